@@ -0,0 +1,17 @@
+#ifndef BACKLOG_H
+#define BACKLOG_H
+
+#include <genesis.h>
+
+// Recently shown scene texts, kept as ids into the ROM text tables so the
+// RAM cost is fixed whatever the story length. The viewer reuses the text
+// box, a long text pages down a line at a time with the box's vscroll and
+// another entry scrolls in the same way.
+#define BACKLOG_ENTRIES  32     // 2 bytes each, the oldest is dropped
+
+void backlogClear();
+void backlogAdd(u16 text);
+bool backlogOpen();
+bool backlogUpdate(u16 pressed);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef BANK_H
+#define BANK_H
+
+#include <genesis.h>
+
+// SSF2 style mapper: the 4 MB address space is eight 512 KB windows and
+// windows 1-7 can show any bank of the ROM. Up to 4 MB the default mapping
+// is used. Past that the ROM header says "SEGA SSF" (src/boot/rom_head.c),
+// code and hot tables must stay below BANK_FAR_BASE and everything from
+// there up is far data (the .rodata_binf section, placed last by the
+// linker). The ROM ends with the far data, so its end gives the bank count.
+#define BANK_SIZE        0x80000
+#define BANK_FAR_WINDOW  6          // Far data is mapped into windows 6 and 7
+#define BANK_FAR_BASE    ((u32) BANK_FAR_WINDOW * BANK_SIZE)
+
+void bankInit(const void* farEnd);          // Linker address past the far data
+const void* bankMapFar(const void* data);   // Valid up to 512 KB past data
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef COLOR_CYCLE_H
+#define COLOR_CYCLE_H
+
+#include <genesis.h>
+
+// Runs of palette entries rotated on a timer, for pulsing or glowing
+// backgrounds without touching tiles or tilemaps. A range belongs to a
+// palette from palette.h, known by its colors, and follows it to whatever
+// slot it has. Once a frame only the CRAM words that changed are queued,
+// through the fade engine so fades keep the cycled colors.
+#define COLOR_CYCLES        4
+
+void colorCycleInit();
+bool colorCycleStart(const u16* palette, u16 first, u16 count, u16 ticks);
+void colorCycleStop(const u16* palette);   // Its ranges, back to the base colors
+void colorCycleClear();
+void colorCycleUpdate();                    // One logic tick
+void colorCycleFlush();                     // Once per frame, before the vblank
+
+#endif
@@ -10,11 +10,44 @@ extern const u16 CATEGORY_COUNT;
 
 // Main tables
 extern const Question * const QUESTIONS;
-extern const Scene    * const SCENES;
 extern const Quiz     * const QUIZZES;
 
 extern const u16 QUESTIONS_COUNT;
-extern const u16 SCENES_COUNT;
 extern const u16 QUIZZES_COUNT;
 
+// Language packs hold all scene and question text and may live in far
+// banks. The accessors map the pack when needed, strings stay valid until
+// the language changes.
+extern const LangPack * const LANG_PACKS[];
+extern const void * const LANG_PACK_ENDS[];     // Linker address past each pack
+extern const u16 LANG_COUNT;
+
+void dataSetLanguage(u16 lang);
+const void* dataFarEnd();                       // For bankInit()
+const char* dataGetSceneText(u16 id);
+const char* dataGetQuestionText(u16 question);
+const char* dataGetAnswerText(u16 question, u16 answer);
+
+// Scene script: SCENE_ENTRIES[scene] is the offset of the scene in SCENE_SCRIPT
+extern const u8  * const SCENE_SCRIPT;
+extern const u16 * const SCENE_ENTRIES;
+
+extern const u16 SCENE_TEXTS_COUNT;
+extern const u16 SCENE_SCRIPT_SIZE;
+extern const u16 SCENES_COUNT;
+
+// Scene choices as a CSR edge array, scene i owns
+// SCENE_CHOICES[SCENE_CHOICE_OFFSETS[i] .. SCENE_CHOICE_OFFSETS[i + 1] - 1]
+extern const SceneChoice * const SCENE_CHOICES;
+extern const u16 * const SCENE_CHOICE_OFFSETS;
+
+#if DEBUG
+// String IDs from scenes.txt, questions.csv and quizzes.txt, debug builds only
+extern const NameHash SCENE_NAMES;
+extern const NameHash QUESTION_NAMES;
+extern const NameHash QUIZ_NAMES;
+
+s16 dataFindName(const NameHash* hash, const char* name);  // Index, -1 if unknown
+#endif
+
 #endif
\ No newline at end of file
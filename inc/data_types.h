@@ -9,29 +9,64 @@ typedef enum {
   SCENE_TYPE_BAD_ENDING = 3
 } SceneType;
 
-// Question
+// Question, the text is in the language packs
 typedef struct {
   u16 id;                
   u16 category_id;       
-  const char *question;  
-  char answerA[20];
-  char answerB[20];
-  char answerC[20];
   u8  correct; 
 } Question;
 
-// Scene
+// Language pack header. Offsets are from the start of the pack, string
+// offsets in the tables are from the start of the strings.
 typedef struct {
-  u16 id;                 
-  SceneType type;
-  const char *text;       
-  s16 nextSceneA;
-  s16 nextSceneB;        
-  s16 triggerQuiz;       
-  s16 questionId;        
-  u8  bg;                 
-  u8  music;              
-} Scene;
+  u32 size;               // whole pack in bytes
+  u16 sceneTextCount;
+  u16 questionCount;
+  u16 sceneTexts;         // u32[sceneTextCount]
+  u16 questionTexts;      // u32[questionCount][4]: question, answers A-C
+  u32 strings;
+} LangPack;
+
+// Scene script opcodes, generated by compile_data.py from scenes.txt.
+// u16 operands are stored big endian right after the opcode byte.
+typedef enum {
+  OP_END = 0,          // stop the script
+  OP_TEXT,             // u16 text: clear the text box and typewrite scene text [text]
+  OP_WAIT_INPUT,       // show "Continue..." and wait for A/B/C
+  OP_WAIT,             // u8 frames
+  OP_JUMP,             // u16 offset
+  OP_SET_FLAG,         // u8 flag
+  OP_CLEAR_FLAG,       // u8 flag
+  OP_JUMP_IF_FLAG,     // u8 flag, u16 offset
+  OP_QUESTION,         // u16 question: single question trial
+  OP_QUIZ,             // u16 quiz: full quiz
+  OP_MUSIC,            // u8 music id
+  OP_BG,               // u8 background id
+  OP_ENDING,           // u8 SceneType
+  OP_CHOICE,           // u16 scene: choice menu over the scene's edges
+  OP_SPRITE,           // u8 sprite animation id, 0 hides
+  OP_ILLUSTRATION      // u8 illustration id, 0 hides
+} SceneOp;
+
+// Flag set by the scene manager when the last quiz was passed
+#define SCENE_FLAG_PASSED 0
+
+// Labeled edge of the scene graph
+typedef struct {
+  u16 label;             // scene text
+  u16 target;            // scene index
+} SceneChoice;
+
+// Minimal perfect hash from the string IDs of the sources to indices,
+// written by compile_data.py. A name goes to slot
+// hash(name, seeds[hash(name, 0) % bucketCount]) % count.
+typedef struct {
+  const char * const *names;    // by index
+  const u16 *seeds;              // per bucket
+  const u16 *slots;              // index in each slot
+  u16 count;
+  u16 bucketCount;
+} NameHash;
 
 // Quiz
 typedef struct {
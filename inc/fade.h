@@ -0,0 +1,19 @@
+#ifndef FADE_H
+#define FADE_H
+
+#include <genesis.h>
+
+// Asynchronous palette fades over PAL0-PAL3. All steps are precomputed
+// when a fade starts, each step is then one queued CRAM DMA.
+#define FADE_STEPS          7   // VDP channels have 8 levels
+#define FADE_TICKS_PER_STEP 2
+
+void fadeInit();
+void fadeSetPalette(u16 pal, const u16* colors);
+void fadeSetColors(u16 index, const u16* colors, u16 count);
+void fadeOut();
+void fadeIn();
+void fadeUpdate();
+bool fadeIsActive();
+
+#endif
\ No newline at end of file
@@ -0,0 +1,14 @@
+#ifndef FONT_DATA_H
+#define FONT_DATA_H
+
+#include <genesis.h>
+
+// Generated by build_font.py: only the glyphs used by the game content
+extern const u16 FONT_GLYPH_COUNT;
+extern const u8  FONT_REMAP[96];         // ASCII - 32 -> glyph
+extern const u8  FONT_GLYPH_LEFT[];      // First used pixel column
+extern const u8  FONT_GLYPH_WIDTH[];     // Used pixel columns
+extern const u16 FONT_PALETTE[16];
+extern const u32 FONT_TILES[];           // 2 tiles per glyph: top then bottom
+
+#endif
\ No newline at end of file
@@ -3,6 +3,9 @@
 
 #include <genesis.h>
 
+#define PLANE_ROWS 32   // SGDK's default 64x32 planes, text wraps around the bottom
+#define FONT_TILE_BASE  (TILE_USER_INDEX + 946)     // 95 glyphs of 2 tiles, up to the text box
+
 
 void initCustomFont();
 
@@ -10,4 +13,26 @@ void C_DrawText(const char* str, u16 x, u16 y, u16 palette);
 
 void C_ClearText(u16 x, u16 y, u16 length);
 
+// A line of text that remembers what it shows. Setting new text rewrites
+// only the span of characters that changed, as two tilemap rows.
+#define TEXT_REGION_MAX 64
+
+typedef struct {
+    VDPPlane plane;
+    u16 x;
+    u16 y;
+    u16 width;
+    u16 palette;
+    u16 len;
+    char text[TEXT_REGION_MAX];     // 0 = blank tile
+} TextRegion;
+
+void C_InitRegion(TextRegion* region, VDPPlane plane, u16 x, u16 y, u16 width, u16 palette);
+void C_SetRegionText(TextRegion* region, const char* str);
+
+// Building region text in a buffer, both return the new end and leave the
+// terminator to the caller
+char* appendText(char* dst, const char* src);
+char* appendNumber(char* dst, u16 value);
+
 #endif
\ No newline at end of file
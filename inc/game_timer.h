@@ -0,0 +1,17 @@
+#ifndef GAME_TIMER_H
+#define GAME_TIMER_H
+
+#include <genesis.h>
+
+// Game logic runs on a fixed 60 Hz tick on both NTSC and PAL machines,
+// rendering stays tied to vblank.
+#define TIMER_TICK_RATE 60
+
+// Max vblanks caught up after a lag frame
+#define TIMER_MAX_CATCHUP 4
+
+void timerInit();
+u16 timerBeginFrame();
+bool timerIsPAL();
+
+#endif
\ No newline at end of file
@@ -0,0 +1,18 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <genesis.h>
+
+// Quiz status line on the window plane, the top HUD_ROWS tile rows. The
+// window ignores plane scrolling and is only written when a value changes.
+// Scenes show a taller window over the scrolling text box and draw their
+// own prompt in it.
+#define HUD_ROWS    2
+#define HUD_X       2
+
+void hudShow(u16 rows);
+void hudHide();
+void hudSetProgress(u16 current, u16 total);
+void hudSetWrong(u16 wrong, u16 limit);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef ILLUSTRATION_H
+#define ILLUSTRATION_H
+
+#include <genesis.h>
+#include "illustration_data.h"
+
+// Full screen pictures on plane B from illustration_data.c. They replace
+// the scene background and sprite tiles, so the caller hides the sprites
+// while one is up and reloads the backgrounds afterwards.
+// The data unpacks through unpack_queue.h over the next frames and
+// illustrationUpdate() puts the picture up once it's all there.
+#define ILLUSTRATION_TILE_BASE  TILE_USER_INDEX
+#define ILLUSTRATION_MAX_TILES  946             // Up to the font tiles
+
+void illustrationShow(u16 id);      // Scene illustration id, from 1
+void illustrationUpdate();
+void illustrationCancel();
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef ILLUSTRATION_DATA_H
+#define ILLUSTRATION_DATA_H
+
+#include <genesis.h>
+
+// Generated by build_illustrations.py from data/illustrations.txt
+typedef struct {
+    u16 tileCount;
+    u16 paletteCount;       // PAL0 up
+    const u8* tiles;        // LZ packed (lz_stream.h), 32 bytes per tile
+    const u8* map;          // LZ packed 40x28 tilemap, tile indices from 0
+    const u16* palettes;
+} Illustration;
+
+extern const u16 ILLUSTRATION_COUNT;
+extern const Illustration ILLUSTRATIONS[];  // Scene illustration id - 1
+
+#endif
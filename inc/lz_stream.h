@@ -0,0 +1,25 @@
+#ifndef LZ_STREAM_H
+#define LZ_STREAM_H
+
+#include <genesis.h>
+
+// Windowed LZ written by build_illustrations.py: u16 unpacked size, then
+// tokens. 0x00-0x7F copies the next n + 1 bytes, 0x80-0xFF repeats
+// (n & 0x7F) + 3 bytes from distance next byte + 1. Matches only reach
+// back 256 bytes, so the stream unpacks in pieces of any size without
+// keeping the output around.
+typedef struct {
+    const u8* src;
+    u16 left;               // Bytes still to produce
+    u8 run;                 // Bytes left in the current token
+    bool match;
+    u8 distance;            // Match distance - 1
+    u8 pos;                 // Write position in the window
+    u8 window[256];
+} LzStream;
+
+void lzStreamInit(LzStream* s, const u8* src);
+u16 lzStreamRead(LzStream* s, u8* dst, u16 max);
+void lzToNativeOrder(u8* data, u16 bytes, u16 width);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include <genesis.h>
+
+// PAL1-PAL3 handed out by reference count, PAL0 stays the font's. A palette
+// is known by its colors: acquiring one already in a slot only counts the
+// reference, otherwise it takes a free slot and the colors go through the
+// fade engine to the vblank DMA queue. Released palettes keep their slot
+// until it's needed, so coming back to them uploads nothing. Renderers ask
+// paletteSlot() for the PALn of their TILE_ATTR_FULL, it can change after
+// a paletteReserve().
+#define PALETTE_SLOTS       4
+#define PALETTE_ENTRIES     8           // Palettes known at once
+#define PALETTE_NONE        0xFFFF
+
+void paletteInit();
+u16 paletteAcquire(const u16* colors);  // Slot, PALETTE_NONE when all are in use
+void paletteRelease(const u16* colors);
+u16 paletteSlot(const u16* colors);     // PALETTE_NONE when not in a slot
+void paletteReserve(u16 count);         // PAL0 up for a full screen picture, 0 gives them back
+
+#endif
@@ -11,18 +11,28 @@ typedef enum {
     SCENE_END = 2
 } NextScene;
 
+// Max script opcodes run per frame, keeps the per-frame cost bounded
+#define SCENE_OPS_PER_FRAME 8
+
 void sceneManagerInit();
 void sceneManagerStart();
+void sceneManagerStartAt(u16 scene);
 void sceneManagerReset();
-void sceneManagerUpdate(u16* lastJoy, SceneType NextScene);
+void sceneManagerUpdate(u16* lastJoy);
 void sceneManagerDraw();
 
 bool sceneManagerShouldTriggerQuiz();
 bool sceneManagerGetTriggeredQuiz(u16* outQuizId);
 bool sceneManagerGetQuestionId(u16* outQuestionId);
-void sceneManagerContinueAfterQuiz(SceneType NextScene);
+void sceneManagerContinueAfterQuiz(NextScene nextScenePath);
 
 u8 sceneManagerGetCurrentBGId();
+u8 sceneManagerGetCurrentMusicId();
+u8 sceneManagerGetCurrentSpriteId();
+u8 sceneManagerGetCurrentIllustrationId();
+s16 sceneManagerGetCurrentScene();               // -1 before the first text
+u16 sceneManagerGetNextScenes(u16* scenes, u16 max);
+void sceneManagerGetSceneLook(u16 scene, u8* bg, u8* sprite);
 bool sceneManagerReachedEnd();
 SceneType sceneManagerGetEndingType();
 
@@ -0,0 +1,21 @@
+#ifndef SCROLL_FX_H
+#define SCROLL_FX_H
+
+#include <genesis.h>
+
+// Plane B scroll effects. Line and row offsets come from the build time
+// tables in scroll_tables.c, a frame costs one queued DMA per table.
+typedef enum {
+    SCROLLFX_NONE,          // Plane B at 0,0
+    SCROLLFX_DRIFT,         // Whole plane drifts diagonally
+    SCROLLFX_WAVE,          // Per line sine wave, vertical drift
+    SCROLLFX_PARALLAX       // Per tile row bands at different speeds
+} ScrollFxMode;
+
+#define SCROLLFX_WAVE_TICKS  2  // Logic ticks per wave phase
+
+void scrollFxSetMode(ScrollFxMode mode, bool columnWave);
+void scrollFxUpdate();
+void scrollFxApply();
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef SCROLL_TABLES_H
+#define SCROLL_TABLES_H
+
+#include <genesis.h>
+
+// Generated by build_scroll_tables.py
+#define SCROLL_LINES            224
+#define SCROLL_ROWS             28
+#define SCROLL_COLUMNS          20
+#define SCROLL_WAVE_PERIOD      64
+#define SCROLL_COLUMN_PERIOD    20
+#define SCROLL_PARALLAX_FRAMES  64
+
+extern const s16 SCROLL_WAVE[];        // Line offsets, frame = &SCROLL_WAVE[phase]
+extern const s16 SCROLL_COLUMN_WAVE[]; // Column offsets, frame = &SCROLL_COLUMN_WAVE[phase]
+extern const s16 SCROLL_PARALLAX[];    // Row offsets, frame = &SCROLL_PARALLAX[frame * SCROLL_ROWS]
+
+#endif
\ No newline at end of file
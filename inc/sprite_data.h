@@ -0,0 +1,36 @@
+#ifndef SPRITE_DATA_H
+#define SPRITE_DATA_H
+
+#include <genesis.h>
+
+// Generated by build_sprites.py from data/sprites.txt
+typedef struct {
+    s8 x;                   // Offset from the animation position in pixels
+    s8 y;
+    u8 size;                // SPRITE_SIZE(w, h)
+    u16 tile;               // First tile in the animation's tiles
+} SpritePiece;
+
+typedef struct {
+    u16 firstPiece;
+    u8 pieceCount;
+    u8 ticks;               // Logic ticks the frame is shown
+} SpriteFrame;
+
+typedef struct {
+    u16 firstFrame;
+    u8 frameCount;
+    u8 loop;
+    s16 x;                  // Screen position in pixels
+    s16 y;
+    u16 tileCount;
+    const u32* tiles;
+    const u16* palette;
+} SpriteAnim;
+
+extern const u16 SPRITE_ANIM_COUNT;
+extern const SpritePiece SPRITE_PIECES[];
+extern const SpriteFrame SPRITE_FRAMES[];
+extern const SpriteAnim  SPRITE_ANIMS[];    // Scene sprite id - 1
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef SPRITE_ENGINE_H
+#define SPRITE_ENGINE_H
+
+#include <genesis.h>
+#include "sprite_data.h"
+
+// Metasprite animations from sprite_data.c. The sprite table is built in
+// RAM and sent in one DMA, only the used entries are linked. The shown
+// animation holds a reference to its own palette in palette.h, so it never
+// draws with a background's slot; the sprites stay hidden while it has none.
+#define SPRITE_TILE_BASE  (TILE_USER_INDEX + 300)   // After the backgrounds, under illustrations
+
+void spriteEngineInit();
+void spriteEngineShow(u16 anim);    // Scene sprite id, 0 hides
+void spriteEngineUpdate();
+void spriteEngineFlush();
+
+#endif
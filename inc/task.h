@@ -0,0 +1,21 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include <genesis.h>
+
+// Long screen updates cut into items and run a frame's budget at a time
+// from taskUpdate(), in the order they were started. A step handles items
+// from..to-1, cost is a rough 68000 cycle count for one item. Input, music
+// and fades keep their frames while a redraw is spread out.
+#define TASK_SLOTS          8
+#define TASK_FRAME_BUDGET   32000   // About a quarter of a frame
+
+typedef void (*TaskStep)(const void* data, u16 from, u16 to);
+
+void taskStart(TaskStep step, const void* data, u16 count, u16 cost);
+void taskUpdate();
+bool taskBusy();
+void taskFinish();                  // Everything left at once
+void taskCancel();
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <genesis.h>
+
+// Play events kept in SRAM across power cycles, decoded on a PC by
+// thirdparty/scripts/telemetry_csv.py. An event only goes into a small RAM
+// queue, telemetryFlush() writes the queue out once a frame.
+//
+// SRAM layout, u16s big endian: "KTL1", session count, next record slot,
+// records written, then TELEMETRY_RECORDS records of 8 bytes as a ring:
+// kind, a, b, c, d (u8, u8, u16, u16, u16).
+//   SESSION  b session number
+//   SCENE    a passed flag on leaving, b scene, c frames in the scene
+//   ANSWER   a answer, b question, c frames to answer, d correct
+//   QUIZ     a passed, b quiz (TELEMETRY_NO_QUIZ for a single question),
+//            c frames in the quiz, d wrong answers
+// SGDK's ROM header declares the SRAM, 2 KB of it is used.
+#define TELEMETRY_RECORDS   254
+#define TELEMETRY_QUEUE     8
+#define TELEMETRY_NO_QUIZ   0xFFFF
+
+typedef enum {
+    TELEMETRY_SESSION = 1,
+    TELEMETRY_SCENE,
+    TELEMETRY_ANSWER,
+    TELEMETRY_QUIZ
+} TelemetryKind;
+
+void telemetryInit();       // Opens a new session
+void telemetryScene(u16 scene, u16 frames, bool passed);
+void telemetryAnswer(u16 question, u8 answer, bool correct, u16 latency);
+void telemetryQuiz(u16 quiz, bool passed, u16 frames, u16 wrong);
+void telemetryFlush();
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef TEXT_BOX_H
+#define TEXT_BOX_H
+
+#include <genesis.h>
+
+// Variable width text box on plane A. Glyphs are packed side by side into
+// a RAM tile buffer and only the changed tiles are uploaded. Lines wrap
+// between words. A cell only gets a tile once a glyph reaches it, so the
+// box needs tiles for the text on screen rather than for all of its
+// cells; compile_data.py checks every scene text fits TEXTBOX_TILES.
+//
+// Text longer than the box scrolls it: lines are laid out down the whole
+// plane height as a ring and the plane A vscroll moves up one line at a
+// time. A new line reuses the tiles of the line that just left the box,
+// whose rows are blanked before the ring brings them back at the bottom.
+// Plane A rows above the box scroll too, keep them under the window.
+#define TEXTBOX_X        2
+#define TEXTBOX_Y        7
+#define TEXTBOX_COLS     36                     // Tiles per line
+#define TEXTBOX_LINES    8                      // Lines of 2 tile rows on screen
+#define TEXTBOX_TILE_BASE (TILE_USER_INDEX + 1136)   // Up to the window plane at 0xB000
+#define TEXTBOX_TILES    256                    // Pairs for a top and a bottom cell
+
+void textBoxInit();
+void textBoxClear();
+void textBoxPutChar(const char* text);          // Puts text[0]
+bool textBoxFits(const char* text);
+void textBoxFlush();
+u16 textBoxGetLineY();
+u16 textBoxPlaneRow(u16 screenRow);
+
+#endif
\ No newline at end of file
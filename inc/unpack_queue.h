@@ -0,0 +1,22 @@
+#ifndef UNPACK_QUEUE_H
+#define UNPACK_QUEUE_H
+
+#include <genesis.h>
+
+// Background unpacking of lz_stream.h data, a job at a time in queue
+// order. unpackQueueUpdate() moves the front job on once per frame so
+// text and input keep going meanwhile. While no music plays the Z80 runs
+// the job (z80_unpack.s80), the 68000 only feeds it the packed data and
+// copies its output, else the 68000 unpacks UNPACK_SLICE_BYTES a frame
+// itself.
+#define UNPACK_JOBS         4
+#define UNPACK_SLICE_BYTES  512     // Multiple of a tile
+
+bool unpackQueueTiles(const u8* packed, u16 tile);  // FALSE when full
+bool unpackQueueRAM(const u8* packed, u8* dst);
+void unpackQueueUpdate();
+bool unpackQueueBusy();
+void unpackQueueFinish();           // Runs the jobs to the end, for loads out of view
+void unpackQueueClear();
+
+#endif
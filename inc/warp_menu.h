@@ -0,0 +1,23 @@
+#ifndef WARP_MENU_H
+#define WARP_MENU_H
+
+#include <genesis.h>
+
+// Debug builds only (make debug defines DEBUG): a title screen menu that
+// warps straight to a scene, quiz or question by its string ID. Up/Down
+// change the letter under the cursor, Left/Right move it, B fills in the
+// next known name, A warps and C goes back to the title.
+typedef enum {
+    WARP_NONE,          // Menu still open
+    WARP_CLOSED,
+    WARP_SCENE,
+    WARP_QUIZ,
+    WARP_QUESTION
+} WarpKind;
+
+#define WARP_NAME_MAX 20
+
+void warpMenuOpen();
+WarpKind warpMenuUpdate(u16 pressed, u16* index);
+
+#endif
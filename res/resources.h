@@ -6,7 +6,6 @@
 extern const u8 bgMusic_01[9984];
 extern const u8 quizMusic_01[11776];
 extern const Image skullBgTile;
-extern const Image customFontTiles;
 extern const Image greenBg;
 extern const Image redBg;
 
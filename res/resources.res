@@ -1,6 +1,5 @@
 IMAGE skullBgTile "SkullTileRealBig.png" BEST NONE
 XGM bgMusic_01 "spookyGob1.vgm" -1
 XGM quizMusic_01 "spookyGobQuiz.vgm" -1
-IMAGE customFontTiles "Font.png" BEST NONE
 IMAGE greenBg "Sprite-0006.png" BEST NONE
 IMAGE redBg "image.png" BEST NONE
\ No newline at end of file
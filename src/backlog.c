@@ -0,0 +1,127 @@
+#include "backlog.h"
+#include "functions.h"
+#include "text_box.h"
+#include "data_load.h"
+
+static u16 g_entries[BACKLOG_ENTRIES];
+static u16 g_head = 0;          // Next slot to write
+static u16 g_count = 0;
+
+// Viewer state
+static TextRegion g_header;
+static bool g_open = FALSE;
+static u16 g_view = 0;          // 0 is the newest entry
+static const char* g_text = NULL;
+static u16 g_pos = 0;           // Next character of g_text
+static u16 g_len = 0;
+static u16 g_scrollLines = 0;   // Box lines left to scroll to another entry
+
+void backlogClear() {
+    g_head = 0;
+    g_count = 0;
+    g_open = FALSE;
+}
+
+void backlogAdd(u16 text) {
+    // A script loop showing the same text again doesn't fill the log
+    if(g_count && g_entries[(g_head + BACKLOG_ENTRIES - 1) % BACKLOG_ENTRIES] == text) return;
+    
+    g_entries[g_head] = text;
+    g_head = (g_head + 1) % BACKLOG_ENTRIES;
+    if(g_count < BACKLOG_ENTRIES) g_count++;
+}
+
+// Puts characters up to the end of the current line
+static void revealLine() {
+    while(g_pos < g_len && textBoxFits(&g_text[g_pos])) {
+        textBoxPutChar(&g_text[g_pos++]);
+    }
+}
+
+// The character that breaks the line starts the next one, past the
+// bottom the box scrolls up
+static bool nextLine() {
+    if(g_pos >= g_len) return FALSE;
+    textBoxPutChar(&g_text[g_pos++]);
+    revealLine();
+    return TRUE;
+}
+
+// "Backlog <n>/<count>", oldest first
+static void drawHeader() {
+    char buf[TEXT_REGION_MAX];
+    char* p = appendText(buf, "Backlog ");
+    p = appendNumber(p, g_count - g_view);
+    p = appendText(p, "/");
+    p = appendNumber(p, g_count);
+    *p = 0;
+    C_SetRegionText(&g_header, buf);
+}
+
+static void selectEntry(u16 view) {
+    g_view = view;
+    g_text = dataGetSceneText(g_entries[(g_head + BACKLOG_ENTRIES - 1 - view) % BACKLOG_ENTRIES]);
+    g_len = strlen(g_text);
+    g_pos = 0;
+    drawHeader();
+}
+
+// Another entry doesn't redraw the box, it scrolls in with the box's
+// vscroll: blank lines push the shown text out, so the two entries never
+// share the tile pool, then the new text comes up from the bottom until
+// its first line is at the top.
+static void pageTo(u16 view) {
+    selectEntry(view);
+    g_scrollLines = TEXTBOX_LINES * 2 - 1;
+}
+
+// A line of the page scroll, called once per frame
+static void scrollStep() {
+    if(g_scrollLines >= TEXTBOX_LINES) {
+        textBoxPutChar("\n");
+        if(g_scrollLines == TEXTBOX_LINES) revealLine();
+    } else if(!nextLine()) {
+        textBoxPutChar("\n");
+    }
+    g_scrollLines--;
+}
+
+// Opens on the newest entry, FALSE if nothing was shown yet. The caller
+// clears plane A first.
+bool backlogOpen() {
+    if(!g_count) return FALSE;
+    
+    C_InitRegion(&g_header, WINDOW, 8, 3, 24, PAL0);
+    g_open = TRUE;
+    g_scrollLines = 0;
+    selectEntry(0);
+    
+    textBoxClear();
+    revealLine();
+    for(u16 line = 1; line < TEXTBOX_LINES && nextLine(); line++);
+    return TRUE;
+}
+
+// Up/Down older/newer, A or C next line of a long text, B or START closes.
+// Returns FALSE once closed, the caller redraws its screen. Keys other
+// than closing wait for a page scroll to finish.
+bool backlogUpdate(u16 pressed) {
+    if(!g_open) return FALSE;
+    
+    if(pressed & (BUTTON_B | BUTTON_START)) {
+        C_SetRegionText(&g_header, "");
+        g_open = FALSE;
+        return FALSE;
+    }
+    
+    if(g_scrollLines) {
+        scrollStep();
+    } else if((pressed & BUTTON_UP) && g_view + 1 < g_count) {
+        pageTo(g_view + 1);
+    } else if((pressed & BUTTON_DOWN) && g_view > 0) {
+        pageTo(g_view - 1);
+    } else if(pressed & (BUTTON_A | BUTTON_C)) {
+        nextLine();
+    }
+    return TRUE;
+}
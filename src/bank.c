@@ -0,0 +1,38 @@
+#include "bank.h"
+
+#define BANK_WINDOWS     8
+#define BANK_REGISTER(w) ((vu8*) (0xA130F1 + (w) * 2))
+
+static u8 g_mapped[BANK_WINDOWS];   // Bank shown in each window
+static u16 g_banks = 0;             // Banks in the ROM, 0 when it fits the default mapping
+
+static void mapWindow(u16 window, u16 bank) {
+    if(g_mapped[window] == bank) return;
+    
+    g_mapped[window] = bank;
+    *BANK_REGISTER(window) = bank;
+}
+
+// The mapper is only touched when the far data ends past 4 MB
+void bankInit(const void* farEnd) {
+    u32 size = (u32) farEnd;
+    if(size <= (u32) BANK_WINDOWS * BANK_SIZE) return;
+    
+    g_banks = (size + BANK_SIZE - 1) / BANK_SIZE;
+    for(u16 w = 1; w < BANK_WINDOWS; w++) {
+        g_mapped[w] = 0xFF;
+        mapWindow(w, w);
+    }
+}
+
+// Maps the bank holding data and the next one, the mapper is only written
+// when that changes
+const void* bankMapFar(const void* data) {
+    u32 addr = (u32) data;
+    if(!g_banks || addr < BANK_FAR_BASE) return data;
+    
+    u16 bank = addr / BANK_SIZE;
+    mapWindow(BANK_FAR_WINDOW, bank);
+    mapWindow(BANK_FAR_WINDOW + 1, min(bank + 1, g_banks - 1));
+    return (const void*) (BANK_FAR_BASE + (addr % BANK_SIZE));
+}
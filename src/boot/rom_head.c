@@ -0,0 +1,29 @@
+#include "genesis.h"
+
+// The project's copy of SGDK's boot/rom_head.c, makefile.gen uses it in
+// place of the library's. "SEGA SSF" turns the SSF2 mapper on in
+// emulators and flash carts, bank.c only writes it once the far data is
+// past 4 MB. The header is built before the ROM is linked, so it gives
+// the last address the mapper reaches and bankInit() takes the real size
+// from the far data.
+__attribute__((externally_visible))
+const ROMHeader rom_header = {
+    "SEGA SSF        ",
+    "(C)GGG 2015     ",
+    "KNOWING                                         ",
+    "KNOWING                                         ",
+    "GM 00000000-00",
+    0x000,
+    "JD              ",
+    0x00000000,
+    0x01FFFFFF,         // 64 banks of 512 KB
+    0xE0FF0000,
+    0xE0FFFFFF,
+    "RA",
+    0xF820,
+    0x00200000,
+    0x0020FFFF,
+    "            ",
+    "GENESIS GAME JAM                        ",
+    "JUE             "
+};
@@ -0,0 +1,101 @@
+#include "color_cycle.h"
+#include "palette.h"
+#include "fade.h"
+
+typedef struct {
+    const u16* palette;     // Base colors, NULL for a free range
+    u16 first;
+    u16 count;
+    u16 ticks;              // Per step
+    u16 timer;
+    u16 phase;
+    u16 slot;               // Where shown went, PALETTE_NONE while nowhere
+    u16 shown[16];          // Range colors in CRAM
+} ColorCycle;
+
+static ColorCycle g_cycles[COLOR_CYCLES];
+
+// Forward declarations
+static void upload(ColorCycle* cycle, u16 phase);
+
+void colorCycleInit() {
+    memset(g_cycles, 0, sizeof(g_cycles));
+}
+
+bool colorCycleStart(const u16* palette, u16 first, u16 count, u16 ticks) {
+    if(!palette || count < 2 || first + count > 16) return FALSE;
+    
+    for(u16 i = 0; i < COLOR_CYCLES; i++) {
+        ColorCycle* cycle = &g_cycles[i];
+        if(cycle->palette) continue;
+        
+        cycle->palette = palette;
+        cycle->first = first;
+        cycle->count = count;
+        cycle->ticks = max(ticks, 1);
+        cycle->timer = 0;
+        cycle->phase = 0;
+        cycle->slot = PALETTE_NONE;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+void colorCycleStop(const u16* palette) {
+    for(u16 i = 0; i < COLOR_CYCLES; i++) {
+        ColorCycle* cycle = &g_cycles[i];
+        if(!palette || cycle->palette != palette) continue;
+        
+        upload(cycle, 0);
+        cycle->palette = NULL;
+    }
+}
+
+void colorCycleClear() {
+    for(u16 i = 0; i < COLOR_CYCLES; i++) {
+        if(g_cycles[i].palette) colorCycleStop(g_cycles[i].palette);
+    }
+}
+
+// One logic tick
+void colorCycleUpdate() {
+    for(u16 i = 0; i < COLOR_CYCLES; i++) {
+        ColorCycle* cycle = &g_cycles[i];
+        if(!cycle->palette || ++cycle->timer < cycle->ticks) continue;
+        
+        cycle->timer = 0;
+        cycle->phase = (cycle->phase + 1) % cycle->count;
+    }
+}
+
+void colorCycleFlush() {
+    for(u16 i = 0; i < COLOR_CYCLES; i++) {
+        if(g_cycles[i].palette) upload(&g_cycles[i], g_cycles[i].phase);
+    }
+}
+
+// Queues the span of the range whose colors differ from CRAM
+static void upload(ColorCycle* cycle, u16 phase) {
+    u16 slot = paletteSlot(cycle->palette);
+    const u16* base = cycle->palette + cycle->first;
+    
+    if(slot != cycle->slot) {
+        // The palette manager just put the base colors there
+        cycle->slot = slot;
+        memcpy(cycle->shown, base, cycle->count * 2);
+    }
+    if(slot == PALETTE_NONE) return;
+    
+    s16 lo = -1, hi = -1;
+    for(u16 i = 0, src = phase; i < cycle->count; i++) {
+        if(cycle->shown[i] != base[src]) {
+            cycle->shown[i] = base[src];
+            if(lo < 0) lo = i;
+            hi = i;
+        }
+        if(++src == cycle->count) src = 0;
+    }
+    if(lo < 0) return;
+    
+    fadeSetColors(slot * 16 + cycle->first + lo, &cycle->shown[lo], hi - lo + 1);
+}
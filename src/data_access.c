@@ -0,0 +1,65 @@
+#include "data_load.h"
+#include "bank.h"
+
+static const LangPack* g_lang = NULL;   // Linker address, may be far
+
+void dataSetLanguage(u16 lang) {
+    if(lang >= LANG_COUNT) lang = 0;
+    g_lang = LANG_PACKS[lang];
+}
+
+// The packs are the far data, its end is the last pack's
+const void* dataFarEnd() {
+    const void* end = NULL;
+    for(u16 i = 0; i < LANG_COUNT; i++) {
+        if((u32) LANG_PACK_ENDS[i] > (u32) end) end = LANG_PACK_ENDS[i];
+    }
+    return end;
+}
+
+static const u8* langBase() {
+    if(g_lang == NULL) dataSetLanguage(0);
+    return bankMapFar(g_lang);
+}
+
+static const char* langString(u16 table, u16 index) {
+    const u8* base = langBase();
+    const LangPack* pack = (const LangPack*) base;
+    const u32* offsets = (const u32*) (base + table);
+    return (const char*) (base + pack->strings + offsets[index]);
+}
+
+const char* dataGetSceneText(u16 id) {
+    const LangPack* pack = (const LangPack*) langBase();
+    return langString(pack->sceneTexts, id);
+}
+
+const char* dataGetQuestionText(u16 question) {
+    const LangPack* pack = (const LangPack*) langBase();
+    return langString(pack->questionTexts, question * 4);
+}
+
+const char* dataGetAnswerText(u16 question, u16 answer) {
+    const LangPack* pack = (const LangPack*) langBase();
+    return langString(pack->questionTexts, question * 4 + 1 + answer);
+}
+
+#if DEBUG
+
+// Same hash as name_hash() in compile_data.py
+static u16 nameHash(const char* name, u16 seed) {
+    u16 h = seed;
+    while(*name) h = (h ^ (u8) *name++) * 0x9E3BU;
+    return h ^ (h >> 8);
+}
+
+s16 dataFindName(const NameHash* hash, const char* name) {
+    if(!hash->count) return -1;
+    
+    u16 seed = hash->seeds[nameHash(name, 0) % hash->bucketCount];
+    u16 index = hash->slots[nameHash(name, seed) % hash->count];
+    // Names not in the table land in some slot too
+    return strcmp(hash->names[index], name) ? -1 : (s16) index;
+}
+
+#endif
@@ -27,984 +27,781 @@ static const Question QUESTIONS_DATA[] = {
   {
     .id = 0,
     .category_id = 13,
-    .question = "Which country won the 2018 FIFA World Cup?",
-    .answerA = "Germany",
-    .answerB = "France",
-    .answerC = "Brazil",
     .correct = 1,
   },
   {
     .id = 1,
     .category_id = 13,
-    .question = "In basketball how many points is a free throw worth?",
-    .answerA = "1",
-    .answerB = "2",
-    .answerC = "3",
     .correct = 0,
   },
   {
     .id = 2,
     .category_id = 13,
-    .question = "Who has won the most Olympic gold medals?",
-    .answerA = "Usain Bolt",
-    .answerB = "Michael Phelps",
-    .answerC = "Carl Lewis",
     .correct = 1,
   },
   {
     .id = 3,
     .category_id = 13,
-    .question = "Which sport uses the term 'love' for zero?",
-    .answerA = "Badminton",
-    .answerB = "Tennis",
-    .answerC = "Cricket",
     .correct = 1,
   },
   {
     .id = 4,
     .category_id = 13,
-    .question = "Where were the 2016 Summer Olympics held?",
-    .answerA = "Tokyo",
-    .answerB = "Rio de Janeiro",
-    .answerC = "London",
     .correct = 1,
   },
   {
     .id = 5,
     .category_id = 13,
-    .question = "Which country hosts the Tour de France?",
-    .answerA = "Spain",
-    .answerB = "France",
-    .answerC = "Italy",
     .correct = 1,
   },
   {
     .id = 6,
     .category_id = 13,
-    .question = "How long is a marathon?",
-    .answerA = "26.2 miles",
-    .answerB = "24.5 miles",
-    .answerC = "28 miles",
     .correct = 0,
   },
   {
     .id = 7,
     .category_id = 13,
-    .question = "Which NFL team has won the most Super Bowls?",
-    .answerA = "Dallas Cowboys",
-    .answerB = "New England Patriots",
-    .answerC = "Pittsburgh Steelers",
     .correct = 2,
   },
   {
     .id = 8,
     .category_id = 13,
-    .question = "Who is known as \"The King\" in football (soccer)?",
-    .answerA = "Maradona",
-    .answerB = "Pelé",
-    .answerC = "Messi",
     .correct = 1,
   },
   {
     .id = 9,
     .category_id = 13,
-    .question = "What is the term for one stroke under par in golf?",
-    .answerA = "Eagle",
-    .answerB = "Birdie",
-    .answerC = "Bogey",
     .correct = 1,
   },
   {
     .id = 10,
     .category_id = 11,
-    .question = "Who is known as the \"King of Pop\"?",
-    .answerA = "Elvis Presley",
-    .answerB = "Michael Jackson",
-    .answerC = "Prince",
     .correct = 1,
   },
   {
     .id = 11,
     .category_id = 11,
-    .question = "Which band released the album \"Abbey Road\"?",
-    .answerA = "The Rolling Stones",
-    .answerB = "The Beatles",
-    .answerC = "Queen",
     .correct = 1,
   },
   {
     .id = 12,
     .category_id = 11,
-    .question = "What instrument does a pianist play?",
-    .answerA = "Guitar",
-    .answerB = "Piano",
-    .answerC = "Drums",
     .correct = 1,
   },
   {
     .id = 13,
     .category_id = 11,
-    .question = "Who sang \"Someone Like You\"?",
-    .answerA = "Adele",
-    .answerB = "Taylor Swift",
-    .answerC = "Beyoncé",
     .correct = 0,
   },
   {
     .id = 14,
     .category_id = 11,
-    .question = "Which music genre is associated with Bob Marley?",
-    .answerA = "Reggae",
-    .answerB = "Rock",
-    .answerC = "Jazz",
     .correct = 0,
   },
   {
     .id = 15,
     .category_id = 11,
-    .question = "What is the highest male singing voice?",
-    .answerA = "Baritone",
-    .answerB = "Tenor",
-    .answerC = "Bass",
     .correct = 1,
   },
   {
     .id = 16,
     .category_id = 11,
-    .question = "Who was the lead singer of Queen?",
-    .answerA = "Freddie Mercury",
-    .answerB = "David Bowie",
-    .answerC = "Robert Plant",
     .correct = 0,
   },
   {
     .id = 17,
     .category_id = 11,
-    .question = "Which country did K-pop originate from?",
-    .answerA = "Japan",
-    .answerB = "China",
-    .answerC = "South Korea",
     .correct = 2,
   },
   {
     .id = 18,
     .category_id = 11,
-    .question = "Which classical composer became deaf?",
-    .answerA = "Beethoven",
-    .answerB = "Mozart",
-    .answerC = "Chopin",
     .correct = 0,
   },
   {
     .id = 19,
     .category_id = 11,
-    .question = "Who sang the hit song \"Blinding Lights\"?",
-    .answerA = "The Weeknd",
-    .answerB = "Drake",
-    .answerC = "Post Malone",
     .correct = 0,
   },
   {
     .id = 20,
     .category_id = 0,
-    .question = "What is the capital of France?",
-    .answerA = "Rome",
-    .answerB = "Paris",
-    .answerC = "Berlin",
     .correct = 1,
   },
   {
     .id = 21,
     .category_id = 0,
-    .question = "Which continent is the Sahara Desert located in?",
-    .answerA = "Asia",
-    .answerB = "Australia",
-    .answerC = "Africa",
     .correct = 2,
   },
   {
     .id = 22,
     .category_id = 0,
-    .question = "Mount Everest lies on the border of Nepal and which country?",
-    .answerA = "India",
-    .answerB = "China",
-    .answerC = "Bhutan",
     .correct = 1,
   },
   {
     .id = 23,
     .category_id = 0,
-    .question = "What is the largest ocean on Earth?",
-    .answerA = "Atlantic",
-    .answerB = "Pacific",
-    .answerC = "Indian",
     .correct = 1,
   },
   {
     .id = 24,
     .category_id = 0,
-    .question = "Which country has the most people?",
-    .answerA = "India",
-    .answerB = "USA",
-    .answerC = "China",
     .correct = 0,
   },
   {
     .id = 25,
     .category_id = 0,
-    .question = "What is the longest river in the world?",
-    .answerA = "Amazon",
-    .answerB = "Nile",
-    .answerC = "Mississippi",
     .correct = 1,
   },
   {
     .id = 26,
     .category_id = 0,
-    .question = "Which U.S. state is known as \"The Sunshine State\"?",
-    .answerA = "California",
-    .answerB = "Florida",
-    .answerC = "Texas",
     .correct = 1,
   },
   {
     .id = 27,
     .category_id = 0,
-    .question = "What is the smallest country in the world?",
-    .answerA = "Monaco",
-    .answerB = "Vatican City",
-    .answerC = "San Marino",
     .correct = 1,
   },
   {
     .id = 28,
     .category_id = 0,
-    .question = "Which desert covers much of northern Africa?",
-    .answerA = "Gobi",
-    .answerB = "Sahara",
-    .answerC = "Kalahari",
     .correct = 1,
   },
   {
     .id = 29,
     .category_id = 0,
-    .question = "Which city is known as the \"Big Apple\"?",
-    .answerA = "Los Angeles",
-    .answerB = "Chicago",
-    .answerC = "New York City",
     .correct = 2,
   },
   {
     .id = 30,
     .category_id = 1,
-    .question = "When did World War II end?",
-    .answerA = "1943",
-    .answerB = "1945",
-    .answerC = "1947",
     .correct = 1,
   },
   {
     .id = 31,
     .category_id = 1,
-    .question = "Who was the first President of the United States?",
-    .answerA = "George Washington",
-    .answerB = "Thomas Jefferson",
-    .answerC = "Abraham Lincoln",
     .correct = 0,
   },
   {
     .id = 32,
     .category_id = 1,
-    .question = "In which year did the Titanic sink?",
-    .answerA = "1910",
-    .answerB = "1912",
-    .answerC = "1914",
     .correct = 1,
   },
   {
     .id = 33,
     .category_id = 1,
-    .question = "Who discovered America in 1492?",
-    .answerA = "Christopher Columbus",
-    .answerB = "Ferdinand Magellan",
-    .answerC = "Marco Polo",
     .correct = 0,
   },
   {
     .id = 34,
     .category_id = 1,
-    .question = "What wall fell in 1989 symbolizing the end of the Cold War?",
-    .answerA = "Berlin Wall",
-    .answerB = "Great Wall of China",
-    .answerC = "Hadrian’s Wall",
     .correct = 0,
   },
   {
     .id = 35,
     .category_id = 1,
-    .question = "Who was the British Prime Minister during most of World War II?",
-    .answerA = "Winston Churchill",
-    .answerB = "Neville Chamberlain",
-    .answerC = "Margaret Thatcher",
     .correct = 0,
   },
   {
     .id = 36,
     .category_id = 1,
-    .question = "Which empire built the Colosseum?",
-    .answerA = "Greek",
-    .answerB = "Roman",
-    .answerC = "Byzantine",
     .correct = 1,
   },
   {
     .id = 37,
     .category_id = 1,
-    .question = "What was the name of the ship that brought the Pilgrims to America?",
-    .answerA = "Santa Maria",
-    .answerB = "Mayflower",
-    .answerC = "Endeavour",
     .correct = 1,
   },
   {
     .id = 38,
     .category_id = 1,
-    .question = "Who was known as the Maid of Orléans?",
-    .answerA = "Catherine the Great",
-    .answerB = "Joan of Arc",
-    .answerC = "Marie Antoinette",
     .correct = 1,
   },
   {
     .id = 39,
     .category_id = 1,
-    .question = "In which year did humans first land on the moon?",
-    .answerA = "1965",
-    .answerB = "1969",
-    .answerC = "1972",
     .correct = 1,
   },
   {
     .id = 40,
     .category_id = 12,
-    .question = "What planet is known as the Red Planet?",
-    .answerA = "Venus",
-    .answerB = "Mars",
-    .answerC = "Jupiter",
     .correct = 1,
   },
   {
     .id = 41,
     .category_id = 12,
-    .question = "What is the chemical symbol for water?",
-    .answerA = "H2O",
-    .answerB = "O2",
-    .answerC = "CO2",
     .correct = 0,
   },
   {
     .id = 42,
     .category_id = 12,
-    .question = "How many bones are in the adult human body?",
-    .answerA = "206",
-    .answerB = "210",
-    .answerC = "215",
     .correct = 0,
   },
   {
     .id = 43,
     .category_id = 12,
-    .question = "What gas do plants absorb during photosynthesis?",
-    .answerA = "Oxygen",
-    .answerB = "Carbon Dioxide",
-    .answerC = "Nitrogen",
     .correct = 1,
   },
   {
     .id = 44,
     .category_id = 12,
-    .question = "What is the speed of light?",
-    .answerA = "300",
-    .answerB = "000 km/s",
-    .answerC = "150",
     .correct = 0,
   },
   {
     .id = 45,
     .category_id = 12,
-    .question = "Who developed the theory of relativity?",
-    .answerA = "Isaac Newton",
-    .answerB = "Albert Einstein",
-    .answerC = "Galileo Galilei",
     .correct = 1,
   },
   {
     .id = 46,
     .category_id = 12,
-    .question = "What part of the atom has a positive charge?",
-    .answerA = "Electron",
-    .answerB = "Proton",
-    .answerC = "Neutron",
     .correct = 1,
   },
   {
     .id = 47,
     .category_id = 12,
-    .question = "Which planet is closest to the Sun?",
-    .answerA = "Venus",
-    .answerB = "Mercury",
-    .answerC = "Earth",
     .correct = 1,
   },
   {
     .id = 48,
     .category_id = 12,
-    .question = "What is the process of water turning into vapor called?",
-    .answerA = "Condensation",
-    .answerB = "Evaporation",
-    .answerC = "Precipitation",
     .correct = 1,
   },
   {
     .id = 49,
     .category_id = 12,
-    .question = "What is the hardest natural substance on Earth?",
-    .answerA = "Gold",
-    .answerB = "Iron",
-    .answerC = "Diamond",
     .correct = 2,
   },
   {
     .id = 50,
     .category_id = 14,
-    .question = "What is the best-selling video game of all time?",
-    .answerA = "Minecraft",
-    .answerB = "Tetris",
-    .answerC = "GTA V",
     .correct = 0,
   },
   {
     .id = 51,
     .category_id = 14,
-    .question = "Which company created the PlayStation console?",
-    .answerA = "Sega",
-    .answerB = "Nintendo",
-    .answerC = "Sony",
     .correct = 2,
   },
   {
     .id = 52,
     .category_id = 14,
-    .question = "What is the name of Mario’s brother?",
-    .answerA = "Luigi",
-    .answerB = "Yoshi",
-    .answerC = "Wario",
     .correct = 0,
   },
   {
     .id = 53,
     .category_id = 14,
-    .question = "Which game features the character Master Chief?",
-    .answerA = "Halo",
-    .answerB = "Call of Duty",
-    .answerC = "Destiny",
     .correct = 0,
   },
   {
     .id = 54,
     .category_id = 14,
-    .question = "In which game do players compete in a battle royale on an island?",
-    .answerA = "Overwatch",
-    .answerB = "Fortnite",
-    .answerC = "Apex Legends",
     .correct = 1,
   },
   {
     .id = 55,
     .category_id = 14,
-    .question = "What Pokémon is number 25 in the Pokédex?",
-    .answerA = "Bulbasaur",
-    .answerB = "Pikachu",
-    .answerC = "Charmander",
     .correct = 1,
   },
   {
     .id = 56,
     .category_id = 14,
-    .question = "What is the main currency in The Legend of Zelda?",
-    .answerA = "Gold",
-    .answerB = "Rupees",
-    .answerC = "Coins",
     .correct = 1,
   },
   {
     .id = 57,
     .category_id = 14,
-    .question = "Which game series features locations like Vice City and Los Santos?",
-    .answerA = "GTA",
-    .answerB = "Red Dead Redemption",
-    .answerC = "Saints Row",
     .correct = 0,
   },
   {
     .id = 58,
     .category_id = 14,
-    .question = "Who is the creator of the game Minecraft?",
-    .answerA = "Gabe Newell",
-    .answerB = "Notch",
-    .answerC = "Hideo Kojima",
     .correct = 1,
   },
   {
     .id = 59,
     .category_id = 14,
-    .question = "Which company developed the game “Overwatch”?",
-    .answerA = "Valve",
-    .answerB = "Blizzard",
-    .answerC = "Ubisoft",
     .correct = 1,
   },
   {
     .id = 60,
     .category_id = 6,
-    .question = "1.1.2.3.5... What comes next?",
-    .answerA = "8",
-    .answerB = "9",
-    .answerC = "10",
     .correct = 0,
   },
   {
     .id = 61,
     .category_id = 7,
-    .question = "If English is English what's Japanese?",
-    .answerA = "Japanese",
-    .answerB = "Nihongo",
-    .answerC = "English",
     .correct = 2,
   },
   {
     .id = 62,
     .category_id = 8,
-    .question = "If a book costs $1 plus half its cost what's its cost?",
-    .answerA = "$1.50",
-    .answerB = "$1.75",
-    .answerC = "$2.00",
     .correct = 2,
   },
   {
     .id = 63,
     .category_id = 9,
-    .question = "What to ask one always honest and one always lying guards?",
-    .answerA = "Which way?",
-    .answerB = "Other guard's choice",
-    .answerC = "Who is a liar?",
     .correct = 1,
   },
   {
     .id = 64,
     .category_id = 10,
-    .question = "Wolf goat and cabbage. Cross with which first?",
-    .answerA = "Wolf",
-    .answerB = "Goat",
-    .answerC = "Cabbage",
     .correct = 1,
   },
   {
     .id = 65,
     .category_id = 2,
-    .question = "What is the C Major third?",
-    .answerA = "E",
-    .answerB = "F",
-    .answerC = "G",
     .correct = 0,
   },
   {
     .id = 66,
     .category_id = 3,
-    .question = "Whose philosophy is quoted as 'I think therefore I am'?",
-    .answerA = "Jean-Paul Sartre",
-    .answerB = "Aristotle",
-    .answerC = "Rene Descartes",
     .correct = 2,
   },
   {
     .id = 67,
     .category_id = 4,
-    .question = "Which was invented first?",
-    .answerA = "Sandwich",
-    .answerB = "Sliced bread",
-    .answerC = "Mahjong",
     .correct = 0,
   },
   {
     .id = 68,
     .category_id = 5,
-    .question = "What phenomena does Schrodinger's Cat explore?",
-    .answerA = "Logic puzzles",
-    .answerB = "Quantum mechanics",
-    .answerC = "Cognitive dissonance",
     .correct = 1,
   },
 };
 const Question * const QUESTIONS = QUESTIONS_DATA;
 const u16 QUESTIONS_COUNT = 69;
 
-// ---- Scenes ----
-static const Scene SCENES_DATA[] = {
-  {
-    .id = 0,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "Intuition is somewhat magical in a dream. \nYou don't know why, but you make these connections \nbetween what you need to do and what is correct.",
-    .nextSceneA = 1,
-    .nextSceneB = 1,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 1,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "Perhaps you're still in a dream when you wake, \nwhen you find yourself in an empty room.",
-    .nextSceneA = 2,
-    .nextSceneB = 2,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 2,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "You feel like you should know what to do next. \nMaybe you do know what to do next. \nMaybe you've always known. \nOr maybe you're just learning.",
-    .nextSceneA = 3,
-    .nextSceneB = 3,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 3,
-    .type = SCENE_TYPE_QUIZ_TRIGGER,
-    .text = "Maybe if you focus on what you do know, the rest will come naturally. \n\nStart small.",
-    .nextSceneA = 5,
-    .nextSceneB = 4,
-    .triggerQuiz = -1,
-    .questionId = 60,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 4,
-    .type = SCENE_TYPE_BAD_ENDING,
-    .text = "You turn to the red door. \nIt seems like the only door you could enter. \nIt's only natural that you enter it.",
-    .nextSceneA = -1,
-    .nextSceneB = -1,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 2, .music = 0,
-  },
-  {
-    .id = 5,
-    .type = SCENE_TYPE_QUIZ_TRIGGER,
-    .text = "A voice slithers from the corner of the room. \nIt chills you to the bone and freezes you in place. \nNOW YOU MUST ANSWER!",
-    .nextSceneA = 13,
-    .nextSceneB = 9,
-    .triggerQuiz = -1,
-    .questionId = 65,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 6,
-    .type = SCENE_TYPE_QUIZ_TRIGGER,
-    .text = "A voice slithers from the corner of the room. \nIt chills you to the bone and freezes you in place. \nNOW YOU MUST ANSWER!",
-    .nextSceneA = 14,
-    .nextSceneB = 10,
-    .triggerQuiz = -1,
-    .questionId = 66,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 7,
-    .type = SCENE_TYPE_QUIZ_TRIGGER,
-    .text = "A voice slithers from the corner of the room. \nIt chills you to the bone and freezes you in place. \nNOW YOU MUST ANSWER!",
-    .nextSceneA = 15,
-    .nextSceneB = 11,
-    .triggerQuiz = -1,
-    .questionId = 67,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 8,
-    .type = SCENE_TYPE_QUIZ_TRIGGER,
-    .text = "A voice slithers from the corner of the room. \nIt chills you to the bone and freezes you in place. \nNOW YOU MUST ANSWER!",
-    .nextSceneA = 16,
-    .nextSceneB = 12,
-    .triggerQuiz = -1,
-    .questionId = 68,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 9,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "The demon cackles. \nYOU'RE ON YOUR OWN!",
-    .nextSceneA = 17,
-    .nextSceneB = 17,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 10,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "The demon cackles. \nYOU'RE ON YOUR OWN!",
-    .nextSceneA = 19,
-    .nextSceneB = 19,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 11,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "The demon cackles. \nYOU'RE ON YOUR OWN!",
-    .nextSceneA = 21,
-    .nextSceneB = 21,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 12,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "The demon cackles. \nYOU'RE ON YOUR OWN!",
-    .nextSceneA = 22,
-    .nextSceneB = 22,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 13,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "The demon smiles the most awful smile. \nREMEMBER, ENGLISH IS AN ENGLISH WORD! \nREMEMBER!",
-    .nextSceneA = 17,
-    .nextSceneB = 17,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 14,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "The demon smiles the most awful smile. \nREMEMBER, A THING COSTS WHAT IT COSTS! \nREMEMBER!",
-    .nextSceneA = 19,
-    .nextSceneB = 19,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 15,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "The demon smiles the most awful smile. \nREMEMBER, YOU DON'T WANT TO FOLLOW A LIAR! \nREMEMBER!",
-    .nextSceneA = 21,
-    .nextSceneB = 21,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 16,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "The demon smiles the most awful smile. \nREMEMBER, A WOLF WILL NOT EAT CABBAGE! \nREMEMBER!",
-    .nextSceneA = 22,
-    .nextSceneB = 22,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 4, .music = 2,
-  },
-  {
-    .id = 17,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "You begin looking around the room. \nThere's a door and... another door. \nWere there always two doors here?",
-    .nextSceneA = 18,
-    .nextSceneB = 18,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 18,
-    .type = SCENE_TYPE_QUIZ_TRIGGER,
-    .text = "You're sure there have definitely always been two doors here. \n\nNow think...",
-    .nextSceneA = 6,
-    .nextSceneB = 4,
-    .triggerQuiz = -1,
-    .questionId = 61,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 19,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "You reach for the green door. \nIt's locked.",
-    .nextSceneA = 20,
-    .nextSceneB = 20,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 3, .music = 1,
-  },
-  {
-    .id = 20,
-    .type = SCENE_TYPE_QUIZ_TRIGGER,
-    .text = "Surely there are keys somewhere around here, \nif you take the time to search for them. \n\nNow think...",
-    .nextSceneA = 7,
-    .nextSceneB = 24,
-    .triggerQuiz = -1,
-    .questionId = 62,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 21,
-    .type = SCENE_TYPE_QUIZ_TRIGGER,
-    .text = "You go over to the bookshelf and find a book on Lockpicking. \nHmmm, perhaps you don't need a key at all... \n\nNow think...",
-    .nextSceneA = 8,
-    .nextSceneB = 25,
-    .triggerQuiz = -1,
-    .questionId = 63,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 22,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "As you reach to scratch your head, you find \na bobbypin holding your hair in a bun.",
-    .nextSceneA = 23,
-    .nextSceneB = 23,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 23,
-    .type = SCENE_TYPE_QUIZ_TRIGGER,
-    .text = "Apparently, you have long, beautiful hair \nthat falls down as you remove the bobbypin. \n\nNow think...",
-    .nextSceneA = 26,
-    .nextSceneB = 27,
-    .triggerQuiz = -1,
-    .questionId = 64,
-    .bg = 0, .music = 1,
-  },
-  {
-    .id = 24,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "You go over to the bookshelf and find a book on Algebra. \nPerhaps it's a hollow book and the key is inside? \nNope, all that's inside is knowledge.",
-    .nextSceneA = 4,
-    .nextSceneB = 4,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 0, .music = 0,
-  },
-  {
-    .id = 25,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "You set down the book on Lockpicking and \na book on Logic catches your eye. \nMaybe the key is in understanding \nthe things which you know to be true.",
-    .nextSceneA = 4,
-    .nextSceneB = 4,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 0, .music = 0,
-  },
-  {
-    .id = 26,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "As you fumble with lock, your thoughts meander... \nWhat are you doing here? \nWho are you? \nHow long have you been here?",
-    .nextSceneA = 4,
-    .nextSceneB = 4,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 3, .music = 0,
-  },
-  {
-    .id = 27,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "Despite barely understanding the book on Lockpicking, \nyou effortlessly unlock the door with the bobbypin.",
-    .nextSceneA = 28,
-    .nextSceneB = 28,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 3, .music = 1,
-  },
-  {
-    .id = 28,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "Maybe you do this professionally in another life.",
-    .nextSceneA = 29,
-    .nextSceneB = 29,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 3, .music = 1,
-  },
-  {
-    .id = 29,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "Maybe you're married in another life.",
-    .nextSceneA = 30,
-    .nextSceneB = 30,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 3, .music = 1,
-  },
-  {
-    .id = 30,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "Maybe you're an artist in another life.",
-    .nextSceneA = 31,
-    .nextSceneB = 31,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 3, .music = 1,
-  },
-  {
-    .id = 31,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "Who are you really?",
-    .nextSceneA = 32,
-    .nextSceneB = 32,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 3, .music = 1,
-  },
-  {
-    .id = 32,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "You step through the door and wake up.",
-    .nextSceneA = 33,
-    .nextSceneB = 33,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 3, .music = 1,
-  },
-  {
-    .id = 33,
-    .type = SCENE_TYPE_NORMAL,
-    .text = "Game Design and Programming by Saffron \nMusic and Story by Fantastic Fox \nArt by Roselion",
-    .nextSceneA = 34,
-    .nextSceneB = 34,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 1, .music = 1,
-  },
-  {
-    .id = 34,
-    .type = SCENE_TYPE_GOOD_ENDING,
-    .text = "THE END",
-    .nextSceneA = -1,
-    .nextSceneB = -1,
-    .triggerQuiz = -1,
-    .questionId = -1,
-    .bg = 1, .music = 1,
-  },
+// ---- Language pack: en ----
+typedef struct {
+  LangPack head;
+  u32 sceneTexts[29];
+  u32 questionTexts[276];
+  char strings[7394];
+} LANG_EN_t;
+static const LANG_EN_t LANG_EN __attribute__((section(".rodata_binf"), aligned(2))) = {
+  { sizeof(LANG_EN_t), 29, 69, __builtin_offsetof(LANG_EN_t, sceneTexts), __builtin_offsetof(LANG_EN_t, questionTexts), __builtin_offsetof(LANG_EN_t, strings) },
+  {
+    0, 144, 233, 376, 461, 571, 692, 732, 821, 911, 1005, 1095, 1202, 1279, 1323, 1425,
+    1547, 1631, 1733, 1880, 2030, 2150, 2257, 2307, 2345, 2385, 2405, 2444, 2534,
+  },
+  {
+    2542, 2585, 2593, 2600, 2607, 2660, 2662, 2664, 2666, 2708, 2719, 2734, 2745, 2788, 2798, 2805,
+    2813, 2855, 2861, 2876, 2883, 2923, 2593, 2929, 2935, 2959, 2970, 2981, 2990, 3035, 3050, 3071,
+    3091, 3140, 3149, 3155, 3161, 3212, 3218, 3225, 3231, 3266, 3280, 3296, 3303, 3347, 3366, 3378,
+    3384, 3421, 3428, 3434, 3440, 3469, 3475, 3488, 3497, 3546, 3553, 3558, 3563, 3603, 3612, 3618,
+    3623, 3657, 3673, 3685, 3698, 3738, 3744, 3750, 3762, 3800, 3810, 3817, 3824, 3865, 3876, 3882,
+    3894, 3925, 3930, 3936, 3943, 3992, 3997, 4007, 4014, 4075, 3744, 4081, 4088, 4124, 4133, 4141,
+    4148, 4075, 4183, 3744, 4187, 4227, 4234, 4239, 4251, 4302, 4313, 4321, 4327, 4370, 4377, 4390,
+    4401, 4446, 4451, 4458, 4467, 4507, 4519, 4527, 4541, 4568, 4573, 4578, 4583, 4633, 4651, 4668,
+    4684, 4720, 4725, 4730, 4735, 4767, 4788, 4807, 4818, 4878, 4890, 4910, 4927, 4991, 5009, 5029,
+    5047, 5081, 5087, 5093, 5103, 5171, 5183, 5193, 5203, 5242, 5262, 5274, 5291, 5340, 5345, 5350,
+    5355, 5395, 5401, 5406, 5414, 5453, 5457, 5460, 5464, 5508, 5512, 5516, 5520, 5569, 5576, 5591,
+    5600, 5628, 5632, 5641, 5645, 5685, 5698, 5714, 5730, 5775, 5784, 5791, 5799, 5395, 5835, 5843,
+    5849, 5905, 5918, 5930, 5944, 5992, 5997, 6002, 6010, 6059, 6069, 6076, 6082, 6129, 6134, 6143,
+    6148, 6187, 6193, 6199, 6205, 6253, 6258, 6271, 6279, 6345, 6355, 6364, 6377, 6421, 6431, 6439,
+    6450, 5992, 6500, 6507, 6513, 6581, 6585, 6605, 6616, 6658, 6670, 6676, 6689, 6739, 6745, 6754,
+    6762, 6792, 6794, 6796, 6799, 6838, 6847, 6855, 6863, 6918, 6924, 6930, 6936, 6995, 7006, 7027,
+    7042, 7089, 7094, 7099, 7107, 7134, 7136, 7138, 7140, 7196, 7213, 7223, 7238, 7264, 7273, 7286,
+    7294, 7341, 7355, 7373,
+  },
+  {
+    "Intuition is somewhat magical in a dream. \nYou don't know why, but you make these connections \nbetween what you need to do and what is correct.\0"
+    "Perhaps you're still in a dream when you wake, \nwhen you find yourself in an empty room.\0"
+    "You feel like you should know what to do next. \nMaybe you do know what to do next. \nMaybe you've always known. \nOr maybe you're just learning.\0"
+    "Maybe if you focus on what you do know, the rest will come naturally. \n\nStart small.\0"
+    "You turn to the red door. \nIt seems like the only door you could enter. \nIt's only natural that you enter it.\0"
+    "A voice slithers from the corner of the room. \nIt chills you to the bone and freezes you in place. \nNOW YOU MUST ANSWER!\0"
+    "The demon cackles. \nYOU'RE ON YOUR OWN!\0"
+    "The demon smiles the most awful smile. \nREMEMBER, ENGLISH IS AN ENGLISH WORD! \nREMEMBER!\0"
+    "The demon smiles the most awful smile. \nREMEMBER, A THING COSTS WHAT IT COSTS! \nREMEMBER!\0"
+    "The demon smiles the most awful smile. \nREMEMBER, YOU DON'T WANT TO FOLLOW A LIAR! \nREMEMBER!\0"
+    "The demon smiles the most awful smile. \nREMEMBER, A WOLF WILL NOT EAT CABBAGE! \nREMEMBER!\0"
+    "You begin looking around the room. \nThere's a door and... another door. \nWere there always two doors here?\0"
+    "You're sure there have definitely always been two doors here. \n\nNow think...\0"
+    "You reach for the green door. \nIt's locked.\0"
+    "Surely there are keys somewhere around here, \nif you take the time to search for them. \n\nNow think...\0"
+    "You go over to the bookshelf and find a book on Lockpicking. \nHmmm, perhaps you don't need a key at all... \n\nNow think...\0"
+    "As you reach to scratch your head, you find \na bobbypin holding your hair in a bun.\0"
+    "Apparently, you have long, beautiful hair \nthat falls down as you remove the bobbypin. \n\nNow think...\0"
+    "You go over to the bookshelf and find a book on Algebra. \nPerhaps it's a hollow book and the key is inside? \nNope, all that's inside is knowledge.\0"
+    "You set down the book on Lockpicking and \na book on Logic catches your eye. \nMaybe the key is in understanding \nthe things which you know to be true.\0"
+    "As you fumble with lock, your thoughts meander... \nWhat are you doing here? \nWho are you? \nHow long have you been here?\0"
+    "Despite barely understanding the book on Lockpicking, \nyou effortlessly unlock the door with the bobbypin.\0"
+    "Maybe you do this professionally in another life.\0"
+    "Maybe you're married in another life.\0"
+    "Maybe you're an artist in another life.\0"
+    "Who are you really?\0"
+    "You step through the door and wake up.\0"
+    "Game Design and Programming by Saffron \nMusic and Story by Fantastic Fox \nArt by Roselion\0"
+    "THE END\0"
+    "Which country won the 2018 FIFA World Cup?\0"
+    "Germany\0"
+    "France\0"
+    "Brazil\0"
+    "In basketball how many points is a free throw worth?\0"
+    "1\0"
+    "2\0"
+    "3\0"
+    "Who has won the most Olympic gold medals?\0"
+    "Usain Bolt\0"
+    "Michael Phelps\0"
+    "Carl Lewis\0"
+    "Which sport uses the term 'love' for zero?\0"
+    "Badminton\0"
+    "Tennis\0"
+    "Cricket\0"
+    "Where were the 2016 Summer Olympics held?\0"
+    "Tokyo\0"
+    "Rio de Janeiro\0"
+    "London\0"
+    "Which country hosts the Tour de France?\0"
+    "Spain\0"
+    "Italy\0"
+    "How long is a marathon?\0"
+    "26.2 miles\0"
+    "24.5 miles\0"
+    "28 miles\0"
+    "Which NFL team has won the most Super Bowls?\0"
+    "Dallas Cowboys\0"
+    "New England Patriots\0"
+    "Pittsburgh Steelers\0"
+    "Who is known as \"The King\" in football (soccer)?\0"
+    "Maradona\0"
+    "Pelé\0"
+    "Messi\0"
+    "What is the term for one stroke under par in golf?\0"
+    "Eagle\0"
+    "Birdie\0"
+    "Bogey\0"
+    "Who is known as the \"King of Pop\"?\0"
+    "Elvis Presley\0"
+    "Michael Jackson\0"
+    "Prince\0"
+    "Which band released the album \"Abbey Road\"?\0"
+    "The Rolling Stones\0"
+    "The Beatles\0"
+    "Queen\0"
+    "What instrument does a pianist play?\0"
+    "Guitar\0"
+    "Piano\0"
+    "Drums\0"
+    "Who sang \"Someone Like You\"?\0"
+    "Adele\0"
+    "Taylor Swift\0"
+    "Beyoncé\0"
+    "Which music genre is associated with Bob Marley?\0"
+    "Reggae\0"
+    "Rock\0"
+    "Jazz\0"
+    "What is the highest male singing voice?\0"
+    "Baritone\0"
+    "Tenor\0"
+    "Bass\0"
+    "Who was the lead singer of Queen?\0"
+    "Freddie Mercury\0"
+    "David Bowie\0"
+    "Robert Plant\0"
+    "Which country did K-pop originate from?\0"
+    "Japan\0"
+    "China\0"
+    "South Korea\0"
+    "Which classical composer became deaf?\0"
+    "Beethoven\0"
+    "Mozart\0"
+    "Chopin\0"
+    "Who sang the hit song \"Blinding Lights\"?\0"
+    "The Weeknd\0"
+    "Drake\0"
+    "Post Malone\0"
+    "What is the capital of France?\0"
+    "Rome\0"
+    "Paris\0"
+    "Berlin\0"
+    "Which continent is the Sahara Desert located in?\0"
+    "Asia\0"
+    "Australia\0"
+    "Africa\0"
+    "Mount Everest lies on the border of Nepal and which country?\0"
+    "India\0"
+    "Bhutan\0"
+    "What is the largest ocean on Earth?\0"
+    "Atlantic\0"
+    "Pacific\0"
+    "Indian\0"
+    "Which country has the most people?\0"
+    "USA\0"
+    "What is the longest river in the world?\0"
+    "Amazon\0"
+    "Nile\0"
+    "Mississippi\0"
+    "Which U.S. state is known as \"The Sunshine State\"?\0"
+    "California\0"
+    "Florida\0"
+    "Texas\0"
+    "What is the smallest country in the world?\0"
+    "Monaco\0"
+    "Vatican City\0"
+    "San Marino\0"
+    "Which desert covers much of northern Africa?\0"
+    "Gobi\0"
+    "Sahara\0"
+    "Kalahari\0"
+    "Which city is known as the \"Big Apple\"?\0"
+    "Los Angeles\0"
+    "Chicago\0"
+    "New York City\0"
+    "When did World War II end?\0"
+    "1943\0"
+    "1945\0"
+    "1947\0"
+    "Who was the first President of the United States?\0"
+    "George Washington\0"
+    "Thomas Jefferson\0"
+    "Abraham Lincoln\0"
+    "In which year did the Titanic sink?\0"
+    "1910\0"
+    "1912\0"
+    "1914\0"
+    "Who discovered America in 1492?\0"
+    "Christopher Columbus\0"
+    "Ferdinand Magellan\0"
+    "Marco Polo\0"
+    "What wall fell in 1989 symbolizing the end of the Cold War?\0"
+    "Berlin Wall\0"
+    "Great Wall of China\0"
+    "Hadrian’s Wall\0"
+    "Who was the British Prime Minister during most of World War II?\0"
+    "Winston Churchill\0"
+    "Neville Chamberlain\0"
+    "Margaret Thatcher\0"
+    "Which empire built the Colosseum?\0"
+    "Greek\0"
+    "Roman\0"
+    "Byzantine\0"
+    "What was the name of the ship that brought the Pilgrims to America?\0"
+    "Santa Maria\0"
+    "Mayflower\0"
+    "Endeavour\0"
+    "Who was known as the Maid of Orléans?\0"
+    "Catherine the Great\0"
+    "Joan of Arc\0"
+    "Marie Antoinette\0"
+    "In which year did humans first land on the moon?\0"
+    "1965\0"
+    "1969\0"
+    "1972\0"
+    "What planet is known as the Red Planet?\0"
+    "Venus\0"
+    "Mars\0"
+    "Jupiter\0"
+    "What is the chemical symbol for water?\0"
+    "H2O\0"
+    "O2\0"
+    "CO2\0"
+    "How many bones are in the adult human body?\0"
+    "206\0"
+    "210\0"
+    "215\0"
+    "What gas do plants absorb during photosynthesis?\0"
+    "Oxygen\0"
+    "Carbon Dioxide\0"
+    "Nitrogen\0"
+    "What is the speed of light?\0"
+    "300\0"
+    "000 km/s\0"
+    "150\0"
+    "Who developed the theory of relativity?\0"
+    "Isaac Newton\0"
+    "Albert Einstein\0"
+    "Galileo Galilei\0"
+    "What part of the atom has a positive charge?\0"
+    "Electron\0"
+    "Proton\0"
+    "Neutron\0"
+    "Which planet is closest to the Sun?\0"
+    "Mercury\0"
+    "Earth\0"
+    "What is the process of water turning into vapor called?\0"
+    "Condensation\0"
+    "Evaporation\0"
+    "Precipitation\0"
+    "What is the hardest natural substance on Earth?\0"
+    "Gold\0"
+    "Iron\0"
+    "Diamond\0"
+    "What is the best-selling video game of all time?\0"
+    "Minecraft\0"
+    "Tetris\0"
+    "GTA V\0"
+    "Which company created the PlayStation console?\0"
+    "Sega\0"
+    "Nintendo\0"
+    "Sony\0"
+    "What is the name of Mario’s brother?\0"
+    "Luigi\0"
+    "Yoshi\0"
+    "Wario\0"
+    "Which game features the character Master Chief?\0"
+    "Halo\0"
+    "Call of Duty\0"
+    "Destiny\0"
+    "In which game do players compete in a battle royale on an island?\0"
+    "Overwatch\0"
+    "Fortnite\0"
+    "Apex Legends\0"
+    "What Pokémon is number 25 in the Pokédex?\0"
+    "Bulbasaur\0"
+    "Pikachu\0"
+    "Charmander\0"
+    "What is the main currency in The Legend of Zelda?\0"
+    "Rupees\0"
+    "Coins\0"
+    "Which game series features locations like Vice City and Los Santos?\0"
+    "GTA\0"
+    "Red Dead Redemption\0"
+    "Saints Row\0"
+    "Who is the creator of the game Minecraft?\0"
+    "Gabe Newell\0"
+    "Notch\0"
+    "Hideo Kojima\0"
+    "Which company developed the game “Overwatch”?\0"
+    "Valve\0"
+    "Blizzard\0"
+    "Ubisoft\0"
+    "1.1.2.3.5... What comes next?\0"
+    "8\0"
+    "9\0"
+    "10\0"
+    "If English is English what's Japanese?\0"
+    "Japanese\0"
+    "Nihongo\0"
+    "English\0"
+    "If a book costs $1 plus half its cost what's its cost?\0"
+    "$1.50\0"
+    "$1.75\0"
+    "$2.00\0"
+    "What to ask one always honest and one always lying guards?\0"
+    "Which way?\0"
+    "Other guard's choice\0"
+    "Who is a liar?\0"
+    "Wolf goat and cabbage. Cross with which first?\0"
+    "Wolf\0"
+    "Goat\0"
+    "Cabbage\0"
+    "What is the C Major third?\0"
+    "E\0"
+    "F\0"
+    "G\0"
+    "Whose philosophy is quoted as 'I think therefore I am'?\0"
+    "Jean-Paul Sartre\0"
+    "Aristotle\0"
+    "Rene Descartes\0"
+    "Which was invented first?\0"
+    "Sandwich\0"
+    "Sliced bread\0"
+    "Mahjong\0"
+    "What phenomena does Schrodinger's Cat explore?\0"
+    "Logic puzzles\0"
+    "Quantum mechanics\0"
+    "Cognitive dissonance\0"
+  }
+};
+
+const LangPack * const LANG_PACKS[] = { &LANG_EN.head };
+const void * const LANG_PACK_ENDS[] = { (const u8*) &LANG_EN + sizeof(LANG_EN_t) };
+const u16 LANG_COUNT = 1;
+const u16 SCENE_TEXTS_COUNT = 29;
+
+// ---- Scene script ----
+// flags: 0=passed
+static const u8 SCENE_SCRIPT_DATA[] = {
+  // 0: intro1 @ 0
+  OP_BG, 0, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 0, OP_WAIT_INPUT, OP_JUMP, 0, 13,
+  // 1: intro2 @ 13
+  OP_BG, 0, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 1, OP_WAIT_INPUT, OP_JUMP, 0, 26,
+  // 2: intro3 @ 26
+  OP_BG, 0, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 2, OP_WAIT_INPUT, OP_JUMP, 0, 39,
+  // 3: intro4 @ 39
+  OP_BG, 1, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 3, OP_WAIT_INPUT, OP_QUESTION, 0, 60, OP_JUMP_IF_FLAG, 0, 0, 71, OP_JUMP, 0, 59,
+  // 4: gameover @ 59
+  OP_BG, 2, OP_MUSIC, 0, OP_SPRITE, 0, OP_TEXT, 0, 4, OP_WAIT_INPUT, OP_ENDING, SCENE_TYPE_BAD_ENDING,
+  // 5: demon1 @ 71
+  OP_BG, 1, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 5, OP_WAIT_INPUT, OP_QUESTION, 0, 65, OP_JUMP_IF_FLAG, 0, 0, 203, OP_JUMP, 0, 151,
+  // 6: demon2 @ 91
+  OP_BG, 1, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 5, OP_WAIT_INPUT, OP_QUESTION, 0, 66, OP_JUMP_IF_FLAG, 0, 0, 216, OP_JUMP, 0, 164,
+  // 7: demon3 @ 111
+  OP_BG, 1, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 5, OP_WAIT_INPUT, OP_QUESTION, 0, 67, OP_JUMP_IF_FLAG, 0, 0, 229, OP_JUMP, 0, 177,
+  // 8: demon4 @ 131
+  OP_BG, 1, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 5, OP_WAIT_INPUT, OP_QUESTION, 0, 68, OP_JUMP_IF_FLAG, 0, 0, 242, OP_JUMP, 0, 190,
+  // 9: correctintro1 @ 151
+  OP_BG, 3, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 6, OP_WAIT_INPUT, OP_JUMP, 0, 255,
+  // 10: correctintro2 @ 164
+  OP_BG, 3, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 6, OP_WAIT_INPUT, OP_JUMP, 1, 32,
+  // 11: correctintro3 @ 177
+  OP_BG, 3, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 6, OP_WAIT_INPUT, OP_JUMP, 1, 65,
+  // 12: correctintro4 @ 190
+  OP_BG, 3, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 6, OP_WAIT_INPUT, OP_JUMP, 1, 85,
+  // 13: doublecorrectintro1 @ 203
+  OP_BG, 3, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 7, OP_WAIT_INPUT, OP_JUMP, 0, 255,
+  // 14: doublecorrectintro2 @ 216
+  OP_BG, 3, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 8, OP_WAIT_INPUT, OP_JUMP, 1, 32,
+  // 15: doublecorrectintro3 @ 229
+  OP_BG, 3, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 9, OP_WAIT_INPUT, OP_JUMP, 1, 65,
+  // 16: doublecorrectintro4 @ 242
+  OP_BG, 3, OP_MUSIC, 2, OP_SPRITE, 1, OP_TEXT, 0, 10, OP_WAIT_INPUT, OP_JUMP, 1, 85,
+  // 17: correct1 @ 255
+  OP_BG, 0, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 11, OP_WAIT_INPUT, OP_JUMP, 1, 12,
+  // 18: correct12 @ 268
+  OP_BG, 1, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 12, OP_WAIT_INPUT, OP_QUESTION, 0, 61, OP_JUMP_IF_FLAG, 0, 0, 91, OP_JUMP, 0, 59,
+  // 19: correct2 @ 288
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 13, OP_WAIT_INPUT, OP_JUMP, 1, 45,
+  // 20: correct22 @ 301
+  OP_BG, 1, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 14, OP_WAIT_INPUT, OP_QUESTION, 0, 62, OP_JUMP_IF_FLAG, 0, 0, 111, OP_JUMP, 1, 118,
+  // 21: correct3 @ 321
+  OP_BG, 1, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 15, OP_WAIT_INPUT, OP_QUESTION, 0, 63, OP_JUMP_IF_FLAG, 0, 0, 131, OP_JUMP, 1, 131,
+  // 22: correct4 @ 341
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 16, OP_WAIT_INPUT, OP_JUMP, 1, 98,
+  // 23: correct42 @ 354
+  OP_BG, 1, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 17, OP_WAIT_INPUT, OP_QUESTION, 0, 64, OP_JUMP_IF_FLAG, 0, 1, 144, OP_JUMP, 1, 157,
+  // 24: gameover2 @ 374
+  OP_BG, 2, OP_MUSIC, 0, OP_SPRITE, 0, OP_TEXT, 0, 18, OP_WAIT_INPUT, OP_JUMP, 0, 59,
+  // 25: gameover3 @ 387
+  OP_BG, 2, OP_MUSIC, 0, OP_SPRITE, 0, OP_TEXT, 0, 19, OP_WAIT_INPUT, OP_JUMP, 0, 59,
+  // 26: gameover4 @ 400
+  OP_BG, 2, OP_MUSIC, 0, OP_SPRITE, 0, OP_TEXT, 0, 20, OP_WAIT_INPUT, OP_JUMP, 0, 59,
+  // 27: final1 @ 413
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 21, OP_WAIT_INPUT, OP_JUMP, 1, 170,
+  // 28: final2 @ 426
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 22, OP_WAIT_INPUT, OP_JUMP, 1, 183,
+  // 29: final3 @ 439
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 23, OP_WAIT_INPUT, OP_JUMP, 1, 196,
+  // 30: final4 @ 452
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 24, OP_WAIT_INPUT, OP_JUMP, 1, 209,
+  // 31: final5 @ 465
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 25, OP_WAIT_INPUT, OP_JUMP, 1, 222,
+  // 32: final6 @ 478
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 26, OP_WAIT_INPUT, OP_JUMP, 1, 235,
+  // 33: final7 @ 491
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 27, OP_WAIT_INPUT, OP_JUMP, 1, 248,
+  // 34: final8 @ 504
+  OP_BG, 3, OP_MUSIC, 1, OP_SPRITE, 0, OP_TEXT, 0, 28, OP_WAIT_INPUT, OP_ENDING, SCENE_TYPE_GOOD_ENDING,
 };
-const Scene * const SCENES = SCENES_DATA;
+static const u16 SCENE_ENTRIES_DATA[] = { 0, 13, 26, 39, 59, 71, 91, 111, 131, 151, 164, 177, 190, 203, 216, 229, 242, 255, 268, 288, 301, 321, 341, 354, 374, 387, 400, 413, 426, 439, 452, 465, 478, 491, 504 };
+const u8  * const SCENE_SCRIPT = SCENE_SCRIPT_DATA;
+const u16 * const SCENE_ENTRIES = SCENE_ENTRIES_DATA;
+const u16 SCENE_SCRIPT_SIZE = 516;
 const u16 SCENES_COUNT = 35;
 
+// ---- Scene choices (CSR: edges of scene i are [offsets[i], offsets[i + 1])) ----
+static const SceneChoice SCENE_CHOICES_DATA[] = {
+  { 0, 0 },  // unused, keeps the array non-empty
+};
+static const u16 SCENE_CHOICE_OFFSETS_DATA[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+const SceneChoice * const SCENE_CHOICES = SCENE_CHOICES_DATA;
+const u16 * const SCENE_CHOICE_OFFSETS = SCENE_CHOICE_OFFSETS_DATA;
+
 // ---- Quizzes ----
 static const u16 _QUIZ_CATS_0[] = { 1, 0, 12, 14, 11 };
 static const u16 _QUIZ_CATS_1[] = { 1, 0, 12, 14, 11 };
@@ -1110,6 +907,140 @@ static const Quiz QUIZZES_DATA[] = {
 const Quiz * const QUIZZES = QUIZZES_DATA;
 const u16 QUIZZES_COUNT = 11;
 
+// ---- Name lookup ----
+#if DEBUG
+static const char * const SCENE_NAMES_STRINGS[] = {
+  "intro1",
+  "intro2",
+  "intro3",
+  "intro4",
+  "gameover",
+  "demon1",
+  "demon2",
+  "demon3",
+  "demon4",
+  "correctintro1",
+  "correctintro2",
+  "correctintro3",
+  "correctintro4",
+  "doublecorrectintro1",
+  "doublecorrectintro2",
+  "doublecorrectintro3",
+  "doublecorrectintro4",
+  "correct1",
+  "correct12",
+  "correct2",
+  "correct22",
+  "correct3",
+  "correct4",
+  "correct42",
+  "gameover2",
+  "gameover3",
+  "gameover4",
+  "final1",
+  "final2",
+  "final3",
+  "final4",
+  "final5",
+  "final6",
+  "final7",
+  "final8",
+};
+static const u16 SCENE_NAMES_SEEDS[] = { 3, 2, 1, 1, 11, 12, 0, 8, 35, 4, 1, 7, 11, 1, 29, 10, 7, 24 };
+static const u16 SCENE_NAMES_SLOTS[] = { 32, 12, 17, 13, 22, 27, 15, 23, 8, 31, 9, 11, 5, 18, 21, 7, 19, 28, 2, 25, 0, 33, 29, 34, 10, 4, 1, 14, 20, 6, 16, 3, 26, 30, 24 };
+const NameHash SCENE_NAMES = { SCENE_NAMES_STRINGS, SCENE_NAMES_SEEDS, SCENE_NAMES_SLOTS, 35, 18 };
+static const char * const QUESTION_NAMES_STRINGS[] = {
+  "q_sport_1",
+  "q_sport_2",
+  "q_sport_3",
+  "q_sport_4",
+  "q_sport_5",
+  "q_sport_6",
+  "q_sport_7",
+  "q_sport_8",
+  "q_sport_9",
+  "q_sport_10",
+  "q_music_1",
+  "q_music_2",
+  "q_music_3",
+  "q_music_4",
+  "q_music_5",
+  "q_music_6",
+  "q_music_7",
+  "q_music_8",
+  "q_music_9",
+  "q_music_10",
+  "q_geo_1",
+  "q_geo_2",
+  "q_geo_3",
+  "q_geo_4",
+  "q_geo_5",
+  "q_geo_6",
+  "q_geo_7",
+  "q_geo_8",
+  "q_geo_9",
+  "q_geo_10",
+  "q_hist_1",
+  "q_hist_2",
+  "q_hist_3",
+  "q_hist_4",
+  "q_hist_5",
+  "q_hist_6",
+  "q_hist_7",
+  "q_hist_8",
+  "q_hist_9",
+  "q_hist_10",
+  "q_sci_1",
+  "q_sci_2",
+  "q_sci_3",
+  "q_sci_4",
+  "q_sci_5",
+  "q_sci_6",
+  "q_sci_7",
+  "q_sci_8",
+  "q_sci_9",
+  "q_sci_10",
+  "q_game_1",
+  "q_game_2",
+  "q_game_3",
+  "q_game_4",
+  "q_game_5",
+  "q_game_6",
+  "q_game_7",
+  "q_game_8",
+  "q_game_9",
+  "q_game_10",
+  "q_log_1",
+  "q_log_2",
+  "q_log_3",
+  "q_log_4",
+  "q_log_5",
+  "q_know1",
+  "q_know2",
+  "q_know3",
+  "q_know4",
+};
+static const u16 QUESTION_NAMES_SEEDS[] = { 4, 1, 1, 0, 3, 6, 3, 1, 0, 2, 11, 2, 7, 13, 3, 3, 6, 10, 6, 21, 13, 1, 3, 54, 60, 2, 0, 28, 7, 4, 51, 67, 32, 26, 0 };
+static const u16 QUESTION_NAMES_SLOTS[] = { 19, 21, 55, 44, 28, 9, 22, 33, 24, 35, 13, 10, 61, 47, 62, 36, 63, 46, 17, 68, 43, 45, 41, 34, 42, 59, 3, 58, 38, 18, 39, 49, 4, 23, 50, 64, 65, 15, 6, 66, 8, 52, 29, 5, 51, 57, 32, 14, 20, 60, 0, 16, 31, 30, 40, 26, 53, 37, 56, 48, 1, 12, 7, 67, 54, 2, 27, 25, 11 };
+const NameHash QUESTION_NAMES = { QUESTION_NAMES_STRINGS, QUESTION_NAMES_SEEDS, QUESTION_NAMES_SLOTS, 69, 35 };
+static const char * const QUIZ_NAMES_STRINGS[] = {
+  "quiz_1",
+  "quiz_2",
+  "internal1",
+  "internal2",
+  "internal3",
+  "internal4",
+  "internal5",
+  "demonquiz1",
+  "demonquiz2",
+  "demonquiz3",
+  "demonquiz4",
+};
+static const u16 QUIZ_NAMES_SEEDS[] = { 4, 55, 6, 1, 14, 0 };
+static const u16 QUIZ_NAMES_SLOTS[] = { 4, 8, 2, 0, 1, 3, 7, 10, 9, 5, 6 };
+const NameHash QUIZ_NAMES = { QUIZ_NAMES_STRINGS, QUIZ_NAMES_SEEDS, QUIZ_NAMES_SLOTS, 11, 6 };
+#endif
+
 // ---- Category Question Indexes ----
 static const u16 _CAT_QIDX_0[] = { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 };
 static const u16 _CAT_QIDX_1[] = { 30, 31, 32, 33, 34, 35, 36, 37, 38, 39 };
@@ -0,0 +1,90 @@
+#include "fade.h"
+
+// FADE_LEVEL[level][v] = v * level / FADE_STEPS
+static const u8 FADE_LEVEL[FADE_STEPS + 1][8] = {
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 1 },
+    { 0, 0, 0, 0, 1, 1, 1, 2 },
+    { 0, 0, 0, 1, 1, 2, 2, 3 },
+    { 0, 0, 1, 1, 2, 2, 3, 4 },
+    { 0, 0, 1, 2, 2, 3, 4, 5 },
+    { 0, 0, 1, 2, 3, 4, 5, 6 },
+    { 0, 1, 2, 3, 4, 5, 6, 7 }
+};
+
+static u16 g_palette[64];                       // Palettes at full brightness
+static u16 g_fadeTable[FADE_STEPS + 1][64];     // g_fadeTable[level]
+static u16 g_level = FADE_STEPS;
+static s16 g_direction = 0;                     // -1 out, 1 in, 0 idle
+static u16 g_timer = 0;
+
+static u16 scaleColor(u16 color, u16 level) {
+    const u8* lut = FADE_LEVEL[level];
+    return (lut[(color >> 1) & 7] << 1) | (lut[(color >> 5) & 7] << 5) | (lut[(color >> 9) & 7] << 9);
+}
+
+static void buildFadeTable() {
+    for(u16 level = 0; level <= FADE_STEPS; level++) {
+        for(u16 i = 0; i < 64; i++) {
+            g_fadeTable[level][i] = scaleColor(g_palette[i], level);
+        }
+    }
+}
+
+void fadeInit() {
+    memset(g_palette, 0, sizeof(g_palette));
+    g_level = FADE_STEPS;
+    g_direction = 0;
+    g_timer = 0;
+}
+
+// Palettes go through here so fades know the full brightness colors
+void fadeSetPalette(u16 pal, const u16* colors) {
+    fadeSetColors(pal * 16, colors, 16);
+}
+
+// CRAM entries from index on, only those words are queued or faded
+void fadeSetColors(u16 index, const u16* colors, u16 count) {
+    memcpy(&g_palette[index], colors, count * 2);
+    
+    if(g_direction == 0 && g_level == FADE_STEPS) {
+        PAL_setColors(index, &g_palette[index], count, DMA_QUEUE);
+    } else {
+        for(u16 level = 0; level <= FADE_STEPS; level++) {
+            for(u16 i = index; i < index + count; i++) {
+                g_fadeTable[level][i] = scaleColor(g_palette[i], level);
+            }
+        }
+    }
+}
+
+void fadeOut() {
+    buildFadeTable();
+    g_direction = -1;
+    g_timer = 0;
+}
+
+void fadeIn() {
+    buildFadeTable();
+    g_direction = 1;
+    g_timer = 0;
+}
+
+// One logic tick
+void fadeUpdate() {
+    if(g_direction == 0) return;
+    
+    if(++g_timer < FADE_TICKS_PER_STEP) return;
+    g_timer = 0;
+    
+    if(g_direction < 0 && g_level > 0) g_level--;
+    else if(g_direction > 0 && g_level < FADE_STEPS) g_level++;
+    
+    PAL_setColors(0, g_fadeTable[g_level], 64, DMA_QUEUE);
+    
+    if(g_level == 0 || g_level == FADE_STEPS) g_direction = 0;
+}
+
+bool fadeIsActive() {
+    return g_direction != 0;
+}
@@ -0,0 +1,254 @@
+#include <genesis.h>
+#include "font_data.h"
+
+// 76 of 95 glyphs used:  !"$'(),-./0123456789:>?ABCDEFGHIJKLMNOPQRSTUVWYZ_abcdefghijklmnopqrstuvwxyz
+const u16 FONT_GLYPH_COUNT = 76;
+
+// ---- ASCII - 32 -> glyph, unused characters show as space ----
+const u8 FONT_REMAP[96] = {
+  0, 1, 2, 0, 3, 0, 0, 4, 5, 6, 0, 0, 7, 8, 9, 10,
+  11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 0, 0, 0, 22, 23,
+  0, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+  39, 40, 41, 42, 43, 44, 45, 46, 0, 47, 48, 0, 0, 0, 0, 49,
+  0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 0, 0, 0, 0, 0,
+};
+
+// ---- Glyph metrics in pixels ----
+const u8 FONT_GLYPH_LEFT[] = { 0, 1, 1, 1, 1, 2, 3, 2, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+const u8 FONT_GLYPH_WIDTH[] = { 4, 6, 6, 6, 3, 5, 4, 2, 6, 2, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 6, 6, 5, 6, 6, 6, 6, 6, 3, 5, 5, 2, 6, 5, 5, 6, 6, 6, 5, 6, 6, 6, 6, 6, 5, 6 };
+
+// ---- Palette ----
+const u16 FONT_PALETTE[16] = { 0x000, 0xEEE, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 };
+
+// ---- Tiles, 2 per glyph: top then bottom ----
+const u32 FONT_TILES[] = {
+  // ' '
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  // '!'
+  0x00000000, 0x00000000, 0x01111110, 0x01111100, 0x00111100, 0x00111100, 0x00011000, 0x00011000,
+  0x00000000, 0x00000000, 0x00011000, 0x00111100, 0x00111100, 0x00011000, 0x00000000, 0x00000000,
+  // '"'
+  0x00000000, 0x00000000, 0x00100010, 0x00100010, 0x01000100, 0x01000100, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  // '$'
+  0x00000000, 0x00001000, 0x00011100, 0x00101010, 0x01001000, 0x01001000, 0x01001000, 0x00111100,
+  0x00001010, 0x00001010, 0x00101010, 0x00101010, 0x00101010, 0x00011100, 0x00001000, 0x00000000,
+  // "'"
+  0x00000000, 0x00000000, 0x00110000, 0x00110000, 0x00100000, 0x01100000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  // '('
+  0x00000000, 0x00000000, 0x00000010, 0x00000110, 0x00001100, 0x00001000, 0x00011000, 0x00010000,
+  0x00110000, 0x00110000, 0x00110000, 0x00110000, 0x00010000, 0x00011000, 0x00001100, 0x00000000,
+  // ')'
+  0x00000000, 0x00000000, 0x00001000, 0x00001100, 0x00000100, 0x00000110, 0x00000010, 0x00000010,
+  0x00000010, 0x00000010, 0x00000010, 0x00001110, 0x00001100, 0x00001100, 0x00011000, 0x00000000,
+  // ','
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00110000, 0x00100000, 0x00000000, 0x00000000,
+  // '-'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01111110,
+  0x01111110, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  // '.'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00011000, 0x00011000, 0x00000000, 0x00000000,
+  // '/'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000110, 0x00000100,
+  0x00001100, 0x00011000, 0x00010000, 0x00110000, 0x01100000, 0x01000000, 0x01000000, 0x00000000,
+  // '0'
+  0x00000000, 0x00111100, 0x00100100, 0x01001010, 0x01001010, 0x01001010, 0x01001010, 0x01001010,
+  0x01011010, 0x01010010, 0x01010010, 0x01010010, 0x01010010, 0x01100010, 0x00111100, 0x00000000,
+  // '1'
+  0x00000000, 0x00111000, 0x01111000, 0x01011000, 0x01011000, 0x00011000, 0x00011000, 0x00011000,
+  0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x01111110, 0x01111110, 0x00000000,
+  // '2'
+  0x00000000, 0x00011100, 0x00111110, 0x01111110, 0x01100110, 0x00000110, 0x00000100, 0x00001100,
+  0x00011000, 0x00011000, 0x00010000, 0x00110000, 0x01100000, 0x01111110, 0x01111110, 0x00000000,
+  // '3'
+  0x00000000, 0x00111100, 0x00111110, 0x01100010, 0x01000010, 0x00000010, 0x00000110, 0x00111100,
+  0x00111100, 0x00000110, 0x00000010, 0x01000010, 0x01100010, 0x00111110, 0x00111100, 0x00000000,
+  // '4'
+  0x00000000, 0x00000000, 0x01100010, 0x01100010, 0x01000010, 0x01000010, 0x01000010, 0x01000010,
+  0x01111110, 0x00111110, 0x00000110, 0x00000110, 0x00000110, 0x00000110, 0x00000110, 0x00000000,
+  // '5'
+  0x00000000, 0x00111110, 0x01111110, 0x01100000, 0x01100000, 0x01100000, 0x00111100, 0x00011110,
+  0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x01000010, 0x01111110, 0x00111100, 0x00000000,
+  // '6'
+  0x00000000, 0x00001100, 0x00011000, 0x00110000, 0x00100000, 0x01100000, 0x01000000, 0x01000000,
+  0x01011100, 0x01100010, 0x01000010, 0x01000010, 0x01000010, 0x01100100, 0x00111100, 0x00000000,
+  // '7'
+  0x00000000, 0x01111110, 0x01111110, 0x00000010, 0x00000110, 0x00000100, 0x00000100, 0x00001100,
+  0x00001000, 0x00011000, 0x00010000, 0x00110000, 0x00100000, 0x01100000, 0x01000000, 0x00000000,
+  // '8'
+  0x00000000, 0x00111100, 0x01000010, 0x01000010, 0x01000010, 0x01100110, 0x00100100, 0x00011000,
+  0x00100100, 0x00100010, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x00111100, 0x00000000,
+  // '9'
+  0x00000000, 0x00111100, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x00111110,
+  0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000110, 0x00000100, 0x01111000, 0x00000000,
+  // ':'
+  0x00000000, 0x00000000, 0x00000000, 0x00111000, 0x00111000, 0x00111000, 0x00111000, 0x00000000,
+  0x00000000, 0x00000000, 0x00011100, 0x00011100, 0x00011100, 0x00000000, 0x00000000, 0x00000000,
+  // '>'
+  0x00000000, 0x01100000, 0x00110000, 0x00011000, 0x00001100, 0x00000100, 0x00000110, 0x00000110,
+  0x00000110, 0x00000100, 0x00001100, 0x00001000, 0x00011000, 0x00110000, 0x01100000, 0x00000000,
+  // '?'
+  0x00000000, 0x00111100, 0x01100110, 0x01100110, 0x01100110, 0x00000110, 0x00001110, 0x00011100,
+  0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00000000, 0x00011000, 0x00000000,
+  // 'A'
+  0x00000000, 0x00001000, 0x00011000, 0x00011000, 0x00011000, 0x00011100, 0x00110100, 0x00100100,
+  0x00100100, 0x00100100, 0x01111100, 0x01000110, 0x01000010, 0x01000010, 0x00000000, 0x00000000,
+  // 'B'
+  0x00000000, 0x00111100, 0x00100100, 0x01000110, 0x01000010, 0x01000110, 0x01000100, 0x01011100,
+  0x01000110, 0x01000010, 0x01000010, 0x01000010, 0x01000110, 0x01101100, 0x01111000, 0x00000000,
+  // 'C'
+  0x00000000, 0x00011110, 0x00110000, 0x00100000, 0x01100000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01100000, 0x00100000, 0x00111000, 0x00001110, 0x00000000,
+  // 'D'
+  0x00000000, 0x01111000, 0x01001100, 0x01000110, 0x01000010, 0x01000010, 0x01000010, 0x01000010,
+  0x01000010, 0x01000010, 0x01000010, 0x01000110, 0x01000100, 0x01101100, 0x01111000, 0x00000000,
+  // 'E'
+  0x00000000, 0x01111110, 0x01111100, 0x01000000, 0x01000000, 0x01000000, 0x01100000, 0x01100000,
+  0x01111100, 0x01111100, 0x01100000, 0x01100000, 0x01100000, 0x01111100, 0x01111110, 0x00000000,
+  // 'F'
+  0x00000000, 0x00111110, 0x01111110, 0x01100000, 0x01100000, 0x01100000, 0x01100000, 0x01111110,
+  0x01111110, 0x01110000, 0x01100000, 0x01100000, 0x01100000, 0x01100000, 0x01100000, 0x00000000,
+  // 'G'
+  0x00000000, 0x00111110, 0x01111110, 0x01100000, 0x01000000, 0x01000000, 0x01000000, 0x01011100,
+  0x01011110, 0x01000110, 0x01000010, 0x01000010, 0x01000010, 0x01111110, 0x00111100, 0x00000000,
+  // 'H'
+  0x00000000, 0x00000010, 0x01100110, 0x01100110, 0x01100110, 0x01100110, 0x01100110, 0x01111110,
+  0x01100110, 0x01100110, 0x01100110, 0x01100110, 0x01100110, 0x01100110, 0x00100100, 0x00000000,
+  // 'I'
+  0x00000000, 0x01000000, 0x01111110, 0x01111110, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+  0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x01111100, 0x01111100, 0x00000000,
+  // 'J'
+  0x00000000, 0x00000110, 0x00000110, 0x00000110, 0x00000110, 0x00000110, 0x00000110, 0x00000110,
+  0x00000110, 0x01100110, 0x01100110, 0x01100110, 0x01100110, 0x00111110, 0x00011100, 0x00000000,
+  // 'K'
+  0x00000000, 0x01000110, 0x01000100, 0x01001100, 0x01011000, 0x01010000, 0x01010000, 0x01110000,
+  0x01100000, 0x01100000, 0x01110000, 0x01011000, 0x01001100, 0x01000110, 0x01000000, 0x00000000,
+  // 'L'
+  0x00000000, 0x00100000, 0x00100000, 0x01100000, 0x01100000, 0x01100000, 0x01100000, 0x01100000,
+  0x01100000, 0x01100000, 0x01100000, 0x01100000, 0x01100000, 0x01111100, 0x01111110, 0x00000000,
+  // 'M'
+  0x00000000, 0x00100100, 0x00100100, 0x01100110, 0x01100110, 0x01111110, 0x01011010, 0x01011010,
+  0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x00000000,
+  // 'N'
+  0x00000000, 0x00000010, 0x01000010, 0x01100110, 0x01100100, 0x01100100, 0x01110100, 0x01010100,
+  0x01010100, 0x01010100, 0x01011100, 0x01001100, 0x01001100, 0x01000100, 0x00000000, 0x00000000,
+  // 'O'
+  0x00000000, 0x00111000, 0x01101000, 0x01001000, 0x01001000, 0x01001000, 0x01001000, 0x01001000,
+  0x01001000, 0x01001000, 0x01001000, 0x01001000, 0x01001000, 0x01011000, 0x01110000, 0x00000000,
+  // 'P'
+  0x00000000, 0x00111100, 0x01100010, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x01000110,
+  0x01001100, 0x01111000, 0x01100000, 0x01000000, 0x01000000, 0x01000000, 0x01100000, 0x00000000,
+  // 'Q'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00111100, 0x01000100, 0x01000110, 0x01000110,
+  0x01000110, 0x01000110, 0x01010110, 0x01010110, 0x01001100, 0x01111100, 0x00000110, 0x00000000,
+  // 'R'
+  0x00000000, 0x00000000, 0x00000000, 0x01111100, 0x01100110, 0x01100010, 0x01100010, 0x01100110,
+  0x01101100, 0x01111000, 0x01111000, 0x01101100, 0x01100100, 0x01100110, 0x01100110, 0x00000000,
+  // 'S'
+  0x00000000, 0x00001110, 0x00011000, 0x00110000, 0x00100000, 0x00100000, 0x00100000, 0x00110000,
+  0x00011000, 0x00001100, 0x00000100, 0x00000100, 0x00001100, 0x01111100, 0x01111000, 0x00000000,
+  // 'T'
+  0x00000000, 0x00000000, 0x01111110, 0x01111110, 0x01111110, 0x00011000, 0x00011000, 0x00011000,
+  0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00000000, 0x00000000,
+  // 'U'
+  0x00000000, 0x00000000, 0x01000000, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x01000010,
+  0x01000010, 0x01000010, 0x01000010, 0x01100110, 0x01111110, 0x01111100, 0x00111000, 0x00000000,
+  // 'V'
+  0x00000000, 0x00000000, 0x01000010, 0x01000010, 0x01000010, 0x01100110, 0x00100100, 0x00100100,
+  0x00100100, 0x00100100, 0x00100100, 0x00111100, 0x00011000, 0x00011000, 0x00000000, 0x00000000,
+  // 'W'
+  0x00000000, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x01000010,
+  0x01011010, 0x01011010, 0x01111110, 0x01100110, 0x01100110, 0x00100100, 0x00100100, 0x00000000,
+  // 'Y'
+  0x00000000, 0x01000010, 0x01100010, 0x00100010, 0x00110110, 0x00010100, 0x00011100, 0x00001100,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00011000, 0x00010000, 0x00110000, 0x00000000,
+  // 'Z'
+  0x00000000, 0x00000000, 0x01111110, 0x00111110, 0x00000010, 0x00000110, 0x00001100, 0x00001000,
+  0x00011000, 0x00010000, 0x00110000, 0x01100110, 0x01001110, 0x01111100, 0x00000000, 0x00000000,
+  // '_'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11111111, 0x11111111, 0x00000000,
+  // 'a'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01111100, 0x00000110,
+  0x00000010, 0x00000010, 0x00111110, 0x01000010, 0x01000010, 0x01000010, 0x00111100, 0x00000000,
+  // 'b'
+  0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00100000, 0x00100000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01111100, 0x01000010, 0x01000010, 0x01100010, 0x01111100, 0x00000000,
+  // 'c'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01111100,
+  0x01000100, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01100100, 0x01111100, 0x00000000,
+  // 'd'
+  0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010,
+  0x00000110, 0x00111110, 0x01000010, 0x01000010, 0x01000010, 0x01000010, 0x00111100, 0x00000000,
+  // 'e'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00011110, 0x00100010,
+  0x01000010, 0x01000010, 0x01111110, 0x01000000, 0x01000000, 0x01100000, 0x01111110, 0x00000000,
+  // 'f'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00011100, 0x00100010, 0x00100010,
+  0x00100010, 0x00100000, 0x00100000, 0x01111000, 0x00100000, 0x00100000, 0x00100000, 0x00000000,
+  // 'g'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001100, 0x01111110, 0x01100110,
+  0x01000110, 0x01000110, 0x01001110, 0x01111110, 0x00000110, 0x00001110, 0x01111100, 0x00000000,
+  // 'h'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x01100000, 0x01100000, 0x01100000,
+  0x01111100, 0x01101110, 0x01100110, 0x01100110, 0x01100110, 0x01100110, 0x01100110, 0x00000000,
+  // 'i'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00110000, 0x00110000, 0x00000000,
+  0x00000000, 0x00000000, 0x00110000, 0x00110000, 0x00110000, 0x00110000, 0x01110000, 0x00000000,
+  // 'j'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000110, 0x00000110, 0x00000000, 0x00000110,
+  0x00000110, 0x00000110, 0x00000110, 0x00000110, 0x00000110, 0x00111110, 0x00011100, 0x00000000,
+  // 'k'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x01001100,
+  0x01011000, 0x01110000, 0x01100000, 0x01110000, 0x01010000, 0x01011000, 0x01001100, 0x00000000,
+  // 'l'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00011000, 0x00011000, 0x00011000,
+  0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00011000, 0x00000000,
+  // 'm'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00111100, 0x01111110, 0x01011010, 0x01011010, 0x01000010, 0x01000010, 0x01000010, 0x00000000,
+  // 'n'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00111000, 0x01111100, 0x01100100, 0x01100100, 0x01100100, 0x01100100, 0x00000000,
+  // 'o'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00111000, 0x01100100, 0x01100100, 0x01100100, 0x01100100, 0x00111100, 0x00000000,
+  // 'p'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00011100,
+  0x00110110, 0x01100010, 0x01100110, 0x01111110, 0x01000000, 0x01100000, 0x01100000, 0x01100000,
+  // 'q'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00110000, 0x00101100, 0x01100110, 0x01100110, 0x00111110, 0x00000110, 0x00000110, 0x00000110,
+  // 'r'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00111100, 0x00111110, 0x01100110, 0x01100000, 0x01100000, 0x01100000, 0x01100000, 0x00000000,
+  // 's'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00111000, 0x00111100,
+  0x01000000, 0x01000000, 0x01100000, 0x00110000, 0x00001100, 0x00000100, 0x01111100, 0x00000000,
+  // 't'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00011000, 0x00011000, 0x01111110,
+  0x01111110, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010110, 0x00011110, 0x00000000,
+  // 'u'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x01100100, 0x01100100, 0x01100100, 0x01101100, 0x01101100, 0x00111110, 0x00000000,
+  // 'v'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x01000010, 0x01000010, 0x00100100, 0x00100100, 0x00111100, 0x00011000, 0x00000000,
+  // 'w'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x01000010, 0x01000010, 0x01011010, 0x01011010, 0x01111110, 0x00000000,
+  // 'x'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x01000010, 0x01100110, 0x00111100, 0x00011000, 0x00111100, 0x01100110, 0x00000000,
+  // 'y'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x01000000, 0x01000100, 0x01000100, 0x01000100, 0x01111100, 0x00001100, 0x00001100, 0x01111100,
+  // 'z'
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x01111110, 0x00000100, 0x00001100, 0x00011000, 0x00110000, 0x01111110, 0x00000000,
+};
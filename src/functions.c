@@ -1,5 +1,6 @@
 #include "functions.h"
-#include "resources.h"
+#include "font_data.h"
+#include "fade.h"
 
 static u16 g_fontTileBase = 0;
 static bool g_fontInitialized = FALSE;
@@ -7,46 +8,92 @@ static bool g_fontInitialized = FALSE;
 void initCustomFont() {
     if(g_fontInitialized) return;
     
-    g_fontTileBase = TILE_USER_INDEX + 300;
-    VDP_loadTileSet(customFontTiles.tileset, g_fontTileBase, DMA);
+    g_fontTileBase = FONT_TILE_BASE;
+    VDP_loadTileData(FONT_TILES, g_fontTileBase, FONT_GLYPH_COUNT * 2, DMA);
     
-    PAL_setPalette(PAL0, customFontTiles.palette->data, DMA);
+    fadeSetPalette(PAL0, FONT_PALETTE);
 
     g_fontInitialized = TRUE;
 }
 
+static u16 glyphTile(char c) {
+    // Only handle printable ASCII
+    if(c < 32 || c > 126) {
+        c = 32;
+    }
+    
+    // Glyphs not used by the content map to the space glyph
+    return g_fontTileBase + FONT_REMAP[c - 32] * 2;
+}
+
 void C_DrawText(const char* str, u16 x, u16 y, u16 palette) {
     if(!g_fontInitialized) return;
     
     u16 len = strlen(str);
     
     for(u16 i = 0; i < len; i++) {
-        char c = str[i];
-        
-        // Only handle printable ASCII
-        if(c < 32 || c > 126) {
-            c = 32;
-        }
-        
-        // Calculate position in 16x6 grid
-        u16 charIndex = c - 32; 
-        u16 gridX = charIndex % 16;
-        u16 gridY = charIndex / 16;
-        
-        u16 rowOffset = gridY * 32;
-        u16 colOffset = gridX; //Since I'm using 16 height, 2 tiles per character
-        
-        u16 topTile = g_fontTileBase + rowOffset + colOffset;
-        u16 bottomTile = topTile + 16; 
+        u16 topTile = glyphTile(str[i]);
+        u16 bottomTile = topTile + 1;
         
         VDP_setTileMapXY(BG_A, TILE_ATTR_FULL(palette, 0, 0, 0, topTile), x + i, y); //top
-        VDP_setTileMapXY(BG_A, TILE_ATTR_FULL(palette, 0, 0, 0, bottomTile), x + i, y + 1); //bottom
+        VDP_setTileMapXY(BG_A, TILE_ATTR_FULL(palette, 0, 0, 0, bottomTile), x + i, (y + 1) % PLANE_ROWS); //bottom
     }
 }
 
-void C_SClearText(u16 x, u16 y, u16 length) {
+void C_ClearText(u16 x, u16 y, u16 length) {
     for(u16 i = 0; i < length; i++) {
         VDP_setTileMapXY(BG_A, 0, x + i, y); 
-        VDP_setTileMapXY(BG_A, 0, x + i, y + 1);
+        VDP_setTileMapXY(BG_A, 0, x + i, (y + 1) % PLANE_ROWS);
     }
-}
\ No newline at end of file
+}
+
+// The region starts out blank, as after a plane clear
+void C_InitRegion(TextRegion* region, VDPPlane plane, u16 x, u16 y, u16 width, u16 palette) {
+    region->plane = plane;
+    region->x = x;
+    region->y = y;
+    region->width = min(width, TEXT_REGION_MAX);
+    region->palette = palette;
+    region->len = 0;
+}
+
+void C_SetRegionText(TextRegion* region, const char* str) {
+    if(!g_fontInitialized) return;
+    
+    u16 len = min(strlen(str), region->width);
+    u16 end = max(len, region->len);
+    u16 first = end;
+    u16 last = 0;
+    
+    for(u16 i = 0; i < end; i++) {
+        char c = (i < len) ? str[i] : 0;
+        char old = (i < region->len) ? region->text[i] : 0;
+        if(c != old) {
+            if(first == end) first = i;
+            last = i + 1;
+        }
+    }
+    region->len = len;
+    if(first >= last) return;
+    
+    u16 top[TEXT_REGION_MAX];
+    u16 bottom[TEXT_REGION_MAX];
+    for(u16 i = first; i < last; i++) {
+        char c = (i < len) ? str[i] : 0;
+        u16 tile = c ? TILE_ATTR_FULL(region->palette, 0, 0, 0, glyphTile(c)) : 0;
+        region->text[i] = c;
+        top[i - first] = tile;
+        bottom[i - first] = c ? tile + 1 : 0;
+    }
+    VDP_setTileMapDataRow(region->plane, top, region->y, region->x + first, last - first, CPU);
+    VDP_setTileMapDataRow(region->plane, bottom, (region->y + 1) % PLANE_ROWS, region->x + first, last - first, CPU);
+}
+
+char* appendText(char* dst, const char* src) {
+    while(*src) *dst++ = *src++;
+    return dst;
+}
+
+char* appendNumber(char* dst, u16 value) {
+    return dst + uintToStr(value, dst, 1);
+}
@@ -0,0 +1,42 @@
+#include "game_timer.h"
+
+static bool g_isPAL = FALSE;
+static u16 g_frameRate = 60;     // vblanks per second
+static u16 g_accumulator = 0;    // in 1 / (TIMER_TICK_RATE * g_frameRate) s
+static u32 g_lastVTimer = 0;
+
+void timerInit() {
+    g_isPAL = SYS_isPAL();
+    g_frameRate = g_isPAL ? 50 : 60;
+    g_accumulator = 0;
+    g_lastVTimer = vtimer;
+    
+    // XGM tempo is in frames per second, keep the music at NTSC speed
+    XGM_setMusicTempo(TIMER_TICK_RATE);
+}
+
+// Returns the number of logic ticks to run before the next vblank.
+// NTSC runs exactly one, PAL runs an extra one every 5th frame and a
+// lag frame is caught up instead of slowing the game down.
+u16 timerBeginFrame() {
+    u32 now = vtimer;
+    u16 elapsed = now - g_lastVTimer;
+    g_lastVTimer = now;
+    
+    if(elapsed == 0) elapsed = 1;
+    if(elapsed > TIMER_MAX_CATCHUP) elapsed = TIMER_MAX_CATCHUP;
+    
+    g_accumulator += elapsed * TIMER_TICK_RATE;
+    
+    u16 ticks = 0;
+    while(g_accumulator >= g_frameRate) {
+        g_accumulator -= g_frameRate;
+        ticks++;
+    }
+    
+    return ticks;
+}
+
+bool timerIsPAL() {
+    return g_isPAL;
+}
@@ -0,0 +1,59 @@
+#include "hud.h"
+#include "functions.h"
+
+// The whole line is one text region, so a new value rewrites its digits only
+static TextRegion g_line;
+static bool g_visible = FALSE;
+static u16 g_current = 0xFFFF;
+static u16 g_total = 0xFFFF;
+static u16 g_wrong = 0xFFFF;
+static u16 g_limit = 0xFFFF;
+
+// "Q<n>/<count>  Wrong:<n>/<limit>", the wrong count only in a quiz with a limit
+static void drawLine() {
+    char buf[TEXT_REGION_MAX];
+    char* p = buf;
+    
+    if(g_total != 0xFFFF) {
+        p = appendText(p, "Q");
+        p = appendNumber(p, g_current);
+        p = appendText(p, "/");
+        p = appendNumber(p, g_total);
+    }
+    if(g_limit != 0xFFFF) {
+        p = appendText(p, (p != buf) ? "  Wrong:" : "Wrong:");
+        p = appendNumber(p, g_wrong);
+        p = appendText(p, "/");
+        p = appendNumber(p, g_limit);
+    }
+    *p = 0;
+    C_SetRegionText(&g_line, buf);
+}
+
+void hudShow(u16 rows) {
+    VDP_clearPlane(WINDOW, TRUE);
+    C_InitRegion(&g_line, WINDOW, HUD_X, 0, 40 - HUD_X, PAL0);
+    g_current = g_total = g_wrong = g_limit = 0xFFFF;
+    VDP_setWindowVPos(FALSE, rows);
+    g_visible = TRUE;
+}
+
+void hudHide() {
+    if(!g_visible) return;
+    VDP_setWindowVPos(FALSE, 0);
+    g_visible = FALSE;
+}
+
+void hudSetProgress(u16 current, u16 total) {
+    if(current == g_current && total == g_total) return;
+    g_current = current;
+    g_total = total;
+    drawLine();
+}
+
+void hudSetWrong(u16 wrong, u16 limit) {
+    if(wrong == g_wrong && limit == g_limit) return;
+    g_wrong = wrong;
+    g_limit = limit;
+    drawLine();
+}
@@ -0,0 +1,43 @@
+#include "illustration.h"
+#include "unpack_queue.h"
+#include "lz_stream.h"
+#include "fade.h"
+#include "palette.h"
+
+static u16 g_pending = 0;       // Shown once its data is unpacked
+static u16 g_map[40 * 28];
+
+void illustrationShow(u16 id) {
+    illustrationCancel();
+    if(!id || id > ILLUSTRATION_COUNT) return;
+    const Illustration* ill = &ILLUSTRATIONS[id - 1];
+    
+    // The old picture's tiles get replaced, nothing shows until the new map
+    VDP_clearPlane(BG_B, TRUE);
+    unpackQueueTiles(ill->tiles, ILLUSTRATION_TILE_BASE);
+    unpackQueueRAM(ill->map, (u8*) g_map);
+    g_pending = id;
+}
+
+void illustrationUpdate() {
+    if(!g_pending || unpackQueueBusy()) return;
+    const Illustration* ill = &ILLUSTRATIONS[g_pending - 1];
+    g_pending = 0;
+    
+    paletteReserve(ill->paletteCount);
+    for(u16 pal = 0; pal < ill->paletteCount; pal++) {
+        fadeSetPalette(pal, ill->palettes + pal * 16);
+    }
+    
+    lzToNativeOrder((u8*) g_map, sizeof(g_map), 2);
+    for(u16 y = 0; y < 28; y++) {
+        u16* row = g_map + y * 40;
+        for(u16 x = 0; x < 40; x++) row[x] += ILLUSTRATION_TILE_BASE;
+        VDP_setTileMapDataRow(BG_B, row, y, 0, 40, CPU);
+    }
+}
+
+void illustrationCancel() {
+    if(g_pending) unpackQueueClear();
+    g_pending = 0;
+}
@@ -0,0 +1,4578 @@
+#include <genesis.h>
+#include "illustration_data.h"
+
+// ---- skel_a: ../content/images/skel-test-00213.bmp, 898 tiles (898 unique, 0 cells flipped), 24170 bytes packed ----
+static const u16 ILLUSTRATION_PALETTES_skel_a[64] = {
+  0x000, 0xEEE, 0x868, 0x222, 0x686, 0x646, 0x86A, 0x444, 0x886, 0x666, 0x424, 0x464, 0x8A8, 0x848, 0x888, 0x648,
+  0x000, 0x686, 0x222, 0x464, 0xEEE, 0x868, 0x444, 0x242, 0xA8A, 0x666, 0x886, 0x484, 0x86A, 0x646, 0x888, 0x424,
+  0x000, 0x886, 0x222, 0x68A, 0x664, 0x444, 0x668, 0x688, 0x442, 0x466, 0x8A6, 0x446, 0x884, 0x224, 0x868, 0x468,
+  0x000, 0xEEE, 0x868, 0x222, 0x646, 0xAAA, 0xA68, 0x666, 0xCCC, 0x444, 0x886, 0x424, 0x86A, 0x888, 0x644, 0x846,
+};
+static const u8 ILLUSTRATION_TILES_skel_a[] = {
+  0x70, 0x40, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x22, 0x8B, 0x00, 0x07, 0x59, 0x22, 0x22, 0x2B, 0x77,
+  0x22, 0x22, 0x57, 0x80, 0x03, 0x08, 0x6B, 0x56, 0x22, 0x29, 0xB2, 0x29, 0x55, 0x55, 0x58, 0x86,
+  0x1C, 0x07, 0x66, 0x7F, 0xF9, 0x52, 0x33, 0x33, 0x33, 0x36, 0x80, 0x03, 0x08, 0x33, 0x73, 0x69,
+  0x67, 0x33, 0x7F, 0x22, 0x27, 0x33, 0x8C, 0x3F, 0x01, 0x22, 0xB2, 0x80, 0x03, 0x00, 0x3B, 0x80,
+  0x03, 0x00, 0x39, 0x80, 0x03, 0x00, 0x75, 0x82, 0x0B, 0x02, 0x66, 0x66, 0x33, 0x81, 0x03, 0x00,
+  0xE2, 0x80, 0x03, 0x00, 0x37, 0x80, 0x03, 0x06, 0x33, 0x72, 0x26, 0x33, 0x33, 0x3B, 0x4F, 0x81,
+  0x43, 0x81, 0x00, 0x09, 0x2B, 0x33, 0x34, 0x66, 0x22, 0x7F, 0x22, 0x66, 0x62, 0x66, 0x86, 0x00,
+  0x80, 0x35, 0x01, 0xFF, 0x4B, 0x85, 0x1F, 0x88, 0x15, 0x06, 0x2F, 0x66, 0x22, 0xF9, 0x33, 0x2F,
+  0xE3, 0x85, 0x19, 0x83, 0x00, 0x11, 0x55, 0x52, 0x22, 0x22, 0x5D, 0x22, 0x22, 0x61, 0x62, 0x22,
+  0x71, 0x11, 0x22, 0x26, 0x11, 0x11, 0x22, 0x21, 0x80, 0x03, 0x0C, 0x31, 0x13, 0x1B, 0x27, 0x11,
+  0x72, 0x22, 0x29, 0x11, 0x22, 0x22, 0x73, 0x11, 0x93, 0x00, 0x00, 0x27, 0x80, 0x03, 0x81, 0x2F,
+  0x07, 0x44, 0x44, 0xB7, 0x33, 0x44, 0x44, 0x44, 0x4B, 0x80, 0x03, 0x92, 0x00, 0x81, 0xD3, 0x00,
+  0x32, 0x80, 0x03, 0x01, 0x11, 0x16, 0x80, 0x03, 0x01, 0x11, 0x17, 0x80, 0x03, 0x01, 0x11, 0x62,
+  0x80, 0x03, 0x00, 0x16, 0x85, 0x47, 0x8D, 0xFF, 0x80, 0x00, 0x00, 0x2B, 0x80, 0x03, 0x0C, 0x57,
+  0x82, 0x22, 0x22, 0x6B, 0x42, 0x22, 0x29, 0xB2, 0x22, 0x55, 0x55, 0x58, 0x85, 0x18, 0x04, 0x59,
+  0x66, 0x7F, 0xF9, 0x77, 0x80, 0xB3, 0x81, 0x03, 0x07, 0x56, 0x33, 0x69, 0x63, 0x29, 0x3F, 0x22,
+  0x27, 0x89, 0x38, 0x80, 0xCA, 0x06, 0x22, 0x36, 0xB2, 0x22, 0x22, 0x33, 0x3B, 0x80, 0x03, 0x00,
+  0x39, 0x80, 0x03, 0x00, 0x75, 0x81, 0x0B, 0x04, 0x26, 0x66, 0x33, 0x33, 0x22, 0x80, 0x03, 0x00,
+  0xE2, 0x80, 0x03, 0x01, 0x37, 0x26, 0x80, 0x3A, 0x00, 0x72, 0x80, 0x03, 0x00, 0x3B, 0x85, 0xFF,
+  0x0A, 0x66, 0x23, 0x33, 0x34, 0x66, 0x22, 0x7F, 0x22, 0x66, 0x26, 0x66, 0x82, 0x00, 0x00, 0x22,
+  0x80, 0x02, 0x03, 0x4F, 0x22, 0x22, 0xFF, 0x86, 0x1F, 0x86, 0x00, 0x0A, 0x22, 0x62, 0x66, 0x66,
+  0x62, 0xF9, 0x26, 0x24, 0xE3, 0x33, 0xEB, 0x85, 0x1C, 0x80, 0x00, 0x0E, 0x55, 0x55, 0x52, 0x22,
+  0x55, 0x5D, 0x22, 0x22, 0x5D, 0x62, 0x22, 0x71, 0x22, 0x22, 0x26, 0x80, 0xCF, 0x00, 0x21, 0x80,
+  0x03, 0x07, 0x31, 0x13, 0x22, 0x27, 0x11, 0x72, 0x22, 0x29, 0x80, 0x0A, 0x03, 0x73, 0x11, 0x11,
+  0x61, 0x85, 0xEC, 0x84, 0x00, 0x01, 0x1B, 0xB1, 0x80, 0xF7, 0x00, 0x27, 0x81, 0xFB, 0x05, 0x23,
+  0x11, 0x44, 0x44, 0x44, 0xB7, 0x80, 0x03, 0x96, 0x00, 0x81, 0xD7, 0x06, 0x13, 0x32, 0x22, 0x22,
+  0x11, 0x11, 0x16, 0x80, 0x03, 0x01, 0x11, 0x17, 0x8C, 0x4A, 0x80, 0x43, 0x8B, 0x00, 0x00, 0x62,
+  0x80, 0x03, 0x00, 0x16, 0x80, 0x03, 0x80, 0x7D, 0x08, 0x22, 0x11, 0x32, 0x22, 0x29, 0x22, 0x22,
+  0x88, 0x88, 0x86, 0x1C, 0x07, 0x59, 0xF6, 0x6F, 0x2B, 0x77, 0x33, 0x33, 0x57, 0x80, 0x03, 0x08,
+  0x6B, 0x56, 0x33, 0x69, 0xB2, 0x29, 0x3F, 0x22, 0x58, 0x88, 0x3B, 0x14, 0x99, 0x52, 0x22, 0x22,
+  0x33, 0x36, 0xB2, 0x22, 0x77, 0x33, 0x3B, 0x22, 0xF7, 0x33, 0x39, 0x22, 0x27, 0x33, 0x35, 0x22,
+  0x33, 0x80, 0x0B, 0x80, 0xE6, 0x00, 0x26, 0x80, 0x03, 0x00, 0xE2, 0x80, 0x03, 0x00, 0x37, 0x88,
+  0xFA, 0x82, 0x00, 0x02, 0x66, 0x66, 0x2B, 0x80, 0x03, 0x02, 0x22, 0x7F, 0x66, 0x84, 0x00, 0x05,
+  0x72, 0x26, 0x62, 0x22, 0x3B, 0x4F, 0x80, 0x47, 0x84, 0x00, 0x00, 0x34, 0x80, 0x13, 0x00, 0x22,
+  0x84, 0x03, 0x80, 0x00, 0x06, 0x62, 0x66, 0x22, 0x2F, 0xE3, 0xFF, 0xEB, 0x89, 0x3F, 0x0D, 0x22,
+  0x23, 0x66, 0x66, 0x2F, 0x33, 0x22, 0x2F, 0x93, 0x33, 0xF9, 0x33, 0x33, 0x39, 0x80, 0x12, 0x00,
+  0x3A, 0x80, 0x03, 0x00, 0x9A, 0x80, 0x0A, 0x00, 0xAA, 0x80, 0x6E, 0x09, 0xAA, 0x22, 0x22, 0x73,
+  0x11, 0x22, 0x61, 0x11, 0x11, 0x71, 0x88, 0xF3, 0x02, 0x13, 0x1B, 0x11, 0x80, 0xDE, 0x00, 0x27,
+  0x81, 0xFB, 0x01, 0x26, 0x44, 0x9C, 0x00, 0x00, 0xB7, 0x80, 0x4C, 0x03, 0x44, 0x4B, 0xB3, 0x33,
+  0x80, 0x0A, 0x00, 0x47, 0x91, 0x1F, 0x88, 0xFE, 0x01, 0x22, 0x17, 0x80, 0x03, 0x01, 0x11, 0x62,
+  0x80, 0x03, 0x00, 0x16, 0x80, 0x03, 0x80, 0x61, 0x02, 0x11, 0x11, 0x32, 0x81, 0x16, 0x00, 0x55,
+  0x87, 0x21, 0x13, 0x59, 0x67, 0x22, 0x2B, 0x73, 0x33, 0x22, 0x57, 0x77, 0x33, 0x22, 0x6B, 0x56,
+  0x37, 0x29, 0xB2, 0x29, 0x7F, 0x55, 0x58, 0x87, 0x1D, 0x02, 0x7F, 0x99, 0x52, 0x80, 0xF7, 0x01,
+  0x36, 0xB2, 0x80, 0xB7, 0x08, 0x7B, 0x69, 0xF3, 0x77, 0x79, 0x22, 0x27, 0x77, 0x75, 0x84, 0xCF,
+  0x96, 0x00, 0x16, 0x26, 0x66, 0x66, 0x2B, 0x22, 0x66, 0x66, 0x22, 0xE2, 0x66, 0x66, 0x62, 0x37,
+  0x66, 0x66, 0x66, 0x33, 0x72, 0x26, 0x62, 0x33, 0x3B, 0xEF, 0x80, 0x47, 0x84, 0x00, 0x03, 0x34,
+  0x66, 0x66, 0x7F, 0x81, 0x20, 0x00, 0x62, 0x80, 0x1C, 0x82, 0x00, 0x04, 0x22, 0x24, 0x22, 0xFF,
+  0x4B, 0x86, 0x1E, 0x80, 0x10, 0x80, 0x42, 0x0A, 0x66, 0x2F, 0x62, 0x62, 0x2F, 0x93, 0x22, 0xFE,
+  0x33, 0x33, 0xE3, 0x87, 0x5A, 0x00, 0x39, 0x80, 0x03, 0x11, 0x37, 0x52, 0x22, 0x22, 0x73, 0x22,
+  0x22, 0x61, 0x11, 0x22, 0x71, 0x11, 0x11, 0x26, 0x11, 0x11, 0x11, 0x21, 0x80, 0x03, 0x02, 0x31,
+  0x13, 0x1B, 0x81, 0xDE, 0x01, 0x27, 0x11, 0x80, 0xB3, 0x00, 0x44, 0x98, 0x00, 0x00, 0x37, 0x81,
+  0x04, 0x06, 0xB7, 0x33, 0x33, 0x44, 0x44, 0x4B, 0xB3, 0x95, 0x23, 0x23, 0x22, 0x57, 0xB2, 0x26,
+  0x22, 0xB7, 0xFD, 0xB7, 0x22, 0xB3, 0x33, 0x73, 0x22, 0x26, 0x77, 0x77, 0x22, 0x25, 0x7D, 0x57,
+  0x82, 0x2D, 0x7D, 0x53, 0x82, 0x2D, 0x77, 0x77, 0x82, 0x2D, 0x79, 0xD6, 0x7D, 0x22, 0x26, 0x33,
+  0x80, 0x03, 0x25, 0x7B, 0x79, 0x5B, 0x9B, 0x52, 0x77, 0x77, 0x52, 0x22, 0x76, 0x67, 0xD2, 0x22,
+  0x62, 0x57, 0x22, 0x22, 0x75, 0xB6, 0x22, 0x22, 0x33, 0x36, 0x22, 0x25, 0x93, 0x33, 0x3A, 0x75,
+  0x33, 0x3A, 0xF2, 0x22, 0x33, 0x52, 0x22, 0x66, 0x35, 0x80, 0xE7, 0x00, 0xA2, 0x80, 0x03, 0x80,
+  0x0A, 0x00, 0x66, 0x80, 0x02, 0x0A, 0x2D, 0x22, 0x62, 0x2D, 0x73, 0xFF, 0xFF, 0xFF, 0x55, 0x22,
+  0x22, 0x81, 0x0E, 0x83, 0xFC, 0x13, 0x62, 0x5D, 0x22, 0x23, 0x2A, 0x33, 0x22, 0xF3, 0xA3, 0x33,
+  0x52, 0xF3, 0x33, 0x33, 0x56, 0xD3, 0x55, 0x57, 0xA3, 0x33, 0x80, 0xC6, 0x00, 0x53, 0x81, 0x1B,
+  0x81, 0x36, 0x04, 0x32, 0x22, 0x66, 0x62, 0x3A, 0x80, 0x08, 0x01, 0x33, 0xA2, 0x80, 0x5F, 0x80,
+  0x54, 0x00, 0x33, 0x84, 0x00, 0x00, 0x73, 0x80, 0x03, 0x00, 0x25, 0x80, 0x03, 0x04, 0x62, 0xD3,
+  0x33, 0x33, 0x66, 0x80, 0x08, 0x0C, 0x66, 0x62, 0x73, 0x33, 0x66, 0x66, 0xD3, 0x33, 0x21, 0x11,
+  0x22, 0x22, 0x31, 0x80, 0x03, 0x00, 0x91, 0x82, 0x03, 0x00, 0x62, 0x80, 0x0B, 0x00, 0x12, 0x80,
+  0x03, 0x00, 0x1B, 0x80, 0x03, 0x04, 0x11, 0xB2, 0x61, 0x11, 0x11, 0x80, 0x15, 0x00, 0x71, 0x80,
+  0x03, 0x01, 0x22, 0x31, 0x80, 0x03, 0x00, 0x27, 0x80, 0x03, 0x8A, 0x00, 0x03, 0x13, 0x36, 0x63,
+  0x13, 0x80, 0x22, 0x86, 0x00, 0x04, 0x23, 0x11, 0x11, 0x16, 0x22, 0x80, 0x3F, 0x04, 0x22, 0x11,
+  0xB2, 0x22, 0x61, 0x80, 0x03, 0x80, 0x42, 0x01, 0x22, 0x44, 0x82, 0x00, 0x05, 0x4B, 0x74, 0x44,
+  0xBB, 0x73, 0x37, 0x85, 0x8B, 0x89, 0x00, 0x24, 0x18, 0x22, 0x57, 0xB2, 0x14, 0x22, 0xB7, 0xFD,
+  0x11, 0x22, 0xB3, 0x77, 0x11, 0x22, 0x26, 0x37, 0x8A, 0x22, 0x25, 0x7D, 0x21, 0x82, 0x2D, 0x7D,
+  0x24, 0x82, 0x2D, 0x37, 0x28, 0x82, 0x2D, 0x79, 0x26, 0x3D, 0x22, 0x26, 0xB7, 0x80, 0x03, 0x03,
+  0x73, 0x39, 0x5B, 0x9B, 0x80, 0xC5, 0x19, 0x52, 0x57, 0x76, 0x63, 0xD2, 0x57, 0x62, 0x57, 0x22,
+  0x73, 0x75, 0xB6, 0x22, 0xDF, 0x77, 0x76, 0x22, 0xEE, 0x93, 0x33, 0x3A, 0xE5, 0x33, 0x3A, 0xF2,
+  0x73, 0x81, 0xEB, 0x08, 0x37, 0x26, 0x22, 0x33, 0xA2, 0x26, 0x66, 0x33, 0x52, 0x80, 0xFF, 0x0E,
+  0x22, 0x66, 0x22, 0x37, 0x22, 0x22, 0x2D, 0x75, 0xDD, 0xDD, 0xDD, 0x22, 0x66, 0x66, 0x66, 0x80,
+  0x0E, 0x80, 0x02, 0x80, 0x07, 0x12, 0x22, 0x5F, 0x66, 0x22, 0x2A, 0x33, 0x26, 0x2D, 0xA3, 0x33,
+  0x56, 0x73, 0x33, 0x33, 0x52, 0x55, 0x55, 0x57, 0xA3, 0x89, 0xD3, 0x04, 0x23, 0x32, 0x22, 0x22,
+  0xF3, 0x80, 0x3C, 0x07, 0xF3, 0x33, 0xA2, 0x66, 0xD3, 0x33, 0x33, 0xF2, 0x81, 0xA3, 0x00, 0x53,
+  0x80, 0x03, 0x00, 0x22, 0x80, 0x2C, 0x08, 0x66, 0x25, 0x33, 0x33, 0x26, 0x62, 0xD3, 0x33, 0x66,
+  0x80, 0x08, 0x80, 0x49, 0x00, 0x73, 0x80, 0x56, 0x06, 0xD3, 0x22, 0x21, 0x11, 0x22, 0x22, 0x31,
+  0x80, 0x03, 0x00, 0x91, 0x82, 0x03, 0x00, 0x62, 0x80, 0x0B, 0x00, 0x12, 0x80, 0x03, 0x00, 0x1B,
+  0x80, 0x03, 0x02, 0x11, 0x22, 0x61, 0x80, 0x03, 0x02, 0x22, 0x22, 0x71, 0x89, 0x5F, 0x85, 0x00,
+  0x00, 0xB2, 0x80, 0x03, 0x04, 0x11, 0x13, 0x33, 0x33, 0x11, 0x80, 0x00, 0x80, 0x2A, 0x01, 0x11,
+  0x27, 0x80, 0x03, 0x01, 0x22, 0x23, 0x81, 0x2F, 0x80, 0x3F, 0x02, 0x22, 0x11, 0xB2, 0x80, 0x3B,
+  0x05, 0xB2, 0x13, 0x11, 0x11, 0xB2, 0x44, 0x83, 0x00, 0x05, 0x4B, 0x44, 0x44, 0xBB, 0x73, 0x47,
+  0x81, 0x8C, 0x8C, 0x00, 0x0F, 0x11, 0x17, 0x22, 0x6E, 0x61, 0x13, 0x22, 0xDE, 0x26, 0x11, 0x22,
+  0xDE, 0x22, 0x11, 0x22, 0x29, 0x80, 0x6D, 0x06, 0x26, 0x22, 0x21, 0x72, 0x2F, 0x22, 0x23, 0x80,
+  0x03, 0x33, 0x26, 0x72, 0x2F, 0xB2, 0x26, 0x3D, 0x22, 0xFD, 0xB7, 0x3D, 0x22, 0x33, 0x77, 0x79,
+  0x5B, 0x33, 0x77, 0x73, 0x73, 0x7D, 0x57, 0x36, 0x67, 0x7D, 0x57, 0x62, 0x57, 0x77, 0x77, 0x75,
+  0xB7, 0x79, 0xD6, 0x33, 0x37, 0x32, 0xEE, 0x93, 0x33, 0x32, 0xE5, 0x33, 0x3A, 0x95, 0x73, 0x33,
+  0x52, 0x73, 0x33, 0x37, 0x22, 0xA3, 0x80, 0xF7, 0x02, 0x33, 0x33, 0x52, 0x80, 0x03, 0x01, 0x26,
+  0x66, 0x80, 0x0E, 0x09, 0x22, 0x3A, 0x75, 0xFF, 0xFF, 0xF2, 0x22, 0x66, 0x22, 0x22, 0x80, 0xF0,
+  0x80, 0xEF, 0x80, 0x00, 0x11, 0x22, 0x5F, 0x66, 0x66, 0x2A, 0x33, 0x22, 0x2D, 0xA3, 0x33, 0x2D,
+  0x73, 0x33, 0x33, 0xDD, 0x55, 0x55, 0x57, 0x82, 0xD0, 0x82, 0x1A, 0x12, 0x22, 0x22, 0x26, 0x23,
+  0x32, 0x26, 0x22, 0xF3, 0x33, 0x22, 0x52, 0xF3, 0x33, 0xA2, 0x52, 0xD3, 0x33, 0x33, 0xA3, 0x80,
+  0xA3, 0x06, 0x22, 0x53, 0x33, 0x33, 0x66, 0x22, 0x73, 0x80, 0x03, 0x00, 0x25, 0x80, 0x03, 0x01,
+  0x62, 0xD3, 0x80, 0x29, 0x00, 0x25, 0x81, 0x2D, 0x00, 0xF2, 0x80, 0x03, 0x06, 0x33, 0x33, 0x34,
+  0x44, 0x33, 0x33, 0xB4, 0x8E, 0x03, 0x00, 0x73, 0x80, 0x03, 0x02, 0xD3, 0x33, 0x74, 0x80, 0x0B,
+  0x87, 0x00, 0x80, 0x6E, 0x01, 0x33, 0x43, 0x80, 0x03, 0x81, 0x14, 0x01, 0x44, 0xB3, 0x80, 0x03,
+  0x08, 0x44, 0x4B, 0xBB, 0x71, 0x11, 0x11, 0x11, 0x22, 0x31, 0x80, 0x03, 0x00, 0x27, 0x80, 0x03,
+  0x01, 0x22, 0x23, 0x80, 0x03, 0x00, 0x22, 0x84, 0x03, 0x03, 0x61, 0x11, 0x33, 0x13, 0x80, 0x1C,
+  0x87, 0x00, 0x05, 0x33, 0x11, 0x16, 0x22, 0x22, 0x12, 0x80, 0x1C, 0x00, 0xB2, 0x88, 0x03, 0x09,
+  0x11, 0x11, 0x17, 0x22, 0x13, 0x61, 0x13, 0x22, 0x62, 0x26, 0x85, 0x3A, 0x00, 0x71, 0x80, 0x03,
+  0x01, 0x21, 0x72, 0x80, 0x4B, 0x80, 0x03, 0x4D, 0x27, 0x72, 0x57, 0xB2, 0x26, 0x3D, 0xB3, 0xFD,
+  0xB7, 0x3D, 0xB3, 0x77, 0x33, 0x39, 0x2F, 0x77, 0x33, 0x77, 0x25, 0x7D, 0x57, 0x76, 0x2D, 0x7D,
+  0x57, 0x62, 0x2D, 0x37, 0x77, 0x75, 0x2D, 0x79, 0xDF, 0x77, 0x22, 0x26, 0x33, 0x92, 0x22, 0x26,
+  0x79, 0x22, 0x5B, 0x9B, 0x52, 0x22, 0x33, 0x52, 0x22, 0x25, 0x67, 0xD2, 0x22, 0xDE, 0x57, 0x22,
+  0x22, 0xBE, 0x96, 0x22, 0x22, 0xEE, 0x76, 0x22, 0x25, 0xEE, 0x33, 0x3A, 0x75, 0xFF, 0x3A, 0xF2,
+  0x22, 0x22, 0x52, 0x22, 0x22, 0x66, 0x83, 0x01, 0x01, 0x66, 0x62, 0x80, 0xFB, 0x0C, 0x2A, 0x66,
+  0x62, 0x2D, 0xA3, 0x22, 0x2D, 0x73, 0x33, 0xFF, 0xFF, 0x55, 0x55, 0x80, 0x70, 0x80, 0x00, 0x80,
+  0x17, 0x80, 0x05, 0x09, 0x5F, 0x22, 0x23, 0x32, 0x33, 0x26, 0xF3, 0x33, 0x33, 0x56, 0x80, 0x03,
+  0x16, 0x52, 0xD3, 0x33, 0x57, 0xA3, 0x33, 0x33, 0x22, 0x22, 0x53, 0x33, 0x66, 0x62, 0x22, 0x73,
+  0x66, 0x66, 0x26, 0x25, 0x26, 0x66, 0x26, 0x62, 0x80, 0x43, 0x01, 0x66, 0xA2, 0x80, 0x04, 0x01,
+  0x33, 0x52, 0x80, 0x03, 0x02, 0x33, 0x33, 0x34, 0x80, 0x03, 0x00, 0xB4, 0x80, 0x03, 0x00, 0x94,
+  0x81, 0x07, 0x00, 0xD3, 0x80, 0x03, 0x00, 0x65, 0x80, 0x03, 0x07, 0x62, 0x73, 0x33, 0xB4, 0x66,
+  0xD3, 0x33, 0x74, 0x85, 0xD5, 0x82, 0x03, 0x00, 0x62, 0x80, 0x03, 0x00, 0x12, 0x80, 0x03, 0x00,
+  0x1B, 0x81, 0xF7, 0x00, 0xB2, 0x80, 0x03, 0x04, 0x11, 0x13, 0x22, 0x71, 0x11, 0x80, 0x1A, 0x00,
+  0x31, 0x80, 0x03, 0x00, 0x27, 0x81, 0x22, 0x00, 0x23, 0x83, 0x8B, 0x82, 0x00, 0x03, 0x61, 0x66,
+  0x63, 0x13, 0x80, 0x22, 0x89, 0x00, 0x00, 0x16, 0x83, 0x3F, 0x00, 0xB2, 0x87, 0x03, 0x08, 0x42,
+  0x25, 0x75, 0x29, 0x42, 0x22, 0xD2, 0x2D, 0x42, 0x80, 0x30, 0x0F, 0x82, 0x22, 0x92, 0x26, 0x22,
+  0x25, 0x72, 0x27, 0x22, 0x25, 0x7D, 0x57, 0x22, 0x22, 0x67, 0x77, 0x80, 0x12, 0x08, 0x59, 0x7F,
+  0xB6, 0x22, 0x2E, 0x5D, 0x25, 0x22, 0x2E, 0x80, 0x0B, 0x19, 0x5E, 0xB2, 0x25, 0x22, 0xBE, 0x62,
+  0x59, 0x22, 0xBE, 0x37, 0x7F, 0x22, 0xBE, 0x33, 0x3F, 0x22, 0x5E, 0x67, 0x3F, 0x22, 0x2E, 0x25,
+  0xAA, 0x33, 0x33, 0x23, 0x80, 0xB8, 0x00, 0x2A, 0x80, 0x03, 0x00, 0x2F, 0x80, 0x03, 0x00, 0x62,
+  0x80, 0xEF, 0x00, 0x66, 0x80, 0x0C, 0x00, 0x66, 0x81, 0xF3, 0x05, 0x66, 0x22, 0x55, 0x33, 0x33,
+  0x56, 0x80, 0x1E, 0x00, 0x76, 0x80, 0x03, 0x14, 0x56, 0x25, 0x33, 0x33, 0x26, 0x62, 0x33, 0x33,
+  0x22, 0x62, 0x33, 0x35, 0x22, 0x66, 0x33, 0x32, 0x26, 0x66, 0x5A, 0x52, 0x26, 0x80, 0xFF, 0x01,
+  0x3A, 0x52, 0x80, 0x36, 0x86, 0x00, 0x00, 0x53, 0x80, 0x03, 0x80, 0x28, 0x05, 0x33, 0x22, 0x27,
+  0xAA, 0xA7, 0x66, 0x80, 0x74, 0x0B, 0x55, 0xCC, 0x5F, 0x22, 0xDD, 0x55, 0x55, 0x22, 0x22, 0x25,
+  0x55, 0xF2, 0x80, 0x03, 0x11, 0xD2, 0x22, 0xD5, 0x55, 0xD2, 0x2D, 0x5C, 0xC5, 0xD2, 0x55, 0x55,
+  0x55, 0xD2, 0x5C, 0x88, 0x8C, 0xF2, 0x21, 0x80, 0xD5, 0x00, 0x23, 0x80, 0x03, 0x01, 0x22, 0x91,
+  0x80, 0x03, 0x80, 0x08, 0x80, 0xF6, 0x80, 0x03, 0x00, 0x27, 0x80, 0x03, 0x01, 0x22, 0x21, 0x81,
+  0x03, 0x87, 0xFB, 0x08, 0xB7, 0x31, 0x11, 0x13, 0x22, 0x71, 0x11, 0x17, 0x27, 0x80, 0x29, 0x89,
+  0x00, 0x04, 0xB2, 0x22, 0x11, 0x11, 0x12, 0x80, 0x03, 0x05, 0x13, 0x22, 0x67, 0x11, 0x11, 0x32,
+  0x80, 0x31, 0x02, 0x13, 0x17, 0x26, 0x80, 0x16, 0x03, 0x73, 0x11, 0x11, 0xE1, 0x81, 0x57, 0x90,
+  0x00, 0x02, 0x1B, 0x33, 0x33, 0x85, 0x3C, 0x08, 0x32, 0x22, 0x32, 0x2F, 0xEF, 0x22, 0x32, 0x22,
+  0xF2, 0x80, 0x03, 0x10, 0x22, 0x29, 0x72, 0x22, 0x92, 0x93, 0x22, 0x26, 0x52, 0x12, 0x22, 0x26,
+  0xEF, 0x72, 0x22, 0x22, 0x5E, 0x81, 0x2B, 0x06, 0x29, 0x36, 0xB6, 0x22, 0x2D, 0x5D, 0x25, 0x82,
+  0x37, 0x1C, 0x26, 0xB2, 0x25, 0x22, 0x27, 0x62, 0x59, 0x22, 0x57, 0x77, 0x7F, 0x22, 0x77, 0x33,
+  0x3F, 0x22, 0x59, 0x67, 0x39, 0x22, 0x32, 0x65, 0xAA, 0x33, 0x32, 0x23, 0x33, 0x33, 0x72, 0x80,
+  0x03, 0x01, 0x52, 0x2F, 0x80, 0x03, 0x0F, 0x22, 0xA3, 0x33, 0x52, 0x66, 0x2A, 0x33, 0x72, 0x26,
+  0x22, 0x53, 0xA2, 0x26, 0x22, 0x22, 0x33, 0x80, 0x1A, 0x84, 0x03, 0x00, 0x52, 0x80, 0x03, 0x81,
+  0x0F, 0x80, 0x03, 0x09, 0x35, 0x26, 0x33, 0x33, 0x32, 0x26, 0x77, 0x7A, 0x52, 0x22, 0x80, 0x36,
+  0x00, 0x3A, 0x80, 0x03, 0x01, 0x33, 0x25, 0x85, 0x1C, 0x00, 0x53, 0x80, 0x03, 0x00, 0x65, 0x80,
+  0x03, 0x11, 0x22, 0x27, 0xAA, 0x66, 0x66, 0x22, 0x22, 0x52, 0x62, 0x62, 0x6A, 0x33, 0x5F, 0x22,
+  0x2D, 0x33, 0x33, 0x3D, 0x80, 0x1E, 0x01, 0x32, 0x66, 0x80, 0x46, 0x08, 0x66, 0x33, 0x35, 0x22,
+  0x66, 0xA7, 0x22, 0x62, 0x66, 0x80, 0x02, 0x00, 0x62, 0x80, 0xEF, 0x09, 0x11, 0x22, 0x23, 0x11,
+  0x11, 0xF2, 0x22, 0x91, 0x11, 0xD2, 0x80, 0x08, 0x03, 0xD2, 0x22, 0x22, 0x61, 0x80, 0x03, 0x00,
+  0x27, 0x80, 0x03, 0x80, 0xD4, 0x01, 0x22, 0x69, 0x85, 0xE8, 0x80, 0x00, 0x08, 0xB7, 0x11, 0x11,
+  0x13, 0x22, 0x11, 0x11, 0x17, 0x27, 0x81, 0x0C, 0x80, 0x36, 0x02, 0x11, 0x9E, 0xEE, 0x82, 0x17,
+  0x00, 0xB2, 0x80, 0x03, 0x01, 0x12, 0x31, 0x80, 0x1C, 0x04, 0x71, 0x66, 0x11, 0x11, 0x91, 0x81,
+  0x50, 0x01, 0x17, 0x26, 0x80, 0x12, 0x00, 0x73, 0x80, 0x03, 0x01, 0xE1, 0x11, 0x80, 0x92, 0x86,
+  0x00, 0x00, 0xB3, 0x80, 0x03, 0x00, 0x4B, 0x80, 0x03, 0x04, 0x44, 0x4B, 0xBB, 0xBB, 0x44, 0x82,
+  0x00, 0x04, 0x4C, 0xCC, 0x22, 0x22, 0x32, 0x80, 0xE5, 0x00, 0x32, 0x80, 0x6D, 0x80, 0x03, 0x08,
+  0x29, 0x72, 0x22, 0x22, 0x93, 0x22, 0x26, 0x11, 0x12, 0x80, 0x03, 0x80, 0x0A, 0x0B, 0x32, 0x22,
+  0x26, 0x96, 0x3D, 0x29, 0x7F, 0xB6, 0xD2, 0x2D, 0x5D, 0x25, 0x80, 0x20, 0x23, 0x22, 0x92, 0x26,
+  0xB2, 0x25, 0x62, 0x27, 0x62, 0x59, 0x7D, 0x57, 0x37, 0x7F, 0x67, 0x77, 0x73, 0x7F, 0x22, 0x59,
+  0x63, 0x79, 0x22, 0x25, 0x5D, 0xF2, 0x22, 0x25, 0x52, 0x22, 0x22, 0x65, 0x5F, 0x22, 0x22, 0xD5,
+  0x5D, 0x80, 0x03, 0x01, 0x55, 0xF2, 0x80, 0x03, 0x08, 0x5F, 0x22, 0x65, 0xC5, 0xC5, 0xE2, 0x25,
+  0x55, 0x88, 0x89, 0x7F, 0x88, 0x00, 0x09, 0x35, 0x53, 0x33, 0x33, 0x32, 0x62, 0x77, 0x7A, 0x56,
+  0xD5, 0x81, 0x3A, 0x80, 0x03, 0x81, 0x3A, 0x01, 0x55, 0x55, 0x80, 0x03, 0x0F, 0xC5, 0xD2, 0x22,
+  0x55, 0xCC, 0x5D, 0x22, 0x55, 0x5C, 0x55, 0x56, 0x89, 0x58, 0xCC, 0xC5, 0x3A, 0x80, 0x1B, 0x02,
+  0x33, 0x33, 0x5F, 0x80, 0x03, 0x01, 0x33, 0x32, 0x84, 0x03, 0x00, 0x52, 0x80, 0x3E, 0x04, 0x22,
+  0xAA, 0xA7, 0x22, 0x66, 0x80, 0x92, 0x01, 0x66, 0x5F, 0x80, 0xEF, 0x03, 0x55, 0x22, 0x23, 0x11,
+  0x80, 0x75, 0x04, 0x91, 0x55, 0xD2, 0x22, 0x23, 0x80, 0x03, 0x01, 0x22, 0xCC, 0x84, 0x03, 0x04,
+  0x8C, 0xF2, 0x22, 0x22, 0x11, 0x8B, 0x00, 0x05, 0x13, 0x61, 0x11, 0x11, 0x17, 0x27, 0x80, 0x08,
+  0x80, 0x36, 0x04, 0x11, 0x22, 0x3E, 0xE1, 0x99, 0x85, 0x18, 0x01, 0x17, 0x31, 0x80, 0x0F, 0x04,
+  0x71, 0x66, 0x11, 0x26, 0x91, 0x81, 0x19, 0x01, 0x17, 0x26, 0x80, 0x12, 0x05, 0x73, 0x9E, 0xE1,
+  0x11, 0x11, 0xB2, 0x80, 0x64, 0x00, 0x12, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x01, 0x11, 0x32,
+  0x80, 0x03, 0x80, 0x08, 0x03, 0x11, 0x11, 0x1B, 0x33, 0x85, 0x37, 0x80, 0x16, 0x80, 0x15, 0x85,
+  0x03, 0x08, 0x21, 0x72, 0x22, 0x22, 0x93, 0x22, 0x33, 0x11, 0x12, 0x80, 0x23, 0x00, 0x72, 0x82,
+  0x2F, 0x06, 0x25, 0x3D, 0x29, 0x3F, 0x22, 0xD2, 0x2D, 0x80, 0xDD, 0x80, 0x00, 0x27, 0x92, 0x29,
+  0xB2, 0x25, 0x62, 0x27, 0x6D, 0x25, 0x7D, 0x57, 0x77, 0x22, 0x66, 0x77, 0x33, 0x22, 0x22, 0x59,
+  0x67, 0xB6, 0x22, 0x2E, 0xEB, 0x25, 0x22, 0x2E, 0xE2, 0x22, 0x22, 0x5E, 0xED, 0x25, 0x22, 0xBE,
+  0xE6, 0x59, 0x22, 0xBE, 0xEE, 0x7F, 0x80, 0x03, 0x02, 0x3F, 0x22, 0x5E, 0x80, 0x03, 0x02, 0x2E,
+  0xEE, 0xAA, 0x80, 0xF0, 0x89, 0x00, 0x00, 0xA3, 0x80, 0x03, 0x00, 0x2A, 0x80, 0x03, 0x0B, 0x22,
+  0x53, 0x33, 0x33, 0x66, 0x2D, 0x77, 0x7A, 0x33, 0x72, 0x23, 0x33, 0x82, 0x03, 0x01, 0x52, 0x25,
+  0x80, 0x14, 0x00, 0x22, 0x80, 0x03, 0x11, 0x66, 0x53, 0x35, 0x26, 0x22, 0x65, 0x32, 0x26, 0x66,
+  0x66, 0x52, 0x66, 0x66, 0x66, 0x33, 0x3A, 0x52, 0x26, 0x80, 0x2E, 0x00, 0x5F, 0x8C, 0x46, 0x19,
+  0x35, 0x27, 0x33, 0xA7, 0x22, 0x62, 0x22, 0x22, 0x62, 0x66, 0x6A, 0x33, 0x34, 0x22, 0x2D, 0x33,
+  0x3B, 0x3D, 0x62, 0xA3, 0x33, 0x32, 0x62, 0x53, 0x33, 0x52, 0x80, 0x03, 0x00, 0x26, 0x80, 0x03,
+  0x00, 0x22, 0x80, 0x60, 0x02, 0x22, 0x22, 0xA3, 0x86, 0xE7, 0x00, 0x91, 0x80, 0x03, 0x00, 0x23,
+  0x81, 0xEF, 0x00, 0x61, 0x80, 0x03, 0x00, 0x27, 0x81, 0xF7, 0x00, 0x21, 0x82, 0x03, 0x86, 0x00,
+  0x09, 0x17, 0x31, 0x11, 0x13, 0x22, 0x71, 0x66, 0x17, 0x26, 0x91, 0x80, 0xFB, 0x01, 0x11, 0x17,
+  0x86, 0x17, 0x04, 0xB2, 0x22, 0x22, 0x11, 0x12, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x01, 0x11,
+  0x32, 0x80, 0x31, 0x06, 0x13, 0x22, 0x26, 0x11, 0x11, 0x1B, 0x73, 0x84, 0x1E, 0x00, 0x22, 0x88,
+  0x00, 0x04, 0x12, 0x24, 0x45, 0x22, 0xC2, 0x80, 0x56, 0x02, 0x42, 0x81, 0x1C, 0x81, 0x0E, 0x00,
+  0x25, 0x81, 0x04, 0x03, 0x2D, 0x52, 0x22, 0x2E, 0x85, 0x0B, 0x03, 0x88, 0x88, 0x22, 0x57, 0x80,
+  0x32, 0x19, 0x70, 0x11, 0x11, 0xA7, 0x00, 0x11, 0x1A, 0x70, 0x00, 0x5C, 0x1A, 0x00, 0x00, 0xC5,
+  0x58, 0x89, 0x62, 0x58, 0xE2, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x20, 0x80, 0x03, 0x80, 0x00,
+  0x3D, 0x02, 0x00, 0x00, 0x6E, 0x89, 0x00, 0x68, 0x85, 0x55, 0x0E, 0x85, 0x5C, 0x58, 0x6E, 0x85,
+  0x5C, 0xCC, 0x00, 0x9C, 0xCC, 0xCC, 0x00, 0x28, 0x5D, 0x55, 0x00, 0x0E, 0x22, 0xDC, 0x00, 0x29,
+  0x22, 0x55, 0xE9, 0x82, 0xF5, 0x5D, 0x55, 0x55, 0x55, 0x5F, 0x88, 0x59, 0x98, 0xD6, 0xCC, 0x55,
+  0x55, 0x5C, 0xCC, 0xCC, 0x5C, 0x85, 0x55, 0xCC, 0x85, 0x00, 0x55, 0x58, 0x60, 0x00, 0xF2, 0x80,
+  0x4B, 0x00, 0x2E, 0x80, 0x48, 0x00, 0x92, 0x80, 0x06, 0x08, 0x90, 0x00, 0x06, 0xE2, 0x54, 0x30,
+  0x39, 0x7D, 0x30, 0x83, 0x57, 0x83, 0x00, 0x37, 0x07, 0x93, 0x00, 0x37, 0xD3, 0x37, 0xD9, 0x73,
+  0x33, 0xB4, 0x77, 0x39, 0x42, 0x22, 0x23, 0x33, 0x33, 0x33, 0x44, 0x97, 0x33, 0x3B, 0x4B, 0x09,
+  0x73, 0x34, 0x4E, 0x00, 0x93, 0x44, 0xC3, 0x00, 0x0E, 0xBB, 0xE0, 0x00, 0x09, 0x33, 0x90, 0x70,
+  0x03, 0x43, 0x73, 0xE0, 0x00, 0xC4, 0xC0, 0x44, 0x4C, 0xC4, 0x97, 0x4C, 0x93, 0x00, 0x00, 0x70,
+  0x87, 0x40, 0x04, 0x9E, 0x00, 0x09, 0xE7, 0x74, 0x80, 0x23, 0x0D, 0x9E, 0x00, 0x0E, 0xE9, 0x30,
+  0x26, 0x98, 0x13, 0x27, 0x00, 0x02, 0x86, 0x22, 0x00, 0x80, 0x98, 0x08, 0x00, 0x00, 0x09, 0x22,
+  0x98, 0x20, 0x09, 0x22, 0xE6, 0x80, 0xA8, 0x28, 0x00, 0x00, 0x61, 0x22, 0x00, 0x06, 0xE3, 0x22,
+  0x7B, 0xB9, 0x47, 0x33, 0x33, 0x90, 0x0E, 0x33, 0x39, 0x30, 0x03, 0x77, 0x39, 0x00, 0x00, 0x98,
+  0x39, 0x00, 0x03, 0xB8, 0x37, 0x00, 0x09, 0x3B, 0x93, 0x00, 0x08, 0x33, 0x90, 0x00, 0x77, 0x37,
+  0x22, 0x84, 0x00, 0x00, 0x82, 0x80, 0x03, 0x0B, 0x11, 0x12, 0x24, 0x45, 0x11, 0xC2, 0x21, 0x11,
+  0xCC, 0x42, 0x81, 0x1C, 0x81, 0x13, 0x00, 0x55, 0x80, 0x03, 0x04, 0x33, 0x7E, 0xE9, 0x99, 0x3E,
+  0x80, 0x7C, 0x00, 0x90, 0x80, 0x79, 0x81, 0x03, 0x80, 0x8A, 0x06, 0x07, 0x3E, 0x97, 0x00, 0x09,
+  0x37, 0x89, 0x80, 0x81, 0x80, 0x07, 0x1C, 0x69, 0x8C, 0xCC, 0x8C, 0x00, 0x9C, 0xCE, 0x2E, 0x00,
+  0x28, 0x82, 0x00, 0x00, 0x9C, 0x80, 0x00, 0x99, 0x95, 0x50, 0x00, 0x22, 0xDC, 0x60, 0x00, 0x2F,
+  0x58, 0x00, 0x00, 0x25, 0x80, 0x03, 0x25, 0x55, 0x55, 0x55, 0x58, 0x8C, 0xCC, 0xCC, 0x59, 0x85,
+  0x55, 0xCC, 0x59, 0x6D, 0x5C, 0x5D, 0x29, 0x0E, 0x65, 0x52, 0x26, 0x06, 0x95, 0x52, 0x67, 0x00,
+  0x85, 0x55, 0x82, 0x00, 0x28, 0x5C, 0x80, 0x69, 0x85, 0xC5, 0xCC, 0x00, 0x28, 0x80, 0x03, 0x0A,
+  0x0E, 0x5C, 0xCC, 0x00, 0x09, 0x5C, 0x55, 0x00, 0x09, 0x2F, 0x66, 0x80, 0xC6, 0x00, 0x22, 0x85,
+  0x03, 0x11, 0x66, 0x22, 0x22, 0x25, 0x66, 0x66, 0x22, 0x53, 0x62, 0x66, 0xFA, 0x33, 0x22, 0x5A,
+  0x33, 0x33, 0xA3, 0x33, 0x86, 0x00, 0x0D, 0xA5, 0x33, 0x37, 0x52, 0x22, 0x22, 0x29, 0x99, 0x62,
+  0x29, 0x92, 0x00, 0x00, 0xE2, 0x84, 0x9F, 0x0A, 0x90, 0x00, 0x06, 0x9E, 0x90, 0x00, 0x69, 0x22,
+  0x50, 0x00, 0x97, 0x80, 0x07, 0x01, 0x99, 0x20, 0x80, 0x94, 0x00, 0xBB, 0x80, 0xB2, 0x80, 0xB6,
+  0x32, 0x00, 0x93, 0x37, 0x77, 0x00, 0x93, 0xC4, 0xE3, 0x00, 0x93, 0x9E, 0x30, 0x00, 0xE3, 0x70,
+  0x00, 0x09, 0x73, 0x00, 0x00, 0x99, 0x33, 0x44, 0x4C, 0x34, 0xCB, 0xB4, 0xC3, 0x00, 0x97, 0x74,
+  0xC0, 0x00, 0x09, 0x74, 0x40, 0x00, 0x04, 0x74, 0x90, 0x00, 0x3E, 0x7C, 0x70, 0x00, 0x94, 0x34,
+  0x00, 0x00, 0xEB, 0x39, 0x80, 0x03, 0x03, 0x27, 0x63, 0x29, 0x02, 0x80, 0x64, 0x03, 0x00, 0x22,
+  0x22, 0x26, 0x80, 0x03, 0x00, 0x66, 0x80, 0x03, 0x00, 0x92, 0x80, 0x03, 0x00, 0x90, 0x86, 0x03,
+  0x0E, 0xE3, 0x33, 0x79, 0x07, 0x39, 0x33, 0xE0, 0x00, 0x09, 0x77, 0x90, 0x00, 0x0C, 0x8C, 0x30,
+  0x80, 0x03, 0x06, 0x00, 0x00, 0x3E, 0xB8, 0x00, 0x00, 0x73, 0x80, 0x3C, 0x00, 0x97, 0x80, 0x75,
+  0x00, 0x62, 0x80, 0x3B, 0x00, 0x92, 0x84, 0x03, 0x21, 0x63, 0x22, 0x79, 0x00, 0x08, 0x22, 0xAA,
+  0x00, 0x0A, 0x22, 0xA9, 0x00, 0x02, 0x96, 0xA9, 0x00, 0x00, 0xE7, 0x33, 0x00, 0x0E, 0x25, 0x58,
+  0x20, 0x06, 0x66, 0xC9, 0x00, 0x00, 0x92, 0xE2, 0x00, 0x02, 0x92, 0x80, 0xBD, 0x00, 0x32, 0x80,
+  0x03, 0x1B, 0x26, 0x60, 0x00, 0x09, 0x29, 0x20, 0x02, 0x09, 0x2E, 0x00, 0x00, 0xEC, 0x55, 0x55,
+  0x85, 0x08, 0xCC, 0xC8, 0x60, 0x05, 0xDC, 0x82, 0x00, 0x09, 0x6E, 0x00, 0x00, 0xDE, 0x80, 0xE4,
+  0x30, 0x86, 0x00, 0x00, 0x0E, 0x60, 0x00, 0x0F, 0x85, 0x00, 0x00, 0x98, 0x55, 0x00, 0x0E, 0x5C,
+  0xC5, 0x00, 0x06, 0x55, 0x8E, 0x00, 0x06, 0xCC, 0x90, 0x00, 0x28, 0x58, 0x20, 0x6E, 0x85, 0xF6,
+  0x20, 0x95, 0x5D, 0x22, 0x90, 0x55, 0x5F, 0x26, 0x60, 0x5C, 0xD2, 0x29, 0x00, 0xC8, 0x8E, 0x59,
+  0x66, 0x62, 0x80, 0xFC, 0x86, 0x00, 0x27, 0x02, 0x69, 0x99, 0x00, 0xE9, 0x22, 0x22, 0x02, 0x62,
+  0x22, 0x22, 0x09, 0x69, 0x99, 0x99, 0x3B, 0xD9, 0x33, 0x37, 0x00, 0x0D, 0x33, 0xD9, 0x00, 0x07,
+  0x39, 0x90, 0x00, 0x3D, 0x3E, 0x30, 0x77, 0x73, 0x39, 0x90, 0x33, 0x33, 0x33, 0x70, 0xB4, 0x80,
+  0x07, 0x05, 0xDD, 0x73, 0x37, 0x00, 0xE9, 0x30, 0x89, 0x3C, 0x26, 0x07, 0x99, 0x00, 0x3E, 0x99,
+  0x44, 0x00, 0xE7, 0x37, 0xBC, 0x03, 0x93, 0x37, 0xE3, 0x07, 0x4B, 0xE9, 0x00, 0x00, 0x7C, 0x44,
+  0x44, 0x00, 0x07, 0xC4, 0x44, 0x00, 0x00, 0xC4, 0x44, 0x70, 0x00, 0x4B, 0x44, 0xC7, 0x00, 0x93,
+  0x44, 0x90, 0x80, 0x03, 0x0E, 0x00, 0x09, 0x73, 0x74, 0x00, 0x39, 0x33, 0x33, 0x13, 0x27, 0x63,
+  0x22, 0x17, 0x22, 0x22, 0x82, 0x03, 0x00, 0x13, 0x80, 0x03, 0x00, 0x1B, 0x88, 0x03, 0x00, 0x33,
+  0x80, 0x03, 0x86, 0x00, 0x06, 0x28, 0x52, 0x22, 0x22, 0x21, 0x11, 0x12, 0x80, 0x03, 0x04, 0xC2,
+  0x22, 0x24, 0x44, 0x42, 0x82, 0x13, 0x01, 0x25, 0x55, 0x81, 0x05, 0x00, 0x2D, 0x85, 0x22, 0x0B,
+  0x24, 0x45, 0x22, 0x88, 0x21, 0x11, 0x22, 0x11, 0x81, 0x1C, 0x22, 0x11, 0x80, 0x1C, 0x80, 0x03,
+  0x09, 0x28, 0x5C, 0x6F, 0x22, 0x25, 0x5C, 0x22, 0x22, 0x26, 0xCC, 0x80, 0x1E, 0x01, 0xD5, 0x77,
+  0x80, 0x14, 0x02, 0xAA, 0xA3, 0x72, 0x80, 0x03, 0x22, 0x22, 0xDC, 0xAA, 0xA7, 0x2F, 0x5C, 0xAA,
+  0x32, 0x25, 0x55, 0x66, 0x26, 0x22, 0x22, 0x66, 0x66, 0x26, 0x66, 0x66, 0x6D, 0xF2, 0x22, 0x66,
+  0x6A, 0x3A, 0x22, 0x66, 0x25, 0x33, 0x72, 0x22, 0x22, 0x53, 0xA2, 0x66, 0x81, 0x50, 0x80, 0x04,
+  0x80, 0x19, 0x82, 0x00, 0x17, 0x62, 0xD5, 0x26, 0x26, 0x2F, 0x33, 0x52, 0x22, 0x23, 0x33, 0x22,
+  0xA3, 0x23, 0xA2, 0x25, 0x33, 0x62, 0x22, 0x2A, 0x33, 0x26, 0x22, 0x53, 0x33, 0x80, 0x19, 0x00,
+  0x62, 0x81, 0x1F, 0x00, 0x26, 0x80, 0x01, 0x80, 0x31, 0x04, 0x5A, 0x3A, 0x77, 0xA3, 0x33, 0x88,
+  0x00, 0x04, 0x37, 0x22, 0x25, 0x33, 0x33, 0x80, 0x26, 0x01, 0x33, 0xFA, 0x89, 0x15, 0x81, 0x00,
+  0x01, 0xA5, 0x93, 0x83, 0x4D, 0x10, 0x22, 0x11, 0x11, 0x22, 0x23, 0x13, 0x61, 0x22, 0x71, 0x17,
+  0x23, 0x22, 0x11, 0x13, 0x26, 0x22, 0x33, 0x80, 0x03, 0x04, 0x22, 0x27, 0x27, 0x27, 0x67, 0x81,
+  0xEE, 0x0C, 0xB7, 0x27, 0x11, 0xB3, 0x11, 0x11, 0x11, 0x72, 0x31, 0x11, 0x11, 0x32, 0x61, 0x81,
+  0x03, 0x00, 0x33, 0x80, 0x03, 0x03, 0x22, 0x31, 0x32, 0x61, 0x80, 0xA3, 0x00, 0x27, 0x82, 0xF3,
+  0x05, 0x11, 0x13, 0x27, 0x63, 0x11, 0x17, 0x80, 0x07, 0x81, 0x03, 0x00, 0x13, 0x80, 0x03, 0x00,
+  0x1B, 0x83, 0x03, 0x00, 0x61, 0x80, 0x03, 0x00, 0x27, 0x80, 0x5D, 0x02, 0x82, 0x91, 0x42, 0x80,
+  0x10, 0x08, 0x42, 0x84, 0x88, 0x1A, 0x82, 0x41, 0x11, 0x11, 0x14, 0x80, 0x4C, 0x8B, 0x00, 0x2C,
+  0x33, 0x79, 0x00, 0x03, 0x93, 0xD0, 0x00, 0x05, 0xA5, 0x90, 0x00, 0x52, 0xA5, 0x00, 0x07, 0xDF,
+  0xAA, 0x00, 0x0D, 0xB3, 0xA7, 0x00, 0x39, 0x33, 0xA7, 0x00, 0x37, 0x42, 0xA7, 0x00, 0x05, 0x22,
+  0x85, 0x2D, 0x88, 0x96, 0x5D, 0xE9, 0x20, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xE2, 0x80, 0x03, 0x13,
+  0x92, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x29, 0x98, 0xD6, 0x5E, 0x8D, 0x96, 0xD2, 0x65, 0x58, 0x60,
+  0x00, 0x00, 0x09, 0x9D, 0x80, 0x16, 0x00, 0x77, 0x80, 0x03, 0x3D, 0x53, 0x00, 0x00, 0x37, 0xD0,
+  0x30, 0x07, 0xD3, 0x70, 0x30, 0x0D, 0x43, 0x90, 0x00, 0x3D, 0xB3, 0x70, 0x00, 0x73, 0x33, 0x70,
+  0x00, 0x00, 0x97, 0xB4, 0x00, 0x09, 0x52, 0x22, 0x00, 0x35, 0x22, 0x22, 0x00, 0x7E, 0x27, 0x3E,
+  0x00, 0x79, 0x2F, 0x3B, 0x03, 0x99, 0x22, 0x33, 0x00, 0xDE, 0x26, 0xB3, 0x00, 0x9D, 0x44, 0xB3,
+  0x22, 0x22, 0x62, 0x23, 0x22, 0x26, 0x66, 0x23, 0x66, 0x81, 0x03, 0x16, 0x66, 0x22, 0x27, 0x26,
+  0x24, 0x3E, 0x59, 0xF6, 0x24, 0x37, 0x90, 0xF2, 0x62, 0xD3, 0x00, 0xE7, 0x57, 0x00, 0x00, 0x93,
+  0x00, 0xC4, 0xC0, 0x81, 0x03, 0x19, 0xE0, 0x03, 0xC4, 0x40, 0x30, 0x07, 0xC4, 0x90, 0x00, 0x0E,
+  0x44, 0x70, 0x00, 0x3C, 0x4C, 0x30, 0x00, 0xE4, 0x4C, 0x00, 0x07, 0x93, 0x39, 0x00, 0x00, 0x03,
+  0x80, 0x79, 0x89, 0x00, 0x19, 0x39, 0xEC, 0xCC, 0x03, 0xC4, 0x44, 0x44, 0x07, 0x44, 0x44, 0x44,
+  0x09, 0xB4, 0x4C, 0xC9, 0x00, 0x3C, 0x33, 0x33, 0x00, 0x03, 0x97, 0x37, 0x00, 0x00, 0x0E, 0x81,
+  0x2C, 0x0A, 0x98, 0xCE, 0x90, 0x00, 0xEC, 0x4C, 0xC0, 0x00, 0xEC, 0xC9, 0x00, 0x81, 0xD2, 0x00,
+  0x09, 0x80, 0x50, 0x06, 0x93, 0x7C, 0x80, 0x00, 0xE3, 0x7C, 0x90, 0x80, 0x03, 0x0D, 0x70, 0x03,
+  0x93, 0xB8, 0x00, 0x07, 0x87, 0x88, 0x00, 0x09, 0x88, 0x88, 0x00, 0x0E, 0x82, 0x03, 0x10, 0x8C,
+  0x11, 0x82, 0x91, 0x42, 0x11, 0x22, 0x11, 0x42, 0x11, 0x88, 0x11, 0x82, 0x11, 0x11, 0x11, 0x14,
+  0x80, 0x03, 0x86, 0x00, 0x38, 0xAA, 0x91, 0xA1, 0x11, 0x33, 0x90, 0x00, 0x39, 0x7B, 0xE0, 0x00,
+  0x73, 0xB8, 0x80, 0x00, 0x95, 0x8C, 0x90, 0x00, 0x92, 0x8C, 0x30, 0x00, 0xE5, 0x8C, 0x00, 0x03,
+  0x73, 0x8C, 0x00, 0x09, 0x33, 0x89, 0x00, 0x09, 0x72, 0x65, 0x55, 0x00, 0x00, 0x5C, 0xC9, 0x00,
+  0x09, 0x5C, 0x82, 0x00, 0x0E, 0x55, 0x80, 0x00, 0x08, 0xF2, 0x90, 0x00, 0x66, 0x22, 0x80, 0x27,
+  0x25, 0xD5, 0x90, 0x00, 0xED, 0x58, 0x20, 0x00, 0x85, 0x00, 0x0E, 0x5C, 0x80, 0x20, 0x02, 0x85,
+  0xE0, 0xE0, 0x00, 0x9C, 0x90, 0x86, 0x00, 0x08, 0x60, 0xDE, 0x00, 0x06, 0x20, 0x26, 0x60, 0x00,
+  0x00, 0x62, 0xE0, 0x00, 0x00, 0x52, 0x66, 0x81, 0xCF, 0x80, 0xBF, 0x06, 0x93, 0x39, 0x72, 0x00,
+  0x73, 0x3E, 0x26, 0x80, 0x03, 0x04, 0x22, 0x00, 0x73, 0x39, 0x2F, 0x80, 0x03, 0x01, 0x22, 0x03,
+  0x80, 0x0B, 0x05, 0x09, 0x93, 0x39, 0x44, 0x34, 0x22, 0x80, 0x00, 0x07, 0x26, 0x66, 0x26, 0x22,
+  0x22, 0x66, 0x25, 0x39, 0x80, 0x03, 0x10, 0x33, 0x22, 0x6F, 0x37, 0x33, 0xF2, 0x64, 0x37, 0xB3,
+  0xF2, 0x2F, 0x37, 0xB3, 0xE4, 0x44, 0x99, 0x90, 0x80, 0x42, 0x00, 0x70, 0x80, 0x03, 0x00, 0x30,
+  0x80, 0x03, 0x0A, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x07, 0xEC, 0x44, 0x00, 0x09, 0x74, 0x81, 0x03,
+  0x08, 0x4C, 0x00, 0x3E, 0x94, 0x97, 0x00, 0x00, 0x9C, 0x43, 0x80, 0x18, 0x00, 0xE3, 0x81, 0x69,
+  0x0F, 0xE4, 0x93, 0x00, 0x09, 0x44, 0x4C, 0x70, 0x04, 0x44, 0xC7, 0x00, 0x0E, 0xC9, 0x00, 0x00,
+  0x3C, 0x80, 0x13, 0x05, 0xC4, 0x7E, 0x00, 0x07, 0x73, 0x79, 0x80, 0xCB, 0x0A, 0xB9, 0x00, 0x0E,
+  0x43, 0xB7, 0x00, 0x0C, 0xB3, 0xC3, 0x00, 0x3C, 0x81, 0x03, 0x00, 0x33, 0x81, 0x03, 0x27, 0xC7,
+  0x00, 0x0C, 0x37, 0x33, 0x37, 0x90, 0x00, 0x39, 0xA5, 0x00, 0x00, 0x37, 0xA5, 0x00, 0x03, 0x3A,
+  0xAA, 0x00, 0x07, 0x9A, 0x59, 0x00, 0x0D, 0x7A, 0x50, 0x00, 0x35, 0xA5, 0x30, 0x00, 0x7A, 0x59,
+  0x00, 0x00, 0x5A, 0xE8, 0xC0, 0x00, 0x07, 0x80, 0x03, 0x0A, 0x7C, 0x98, 0x80, 0x00, 0x8C, 0xBC,
+  0xB0, 0x00, 0xC8, 0x8C, 0x30, 0x80, 0x03, 0x01, 0x00, 0x03, 0x80, 0x03, 0x12, 0x09, 0xCC, 0x88,
+  0x00, 0x08, 0x88, 0x00, 0x37, 0x99, 0x00, 0x00, 0x0D, 0x73, 0x00, 0x90, 0x09, 0x80, 0x00, 0xD0,
+  0x80, 0x01, 0x00, 0x53, 0x80, 0x74, 0x00, 0xAD, 0x80, 0x03, 0x80, 0x3F, 0x09, 0x00, 0xAA, 0xD0,
+  0x00, 0x00, 0x09, 0x6E, 0x00, 0x00, 0x05, 0x80, 0x48, 0x0F, 0x28, 0xC6, 0x00, 0x00, 0x65, 0x82,
+  0x00, 0x00, 0x96, 0x50, 0x00, 0x6E, 0x92, 0x90, 0x00, 0x92, 0x80, 0x03, 0x01, 0xE5, 0xE5, 0x80,
+  0x03, 0x0B, 0x00, 0x0E, 0x8D, 0x5C, 0x00, 0x28, 0xD2, 0xDC, 0x00, 0x00, 0xE6, 0xD5, 0x80, 0x2D,
+  0x00, 0x85, 0x80, 0xEF, 0x19, 0x98, 0x6E, 0x20, 0x00, 0x06, 0x5D, 0x86, 0x00, 0x00, 0xCC, 0x59,
+  0x90, 0x00, 0x62, 0x33, 0x39, 0x00, 0x2D, 0x33, 0xA9, 0x00, 0x65, 0x33, 0x90, 0x00, 0x23, 0x80,
+  0x03, 0x00, 0xD3, 0x84, 0x07, 0x00, 0x79, 0x80, 0x03, 0x05, 0x09, 0x73, 0x90, 0x00, 0x06, 0x62,
+  0x80, 0x6C, 0x86, 0x00, 0x26, 0x02, 0x66, 0x06, 0x99, 0x88, 0x5D, 0x55, 0x22, 0x95, 0x5D, 0xE5,
+  0xF2, 0xD5, 0x5E, 0x88, 0x59, 0x99, 0x62, 0x02, 0x23, 0x37, 0x00, 0x03, 0xD3, 0x97, 0x00, 0x09,
+  0x63, 0xD0, 0x00, 0x75, 0x73, 0x70, 0x00, 0x3E, 0x23, 0x70, 0x00, 0x3B, 0x80, 0x03, 0x09, 0x73,
+  0xF3, 0x70, 0x00, 0x3D, 0x43, 0x70, 0x00, 0x0E, 0xEB, 0x86, 0x3C, 0x00, 0x09, 0x80, 0x02, 0x08,
+  0xCC, 0x00, 0x00, 0x7C, 0x44, 0x00, 0x00, 0x03, 0xEC, 0x80, 0x0F, 0x01, 0x07, 0xE7, 0x80, 0x04,
+  0x10, 0x03, 0xCB, 0x33, 0x33, 0x3E, 0x74, 0xB3, 0x7B, 0xE3, 0xB4, 0xB3, 0x74, 0x43, 0x74, 0xB3,
+  0xB4, 0x44, 0x84, 0x00, 0x00, 0xCC, 0x80, 0x03, 0x1D, 0x09, 0xC4, 0x44, 0x44, 0x22, 0x22, 0x26,
+  0x6A, 0x72, 0x26, 0xAA, 0xAA, 0x17, 0x23, 0xAA, 0xAA, 0xB2, 0x2A, 0xAA, 0xAA, 0x32, 0x6A, 0xAA,
+  0xAA, 0x72, 0x3A, 0xAA, 0xAA, 0x22, 0xAA, 0x83, 0x03, 0x03, 0xC2, 0x5A, 0x11, 0x82, 0x80, 0x03,
+  0x0A, 0x22, 0x42, 0x81, 0x11, 0x88, 0x82, 0x4A, 0x11, 0x11, 0xC5, 0x11, 0x87, 0x00, 0x13, 0x1C,
+  0xC1, 0x11, 0x11, 0x91, 0x42, 0x22, 0x22, 0x11, 0x42, 0x84, 0x82, 0x1A, 0x82, 0x41, 0xA1, 0x11,
+  0x14, 0x11, 0x1A, 0x80, 0x16, 0x81, 0x03, 0x82, 0x1E, 0x80, 0x03, 0x14, 0x14, 0x3B, 0x33, 0x72,
+  0x65, 0x33, 0x33, 0x26, 0x25, 0xB3, 0x35, 0x66, 0x6A, 0xB3, 0x32, 0x2D, 0x53, 0x73, 0x77, 0xA3,
+  0x33, 0x83, 0x00, 0x19, 0x52, 0x53, 0x33, 0x72, 0x22, 0x53, 0x35, 0x66, 0x62, 0x25, 0x37, 0x66,
+  0x66, 0xA3, 0x37, 0x22, 0x22, 0x33, 0x35, 0x22, 0x2F, 0x33, 0x33, 0x3A, 0x55, 0x37, 0x80, 0x1C,
+  0x0A, 0x3A, 0x72, 0x25, 0x73, 0x33, 0x76, 0x22, 0x23, 0x33, 0x26, 0x22, 0x80, 0x29, 0x06, 0x6D,
+  0x33, 0x33, 0x56, 0x25, 0x33, 0x33, 0x80, 0x0E, 0x02, 0x33, 0x22, 0xD3, 0x80, 0x03, 0x03, 0x53,
+  0x33, 0x33, 0x35, 0x85, 0x46, 0x08, 0x33, 0x3E, 0x22, 0x39, 0x72, 0x22, 0x22, 0x39, 0x22, 0x81,
+  0x03, 0x80, 0x0B, 0x01, 0x2F, 0x3B, 0x80, 0x07, 0x0A, 0x33, 0xF2, 0x3E, 0x22, 0xB3, 0xF2, 0x3E,
+  0x44, 0xB3, 0xE4, 0x22, 0x80, 0x34, 0x01, 0x66, 0x66, 0x84, 0x03, 0x04, 0x26, 0x23, 0x33, 0x24,
+  0x3E, 0x80, 0x03, 0x17, 0x3B, 0x23, 0x33, 0x2F, 0x33, 0xF3, 0x33, 0x44, 0x33, 0xB3, 0x33, 0x21,
+  0x11, 0x16, 0x23, 0x21, 0x11, 0x17, 0x23, 0x61, 0x11, 0x17, 0x21, 0x61, 0x80, 0xB0, 0x89, 0x03,
+  0x11, 0x22, 0x22, 0x27, 0x63, 0x11, 0x32, 0x6B, 0x72, 0x11, 0x32, 0x61, 0x32, 0x11, 0x32, 0x31,
+  0x32, 0x11, 0x12, 0x80, 0x07, 0x88, 0x00, 0x00, 0x31, 0x82, 0x23, 0x18, 0x22, 0x26, 0x63, 0x72,
+  0x26, 0xAA, 0x31, 0x17, 0x29, 0xAA, 0x31, 0xB2, 0x2A, 0xAA, 0x11, 0x32, 0x6A, 0xAA, 0x11, 0x72,
+  0x3A, 0xAA, 0x11, 0x22, 0xAA, 0x82, 0x03, 0x00, 0x51, 0x80, 0x23, 0x00, 0x28, 0x81, 0x27, 0x04,
+  0x21, 0x11, 0x11, 0xC5, 0x41, 0x86, 0x3A, 0x00, 0x1A, 0x85, 0x08, 0x26, 0xAE, 0x00, 0x02, 0xE8,
+  0xAE, 0x20, 0x00, 0x02, 0xA3, 0xE0, 0x00, 0x00, 0xA2, 0x69, 0x00, 0x00, 0x72, 0x26, 0xE2, 0x00,
+  0x22, 0x22, 0xD8, 0xE6, 0x22, 0x22, 0x55, 0x58, 0x22, 0x22, 0x2F, 0xFF, 0x62, 0xD8, 0xE2, 0x00,
+  0x69, 0x62, 0x00, 0x85, 0x00, 0x00, 0x09, 0x80, 0x03, 0x21, 0xE5, 0x00, 0x02, 0x98, 0xC5, 0x88,
+  0x88, 0x55, 0x55, 0xFF, 0xFF, 0xDD, 0xDD, 0x03, 0xE3, 0x33, 0x93, 0x0E, 0x27, 0x33, 0x3E, 0x92,
+  0x22, 0x33, 0x39, 0xBA, 0x22, 0x33, 0x33, 0x33, 0x52, 0x33, 0x33, 0x53, 0x80, 0x03, 0x00, 0x2F,
+  0x80, 0x0B, 0x00, 0x5D, 0x80, 0x03, 0x03, 0x00, 0x03, 0x99, 0x99, 0x81, 0x38, 0x00, 0x70, 0x80,
+  0x03, 0x00, 0x97, 0x80, 0x03, 0x0B, 0x39, 0x90, 0x00, 0x00, 0x33, 0x7E, 0xE9, 0x99, 0x33, 0x35,
+  0x22, 0x22, 0x81, 0x03, 0x00, 0x77, 0x83, 0x57, 0x00, 0x03, 0x80, 0x03, 0x19, 0x3D, 0x00, 0x00,
+  0x07, 0xD3, 0x00, 0x07, 0xD9, 0x43, 0x7D, 0x52, 0x2F, 0x23, 0x22, 0x22, 0x62, 0x23, 0x2F, 0xB7,
+  0x66, 0x23, 0x3E, 0x33, 0x39, 0x00, 0xE3, 0x80, 0x03, 0x02, 0x33, 0x33, 0x37, 0x84, 0x03, 0x81,
+  0x0B, 0x01, 0x39, 0x97, 0x80, 0x69, 0x82, 0x00, 0x02, 0x0E, 0x99, 0x93, 0x86, 0x9C, 0x83, 0x00,
+  0x05, 0x07, 0x99, 0x79, 0x99, 0x97, 0x37, 0x80, 0x1A, 0x00, 0x38, 0x80, 0x03, 0x15, 0xB8, 0x00,
+  0x00, 0x3E, 0xC9, 0x00, 0x07, 0xEB, 0xC7, 0x00, 0x99, 0x3B, 0xC7, 0x9E, 0x9B, 0x88, 0xC8, 0x98,
+  0x88, 0x88, 0x8C, 0x88, 0x88, 0x00, 0x02, 0x00, 0x0E, 0x89, 0x81, 0x96, 0x86, 0x00, 0x80, 0xA7,
+  0x04, 0x03, 0xCE, 0x98, 0xEC, 0xCC, 0x86, 0x1F, 0x16, 0x00, 0x75, 0xAA, 0x00, 0x00, 0x05, 0x57,
+  0x00, 0x00, 0x08, 0x30, 0x00, 0x03, 0xA5, 0x00, 0x9A, 0x55, 0xA5, 0x30, 0xAA, 0xAA, 0xAA, 0x57,
+  0x80, 0x03, 0x82, 0x00, 0x07, 0xE6, 0x00, 0x0E, 0xE8, 0x60, 0x00, 0x00, 0x0E, 0x84, 0x3E, 0x00,
+  0x02, 0x80, 0x02, 0x07, 0x68, 0x99, 0x99, 0x99, 0x55, 0xAA, 0x22, 0x22, 0x81, 0x03, 0x19, 0x2F,
+  0x58, 0x00, 0x00, 0x8C, 0xC8, 0x00, 0x02, 0x85, 0x88, 0x00, 0x0D, 0x55, 0x88, 0x00, 0x09, 0x55,
+  0x58, 0x60, 0x0E, 0x55, 0x55, 0x86, 0x68, 0x5C, 0x55, 0x80, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0xDD,
+  0xD2, 0xF8, 0x00, 0x00, 0xD2, 0x68, 0x60, 0x00, 0xD2, 0x25, 0xE0, 0x00, 0x52, 0x2F, 0x80, 0x00,
+  0x5D, 0x22, 0x59, 0x06, 0x55, 0xD2, 0xD8, 0x99, 0xCC, 0x5D, 0x55, 0x22, 0xDD, 0xD5, 0x55, 0x22,
+  0x09, 0x80, 0xC4, 0x08, 0x09, 0x33, 0x37, 0x77, 0x09, 0x33, 0x35, 0x22, 0x39, 0x80, 0x03, 0x00,
+  0xE3, 0x80, 0x03, 0x00, 0x33, 0x8A, 0x03, 0x1F, 0x33, 0x73, 0x33, 0x3E, 0x99, 0x70, 0x43, 0xB2,
+  0x22, 0x20, 0xF3, 0xB2, 0x66, 0x73, 0xE3, 0xB2, 0x66, 0x9D, 0x43, 0x92, 0x66, 0x27, 0x22, 0x22,
+  0x22, 0x26, 0x22, 0x2F, 0xB7, 0x66, 0x00, 0x03, 0x89, 0xDD, 0x06, 0x00, 0x39, 0x73, 0x79, 0x99,
+  0x93, 0x27, 0x80, 0x34, 0x00, 0x23, 0x84, 0x03, 0x80, 0xBA, 0x08, 0x77, 0x00, 0x03, 0xE7, 0x33,
+  0x03, 0x99, 0x33, 0x33, 0x80, 0x02, 0x8E, 0x00, 0x04, 0x99, 0x00, 0x00, 0x97, 0x3E, 0x80, 0x38,
+  0x05, 0x37, 0x70, 0x00, 0x00, 0x33, 0x97, 0x80, 0x03, 0x0B, 0xBC, 0xE3, 0x03, 0x37, 0x88, 0xCC,
+  0xCC, 0x38, 0x88, 0x88, 0x88, 0xB8, 0x80, 0x03, 0x15, 0x00, 0x00, 0x09, 0xA3, 0x00, 0x00, 0x05,
+  0x93, 0x00, 0x00, 0x5A, 0x93, 0x00, 0x35, 0xAA, 0x93, 0x9D, 0x5A, 0xAA, 0xA7, 0x5A, 0xAA, 0x87,
+  0x00, 0x03, 0x39, 0x00, 0x0E, 0x88, 0x81, 0x03, 0x0A, 0x9E, 0x00, 0x39, 0x38, 0x8C, 0x70, 0x7B,
+  0xB8, 0x88, 0xC8, 0xC8, 0x80, 0x35, 0x88, 0x00, 0x08, 0xC3, 0x00, 0x00, 0x88, 0xC9, 0x00, 0x03,
+  0x88, 0x8C, 0x80, 0x24, 0x09, 0x8C, 0x47, 0xE7, 0x88, 0x88, 0xB7, 0x33, 0x88, 0x88, 0x33, 0x86,
+  0x03, 0x36, 0xE5, 0x90, 0x00, 0x8C, 0x55, 0x90, 0x02, 0x8C, 0xDC, 0xE0, 0x00, 0x85, 0xD5, 0x8F,
+  0x02, 0xEC, 0xD5, 0x58, 0x9E, 0x25, 0xD5, 0xC5, 0x5F, 0x2D, 0x55, 0x55, 0xCD, 0xD5, 0x2F, 0xFF,
+  0xFF, 0xFF, 0x62, 0x53, 0x5E, 0x00, 0x62, 0x53, 0x76, 0xE0, 0x62, 0x53, 0x32, 0x62, 0x62, 0x23,
+  0x37, 0x2E, 0x22, 0x2D, 0x33, 0x52, 0x22, 0x26, 0x53, 0x80, 0x03, 0x0B, 0x2F, 0x22, 0x55, 0x55,
+  0x5D, 0x22, 0x00, 0x93, 0x90, 0x00, 0x00, 0x93, 0x80, 0xBC, 0x80, 0x07, 0x06, 0x9E, 0x33, 0x93,
+  0x00, 0x33, 0x33, 0x39, 0x81, 0xE6, 0x00, 0x35, 0x85, 0x03, 0x80, 0xDA, 0x88, 0x00, 0x13, 0x03,
+  0x7D, 0x2D, 0x77, 0x7D, 0x22, 0x22, 0x43, 0x92, 0x26, 0x66, 0x22, 0x22, 0x22, 0x66, 0x22, 0x2F,
+  0xB7, 0x00, 0x73, 0x80, 0x3B, 0x16, 0x73, 0x90, 0x03, 0x09, 0x73, 0x90, 0x09, 0xD9, 0xE3, 0x70,
+  0x07, 0x93, 0x43, 0x7E, 0x3D, 0x27, 0x73, 0x39, 0x73, 0x66, 0x23, 0x33, 0x33, 0x81, 0x03, 0x01,
+  0x97, 0xE3, 0x80, 0x1E, 0x01, 0x39, 0xE3, 0x81, 0x57, 0x00, 0x93, 0x80, 0x4F, 0x00, 0x39, 0x80,
+  0x03, 0x8A, 0x00, 0x19, 0x00, 0x2E, 0x11, 0x13, 0x00, 0x09, 0x27, 0x72, 0x00, 0x09, 0x22, 0x22,
+  0x99, 0xE6, 0x22, 0x33, 0x22, 0x22, 0x3A, 0xAA, 0x22, 0x26, 0xAA, 0xAA, 0x22, 0x2A, 0x80, 0x03,
+  0x07, 0x3A, 0xAA, 0xAA, 0x28, 0x11, 0x11, 0x11, 0x24, 0x83, 0x03, 0x00, 0x1A, 0x80, 0x06, 0x8E,
+  0x00, 0x10, 0xC2, 0x21, 0x18, 0x51, 0x82, 0x21, 0x12, 0x28, 0x82, 0x91, 0x14, 0x22, 0x82, 0x11,
+  0x11, 0xC5, 0x14, 0x8F, 0x22, 0x81, 0x12, 0x01, 0x14, 0x21, 0x80, 0x03, 0x00, 0x4A, 0x80, 0x2E,
+  0x80, 0x0B, 0x80, 0x26, 0x01, 0x1A, 0x22, 0x80, 0x07, 0x82, 0x03, 0x05, 0x33, 0x76, 0x26, 0xA3,
+  0x33, 0x56, 0x80, 0x03, 0x00, 0x52, 0x85, 0x07, 0x05, 0x22, 0x53, 0x33, 0x56, 0x22, 0x2A, 0x80,
+  0x88, 0x01, 0x2F, 0x33, 0x80, 0x7F, 0x20, 0x52, 0x66, 0x53, 0xA2, 0x22, 0x62, 0x53, 0x72, 0x22,
+  0x66, 0x53, 0x32, 0x56, 0x66, 0x23, 0x3A, 0x32, 0x66, 0x2F, 0x33, 0x35, 0x66, 0x22, 0x53, 0x52,
+  0x26, 0x22, 0x2F, 0xAA, 0x55, 0x55, 0x5D, 0x53, 0x80, 0xC3, 0x00, 0x27, 0x80, 0x03, 0x00, 0x22,
+  0x84, 0x03, 0x00, 0x52, 0x84, 0x03, 0x85, 0x0F, 0x81, 0x00, 0x0A, 0x39, 0x99, 0x33, 0x39, 0x34,
+  0x22, 0x43, 0xB2, 0x34, 0x22, 0xF3, 0x80, 0x03, 0x0A, 0xE3, 0xB2, 0x34, 0x66, 0x43, 0x92, 0x34,
+  0x66, 0x22, 0x22, 0x34, 0x81, 0x63, 0x80, 0x00, 0x00, 0x77, 0x81, 0x2B, 0x01, 0xA3, 0x73, 0x80,
+  0x03, 0x00, 0x53, 0x83, 0x03, 0x01, 0x29, 0x23, 0x80, 0x7E, 0x02, 0x23, 0x33, 0xA9, 0x80, 0x03,
+  0x9D, 0x00, 0x07, 0x22, 0x76, 0x31, 0x11, 0x22, 0x22, 0x22, 0x27, 0x80, 0x03, 0x85, 0x00, 0x07,
+  0x3A, 0x22, 0x22, 0x26, 0xAA, 0x22, 0x22, 0x2A, 0x80, 0x03, 0x03, 0x3A, 0xAA, 0xA4, 0x28, 0x80,
+  0xF0, 0x00, 0x24, 0x80, 0xE8, 0x80, 0x03, 0x00, 0x44, 0x80, 0xF0, 0x91, 0x00, 0x01, 0x44, 0x41,
+  0x80, 0x1F, 0x88, 0x00, 0x00, 0x42, 0x80, 0x03, 0x01, 0x15, 0x84, 0x83, 0x2D, 0x86, 0x14, 0x01,
+  0x28, 0x82, 0x81, 0x42, 0x01, 0x48, 0x22, 0x81, 0x2B, 0x80, 0x03, 0x00, 0x14, 0x84, 0x3B, 0x89,
+  0x37, 0x85, 0x3B, 0x00, 0x14, 0x80, 0x03, 0x00, 0x11, 0x80, 0x08, 0x05, 0x11, 0x18, 0x22, 0x22,
+  0x33, 0x3B, 0x91, 0xB5, 0x05, 0x34, 0x22, 0x33, 0x33, 0x42, 0x22, 0x80, 0x06, 0x17, 0x66, 0x33,
+  0x34, 0x24, 0x3E, 0x33, 0x34, 0x2B, 0x39, 0x33, 0x34, 0xB3, 0x37, 0x33, 0x39, 0x4B, 0x72, 0x33,
+  0x3E, 0x22, 0x22, 0x74, 0x42, 0x66, 0x86, 0x00, 0x0D, 0x2E, 0x3B, 0x22, 0x23, 0x2F, 0x33, 0xE2,
+  0x2E, 0x22, 0x43, 0x3E, 0x22, 0x66, 0x2E, 0x80, 0x03, 0x02, 0x62, 0x22, 0x22, 0x80, 0x16, 0x84,
+  0x03, 0x00, 0x62, 0x80, 0x47, 0x02, 0x33, 0x33, 0xEE, 0x80, 0x03, 0x09, 0x22, 0xB3, 0x33, 0x33,
+  0x62, 0xF3, 0x33, 0x33, 0x66, 0x6B, 0x80, 0x03, 0x00, 0x2F, 0x80, 0x03, 0x80, 0x10, 0x02, 0x22,
+  0x22, 0xE3, 0x80, 0x03, 0x00, 0x22, 0x80, 0xA3, 0x00, 0x25, 0x80, 0x03, 0x00, 0x21, 0x84, 0x03,
+  0x00, 0x24, 0x84, 0x0F, 0x00, 0x28, 0x81, 0xBB, 0x80, 0xC1, 0x0B, 0x1C, 0x11, 0x11, 0xC4, 0x22,
+  0x28, 0xAA, 0x82, 0x22, 0x22, 0xAA, 0xC8, 0x81, 0x10, 0x00, 0x88, 0x80, 0x03, 0x00, 0x1A, 0x84,
+  0xDD, 0x83, 0x09, 0x02, 0x85, 0x48, 0x41, 0x88, 0x3F, 0x02, 0x81, 0x11, 0xC4, 0x86, 0x1D, 0x84,
+  0x00, 0x03, 0x44, 0x41, 0x11, 0xC2, 0x80, 0x4C, 0x81, 0x03, 0x87, 0xFB, 0x01, 0x84, 0x44, 0x81,
+  0x3C, 0x00, 0x1A, 0x83, 0x80, 0x80, 0x00, 0x01, 0x25, 0x82, 0x80, 0x7A, 0x80, 0x0A, 0x81, 0x4B,
+  0x03, 0x41, 0x11, 0x11, 0x14, 0x83, 0x3A, 0x82, 0x1A, 0x84, 0x00, 0x00, 0x48, 0x85, 0x3B, 0x80,
+  0x44, 0x00, 0x11, 0x80, 0x08, 0x02, 0x11, 0x11, 0x18, 0x80, 0xDF, 0x00, 0x3A, 0x81, 0xE2, 0x8D,
+  0x00, 0x00, 0x35, 0x80, 0x03, 0x00, 0x52, 0x80, 0x06, 0x80, 0x1F, 0x01, 0x34, 0x64, 0x80, 0x03,
+  0x00, 0x23, 0x80, 0x03, 0x04, 0xB3, 0x33, 0x33, 0x3E, 0x4B, 0x80, 0x03, 0x80, 0xE2, 0x04, 0x42,
+  0x66, 0x66, 0x66, 0x26, 0x80, 0x03, 0x15, 0x66, 0x66, 0x3E, 0x2E, 0x3B, 0x22, 0x39, 0x2F, 0x33,
+  0xE2, 0x37, 0x22, 0x43, 0x34, 0x72, 0x22, 0x2E, 0x3E, 0x26, 0x66, 0x62, 0x22, 0x80, 0x16, 0x81,
+  0x03, 0x81, 0x00, 0x00, 0x62, 0x80, 0x38, 0x07, 0x33, 0x2E, 0xEE, 0x33, 0x33, 0x22, 0x22, 0xB3,
+  0x80, 0x03, 0x08, 0xF3, 0x33, 0x22, 0x26, 0x2B, 0x33, 0x66, 0x66, 0x2F, 0x80, 0x03, 0x01, 0x22,
+  0xB3, 0x80, 0x8E, 0x00, 0xE3, 0x84, 0x9A, 0x00, 0x25, 0x80, 0x03, 0x00, 0x21, 0x84, 0x03, 0x00,
+  0x24, 0x84, 0x0F, 0x00, 0x28, 0x81, 0x18, 0x80, 0xC2, 0x07, 0x1C, 0x11, 0x11, 0xC4, 0x22, 0x11,
+  0x1A, 0x82, 0x80, 0x0B, 0x00, 0xC8, 0x81, 0x0F, 0x00, 0x88, 0x80, 0x03, 0x80, 0xF9, 0x84, 0x00,
+  0x06, 0xA1, 0x1A, 0x11, 0x28, 0x85, 0x48, 0x41, 0x88, 0x3F, 0x02, 0x81, 0x11, 0xC4, 0x86, 0x1D,
+  0x84, 0x00, 0x03, 0x44, 0x41, 0x11, 0xC2, 0x80, 0x4B, 0x81, 0x03, 0x86, 0xFB, 0x01, 0x15, 0x84,
+  0x83, 0x1B, 0x81, 0x0F, 0x85, 0x83, 0x00, 0x24, 0x81, 0x09, 0x81, 0x4B, 0x03, 0x41, 0x44, 0x11,
+  0x14, 0x84, 0x1D, 0x83, 0x00, 0x00, 0x82, 0x81, 0x8B, 0x00, 0x48, 0x85, 0x3B, 0x00, 0x14, 0x81,
+  0x87, 0x00, 0x42, 0x80, 0x03, 0x00, 0xA8, 0x80, 0xDE, 0x00, 0x3A, 0x80, 0x03, 0x95, 0x00, 0x00,
+  0x35, 0x80, 0x03, 0x00, 0x34, 0x88, 0x03, 0x00, 0x3E, 0x81, 0x03, 0x04, 0x34, 0x22, 0x74, 0x42,
+  0x42, 0x84, 0x57, 0x17, 0x24, 0x3E, 0x2E, 0x3B, 0x2B, 0x39, 0x2F, 0x33, 0xB3, 0x37, 0x22, 0x43,
+  0x4B, 0x72, 0x26, 0x2E, 0x22, 0x26, 0x66, 0x62, 0x22, 0x66, 0x66, 0x66, 0x81, 0x03, 0x81, 0x00,
+  0x13, 0x22, 0x73, 0x33, 0x33, 0xE2, 0x2E, 0x9E, 0x33, 0x3E, 0x62, 0x22, 0xB3, 0x3E, 0x66, 0x22,
+  0xF3, 0x22, 0x66, 0x22, 0x2B, 0x80, 0x1B, 0x00, 0x2F, 0x80, 0x03, 0x04, 0x62, 0x62, 0x22, 0x22,
+  0x62, 0x95, 0x78, 0x00, 0xB3, 0x80, 0x03, 0x00, 0xE3, 0x80, 0x03, 0x81, 0xA8, 0x0C, 0x25, 0x11,
+  0x11, 0xC4, 0x21, 0x11, 0x1A, 0x82, 0x21, 0x11, 0x11, 0xC8, 0x24, 0x83, 0x0F, 0x01, 0x11, 0x28,
+  0x81, 0xDB, 0x80, 0x03, 0x01, 0x1C, 0x1A, 0x80, 0x07, 0x01, 0x28, 0x85, 0x80, 0xD9, 0x83, 0x00,
+  0x00, 0x88, 0x80, 0x03, 0x02, 0x1A, 0x11, 0xC4, 0x82, 0xFB, 0x85, 0x00, 0x07, 0x41, 0x11, 0x11,
+  0x44, 0x21, 0x11, 0xC2, 0x22, 0x81, 0x03, 0x00, 0x81, 0x87, 0xFB, 0x00, 0x15, 0x84, 0x1E, 0x00,
+  0x22, 0x80, 0x1F, 0x85, 0x3E, 0x00, 0x24, 0x85, 0x08, 0x03, 0x84, 0x44, 0x11, 0x14, 0x82, 0x1C,
+  0x84, 0x00, 0x02, 0x28, 0x82, 0x22, 0x80, 0x37, 0x00, 0x48, 0x81, 0x2B, 0x00, 0x42, 0x80, 0x03,
+  0x82, 0x1B, 0x89, 0x1F, 0x8D, 0x00, 0x00, 0x42, 0x80, 0x03, 0x00, 0x18, 0x80, 0x03, 0x00, 0x3B,
+  0x91, 0xDC, 0x08, 0x34, 0x22, 0x74, 0x33, 0x42, 0x66, 0x66, 0x34, 0x22, 0x80, 0x03, 0x12, 0x24,
+  0x3E, 0x2E, 0x34, 0x23, 0x39, 0x2F, 0x34, 0xB3, 0x37, 0x22, 0x39, 0x4B, 0xF2, 0x22, 0x3E, 0x22,
+  0x26, 0x22, 0x80, 0x1A, 0x01, 0x66, 0x26, 0x80, 0x03, 0x81, 0x00, 0x10, 0x3B, 0x22, 0x23, 0x33,
+  0x33, 0xE2, 0x2E, 0xEE, 0x43, 0x34, 0x22, 0x22, 0x29, 0x3E, 0x66, 0x66, 0x22, 0x80, 0x33, 0x86,
+  0x00, 0x80, 0x5F, 0x85, 0x52, 0x00, 0xB3, 0x80, 0x03, 0x00, 0xF3, 0x80, 0x03, 0x00, 0x2B, 0x80,
+  0x03, 0x00, 0x2F, 0x80, 0x03, 0x00, 0x62, 0x80, 0x10, 0x03, 0x62, 0xE3, 0x33, 0x33, 0x81, 0xB5,
+  0x01, 0x22, 0x25, 0x80, 0x03, 0x02, 0x21, 0x11, 0x1A, 0x80, 0x03, 0x02, 0x11, 0x22, 0x24, 0x84,
+  0x0F, 0x00, 0x28, 0x81, 0xBB, 0x80, 0xC0, 0x06, 0x1C, 0x11, 0x11, 0xC4, 0x22, 0x28, 0x85, 0x80,
+  0xDE, 0x01, 0x22, 0xC8, 0x80, 0x03, 0x01, 0x11, 0x88, 0x82, 0x15, 0x00, 0xC4, 0x85, 0xDF, 0x00,
+  0x88, 0x9C, 0x00, 0x01, 0x11, 0x14, 0x82, 0x61, 0x00, 0x22, 0x80, 0x5D, 0x83, 0x03, 0x81, 0x0B,
+  0x81, 0x13, 0x80, 0xFC, 0x00, 0x1C, 0x81, 0x9F, 0x03, 0xB2, 0x22, 0x66, 0x33, 0x80, 0xCC, 0x03,
+  0x39, 0x26, 0x66, 0x22, 0x80, 0x03, 0x10, 0x2F, 0x3E, 0x26, 0x66, 0x2B, 0x34, 0x26, 0x66, 0x23,
+  0x37, 0x26, 0x26, 0x23, 0x37, 0x22, 0x65, 0x57, 0x83, 0xC7, 0x09, 0x66, 0x66, 0x24, 0xB9, 0x42,
+  0x66, 0x33, 0x33, 0x3E, 0x26, 0x80, 0xBA, 0x00, 0x72, 0x80, 0x03, 0x00, 0x42, 0x81, 0x03, 0x80,
+  0xBE, 0x09, 0x42, 0x66, 0x66, 0x4B, 0x33, 0x66, 0x24, 0x33, 0x33, 0x66, 0x80, 0xDC, 0x01, 0x62,
+  0x93, 0x84, 0xD7, 0x80, 0x0B, 0x01, 0x66, 0x2E, 0x80, 0x03, 0x0C, 0x22, 0xE3, 0x97, 0x39, 0x26,
+  0x43, 0x33, 0x33, 0xE2, 0x23, 0x33, 0x33, 0x32, 0x8D, 0x03, 0x04, 0x43, 0x33, 0x7B, 0x72, 0xB3,
+  0x80, 0xFF, 0x01, 0x22, 0x41, 0x80, 0x03, 0x00, 0x81, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00,
+  0x25, 0x80, 0x03, 0x8A, 0x00, 0x85, 0xE7, 0x85, 0x00, 0x00, 0x51, 0x80, 0x03, 0x01, 0x28, 0x41,
+  0x81, 0xC5, 0x05, 0x28, 0x54, 0x22, 0x22, 0x29, 0x99, 0x8D, 0x1F, 0x89, 0x00, 0x01, 0x98, 0x54,
+  0x80, 0x28, 0x80, 0xEC, 0x80, 0x04, 0x80, 0x03, 0x00, 0x1A, 0x84, 0x03, 0x81, 0x0B, 0x81, 0x13,
+  0x03, 0x18, 0x22, 0x11, 0x1C, 0x80, 0xFF, 0x01, 0x33, 0xB2, 0x80, 0x03, 0x04, 0x72, 0x66, 0x33,
+  0x39, 0x22, 0x83, 0x03, 0x00, 0x34, 0x84, 0x03, 0x00, 0x37, 0x83, 0x03, 0x83, 0x00, 0x0A, 0x62,
+  0x66, 0x22, 0x24, 0xB9, 0x42, 0x2F, 0x33, 0x33, 0x3E, 0x2B, 0x80, 0xF8, 0x80, 0xBD, 0x82, 0x03,
+  0x81, 0x0B, 0x80, 0x1B, 0x03, 0x4B, 0x66, 0x66, 0x24, 0x80, 0x07, 0x10, 0xF3, 0x33, 0x26, 0x66,
+  0x93, 0x33, 0xF2, 0x62, 0xB3, 0x33, 0x42, 0x62, 0xF3, 0x33, 0x42, 0x66, 0x2E, 0x80, 0x03, 0x09,
+  0x22, 0xE3, 0x33, 0x39, 0x26, 0x43, 0x33, 0x33, 0xE2, 0x73, 0x88, 0xF8, 0x85, 0x0B, 0x80, 0x17,
+  0x01, 0x72, 0xB3, 0x81, 0xA1, 0x81, 0xD3, 0x00, 0x21, 0x80, 0x03, 0x00, 0x25, 0x81, 0x9C, 0x80,
+  0x0C, 0x00, 0x22, 0x80, 0xE0, 0x80, 0xFA, 0x00, 0x28, 0x91, 0xFF, 0x85, 0x00, 0x00, 0x54, 0x81,
+  0x2B, 0x00, 0x28, 0x82, 0xE0, 0x93, 0x00, 0x00, 0x1A, 0x86, 0x09, 0x00, 0x14, 0x80, 0x03, 0x00,
+  0xAC, 0x84, 0x11, 0x85, 0x15, 0x81, 0x13, 0x03, 0x18, 0x11, 0x11, 0x1C, 0x80, 0xFB, 0x01, 0x33,
+  0xB2, 0x80, 0x03, 0x01, 0x72, 0x33, 0x80, 0xA8, 0x83, 0x03, 0x00, 0x3E, 0x80, 0x13, 0x00, 0x34,
+  0x80, 0x03, 0x00, 0x37, 0x81, 0x03, 0x01, 0x66, 0x22, 0x83, 0xFF, 0x00, 0x62, 0x80, 0xE3, 0x02,
+  0xB9, 0x66, 0x6F, 0x80, 0xEF, 0x80, 0xF4, 0x00, 0x66, 0x80, 0xBD, 0x82, 0x03, 0x81, 0x0B, 0x80,
+  0x1C, 0x80, 0x03, 0x0C, 0x24, 0x42, 0x66, 0x62, 0xF3, 0x3E, 0x26, 0x62, 0xE3, 0x33, 0x72, 0x62,
+  0xB3, 0x80, 0xF8, 0x04, 0xF3, 0x33, 0x46, 0x66, 0x2E, 0x80, 0x03, 0x03, 0x22, 0x4B, 0x33, 0x39,
+  0x81, 0x63, 0x00, 0xE2, 0x80, 0x03, 0x00, 0x32, 0x8D, 0x03, 0x00, 0xE3, 0x80, 0x77, 0x00, 0x53,
+  0x80, 0x08, 0x00, 0x93, 0x80, 0x03, 0x80, 0x4E, 0x8A, 0x03, 0x81, 0x17, 0x00, 0xA3, 0x80, 0x03,
+  0x00, 0x22, 0x80, 0xE1, 0x01, 0x22, 0x81, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x25, 0x80,
+  0x03, 0x01, 0x22, 0x51, 0x80, 0x03, 0x02, 0x28, 0x41, 0x22, 0x84, 0x00, 0x95, 0xFE, 0x01, 0x28,
+  0x54, 0x81, 0x2B, 0x81, 0x05, 0x97, 0x00, 0x80, 0x5A, 0x9D, 0x00, 0x01, 0x1C, 0x14, 0x81, 0x63,
+  0x80, 0x03, 0x03, 0x1A, 0x22, 0x22, 0x25, 0x81, 0x03, 0x80, 0x0B, 0x00, 0x25, 0x80, 0x13, 0x04,
+  0x2B, 0x18, 0x22, 0x22, 0x2E, 0x80, 0x16, 0x05, 0x2E, 0xB2, 0x22, 0x66, 0x66, 0x72, 0x80, 0x03,
+  0x0E, 0x26, 0x22, 0x62, 0x24, 0x26, 0x66, 0x2F, 0x33, 0x26, 0x66, 0x2B, 0x33, 0x66, 0x66, 0x23,
+  0x84, 0x03, 0x81, 0x0B, 0x01, 0x66, 0x66, 0x80, 0x1E, 0x08, 0x66, 0xB9, 0x42, 0x66, 0x66, 0x33,
+  0x3E, 0x26, 0x66, 0x80, 0xF2, 0x80, 0x03, 0x00, 0xE2, 0x80, 0x03, 0x00, 0x42, 0x82, 0x03, 0x04,
+  0x22, 0x4B, 0x33, 0x39, 0x24, 0x80, 0xE7, 0x00, 0xF3, 0x80, 0x03, 0x00, 0x93, 0x80, 0x03, 0x00,
+  0xB3, 0x84, 0x0B, 0x00, 0x2E, 0x81, 0xFB, 0x00, 0xE3, 0x80, 0x03, 0x03, 0x53, 0x33, 0x33, 0x52,
+  0x80, 0x18, 0x01, 0x32, 0x23, 0x8C, 0x03, 0x80, 0x17, 0x01, 0x92, 0xA3, 0x80, 0x1F, 0x01, 0x22,
+  0x41, 0x80, 0x92, 0x00, 0x51, 0x80, 0x03, 0x00, 0x21, 0x81, 0x9A, 0x81, 0xAA, 0x00, 0x51, 0x80,
+  0x03, 0x00, 0x28, 0x80, 0x03, 0x82, 0x00, 0x95, 0xF7, 0x02, 0x22, 0x28, 0x54, 0x81, 0x2B, 0x04,
+  0x28, 0x84, 0xC1, 0x1A, 0xAA, 0x80, 0x06, 0x00, 0x88, 0x85, 0x2F, 0x80, 0x00, 0x00, 0x5B, 0x80,
+  0x47, 0x08, 0x77, 0x22, 0x22, 0x26, 0x37, 0x22, 0x22, 0x69, 0xB6, 0x80, 0x2A, 0x03, 0x14, 0x44,
+  0x44, 0x45, 0x86, 0x1C, 0x10, 0x96, 0x69, 0xBB, 0x52, 0x77, 0x33, 0x33, 0x76, 0x77, 0x37, 0x33,
+  0x73, 0x77, 0x76, 0x63, 0x33, 0x82, 0x87, 0x37, 0x00, 0x27, 0x80, 0x37, 0x19, 0x70, 0x22, 0x22,
+  0x57, 0x00, 0x52, 0x22, 0x70, 0x00, 0x75, 0x27, 0x20, 0x00, 0x39, 0x55, 0x00, 0x00, 0x29, 0x8E,
+  0x60, 0x00, 0x99, 0x00, 0x00, 0x00, 0x20, 0x80, 0x03, 0x83, 0x00, 0x1E, 0x06, 0x96, 0x00, 0x09,
+  0x8E, 0x5E, 0x06, 0xE2, 0x26, 0xD9, 0x99, 0x22, 0x26, 0x99, 0x3D, 0x33, 0x33, 0x46, 0x07, 0x33,
+  0x39, 0x22, 0x03, 0x24, 0x72, 0x22, 0x09, 0x62, 0x22, 0x22, 0x3D, 0x80, 0x48, 0x00, 0x56, 0x80,
+  0x03, 0x19, 0x26, 0x66, 0x27, 0x4E, 0x77, 0x99, 0xD9, 0x33, 0x66, 0x26, 0x25, 0x90, 0x66, 0x66,
+  0x59, 0x00, 0x66, 0x26, 0x20, 0x00, 0x66, 0x25, 0x00, 0x00, 0x22, 0x5B, 0x80, 0x03, 0x3C, 0xD0,
+  0x00, 0x07, 0xB2, 0x30, 0x00, 0x77, 0x97, 0x00, 0x09, 0x79, 0x28, 0x5D, 0x22, 0x22, 0x02, 0x8F,
+  0x22, 0x22, 0x00, 0x92, 0x22, 0x63, 0x00, 0x66, 0x23, 0x11, 0x00, 0x29, 0x11, 0x11, 0x00, 0x0E,
+  0x11, 0x11, 0x20, 0x0E, 0x13, 0x11, 0x60, 0x0E, 0x62, 0x22, 0x33, 0x33, 0x7E, 0x7E, 0x37, 0xB4,
+  0xC0, 0x00, 0x44, 0x4C, 0x30, 0x00, 0x44, 0x4E, 0x00, 0x00, 0x44, 0xC3, 0x80, 0x03, 0x02, 0x40,
+  0x00, 0x00, 0x80, 0x0E, 0x01, 0x00, 0x39, 0x80, 0x8D, 0x0C, 0xB7, 0x33, 0x39, 0x00, 0xC4, 0x44,
+  0xE3, 0x00, 0x94, 0x44, 0xE0, 0x00, 0x74, 0x80, 0x14, 0x04, 0x74, 0x44, 0x00, 0x00, 0xB4, 0x80,
+  0x23, 0x1B, 0x7C, 0x40, 0x00, 0x39, 0x7C, 0x00, 0x00, 0xC9, 0x3E, 0x33, 0x33, 0x33, 0x09, 0x73,
+  0x33, 0x33, 0x00, 0x93, 0x33, 0x3E, 0x00, 0xE3, 0x33, 0x73, 0x00, 0x44, 0x43, 0x53, 0x80, 0x2C,
+  0x00, 0x79, 0x80, 0x28, 0x0A, 0x47, 0x00, 0x3C, 0x44, 0xC3, 0x33, 0x78, 0xCC, 0xC8, 0x99, 0x97,
+  0x86, 0xDC, 0x81, 0x00, 0x06, 0x37, 0x00, 0x09, 0x99, 0x75, 0x00, 0x39, 0x80, 0x2F, 0x0B, 0x73,
+  0x37, 0xEE, 0x99, 0x93, 0xA1, 0x11, 0x00, 0x02, 0xA4, 0x45, 0x00, 0x80, 0xA0, 0x81, 0x03, 0x11,
+  0x96, 0x73, 0x39, 0xBB, 0x77, 0x77, 0x33, 0x77, 0x33, 0x73, 0x37, 0x33, 0x33, 0x77, 0x3F, 0x63,
+  0x14, 0x82, 0x80, 0xEC, 0x88, 0x00, 0x00, 0x52, 0x80, 0x03, 0x00, 0x36, 0x80, 0x04, 0x01, 0x33,
+  0x75, 0x80, 0x03, 0x00, 0x39, 0x80, 0x03, 0x02, 0x34, 0x22, 0x66, 0x80, 0x07, 0x02, 0x66, 0x33,
+  0x33, 0x81, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00, 0x32, 0x80, 0xD3, 0x00, 0x3B, 0x80, 0x03, 0x00,
+  0x33, 0x81, 0x9A, 0x01, 0x33, 0x2F, 0x80, 0x03, 0x08, 0x66, 0xF3, 0x33, 0x39, 0x66, 0x22, 0xF4,
+  0x72, 0x66, 0x88, 0x00, 0x00, 0x42, 0x80, 0x47, 0x02, 0x33, 0x3B, 0xBB, 0x80, 0x31, 0x05, 0x22,
+  0x67, 0x22, 0x66, 0x66, 0x26, 0x80, 0x03, 0x00, 0x62, 0x83, 0x19, 0x07, 0x62, 0x74, 0x62, 0x27,
+  0x4B, 0x33, 0x4E, 0xB3, 0x81, 0x3D, 0x18, 0x33, 0x33, 0xD6, 0x65, 0x5D, 0x22, 0x55, 0x55, 0x5F,
+  0x22, 0x55, 0x59, 0xF2, 0x22, 0x55, 0xD2, 0x22, 0x23, 0xF2, 0x22, 0x27, 0x11, 0x22, 0x22, 0x29,
+  0x80, 0x03, 0x05, 0x61, 0x13, 0x22, 0x22, 0x11, 0x72, 0x80, 0x46, 0x06, 0x77, 0x22, 0x26, 0x31,
+  0x11, 0x73, 0x11, 0x8F, 0x00, 0x07, 0x22, 0x26, 0x11, 0x11, 0x63, 0x36, 0x72, 0x22, 0x80, 0x0A,
+  0x00, 0x32, 0x90, 0x1E, 0x83, 0x23, 0x84, 0x00, 0x01, 0x13, 0x62, 0x80, 0x4D, 0x01, 0x11, 0x37,
+  0x81, 0x2B, 0x00, 0x12, 0x8B, 0x1F, 0x01, 0x73, 0xAA, 0x89, 0xFF, 0x81, 0x00, 0x81, 0x74, 0x00,
+  0x17, 0x80, 0x03, 0x81, 0x3C, 0x07, 0x1A, 0xA1, 0x11, 0x11, 0x28, 0x88, 0x44, 0x44, 0x86, 0x1C,
+  0x13, 0x5B, 0x96, 0x69, 0x25, 0x77, 0x33, 0x33, 0x26, 0x73, 0x33, 0x33, 0x69, 0xB6, 0x33, 0x76,
+  0x11, 0x14, 0x82, 0x22, 0x48, 0x88, 0x3B, 0x01, 0xBB, 0x52, 0x80, 0xB0, 0x09, 0x76, 0x52, 0x22,
+  0x33, 0x33, 0x75, 0x22, 0x63, 0x33, 0x39, 0x80, 0x07, 0x00, 0x35, 0x80, 0x03, 0x00, 0x37, 0x80,
+  0x03, 0x00, 0x33, 0x81, 0x03, 0x00, 0x52, 0x80, 0x03, 0x00, 0x32, 0x80, 0x03, 0x00, 0x3A, 0x83,
+  0xFD, 0x03, 0x33, 0x33, 0x66, 0x2F, 0x80, 0x03, 0x01, 0x62, 0xF3, 0x80, 0x03, 0x00, 0x22, 0x82,
+  0x63, 0x0A, 0x26, 0x66, 0x66, 0x22, 0x22, 0x66, 0x66, 0x66, 0x3E, 0x42, 0x22, 0x80, 0x2F, 0x06,
+  0x3B, 0xBB, 0x33, 0x42, 0x66, 0x66, 0x39, 0x80, 0x14, 0x00, 0x72, 0x80, 0x13, 0x81, 0x17, 0x00,
+  0x62, 0x81, 0x1E, 0x05, 0x62, 0x27, 0x4B, 0x22, 0x4E, 0xB3, 0x82, 0x3F, 0x03, 0x27, 0x4E, 0xE2,
+  0x2F, 0x80, 0x3B, 0x09, 0x2B, 0x66, 0x22, 0x62, 0xB3, 0x66, 0x27, 0x43, 0x33, 0x74, 0x83, 0x16,
+  0x00, 0x37, 0x80, 0x03, 0x00, 0x9A, 0x80, 0x03, 0x00, 0xAA, 0x83, 0x65, 0x07, 0x37, 0xB4, 0x33,
+  0x7B, 0x44, 0x44, 0x3B, 0x44, 0x87, 0x00, 0x00, 0x4B, 0x80, 0x03, 0x08, 0x73, 0x33, 0x37, 0x44,
+  0x77, 0x63, 0x36, 0x72, 0x11, 0x98, 0x00, 0x81, 0x93, 0x00, 0x32, 0x80, 0x03, 0x03, 0x11, 0x13,
+  0x62, 0x22, 0x80, 0x0E, 0x00, 0x37, 0x90, 0x1F, 0x00, 0x73, 0x88, 0xFE, 0x01, 0x22, 0x12, 0x81,
+  0x2B, 0x00, 0x72, 0x80, 0x03, 0x00, 0x17, 0x80, 0x03, 0x80, 0x1D, 0x06, 0xC1, 0x1A, 0xAA, 0x11,
+  0x22, 0x28, 0x88, 0x82, 0xDB, 0x83, 0x00, 0x13, 0x5B, 0x96, 0x22, 0x25, 0x77, 0x33, 0x22, 0x27,
+  0x33, 0x33, 0x22, 0x69, 0xB6, 0x33, 0x11, 0x11, 0x14, 0x82, 0x44, 0x45, 0x87, 0x1D, 0x02, 0x69,
+  0xBB, 0x52, 0x80, 0xF7, 0x01, 0x76, 0x52, 0x80, 0xB4, 0x04, 0x75, 0x76, 0x63, 0x33, 0x79, 0x80,
+  0x07, 0x00, 0x35, 0x84, 0xCF, 0x92, 0x00, 0x02, 0x26, 0x66, 0x2F, 0x80, 0x03, 0x14, 0x22, 0xF3,
+  0x22, 0x66, 0x22, 0x22, 0x42, 0x66, 0x66, 0x66, 0x32, 0x22, 0x66, 0x66, 0x3B, 0x26, 0x66, 0x66,
+  0x33, 0x3E, 0x47, 0x80, 0x47, 0x0B, 0x33, 0x3B, 0x33, 0x33, 0x42, 0x66, 0x33, 0x39, 0x22, 0x66,
+  0x44, 0x72, 0x80, 0x14, 0x80, 0x02, 0x80, 0x00, 0x80, 0x05, 0x06, 0x62, 0x27, 0x22, 0x22, 0x4E,
+  0xB3, 0xBB, 0x80, 0x20, 0x06, 0x22, 0x27, 0x4E, 0xE2, 0x66, 0x62, 0x62, 0x80, 0x35, 0x0A, 0x62,
+  0x27, 0x66, 0x66, 0x27, 0xE3, 0x22, 0x74, 0xB3, 0x33, 0x4B, 0x88, 0x5F, 0x00, 0x5D, 0x80, 0x93,
+  0x0C, 0x5F, 0x22, 0x22, 0x26, 0xF2, 0x22, 0x73, 0x11, 0x22, 0x23, 0x11, 0x11, 0x27, 0x80, 0xF3,
+  0x00, 0x29, 0x80, 0x03, 0x01, 0x61, 0x13, 0x80, 0x04, 0x07, 0x62, 0x22, 0x26, 0x22, 0x77, 0x63,
+  0x36, 0x31, 0x80, 0x0A, 0x95, 0x00, 0x00, 0x72, 0x80, 0x3F, 0x01, 0x11, 0x32, 0x80, 0x03, 0x02,
+  0x11, 0x13, 0x62, 0x91, 0x1F, 0x26, 0x22, 0x29, 0x92, 0x29, 0x22, 0x57, 0xB2, 0x26, 0x22, 0xB7,
+  0x92, 0x57, 0x22, 0xB7, 0x37, 0x77, 0x22, 0xD6, 0x33, 0x73, 0x22, 0x25, 0x75, 0xB3, 0x82, 0x25,
+  0x72, 0xD7, 0x82, 0x2D, 0x76, 0x63, 0x36, 0xD2, 0x27, 0x33, 0x3D, 0x22, 0x26, 0x81, 0x03, 0x11,
+  0x7F, 0x3B, 0x55, 0x99, 0xB2, 0x33, 0x77, 0x52, 0x22, 0x76, 0x73, 0xD2, 0x22, 0x62, 0x57, 0x22,
+  0x22, 0x6D, 0x80, 0x03, 0x14, 0xE6, 0xE0, 0x00, 0x0E, 0x96, 0x60, 0x00, 0x99, 0x29, 0x00, 0x06,
+  0x85, 0x29, 0x00, 0x08, 0x55, 0x29, 0x00, 0x28, 0x55, 0x25, 0x80, 0x03, 0x14, 0xDE, 0x00, 0x08,
+  0x5C, 0x58, 0x00, 0x02, 0x88, 0x62, 0x99, 0x96, 0x00, 0x9E, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0x00, 0x90, 0x80, 0x03, 0x0E, 0xE0, 0x00, 0x29, 0xE8, 0x8E, 0x9E, 0x85, 0x89, 0x5D, 0x22, 0x58,
+  0xE0, 0x62, 0x26, 0x89, 0x80, 0x11, 0x1C, 0x05, 0x22, 0x00, 0x00, 0x09, 0x26, 0x00, 0x00, 0x0E,
+  0xFE, 0x00, 0x0D, 0x88, 0xC9, 0x20, 0x08, 0x55, 0x80, 0x00, 0x28, 0x5C, 0x90, 0x00, 0x95, 0x58,
+  0x00, 0x00, 0xE5, 0xC9, 0x80, 0x2F, 0x0B, 0x0E, 0x33, 0x90, 0x00, 0x77, 0x33, 0x00, 0x00, 0xE9,
+  0x99, 0x00, 0x00, 0x80, 0x06, 0x88, 0x00, 0x07, 0x03, 0x99, 0x99, 0x99, 0x90, 0x09, 0x33, 0x33,
+  0x82, 0x03, 0x05, 0x07, 0x73, 0x39, 0x00, 0x00, 0x83, 0x80, 0x03, 0x04, 0x93, 0x77, 0x00, 0x00,
+  0xE3, 0x80, 0x6A, 0x17, 0xCB, 0x90, 0xE0, 0x00, 0xCC, 0x70, 0x73, 0x00, 0x07, 0x00, 0x70, 0x00,
+  0x08, 0x00, 0x30, 0x00, 0x77, 0x30, 0x00, 0x00, 0x79, 0x90, 0x00, 0x07, 0x80, 0x4E, 0x04, 0x0D,
+  0x33, 0x70, 0x00, 0xE9, 0x80, 0x03, 0x0D, 0xD3, 0x33, 0x70, 0x39, 0x00, 0x07, 0xC4, 0x00, 0x00,
+  0x0C, 0x4C, 0x00, 0x00, 0x7C, 0x80, 0x03, 0x01, 0xC4, 0x4C, 0x80, 0x0E, 0x0A, 0x4E, 0x00, 0x0E,
+  0x43, 0x39, 0x00, 0x3C, 0xB3, 0x39, 0x00, 0x94, 0x80, 0x03, 0x06, 0x3C, 0x44, 0xC0, 0x00, 0x0C,
+  0x44, 0xE0, 0x80, 0x22, 0x03, 0x30, 0x00, 0x04, 0xB9, 0x80, 0xAA, 0x80, 0x62, 0x89, 0x03, 0x02,
+  0x99, 0x96, 0x20, 0x8A, 0x94, 0x48, 0x02, 0x9E, 0x88, 0x09, 0x96, 0x26, 0xE6, 0x0E, 0x72, 0x2F,
+  0xE2, 0x0E, 0x66, 0x99, 0x8E, 0x02, 0x36, 0xD2, 0xD7, 0x00, 0x55, 0x22, 0x26, 0x00, 0x25, 0x22,
+  0x26, 0x02, 0x79, 0x55, 0x99, 0x33, 0x77, 0x77, 0x52, 0xB7, 0x77, 0x77, 0xD2, 0xD7, 0x62, 0x57,
+  0x22, 0x99, 0x35, 0x56, 0x22, 0xEE, 0xE7, 0x33, 0x33, 0xEE, 0x93, 0x33, 0x33, 0xE9, 0x33, 0x33,
+  0x52, 0x53, 0x33, 0x72, 0x22, 0x33, 0x37, 0x26, 0x22, 0x33, 0x32, 0x66, 0x66, 0x33, 0x52, 0x80,
+  0x03, 0x00, 0x22, 0x80, 0x03, 0x80, 0x00, 0x04, 0xA7, 0x55, 0x55, 0x55, 0x22, 0x80, 0x0B, 0x00,
+  0x66, 0x81, 0x03, 0x82, 0x00, 0x09, 0xD2, 0x66, 0x22, 0x25, 0x33, 0x22, 0x22, 0xA3, 0x33, 0x56,
+  0x81, 0x1F, 0x02, 0x57, 0x77, 0x7A, 0x80, 0x0C, 0x01, 0x22, 0x2F, 0x80, 0x18, 0x01, 0x26, 0x26,
+  0x80, 0x03, 0x0A, 0x2A, 0xA2, 0x66, 0x66, 0xF3, 0x3A, 0x22, 0x66, 0xF3, 0x33, 0x72, 0x82, 0x3F,
+  0x81, 0x00, 0x00, 0x73, 0x80, 0x03, 0x03, 0x25, 0xA3, 0x33, 0x33, 0x80, 0x37, 0x08, 0x33, 0x66,
+  0x22, 0x53, 0x33, 0x66, 0x26, 0x25, 0x33, 0x80, 0x50, 0x06, 0xA3, 0x33, 0x3B, 0x44, 0x33, 0x33,
+  0x34, 0x80, 0x03, 0x00, 0x74, 0x80, 0x03, 0x00, 0x94, 0x80, 0x03, 0x02, 0xB4, 0x44, 0x73, 0x80,
+  0x07, 0x00, 0x43, 0x80, 0x03, 0x00, 0x4B, 0x80, 0x0B, 0x80, 0x10, 0x81, 0x20, 0x01, 0x33, 0x74,
+  0x85, 0x47, 0x89, 0x00, 0x00, 0xB3, 0x80, 0x03, 0x00, 0x11, 0x84, 0x00, 0x00, 0xB1, 0x80, 0x03,
+  0x00, 0x26, 0x80, 0x03, 0x01, 0x22, 0x21, 0x80, 0x03, 0x02, 0x22, 0x11, 0x17, 0x80, 0x03, 0x04,
+  0xB2, 0x22, 0x61, 0x11, 0xB2, 0x85, 0x1F, 0x80, 0x00, 0x06, 0x1B, 0x11, 0x11, 0x13, 0x32, 0x13,
+  0x72, 0x80, 0xA9, 0x88, 0x00, 0x5A, 0x11, 0x32, 0x22, 0x29, 0x11, 0x12, 0x22, 0x6E, 0x31, 0x13,
+  0x22, 0xDE, 0x26, 0x11, 0x22, 0xDE, 0x22, 0x11, 0x22, 0xF5, 0x22, 0x61, 0x22, 0x26, 0x22, 0x21,
+  0x72, 0x26, 0x22, 0x23, 0x72, 0x26, 0x92, 0x29, 0x76, 0xD2, 0xB2, 0x26, 0x7D, 0x22, 0x92, 0x57,
+  0x3D, 0x22, 0x37, 0x73, 0x3B, 0x55, 0x33, 0x37, 0x33, 0x77, 0x75, 0xB7, 0x77, 0x73, 0x72, 0xD7,
+  0x62, 0x56, 0x36, 0x63, 0x6D, 0x57, 0x27, 0x73, 0x35, 0x22, 0x26, 0x33, 0xF2, 0x22, 0x26, 0x3F,
+  0x22, 0x22, 0x99, 0xB2, 0x22, 0x5E, 0x52, 0x22, 0x25, 0xEE, 0xD2, 0x22, 0x2E, 0xEE, 0x22, 0x22,
+  0xBE, 0x80, 0x03, 0x01, 0xEE, 0xEE, 0x82, 0xA8, 0x07, 0xA7, 0x55, 0x55, 0x52, 0x22, 0x66, 0x66,
+  0x26, 0x80, 0x03, 0x84, 0x00, 0x02, 0xD2, 0x66, 0x22, 0x80, 0xFF, 0x01, 0x22, 0x73, 0x82, 0x1E,
+  0x06, 0x55, 0x57, 0x77, 0x7A, 0x66, 0x62, 0x22, 0x83, 0x1D, 0x00, 0x26, 0x80, 0x02, 0x0A, 0x2A,
+  0xA2, 0x66, 0x22, 0xF3, 0x3A, 0x22, 0x56, 0xF3, 0x33, 0x72, 0x85, 0xEB, 0x00, 0x2F, 0x80, 0x2A,
+  0x04, 0x26, 0x25, 0xA3, 0x33, 0x26, 0x81, 0x37, 0x02, 0x66, 0x22, 0x53, 0x80, 0xBA, 0x00, 0x25,
+  0x80, 0x03, 0x07, 0x62, 0x33, 0x33, 0x3B, 0x44, 0x33, 0x33, 0x34, 0x80, 0x03, 0x00, 0x74, 0x80,
+  0x03, 0x00, 0xB4, 0x80, 0x03, 0x00, 0x94, 0x86, 0x03, 0x00, 0xA3, 0x82, 0x0F, 0x01, 0x33, 0x3B,
+  0x85, 0x43, 0x81, 0x00, 0x81, 0x71, 0x00, 0x43, 0x80, 0x03, 0x00, 0x4B, 0x80, 0x03, 0x01, 0x44,
+  0xB3, 0x80, 0x03, 0x80, 0x00, 0x00, 0x74, 0x80, 0x03, 0x81, 0x08, 0x01, 0x33, 0x37, 0x80, 0x03,
+  0x82, 0x4B, 0x00, 0x33, 0x84, 0x03, 0x02, 0x74, 0x44, 0x11, 0x8B, 0x00, 0x05, 0x13, 0x11, 0x13,
+  0x72, 0x22, 0x17, 0x80, 0x78, 0x00, 0xB2, 0x84, 0x03, 0x02, 0x11, 0x11, 0x32, 0x80, 0x03, 0x08,
+  0x12, 0x22, 0x1B, 0x31, 0x13, 0x22, 0x32, 0x26, 0x11, 0x81, 0x11, 0x80, 0x03, 0x00, 0x61, 0x80,
+  0x03, 0x41, 0x21, 0x72, 0x22, 0x22, 0x23, 0x72, 0x29, 0x92, 0x29, 0x36, 0x57, 0xB2, 0x26, 0x3D,
+  0xB7, 0x92, 0x57, 0x32, 0xB7, 0x77, 0x73, 0x3B, 0xD6, 0x37, 0x77, 0x77, 0x25, 0x75, 0xB7, 0x36,
+  0x2D, 0x72, 0xD3, 0x62, 0x2D, 0x36, 0x73, 0x6D, 0xD2, 0x27, 0x33, 0x35, 0x22, 0x26, 0x33, 0xF2,
+  0x22, 0x26, 0x7F, 0x22, 0x55, 0x99, 0xB2, 0x22, 0x77, 0x52, 0x22, 0x25, 0x73, 0xD2, 0x22, 0x2E,
+  0x57, 0x22, 0x22, 0xBE, 0x80, 0x03, 0x00, 0xEE, 0x83, 0xB5, 0x0B, 0xA7, 0x55, 0x33, 0x52, 0x22,
+  0x22, 0x72, 0x26, 0x66, 0x22, 0x22, 0x66, 0x80, 0xFD, 0x82, 0x03, 0x01, 0x22, 0x25, 0x80, 0x05,
+  0x00, 0xA3, 0x81, 0x1D, 0x03, 0x55, 0x55, 0x57, 0x77, 0x80, 0x0B, 0x81, 0x16, 0x82, 0x1B, 0x0A,
+  0xD2, 0x66, 0x2A, 0xA2, 0x33, 0x22, 0xF3, 0x3A, 0x33, 0x56, 0xF3, 0x82, 0x3D, 0x00, 0x7A, 0x80,
+  0x03, 0x09, 0x22, 0x2F, 0x73, 0x33, 0x66, 0x62, 0x25, 0xA3, 0x66, 0x62, 0x81, 0x37, 0x80, 0x05,
+  0x80, 0x04, 0x00, 0x72, 0x80, 0x03, 0x80, 0x1A, 0x00, 0x3B, 0x80, 0x03, 0x00, 0x34, 0x80, 0x03,
+  0x00, 0x74, 0x80, 0x03, 0x00, 0xB4, 0x80, 0x03, 0x01, 0x94, 0x53, 0x80, 0x03, 0x00, 0x25, 0x80,
+  0x03, 0x04, 0x66, 0xA3, 0x33, 0xB4, 0x44, 0x80, 0x10, 0x8A, 0x03, 0x00, 0x73, 0x80, 0x03, 0x00,
+  0x43, 0x80, 0x03, 0x00, 0x4B, 0x80, 0x03, 0x08, 0x44, 0xB3, 0x33, 0x23, 0x11, 0x11, 0x11, 0x22,
+  0x61, 0x80, 0x03, 0x01, 0x22, 0xB1, 0x80, 0x03, 0x00, 0x26, 0x81, 0xFC, 0x00, 0x21, 0x80, 0x03,
+  0x85, 0x00, 0x80, 0x19, 0x8D, 0x00, 0x07, 0x13, 0x72, 0x11, 0x17, 0x22, 0x22, 0x11, 0xB2, 0x83,
+  0x03, 0x0C, 0x82, 0x2D, 0x3F, 0x56, 0x42, 0x2D, 0x35, 0x2B, 0x42, 0x22, 0x52, 0x25, 0x42, 0x80,
+  0x30, 0x1B, 0x82, 0x22, 0xB2, 0x2B, 0x22, 0x25, 0x62, 0x27, 0x22, 0x25, 0x72, 0xD7, 0x22, 0x2D,
+  0x76, 0x63, 0x37, 0x76, 0x22, 0x25, 0x76, 0x96, 0x22, 0x2E, 0xB5, 0x25, 0x22, 0x2E, 0x80, 0x1E,
+  0x1A, 0x5E, 0x52, 0x22, 0x22, 0xBE, 0x62, 0x59, 0x22, 0xBE, 0x76, 0x69, 0x22, 0xBE, 0x33, 0x79,
+  0x22, 0x5E, 0x26, 0x70, 0x00, 0x07, 0x2F, 0xE0, 0x00, 0x00, 0x23, 0xAE, 0x80, 0x03, 0x0D, 0x37,
+  0xE3, 0x00, 0x65, 0x33, 0x39, 0x93, 0x62, 0xA3, 0x33, 0x37, 0x66, 0xD3, 0x33, 0x80, 0xEF, 0x04,
+  0xA3, 0x33, 0x99, 0x96, 0x00, 0x85, 0x00, 0x00, 0x02, 0x80, 0x03, 0x19, 0x6E, 0x00, 0x02, 0x98,
+  0x85, 0x99, 0x99, 0x55, 0x5C, 0x22, 0x26, 0x55, 0x55, 0x22, 0x25, 0x55, 0xCC, 0x09, 0x6F, 0x82,
+  0x00, 0x29, 0x22, 0x90, 0x00, 0xE2, 0x80, 0x03, 0x00, 0x22, 0x82, 0x03, 0x06, 0x6E, 0x09, 0xD2,
+  0x22, 0x26, 0x96, 0x5D, 0x80, 0x6C, 0x27, 0xC5, 0xDF, 0x22, 0x26, 0x0E, 0x55, 0xD2, 0x22, 0x28,
+  0x55, 0x5F, 0x22, 0xE5, 0x5C, 0x5D, 0x22, 0x92, 0xF5, 0x55, 0xF2, 0x62, 0x2D, 0xC5, 0xD2, 0x22,
+  0xD5, 0xCC, 0xD2, 0x2D, 0x55, 0xCC, 0xD2, 0xD5, 0x55, 0xC5, 0xD2, 0x90, 0x00, 0xEC, 0x00, 0x83,
+  0x03, 0x10, 0xE4, 0x00, 0x97, 0x00, 0xCC, 0x00, 0x39, 0x9E, 0x44, 0xC7, 0x33, 0x33, 0xB4, 0x44,
+  0x33, 0x33, 0x37, 0x80, 0x03, 0x19, 0x33, 0x34, 0x07, 0x97, 0x77, 0xE0, 0x0E, 0x44, 0x44, 0xC7,
+  0x0C, 0x44, 0x44, 0x4C, 0x7C, 0x44, 0x4B, 0xB4, 0xC4, 0x4B, 0x33, 0x34, 0x44, 0x43, 0x33, 0xBB,
+  0x80, 0x0A, 0x00, 0x44, 0x81, 0x00, 0x03, 0x00, 0xE1, 0xB2, 0x29, 0x81, 0x03, 0x10, 0x69, 0xE1,
+  0x12, 0x26, 0x11, 0x11, 0x13, 0x22, 0x33, 0x11, 0x11, 0x72, 0x22, 0x21, 0x11, 0x13, 0x32, 0x80,
+  0x0D, 0x00, 0x1B, 0x80, 0x03, 0x13, 0x00, 0x09, 0x39, 0x00, 0x00, 0x09, 0x37, 0x00, 0xA0, 0x39,
+  0x39, 0x00, 0xE3, 0xE3, 0x3E, 0x00, 0x37, 0x73, 0x33, 0xE7, 0x80, 0x57, 0x03, 0x37, 0x4B, 0x77,
+  0x77, 0x82, 0x40, 0x02, 0x06, 0x62, 0x20, 0x86, 0xE0, 0x81, 0x00, 0x3C, 0x26, 0x69, 0x99, 0x89,
+  0x11, 0x22, 0x26, 0x52, 0x12, 0x22, 0x26, 0xE2, 0x62, 0x22, 0x2F, 0xE5, 0x00, 0x23, 0x76, 0x22,
+  0x00, 0x07, 0x96, 0x22, 0x00, 0x29, 0x25, 0x22, 0x59, 0x72, 0x22, 0x22, 0x5B, 0x52, 0x22, 0x22,
+  0x27, 0x62, 0x5F, 0x22, 0xD7, 0x76, 0x6F, 0x22, 0x63, 0x33, 0x3F, 0x22, 0x37, 0x22, 0x62, 0x22,
+  0x32, 0x2F, 0x7A, 0x33, 0x32, 0x23, 0x33, 0x33, 0x72, 0x80, 0x03, 0x01, 0x52, 0x25, 0x80, 0x03,
+  0x01, 0x62, 0xA3, 0x80, 0x03, 0x09, 0xD3, 0x33, 0x76, 0x66, 0x22, 0xA3, 0x43, 0x33, 0x33, 0x4C,
+  0x80, 0x6F, 0x00, 0x92, 0x80, 0x03, 0x00, 0xE2, 0x80, 0x03, 0x81, 0x0B, 0x81, 0x03, 0x03, 0x2C,
+  0x33, 0x33, 0x39, 0x80, 0x03, 0x05, 0x32, 0x2C, 0xF3, 0x33, 0x3A, 0x22, 0x80, 0x36, 0x00, 0x35,
+  0x80, 0x03, 0x01, 0x33, 0x27, 0x80, 0x03, 0x00, 0x62, 0x80, 0x03, 0x01, 0x26, 0x53, 0x80, 0x03,
+  0x80, 0x47, 0x13, 0x66, 0x62, 0xFA, 0x33, 0x22, 0x66, 0x26, 0xD3, 0xF2, 0x66, 0x66, 0x2A, 0x3A,
+  0x52, 0x22, 0x2F, 0x33, 0x33, 0xA2, 0x22, 0x80, 0x2A, 0x80, 0x03, 0x0F, 0x52, 0x66, 0x33, 0x35,
+  0x26, 0x66, 0x37, 0x52, 0x66, 0x66, 0x33, 0x74, 0x44, 0x44, 0x33, 0x34, 0x80, 0x03, 0x09, 0x39,
+  0x44, 0x44, 0xA3, 0x33, 0x44, 0x44, 0x53, 0x33, 0x3B, 0x80, 0x03, 0x01, 0x33, 0xB4, 0x80, 0x03,
+  0x00, 0x37, 0x80, 0x03, 0x05, 0x33, 0x11, 0x33, 0x66, 0x76, 0x11, 0x87, 0x00, 0x00, 0x13, 0x80,
+  0x02, 0x03, 0x22, 0x11, 0x11, 0x17, 0x80, 0x03, 0x02, 0x1B, 0x31, 0x71, 0x80, 0x10, 0x03, 0x36,
+  0x91, 0x11, 0xB2, 0x80, 0x06, 0x81, 0x03, 0x01, 0x12, 0x31, 0x80, 0x1C, 0x0A, 0x71, 0x33, 0x11,
+  0x11, 0x31, 0x22, 0x21, 0x11, 0x11, 0x32, 0x26, 0x80, 0x22, 0x02, 0x26, 0x11, 0x22, 0x8C, 0x00,
+  0x00, 0x72, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x03, 0x11, 0x13, 0x66, 0x66, 0x81, 0x50, 0x06,
+  0x22, 0x26, 0x72, 0x26, 0x22, 0x22, 0x32, 0x81, 0x03, 0x80, 0x15, 0x80, 0x03, 0x00, 0x23, 0x80,
+  0x21, 0x16, 0x33, 0x22, 0x26, 0x31, 0x12, 0x22, 0x26, 0x11, 0x62, 0x22, 0x2F, 0x7F, 0x56, 0x37,
+  0x36, 0x35, 0x2B, 0x36, 0x96, 0x52, 0x25, 0xB5, 0x25, 0x81, 0x3F, 0x11, 0xB2, 0x29, 0x52, 0x22,
+  0x62, 0x27, 0x62, 0x59, 0x72, 0xD7, 0x36, 0x6F, 0x76, 0x67, 0x73, 0x3F, 0x33, 0x37, 0x80, 0x2E,
+  0x08, 0x32, 0x2F, 0x7A, 0x33, 0x32, 0x23, 0x33, 0x33, 0x72, 0x80, 0x03, 0x00, 0x52, 0x80, 0xF8,
+  0x0B, 0x52, 0x22, 0xA3, 0x33, 0x52, 0x62, 0xD3, 0x33, 0x72, 0x66, 0x22, 0x22, 0x81, 0xC4, 0x93,
+  0x00, 0x09, 0x37, 0xA3, 0x33, 0x33, 0x32, 0x56, 0xF3, 0x33, 0x3A, 0x52, 0x81, 0x36, 0x80, 0x03,
+  0x01, 0x56, 0x67, 0x80, 0x03, 0x03, 0x62, 0x33, 0x33, 0x26, 0x80, 0x34, 0x07, 0x26, 0x66, 0x25,
+  0x33, 0x66, 0x66, 0x22, 0xFA, 0x80, 0x72, 0x04, 0x62, 0x35, 0xF2, 0x66, 0x66, 0x80, 0x25, 0x00,
+  0x26, 0x80, 0x33, 0x00, 0xA2, 0x80, 0x03, 0x00, 0x35, 0x80, 0x03, 0x00, 0x52, 0x80, 0x06, 0x19,
+  0x22, 0x33, 0x37, 0x52, 0x66, 0xF3, 0x33, 0x74, 0x44, 0x2A, 0x33, 0x34, 0x44, 0x2F, 0x33, 0x39,
+  0x44, 0x26, 0xA3, 0x33, 0x44, 0x62, 0x53, 0x33, 0x3B, 0x66, 0x80, 0x73, 0x80, 0x07, 0x82, 0x03,
+  0x02, 0x11, 0x11, 0x33, 0x82, 0xE7, 0x88, 0x00, 0x0F, 0x13, 0x31, 0x11, 0x11, 0x17, 0x26, 0x11,
+  0x11, 0x1B, 0x22, 0x71, 0x11, 0x11, 0x66, 0x36, 0x91, 0x8A, 0x18, 0x0A, 0x22, 0x21, 0x33, 0x11,
+  0x22, 0x3B, 0x22, 0x21, 0x31, 0x11, 0x32, 0x80, 0x22, 0x02, 0x11, 0x26, 0xB2, 0x81, 0xF3, 0x80,
+  0x03, 0x00, 0x12, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x01, 0x11, 0x72, 0x80, 0x03, 0x80, 0x08,
+  0x80, 0x2D, 0x82, 0x57, 0x02, 0x22, 0x22, 0x26, 0x80, 0x11, 0x01, 0x22, 0x32, 0x87, 0x03, 0x00,
+  0x23, 0x80, 0x0F, 0x04, 0x33, 0x22, 0x66, 0x31, 0x12, 0x80, 0x23, 0x0D, 0x62, 0x22, 0x25, 0x7F,
+  0x56, 0x37, 0x25, 0x75, 0x2B, 0x76, 0x22, 0x52, 0x25, 0xB5, 0x80, 0x1F, 0x80, 0x4C, 0x1C, 0x29,
+  0x52, 0x25, 0x62, 0x27, 0x62, 0x25, 0x72, 0x27, 0x36, 0x22, 0x76, 0x67, 0x73, 0xEE, 0x33, 0x37,
+  0x22, 0x92, 0x33, 0x32, 0x2F, 0x37, 0x33, 0x32, 0x23, 0x33, 0x33, 0x72, 0x80, 0x03, 0x06, 0x52,
+  0x65, 0x79, 0x33, 0x52, 0x22, 0x29, 0x80, 0x03, 0x08, 0xE9, 0x33, 0x72, 0x26, 0x22, 0x22, 0x53,
+  0x33, 0x7A, 0x80, 0xF0, 0x89, 0x00, 0x00, 0xA3, 0x80, 0x03, 0x00, 0xD3, 0x80, 0x03, 0x00, 0x22,
+  0x81, 0x08, 0x01, 0x52, 0xF3, 0x83, 0x36, 0x82, 0x3A, 0x00, 0x27, 0x80, 0x03, 0x19, 0x22, 0x33,
+  0x33, 0x26, 0x22, 0x53, 0x37, 0x22, 0x66, 0x25, 0x39, 0x22, 0x66, 0x22, 0x3A, 0x22, 0x22, 0x66,
+  0x33, 0x35, 0xF6, 0x26, 0x33, 0x33, 0x3A, 0x52, 0x8C, 0x46, 0x11, 0x35, 0xFA, 0x33, 0x37, 0x52,
+  0x26, 0xD3, 0x33, 0x74, 0x66, 0x2A, 0x33, 0x34, 0x22, 0x25, 0x33, 0x39, 0xA2, 0x80, 0x50, 0x00,
+  0x35, 0x80, 0x6F, 0x04, 0x52, 0x66, 0x53, 0x33, 0x26, 0x80, 0x03, 0x00, 0x66, 0x80, 0x03, 0x80,
+  0xE2, 0x81, 0x03, 0x86, 0x00, 0x00, 0x23, 0x81, 0xF3, 0x00, 0x31, 0x80, 0x03, 0x00, 0x26, 0x81,
+  0xFB, 0x05, 0x71, 0x11, 0x66, 0x66, 0x36, 0x91, 0x86, 0x1C, 0x0E, 0x13, 0x31, 0x11, 0x13, 0x22,
+  0x71, 0x33, 0x12, 0x22, 0x31, 0x22, 0x1B, 0x31, 0x11, 0x32, 0x80, 0x11, 0x04, 0x1B, 0x11, 0xB2,
+  0x22, 0x22, 0x82, 0x03, 0x00, 0x12, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x03, 0x11, 0x72, 0x22,
+  0x21, 0x80, 0x08, 0x80, 0x3E, 0x00, 0x13, 0x80, 0x03, 0x80, 0x43, 0x02, 0x25, 0x56, 0x22, 0x88,
+  0x00, 0x17, 0x42, 0x25, 0x58, 0x22, 0xC2, 0x21, 0x11, 0x22, 0x42, 0x5A, 0x1C, 0x22, 0x22, 0x28,
+  0x88, 0x25, 0x77, 0x7F, 0x22, 0xDE, 0x25, 0xB5, 0x22, 0x2E, 0x80, 0x1A, 0x00, 0x2B, 0x85, 0x23,
+  0x06, 0x11, 0x11, 0xC4, 0x82, 0x11, 0x11, 0x1C, 0x80, 0x07, 0x08, 0x18, 0x22, 0x66, 0x66, 0x25,
+  0xAA, 0x66, 0x66, 0x62, 0x80, 0x07, 0x02, 0x22, 0x26, 0xF2, 0x80, 0x07, 0x03, 0x32, 0x66, 0x2A,
+  0x37, 0x80, 0x03, 0x05, 0x33, 0x72, 0x66, 0x22, 0x53, 0x26, 0x80, 0x1C, 0x02, 0xA3, 0x72, 0x22,
+  0x80, 0x19, 0x80, 0x1D, 0x16, 0x22, 0x66, 0x62, 0x66, 0x66, 0x2D, 0x26, 0x22, 0x62, 0xA3, 0x56,
+  0x72, 0x23, 0x33, 0x26, 0x32, 0x23, 0x35, 0x25, 0x22, 0x6D, 0x22, 0x2A, 0x80, 0x18, 0x80, 0x3B,
+  0x81, 0x1F, 0x85, 0x00, 0x80, 0x38, 0x03, 0xA7, 0x55, 0x5A, 0x33, 0x84, 0x00, 0x10, 0x22, 0x2C,
+  0xCC, 0xB3, 0xCC, 0xCC, 0x24, 0x33, 0xCC, 0x2C, 0x43, 0x33, 0xCC, 0x29, 0x33, 0x33, 0xFB, 0x85,
+  0x18, 0x82, 0x00, 0x01, 0x3E, 0xF3, 0x80, 0x30, 0x00, 0x23, 0x80, 0x03, 0x08, 0x91, 0x22, 0x22,
+  0x26, 0x1B, 0x22, 0x22, 0x21, 0x17, 0x80, 0x0A, 0x81, 0xE5, 0x80, 0x03, 0x04, 0x22, 0x26, 0x22,
+  0x22, 0x72, 0x80, 0xA3, 0x81, 0x00, 0x0C, 0x1B, 0x11, 0x31, 0x11, 0x72, 0x31, 0x23, 0x11, 0x62,
+  0x61, 0x26, 0x11, 0x32, 0x86, 0x03, 0x81, 0x23, 0x83, 0x1F, 0x04, 0x13, 0x76, 0x11, 0x11, 0x17,
+  0x80, 0x2B, 0x02, 0x17, 0x22, 0xB3, 0x81, 0x3A, 0x03, 0x11, 0x1B, 0x22, 0x72, 0x80, 0x03, 0x02,
+  0x22, 0x31, 0x1B, 0x81, 0x3F, 0x03, 0xB7, 0x3B, 0x77, 0x72, 0x87, 0x9E, 0x02, 0x22, 0x22, 0x2A,
+  0x88, 0x03, 0x81, 0x00, 0x00, 0x25, 0x89, 0x1C, 0x12, 0x11, 0x42, 0x25, 0x88, 0x11, 0xC2, 0x21,
+  0x11, 0x11, 0x42, 0x51, 0x1C, 0x22, 0x22, 0x28, 0x88, 0x56, 0x77, 0x79, 0x80, 0x21, 0x00, 0x55,
+  0x89, 0x22, 0x80, 0x24, 0x01, 0x11, 0x44, 0x80, 0x03, 0x49, 0x1C, 0x25, 0x11, 0x11, 0x18, 0x95,
+  0x2C, 0xCC, 0x24, 0x11, 0x5C, 0xCC, 0xC2, 0x11, 0x12, 0xCC, 0x2C, 0x81, 0x15, 0xCC, 0x22, 0xD1,
+  0x18, 0xCC, 0x2B, 0x71, 0x11, 0x2C, 0xCB, 0x38, 0x11, 0xCC, 0xC2, 0x3D, 0x11, 0x2C, 0xC2, 0xBB,
+  0xB3, 0x92, 0x2C, 0x28, 0x82, 0x22, 0xCC, 0x51, 0x15, 0xC2, 0x22, 0x51, 0x18, 0xCC, 0x22, 0x71,
+  0x18, 0xC2, 0xB5, 0x71, 0x15, 0x23, 0xE1, 0x51, 0x15, 0x23, 0x51, 0x51, 0x15, 0x22, 0x11, 0xCC,
+  0xCC, 0x22, 0x22, 0xCC, 0x80, 0x00, 0x00, 0x2C, 0x80, 0x03, 0x00, 0x85, 0x81, 0x5A, 0x24, 0x22,
+  0xCC, 0x22, 0x11, 0x43, 0xB2, 0x8D, 0x1D, 0x33, 0x91, 0x18, 0x19, 0x33, 0x81, 0x15, 0x22, 0x22,
+  0x66, 0x22, 0x66, 0x66, 0x66, 0x25, 0x22, 0x66, 0x26, 0x53, 0x66, 0x22, 0x27, 0x33, 0x62, 0xDA,
+  0x33, 0x33, 0x5A, 0x33, 0x86, 0x00, 0x01, 0x37, 0xF2, 0x87, 0x95, 0x00, 0x26, 0x80, 0x03, 0x00,
+  0x21, 0x82, 0x42, 0x83, 0x03, 0x18, 0x22, 0xD2, 0x22, 0x22, 0x72, 0x29, 0x11, 0x11, 0x11, 0x31,
+  0x11, 0x11, 0x1B, 0x1B, 0x31, 0x11, 0x72, 0x17, 0x23, 0x11, 0x62, 0x13, 0x26, 0x11, 0x32, 0x81,
+  0x03, 0x00, 0x26, 0x80, 0x03, 0x83, 0xCA, 0x82, 0x00, 0x00, 0x13, 0x80, 0x23, 0x01, 0x17, 0x61,
+  0x81, 0x03, 0x0E, 0xB3, 0x11, 0x13, 0x61, 0x22, 0x11, 0x1B, 0x61, 0x62, 0x11, 0x1B, 0x26, 0x22,
+  0x31, 0x1B, 0x81, 0x1C, 0x03, 0x76, 0x31, 0x77, 0x72, 0x8A, 0xFF, 0x88, 0x00, 0x00, 0x48, 0x8C,
+  0x0F, 0x07, 0x21, 0x11, 0x42, 0x25, 0x21, 0x11, 0xC2, 0x21, 0x80, 0x07, 0x00, 0x51, 0x80, 0x0E,
+  0x08, 0x28, 0x25, 0x56, 0x67, 0x7F, 0x22, 0x22, 0x25, 0x55, 0x85, 0x1F, 0x00, 0x58, 0x82, 0x9C,
+  0x02, 0x11, 0x11, 0x1C, 0x80, 0x03, 0x0D, 0x88, 0x25, 0x11, 0x11, 0x33, 0xA2, 0x26, 0x62, 0x33,
+  0x32, 0x26, 0x66, 0x33, 0x35, 0x80, 0x03, 0x01, 0x33, 0xF2, 0x80, 0x03, 0x10, 0x32, 0x66, 0x8B,
+  0x73, 0x32, 0x66, 0x88, 0x33, 0x72, 0x66, 0x87, 0x33, 0x26, 0x66, 0x25, 0xAA, 0xA3, 0x81, 0x7B,
+  0x04, 0x26, 0x22, 0x26, 0x66, 0x66, 0x81, 0x3F, 0x14, 0x2A, 0x37, 0x22, 0x22, 0x6A, 0x33, 0x72,
+  0x23, 0x62, 0x53, 0xA2, 0x23, 0x66, 0x6F, 0x26, 0x2D, 0x66, 0x66, 0x62, 0x22, 0x66, 0x80, 0x00,
+  0x17, 0x62, 0x62, 0x22, 0x22, 0x2D, 0x26, 0x22, 0x22, 0xA3, 0x56, 0x62, 0x22, 0x33, 0x22, 0x53,
+  0xA7, 0x35, 0x25, 0x33, 0x33, 0x26, 0x2A, 0x33, 0x33, 0x80, 0x32, 0x81, 0x1E, 0x80, 0x3B, 0x82,
+  0x3F, 0x07, 0x25, 0x66, 0x22, 0xDA, 0x33, 0x55, 0x5A, 0x33, 0x86, 0x00, 0x04, 0x22, 0xB3, 0x33,
+  0x33, 0x24, 0x80, 0x07, 0x00, 0x43, 0x87, 0x12, 0x86, 0x00, 0x01, 0x3E, 0xF3, 0x80, 0x1F, 0x0C,
+  0x23, 0x11, 0x11, 0x22, 0x31, 0x11, 0x11, 0x26, 0x1B, 0x31, 0x11, 0x21, 0x17, 0x80, 0x0C, 0x01,
+  0x13, 0x26, 0x82, 0x03, 0x03, 0x22, 0x26, 0x26, 0x11, 0x81, 0x98, 0x00, 0x11, 0x80, 0x00, 0x00,
+  0x1B, 0x80, 0x03, 0x00, 0x72, 0x80, 0x23, 0x06, 0x62, 0x61, 0x11, 0x11, 0x32, 0x61, 0xB3, 0x80,
+  0x03, 0x00, 0x22, 0x80, 0x03, 0x00, 0x72, 0x80, 0x23, 0x81, 0x39, 0x80, 0x2E, 0x03, 0x76, 0x3B,
+  0x77, 0x17, 0x80, 0x2B, 0x81, 0x03, 0x00, 0x13, 0x80, 0x03, 0x00, 0x1B, 0x88, 0x03, 0x03, 0x11,
+  0xB7, 0x22, 0x22, 0x81, 0x47, 0x86, 0x00, 0x02, 0x2A, 0xAA, 0x32, 0x80, 0x03, 0x00, 0xA2, 0x82,
+  0x07, 0x81, 0x00, 0x02, 0x25, 0x56, 0x77, 0x81, 0x05, 0x85, 0x1E, 0x1A, 0x25, 0x58, 0x22, 0x22,
+  0x21, 0x11, 0x22, 0x11, 0x51, 0x1C, 0x22, 0x11, 0x28, 0x88, 0x25, 0x11, 0xE9, 0x33, 0xA2, 0x26,
+  0x77, 0x33, 0x32, 0x26, 0x33, 0x33, 0x35, 0x80, 0x03, 0x01, 0x33, 0xF2, 0x80, 0x03, 0x0A, 0x32,
+  0x88, 0x4B, 0x73, 0x32, 0x88, 0x88, 0x33, 0x72, 0x88, 0x87, 0x80, 0xFE, 0x04, 0x25, 0xAA, 0xA3,
+  0x66, 0x62, 0x81, 0xFD, 0x00, 0x26, 0x81, 0xFF, 0x0F, 0x22, 0x66, 0x2A, 0x37, 0x26, 0x66, 0x2A,
+  0x33, 0x72, 0x66, 0x22, 0x53, 0xA2, 0x66, 0x62, 0x25, 0x80, 0x7B, 0x01, 0x66, 0x26, 0x80, 0x1C,
+  0x80, 0x22, 0x80, 0x04, 0x11, 0x2D, 0x66, 0x66, 0x22, 0xA3, 0x56, 0x62, 0x23, 0x33, 0x22, 0x53,
+  0x23, 0x35, 0x25, 0x33, 0x2F, 0x22, 0x2A, 0x80, 0x40, 0x81, 0x3B, 0x87, 0x00, 0x06, 0x62, 0x66,
+  0x62, 0xDA, 0xA7, 0x55, 0x5A, 0x80, 0x66, 0x83, 0x00, 0x0C, 0xCC, 0xC2, 0xB3, 0x33, 0xCC, 0xC4,
+  0x33, 0x33, 0x2C, 0x43, 0x33, 0x33, 0x29, 0x86, 0x15, 0x84, 0x00, 0x01, 0x3E, 0xF3, 0x80, 0x3F,
+  0x13, 0x29, 0x11, 0x22, 0x22, 0x91, 0x11, 0x22, 0x26, 0x1B, 0x31, 0x22, 0x21, 0x17, 0x23, 0x22,
+  0x91, 0x13, 0x26, 0x22, 0x11, 0x80, 0x03, 0x02, 0x22, 0x26, 0x26, 0x81, 0xF8, 0x00, 0x11, 0x81,
+  0x00, 0x00, 0x1B, 0x80, 0x03, 0x0A, 0x72, 0x31, 0x11, 0x11, 0x62, 0x61, 0x11, 0x11, 0x32, 0x61,
+  0xB3, 0x80, 0x03, 0x00, 0x22, 0x80, 0x03, 0x80, 0x1D, 0x80, 0x2A, 0x81, 0x00, 0x04, 0x13, 0x76,
+  0x31, 0x11, 0x17, 0x80, 0x2B, 0x81, 0x03, 0x00, 0x13, 0x80, 0x03, 0x00, 0x1B, 0x83, 0x03, 0x00,
+  0x31, 0x80, 0x03, 0x80, 0x00, 0x03, 0x28, 0x82, 0x41, 0x42, 0x80, 0x10, 0x08, 0x42, 0x24, 0x22,
+  0x1A, 0x82, 0x41, 0x11, 0x11, 0xC4, 0x82, 0x32, 0x85, 0x00, 0x07, 0x41, 0x11, 0x42, 0x2B, 0x22,
+  0x2C, 0x22, 0x5E, 0x80, 0x27, 0x00, 0xEE, 0x80, 0x0A, 0x80, 0x03, 0x0D, 0x2E, 0xEE, 0x1A, 0x82,
+  0x5B, 0xD2, 0x1A, 0x82, 0x22, 0x22, 0x1C, 0x22, 0x22, 0xBB, 0x80, 0xDD, 0x09, 0x22, 0x6D, 0xA5,
+  0x66, 0x62, 0x65, 0x37, 0x66, 0x62, 0x2A, 0x80, 0x03, 0x07, 0x23, 0x35, 0x22, 0x6D, 0x33, 0x33,
+  0xA7, 0x55, 0x81, 0xBE, 0x22, 0x53, 0x72, 0x57, 0x33, 0x66, 0x26, 0x62, 0x53, 0x2D, 0x26, 0x62,
+  0xA3, 0x53, 0x52, 0x2D, 0x33, 0xA3, 0x52, 0x65, 0x33, 0x33, 0x22, 0x2A, 0x33, 0x37, 0x26, 0xD3,
+  0x33, 0x3A, 0x22, 0x53, 0x33, 0x33, 0xA5, 0xA3, 0x85, 0xE9, 0x10, 0x39, 0x33, 0x3B, 0x47, 0x22,
+  0x33, 0x39, 0x26, 0x62, 0x33, 0x39, 0x22, 0xBE, 0x33, 0x39, 0x2F, 0x3B, 0x80, 0x03, 0x80, 0x15,
+  0x01, 0x26, 0xB3, 0x80, 0x16, 0x00, 0x23, 0x80, 0xC8, 0x00, 0x23, 0x80, 0x7F, 0x06, 0x23, 0x66,
+  0x22, 0x66, 0x23, 0x22, 0x62, 0x80, 0x0B, 0x12, 0x2F, 0xB4, 0x23, 0x72, 0x64, 0x39, 0x23, 0xF2,
+  0x2F, 0x33, 0x73, 0x22, 0x29, 0x11, 0x37, 0x22, 0x21, 0x11, 0x16, 0x80, 0x03, 0x02, 0x17, 0x22,
+  0x61, 0x82, 0x03, 0x00, 0x11, 0x8A, 0x03, 0x81, 0x38, 0x02, 0x11, 0x32, 0x73, 0x80, 0x03, 0x07,
+  0x61, 0x21, 0x11, 0x32, 0x31, 0x11, 0x11, 0x12, 0x80, 0x15, 0x87, 0x00, 0x01, 0x22, 0x26, 0x80,
+  0xC2, 0x80, 0x00, 0x13, 0x32, 0x66, 0x22, 0x26, 0x32, 0x31, 0x17, 0x23, 0x32, 0x31, 0xB2, 0x2A,
+  0x13, 0x11, 0x32, 0x6A, 0x11, 0x11, 0x72, 0x3A, 0x80, 0x1D, 0x00, 0xAA, 0x82, 0x1C, 0x09, 0x21,
+  0xC2, 0x81, 0x11, 0x11, 0xC2, 0x51, 0x11, 0x11, 0x42, 0x80, 0x03, 0x00, 0x82, 0x80, 0x03, 0x00,
+  0x48, 0x87, 0x3F, 0x80, 0x00, 0x06, 0xAA, 0x82, 0x41, 0x42, 0x11, 0x22, 0x11, 0x80, 0x03, 0x01,
+  0x1A, 0x82, 0x80, 0x12, 0x00, 0xC4, 0x89, 0x5F, 0x08, 0x28, 0x41, 0x11, 0x42, 0x22, 0x22, 0x2C,
+  0x82, 0x24, 0x80, 0x27, 0x80, 0x0A, 0x00, 0x2B, 0x80, 0x43, 0x00, 0x2E, 0x80, 0x43, 0x04, 0x5B,
+  0x11, 0x1A, 0x82, 0x22, 0x81, 0x3D, 0x0E, 0x34, 0x55, 0x22, 0xC2, 0x92, 0x2F, 0xB4, 0xC2, 0x22,
+  0xC5, 0x79, 0xCC, 0x22, 0x81, 0x12, 0x80, 0x03, 0x29, 0x18, 0x22, 0xB3, 0x31, 0x18, 0xB4, 0x33,
+  0x35, 0x1D, 0x3D, 0x44, 0x43, 0x42, 0x48, 0x81, 0x15, 0x28, 0x11, 0x81, 0x12, 0x21, 0x11, 0x58,
+  0xD3, 0x45, 0x85, 0x22, 0x33, 0x42, 0x24, 0x22, 0x33, 0x22, 0x2B, 0x11, 0x94, 0x5C, 0xF3, 0x11,
+  0xD1, 0x18, 0x4B, 0x80, 0x03, 0x27, 0x98, 0x53, 0x35, 0x11, 0x19, 0x93, 0x71, 0x11, 0x73, 0x33,
+  0x81, 0x18, 0x47, 0x3D, 0x11, 0x89, 0x22, 0x3D, 0x11, 0xE9, 0x22, 0x33, 0x79, 0x39, 0x2F, 0x73,
+  0x33, 0x3E, 0x6F, 0x1D, 0x33, 0x3E, 0x22, 0x33, 0x3B, 0x47, 0x22, 0x39, 0x72, 0x26, 0x80, 0x7D,
+  0x01, 0x66, 0x66, 0x81, 0x03, 0x00, 0xB4, 0x80, 0x09, 0x12, 0x3B, 0x26, 0x2F, 0xB4, 0x33, 0x76,
+  0x24, 0x39, 0xB3, 0x46, 0x2F, 0x33, 0x23, 0x33, 0x39, 0x44, 0x23, 0x33, 0x34, 0x84, 0x03, 0x00,
+  0x74, 0x8A, 0x03, 0x00, 0x53, 0x80, 0x03, 0x00, 0x37, 0x80, 0x2F, 0x04, 0x16, 0x23, 0x11, 0x32,
+  0x17, 0x81, 0x03, 0x02, 0x21, 0x11, 0x32, 0x80, 0xD2, 0x00, 0xB2, 0x89, 0xDF, 0x1B, 0x33, 0x33,
+  0x37, 0xBB, 0x7B, 0x33, 0x33, 0x33, 0x74, 0xB3, 0x77, 0x33, 0xB4, 0xB3, 0x74, 0x43, 0x74, 0xB3,
+  0xB4, 0x43, 0x44, 0x4B, 0x4C, 0x11, 0x44, 0x4C, 0x11, 0x11, 0x80, 0x02, 0x80, 0x1F, 0x81, 0x00,
+  0x0A, 0x3A, 0xA3, 0x39, 0xAA, 0xAA, 0xA3, 0x37, 0xA5, 0x88, 0x88, 0xD8, 0x89, 0x3C, 0x84, 0x1F,
+  0x0B, 0x9A, 0xAA, 0x93, 0x7A, 0x9A, 0xAA, 0x33, 0xAA, 0x81, 0x18, 0x88, 0x88, 0x8C, 0x1E, 0x05,
+  0x11, 0x33, 0x39, 0x7A, 0xAA, 0x73, 0x80, 0x40, 0x04, 0x73, 0x37, 0x33, 0x33, 0xD7, 0x80, 0x0A,
+  0x03, 0x11, 0x11, 0x85, 0xA3, 0x89, 0x1F, 0x05, 0x73, 0x34, 0x2C, 0x2C, 0x33, 0x92, 0x80, 0xCF,
+  0x11, 0x2C, 0xC4, 0x39, 0x34, 0xCC, 0x2B, 0x39, 0x32, 0x22, 0x2B, 0x34, 0x18, 0x54, 0x33, 0x33,
+  0x11, 0x11, 0x15, 0x80, 0x2B, 0x08, 0x11, 0x18, 0x66, 0x62, 0x66, 0x22, 0x66, 0x62, 0x2D, 0x80,
+  0x03, 0x0D, 0x53, 0x52, 0x66, 0x62, 0x33, 0x52, 0x22, 0x6F, 0x33, 0x22, 0xA7, 0x55, 0x37, 0x22,
+  0x80, 0xB7, 0x0D, 0x22, 0xE7, 0x33, 0x33, 0xA5, 0x62, 0x53, 0x33, 0x33, 0x22, 0xA3, 0x33, 0x33,
+  0x2D, 0x80, 0x63, 0x00, 0x25, 0x80, 0x14, 0x00, 0x2A, 0x80, 0x03, 0x00, 0xD3, 0x80, 0x03, 0x80,
+  0x16, 0x00, 0x37, 0x80, 0x16, 0x0E, 0x37, 0x33, 0x37, 0x18, 0x47, 0x33, 0x35, 0x11, 0x52, 0x47,
+  0x25, 0x11, 0x82, 0x22, 0x26, 0x80, 0x03, 0x38, 0xB4, 0x11, 0x82, 0x2F, 0x3B, 0xD5, 0x2F, 0x2F,
+  0x33, 0x76, 0x24, 0x22, 0xB3, 0xF6, 0x6F, 0x22, 0x23, 0x33, 0x37, 0x2D, 0x59, 0x33, 0x3D, 0x21,
+  0x18, 0x33, 0x31, 0x21, 0x11, 0xE3, 0x91, 0x25, 0x11, 0xD3, 0x91, 0xB2, 0x11, 0x83, 0x91, 0x39,
+  0x11, 0x83, 0x71, 0x33, 0x51, 0xD3, 0xA1, 0x44, 0xB3, 0x33, 0x33, 0x1C, 0x47, 0x3B, 0x44, 0x11,
+  0x43, 0x81, 0x03, 0x09, 0x34, 0x44, 0x11, 0x44, 0x44, 0xC1, 0x11, 0x44, 0x4C, 0x11, 0x81, 0x03,
+  0x02, 0x1C, 0x44, 0x41, 0x81, 0xFF, 0x17, 0x37, 0xB3, 0x7B, 0x33, 0x33, 0xB3, 0x74, 0xB3, 0x77,
+  0xB3, 0xB4, 0xB3, 0xB4, 0xC3, 0x74, 0xB3, 0xB4, 0x14, 0x44, 0x4B, 0x44, 0xC4, 0x44, 0x44, 0x82,
+  0x03, 0x01, 0xBB, 0x22, 0x82, 0x00, 0x16, 0x21, 0x22, 0x26, 0xAA, 0xAA, 0x17, 0x23, 0xAA, 0xAA,
+  0x12, 0x2A, 0xAA, 0xAA, 0x32, 0x6A, 0xAA, 0xAA, 0x72, 0x3A, 0xAA, 0xAA, 0x22, 0xAA, 0x80, 0x03,
+  0x80, 0x00, 0x08, 0x12, 0x81, 0xAA, 0x82, 0xC2, 0x51, 0x11, 0x22, 0x42, 0x80, 0x03, 0x04, 0x82,
+  0x51, 0x11, 0x11, 0x48, 0x80, 0xF8, 0x85, 0x00, 0x11, 0x22, 0x22, 0x25, 0x41, 0x41, 0x42, 0x22,
+  0x22, 0x11, 0x42, 0x24, 0x22, 0x1A, 0x82, 0x41, 0x11, 0x11, 0xC4, 0x86, 0x1A, 0x00, 0x1A, 0x80,
+  0x03, 0x07, 0x1C, 0x88, 0xB3, 0x35, 0x62, 0x38, 0x33, 0x72, 0x80, 0xFE, 0x0E, 0x22, 0x65, 0xB3,
+  0x35, 0x22, 0x6A, 0xB3, 0x32, 0x22, 0x23, 0x73, 0x75, 0x73, 0x33, 0x73, 0x80, 0x98, 0x0F, 0x33,
+  0x33, 0x55, 0x53, 0x22, 0x62, 0x22, 0x26, 0xA5, 0x66, 0x22, 0x2D, 0x37, 0x22, 0x22, 0x53, 0x80,
+  0x03, 0x08, 0x33, 0x35, 0x26, 0x6F, 0x33, 0x33, 0xA7, 0x55, 0x37, 0x81, 0xB7, 0x01, 0x72, 0x57,
+  0x80, 0x35, 0x07, 0x62, 0x53, 0x33, 0x26, 0x62, 0xA3, 0x33, 0x56, 0x80, 0x41, 0x01, 0x52, 0x25,
+  0x80, 0x0F, 0x00, 0x2A, 0x80, 0x03, 0x00, 0xD3, 0x80, 0x03, 0x04, 0x53, 0x33, 0x33, 0xA5, 0xA3,
+  0x82, 0x44, 0x13, 0x3B, 0x33, 0x33, 0x39, 0x72, 0x3B, 0x4F, 0x22, 0x22, 0x3E, 0x22, 0x22, 0x62,
+  0x3E, 0x22, 0xB4, 0x26, 0x3E, 0x2F, 0x3B, 0x80, 0x03, 0x0E, 0x33, 0x72, 0x3E, 0x22, 0xB3, 0x42,
+  0x47, 0x22, 0x23, 0x33, 0x22, 0x66, 0x23, 0x33, 0x66, 0x80, 0x03, 0x00, 0x22, 0x81, 0x0B, 0x80,
+  0x03, 0x08, 0x2F, 0xB4, 0x23, 0x33, 0x24, 0x39, 0x73, 0x33, 0x2F, 0x80, 0x85, 0x10, 0x29, 0x11,
+  0x37, 0x22, 0x21, 0x11, 0x16, 0x23, 0x21, 0x11, 0x17, 0x23, 0x61, 0x11, 0x17, 0x21, 0x61, 0x80,
+  0xB4, 0x89, 0x03, 0x81, 0xFF, 0x02, 0x11, 0x32, 0x73, 0x80, 0x03, 0x07, 0x61, 0x32, 0x11, 0x32,
+  0x31, 0x32, 0x11, 0xB2, 0x80, 0x07, 0x02, 0x11, 0x11, 0x13, 0x85, 0xE4, 0x01, 0x26, 0x3B, 0x81,
+  0x21, 0x19, 0x22, 0x22, 0x66, 0x22, 0x26, 0xAA, 0x31, 0x17, 0x23, 0xAA, 0x31, 0x12, 0x2A, 0xAA,
+  0x11, 0x32, 0x7A, 0xAA, 0x11, 0x72, 0x3A, 0xAA, 0x11, 0x22, 0xAA, 0xAA, 0x81, 0x23, 0x00, 0x41,
+  0x80, 0x03, 0x00, 0x24, 0x81, 0x4B, 0x04, 0x21, 0x11, 0x11, 0x48, 0x51, 0x85, 0x39, 0x01, 0x11,
+  0x1A, 0x81, 0x03, 0x03, 0xA3, 0x22, 0x65, 0x55, 0x80, 0x03, 0x00, 0xCC, 0x83, 0x03, 0x06, 0xD5,
+  0xCC, 0xA7, 0x22, 0xDC, 0xCC, 0x32, 0x80, 0x03, 0x00, 0x22, 0x82, 0x03, 0x0B, 0x55, 0x5C, 0x53,
+  0x72, 0x22, 0x23, 0xA3, 0x52, 0x62, 0x53, 0xA3, 0x22, 0x80, 0x03, 0x00, 0x26, 0x80, 0x03, 0x0E,
+  0x56, 0x62, 0xD3, 0x73, 0x32, 0x66, 0x65, 0x23, 0x35, 0x66, 0x66, 0x25, 0x72, 0x66, 0x66, 0x80,
+  0xFF, 0x0D, 0x33, 0x32, 0x73, 0x33, 0x33, 0x72, 0x2A, 0x33, 0x33, 0xA2, 0x22, 0x33, 0x33, 0x37,
+  0x80, 0x03, 0x08, 0x33, 0xD2, 0x33, 0x33, 0x73, 0x52, 0x33, 0x33, 0x25, 0x81, 0x0B, 0x02, 0x3E,
+  0xFF, 0xB3, 0x81, 0x23, 0x0B, 0x33, 0x33, 0xBB, 0x33, 0x33, 0x34, 0x22, 0xE3, 0x33, 0x34, 0x66,
+  0xF3, 0x80, 0x03, 0x81, 0x07, 0x81, 0x03, 0x04, 0x27, 0x4F, 0xFF, 0x33, 0x93, 0x81, 0x1D, 0x00,
+  0x3B, 0x80, 0x1E, 0x17, 0x92, 0x22, 0xB3, 0x93, 0xB2, 0x22, 0xB3, 0xE3, 0xB2, 0x62, 0xB3, 0x43,
+  0x92, 0x66, 0x74, 0x73, 0x22, 0x26, 0x62, 0x23, 0x22, 0x28, 0x88, 0x85, 0x83, 0xE1, 0x93, 0x00,
+  0x00, 0x31, 0x81, 0xD7, 0x02, 0x27, 0x63, 0x11, 0x90, 0x1A, 0x00, 0x26, 0x80, 0x03, 0x00, 0x2A,
+  0x80, 0x1D, 0x0A, 0xAA, 0x11, 0x13, 0x22, 0xAA, 0x76, 0x67, 0x23, 0xAA, 0x22, 0x22, 0x80, 0x03,
+  0x04, 0x63, 0x3A, 0xAA, 0x6A, 0xAA, 0x87, 0x00, 0x80, 0x3E, 0x80, 0x00, 0x04, 0x12, 0x21, 0x11,
+  0x11, 0x82, 0x81, 0x03, 0x00, 0x41, 0x80, 0x03, 0x80, 0x0F, 0x00, 0xC5, 0x83, 0x16, 0x84, 0x00,
+  0x00, 0x14, 0x80, 0x15, 0x01, 0x12, 0x24, 0x80, 0x07, 0x00, 0x22, 0x80, 0x22, 0x01, 0x48, 0x51,
+  0x8A, 0x1B, 0x80, 0x14, 0x00, 0x5E, 0x88, 0x03, 0x02, 0xBE, 0x11, 0x18, 0x80, 0x03, 0x04, 0x42,
+  0x22, 0xBE, 0x1A, 0x22, 0x82, 0x03, 0x34, 0xEE, 0x22, 0x43, 0x92, 0x28, 0x22, 0xB3, 0x4C, 0xCC,
+  0xCC, 0xB3, 0x25, 0x55, 0xCC, 0xB3, 0x81, 0x11, 0xCC, 0xB3, 0x51, 0x11, 0xCC, 0x93, 0x91, 0x11,
+  0xCC, 0x23, 0x3D, 0x11, 0x22, 0x24, 0x92, 0x81, 0x11, 0x51, 0x1D, 0xD1, 0x8D, 0x98, 0x89, 0x11,
+  0xD7, 0x42, 0x29, 0x81, 0x11, 0x18, 0x82, 0x39, 0x11, 0x11, 0x15, 0x33, 0x83, 0x03, 0x00, 0x18,
+  0x81, 0x0B, 0x0E, 0x91, 0x15, 0x33, 0x3E, 0xFF, 0x17, 0x33, 0xED, 0x59, 0x53, 0x98, 0x11, 0x1D,
+  0x33, 0x71, 0x80, 0x18, 0x07, 0x3D, 0x55, 0xD2, 0x33, 0x33, 0x34, 0x22, 0xD3, 0x80, 0x03, 0x00,
+  0x15, 0x80, 0x03, 0x03, 0xB3, 0x4F, 0xFF, 0x33, 0x82, 0x00, 0x1B, 0x3B, 0xBB, 0x33, 0x43, 0x92,
+  0x22, 0xB3, 0xF3, 0xB2, 0x22, 0xB3, 0xE3, 0xB2, 0x62, 0xB3, 0x43, 0x92, 0x62, 0x74, 0x2F, 0x26,
+  0x22, 0x22, 0x62, 0x22, 0x27, 0x77, 0x22, 0x84, 0x00, 0x00, 0x62, 0x84, 0x03, 0x1C, 0xD2, 0x22,
+  0x22, 0x29, 0x92, 0x22, 0x22, 0x84, 0x52, 0x22, 0x2E, 0x44, 0x39, 0x97, 0xAA, 0xAD, 0x33, 0x33,
+  0x39, 0x81, 0x33, 0x33, 0xD1, 0x11, 0x33, 0x78, 0x11, 0x11, 0x35, 0x8B, 0xDD, 0x01, 0x11, 0x81,
+  0x85, 0x05, 0x11, 0x17, 0x7D, 0x11, 0x11, 0x87, 0x77, 0xD1, 0x11, 0x15, 0x77, 0x75, 0x11, 0x11,
+  0x57, 0x77, 0x11, 0x11, 0x1D, 0x80, 0x03, 0x00, 0x11, 0x81, 0x03, 0x8E, 0x00, 0x81, 0x33, 0x00,
+  0xD1, 0x80, 0x03, 0x80, 0x28, 0xB9, 0x00, 0x00, 0x15, 0x80, 0x03, 0x0C, 0x57, 0x11, 0x87, 0x33,
+  0x33, 0x11, 0x11, 0xD2, 0x93, 0x11, 0x11, 0x18, 0x2B, 0x80, 0x0F, 0x00, 0x82, 0x80, 0x03, 0x00,
+  0x1D, 0x80, 0x03, 0x01, 0x18, 0xD8, 0x84, 0x5F, 0x80, 0xF9, 0x00, 0x3E, 0x82, 0xFF, 0x83, 0x00,
+  0x00, 0x34, 0x85, 0x03, 0x00, 0xD3, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x03, 0xFF, 0xB3, 0x4F,
+  0xF2, 0x80, 0x0F, 0x35, 0x71, 0xBB, 0x33, 0x3B, 0x51, 0x22, 0x43, 0x92, 0xD1, 0x22, 0xF3, 0xB2,
+  0x21, 0x25, 0x89, 0xB2, 0x25, 0x61, 0x18, 0x96, 0x22, 0x21, 0x11, 0xD2, 0x22, 0x33, 0x93, 0x33,
+  0x91, 0x89, 0x39, 0x57, 0x33, 0x15, 0x38, 0x11, 0x99, 0x18, 0x95, 0x11, 0xD5, 0x11, 0xD9, 0x11,
+  0x85, 0x11, 0x53, 0x81, 0x8D, 0x58, 0x29, 0xD1, 0xDD, 0x25, 0x80, 0xC8, 0x02, 0x19, 0x39, 0xA1,
+  0x80, 0x63, 0x02, 0x35, 0x87, 0x57, 0x80, 0x44, 0x81, 0x6C, 0x0E, 0x11, 0x99, 0x11, 0x93, 0x18,
+  0x38, 0x11, 0x73, 0x55, 0x95, 0x18, 0x33, 0x11, 0x89, 0xE3, 0x80, 0x9B, 0x0A, 0x11, 0x11, 0x63,
+  0x11, 0x11, 0x13, 0x22, 0x22, 0x76, 0x67, 0x22, 0x83, 0x00, 0x0A, 0x63, 0x22, 0x22, 0x6A, 0xAA,
+  0x22, 0x26, 0xAA, 0xAA, 0x22, 0x2A, 0x80, 0x03, 0x80, 0x1F, 0x81, 0x03, 0x00, 0x24, 0x84, 0x03,
+  0x00, 0x41, 0x90, 0xE8, 0x0B, 0x12, 0x21, 0x14, 0x41, 0x82, 0x21, 0x12, 0x25, 0x82, 0x41, 0x14,
+  0x22, 0x80, 0xE0, 0x04, 0x48, 0xC5, 0x11, 0x11, 0x1A, 0x88, 0x1E, 0x00, 0x14, 0x85, 0x03, 0x00,
+  0x21, 0x80, 0x03, 0x00, 0x51, 0x80, 0xFB, 0x03, 0xA1, 0x11, 0x11, 0x42, 0x80, 0x22, 0x80, 0x56,
+  0x05, 0x1A, 0x22, 0x33, 0x72, 0x22, 0x53, 0x80, 0x03, 0x06, 0xA3, 0x33, 0x72, 0x26, 0xA3, 0x33,
+  0x52, 0x84, 0x03, 0x02, 0x56, 0x26, 0x73, 0x80, 0x07, 0x07, 0x23, 0x33, 0x22, 0x22, 0x25, 0x72,
+  0x22, 0x23, 0x80, 0x0A, 0x05, 0x53, 0x32, 0x22, 0x22, 0x53, 0x72, 0x80, 0x03, 0x0E, 0xA2, 0x52,
+  0x22, 0xD3, 0x37, 0x32, 0x66, 0x25, 0x33, 0x35, 0x66, 0x22, 0x73, 0x72, 0x66, 0x80, 0x08, 0x80,
+  0x00, 0x00, 0x73, 0x80, 0x03, 0x00, 0x2A, 0x80, 0x03, 0x00, 0x62, 0x80, 0x03, 0x00, 0x22, 0x84,
+  0x03, 0x00, 0x52, 0x84, 0x07, 0x03, 0x3E, 0xFF, 0xB3, 0x4F, 0x81, 0x23, 0x0E, 0x33, 0xBB, 0x33,
+  0x3B, 0x34, 0x22, 0xE3, 0x92, 0x34, 0x26, 0xF3, 0xB2, 0x34, 0x26, 0xE3, 0x81, 0x03, 0x80, 0x0B,
+  0x04, 0x27, 0x22, 0xFF, 0x33, 0x93, 0x84, 0x1E, 0x80, 0x2F, 0x01, 0xB3, 0x93, 0x80, 0x03, 0x0A,
+  0xE3, 0x33, 0x62, 0xB3, 0x43, 0x33, 0x62, 0x74, 0x23, 0x33, 0x26, 0x80, 0x82, 0x04, 0x28, 0x88,
+  0x85, 0x41, 0x22, 0x98, 0x00, 0x81, 0xE0, 0x03, 0x27, 0x63, 0x11, 0x11, 0x80, 0x0A, 0x00, 0x76,
+  0x88, 0x16, 0x09, 0x6A, 0x22, 0x22, 0x26, 0xAA, 0x22, 0x22, 0x2A, 0xAA, 0x19, 0x80, 0x21, 0x05,
+  0x14, 0x22, 0xA1, 0x11, 0x58, 0x24, 0x80, 0x23, 0x80, 0x03, 0x01, 0x54, 0x41, 0x81, 0x31, 0x8A,
+  0x00, 0x00, 0x1A, 0x81, 0x03, 0x02, 0xC4, 0x41, 0xAA, 0x80, 0x2F, 0x01, 0x88, 0x88, 0x85, 0x40,
+  0x00, 0x82, 0x80, 0x03, 0x07, 0x18, 0x25, 0x44, 0x44, 0x22, 0x22, 0xD5, 0x55, 0x89, 0x6F, 0x03,
+  0x24, 0x11, 0x14, 0x52, 0x81, 0x74, 0x00, 0x22, 0x80, 0x47, 0x00, 0x44, 0x80, 0x07, 0x03, 0x77,
+  0x77, 0x55, 0x55, 0x82, 0xC0, 0x88, 0x00, 0x00, 0xB3, 0x80, 0x03, 0x00, 0x8B, 0x80, 0x03, 0x00,
+  0x88, 0x80, 0x08, 0x01, 0xF2, 0x22, 0x80, 0x08, 0x00, 0xB9, 0x8D, 0x21, 0x81, 0x00, 0x00, 0x3E,
+  0x80, 0x19, 0x04, 0xE2, 0x22, 0x33, 0x34, 0x22, 0x80, 0x03, 0x0D, 0x2F, 0xB4, 0x33, 0x34, 0x2B,
+  0x39, 0x33, 0x34, 0xE3, 0x3F, 0x33, 0x39, 0xE3, 0x42, 0x80, 0x1A, 0x04, 0x22, 0x4E, 0xE7, 0x22,
+  0x62, 0x80, 0xC3, 0x0E, 0x66, 0x2F, 0xE2, 0x22, 0x23, 0x2E, 0x39, 0x22, 0x23, 0x24, 0x33, 0x42,
+  0x2B, 0x62, 0xE3, 0x80, 0x2C, 0x09, 0x2B, 0x39, 0x22, 0x66, 0x22, 0xF2, 0x66, 0x66, 0x66, 0x22,
+  0x80, 0x03, 0x01, 0x66, 0x66, 0x85, 0x4D, 0x81, 0x62, 0x81, 0x6A, 0x05, 0x22, 0xF3, 0x33, 0x33,
+  0x66, 0x2B, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x02, 0x22, 0xB3, 0x33, 0x80, 0xB2, 0x00, 0x41,
+  0x80, 0x03, 0x03, 0x11, 0x22, 0x22, 0x25, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x00, 0x21, 0x84,
+  0x07, 0x81, 0x03, 0x00, 0x28, 0x81, 0xFF, 0x81, 0x00, 0x05, 0xA1, 0x11, 0x14, 0x22, 0x85, 0x1A,
+  0x80, 0xF4, 0x01, 0x11, 0x42, 0x80, 0x03, 0x80, 0x19, 0x80, 0x13, 0x00, 0x1C, 0x85, 0x1C, 0x81,
+  0x00, 0x02, 0x44, 0x44, 0x41, 0x84, 0x3B, 0x83, 0x03, 0x01, 0x44, 0x4C, 0x89, 0x1D, 0x80, 0x00,
+  0x07, 0xC4, 0x41, 0xA1, 0x18, 0x22, 0x22, 0x88, 0xC2, 0x80, 0x6C, 0x00, 0x14, 0x81, 0x70, 0x81,
+  0x4B, 0x06, 0x18, 0x24, 0x44, 0x1A, 0x22, 0x22, 0xD5, 0x80, 0x03, 0x00, 0x22, 0x81, 0x03, 0x00,
+  0x88, 0x80, 0x03, 0x80, 0x76, 0x80, 0x1E, 0x81, 0x61, 0x00, 0x41, 0x80, 0x53, 0x05, 0x11, 0x11,
+  0x99, 0x99, 0x99, 0x21, 0x80, 0xB6, 0x00, 0x3E, 0x84, 0xC6, 0x0F, 0x37, 0x93, 0x33, 0x33, 0x51,
+  0xAA, 0x73, 0x33, 0x11, 0xAA, 0xA7, 0x39, 0x11, 0xAA, 0xAA, 0x77, 0x80, 0x58, 0x0E, 0x1D, 0x51,
+  0x85, 0x11, 0x88, 0x11, 0x33, 0x97, 0x71, 0x11, 0x93, 0x33, 0x91, 0x1D, 0x13, 0x80, 0x24, 0x81,
+  0x03, 0x00, 0x53, 0x80, 0x33, 0x0E, 0xD3, 0x33, 0x33, 0xE2, 0x15, 0x33, 0x34, 0x22, 0x13, 0x33,
+  0x34, 0x2F, 0xD3, 0x33, 0x34, 0x80, 0xF5, 0x01, 0x34, 0xE3, 0x80, 0x16, 0x81, 0x03, 0x03, 0x22,
+  0x22, 0xFE, 0xE7, 0x81, 0x6D, 0x1D, 0x26, 0x26, 0x2F, 0xE2, 0x22, 0xB4, 0x2E, 0x39, 0x22, 0x39,
+  0x24, 0x33, 0x42, 0x3F, 0x22, 0xE3, 0x34, 0x42, 0x22, 0x2B, 0x39, 0x22, 0x66, 0x62, 0xF2, 0x26,
+  0x66, 0x62, 0x62, 0x66, 0x80, 0x00, 0x09, 0x23, 0x33, 0x71, 0x11, 0x23, 0x33, 0x81, 0x11, 0x2B,
+  0x97, 0x80, 0x93, 0x00, 0x28, 0x83, 0x03, 0x00, 0x66, 0x88, 0x03, 0x80, 0x00, 0x09, 0x87, 0x18,
+  0x88, 0x88, 0x15, 0x57, 0x77, 0x77, 0x77, 0xD7, 0x80, 0x03, 0x00, 0x1D, 0x80, 0x03, 0x00, 0x18,
+  0x84, 0x07, 0x00, 0x87, 0x80, 0x03, 0x05, 0x77, 0x51, 0x11, 0x11, 0x77, 0x78, 0x80, 0x03, 0x80,
+  0x08, 0x80, 0x0D, 0x85, 0x03, 0x00, 0x81, 0x80, 0x03, 0x00, 0x78, 0x80, 0x03, 0x00, 0x7D, 0x82,
+  0x41, 0x8B, 0x00, 0x00, 0x57, 0x80, 0x02, 0x02, 0x77, 0x11, 0x8D, 0x83, 0x47, 0x02, 0x11, 0x11,
+  0x18, 0x80, 0x03, 0x80, 0x0F, 0x02, 0x57, 0x77, 0x7D, 0x80, 0x12, 0x00, 0xD8, 0x81, 0x51, 0x81,
+  0x37, 0x81, 0x5A, 0x81, 0x00, 0x80, 0x5A, 0x01, 0x11, 0xD1, 0x8C, 0x40, 0x00, 0x81, 0x80, 0x03,
+  0x00, 0x71, 0x80, 0x03, 0x00, 0x75, 0x80, 0x03, 0x00, 0x17, 0x80, 0xF4, 0x00, 0x18, 0x80, 0x03,
+  0x01, 0x11, 0x93, 0x80, 0x03, 0x00, 0xD3, 0x80, 0x03, 0x04, 0x53, 0x33, 0x3E, 0x11, 0x83, 0x80,
+  0x03, 0x26, 0x82, 0xFE, 0xE7, 0x11, 0x16, 0x22, 0x22, 0x25, 0x11, 0xDF, 0xE7, 0x27, 0x55, 0x2E,
+  0x39, 0x2B, 0x39, 0x24, 0x33, 0xE3, 0x34, 0x28, 0x18, 0xE3, 0x42, 0x21, 0x11, 0x22, 0x26, 0x25,
+  0x11, 0x26, 0x22, 0x66, 0x25, 0x26, 0x26, 0x66, 0x22, 0x80, 0xBE, 0x01, 0x11, 0x61, 0x80, 0x03,
+  0x00, 0x45, 0x80, 0x03, 0x00, 0x74, 0x81, 0x58, 0x81, 0x10, 0x0E, 0x88, 0x11, 0x88, 0x88, 0xD2,
+  0xD2, 0x24, 0x22, 0x26, 0x28, 0x15, 0x11, 0x1E, 0x33, 0x33, 0x86, 0x03, 0x80, 0x6C, 0x80, 0x02,
+  0x01, 0x33, 0x93, 0x80, 0x03, 0x81, 0x00, 0x00, 0xA3, 0x80, 0x03, 0x04, 0x22, 0x41, 0x11, 0x11,
+  0x22, 0x80, 0x32, 0x0C, 0x25, 0x11, 0x11, 0x14, 0x24, 0x11, 0x1A, 0x82, 0x21, 0x11, 0x11, 0x42,
+  0x24, 0x80, 0x0F, 0x81, 0x03, 0x80, 0x13, 0x86, 0x00, 0x04, 0x22, 0x85, 0x44, 0x44, 0x22, 0x88,
+  0x00, 0x03, 0x11, 0x11, 0x44, 0x4C, 0x89, 0xD3, 0x80, 0x46, 0x07, 0xC4, 0x21, 0x11, 0x18, 0x22,
+  0x21, 0x11, 0xC2, 0x80, 0x03, 0x00, 0x14, 0x81, 0x52, 0x00, 0x82, 0x80, 0x03, 0x03, 0x18, 0x11,
+  0x11, 0x1A, 0x80, 0x0B, 0x08, 0x1A, 0x22, 0x41, 0xAA, 0xAA, 0x22, 0x22, 0x88, 0x88, 0x81, 0x3A,
+  0x00, 0x24, 0x85, 0x43, 0x01, 0x25, 0x44, 0x80, 0x53, 0x02, 0xD5, 0x55, 0x55, 0x8A, 0x57, 0x01,
+  0x14, 0x52, 0x81, 0x3B, 0x00, 0x42, 0x80, 0x4F, 0x00, 0x14, 0x81, 0x57, 0x03, 0x77, 0x55, 0x55,
+  0xD2, 0x84, 0xAE, 0x8E, 0x00, 0x00, 0xB3, 0x81, 0xBF, 0x80, 0x03, 0x00, 0xB9, 0x91, 0x1C, 0x2B,
+  0x3E, 0x22, 0xFE, 0x33, 0xE2, 0x22, 0x66, 0x34, 0x22, 0x22, 0x2F, 0x34, 0x2F, 0xB4, 0x2E, 0x34,
+  0x2B, 0x39, 0x2F, 0x34, 0xE3, 0x3F, 0x22, 0x3E, 0xE3, 0x42, 0x22, 0x3E, 0x22, 0x22, 0x66, 0xE7,
+  0x22, 0x26, 0x66, 0x22, 0x62, 0x66, 0x66, 0xE2, 0x26, 0x23, 0x33, 0x39, 0x80, 0x03, 0x04, 0x33,
+  0x42, 0x2B, 0xB9, 0xE3, 0x80, 0x2C, 0x09, 0x2B, 0x39, 0x66, 0x62, 0x22, 0xF2, 0x66, 0x66, 0x22,
+  0x66, 0x83, 0x00, 0x8D, 0x56, 0x00, 0xF3, 0x80, 0x03, 0x00, 0x2B, 0x80, 0x03, 0x00, 0x24, 0x81,
+  0x7B, 0x80, 0x80, 0x03, 0x22, 0x22, 0x41, 0x11, 0x80, 0xB5, 0x02, 0x11, 0x22, 0x25, 0x80, 0x03,
+  0x00, 0x24, 0x80, 0xE8, 0x00, 0x21, 0x82, 0x07, 0x83, 0x03, 0x00, 0x28, 0x81, 0xC1, 0x81, 0x00,
+  0x06, 0xA1, 0x11, 0x14, 0x22, 0x85, 0x44, 0x82, 0x80, 0xDF, 0x00, 0x42, 0x80, 0x03, 0x00, 0x1C,
+  0x81, 0xE7, 0x02, 0x11, 0x1C, 0x44, 0x82, 0x1A, 0x00, 0x12, 0x81, 0xF3, 0x80, 0x03, 0x80, 0x14,
+  0x80, 0x3D, 0x87, 0x03, 0x81, 0x0F, 0x08, 0x18, 0x22, 0x22, 0x33, 0x3E, 0x26, 0x66, 0x33, 0x32,
+  0x80, 0x03, 0x03, 0x72, 0x26, 0x66, 0x39, 0x80, 0x94, 0x80, 0x03, 0x00, 0x27, 0x80, 0x12, 0x08,
+  0x29, 0x34, 0x26, 0x66, 0x2B, 0x37, 0x26, 0x66, 0x23, 0x80, 0xCA, 0x83, 0x00, 0x80, 0x07, 0x07,
+  0x2F, 0xEE, 0xF2, 0x66, 0xB3, 0x33, 0x34, 0x22, 0x80, 0x9A, 0x00, 0x72, 0x80, 0x03, 0x00, 0x46,
+  0x81, 0x03, 0x80, 0x18, 0x80, 0x19, 0x06, 0xF9, 0xBB, 0x66, 0x2F, 0x33, 0x33, 0x66, 0x80, 0xBC,
+  0x01, 0x62, 0xE3, 0x80, 0x03, 0x80, 0xB7, 0x01, 0x62, 0x43, 0x80, 0x0F, 0x00, 0x29, 0x80, 0x07,
+  0x80, 0x10, 0x01, 0xBE, 0x26, 0x80, 0x0C, 0x04, 0x42, 0x23, 0x33, 0x33, 0x32, 0x84, 0x03, 0x00,
+  0x36, 0x85, 0x0B, 0x00, 0x43, 0x80, 0xDF, 0x00, 0x22, 0x80, 0xDF, 0x01, 0x22, 0x41, 0x80, 0x03,
+  0x00, 0x51, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x86, 0x00, 0x85, 0xE1,
+  0x89, 0x00, 0x00, 0x41, 0x80, 0x03, 0x02, 0x25, 0x41, 0xA1, 0x80, 0x37, 0x08, 0x85, 0x41, 0xAA,
+  0xAA, 0xA8, 0x11, 0xAA, 0xAA, 0xA1, 0x80, 0x03, 0x05, 0x81, 0x1D, 0xAA, 0xA5, 0x11, 0x13, 0x80,
+  0x0E, 0x0F, 0x53, 0xAA, 0x51, 0x11, 0x33, 0xAA, 0x81, 0x15, 0x33, 0xA8, 0x11, 0x19, 0x33, 0x73,
+  0x33, 0x3E, 0x80, 0xAF, 0x00, 0x32, 0x80, 0x03, 0x02, 0x72, 0x22, 0x33, 0x80, 0xDC, 0x82, 0x03,
+  0x81, 0xF3, 0x80, 0xE0, 0x00, 0x33, 0x80, 0xE0, 0x01, 0x66, 0x66, 0x81, 0x03, 0x80, 0x00, 0x00,
+  0x62, 0x80, 0x08, 0x80, 0xE0, 0x00, 0x27, 0x80, 0xE0, 0x80, 0xB6, 0x01, 0x33, 0x2B, 0x80, 0x03,
+  0x80, 0xA1, 0x00, 0x33, 0x84, 0x20, 0x00, 0xFE, 0x80, 0xFD, 0x03, 0x33, 0x66, 0x62, 0xF3, 0x80,
+  0x0F, 0x08, 0xE3, 0x33, 0x72, 0x66, 0xB3, 0x33, 0x42, 0x66, 0x43, 0x80, 0xFC, 0x0B, 0x29, 0x33,
+  0x22, 0x28, 0x11, 0x11, 0xBB, 0xB7, 0x11, 0x11, 0x33, 0x33, 0x81, 0x03, 0x80, 0x78, 0x01, 0x33,
+  0x71, 0x80, 0x03, 0x00, 0x31, 0x80, 0x03, 0x00, 0x38, 0x80, 0x03, 0x05, 0x36, 0x11, 0x87, 0x77,
+  0x77, 0x77, 0x85, 0x03, 0x00, 0x17, 0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x00, 0x11, 0x81, 0x03,
+  0x80, 0x10, 0x00, 0x11, 0x80, 0x0C, 0x00, 0x99, 0x9C, 0x00, 0x00, 0x81, 0x80, 0xEB, 0x00, 0x51,
+  0x80, 0x03, 0x00, 0x71, 0x80, 0x03, 0x09, 0x78, 0x11, 0x11, 0x18, 0x7D, 0x11, 0x11, 0x57, 0x77,
+  0x81, 0x80, 0x3D, 0x02, 0x51, 0x11, 0x18, 0x80, 0x03, 0x00, 0x11, 0x81, 0x53, 0x81, 0x03, 0x00,
+  0x1D, 0x80, 0x03, 0x00, 0xD7, 0x80, 0x03, 0x85, 0x00, 0x00, 0x55, 0x80, 0x03, 0x00, 0x18, 0x81,
+  0x08, 0x80, 0x37, 0x81, 0x27, 0x01, 0x77, 0xD1, 0x80, 0x03, 0x80, 0x40, 0x8D, 0x03, 0x03, 0x11,
+  0x16, 0x26, 0x22, 0x80, 0x03, 0x0E, 0x62, 0x11, 0x1D, 0x22, 0x22, 0x11, 0x1D, 0x2F, 0x9E, 0x11,
+  0x12, 0xB3, 0x33, 0x11, 0x1E, 0x80, 0xCD, 0x00, 0x1B, 0x80, 0x03, 0x00, 0x13, 0x80, 0xFF, 0x00,
+  0x22, 0x80, 0x01, 0x12, 0x62, 0x66, 0x26, 0x22, 0x62, 0x66, 0x2F, 0xF2, 0x62, 0x66, 0xF3, 0x34,
+  0x22, 0x66, 0xE3, 0x33, 0x72, 0x66, 0xB3, 0x80, 0xFC, 0x00, 0x43, 0x80, 0x03, 0x07, 0x29, 0x22,
+  0x26, 0x61, 0x11, 0xF9, 0xBB, 0xB8, 0x80, 0xEB, 0x00, 0x33, 0x81, 0x03, 0x00, 0xD1, 0x80, 0x03,
+  0x00, 0xE1, 0x80, 0x03, 0x00, 0x71, 0x80, 0x03, 0x00, 0x51, 0x81, 0x0F, 0x00, 0x73, 0x80, 0x04,
+  0x00, 0x89, 0x80, 0x03, 0x00, 0x1D, 0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x00, 0x18, 0x81, 0x28,
+  0x00, 0x93, 0x80, 0x03, 0x00, 0x53, 0x80, 0x03, 0x08, 0x83, 0x33, 0x33, 0x22, 0x1A, 0x11, 0x11,
+  0x22, 0x41, 0x80, 0x03, 0x80, 0xA3, 0x01, 0x22, 0x21, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x80,
+  0x10, 0x04, 0x22, 0x22, 0x25, 0x41, 0x22, 0x80, 0x00, 0x80, 0xA1, 0x92, 0x00, 0x00, 0xA1, 0x80,
+  0x03, 0x00, 0x85, 0x80, 0x37, 0x00, 0x18, 0x80, 0x23, 0x00, 0x14, 0x80, 0x03, 0x00, 0x1C, 0x80,
+  0x03, 0x00, 0x1A, 0x80, 0x34, 0x85, 0x03, 0x80, 0x0F, 0x00, 0x2B, 0x80, 0x1B, 0x09, 0x2E, 0x3E,
+  0x22, 0x22, 0x62, 0x32, 0x26, 0x66, 0x62, 0x72, 0x80, 0xC7, 0x15, 0x22, 0x66, 0x66, 0x2F, 0x22,
+  0x62, 0x67, 0xB3, 0x26, 0x62, 0x2E, 0x33, 0x22, 0x62, 0x2B, 0x33, 0x62, 0x62, 0x23, 0x33, 0x62,
+  0x66, 0x83, 0x00, 0x0C, 0x22, 0x26, 0x66, 0x66, 0xEE, 0xF2, 0x66, 0x62, 0x33, 0x34, 0x26, 0x66,
+  0x33, 0x80, 0xE0, 0x03, 0x33, 0x33, 0x42, 0x62, 0x80, 0x03, 0x02, 0x66, 0x66, 0x62, 0x80, 0x36,
+  0x03, 0xFE, 0xBB, 0xBE, 0x6F, 0x80, 0xB7, 0x00, 0xF3, 0x80, 0x03, 0x00, 0xE3, 0x80, 0x03, 0x00,
+  0xB3, 0x80, 0x03, 0x00, 0x43, 0x80, 0x03, 0x00, 0x29, 0x80, 0x03, 0x00, 0x22, 0x80, 0x10, 0x00,
+  0x22, 0x80, 0x0C, 0x00, 0x46, 0x80, 0xE8, 0x01, 0x32, 0x23, 0x8C, 0x03, 0x80, 0x30, 0x81, 0xC1,
+  0x83, 0xCF, 0x00, 0x51, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x00, 0x22,
+  0x81, 0xDB, 0x00, 0x25, 0x99, 0xDF, 0x00, 0x41, 0x80, 0xE0, 0x00, 0x22, 0x81, 0xE0, 0x80, 0x00,
+  0x00, 0x4C, 0x80, 0x03, 0x03, 0x22, 0x22, 0x85, 0x54, 0x81, 0x2F, 0x84, 0x00, 0x80, 0x3B, 0x05,
+  0x25, 0x67, 0x22, 0x22, 0x26, 0x77, 0x84, 0x2E, 0x03, 0x1C, 0x44, 0x44, 0x44, 0x86, 0x1C, 0x07,
+  0xB9, 0x95, 0x55, 0x22, 0x33, 0x33, 0x77, 0x7F, 0x80, 0x9E, 0x04, 0x33, 0x11, 0x82, 0x22, 0x22,
+  0x80, 0x02, 0x8E, 0x00, 0x00, 0x52, 0x80, 0x03, 0x00, 0x75, 0x80, 0x03, 0x03, 0x37, 0x26, 0x66,
+  0x23, 0x80, 0xF2, 0x08, 0x24, 0x39, 0x26, 0x66, 0x22, 0x33, 0x22, 0x66, 0x66, 0x81, 0xF2, 0x01,
+  0x33, 0xB2, 0x80, 0x03, 0x01, 0x39, 0x22, 0x80, 0xFF, 0x01, 0xB4, 0x72, 0x80, 0x42, 0x00, 0x42,
+  0x80, 0x03, 0x08, 0x46, 0x43, 0x33, 0x39, 0x26, 0x2F, 0x4E, 0x42, 0x66, 0x80, 0x32, 0x00, 0x66,
+  0x81, 0x00, 0x80, 0x05, 0x00, 0x26, 0x80, 0x0B, 0x08, 0x74, 0x66, 0x22, 0x93, 0x33, 0x66, 0x22,
+  0x2F, 0x99, 0x86, 0x18, 0x80, 0x08, 0x08, 0x66, 0x66, 0x2F, 0xE3, 0x22, 0xFE, 0x33, 0x33, 0x93,
+  0x81, 0x80, 0x08, 0x52, 0xA3, 0x33, 0x79, 0x25, 0x33, 0x33, 0x22, 0x2A, 0x80, 0x03, 0x0A, 0x73,
+  0x33, 0x3B, 0x53, 0x33, 0x3B, 0x44, 0x33, 0x33, 0x44, 0x44, 0x80, 0x06, 0x02, 0x44, 0x33, 0x74,
+  0x80, 0x03, 0x83, 0x00, 0x02, 0x77, 0x33, 0xB4, 0x80, 0xC1, 0x90, 0x00, 0x81, 0xAB, 0x80, 0xE8,
+  0x04, 0x22, 0x11, 0x13, 0x62, 0x22, 0x80, 0xE7, 0x00, 0x16, 0x84, 0xEF, 0x86, 0x00, 0x03, 0x73,
+  0x33, 0xAA, 0xAA, 0x85, 0xD3, 0x00, 0x72, 0x81, 0x27, 0x00, 0x32, 0x80, 0x03, 0x80, 0x04, 0x80,
+  0x1A, 0x81, 0x03, 0x00, 0x17, 0x81, 0x23, 0x03, 0x22, 0x44, 0x11, 0xA1, 0x80, 0x1A, 0x00, 0x85,
+  0x89, 0xFF, 0x80, 0x00, 0x00, 0x25, 0x80, 0x03, 0x01, 0x26, 0xAA, 0x84, 0x00, 0x03, 0x97, 0x77,
+  0x77, 0x71, 0x80, 0x87, 0x00, 0xD1, 0x80, 0x03, 0x0D, 0x11, 0x39, 0x97, 0x75, 0x11, 0x2D, 0xDD,
+  0xD1, 0x11, 0xDD, 0xDD, 0x81, 0x18, 0x51, 0x80, 0x61, 0x01, 0x11, 0x1D, 0x80, 0x14, 0x03, 0x53,
+  0x33, 0x33, 0x18, 0x80, 0xD0, 0x00, 0x17, 0x80, 0x20, 0x00, 0x83, 0x80, 0x03, 0x00, 0xD7, 0x80,
+  0x0B, 0x01, 0xDD, 0xD9, 0x80, 0x08, 0x08, 0x37, 0x26, 0x66, 0x33, 0x34, 0x66, 0x66, 0x33, 0x39,
+  0x80, 0x07, 0x00, 0x33, 0x81, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00, 0xB2, 0x80, 0x03, 0x01, 0x39,
+  0x22, 0x80, 0x1D, 0x01, 0xB4, 0x23, 0x80, 0x04, 0x00, 0x2F, 0x80, 0x03, 0x0C, 0x22, 0x43, 0x33,
+  0x39, 0x66, 0x2F, 0x4E, 0x42, 0x66, 0x62, 0x22, 0x22, 0x66, 0x80, 0x00, 0x81, 0x04, 0x07, 0x72,
+  0x62, 0x26, 0x22, 0x46, 0x66, 0x62, 0x93, 0x80, 0x03, 0x04, 0x2F, 0x26, 0x66, 0x66, 0x62, 0x80,
+  0x03, 0x00, 0x66, 0x81, 0x07, 0x80, 0x1D, 0x05, 0x2F, 0x66, 0x22, 0xF9, 0x33, 0x74, 0x80, 0x63,
+  0x1A, 0x33, 0x33, 0x52, 0x21, 0x7A, 0x79, 0x25, 0x39, 0x22, 0x22, 0x2A, 0x33, 0x22, 0x22, 0x73,
+  0x33, 0x22, 0x53, 0x33, 0x3B, 0x73, 0x33, 0x33, 0x44, 0x33, 0x33, 0x3B, 0x80, 0x03, 0x01, 0x74,
+  0x44, 0x81, 0xDF, 0x81, 0x00, 0x00, 0xE1, 0x80, 0x03, 0x00, 0x3C, 0x80, 0x03, 0x01, 0x44, 0xC1,
+  0x80, 0x03, 0x00, 0x41, 0x80, 0x03, 0x80, 0x19, 0x00, 0x44, 0x81, 0x0C, 0x05, 0x11, 0x57, 0x77,
+  0x11, 0x11, 0x1D, 0x80, 0x03, 0x01, 0x11, 0xD7, 0x80, 0x03, 0x00, 0x1D, 0x85, 0x2F, 0x85, 0x00,
+  0x00, 0x77, 0x8C, 0x00, 0x00, 0x57, 0x80, 0x03, 0x03, 0x18, 0xD7, 0x7D, 0x58, 0x86, 0x1F, 0x00,
+  0x71, 0x88, 0x03, 0x03, 0xD1, 0x11, 0x11, 0x75, 0x90, 0x40, 0x01, 0x11, 0xD7, 0x80, 0x03, 0x80,
+  0x38, 0x01, 0x11, 0x87, 0x80, 0x03, 0x00, 0x17, 0x80, 0x03, 0x00, 0x1D, 0x80, 0x03, 0x01, 0x11,
+  0x88, 0x81, 0x6F, 0x8E, 0x5F, 0x88, 0x00, 0x06, 0x7D, 0x18, 0x85, 0x58, 0x11, 0x77, 0x78, 0x84,
+  0x5B, 0x00, 0x51, 0x80, 0x03, 0x80, 0x2F, 0x81, 0x5F, 0x80, 0x66, 0x85, 0x00, 0x06, 0x17, 0x11,
+  0x83, 0x33, 0x33, 0x11, 0x5F, 0x80, 0x03, 0x23, 0x22, 0xF3, 0x33, 0x18, 0x26, 0x2F, 0x4E, 0x1D,
+  0x26, 0x26, 0x22, 0x82, 0x26, 0x66, 0x66, 0x22, 0x62, 0x66, 0x66, 0xB4, 0x72, 0x22, 0x26, 0x33,
+  0x42, 0x22, 0x22, 0x33, 0x46, 0x22, 0x22, 0x39, 0x26, 0x22, 0x22, 0x42, 0x81, 0x17, 0x80, 0x03,
+  0x83, 0x00, 0x1C, 0x22, 0xFE, 0x22, 0x74, 0x93, 0x33, 0x93, 0x33, 0x33, 0x21, 0x24, 0x9B, 0x97,
+  0x61, 0x22, 0x22, 0x22, 0x28, 0x66, 0x22, 0x22, 0x9D, 0x22, 0x62, 0x43, 0x33, 0x2F, 0xE3, 0x33,
+  0x81, 0x00, 0x00, 0x39, 0x80, 0x03, 0x02, 0x9A, 0x11, 0x13, 0x80, 0x5B, 0x00, 0x19, 0x80, 0x03,
+  0x0B, 0x1C, 0x33, 0xB4, 0x11, 0x11, 0x44, 0x44, 0x11, 0x11, 0xC4, 0x44, 0xC1, 0x84, 0x03, 0x00,
+  0x41, 0x80, 0x03, 0x80, 0x37, 0x04, 0x22, 0x22, 0x76, 0x67, 0x22, 0x80, 0x8B, 0x00, 0x13, 0x8D,
+  0xFA, 0x81, 0x00, 0x03, 0x22, 0x22, 0x73, 0x33, 0x81, 0x22, 0x00, 0x62, 0x80, 0x03, 0x02, 0x11,
+  0x16, 0x72, 0x81, 0x27, 0x00, 0x32, 0x89, 0x1F, 0x00, 0xAA, 0x80, 0x00, 0x80, 0x1A, 0x82, 0x23,
+  0x85, 0x00, 0x00, 0x32, 0x81, 0x2B, 0x81, 0x03, 0x00, 0x17, 0x80, 0x03, 0x85, 0x47, 0x01, 0x85,
+  0x54, 0x83, 0x6B, 0x82, 0x00, 0x05, 0x25, 0xB9, 0x22, 0x25, 0x67, 0x73, 0x80, 0xDD, 0x00, 0x33,
+  0x83, 0x1D, 0x02, 0x1C, 0x82, 0x44, 0x88, 0x1D, 0x0F, 0x9B, 0x55, 0x22, 0x22, 0x37, 0x73, 0x7F,
+  0x52, 0x33, 0x33, 0x77, 0x75, 0x72, 0x22, 0x22, 0x29, 0x80, 0x12, 0x00, 0x2D, 0x80, 0x03, 0x00,
+  0x26, 0x89, 0x63, 0x85, 0x00, 0x07, 0x62, 0x62, 0x23, 0x33, 0x62, 0x62, 0x2F, 0x33, 0x80, 0x08,
+  0x24, 0x43, 0x26, 0x62, 0x66, 0x2F, 0x42, 0x62, 0x66, 0x22, 0xB2, 0x66, 0x66, 0x66, 0x39, 0x26,
+  0x22, 0x66, 0x33, 0xB4, 0x72, 0x22, 0x33, 0x33, 0x46, 0x66, 0x33, 0x33, 0x42, 0x66, 0x33, 0x39,
+  0x22, 0x66, 0x4E, 0x42, 0x22, 0x66, 0x80, 0x32, 0x80, 0x1D, 0x82, 0x00, 0x80, 0x50, 0x0D, 0x74,
+  0x93, 0x22, 0x93, 0x33, 0x33, 0x22, 0x24, 0x99, 0x97, 0x66, 0x62, 0x22, 0x26, 0x81, 0x13, 0x09,
+  0x66, 0x26, 0x62, 0x43, 0x22, 0x2F, 0xE3, 0x33, 0xF9, 0x33, 0x83, 0x00, 0x04, 0x52, 0xA3, 0x33,
+  0x33, 0x25, 0x80, 0x07, 0x00, 0x2A, 0x80, 0x03, 0x03, 0x73, 0x33, 0x3B, 0x44, 0x80, 0x02, 0x04,
+  0x44, 0x33, 0x44, 0x44, 0x44, 0x80, 0x06, 0x01, 0x44, 0x74, 0x80, 0x03, 0x83, 0x85, 0x02, 0x66,
+  0x67, 0x31, 0x85, 0xE8, 0x8C, 0x00, 0x80, 0x1C, 0x00, 0x73, 0x81, 0x21, 0x07, 0x13, 0x62, 0x22,
+  0x22, 0x11, 0x11, 0x16, 0x72, 0x8F, 0x1F, 0x13, 0x9F, 0x97, 0x22, 0x2B, 0x92, 0x29, 0x22, 0x27,
+  0xB2, 0x26, 0x22, 0xB7, 0xB2, 0xD6, 0x22, 0xB7, 0x76, 0x77, 0x22, 0x56, 0x80, 0x93, 0x27, 0x2B,
+  0x7B, 0x93, 0x82, 0x25, 0x72, 0x27, 0x73, 0x36, 0x67, 0x33, 0x76, 0x52, 0x57, 0x33, 0x75, 0x22,
+  0x27, 0x33, 0x3D, 0x22, 0x26, 0x7F, 0x7B, 0x2D, 0x9F, 0x92, 0x77, 0x77, 0x52, 0x22, 0x37, 0x37,
+  0xD2, 0x22, 0x75, 0xB7, 0x22, 0x22, 0xE9, 0x80, 0x97, 0x00, 0xE7, 0x80, 0x03, 0x80, 0xC6, 0x02,
+  0x3A, 0x33, 0x33, 0x80, 0xEF, 0x03, 0x72, 0x22, 0x22, 0x3A, 0x80, 0xE2, 0x00, 0x32, 0x80, 0x03,
+  0x00, 0x52, 0x80, 0x03, 0x84, 0xC6, 0x04, 0x33, 0x77, 0x77, 0x77, 0x7A, 0x80, 0x86, 0x00, 0x62,
+  0x80, 0xE1, 0x82, 0x00, 0x09, 0x26, 0x22, 0x26, 0x25, 0x65, 0x33, 0x22, 0xF3, 0x77, 0x77, 0x85,
+  0x21, 0x80, 0x73, 0x02, 0x22, 0x25, 0xA3, 0x80, 0x23, 0x00, 0x25, 0x80, 0x1E, 0x05, 0x62, 0x72,
+  0x22, 0x66, 0x62, 0x37, 0x88, 0x3F, 0x89, 0x00, 0x00, 0x27, 0x80, 0x03, 0x05, 0x62, 0x53, 0x33,
+  0x33, 0x66, 0x25, 0x80, 0x33, 0x03, 0x11, 0x32, 0x72, 0x23, 0x80, 0xC5, 0x00, 0x21, 0x80, 0x03,
+  0x00, 0x61, 0x80, 0x03, 0x00, 0x31, 0x80, 0x03, 0x02, 0x91, 0x11, 0x72, 0x80, 0x03, 0x00, 0x32,
+  0x80, 0x03, 0x02, 0x13, 0x22, 0x23, 0x81, 0xE3, 0x00, 0x71, 0x81, 0xE7, 0x81, 0x1D, 0x00, 0x27,
+  0x80, 0x03, 0x01, 0x22, 0x23, 0x80, 0x03, 0x86, 0x00, 0x80, 0x1E, 0x8E, 0x00, 0x80, 0x2E, 0x07,
+  0x1B, 0x22, 0x11, 0x16, 0x72, 0x22, 0x11, 0xB2, 0x8D, 0x1F, 0x05, 0xB1, 0x11, 0x1B, 0x32, 0x23,
+  0x37, 0x89, 0x40, 0x0D, 0x22, 0x22, 0x9F, 0x42, 0x22, 0x2B, 0x92, 0x12, 0x22, 0x27, 0xB2, 0x14,
+  0x22, 0x57, 0x80, 0x03, 0x33, 0xB7, 0x76, 0x11, 0x22, 0x56, 0x77, 0x51, 0x22, 0x2B, 0x7B, 0x21,
+  0x82, 0x25, 0x76, 0x7D, 0xDD, 0x11, 0x1D, 0x37, 0xD8, 0x11, 0x5D, 0x32, 0xD1, 0x11, 0x9D, 0xB2,
+  0x81, 0x1D, 0x32, 0xD5, 0x11, 0x19, 0x77, 0xD1, 0x11, 0x5D, 0x93, 0x81, 0x18, 0xDD, 0xB3, 0x11,
+  0x19, 0x42, 0x33, 0x33, 0x39, 0x22, 0x22, 0x77, 0x35, 0x80, 0x03, 0x10, 0x62, 0x22, 0x22, 0x76,
+  0x22, 0x22, 0x5E, 0x92, 0x22, 0x5E, 0xEE, 0x22, 0x2D, 0xEE, 0xEE, 0x22, 0x2E, 0x80, 0x03, 0x02,
+  0xBE, 0xEE, 0xEE, 0x85, 0xF3, 0x03, 0x3A, 0x77, 0x77, 0x77, 0x81, 0x6C, 0x00, 0x66, 0x81, 0x03,
+  0x80, 0x04, 0x80, 0x03, 0x07, 0x66, 0x66, 0x25, 0x3A, 0x22, 0x33, 0x77, 0x77, 0x82, 0x1F, 0x03,
+  0x7A, 0xAA, 0xA3, 0x33, 0x80, 0x42, 0x03, 0x25, 0x66, 0x66, 0x62, 0x83, 0x1A, 0x06, 0x52, 0x26,
+  0x66, 0xF3, 0x37, 0x22, 0x66, 0x85, 0x3F, 0x81, 0x00, 0x00, 0xA3, 0x80, 0x03, 0x00, 0x25, 0x80,
+  0x03, 0x07, 0x66, 0x27, 0x33, 0x33, 0x22, 0x22, 0x53, 0x33, 0x80, 0x25, 0x80, 0x07, 0x07, 0x11,
+  0x32, 0x22, 0x23, 0x11, 0x22, 0x22, 0x21, 0x80, 0x03, 0x00, 0x61, 0x80, 0x03, 0x00, 0x31, 0x82,
+  0x03, 0x02, 0x72, 0x22, 0x91, 0x80, 0x17, 0x0A, 0x91, 0x11, 0x13, 0x72, 0x23, 0x1E, 0x44, 0x22,
+  0x22, 0x71, 0x1E, 0x80, 0x76, 0x00, 0x61, 0x80, 0x03, 0x00, 0x27, 0x8B, 0xFA, 0x80, 0x3D, 0x84,
+  0x00, 0x00, 0xA8, 0x80, 0x03, 0x09, 0xAA, 0xD1, 0x11, 0x11, 0x39, 0xA1, 0x11, 0x11, 0x33, 0x91,
+  0x80, 0x03, 0x80, 0x0B, 0x01, 0x33, 0x81, 0x85, 0x1D, 0x8A, 0x00, 0x0C, 0x88, 0x77, 0x77, 0x99,
+  0x22, 0x73, 0x33, 0x32, 0x22, 0xD3, 0x33, 0x42, 0xCC, 0x80, 0x0F, 0x10, 0x73, 0x11, 0x11, 0x89,
+  0x33, 0x11, 0x15, 0x49, 0x44, 0x18, 0xC2, 0x22, 0x22, 0x52, 0x22, 0xCC, 0xCC, 0x80, 0x02, 0x03,
+  0xCC, 0xC2, 0xCC, 0xC2, 0x80, 0x06, 0x02, 0xC4, 0x3B, 0x33, 0x84, 0xE0, 0x01, 0x55, 0x7A, 0x81,
+  0xB3, 0x81, 0xF7, 0x83, 0x00, 0x06, 0x26, 0x25, 0x72, 0x26, 0x22, 0xF3, 0x37, 0x8A, 0xDF, 0x00,
+  0x25, 0x80, 0xE0, 0x00, 0x22, 0x80, 0x04, 0x02, 0x66, 0x62, 0x27, 0x80, 0xDB, 0x01, 0x22, 0x53,
+  0x80, 0x26, 0x81, 0xEE, 0x03, 0x44, 0x33, 0x33, 0x3B, 0x80, 0x03, 0x00, 0x34, 0x80, 0x03, 0x00,
+  0x74, 0x80, 0x03, 0x00, 0xB4, 0x8A, 0x03, 0x12, 0x98, 0x11, 0x59, 0xAA, 0x3D, 0x11, 0x13, 0x3A,
+  0x39, 0x11, 0x17, 0x33, 0x33, 0x81, 0x15, 0x33, 0x33, 0x51, 0x18, 0x80, 0x03, 0x09, 0x11, 0x93,
+  0x93, 0xD1, 0x11, 0x73, 0xA9, 0x91, 0x11, 0x53, 0x85, 0xB4, 0x00, 0x61, 0x80, 0x03, 0x00, 0x27,
+  0x80, 0x03, 0x01, 0x22, 0x23, 0x80, 0x03, 0x01, 0x22, 0x71, 0x80, 0x03, 0x00, 0x22, 0x82, 0x03,
+  0x92, 0x00, 0x07, 0x1B, 0x37, 0x22, 0x16, 0x72, 0x22, 0x22, 0xB2, 0x82, 0x20, 0x81, 0x03, 0x00,
+  0x32, 0x80, 0x03, 0x07, 0x12, 0x22, 0x11, 0xB1, 0x13, 0x22, 0x32, 0x23, 0x85, 0x3A, 0x00, 0x61,
+  0x80, 0x03, 0x41, 0x21, 0x72, 0x22, 0x9F, 0x96, 0x33, 0x2B, 0x92, 0x29, 0x36, 0x27, 0xB2, 0x26,
+  0x75, 0x57, 0xB2, 0xD6, 0x32, 0xB7, 0x76, 0x73, 0x35, 0x56, 0x77, 0x73, 0x37, 0x2B, 0x7B, 0x93,
+  0x73, 0x25, 0x72, 0x27, 0x75, 0x76, 0x73, 0x33, 0x39, 0x52, 0x57, 0x33, 0x35, 0x22, 0x27, 0x33,
+  0xF2, 0x22, 0x26, 0x7F, 0x22, 0x2D, 0x9F, 0x92, 0x22, 0x77, 0x52, 0x22, 0x2D, 0x33, 0xD2, 0x22,
+  0x2E, 0xB7, 0x22, 0x22, 0xBE, 0x87, 0xFD, 0x02, 0x3A, 0x77, 0x33, 0x80, 0x73, 0x04, 0x72, 0x26,
+  0x26, 0x66, 0x22, 0x80, 0xF8, 0x00, 0x26, 0x82, 0x02, 0x82, 0xFF, 0x00, 0x77, 0x81, 0x1D, 0x03,
+  0x55, 0x55, 0x7A, 0xAA, 0x80, 0x70, 0x81, 0x00, 0x80, 0x16, 0x09, 0x66, 0x66, 0x22, 0x62, 0x27,
+  0x72, 0x3A, 0x22, 0xF3, 0x37, 0x82, 0x1C, 0x80, 0x00, 0x00, 0xA3, 0x80, 0x03, 0x07, 0x22, 0x25,
+  0xA3, 0x33, 0x66, 0x62, 0x25, 0x33, 0x80, 0x1D, 0x04, 0x27, 0x26, 0x26, 0x26, 0x62, 0x80, 0x4A,
+  0x00, 0x66, 0x84, 0x1E, 0x00, 0x3B, 0x80, 0x03, 0x00, 0x34, 0x80, 0x03, 0x00, 0x74, 0x80, 0x03,
+  0x00, 0xB4, 0x80, 0x03, 0x01, 0x94, 0x53, 0x80, 0x03, 0x80, 0x5C, 0x03, 0x94, 0x11, 0x32, 0x72,
+  0x86, 0xD1, 0x86, 0x03, 0x80, 0x87, 0x80, 0xF2, 0x02, 0x22, 0x11, 0x13, 0x81, 0xFB, 0x02, 0x11,
+  0x11, 0x71, 0x80, 0x03, 0x01, 0x22, 0x61, 0x80, 0x03, 0x00, 0x27, 0x80, 0x03, 0x00, 0x22, 0x82,
+  0x2E, 0x00, 0x71, 0x84, 0x8B, 0x82, 0x1F, 0x8F, 0x00, 0x0D, 0x1B, 0x37, 0x11, 0x16, 0x72, 0x22,
+  0x11, 0xB2, 0x22, 0x22, 0x82, 0x2D, 0x76, 0x63, 0x80, 0x03, 0x09, 0xB6, 0x52, 0x2D, 0x75, 0x2B,
+  0x42, 0x22, 0xB2, 0x25, 0x42, 0x80, 0x33, 0x07, 0x82, 0x22, 0x52, 0x25, 0x22, 0x25, 0x62, 0x27,
+  0x81, 0x03, 0x0F, 0x62, 0x56, 0x22, 0x22, 0x37, 0x76, 0x22, 0x25, 0x77, 0x67, 0x22, 0x26, 0x95,
+  0x2B, 0x22, 0x2E, 0x80, 0x1E, 0x0C, 0x5E, 0xD2, 0x22, 0x22, 0xBE, 0x62, 0xD9, 0x22, 0xBE, 0x3F,
+  0x6F, 0x22, 0xBE, 0x80, 0xEE, 0x80, 0xC7, 0x06, 0x22, 0x5A, 0x22, 0x55, 0xAA, 0x33, 0x23, 0x80,
+  0xB8, 0x81, 0x03, 0x80, 0xB7, 0x01, 0x33, 0x22, 0x80, 0x03, 0x00, 0x62, 0x80, 0xC4, 0x04, 0x53,
+  0x33, 0x56, 0xF3, 0x33, 0x82, 0x03, 0x00, 0x72, 0x80, 0x1A, 0x81, 0x03, 0x01, 0x56, 0x2A, 0x80,
+  0x03, 0x00, 0x2D, 0x80, 0x21, 0x0F, 0x22, 0x33, 0x37, 0x26, 0x62, 0x33, 0x52, 0x62, 0x66, 0x33,
+  0x37, 0x22, 0x66, 0x33, 0x33, 0x35, 0x81, 0x32, 0x00, 0x37, 0x80, 0x03, 0x82, 0x00, 0x00, 0x73,
+  0x80, 0x03, 0x80, 0x28, 0x0E, 0x33, 0x66, 0x22, 0xA3, 0x33, 0x66, 0x66, 0x53, 0x33, 0x26, 0x66,
+  0x2A, 0x33, 0xD2, 0x66, 0x80, 0x59, 0x04, 0x72, 0x62, 0xA3, 0x33, 0x35, 0x80, 0x59, 0x0A, 0x72,
+  0x66, 0x53, 0x37, 0x26, 0x66, 0x53, 0x31, 0x11, 0x11, 0x62, 0x80, 0xFA, 0x01, 0x11, 0x21, 0x84,
+  0x03, 0x81, 0xF0, 0x01, 0x22, 0x71, 0x80, 0x03, 0x01, 0x22, 0x31, 0x80, 0x03, 0x00, 0x23, 0x80,
+  0x03, 0x80, 0xBF, 0x02, 0x22, 0x27, 0x67, 0x87, 0xFB, 0x00, 0x13, 0x80, 0xFE, 0x80, 0x21, 0x00,
+  0x17, 0x80, 0x20, 0x05, 0x13, 0x31, 0x11, 0x71, 0x11, 0xB2, 0x80, 0x08, 0x00, 0xB2, 0x80, 0x36,
+  0x81, 0x03, 0x00, 0x12, 0x80, 0x03, 0x05, 0x13, 0x22, 0xB3, 0x11, 0x11, 0x72, 0x80, 0x21, 0x02,
+  0x16, 0x32, 0x26, 0x81, 0x47, 0x97, 0x00, 0x0E, 0xB6, 0x72, 0x27, 0x31, 0x23, 0x72, 0x26, 0xE4,
+  0x26, 0x72, 0x24, 0x44, 0x22, 0x32, 0x94, 0x80, 0x03, 0x00, 0xE4, 0x82, 0x03, 0x1C, 0x23, 0x72,
+  0x64, 0x44, 0x6B, 0x22, 0x29, 0x8E, 0x12, 0x22, 0x26, 0x52, 0x11, 0x53, 0x9D, 0x33, 0x18, 0xD2,
+  0xD2, 0x33, 0x15, 0xDD, 0x22, 0x33, 0x12, 0x79, 0x34, 0x33, 0x19, 0x80, 0xD3, 0x0B, 0x84, 0xB3,
+  0x33, 0x33, 0x95, 0x87, 0x37, 0x33, 0x91, 0x11, 0x8D, 0x33, 0x80, 0xD8, 0x0A, 0x66, 0x37, 0x26,
+  0x22, 0x22, 0x32, 0x22, 0x55, 0xAA, 0x32, 0x23, 0x80, 0xDE, 0x80, 0x03, 0x00, 0x52, 0x80, 0xE6,
+  0x01, 0x52, 0x22, 0x80, 0x03, 0x0A, 0x62, 0xF3, 0x33, 0x22, 0x53, 0x33, 0x56, 0x5A, 0x33, 0x33,
+  0x56, 0x80, 0x36, 0x00, 0x72, 0x84, 0x03, 0x81, 0x0B, 0x81, 0x03, 0x80, 0x21, 0x02, 0x37, 0x22,
+  0xF3, 0x80, 0x29, 0x00, 0xF3, 0x80, 0x07, 0x80, 0x36, 0x00, 0x35, 0x80, 0x03, 0x01, 0x33, 0x2A,
+  0x80, 0x03, 0x00, 0x2D, 0x80, 0x03, 0x01, 0x66, 0x73, 0x80, 0x03, 0x00, 0x27, 0x80, 0x03, 0x0E,
+  0x66, 0x22, 0xA3, 0x66, 0x66, 0x66, 0x53, 0x22, 0x62, 0x66, 0x23, 0x37, 0xD2, 0x66, 0x65, 0x80,
+  0x42, 0x80, 0x37, 0x01, 0x35, 0x26, 0x80, 0x07, 0x00, 0x26, 0x80, 0x36, 0x00, 0x66, 0x80, 0xFC,
+  0x02, 0x11, 0x22, 0x61, 0x80, 0x03, 0x00, 0x21, 0x83, 0x03, 0x04, 0xF2, 0x22, 0x11, 0x11, 0xD2,
+  0x80, 0xFC, 0x03, 0xD2, 0x22, 0x22, 0x91, 0x80, 0x03, 0x01, 0x23, 0x32, 0x80, 0xE7, 0x04, 0x11,
+  0x37, 0x22, 0x27, 0x11, 0x87, 0x00, 0x03, 0x13, 0x11, 0x11, 0x1B, 0x80, 0x25, 0x00, 0x17, 0x80,
+  0x03, 0x0E, 0x13, 0x3E, 0x3E, 0x11, 0x81, 0x11, 0x98, 0x1D, 0x77, 0x11, 0xD1, 0x17, 0x77, 0x11,
+  0x81, 0x80, 0x03, 0x1C, 0xAD, 0xD7, 0x75, 0x11, 0x3A, 0x97, 0x7D, 0x88, 0xAA, 0x33, 0x9A, 0xAA,
+  0x18, 0x77, 0x79, 0xAA, 0x11, 0x88, 0x11, 0x11, 0x18, 0x77, 0x81, 0x11, 0x15, 0x77, 0x51, 0x11,
+  0x1D, 0x80, 0x07, 0x0F, 0x57, 0x7D, 0x11, 0x11, 0x57, 0x78, 0x11, 0x15, 0xA7, 0x9E, 0x77, 0x77,
+  0xAA, 0x99, 0x33, 0x33, 0x84, 0x53, 0x0C, 0x55, 0x57, 0x51, 0x18, 0x77, 0xD7, 0x71, 0x18, 0x77,
+  0x77, 0x71, 0x11, 0x57, 0x80, 0x2A, 0x08, 0x17, 0x77, 0xD5, 0x55, 0x55, 0x9A, 0xA3, 0x33, 0x39,
+  0x85, 0x74, 0x00, 0xD1, 0x80, 0x23, 0x80, 0x36, 0x01, 0x77, 0x7D, 0x80, 0x4D, 0x11, 0x77, 0x11,
+  0x11, 0x77, 0x7D, 0x58, 0x18, 0xD7, 0x23, 0x3D, 0xD7, 0x27, 0xD3, 0x33, 0x22, 0xCC, 0xD3, 0x39,
+  0x80, 0x03, 0x20, 0x32, 0xC2, 0x44, 0x73, 0x32, 0x23, 0x33, 0xD9, 0x92, 0x23, 0x33, 0x7D, 0x4C,
+  0x24, 0x33, 0x78, 0x4C, 0x22, 0x33, 0x9D, 0x22, 0x22, 0x43, 0x66, 0x22, 0x53, 0x33, 0x62, 0x5A,
+  0x33, 0x33, 0xAA, 0x33, 0x92, 0x00, 0x0C, 0x37, 0x52, 0xF3, 0x33, 0x52, 0x56, 0xF3, 0x33, 0x37,
+  0x76, 0x23, 0x33, 0x33, 0x81, 0x03, 0x01, 0x52, 0x2A, 0x80, 0x03, 0x09, 0x2D, 0x33, 0x33, 0x22,
+  0x66, 0x73, 0x33, 0x62, 0x66, 0x27, 0x80, 0x03, 0x0D, 0x66, 0x62, 0x22, 0x66, 0x66, 0x66, 0x35,
+  0x22, 0x22, 0x66, 0x33, 0x37, 0xD2, 0x66, 0x80, 0x33, 0x00, 0x72, 0x80, 0x03, 0x00, 0x35, 0x83,
+  0x07, 0x0E, 0x37, 0x22, 0xF2, 0x22, 0x31, 0x11, 0xD2, 0x22, 0x61, 0x11, 0x5F, 0x22, 0x21, 0x11,
+  0xCD, 0x80, 0x03, 0x07, 0xCC, 0xF2, 0x22, 0x11, 0xCC, 0xD2, 0x22, 0x71, 0x80, 0x03, 0x00, 0x22,
+  0x80, 0x03, 0x0C, 0x26, 0x44, 0xB1, 0x11, 0x13, 0x44, 0x41, 0x11, 0x19, 0x44, 0x4C, 0x11, 0x11,
+  0x86, 0x03, 0x07, 0x44, 0x11, 0x11, 0x94, 0x44, 0xC1, 0x11, 0x3B, 0x80, 0x18, 0x00, 0x22, 0x80,
+  0x3B, 0x02, 0x27, 0x67, 0x31, 0x85, 0xE6, 0x01, 0x11, 0xE3, 0x80, 0x03, 0x0F, 0xE2, 0x71, 0xB3,
+  0x11, 0xE2, 0x31, 0x22, 0x71, 0xE1, 0x11, 0x32, 0x26, 0xB2, 0x22, 0x22, 0x22, 0x85, 0x03, 0x00,
+  0x12, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x01, 0x11, 0x72, 0x80, 0x03, 0x00, 0x16, 0x80, 0x03,
+  0x01, 0x11, 0xB6, 0x80, 0x09, 0x00, 0x23, 0x80, 0x03, 0x00, 0x26, 0x80, 0x03, 0x01, 0x22, 0x32,
+  0x87, 0x03, 0x81, 0x13, 0x15, 0x6B, 0x22, 0x27, 0x31, 0x12, 0x22, 0x2D, 0x36, 0x63, 0x62, 0x2D,
+  0x36, 0xB6, 0x77, 0x25, 0x35, 0x29, 0x76, 0x22, 0xB2, 0x25, 0x9B, 0x80, 0x1F, 0x08, 0x22, 0x22,
+  0x52, 0x25, 0xD2, 0x25, 0x62, 0x27, 0x62, 0x80, 0x03, 0x05, 0x3F, 0x7E, 0x33, 0x33, 0x26, 0xE2,
+  0x80, 0xC7, 0x07, 0x22, 0x33, 0x32, 0x22, 0x35, 0x33, 0x32, 0x23, 0x80, 0xD6, 0x80, 0x03, 0x08,
+  0x56, 0x25, 0xA9, 0x33, 0x56, 0x22, 0x29, 0x33, 0x56, 0x80, 0xF9, 0x07, 0x62, 0x53, 0x66, 0x22,
+  0x5A, 0x33, 0x55, 0xAA, 0x80, 0xF1, 0x8C, 0x00, 0x00, 0x53, 0x81, 0x04, 0x01, 0x52, 0xF3, 0x80,
+  0x2E, 0x80, 0x03, 0x81, 0x36, 0x82, 0x03, 0x00, 0x2A, 0x80, 0x0F, 0x00, 0x2D, 0x80, 0x55, 0x0A,
+  0x66, 0x53, 0x37, 0x26, 0x66, 0x2A, 0x52, 0x22, 0x66, 0x66, 0x37, 0x80, 0x03, 0x01, 0x33, 0x35,
+  0x80, 0x62, 0x02, 0x33, 0x37, 0xD2, 0x8C, 0x42, 0x11, 0x37, 0x22, 0xA3, 0x33, 0xB4, 0x66, 0x53,
+  0x33, 0x74, 0x66, 0x2A, 0x33, 0x34, 0x66, 0x25, 0x33, 0x34, 0x72, 0x80, 0x10, 0x00, 0x35, 0x80,
+  0x10, 0x04, 0x72, 0x62, 0x53, 0x33, 0x22, 0x80, 0x07, 0x02, 0x11, 0x11, 0x62, 0x80, 0xE7, 0x01,
+  0x11, 0x37, 0x80, 0x03, 0x86, 0x00, 0x00, 0x71, 0x80, 0x03, 0x01, 0x22, 0x91, 0x80, 0x03, 0x00,
+  0x23, 0x80, 0x03, 0x06, 0x22, 0x22, 0x71, 0x22, 0x27, 0x67, 0x31, 0x86, 0x1C, 0x12, 0x13, 0x11,
+  0x11, 0x1B, 0x22, 0x21, 0xB3, 0x17, 0x22, 0x31, 0x22, 0x13, 0x31, 0x11, 0x32, 0x11, 0xB2, 0x22,
+  0x22, 0x86, 0x03, 0x00, 0x12, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x12, 0x11, 0x72, 0x22, 0x71,
+  0x11, 0x16, 0x22, 0x26, 0x11, 0x11, 0xB6, 0x22, 0x25, 0x7F, 0x67, 0x22, 0x22, 0x55, 0xB6, 0x80,
+  0x47, 0x86, 0x00, 0x00, 0x42, 0x80, 0x03, 0x0B, 0xC2, 0x21, 0x11, 0x22, 0xC2, 0x8A, 0x1C, 0x22,
+  0x77, 0x3F, 0x22, 0x5E, 0x80, 0x03, 0x04, 0xDE, 0x5B, 0xB5, 0x22, 0x2E, 0x80, 0x16, 0x00, 0x2B,
+  0x85, 0x23, 0x03, 0x11, 0x11, 0x45, 0x82, 0x81, 0x86, 0x26, 0x62, 0x2D, 0xA3, 0x33, 0x66, 0x22,
+  0x25, 0x33, 0x66, 0x26, 0x62, 0x22, 0x22, 0x26, 0x66, 0x66, 0x22, 0x26, 0x62, 0x26, 0x32, 0x26,
+  0x6A, 0x35, 0x32, 0x66, 0x6A, 0x33, 0x72, 0x66, 0x22, 0x73, 0x33, 0x35, 0x26, 0x62, 0x33, 0xA2,
+  0x26, 0x80, 0x17, 0x02, 0x26, 0x66, 0x62, 0x82, 0x1F, 0x80, 0x26, 0x0D, 0x22, 0xA3, 0xD6, 0x52,
+  0x23, 0x33, 0x26, 0x36, 0x23, 0x35, 0x2F, 0x22, 0x53, 0x33, 0x80, 0x3F, 0x03, 0x22, 0x22, 0x66,
+  0x62, 0x80, 0x01, 0x80, 0x00, 0x00, 0x22, 0x80, 0x03, 0x80, 0x22, 0x05, 0x66, 0x5A, 0x55, 0xFF,
+  0x57, 0x33, 0x80, 0x00, 0x03, 0x52, 0x26, 0x66, 0x53, 0x80, 0x36, 0x08, 0xA3, 0x26, 0x66, 0x2D,
+  0x33, 0x66, 0x66, 0xF3, 0x33, 0x80, 0x6A, 0x00, 0x33, 0x80, 0x02, 0x86, 0x00, 0x80, 0x3A, 0x00,
+  0x61, 0x80, 0x03, 0x00, 0x23, 0x80, 0x03, 0x00, 0x31, 0x80, 0x59, 0x04, 0x11, 0x22, 0x22, 0x21,
+  0x17, 0x80, 0x0A, 0x81, 0xE5, 0x80, 0x03, 0x01, 0x22, 0x73, 0x80, 0xA3, 0x86, 0x00, 0x0B, 0x31,
+  0x11, 0x72, 0x91, 0x23, 0x11, 0x72, 0x31, 0x26, 0x11, 0x32, 0x61, 0x85, 0x03, 0x01, 0x13, 0x26,
+  0x85, 0x1D, 0x04, 0x13, 0x63, 0x11, 0x11, 0x17, 0x80, 0xD7, 0x81, 0x03, 0x81, 0x3E, 0x02, 0x1B,
+  0x22, 0x72, 0x80, 0x03, 0x84, 0x1C, 0x03, 0x17, 0xB1, 0x66, 0x67, 0x85, 0xFA, 0x81, 0x00, 0x00,
+  0x2A, 0x85, 0x03, 0x03, 0x42, 0x22, 0x25, 0x7F, 0x80, 0x07, 0x00, 0x55, 0x89, 0x1C, 0x01, 0x11,
+  0x42, 0x80, 0x03, 0x06, 0xC2, 0x21, 0x11, 0x11, 0xC2, 0x51, 0x1C, 0x80, 0x05, 0x01, 0x87, 0x45,
+  0x80, 0x40, 0x01, 0x33, 0x81, 0x80, 0x03, 0x00, 0xE1, 0x80, 0x03, 0x00, 0x3D, 0x80, 0x03, 0x80,
+  0x0C, 0x02, 0x33, 0xAA, 0xA1, 0x80, 0x03, 0x0C, 0xAA, 0x11, 0x42, 0x2C, 0x2F, 0xB3, 0x18, 0x52,
+  0xC2, 0x24, 0x11, 0x18, 0xCC, 0x80, 0x6B, 0x05, 0x82, 0xCC, 0x11, 0x11, 0x18, 0xC2, 0x80, 0x2E,
+  0x00, 0x19, 0x80, 0x03, 0x00, 0x18, 0x81, 0x78, 0x28, 0x33, 0x33, 0x34, 0x22, 0x33, 0x33, 0xB2,
+  0xCC, 0x22, 0x22, 0x2C, 0xCC, 0x22, 0xC2, 0xC2, 0xCC, 0x2C, 0xCC, 0x2C, 0x22, 0x34, 0x2C, 0x22,
+  0xB3, 0x93, 0x4C, 0x23, 0x33, 0x83, 0x32, 0xF3, 0x34, 0x66, 0x22, 0x53, 0x33, 0x66, 0x66, 0x22,
+  0x22, 0x66, 0x84, 0x00, 0x80, 0x09, 0x02, 0x22, 0xF2, 0x26, 0x80, 0x84, 0x04, 0x5A, 0x55, 0xFF,
+  0x2F, 0x33, 0x80, 0x00, 0x00, 0x52, 0x80, 0x10, 0x80, 0x1D, 0x03, 0x26, 0x22, 0x66, 0x2D, 0x80,
+  0x1E, 0x04, 0xFA, 0x22, 0x22, 0x25, 0x33, 0x80, 0x02, 0x01, 0x33, 0x57, 0x81, 0x1B, 0x80, 0x00,
+  0x00, 0x53, 0x80, 0x03, 0x00, 0xA3, 0x84, 0x0B, 0x80, 0x00, 0x00, 0x37, 0x80, 0x03, 0x00, 0x34,
+  0x80, 0x03, 0x00, 0xB4, 0x80, 0x03, 0x00, 0x44, 0x81, 0x10, 0x16, 0x74, 0x44, 0x44, 0x41, 0x3B,
+  0x44, 0x44, 0xC1, 0xB4, 0x44, 0x44, 0x11, 0x44, 0xB4, 0x44, 0x11, 0x43, 0x3B, 0x4C, 0x11, 0x4B,
+  0x37, 0x41, 0x80, 0x03, 0x02, 0xC1, 0x11, 0x3B, 0x80, 0x03, 0x03, 0x15, 0x77, 0x81, 0x85, 0x80,
+  0x03, 0x00, 0x1D, 0x80, 0x03, 0x08, 0x17, 0x15, 0x77, 0x11, 0x87, 0x11, 0x58, 0x11, 0x57, 0x80,
+  0xB6, 0x00, 0x87, 0x81, 0xBB, 0x81, 0x00, 0x08, 0xAD, 0xDA, 0xAA, 0xAA, 0x7D, 0x11, 0x18, 0x88,
+  0x77, 0x80, 0xCF, 0x81, 0x03, 0x00, 0x7D, 0x80, 0x03, 0x00, 0x78, 0x84, 0xDB, 0x81, 0x00, 0x0B,
+  0xAA, 0x93, 0x33, 0x39, 0xA7, 0xD5, 0xDD, 0xDD, 0x77, 0x51, 0x11, 0x11, 0x89, 0x03, 0x01, 0xD7,
+  0x81, 0x83, 0x1F, 0x0F, 0xD2, 0x2D, 0xDD, 0xD7, 0x27, 0xD5, 0x55, 0x52, 0x77, 0x71, 0x11, 0x17,
+  0xD7, 0x71, 0x11, 0x1D, 0x88, 0x03, 0x01, 0x18, 0x57, 0x80, 0x27, 0x1B, 0x33, 0x92, 0x22, 0x2F,
+  0xE9, 0xB2, 0x22, 0x22, 0x77, 0x72, 0x22, 0xC2, 0x77, 0x87, 0xCC, 0xCC, 0x77, 0x17, 0x2C, 0xCC,
+  0x77, 0x15, 0x32, 0xCC, 0xD5, 0x11, 0x32, 0xCC, 0x80, 0x3D, 0x00, 0xCC, 0x80, 0xDB, 0x00, 0x35,
+  0x80, 0xEE, 0x20, 0xA2, 0x22, 0x22, 0x22, 0x26, 0x22, 0x66, 0x62, 0x22, 0x62, 0x26, 0x62, 0x66,
+  0x6A, 0x35, 0x22, 0x62, 0x2A, 0x33, 0x52, 0x23, 0x22, 0x73, 0x32, 0x23, 0x22, 0x62, 0x22, 0x53,
+  0x22, 0x66, 0x66, 0x22, 0x80, 0x03, 0x82, 0x00, 0x81, 0x08, 0x0A, 0xA3, 0xD2, 0x22, 0x66, 0x33,
+  0x26, 0x5A, 0x55, 0x35, 0x2F, 0x33, 0x80, 0x00, 0x02, 0x42, 0x22, 0x2F, 0x80, 0x3C, 0x02, 0xCC,
+  0xCC, 0xC2, 0x80, 0x03, 0x81, 0x00, 0x1E, 0x22, 0x24, 0xCC, 0xCC, 0x24, 0xB5, 0x44, 0x49, 0x39,
+  0x81, 0x33, 0x33, 0x71, 0x11, 0x22, 0x43, 0x33, 0x51, 0x22, 0xB3, 0x35, 0x11, 0xCF, 0x37, 0x81,
+  0x11, 0x49, 0xD1, 0x11, 0x11, 0x48, 0x83, 0xB6, 0x00, 0x17, 0x80, 0x03, 0x1D, 0x73, 0x11, 0x11,
+  0x89, 0x33, 0xC3, 0x74, 0x4C, 0xCC, 0x17, 0x3B, 0x44, 0x44, 0x19, 0xB4, 0x44, 0x44, 0x14, 0x44,
+  0xB4, 0x44, 0xE4, 0x43, 0x3B, 0x44, 0x94, 0x4B, 0x37, 0x44, 0x44, 0x80, 0x03, 0x07, 0x33, 0x3B,
+  0x37, 0x44, 0x11, 0x11, 0x13, 0x26, 0x83, 0x32, 0x02, 0x11, 0x11, 0x72, 0x81, 0x03, 0x04, 0x31,
+  0x11, 0x11, 0x32, 0x61, 0x81, 0x03, 0x00, 0x22, 0x80, 0x03, 0x81, 0x11, 0x83, 0x00, 0x04, 0x13,
+  0x63, 0x31, 0x66, 0x17, 0x80, 0x87, 0x81, 0x03, 0x00, 0x13, 0x80, 0x03, 0x00, 0x1B, 0x84, 0x03,
+  0x80, 0x29, 0x01, 0x22, 0x11, 0x80, 0x14, 0x00, 0x67, 0x80, 0x0B, 0x86, 0x00, 0x02, 0x2A, 0xAA,
+  0x32, 0x80, 0x03, 0x00, 0xA2, 0x81, 0x03, 0x07, 0x25, 0x7F, 0x67, 0x33, 0x22, 0x55, 0xB6, 0x77,
+  0x80, 0x15, 0x00, 0x5B, 0x89, 0x22, 0x16, 0x21, 0x11, 0x22, 0x11, 0x51, 0x1C, 0x22, 0x11, 0x3F,
+  0x22, 0x5E, 0xEE, 0x3F, 0x22, 0xDE, 0xEE, 0xB5, 0x22, 0x2E, 0xEE, 0x22, 0x22, 0x2B, 0x80, 0x03,
+  0x00, 0x22, 0x81, 0x03, 0x0E, 0x2E, 0x1C, 0x45, 0x82, 0x2E, 0x11, 0x11, 0x22, 0x5E, 0x6D, 0xA3,
+  0x33, 0x33, 0x26, 0x25, 0x80, 0x03, 0x80, 0x14, 0x18, 0x66, 0x66, 0x66, 0x62, 0x66, 0x62, 0x26,
+  0x62, 0x66, 0x2A, 0x35, 0x22, 0x66, 0x2A, 0x33, 0x52, 0x66, 0x62, 0x73, 0x32, 0x35, 0x26, 0x66,
+  0x22, 0xA2, 0x80, 0x18, 0x83, 0x1C, 0x01, 0x66, 0x66, 0x80, 0x27, 0x10, 0x66, 0x22, 0xA3, 0xF2,
+  0x26, 0x23, 0x33, 0x26, 0x5A, 0x23, 0x35, 0x2F, 0x33, 0x53, 0x33, 0x33, 0x52, 0x81, 0x6F, 0x84,
+  0x1E, 0x81, 0x00, 0x00, 0x62, 0x80, 0x0E, 0x04, 0x25, 0x55, 0xFF, 0x57, 0x33, 0x81, 0x00, 0x02,
+  0x22, 0x66, 0x53, 0x80, 0x03, 0x09, 0xA3, 0x33, 0x66, 0x6D, 0x33, 0x33, 0x66, 0xF3, 0x33, 0x33,
+  0x80, 0x6A, 0x8A, 0x00, 0x06, 0x22, 0x22, 0x61, 0x11, 0x22, 0x22, 0x23, 0x80, 0x03, 0x0F, 0x31,
+  0x11, 0x22, 0x26, 0x11, 0x31, 0x22, 0x21, 0x17, 0x23, 0x22, 0x31, 0x13, 0x26, 0x22, 0x11, 0x80,
+  0x03, 0x06, 0x22, 0x73, 0x26, 0x11, 0x11, 0x11, 0x13, 0x80, 0x03, 0x83, 0x00, 0x00, 0x72, 0x81,
+  0x03, 0x04, 0x31, 0x11, 0x11, 0x32, 0x61, 0x81, 0x03, 0x00, 0x22, 0x80, 0x03, 0x00, 0x72, 0x81,
+  0x20, 0x82, 0x00, 0x06, 0x13, 0x63, 0x31, 0x11, 0x17, 0x22, 0x22, 0x82, 0x03, 0x00, 0x13, 0x80,
+  0x03, 0x00, 0x1B, 0x83, 0x03, 0x80, 0x89, 0x00, 0x28, 0x81, 0x05, 0x01, 0x82, 0x44, 0x80, 0xA6,
+  0x09, 0x11, 0x42, 0x25, 0x22, 0x1A, 0x82, 0x51, 0xCC, 0x11, 0x45, 0x86, 0x52, 0x0B, 0x11, 0x11,
+  0x18, 0x22, 0xC1, 0x11, 0xC2, 0x2B, 0x22, 0x81, 0x82, 0x5E, 0x80, 0x27, 0x0E, 0xEE, 0x1C, 0x52,
+  0x25, 0xEE, 0x11, 0xC2, 0x2E, 0xEE, 0x1A, 0x82, 0x56, 0xBD, 0x1A, 0x82, 0x81, 0xD8, 0x01, 0x22,
+  0x25, 0x80, 0xDC, 0x0E, 0x62, 0x22, 0x5D, 0x66, 0x66, 0x25, 0x37, 0x66, 0x66, 0x27, 0x37, 0x66,
+  0x22, 0x2A, 0x35, 0x81, 0xCD, 0x01, 0x75, 0xDF, 0x81, 0xBF, 0x07, 0xF2, 0x25, 0x22, 0x6A, 0x22,
+  0x22, 0x26, 0xF3, 0x80, 0x03, 0x06, 0xA3, 0x53, 0x56, 0x22, 0x33, 0xA3, 0x56, 0x80, 0xE1, 0x09,
+  0x26, 0x2A, 0x33, 0x37, 0x22, 0xD3, 0x33, 0x37, 0x26, 0x53, 0x89, 0xEA, 0x08, 0x3B, 0x33, 0x33,
+  0xE4, 0x72, 0x33, 0x3E, 0x22, 0x22, 0x80, 0x03, 0x04, 0x94, 0x33, 0x3E, 0x2F, 0x39, 0x80, 0x03,
+  0x80, 0x16, 0x09, 0x39, 0x43, 0x33, 0x94, 0x22, 0x73, 0x42, 0x22, 0x22, 0x23, 0x80, 0x6C, 0x00,
+  0x23, 0x80, 0x6B, 0x0B, 0x23, 0x26, 0x62, 0x22, 0x23, 0x26, 0x6F, 0x9F, 0x23, 0x72, 0x24, 0x39,
+  0x80, 0x13, 0x80, 0x00, 0x04, 0x23, 0x11, 0x62, 0x22, 0x21, 0x80, 0xD5, 0x00, 0x21, 0x80, 0xDD,
+  0x00, 0x71, 0x80, 0x03, 0x80, 0xFE, 0x86, 0x03, 0x02, 0x27, 0x72, 0x73, 0x82, 0x22, 0x0D, 0x13,
+  0x32, 0x76, 0x23, 0x11, 0x32, 0x61, 0x21, 0x11, 0x32, 0x31, 0x31, 0x11, 0xB2, 0x80, 0x19, 0x00,
+  0x13, 0x82, 0xDD, 0x02, 0x72, 0x31, 0x1B, 0x80, 0x1C, 0x80, 0x03, 0x80, 0x00, 0x0F, 0x32, 0x77,
+  0x22, 0x27, 0x32, 0x31, 0x17, 0x23, 0x32, 0x31, 0x12, 0x2A, 0x13, 0x11, 0x32, 0x7A, 0x80, 0x1D,
+  0x00, 0x3A, 0x82, 0x18, 0x81, 0x00, 0x0D, 0x24, 0x42, 0x81, 0x41, 0x11, 0xC2, 0x51, 0x11, 0x11,
+  0x42, 0x5A, 0x11, 0x11, 0x82, 0x81, 0x07, 0x00, 0x41, 0x81, 0x3F, 0x03, 0x22, 0x22, 0x25, 0x45,
+  0x81, 0x1E, 0x0F, 0x11, 0x82, 0x44, 0x52, 0x11, 0x22, 0x11, 0x42, 0x11, 0x22, 0x1A, 0x82, 0x11,
+  0xC1, 0x11, 0x45, 0x82, 0x5C, 0x80, 0x00, 0x03, 0x37, 0x88, 0x88, 0xC1, 0x80, 0x03, 0x05, 0x89,
+  0x33, 0x33, 0x78, 0x73, 0x37, 0x80, 0xCD, 0x02, 0x78, 0x88, 0x73, 0x80, 0x0E, 0x09, 0x83, 0x32,
+  0x88, 0x88, 0x73, 0xAF, 0x88, 0x8C, 0x73, 0x33, 0x85, 0x27, 0x00, 0x78, 0x80, 0x03, 0x01, 0x2C,
+  0x81, 0x81, 0x4F, 0x80, 0x03, 0x06, 0x2B, 0x98, 0x11, 0x4B, 0x33, 0x33, 0xD1, 0x81, 0xFC, 0x02,
+  0x11, 0x22, 0x24, 0x80, 0x5B, 0x03, 0x2C, 0x22, 0x11, 0x18, 0x80, 0x03, 0x06, 0x11, 0x82, 0xC2,
+  0x11, 0x11, 0x18, 0x24, 0x80, 0x2A, 0x00, 0x5B, 0x80, 0x03, 0x00, 0x19, 0x80, 0x03, 0x01, 0x18,
+  0x2B, 0x80, 0x24, 0x00, 0x43, 0x80, 0x03, 0x00, 0xB3, 0x80, 0x03, 0x80, 0x00, 0x00, 0xE4, 0x80,
+  0x32, 0x00, 0x22, 0x84, 0x03, 0x00, 0x2F, 0x83, 0x03, 0x1E, 0x33, 0x39, 0x33, 0x33, 0x94, 0x72,
+  0x3B, 0x42, 0x22, 0x22, 0x72, 0x22, 0x66, 0x66, 0x22, 0x62, 0x66, 0x66, 0x94, 0x62, 0x22, 0x22,
+  0x39, 0x22, 0x2F, 0x94, 0x33, 0x72, 0x24, 0x39, 0x53, 0x80, 0x20, 0x06, 0x93, 0x33, 0x3B, 0x44,
+  0x23, 0x33, 0x34, 0x84, 0x03, 0x00, 0x74, 0x89, 0x03, 0x04, 0x4C, 0x22, 0x22, 0x64, 0x44, 0x80,
+  0x2E, 0x13, 0x6E, 0x13, 0x23, 0x13, 0x32, 0x17, 0x23, 0x11, 0x32, 0x17, 0x21, 0x11, 0x32, 0x11,
+  0x31, 0x11, 0xB2, 0x11, 0xE8, 0x44, 0x82, 0x00, 0x81, 0xBB, 0x80, 0xB6, 0x10, 0x11, 0x37, 0xD5,
+  0x11, 0x11, 0x9A, 0x93, 0x97, 0x7D, 0x9A, 0x93, 0x9A, 0xA3, 0x7D, 0xDD, 0x58, 0x88, 0x84, 0xD6,
+  0x85, 0x07, 0x86, 0x0C, 0x0E, 0x37, 0xAA, 0x55, 0x88, 0x5A, 0xAA, 0xAA, 0x73, 0x15, 0xAA, 0xAA,
+  0xAD, 0x8A, 0xAA, 0xAA, 0x89, 0x1E, 0x82, 0x00, 0x81, 0x4B, 0x05, 0x9A, 0xAA, 0xA5, 0x81, 0x55,
+  0xAA, 0x81, 0x1C, 0x01, 0x88, 0x85, 0x8E, 0x20, 0x84, 0x00, 0x03, 0xA5, 0x58, 0x81, 0x11, 0x80,
+  0x22, 0x07, 0x93, 0x11, 0x11, 0x82, 0xCC, 0x11, 0x11, 0x12, 0x80, 0x03, 0x00, 0x1D, 0x80, 0x8B,
+  0x04, 0x12, 0x39, 0x11, 0x11, 0x17, 0x81, 0x03, 0x45, 0x34, 0x11, 0x11, 0x19, 0x33, 0x97, 0x7D,
+  0x93, 0x33, 0x66, 0x25, 0xF2, 0x25, 0x66, 0x62, 0x26, 0x62, 0x22, 0x62, 0x62, 0x26, 0x22, 0x66,
+  0x53, 0x56, 0x22, 0x62, 0xA3, 0x52, 0x66, 0x6D, 0x33, 0x26, 0x75, 0x2F, 0x37, 0x26, 0x33, 0x33,
+  0x37, 0x22, 0x22, 0x2B, 0x33, 0x33, 0x22, 0x43, 0x33, 0x33, 0xCC, 0xB3, 0x33, 0x33, 0xC2, 0x33,
+  0x33, 0x3D, 0xC4, 0x33, 0x37, 0x11, 0x2B, 0x3B, 0x51, 0x11, 0x23, 0x98, 0x11, 0x11, 0x49, 0x80,
+  0x8C, 0x04, 0x33, 0x3D, 0x11, 0x11, 0x39, 0x80, 0x07, 0x00, 0x71, 0x87, 0x7A, 0x00, 0x8D, 0x80,
+  0x03, 0x00, 0x62, 0x80, 0x6F, 0x18, 0x2F, 0x11, 0x11, 0xD6, 0x24, 0x44, 0x49, 0x22, 0x22, 0x44,
+  0xE2, 0x22, 0x29, 0x48, 0x92, 0x22, 0x21, 0x85, 0x52, 0x22, 0x21, 0x55, 0x52, 0x22, 0x71, 0x80,
+  0x03, 0x01, 0x61, 0x6D, 0x80, 0x03, 0x00, 0x26, 0x80, 0x03, 0x0E, 0x22, 0x22, 0x22, 0x27, 0x11,
+  0x62, 0x22, 0x22, 0x11, 0x13, 0x23, 0x13, 0x11, 0x17, 0x23, 0x80, 0x9A, 0x00, 0x21, 0x80, 0x3E,
+  0x00, 0x31, 0x86, 0x4C, 0x03, 0x72, 0x73, 0x72, 0x31, 0x80, 0x23, 0x13, 0x23, 0x32, 0x76, 0x22,
+  0x22, 0x32, 0x61, 0x32, 0x77, 0x32, 0x31, 0x32, 0x31, 0xB2, 0x61, 0x32, 0x31, 0x13, 0x11, 0x13,
+  0x82, 0x1F, 0x00, 0x1B, 0x80, 0x1C, 0x81, 0x03, 0x81, 0x23, 0x13, 0x22, 0x27, 0x3A, 0xAA, 0x17,
+  0x23, 0xAA, 0xAA, 0x12, 0x2A, 0xAA, 0xAA, 0x32, 0x7A, 0xAA, 0xAA, 0x72, 0x3A, 0xAA, 0xAA, 0x83,
+  0x1A, 0x08, 0x22, 0x22, 0x42, 0x51, 0x11, 0x82, 0xC2, 0x5A, 0x11, 0x81, 0x07, 0x06, 0x22, 0x82,
+  0x51, 0x11, 0xC1, 0x42, 0x41, 0x83, 0x5F, 0x09, 0x25, 0x48, 0x28, 0x11, 0x22, 0x22, 0x25, 0xC1,
+  0x44, 0x52, 0x80, 0x83, 0x08, 0x42, 0x25, 0x22, 0x1A, 0x82, 0x51, 0x1C, 0x11, 0x45, 0x82, 0x1A,
+  0x00, 0x1A, 0x81, 0x03, 0x1C, 0xAA, 0xA7, 0x22, 0x55, 0xAA, 0xA2, 0x2D, 0x5C, 0x7A, 0x72, 0x65,
+  0x55, 0x22, 0x22, 0x5C, 0x5D, 0x62, 0x26, 0x5C, 0xC6, 0xA2, 0x25, 0xCC, 0x5F, 0x72, 0x6D, 0xDF,
+  0x22, 0x72, 0x80, 0x57, 0x0F, 0x66, 0x26, 0x25, 0xF2, 0x66, 0x66, 0x62, 0x22, 0x5D, 0x26, 0x26,
+  0x22, 0x37, 0x22, 0x66, 0x53, 0x80, 0x03, 0x20, 0xA3, 0x35, 0x22, 0x6D, 0x33, 0x33, 0x75, 0xDF,
+  0x37, 0x33, 0x33, 0x33, 0x37, 0x25, 0x22, 0x2A, 0x33, 0x22, 0x26, 0xF3, 0x33, 0x66, 0x22, 0xA3,
+  0x33, 0x52, 0x22, 0x33, 0x33, 0x52, 0x65, 0x33, 0x33, 0x80, 0x12, 0x02, 0x33, 0x26, 0xD3, 0x80,
+  0x03, 0x00, 0x53, 0x80, 0x21, 0x86, 0x00, 0x06, 0x3B, 0x42, 0x33, 0xE4, 0x72, 0x22, 0x3E, 0x80,
+  0x52, 0x06, 0x3E, 0x22, 0x94, 0x26, 0x39, 0x2F, 0x39, 0x80, 0x03, 0x09, 0x33, 0x72, 0x33, 0x39,
+  0x43, 0x33, 0x94, 0x72, 0x23, 0x33, 0x80, 0xDE, 0x82, 0x03, 0x01, 0x66, 0x66, 0x80, 0x03, 0x80,
+  0x07, 0x05, 0x2F, 0x94, 0x23, 0x33, 0x24, 0x39, 0x81, 0x13, 0x80, 0x15, 0x12, 0x11, 0x62, 0x22,
+  0x21, 0x11, 0x13, 0x23, 0x21, 0x11, 0x17, 0x23, 0x71, 0x11, 0x17, 0x21, 0x61, 0x11, 0x11, 0x31,
+  0x80, 0x03, 0x00, 0x11, 0x81, 0x03, 0x02, 0x27, 0x72, 0x73, 0x81, 0xA6, 0x0E, 0x22, 0x13, 0x32,
+  0x76, 0x22, 0x11, 0x32, 0x61, 0x32, 0x11, 0x32, 0x31, 0x32, 0x11, 0xB2, 0x80, 0x07, 0x00, 0x13,
+  0x80, 0x01, 0x80, 0x00, 0x01, 0x31, 0x1B, 0x80, 0x3F, 0x80, 0x03, 0x81, 0x00, 0x13, 0x77, 0x22,
+  0x27, 0x3A, 0x31, 0x17, 0x23, 0xAA, 0x31, 0x12, 0x2A, 0xAA, 0x11, 0x32, 0x7A, 0xAA, 0x11, 0x72,
+  0x3A, 0xAA, 0x81, 0x23, 0x81, 0x00, 0x00, 0x41, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x04, 0x22,
+  0x81, 0x11, 0x11, 0x52, 0x80, 0x03, 0x84, 0x00, 0x0C, 0x1A, 0xAA, 0x22, 0x22, 0x6D, 0xA3, 0x22,
+  0xFD, 0x55, 0xA3, 0x22, 0x65, 0x5C, 0x80, 0x03, 0x09, 0xCC, 0xA3, 0x22, 0xD5, 0xCC, 0xA7, 0x22,
+  0xDC, 0xCC, 0x32, 0x80, 0x07, 0x00, 0x22, 0x80, 0x03, 0x22, 0x53, 0x75, 0x5A, 0x33, 0x53, 0x72,
+  0x22, 0x23, 0xA3, 0x72, 0x26, 0xF3, 0xA3, 0x22, 0x66, 0x53, 0xA3, 0x22, 0x62, 0x53, 0xA3, 0x56,
+  0x62, 0xF3, 0xA3, 0xA2, 0x66, 0x65, 0x23, 0x35, 0x66, 0x22, 0x33, 0x72, 0xA3, 0x82, 0xFD, 0x00,
+  0x3F, 0x80, 0x06, 0x01, 0x72, 0x2A, 0x80, 0x03, 0x03, 0x22, 0x33, 0x33, 0x35, 0x80, 0x03, 0x00,
+  0x33, 0x80, 0x03, 0x01, 0xA3, 0x52, 0x80, 0x07, 0x04, 0x3E, 0x22, 0xB3, 0x33, 0x34, 0x80, 0x03,
+  0x85, 0x00, 0x02, 0x34, 0x22, 0xE3, 0x80, 0x03, 0x00, 0xF3, 0x80, 0x03, 0x00, 0x43, 0x81, 0x0B,
+  0x07, 0xF2, 0x2F, 0x33, 0x73, 0x42, 0x22, 0x33, 0xE3, 0x85, 0x1E, 0x17, 0x92, 0x22, 0xB3, 0x93,
+  0xB2, 0x66, 0xB3, 0xE3, 0xB2, 0x62, 0xB3, 0x43, 0x92, 0x66, 0xFE, 0x73, 0x33, 0x74, 0x44, 0x44,
+  0x33, 0x3B, 0xBB, 0xBB, 0x86, 0x3F, 0x8C, 0x00, 0x81, 0xC4, 0x00, 0x31, 0x81, 0xD7, 0x06, 0x26,
+  0x3B, 0x11, 0x22, 0x22, 0x22, 0x27, 0x80, 0x03, 0x89, 0x00, 0x00, 0x27, 0x80, 0x19, 0x00, 0xAA,
+  0x82, 0x03, 0x05, 0x13, 0x22, 0xAA, 0x63, 0x37, 0x26, 0x80, 0xEE, 0x07, 0x23, 0xAA, 0x22, 0x77,
+  0x3A, 0xAA, 0x7A, 0xAA, 0x83, 0x00, 0x81, 0x3F, 0x83, 0x00, 0x09, 0x18, 0x81, 0x11, 0x11, 0x42,
+  0x21, 0x11, 0x11, 0x82, 0x41, 0x80, 0x03, 0x80, 0x0F, 0x00, 0x48, 0x87, 0x1A, 0x80, 0x00, 0x05,
+  0x14, 0x41, 0x1A, 0x11, 0x12, 0x24, 0x80, 0x25, 0x00, 0x22, 0x80, 0x26, 0x00, 0x52, 0x80, 0x03,
+  0x84, 0x00, 0x07, 0x88, 0x88, 0x33, 0x33, 0x88, 0x8B, 0x33, 0xA5, 0x80, 0x03, 0x00, 0x72, 0x80,
+  0x03, 0x00, 0x76, 0x80, 0x03, 0x1C, 0x52, 0x88, 0x87, 0x33, 0x56, 0x88, 0xB3, 0x33, 0x56, 0x8C,
+  0x33, 0x33, 0x56, 0x75, 0x53, 0x75, 0x5A, 0x22, 0x53, 0x72, 0x22, 0x26, 0xA3, 0x72, 0x26, 0x66,
+  0xA3, 0x22, 0x66, 0x83, 0x03, 0x00, 0x52, 0x80, 0x03, 0x06, 0x32, 0x66, 0x66, 0x23, 0x35, 0x66,
+  0x91, 0x80, 0x43, 0x80, 0xA4, 0x02, 0x11, 0x43, 0xD1, 0x80, 0x03, 0x1B, 0x98, 0x11, 0x11, 0xE3,
+  0x92, 0x51, 0x11, 0x43, 0x34, 0x25, 0x81, 0x24, 0x33, 0x22, 0x35, 0xC2, 0xB3, 0x42, 0x33, 0xD3,
+  0x33, 0x3E, 0x22, 0x17, 0x33, 0x34, 0x22, 0x18, 0x81, 0xEB, 0x04, 0xD3, 0x39, 0x79, 0x11, 0x1D,
+  0x87, 0x93, 0x80, 0x2E, 0x07, 0x11, 0xB3, 0xF2, 0x2F, 0x33, 0xB3, 0x42, 0x22, 0x80, 0x1D, 0x1B,
+  0x34, 0xD8, 0x33, 0x33, 0x51, 0x11, 0x89, 0x92, 0x81, 0x11, 0x1D, 0xB2, 0x65, 0xD9, 0x15, 0xB2,
+  0x22, 0xB3, 0x15, 0x96, 0x22, 0xFE, 0x73, 0x33, 0xA8, 0x11, 0x4D, 0x51, 0x82, 0x2E, 0x09, 0x15,
+  0x11, 0x11, 0x57, 0x33, 0x85, 0x73, 0x33, 0x33, 0x93, 0x80, 0x2D, 0x00, 0x43, 0x80, 0x03, 0x80,
+  0x0A, 0x00, 0x33, 0x82, 0x19, 0x06, 0xCC, 0xC4, 0x44, 0x93, 0x33, 0x37, 0xB4, 0x80, 0x0E, 0x8E,
+  0x00, 0x80, 0x1B, 0x03, 0x33, 0x44, 0x44, 0x44, 0x80, 0x03, 0x05, 0x4B, 0x33, 0x33, 0x7B, 0xB3,
+  0x37, 0x80, 0x12, 0x1C, 0x3B, 0x33, 0x33, 0x77, 0xB8, 0x33, 0x78, 0x88, 0x8C, 0x37, 0x88, 0x88,
+  0xC1, 0xAA, 0xAA, 0xAA, 0x11, 0xA5, 0x15, 0xAA, 0xA5, 0xA1, 0x11, 0xAA, 0xA9, 0xA8, 0x11, 0x5A,
+  0x73, 0x80, 0x03, 0x00, 0x93, 0x81, 0x03, 0x07, 0x81, 0x11, 0x5A, 0x79, 0x11, 0x11, 0x18, 0xAA,
+  0x81, 0x5E, 0x00, 0x88, 0x80, 0x03, 0x0E, 0x9A, 0xA7, 0xA5, 0x58, 0x3A, 0xA3, 0x37, 0xAA, 0x7A,
+  0xA9, 0x33, 0x9A, 0xAA, 0xAA, 0xE3, 0x80, 0x03, 0x83, 0x00, 0x03, 0x11, 0x88, 0x88, 0xA7, 0x85,
+  0xCF, 0x0A, 0xAA, 0x55, 0x55, 0x7D, 0xAA, 0xAA, 0xA7, 0x33, 0xAA, 0xAA, 0xA9, 0x80, 0x03, 0x00,
+  0x73, 0x80, 0x03, 0x09, 0x33, 0x33, 0x79, 0x94, 0x43, 0x94, 0x11, 0x11, 0x8D, 0x72, 0x81, 0x1F,
+  0x13, 0x58, 0x81, 0x11, 0x11, 0x42, 0x22, 0x7D, 0x81, 0x4C, 0x2C, 0xB3, 0x42, 0x42, 0x22, 0xB3,
+  0x32, 0x42, 0x2C, 0x23, 0x34, 0x80, 0x95, 0x0D, 0x92, 0x22, 0x2B, 0xDD, 0x85, 0x52, 0x45, 0x11,
+  0x11, 0x12, 0x21, 0x11, 0x11, 0x82, 0x80, 0x03, 0x00, 0x22, 0x80, 0xEF, 0x01, 0x2C, 0xC1, 0x80,
+  0xD6, 0x03, 0x2C, 0x81, 0x18, 0x48, 0x85, 0x5C, 0x83, 0x00, 0x0C, 0x59, 0x11, 0x11, 0x17, 0x34,
+  0x11, 0x18, 0x93, 0x34, 0x87, 0x93, 0x33, 0x34, 0x80, 0xCB, 0x09, 0x34, 0x11, 0x89, 0xF2, 0x2F,
+  0x15, 0xB3, 0x42, 0x22, 0x73, 0x84, 0xEF, 0x09, 0x22, 0xE3, 0x92, 0x22, 0x22, 0xF3, 0xB2, 0x62,
+  0x22, 0x43, 0x80, 0x03, 0x0A, 0xE3, 0x92, 0x66, 0x33, 0x73, 0x33, 0x9A, 0x33, 0xE3, 0x33, 0x39,
+  0x84, 0x1E, 0x02, 0x33, 0xB3, 0x93, 0x80, 0x03, 0x00, 0xE3, 0x80, 0x03, 0x03, 0x43, 0x33, 0x33,
+  0xFE, 0x80, 0x34, 0x00, 0x44, 0x80, 0x00, 0x03, 0xBB, 0xBB, 0xB4, 0x44, 0x80, 0x1A, 0x00, 0x37,
+  0x85, 0x23, 0x89, 0x00, 0x85, 0x78, 0x08, 0x3B, 0x11, 0x11, 0x13, 0x22, 0x27, 0x63, 0x37, 0x22,
+  0x83, 0x00, 0x09, 0x76, 0x22, 0x22, 0x7A, 0xAA, 0x22, 0x27, 0xAA, 0xAA, 0x22, 0x80, 0x1B, 0x82,
+  0x03, 0x03, 0xA1, 0x11, 0x11, 0x25, 0x80, 0x07, 0x04, 0x24, 0x11, 0x11, 0x1A, 0x41, 0x80, 0x03,
+  0x8B, 0xB6, 0x11, 0x11, 0x11, 0x18, 0x81, 0x14, 0x41, 0x42, 0x21, 0x12, 0x24, 0x82, 0x41, 0x18,
+  0x22, 0x82, 0x11, 0x11, 0x52, 0x8C, 0xD7, 0x00, 0x14, 0x80, 0x30, 0x00, 0x14, 0x81, 0x07, 0x00,
+  0x81, 0x83, 0x03, 0x00, 0x18, 0x80, 0x0B, 0x00, 0x42, 0x80, 0x46, 0x12, 0x22, 0x33, 0x33, 0x75,
+  0x53, 0x33, 0xA5, 0x22, 0x53, 0x33, 0x72, 0x26, 0xA3, 0x33, 0x72, 0x66, 0xA3, 0x33, 0x52, 0x88,
+  0x03, 0x09, 0x56, 0x66, 0x23, 0x75, 0x5A, 0x33, 0x33, 0x72, 0x22, 0x23, 0x80, 0x1E, 0x17, 0xF3,
+  0x3F, 0x22, 0x66, 0x53, 0x72, 0x22, 0x62, 0x53, 0x72, 0x52, 0x66, 0xF3, 0x35, 0x32, 0x66, 0x25,
+  0x33, 0x35, 0x66, 0x62, 0xA3, 0x72, 0xA3, 0x83, 0xC7, 0x81, 0x06, 0x00, 0x2A, 0x80, 0x03, 0x80,
+  0x50, 0x86, 0x03, 0x00, 0x52, 0x80, 0x03, 0x07, 0x39, 0x22, 0xB3, 0xF6, 0x3E, 0x22, 0xB3, 0x42,
+  0x85, 0xEF, 0x12, 0x34, 0x22, 0xE3, 0x92, 0x34, 0x62, 0xF3, 0xB2, 0x34, 0x62, 0x43, 0xB2, 0x34,
+  0x66, 0xE3, 0x92, 0x6F, 0x33, 0x73, 0x80, 0x2B, 0x00, 0xE3, 0x85, 0x1E, 0x07, 0x33, 0x22, 0xB3,
+  0x93, 0x33, 0x62, 0xB3, 0xE3, 0x80, 0x03, 0x0D, 0x43, 0x33, 0x62, 0xFE, 0x73, 0x33, 0x74, 0x44,
+  0x44, 0x44, 0x3B, 0xBB, 0xBB, 0xB4, 0x86, 0x20, 0x8C, 0x00, 0x85, 0xE0, 0x08, 0x26, 0x3B, 0x11,
+  0x11, 0x22, 0x22, 0x27, 0x63, 0x22, 0x87, 0x00, 0x00, 0x7A, 0x80, 0x0F, 0x03, 0xAA, 0x11, 0x22,
+  0xAA, 0x82, 0x03, 0x00, 0x13, 0x80, 0x03, 0x0A, 0x37, 0x26, 0xAA, 0xAA, 0x22, 0x23, 0xAA, 0xAA,
+  0x76, 0x3A, 0xAA, 0x86, 0x00, 0x80, 0x3A, 0x00, 0x1A, 0x85, 0x03, 0x04, 0x1C, 0xC1, 0x11, 0x1A,
+  0x00, 0x8C, 0x00, 0x80, 0x91, 0x04, 0x66, 0x33, 0x33, 0x75, 0x55, 0x85, 0x6F, 0x8D, 0x1F, 0x07,
+  0x25, 0x32, 0x66, 0x22, 0x55, 0x55, 0xDD, 0xDD, 0x95, 0x1F, 0x01, 0x27, 0x22, 0x80, 0x41, 0x80,
+  0x03, 0x01, 0x33, 0x75, 0x93, 0x1F, 0x0F, 0x33, 0x34, 0x22, 0x24, 0x33, 0x34, 0x66, 0x62, 0x33,
+  0x34, 0x2F, 0x94, 0x33, 0x34, 0x2E, 0x39, 0x8D, 0x1F, 0x0F, 0x72, 0x26, 0x22, 0x23, 0x22, 0x42,
+  0x62, 0x23, 0x2E, 0x3E, 0x22, 0x23, 0x24, 0x33, 0x42, 0x23, 0x8F, 0x9F, 0x87, 0x00, 0x00, 0x3A,
+  0x91, 0x5F, 0x02, 0x33, 0x33, 0x38, 0x80, 0x03, 0x00, 0x78, 0x80, 0x03, 0x04, 0x88, 0x33, 0x33,
+  0x37, 0x88, 0x8D, 0x1F, 0x80, 0xF7, 0x88, 0x00, 0x01, 0x82, 0x84, 0x99, 0x1F, 0x03, 0x44, 0x14,
+  0xC1, 0x11, 0x9A, 0x3F, 0x00, 0x1C, 0x8F, 0x1F, 0x03, 0x1A, 0x22, 0x22, 0xEE, 0x80, 0x03, 0x00,
+  0x5B, 0x80, 0x03, 0x00, 0x22, 0x81, 0x03, 0x8D, 0x1F, 0x07, 0x22, 0x65, 0x32, 0x66, 0x55, 0x55,
+  0x55, 0xFD, 0x85, 0xC3, 0x8E, 0x1F, 0x05, 0x27, 0x22, 0x33, 0xDD, 0x22, 0x22, 0x80, 0x19, 0x00,
+  0x75, 0x92, 0x1F, 0x05, 0x33, 0x81, 0x11, 0x11, 0x33, 0xD1, 0x80, 0x03, 0x06, 0x35, 0x11, 0x18,
+  0x33, 0x33, 0x34, 0x29, 0x8D, 0x1F, 0x0F, 0x18, 0x72, 0x22, 0x26, 0x1D, 0x22, 0x42, 0x26, 0xE4,
+  0x2E, 0x3E, 0x66, 0x39, 0x24, 0x33, 0x46, 0x8D, 0x1F, 0x00, 0x23, 0x80, 0x53, 0x86, 0x03, 0x02,
+  0x37, 0x11, 0x88, 0x8E, 0x5F, 0x85, 0x00, 0x02, 0x99, 0x97, 0xD5, 0x81, 0xE2, 0x8D, 0x1F, 0x07,
+  0x3A, 0xAA, 0xA5, 0x11, 0x9A, 0x58, 0x11, 0x11, 0x80, 0x86, 0x80, 0x00, 0x01, 0x18, 0x73, 0x8D,
+  0x1F, 0x81, 0x14, 0x81, 0x19, 0x07, 0x81, 0x15, 0x58, 0x11, 0x51, 0x1D, 0xA7, 0xA5, 0x8D, 0x1F,
+  0x07, 0x5A, 0xAA, 0xAA, 0xAA, 0x11, 0x88, 0x88, 0x88, 0x82, 0x23, 0x90, 0x5F, 0x04, 0xAA, 0xAA,
+  0x33, 0x33, 0x85, 0x80, 0x03, 0x03, 0x11, 0x11, 0x88, 0x55, 0x91, 0x7F, 0x09, 0x22, 0xCC, 0x24,
+  0xB2, 0x94, 0x44, 0x44, 0x44, 0x55, 0x73, 0x80, 0x23, 0x02, 0x17, 0x33, 0x33, 0x8D, 0x1F, 0x07,
+  0x66, 0x62, 0x27, 0x22, 0xDD, 0xDD, 0x22, 0x22, 0x80, 0xC1, 0x00, 0x75, 0x81, 0xC6, 0x90, 0xDF,
+  0x00, 0x35, 0x89, 0x03, 0x8E, 0x5F, 0x0D, 0x24, 0x72, 0x22, 0x66, 0x22, 0x22, 0x42, 0x2F, 0x94,
+  0x2E, 0x3E, 0x29, 0x39, 0x24, 0x8E, 0x3F, 0x03, 0x22, 0x23, 0x33, 0x33, 0x82, 0x03, 0x80, 0x7F,
+  0x02, 0x46, 0x23, 0x3B, 0x91, 0x5F, 0x8A, 0x00, 0x8E, 0x1F, 0x04, 0x38, 0x88, 0x88, 0x33, 0x78,
+  0x80, 0x03, 0x03, 0x88, 0x88, 0x88, 0x37, 0x80, 0x03, 0x8D, 0x1F, 0x81, 0xF3, 0x85, 0x00, 0x03,
+  0x82, 0x54, 0x44, 0xC4, 0x99, 0x1F, 0x03, 0xC1, 0x11, 0x11, 0x1C, 0x8F, 0x1F, 0x01, 0x1A, 0x22,
+  0x85, 0x03, 0x00, 0xC1, 0x80, 0x03, 0x8E, 0x7F, 0x06, 0x26, 0x66, 0x25, 0x33, 0x75, 0x55, 0x55,
+  0x95, 0x9F, 0x07, 0x32, 0x26, 0x22, 0x27, 0x55, 0xDD, 0xDD, 0x22, 0x95, 0x1F, 0x81, 0x18, 0x81,
+  0x03, 0x00, 0x75, 0x94, 0x1F, 0x0F, 0x34, 0x26, 0x24, 0x72, 0x34, 0x22, 0x22, 0x22, 0x34, 0x2F,
+  0x94, 0x2E, 0x34, 0x29, 0x39, 0x24, 0x8D, 0x1F, 0x08, 0x26, 0x26, 0x23, 0x33, 0x42, 0x66, 0x23,
+  0x33, 0x3E, 0x80, 0x03, 0x03, 0x33, 0x46, 0x23, 0x3B, 0x8E, 0x9F, 0x05, 0x33, 0x38, 0x88, 0x33,
+  0x33, 0x78, 0x80, 0x03, 0x05, 0x88, 0x88, 0x33, 0x37, 0x88, 0x88, 0x96, 0xFF, 0x00, 0xA1, 0x80,
+  0x03, 0x02, 0x82, 0x54, 0x44, 0x8D, 0x1F,
+};
+static const u8 ILLUSTRATION_MAP_skel_a[] = {
+  0x08, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x9A, 0x00, 0x7F, 0x40, 0x01, 0x40, 0x02, 0x40, 0x03, 0x60,
+  0x04, 0x60, 0x05, 0x60, 0x06, 0x20, 0x07, 0x20, 0x08, 0x00, 0x09, 0x20, 0x0A, 0x40, 0x0B, 0x40,
+  0x0C, 0x40, 0x0D, 0x60, 0x0E, 0x60, 0x0F, 0x60, 0x10, 0x20, 0x11, 0x20, 0x12, 0x00, 0x13, 0x20,
+  0x14, 0x20, 0x15, 0x40, 0x16, 0x40, 0x17, 0x60, 0x18, 0x60, 0x19, 0x60, 0x1A, 0x60, 0x1B, 0x20,
+  0x1C, 0x00, 0x1D, 0x00, 0x1E, 0x20, 0x1F, 0x40, 0x20, 0x40, 0x21, 0x00, 0x22, 0x60, 0x23, 0x60,
+  0x24, 0x60, 0x25, 0x20, 0x26, 0x00, 0x27, 0x00, 0x28, 0x40, 0x29, 0x40, 0x2A, 0x00, 0x2B, 0x00,
+  0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x20, 0x2F, 0x20, 0x30, 0x20, 0x31, 0x00, 0x32, 0x40, 0x33, 0x40,
+  0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x20, 0x39, 0x20, 0x3A, 0x20, 0x3B, 0x00,
+  0x3C, 0x20, 0x3D, 0x40, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x7F, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
+  0x00, 0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x40, 0x48, 0x40, 0x49, 0x00, 0x4A, 0x00, 0x4B,
+  0x00, 0x4C, 0x00, 0x4D, 0x20, 0x4E, 0x20, 0x4F, 0x20, 0x50, 0x40, 0x51, 0x40, 0x52, 0x00, 0x53,
+  0x00, 0x54, 0x00, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5A, 0x20, 0x5B,
+  0x40, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60, 0x20, 0x61, 0x20, 0x62, 0x20, 0x63,
+  0x00, 0x64, 0x20, 0x65, 0x40, 0x66, 0x20, 0x67, 0x00, 0x68, 0x20, 0x69, 0x00, 0x6A, 0x20, 0x6B,
+  0x20, 0x6C, 0x20, 0x6D, 0x20, 0x6E, 0x20, 0x6F, 0x40, 0x70, 0x40, 0x71, 0x00, 0x72, 0x00, 0x73,
+  0x00, 0x74, 0x00, 0x75, 0x20, 0x76, 0x20, 0x77, 0x20, 0x78, 0x40, 0x79, 0x40, 0x7A, 0x20, 0x7B,
+  0x20, 0x7C, 0x20, 0x7D, 0x60, 0x7E, 0x00, 0x7F, 0x00, 0x80, 0x7F, 0x20, 0x81, 0x00, 0x82, 0x40,
+  0x83, 0x00, 0x84, 0x20, 0x85, 0x20, 0x86, 0x20, 0x87, 0x00, 0x88, 0x20, 0x89, 0x00, 0x8A, 0x00,
+  0x8B, 0x20, 0x8C, 0x00, 0x8D, 0x20, 0x8E, 0x20, 0x8F, 0x20, 0x90, 0x20, 0x91, 0x20, 0x92, 0x60,
+  0x93, 0x00, 0x94, 0x00, 0x95, 0x20, 0x96, 0x40, 0x97, 0x40, 0x98, 0x20, 0x99, 0x00, 0x9A, 0x00,
+  0x9B, 0x00, 0x9C, 0x00, 0x9D, 0x20, 0x9E, 0x20, 0x9F, 0x20, 0xA0, 0x40, 0xA1, 0x60, 0xA2, 0x20,
+  0xA3, 0x60, 0xA4, 0x60, 0xA5, 0x60, 0xA6, 0x00, 0xA7, 0x00, 0xA8, 0x00, 0xA9, 0x00, 0xAA, 0x40,
+  0xAB, 0x00, 0xAC, 0x20, 0xAD, 0x20, 0xAE, 0x60, 0xAF, 0x60, 0xB0, 0x00, 0xB1, 0x00, 0xB2, 0x00,
+  0xB3, 0x60, 0xB4, 0x00, 0xB5, 0x60, 0xB6, 0x20, 0xB7, 0x20, 0xB8, 0x00, 0xB9, 0x20, 0xBA, 0x60,
+  0xBB, 0x00, 0xBC, 0x00, 0xBD, 0x20, 0xBE, 0x40, 0xBF, 0x40, 0xC0, 0x7F, 0x00, 0xC1, 0x00, 0xC2,
+  0x00, 0xC3, 0x60, 0xC4, 0x60, 0xC5, 0x20, 0xC6, 0x20, 0xC7, 0x20, 0xC8, 0x40, 0xC9, 0x20, 0xCA,
+  0x20, 0xCB, 0x00, 0xCC, 0x00, 0xCD, 0x60, 0xCE, 0x00, 0xCF, 0x00, 0xD0, 0x00, 0xD1, 0x00, 0xD2,
+  0x60, 0xD3, 0x20, 0xD4, 0x20, 0xD5, 0x20, 0xD6, 0x00, 0xD7, 0x60, 0xD8, 0x00, 0xD9, 0x00, 0xDA,
+  0x00, 0xDB, 0x60, 0xDC, 0x00, 0xDD, 0x00, 0xDE, 0x20, 0xDF, 0x00, 0xE0, 0x00, 0xE1, 0x60, 0xE2,
+  0x60, 0xE3, 0x00, 0xE4, 0x20, 0xE5, 0x40, 0xE6, 0x40, 0xE7, 0x40, 0xE8, 0x00, 0xE9, 0x00, 0xEA,
+  0x00, 0xEB, 0x60, 0xEC, 0x00, 0xED, 0x00, 0xEE, 0x20, 0xEF, 0x40, 0xF0, 0x40, 0xF1, 0x40, 0xF2,
+  0x40, 0xF3, 0x60, 0xF4, 0x60, 0xF5, 0x60, 0xF6, 0x60, 0xF7, 0x40, 0xF8, 0x40, 0xF9, 0x40, 0xFA,
+  0x40, 0xFB, 0x40, 0xFC, 0x40, 0xFD, 0x00, 0xFE, 0x60, 0xFF, 0x61, 0x00, 0x43, 0x61, 0x01, 0x41,
+  0x02, 0x41, 0x03, 0x41, 0x04, 0x41, 0x05, 0x41, 0x06, 0x41, 0x07, 0x01, 0x08, 0x61, 0x09, 0x61,
+  0x0A, 0x61, 0x0B, 0x61, 0x0C, 0x41, 0x0D, 0x41, 0x0E, 0x41, 0x0F, 0x41, 0x10, 0x41, 0x11, 0x41,
+  0x12, 0x61, 0x13, 0x61, 0x14, 0x61, 0x15, 0x61, 0x16, 0x41, 0x17, 0x41, 0x18, 0x01, 0x19, 0x01,
+  0x19, 0x41, 0x1A, 0x61, 0x1B, 0x61, 0x1C, 0x61, 0x1D, 0x61, 0x1E, 0x41, 0x1F, 0x41, 0x20, 0x41,
+  0x21, 0x82, 0x13, 0x10, 0x22, 0x61, 0x23, 0x61, 0x24, 0x61, 0x25, 0x61, 0x26, 0x00, 0xEE, 0x41,
+  0x27, 0x41, 0x28, 0x41, 0x29, 0x80, 0x13, 0x10, 0x2A, 0x61, 0x2B, 0x61, 0x2C, 0x61, 0x2D, 0x61,
+  0x2E, 0x01, 0x2F, 0x41, 0x30, 0x41, 0x31, 0x41, 0x32, 0x80, 0x13, 0x7F, 0x33, 0x41, 0x34, 0x61,
+  0x35, 0x61, 0x36, 0x61, 0x37, 0x01, 0x38, 0x41, 0x39, 0x41, 0x3A, 0x41, 0x3B, 0x41, 0x3C, 0x41,
+  0x3D, 0x21, 0x3E, 0x61, 0x3F, 0x61, 0x40, 0x21, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01,
+  0x45, 0x41, 0x46, 0x41, 0x47, 0x61, 0x48, 0x61, 0x49, 0x61, 0x4A, 0x21, 0x4B, 0x21, 0x4C, 0x21,
+  0x4D, 0x21, 0x4E, 0x21, 0x4F, 0x41, 0x50, 0x41, 0x51, 0x01, 0x52, 0x61, 0x53, 0x61, 0x54, 0x61,
+  0x55, 0x01, 0x56, 0x21, 0x57, 0x21, 0x58, 0x21, 0x59, 0x41, 0x5A, 0x41, 0x5B, 0x01, 0x5C, 0x61,
+  0x5D, 0x61, 0x5E, 0x61, 0x5F, 0x21, 0x60, 0x21, 0x61, 0x21, 0x62, 0x41, 0x63, 0x41, 0x64, 0x21,
+  0x65, 0x21, 0x66, 0x21, 0x67, 0x01, 0x68, 0x01, 0x69, 0x61, 0x6A, 0x01, 0x6B, 0x01, 0x6C, 0x21,
+  0x6D, 0x41, 0x6E, 0x01, 0x6F, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x7F, 0x73, 0x01, 0x74,
+  0x21, 0x75, 0x21, 0x76, 0x21, 0x77, 0x41, 0x78, 0x41, 0x79, 0x01, 0x7A, 0x01, 0x7B, 0x01, 0x7C,
+  0x01, 0x7D, 0x01, 0x7E, 0x01, 0x7F, 0x21, 0x80, 0x21, 0x81, 0x41, 0x82, 0x41, 0x83, 0x01, 0x84,
+  0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88, 0x21, 0x89, 0x21, 0x8A, 0x41, 0x8B, 0x41, 0x8C,
+  0x01, 0x8D, 0x21, 0x8E, 0x21, 0x8F, 0x21, 0x90, 0x01, 0x91, 0x01, 0x92, 0x21, 0x93, 0x01, 0x94,
+  0x21, 0x95, 0x41, 0x96, 0x01, 0x97, 0x61, 0x98, 0x01, 0x99, 0x01, 0x9A, 0x01, 0x9B, 0x21, 0x9C,
+  0x21, 0x9D, 0x21, 0x9E, 0x21, 0x9F, 0x41, 0xA0, 0x01, 0xA1, 0x01, 0xA2, 0x01, 0xA3, 0x01, 0xA4,
+  0x01, 0xA5, 0x21, 0xA6, 0x21, 0xA7, 0x21, 0xA8, 0x21, 0xA9, 0x41, 0xAA, 0x01, 0xAB, 0x01, 0xAC,
+  0x01, 0xAD, 0x01, 0xAE, 0x01, 0xAF, 0x21, 0xB0, 0x21, 0xB1, 0x21, 0xB2, 0x41, 0x7F, 0xB3, 0x41,
+  0xB4, 0x01, 0xB5, 0x01, 0xB6, 0x01, 0xB7, 0x61, 0xB8, 0x21, 0xB9, 0x21, 0xBA, 0x21, 0xBB, 0x21,
+  0xBC, 0x41, 0xBD, 0x41, 0xBE, 0x61, 0xBF, 0x61, 0xC0, 0x61, 0xC1, 0x01, 0xC2, 0x21, 0xC3, 0x21,
+  0xC4, 0x21, 0xC5, 0x21, 0xC6, 0x41, 0xC7, 0x41, 0xC8, 0x01, 0xC9, 0x01, 0xCA, 0x01, 0xCB, 0x01,
+  0xCC, 0x61, 0xCD, 0x21, 0xCE, 0x21, 0xCF, 0x21, 0xD0, 0x21, 0xD1, 0x41, 0xD2, 0x01, 0xD3, 0x01,
+  0xD4, 0x01, 0xD5, 0x01, 0xD6, 0x61, 0xD7, 0x21, 0xD8, 0x21, 0xD9, 0x21, 0xDA, 0x41, 0xDB, 0x41,
+  0xDC, 0x01, 0xDD, 0x01, 0xDE, 0x61, 0xDF, 0x61, 0xE0, 0x21, 0xE1, 0x21, 0xE2, 0x21, 0xE3, 0x41,
+  0xE4, 0x41, 0xE5, 0x41, 0xE6, 0x61, 0xE7, 0x61, 0xE8, 0x61, 0xE9, 0x61, 0xEA, 0x01, 0xEB, 0x21,
+  0xEC, 0x01, 0xED, 0x61, 0xEE, 0x61, 0xEF, 0x61, 0xF0, 0x61, 0xF1, 0x01, 0xF2, 0x01, 0x7F, 0xF3,
+  0x61, 0xF4, 0x61, 0xF5, 0x01, 0xF6, 0x01, 0xF7, 0x21, 0xF8, 0x41, 0xF9, 0x41, 0xFA, 0x01, 0xFB,
+  0x01, 0xFC, 0x01, 0xFD, 0x61, 0xFE, 0x61, 0xFF, 0x22, 0x00, 0x22, 0x01, 0x22, 0x02, 0x42, 0x03,
+  0x22, 0x04, 0x02, 0x05, 0x02, 0x06, 0x62, 0x07, 0x62, 0x08, 0x42, 0x09, 0x22, 0x0A, 0x22, 0x0B,
+  0x42, 0x0C, 0x42, 0x0D, 0x42, 0x0E, 0x62, 0x0F, 0x62, 0x10, 0x62, 0x11, 0x62, 0x12, 0x22, 0x13,
+  0x62, 0x14, 0x62, 0x15, 0x62, 0x16, 0x02, 0x17, 0x02, 0x17, 0x62, 0x18, 0x62, 0x19, 0x62, 0x1A,
+  0x62, 0x1B, 0x62, 0x1C, 0x62, 0x1D, 0x22, 0x1E, 0x42, 0x1F, 0x42, 0x20, 0x42, 0x21, 0x02, 0x22,
+  0x02, 0x23, 0x02, 0x24, 0x62, 0x25, 0x62, 0x26, 0x42, 0x27, 0x22, 0x28, 0x42, 0x29, 0x42, 0x2A,
+  0x42, 0x2B, 0x02, 0x2C, 0x62, 0x2D, 0x62, 0x2E, 0x62, 0x2F, 0x62, 0x30, 0x42, 0x31, 0x42, 0x10,
+  0x32, 0x42, 0x33, 0x42, 0x34, 0x42, 0x35, 0x62, 0x36, 0x62, 0x37, 0x62, 0x38, 0x62, 0x39, 0x62,
+  0x3A, 0x80, 0x47, 0x02, 0x3B, 0x62, 0x3C, 0x80, 0x05, 0x36, 0x3D, 0x62, 0x3E, 0x62, 0x3F, 0x62,
+  0x40, 0x62, 0x41, 0x62, 0x42, 0x02, 0x43, 0x42, 0x44, 0x42, 0x45, 0x42, 0x46, 0x42, 0x47, 0x42,
+  0x48, 0x02, 0x49, 0x62, 0x4A, 0x62, 0x4B, 0x62, 0x4C, 0x62, 0x4D, 0x42, 0x4E, 0x42, 0x4F, 0x01,
+  0x19, 0x01, 0x19, 0x42, 0x50, 0x62, 0x51, 0x62, 0x52, 0x62, 0x53, 0x62, 0x54, 0x42, 0x55, 0x42,
+  0x56, 0x81, 0x11, 0x0B, 0x01, 0x19, 0x62, 0x57, 0x62, 0x58, 0x62, 0x59, 0x62, 0x5A, 0x62, 0x5B,
+  0x80, 0x49, 0x06, 0x5C, 0x02, 0x5D, 0x62, 0x5E, 0x62, 0x5F, 0x80, 0x05, 0x0C, 0x60, 0x62, 0x61,
+  0x62, 0x62, 0x62, 0x63, 0x62, 0x64, 0x42, 0x65, 0x42, 0x66, 0x83, 0x29, 0x7F, 0x42, 0x67, 0x62,
+  0x68, 0x62, 0x69, 0x62, 0x6A, 0x62, 0x6B, 0x42, 0x6C, 0x42, 0x6D, 0x42, 0x6E, 0x42, 0x6F, 0x42,
+  0x70, 0x62, 0x71, 0x62, 0x72, 0x62, 0x73, 0x02, 0x74, 0x02, 0x75, 0x22, 0x76, 0x22, 0x77, 0x42,
+  0x78, 0x62, 0x79, 0x62, 0x7A, 0x62, 0x7B, 0x62, 0x7C, 0x62, 0x7D, 0x02, 0x7E, 0x02, 0x7F, 0x62,
+  0x80, 0x62, 0x81, 0x62, 0x82, 0x62, 0x83, 0x62, 0x84, 0x62, 0x85, 0x62, 0x86, 0x62, 0x87, 0x62,
+  0x88, 0x02, 0x89, 0x22, 0x8A, 0x22, 0x8B, 0x22, 0x8C, 0x42, 0x8D, 0x42, 0x8E, 0x22, 0x8F, 0x62,
+  0x90, 0x62, 0x91, 0x62, 0x92, 0x02, 0x93, 0x22, 0x94, 0x22, 0x95, 0x42, 0x96, 0x42, 0x97, 0x02,
+  0x98, 0x02, 0x99, 0x02, 0x9A, 0x02, 0x9B, 0x22, 0x9C, 0x22, 0x9D, 0x22, 0x9E, 0x22, 0x9F, 0x42,
+  0xA0, 0x62, 0xA1, 0x42, 0xA2, 0x02, 0xA3, 0x02, 0xA4, 0x02, 0xA5, 0x22, 0xA6, 0x05, 0x22, 0xA7,
+  0x62, 0xA8, 0x02, 0x17, 0x81, 0x01, 0x7F, 0x62, 0xA9, 0x62, 0xAA, 0x02, 0xAB, 0x02, 0xAC, 0x02,
+  0xAD, 0x62, 0xAE, 0x22, 0xAF, 0x22, 0xB0, 0x22, 0xB1, 0x42, 0xB2, 0x42, 0xB3, 0x02, 0xB4, 0x02,
+  0xB5, 0x02, 0xB6, 0x02, 0xB7, 0x22, 0xB8, 0x22, 0xB9, 0x22, 0xBA, 0x42, 0xBB, 0x42, 0xBC, 0x02,
+  0xBD, 0x02, 0xBE, 0x02, 0xBF, 0x02, 0xC0, 0x22, 0xC1, 0x22, 0xC2, 0x22, 0xC3, 0x22, 0xC4, 0x22,
+  0xC5, 0x62, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x02, 0xC9, 0x02, 0xCA, 0x22, 0xCB, 0x22, 0xCC, 0x62,
+  0xCD, 0x62, 0xCE, 0x62, 0xCF, 0x62, 0xD0, 0x62, 0xD1, 0x02, 0xD2, 0x02, 0xD3, 0x02, 0xD4, 0x22,
+  0xD5, 0x02, 0xD6, 0x22, 0xD7, 0x22, 0xD8, 0x22, 0xD9, 0x42, 0xDA, 0x02, 0xDB, 0x02, 0xDC, 0x02,
+  0xDD, 0x02, 0xDE, 0x02, 0xDF, 0x22, 0xE0, 0x22, 0xE1, 0x22, 0xE2, 0x42, 0xE3, 0x42, 0xE4, 0x02,
+  0xE5, 0x02, 0xE6, 0x02, 0xE7, 0x02, 0xE8, 0x7F, 0x22, 0xE9, 0x22, 0xEA, 0x22, 0xEB, 0x22, 0xEC,
+  0x42, 0xED, 0x62, 0xEE, 0x62, 0xEF, 0x62, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4,
+  0x62, 0xF5, 0x62, 0xF6, 0x62, 0xF7, 0x62, 0xF8, 0x62, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x62, 0xFC,
+  0x62, 0xFD, 0x02, 0xFE, 0x22, 0xFF, 0x23, 0x00, 0x23, 0x01, 0x43, 0x02, 0x43, 0x03, 0x03, 0x04,
+  0x03, 0x05, 0x03, 0x06, 0x03, 0x07, 0x23, 0x08, 0x23, 0x09, 0x23, 0x0A, 0x43, 0x0B, 0x43, 0x0C,
+  0x03, 0x0D, 0x03, 0x0E, 0x63, 0x0F, 0x63, 0x10, 0x23, 0x11, 0x23, 0x12, 0x23, 0x13, 0x43, 0x14,
+  0x43, 0x15, 0x03, 0x16, 0x63, 0x17, 0x63, 0x18, 0x63, 0x19, 0x63, 0x1A, 0x03, 0x1B, 0x23, 0x1C,
+  0x63, 0x1D, 0x63, 0x1E, 0x63, 0x1F, 0x63, 0x20, 0x63, 0x21, 0x03, 0x22, 0x63, 0x23, 0x63, 0x24,
+  0x23, 0x25, 0x23, 0x26, 0x23, 0x27, 0x23, 0x28, 0x7F, 0x43, 0x29, 0x43, 0x2A, 0x23, 0x2B, 0x03,
+  0x2C, 0x03, 0x2D, 0x63, 0x2E, 0x63, 0x2F, 0x23, 0x30, 0x23, 0x31, 0x23, 0x32, 0x43, 0x33, 0x23,
+  0x34, 0x03, 0x35, 0x03, 0x36, 0x63, 0x37, 0x63, 0x38, 0x03, 0x39, 0x23, 0x3A, 0x23, 0x3B, 0x43,
+  0x3C, 0x43, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x63, 0x40, 0x63, 0x41, 0x63, 0x42, 0x63, 0x43, 0x03,
+  0x44, 0x03, 0x45, 0x63, 0x46, 0x63, 0x47, 0x63, 0x48, 0x63, 0x49, 0x63, 0x4A, 0x63, 0x4B, 0x63,
+  0x4C, 0x63, 0x4D, 0x03, 0x4E, 0x23, 0x4F, 0x43, 0x50, 0x43, 0x51, 0x43, 0x52, 0x03, 0x53, 0x03,
+  0x54, 0x03, 0x55, 0x63, 0x56, 0x63, 0x57, 0x03, 0x58, 0x23, 0x59, 0x23, 0x5A, 0x43, 0x5B, 0x03,
+  0x5C, 0x03, 0x5D, 0x03, 0x5E, 0x63, 0x5F, 0x63, 0x60, 0x03, 0x61, 0x03, 0x62, 0x43, 0x63, 0x43,
+  0x64, 0x43, 0x65, 0x43, 0x66, 0x03, 0x67, 0x03, 0x68, 0x2D, 0x63, 0x69, 0x63, 0x6A, 0x63, 0x6B,
+  0x63, 0x6C, 0x63, 0x6D, 0x63, 0x6E, 0x63, 0x6F, 0x63, 0x70, 0x63, 0x71, 0x03, 0x72, 0x03, 0x73,
+  0x63, 0x74, 0x63, 0x75, 0x03, 0x76, 0x03, 0x77, 0x43, 0x78, 0x43, 0x79, 0x43, 0x7A, 0x03, 0x7B,
+  0x03, 0x7C, 0x03, 0x7D, 0x63, 0x7E, 0x63, 0x7F, 0x80, 0x13, 0x03, 0x80, 0x43, 0x81, 0x00, 0xFF,
+  0x00, 0xEA, 0x00,
+};
+
+// ---- skel_b: ../content/images/skel-test-00625.bmp, 826 tiles (826 unique, 5 cells flipped), 19169 bytes packed ----
+static const u16 ILLUSTRATION_PALETTES_skel_b[64] = {
+  0x000, 0xEEE, 0x868, 0x222, 0x444, 0x02E, 0x86A, 0x686, 0x646, 0x424, 0x886, 0x848, 0x648, 0x464, 0x22A, 0x422,
+  0x000, 0xAAA, 0x686, 0x222, 0x444, 0x666, 0x68A, 0x464, 0x242, 0x688, 0x886, 0x668, 0x484, 0x446, 0x224, 0x466,
+  0x000, 0xAAA, 0x666, 0x222, 0xA68, 0x868, 0x444, 0x646, 0x424, 0x888, 0x644, 0x846, 0x686, 0x866, 0x422, 0xA8A,
+  0x000, 0x886, 0xAAA, 0x222, 0x444, 0x664, 0x86A, 0x666, 0x442, 0x868, 0x686, 0x8A6, 0x884, 0x646, 0x888, 0x8A8,
+};
+static const u8 ILLUSTRATION_TILES_skel_b[] = {
+  0x67, 0x40, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x33, 0x8B, 0x00, 0x13, 0x4F, 0x33, 0x33, 0x3D, 0x99,
+  0x33, 0x33, 0x49, 0x66, 0x33, 0x33, 0xBD, 0x4B, 0x33, 0x35, 0xD3, 0x3F, 0x44, 0x44, 0x48, 0x86,
+  0x1C, 0x13, 0xB9, 0x9B, 0xBF, 0x43, 0x99, 0x99, 0x99, 0x9B, 0x66, 0x66, 0x99, 0x66, 0x66, 0xBF,
+  0xB9, 0x96, 0x9B, 0x33, 0x39, 0x96, 0x8C, 0x3F, 0x01, 0x33, 0xD3, 0x80, 0x03, 0x00, 0x6D, 0x80,
+  0x03, 0x00, 0x6F, 0x80, 0x03, 0x00, 0x94, 0x80, 0x03, 0x04, 0x38, 0x55, 0x44, 0x44, 0x33, 0x81,
+  0x03, 0x00, 0xA5, 0x80, 0x03, 0x00, 0x3D, 0x80, 0x03, 0x02, 0x3E, 0xD5, 0x44, 0x80, 0x15, 0x00,
+  0x7B, 0x85, 0x2F, 0x0B, 0xD8, 0x33, 0x37, 0x44, 0x55, 0xDB, 0x55, 0x44, 0x55, 0x44, 0x54, 0x44,
+  0x81, 0x00, 0x80, 0x2A, 0x04, 0x55, 0x55, 0x55, 0xBB, 0xA8, 0x85, 0x1F, 0x82, 0x14, 0x82, 0x18,
+  0x07, 0x45, 0x5B, 0x44, 0x55, 0xB6, 0xE3, 0x5B, 0xAE, 0x8B, 0x6F, 0x11, 0x99, 0x93, 0x33, 0x33,
+  0x9D, 0x33, 0x33, 0x4A, 0x43, 0x33, 0x8A, 0xAA, 0x33, 0x34, 0xAA, 0xAA, 0x33, 0x3A, 0x80, 0x03,
+  0x0C, 0x5A, 0xA5, 0xAA, 0x38, 0xAA, 0x83, 0x33, 0x37, 0xAA, 0x33, 0x33, 0x87, 0x22, 0x8F, 0x00,
+  0x00, 0xC2, 0x80, 0x03, 0x00, 0x38, 0x80, 0x03, 0x0B, 0x33, 0x37, 0x22, 0x22, 0x77, 0x77, 0xD4,
+  0x33, 0x77, 0x77, 0x77, 0x7D, 0x80, 0x03, 0x92, 0x00, 0x81, 0x63, 0x00, 0x73, 0x80, 0x03, 0x01,
+  0x22, 0x24, 0x80, 0x03, 0x01, 0x22, 0x28, 0x80, 0x03, 0x01, 0x22, 0x43, 0x80, 0x03, 0x00, 0x24,
+  0x85, 0x4B, 0x8D, 0xFF, 0x80, 0x00, 0x00, 0x3D, 0x80, 0x03, 0x0C, 0x49, 0x83, 0x33, 0x33, 0xBD,
+  0x73, 0x33, 0x35, 0xD3, 0x33, 0x88, 0x88, 0x88, 0x85, 0x18, 0x06, 0x45, 0xB9, 0x9B, 0xFF, 0x99,
+  0x96, 0x66, 0x82, 0x00, 0x07, 0x4B, 0x66, 0xBF, 0xB6, 0x3F, 0x6B, 0x33, 0x39, 0x89, 0x38, 0x00,
+  0x43, 0x80, 0x03, 0x05, 0x6B, 0xD3, 0x33, 0x33, 0x66, 0x6D, 0x80, 0x03, 0x00, 0x6F, 0x80, 0x03,
+  0x00, 0x94, 0x80, 0x10, 0x05, 0x38, 0x54, 0x44, 0x33, 0x33, 0x55, 0x80, 0x03, 0x00, 0xA5, 0x80,
+  0x03, 0x00, 0x3D, 0x80, 0x03, 0x01, 0x3E, 0xD5, 0x81, 0x15, 0x85, 0x33, 0x0A, 0x44, 0x5E, 0x33,
+  0x37, 0x44, 0x55, 0xDB, 0x55, 0x44, 0x44, 0x44, 0x81, 0x03, 0x82, 0x04, 0x03, 0x7B, 0x55, 0x55,
+  0xBB, 0x86, 0x1F, 0x86, 0x00, 0x01, 0x55, 0x45, 0x80, 0x03, 0x05, 0xB6, 0x54, 0x57, 0xAE, 0x33,
+  0xA8, 0x88, 0x73, 0x00, 0x44, 0x80, 0x40, 0x0E, 0x44, 0x5B, 0xE3, 0x33, 0x5B, 0x63, 0x33, 0x6C,
+  0xE3, 0x33, 0x36, 0xCC, 0x33, 0x33, 0x3C, 0x80, 0x03, 0x01, 0x6C, 0xC6, 0x82, 0x0A, 0x00, 0x32,
+  0x80, 0x03, 0x03, 0x87, 0x22, 0x22, 0x42, 0x85, 0xEC, 0x84, 0x00, 0x00, 0x2C, 0x81, 0xF7, 0x00,
+  0x38, 0x81, 0xFB, 0x05, 0x37, 0x22, 0x77, 0x77, 0x77, 0xD4, 0x80, 0x03, 0x96, 0x00, 0x81, 0x63,
+  0x06, 0x27, 0x73, 0x33, 0x33, 0x22, 0x22, 0x24, 0x80, 0x03, 0x01, 0x22, 0x28, 0x8C, 0x4A, 0x80,
+  0x43, 0x8B, 0x00, 0x00, 0x43, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x01, 0x22, 0x83, 0x80, 0x03,
+  0x06, 0x73, 0x33, 0x35, 0x33, 0x33, 0x88, 0x88, 0x86, 0x1C, 0x13, 0x45, 0xBB, 0xBB, 0x3D, 0x96,
+  0x66, 0x66, 0x49, 0x66, 0x66, 0x66, 0xBD, 0x4B, 0x66, 0xBF, 0xD3, 0x3F, 0x6B, 0x33, 0x48, 0x88,
+  0x3B, 0x00, 0xBF, 0x80, 0x3C, 0x0E, 0x66, 0x6B, 0xD3, 0x33, 0x99, 0x66, 0x9D, 0x33, 0xB9, 0x66,
+  0x6F, 0x33, 0x39, 0x66, 0x64, 0x80, 0x15, 0x01, 0x38, 0x55, 0x80, 0x04, 0x81, 0x03, 0x00, 0xA5,
+  0x80, 0x03, 0x00, 0x3D, 0x80, 0x03, 0x00, 0x3E, 0x89, 0x6F, 0x82, 0xFF, 0x03, 0x44, 0x45, 0xDB,
+  0x44, 0x84, 0x00, 0x06, 0xD5, 0x54, 0x44, 0x44, 0x38, 0x7B, 0x55, 0x81, 0x2F, 0x82, 0x00, 0x00,
+  0x37, 0x80, 0x13, 0x00, 0x55, 0x83, 0x1A, 0x81, 0x06, 0x07, 0x55, 0x44, 0x45, 0x5B, 0xAE, 0xBB,
+  0xA8, 0xE3, 0x88, 0x3F, 0x0D, 0x55, 0x5E, 0x44, 0x44, 0x5B, 0xE3, 0x45, 0x5B, 0x63, 0x33, 0xB6,
+  0xE3, 0x33, 0x36, 0x80, 0x12, 0x00, 0x3C, 0x80, 0x03, 0x07, 0x6C, 0x33, 0x33, 0x36, 0xCC, 0x33,
+  0x33, 0x32, 0x80, 0x03, 0x06, 0x87, 0x22, 0x33, 0x42, 0x22, 0x22, 0x82, 0x88, 0xF3, 0x02, 0x27,
+  0x2C, 0x22, 0x80, 0xDE, 0x00, 0x38, 0x81, 0xFB, 0x01, 0x37, 0x77, 0x9C, 0x00, 0x00, 0xD4, 0x80,
+  0x24, 0x03, 0x77, 0x7D, 0xD3, 0x33, 0x80, 0x0A, 0x00, 0x74, 0x91, 0x1F, 0x89, 0xCB, 0x00, 0x28,
+  0x80, 0x03, 0x01, 0x22, 0x43, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x80, 0x61, 0x02, 0x22, 0x22,
+  0x73, 0x82, 0xA2, 0x87, 0x21, 0x13, 0x45, 0xB9, 0x33, 0x3D, 0x99, 0x66, 0x33, 0x49, 0x96, 0x66,
+  0x33, 0xBD, 0x4B, 0x66, 0x3F, 0xD3, 0x3F, 0x6B, 0x88, 0x48, 0x87, 0x1D, 0x13, 0x9B, 0xBF, 0x43,
+  0x33, 0x66, 0x66, 0x6B, 0xD3, 0x66, 0x66, 0x69, 0x9D, 0xBF, 0xB6, 0x66, 0x9F, 0x33, 0x39, 0x66,
+  0x94, 0x80, 0x16, 0x00, 0x39, 0x89, 0x63, 0x8D, 0x00, 0x03, 0x55, 0x44, 0x44, 0x58, 0x80, 0x03,
+  0x10, 0x55, 0xA5, 0x44, 0x44, 0x54, 0x3D, 0x54, 0x44, 0x44, 0x3E, 0xD5, 0x54, 0x45, 0x33, 0x38,
+  0xAB, 0x55, 0x86, 0x20, 0x04, 0x37, 0x55, 0x44, 0xDB, 0x55, 0x80, 0x21, 0x00, 0x44, 0x81, 0x03,
+  0x81, 0x05, 0x05, 0x55, 0x5B, 0x55, 0xBB, 0xA8, 0xE3, 0x85, 0x1E, 0x80, 0x12, 0x80, 0x35, 0x0A,
+  0x44, 0x5B, 0x55, 0x45, 0x5B, 0x63, 0x55, 0xB6, 0xE3, 0x33, 0xAE, 0x87, 0x5A, 0x00, 0x36, 0x80,
+  0x03, 0x11, 0x32, 0xB3, 0x33, 0x33, 0x87, 0x33, 0x33, 0x42, 0x22, 0x33, 0x82, 0x22, 0x22, 0x34,
+  0x22, 0x22, 0x22, 0x32, 0x80, 0x03, 0x02, 0x72, 0x27, 0x2C, 0x81, 0xDE, 0x01, 0x38, 0x22, 0x80,
+  0x20, 0x00, 0x77, 0x98, 0x00, 0x00, 0x34, 0x81, 0x04, 0x00, 0xD4, 0x81, 0x23, 0x01, 0x7D, 0xD3,
+  0x95, 0x23, 0x23, 0x33, 0x49, 0xD3, 0x3B, 0x33, 0xD9, 0xBE, 0xD9, 0x33, 0xD9, 0x69, 0x66, 0x33,
+  0x3B, 0x99, 0x66, 0x33, 0x34, 0x9E, 0x49, 0x83, 0x3E, 0x9E, 0x46, 0x83, 0x3E, 0x99, 0x99, 0x83,
+  0x3E, 0x9F, 0xEB, 0x9E, 0x33, 0x3B, 0x96, 0x80, 0x03, 0x1F, 0x9F, 0x9F, 0x4D, 0xFD, 0x43, 0x66,
+  0x99, 0x43, 0x33, 0x9B, 0xB9, 0xE3, 0x33, 0xB3, 0x49, 0x33, 0x33, 0x94, 0xD9, 0x33, 0x33, 0x69,
+  0x9B, 0x33, 0x34, 0xD3, 0x33, 0x39, 0x48, 0x33, 0x39, 0xC2, 0x83, 0x9F, 0x03, 0x26, 0x66, 0x66,
+  0x92, 0x80, 0x03, 0x0F, 0x82, 0x66, 0x66, 0x66, 0x22, 0x66, 0x66, 0x2B, 0x22, 0x22, 0x2B, 0x43,
+  0xBB, 0xBB, 0xBB, 0x88, 0x80, 0x0C, 0x00, 0x26, 0x80, 0x0F, 0x80, 0x19, 0x15, 0x66, 0x62, 0x62,
+  0x8C, 0x22, 0x23, 0x29, 0x33, 0x22, 0xC3, 0x93, 0x33, 0x82, 0xC3, 0x33, 0x33, 0x82, 0xB3, 0x88,
+  0x84, 0x93, 0x33, 0x80, 0xD2, 0x00, 0x83, 0x81, 0x32, 0x02, 0x22, 0x22, 0x66, 0x80, 0xDF, 0x02,
+  0x66, 0x62, 0x39, 0x80, 0x03, 0x06, 0x33, 0x92, 0x22, 0x22, 0x33, 0x3F, 0x82, 0x81, 0xE2, 0x82,
+  0x00, 0x00, 0x43, 0x80, 0x03, 0x00, 0x28, 0x80, 0x03, 0x05, 0x62, 0xB3, 0x33, 0x33, 0x66, 0x68,
+  0x80, 0x03, 0x01, 0x66, 0x43, 0x80, 0x03, 0x02, 0xB3, 0x33, 0x32, 0x80, 0x21, 0x00, 0x72, 0x80,
+  0x03, 0x00, 0x52, 0x80, 0x03, 0x02, 0xF2, 0x22, 0x43, 0x80, 0x0B, 0x00, 0x23, 0x80, 0x03, 0x00,
+  0x2C, 0x80, 0x03, 0x02, 0x22, 0xC3, 0x42, 0x80, 0x51, 0x80, 0x63, 0x81, 0x43, 0x00, 0x72, 0x80,
+  0x03, 0x00, 0x38, 0x85, 0x4B, 0x85, 0x00, 0x03, 0x27, 0x44, 0x47, 0x27, 0x80, 0x22, 0x86, 0x00,
+  0x04, 0x37, 0x22, 0x22, 0x24, 0x33, 0x80, 0x3F, 0x80, 0x9E, 0x01, 0x33, 0x42, 0x80, 0x03, 0x80,
+  0x42, 0x01, 0x33, 0x77, 0x82, 0x00, 0x05, 0x7D, 0x47, 0x77, 0xDD, 0x43, 0x34, 0x8D, 0x3F, 0x81,
+  0x00, 0x48, 0x28, 0x33, 0x49, 0xD3, 0x27, 0x33, 0xD9, 0xBE, 0x22, 0x33, 0xD9, 0x99, 0x22, 0x33,
+  0x3B, 0x69, 0x82, 0x33, 0x34, 0x9E, 0x32, 0x83, 0x3E, 0x94, 0x37, 0x83, 0x3E, 0x69, 0x38, 0x83,
+  0x3E, 0x9B, 0x3B, 0x6E, 0x33, 0x3B, 0xD9, 0x9E, 0x33, 0x3B, 0x96, 0x9F, 0x4D, 0xFD, 0x96, 0x69,
+  0x69, 0x43, 0x46, 0x6B, 0xB6, 0x33, 0x46, 0xB3, 0x49, 0x33, 0x96, 0x94, 0xDB, 0x33, 0xEB, 0x69,
+  0x6B, 0x33, 0x67, 0xD3, 0x33, 0x39, 0x68, 0x33, 0x39, 0xC2, 0x43, 0x81, 0xA7, 0x02, 0x34, 0x22,
+  0x66, 0x80, 0xF7, 0x10, 0x66, 0x33, 0x82, 0x66, 0x66, 0x33, 0x22, 0x66, 0x26, 0x34, 0x22, 0x22,
+  0x2B, 0x48, 0xCC, 0xCC, 0xCC, 0x80, 0x9A, 0x01, 0x66, 0x66, 0x81, 0x04, 0x82, 0x03, 0x11, 0x8C,
+  0x22, 0x62, 0x29, 0x33, 0x26, 0x22, 0x93, 0x33, 0x82, 0x43, 0x33, 0x33, 0x86, 0x88, 0x88, 0x84,
+  0x93, 0x85, 0xBF, 0x00, 0x62, 0x80, 0x03, 0x01, 0x23, 0x32, 0x80, 0xB5, 0x0A, 0x3F, 0x22, 0x66,
+  0xC3, 0x33, 0x92, 0x62, 0xB3, 0x33, 0x3F, 0x82, 0x81, 0xA3, 0x00, 0x83, 0x80, 0x03, 0x00, 0x22,
+  0x80, 0x2C, 0x01, 0x66, 0x68, 0x80, 0x03, 0x05, 0x22, 0xB3, 0x33, 0x66, 0x66, 0x28, 0x80, 0x03,
+  0x0B, 0x22, 0x43, 0x66, 0x66, 0x66, 0xB3, 0x33, 0x32, 0x22, 0x33, 0x33, 0x72, 0x80, 0x03, 0x00,
+  0x52, 0x80, 0x03, 0x00, 0xF2, 0x80, 0x25, 0x02, 0x72, 0x22, 0x23, 0x80, 0x03, 0x00, 0x2C, 0x80,
+  0x03, 0x02, 0x22, 0x33, 0x42, 0x80, 0x03, 0x01, 0x33, 0x33, 0x82, 0x43, 0x8D, 0x00, 0x00, 0xC3,
+  0x81, 0x53, 0x02, 0x27, 0x44, 0x47, 0x81, 0x77, 0x80, 0x2A, 0x01, 0x22, 0x38, 0x80, 0x03, 0x01,
+  0x33, 0x37, 0x81, 0x2F, 0x80, 0x3F, 0x02, 0x33, 0x22, 0xC3, 0x80, 0x3B, 0x01, 0xC3, 0x27, 0x80,
+  0x8A, 0x00, 0x77, 0x83, 0x00, 0x05, 0x7D, 0x77, 0x77, 0xDD, 0x43, 0x74, 0x90, 0x47, 0x0F, 0x22,
+  0x28, 0x33, 0x49, 0x42, 0x27, 0x33, 0xD9, 0x34, 0x22, 0x33, 0xD9, 0x33, 0x22, 0x33, 0x3B, 0x80,
+  0x6D, 0x06, 0x34, 0x33, 0x32, 0x83, 0x3E, 0x33, 0x37, 0x80, 0x03, 0x36, 0x34, 0x83, 0x3E, 0xD3,
+  0x3B, 0x6E, 0x33, 0xBE, 0xD9, 0x6E, 0x33, 0x69, 0x99, 0x9F, 0x4D, 0x66, 0x96, 0x96, 0x96, 0x9E,
+  0x49, 0x6B, 0xB6, 0x9E, 0x49, 0xB3, 0x49, 0x99, 0x99, 0x94, 0xD9, 0x9B, 0xEB, 0x66, 0x99, 0x32,
+  0x67, 0xD3, 0x33, 0x32, 0x68, 0x33, 0x39, 0xD8, 0x43, 0x33, 0x82, 0x43, 0x33, 0x34, 0x22, 0x93,
+  0x33, 0x92, 0x26, 0x80, 0xB2, 0x00, 0x66, 0x80, 0x59, 0x00, 0x66, 0x80, 0x0E, 0x09, 0x22, 0x39,
+  0x48, 0xCC, 0xCC, 0xC2, 0x22, 0x66, 0x66, 0x62, 0x80, 0x03, 0x83, 0x00, 0x11, 0x22, 0x8B, 0x66,
+  0x66, 0x29, 0x33, 0x22, 0x2B, 0x93, 0x33, 0x2B, 0x43, 0x33, 0x33, 0xCC, 0x88, 0x88, 0x84, 0x80,
+  0x1C, 0x83, 0x1D, 0x80, 0x07, 0x02, 0x22, 0x23, 0x32, 0x80, 0xB5, 0x0A, 0x3F, 0x22, 0x82, 0xC3,
+  0x33, 0x92, 0x82, 0xB3, 0x33, 0x3F, 0x93, 0x81, 0xA3, 0x0A, 0x83, 0x33, 0x33, 0x66, 0x22, 0x43,
+  0x33, 0x66, 0x26, 0x28, 0x33, 0x80, 0x3F, 0x00, 0xB3, 0x80, 0x29, 0x01, 0x28, 0x26, 0x80, 0x08,
+  0x00, 0x82, 0x80, 0x08, 0x06, 0x33, 0x33, 0x37, 0x77, 0x33, 0x33, 0xD7, 0x8E, 0x03, 0x00, 0x43,
+  0x80, 0x03, 0x02, 0xB3, 0x33, 0x47, 0x80, 0x0B, 0x87, 0x00, 0x80, 0x6E, 0x01, 0x33, 0x23, 0x80,
+  0x03, 0x00, 0x2C, 0x81, 0x53, 0x00, 0xC3, 0x80, 0x03, 0x03, 0x22, 0x27, 0x44, 0x82, 0x80, 0x72,
+  0x01, 0x33, 0x72, 0x80, 0x03, 0x00, 0x38, 0x80, 0x03, 0x01, 0x33, 0x37, 0x80, 0x03, 0x00, 0x33,
+  0x84, 0x03, 0x03, 0x42, 0x22, 0x47, 0x27, 0x80, 0x1C, 0x87, 0x00, 0x02, 0x77, 0x22, 0x24, 0x83,
+  0x3F, 0x80, 0x3A, 0x86, 0x03, 0x09, 0x22, 0x22, 0x28, 0x33, 0x27, 0x42, 0x27, 0x33, 0x43, 0x34,
+  0x85, 0x3A, 0x00, 0x82, 0x80, 0x03, 0x00, 0x32, 0x80, 0xB1, 0x00, 0x37, 0x80, 0x03, 0x49, 0x34,
+  0x83, 0x49, 0xD3, 0x3B, 0x9E, 0xD9, 0xBE, 0xD9, 0x9E, 0xD9, 0x99, 0x66, 0x6F, 0x3B, 0x99, 0x66,
+  0x66, 0x34, 0x9E, 0x49, 0x6B, 0x3E, 0x9E, 0x49, 0xB3, 0x3E, 0x69, 0x99, 0x94, 0x3E, 0x9F, 0xEB,
+  0x99, 0x33, 0x3B, 0x69, 0xF3, 0x33, 0x3B, 0x9F, 0x33, 0x4D, 0xFD, 0x43, 0x33, 0x96, 0x43, 0x33,
+  0x34, 0xB9, 0x33, 0x33, 0xEB, 0x49, 0x33, 0x33, 0xDB, 0xDB, 0x33, 0x33, 0xBB, 0x9B, 0x33, 0x34,
+  0xBB, 0x33, 0x39, 0x48, 0xCC, 0x39, 0xC2, 0x26, 0x22, 0x80, 0xA7, 0x01, 0x66, 0x22, 0x80, 0xEF,
+  0x80, 0x03, 0x80, 0xFA, 0x0D, 0x66, 0x29, 0x66, 0x62, 0x2B, 0x93, 0x22, 0x2B, 0x43, 0x33, 0xCC,
+  0xCC, 0x88, 0x88, 0x81, 0x9C, 0x80, 0x13, 0x80, 0x00, 0x05, 0x62, 0x26, 0x8C, 0x22, 0x23, 0x32,
+  0x80, 0xDC, 0x02, 0x3F, 0x33, 0x82, 0x80, 0x9D, 0x04, 0x86, 0xB3, 0x33, 0x84, 0x93, 0x81, 0xA3,
+  0x01, 0x83, 0x33, 0x80, 0x39, 0x00, 0x43, 0x80, 0x20, 0x04, 0x28, 0x26, 0x66, 0x62, 0x62, 0x81,
+  0x2C, 0x05, 0x92, 0x62, 0x66, 0x66, 0x33, 0x82, 0x80, 0x03, 0x80, 0xA8, 0x80, 0x03, 0x00, 0xD7,
+  0x85, 0x03, 0x00, 0xB3, 0x80, 0x03, 0x00, 0x28, 0x80, 0x03, 0x07, 0x62, 0x43, 0x33, 0xD7, 0x66,
+  0xB3, 0x33, 0x47, 0x85, 0xD5, 0x82, 0x03, 0x00, 0x43, 0x80, 0x03, 0x00, 0x23, 0x80, 0x03, 0x00,
+  0x2C, 0x81, 0x53, 0x00, 0xC3, 0x80, 0x03, 0x02, 0x22, 0x27, 0x33, 0x80, 0x98, 0x02, 0x33, 0x33,
+  0x72, 0x80, 0x03, 0x00, 0x38, 0x81, 0x22, 0x81, 0x4B, 0x85, 0x00, 0x03, 0x42, 0x44, 0x47, 0x27,
+  0x81, 0x9A, 0x88, 0x00, 0x00, 0x24, 0x83, 0x3F, 0x80, 0x9A, 0x85, 0x03, 0x08, 0x73, 0x3E, 0x9E,
+  0x3F, 0x73, 0x33, 0xE3, 0x3E, 0x73, 0x80, 0x30, 0x0F, 0x83, 0x33, 0xF3, 0x3B, 0x33, 0x34, 0x93,
+  0x39, 0x33, 0x34, 0x9E, 0x49, 0x33, 0x33, 0xB9, 0x99, 0x80, 0x12, 0x08, 0x4F, 0x9B, 0xDB, 0x33,
+  0x3B, 0x4E, 0x34, 0x33, 0x3B, 0x80, 0x0B, 0x15, 0x4B, 0xD3, 0x34, 0x33, 0xDB, 0xB3, 0x4B, 0x33,
+  0xDB, 0x69, 0x9B, 0x33, 0xDB, 0x96, 0x6B, 0x33, 0x4B, 0xB9, 0x6B, 0x33, 0x3B, 0x28, 0x80, 0x25,
+  0x80, 0x52, 0x01, 0x33, 0x29, 0x80, 0x03, 0x80, 0x96, 0x01, 0x33, 0x62, 0x80, 0xEF, 0x00, 0x66,
+  0x80, 0x0C, 0x00, 0x66, 0x83, 0xF3, 0x03, 0x44, 0x33, 0x33, 0x86, 0x80, 0x1E, 0x00, 0x46, 0x80,
+  0x03, 0x00, 0x86, 0x80, 0xD6, 0x00, 0x26, 0x80, 0xA3, 0x80, 0xAF, 0x09, 0x38, 0x22, 0x66, 0x33,
+  0x32, 0x22, 0x66, 0x49, 0x82, 0x26, 0x80, 0xFF, 0x01, 0x39, 0x82, 0x88, 0xB3, 0x80, 0x83, 0x01,
+  0x33, 0x33, 0x80, 0x28, 0x05, 0x33, 0x62, 0x24, 0x99, 0x94, 0x66, 0x81, 0xB2, 0x1F, 0x26, 0x29,
+  0x33, 0x8C, 0x26, 0x2B, 0x33, 0x33, 0x3B, 0x22, 0x93, 0x33, 0x32, 0x62, 0x83, 0x33, 0x82, 0x62,
+  0x83, 0x38, 0x22, 0x62, 0x83, 0x22, 0x26, 0x62, 0x83, 0x26, 0x66, 0x62, 0x93, 0x32, 0x80, 0x22,
+  0x00, 0x37, 0x80, 0x03, 0x01, 0x33, 0xF2, 0x80, 0x03, 0x80, 0x08, 0x80, 0xF6, 0x80, 0x03, 0x00,
+  0x38, 0x80, 0x03, 0x01, 0x33, 0x32, 0x81, 0x03, 0x87, 0xFB, 0x08, 0xC8, 0x72, 0x22, 0x27, 0x33,
+  0x82, 0x22, 0x28, 0x38, 0x80, 0x29, 0x89, 0x00, 0x00, 0xC3, 0x80, 0x91, 0x00, 0x23, 0x80, 0x03,
+  0x05, 0x27, 0x33, 0x48, 0x22, 0x22, 0x73, 0x80, 0x31, 0x02, 0x27, 0x28, 0x34, 0x80, 0x16, 0x00,
+  0x87, 0x83, 0x1D, 0x89, 0x9B, 0x85, 0x00, 0x02, 0x2C, 0x77, 0x77, 0x85, 0x3C, 0x08, 0x73, 0x33,
+  0x73, 0x3E, 0x9E, 0x33, 0x73, 0x33, 0xE3, 0x80, 0x03, 0x0C, 0x33, 0x35, 0x83, 0x33, 0xF3, 0x57,
+  0x33, 0x34, 0xB3, 0x23, 0x33, 0x34, 0x9E, 0x80, 0xC7, 0x00, 0xB9, 0x81, 0x2B, 0x06, 0x3F, 0x6B,
+  0xDB, 0x33, 0x3E, 0x4E, 0x34, 0x82, 0x37, 0x19, 0x3B, 0xD3, 0x34, 0x33, 0x39, 0xB3, 0x4F, 0x33,
+  0x49, 0x69, 0x9B, 0x33, 0x99, 0x96, 0x6B, 0x33, 0x4F, 0xB9, 0x9F, 0x33, 0x32, 0x68, 0x99, 0x33,
+  0x32, 0x23, 0x80, 0xB5, 0x04, 0x29, 0x33, 0x33, 0x82, 0x2C, 0x80, 0x03, 0x07, 0x62, 0x93, 0x33,
+  0x82, 0x66, 0x29, 0x33, 0x42, 0x80, 0xDF, 0x02, 0xF2, 0x26, 0x66, 0x81, 0x7F, 0x00, 0x42, 0x84,
+  0x03, 0x00, 0x82, 0x80, 0x03, 0x00, 0x26, 0x80, 0x03, 0x81, 0xDF, 0x80, 0x07, 0x05, 0x32, 0x26,
+  0x44, 0x49, 0x82, 0x26, 0x80, 0x3A, 0x00, 0x39, 0x80, 0x03, 0x01, 0x33, 0x28, 0x80, 0x03, 0x00,
+  0x62, 0x81, 0x03, 0x80, 0x78, 0x00, 0x66, 0x80, 0x0C, 0x12, 0x66, 0x62, 0x24, 0xFF, 0x66, 0x66,
+  0x62, 0x22, 0x82, 0x62, 0x22, 0x29, 0x33, 0x88, 0x22, 0x2B, 0x33, 0x33, 0x3C, 0x81, 0x33, 0x80,
+  0x22, 0x01, 0x82, 0x62, 0x80, 0x3E, 0x15, 0x62, 0x94, 0x22, 0x26, 0x62, 0x22, 0x62, 0x66, 0x62,
+  0x33, 0x37, 0x77, 0x77, 0x33, 0x3D, 0x77, 0x77, 0x93, 0x33, 0xD7, 0x77, 0x83, 0x80, 0x08, 0x80,
+  0x3E, 0x00, 0x47, 0x80, 0x03, 0x00, 0x33, 0x81, 0x03, 0x00, 0x93, 0x81, 0x6C, 0x87, 0x00, 0x03,
+  0xC8, 0x22, 0x22, 0x27, 0x80, 0x0F, 0x01, 0x28, 0x38, 0x81, 0x0C, 0x00, 0x32, 0x84, 0x03, 0x80,
+  0x00, 0x00, 0xC3, 0x80, 0x03, 0x01, 0x23, 0x72, 0x80, 0x1C, 0x05, 0x82, 0x44, 0x22, 0x22, 0xF2,
+  0x33, 0x80, 0x15, 0x01, 0x28, 0x34, 0x80, 0x12, 0x00, 0x87, 0x82, 0x1C, 0x82, 0xF8, 0x84, 0x00,
+  0x00, 0xD3, 0x80, 0x03, 0x00, 0x7D, 0x80, 0x03, 0x04, 0x77, 0x77, 0xDD, 0xDD, 0x77, 0x84, 0x00,
+  0x03, 0x33, 0x33, 0x73, 0x3E, 0x80, 0x03, 0x80, 0x15, 0x80, 0x03, 0x00, 0x35, 0x80, 0x75, 0x04,
+  0x57, 0x33, 0x34, 0x22, 0x23, 0x80, 0x03, 0x80, 0x0A, 0x81, 0x15, 0x07, 0x9E, 0x3F, 0x9B, 0xDB,
+  0xE3, 0x3E, 0x4E, 0x34, 0x81, 0x3F, 0x1E, 0xF3, 0x3B, 0xD3, 0x34, 0xB3, 0x39, 0xB3, 0x4B, 0x9E,
+  0x49, 0x69, 0x9F, 0xB9, 0x99, 0x66, 0x9F, 0x33, 0x4F, 0xB9, 0x9F, 0x33, 0x32, 0x28, 0x99, 0x33,
+  0x32, 0x23, 0x33, 0x33, 0x42, 0x29, 0x80, 0xDA, 0x00, 0x2C, 0x80, 0x03, 0x01, 0x22, 0x93, 0x80,
+  0x03, 0x02, 0x29, 0x33, 0x46, 0x80, 0xDB, 0x02, 0xF2, 0x66, 0x66, 0x89, 0x7F, 0x88, 0x00, 0x00,
+  0x38, 0x80, 0x5E, 0x05, 0x32, 0x6B, 0x44, 0x49, 0x82, 0x42, 0x81, 0x3A, 0x80, 0x03, 0x01, 0x86,
+  0x68, 0x81, 0xEB, 0x81, 0x03, 0x04, 0x83, 0x33, 0x22, 0x66, 0x28, 0x80, 0x03, 0x0C, 0x22, 0x24,
+  0x66, 0x66, 0x66, 0x22, 0x39, 0x82, 0x22, 0x62, 0x33, 0x33, 0x8C, 0x81, 0xC7, 0x00, 0x3C, 0x80,
+  0x03, 0x00, 0x32, 0x80, 0x03, 0x00, 0x82, 0x80, 0x3E, 0x18, 0x22, 0x99, 0x94, 0x22, 0x26, 0x22,
+  0x22, 0x26, 0x66, 0x29, 0x33, 0x37, 0x77, 0x2B, 0x33, 0x3D, 0x77, 0x66, 0x93, 0x33, 0xD7, 0x66,
+  0x83, 0x33, 0x3D, 0x80, 0x03, 0x00, 0x33, 0x85, 0x03, 0x01, 0x62, 0x93, 0x81, 0x4F, 0x8A, 0x00,
+  0x05, 0x27, 0x42, 0x22, 0x22, 0x28, 0x38, 0x80, 0x08, 0x01, 0x33, 0x32, 0x83, 0x03, 0x85, 0x00,
+  0x01, 0xC8, 0x72, 0x80, 0x0F, 0x04, 0x82, 0x48, 0x22, 0x38, 0xF2, 0x81, 0x15, 0x01, 0x28, 0x34,
+  0x80, 0x12, 0x00, 0x87, 0x81, 0x17, 0x00, 0xC3, 0x80, 0x70, 0x80, 0x9E, 0x01, 0x33, 0x27, 0x80,
+  0x03, 0x01, 0x22, 0x73, 0x80, 0x03, 0x80, 0x08, 0x80, 0x16, 0x00, 0x77, 0x85, 0x37, 0x80, 0x16,
+  0x80, 0x15, 0x85, 0x03, 0x00, 0x32, 0x80, 0x75, 0x04, 0x57, 0x33, 0x77, 0x22, 0x23, 0x83, 0xC7,
+  0x80, 0x11, 0x07, 0x3E, 0x6E, 0x3F, 0x6B, 0x33, 0xE3, 0x3E, 0x4E, 0x82, 0xF5, 0x19, 0xF3, 0x3B,
+  0xD3, 0x34, 0xB3, 0x39, 0xB3, 0x34, 0x9E, 0x49, 0x99, 0x33, 0xBB, 0x96, 0x96, 0x33, 0x33, 0x4F,
+  0xB9, 0x82, 0x33, 0x32, 0x28, 0x34, 0x33, 0x32, 0x80, 0x62, 0x10, 0x42, 0x29, 0x34, 0x33, 0x82,
+  0x2C, 0x4D, 0x33, 0x82, 0x22, 0x7C, 0x33, 0x86, 0x66, 0x6C, 0x33, 0x42, 0x80, 0x03, 0x02, 0xF2,
+  0x66, 0x99, 0x82, 0x38, 0x87, 0x00, 0x80, 0xD2, 0x01, 0x33, 0x29, 0x81, 0x8B, 0x81, 0xE3, 0x04,
+  0x62, 0x44, 0x49, 0x33, 0x42, 0x81, 0x3A, 0x80, 0x03, 0x04, 0x82, 0x28, 0x33, 0x33, 0x26, 0x80,
+  0x8E, 0x12, 0x26, 0x22, 0x83, 0x38, 0x26, 0x66, 0x68, 0x32, 0x26, 0x66, 0x66, 0x82, 0x62, 0x66,
+  0x66, 0x33, 0x34, 0x82, 0x26, 0x80, 0x2E, 0x00, 0x8C, 0x8C, 0x46, 0x05, 0x38, 0x24, 0xFF, 0x94,
+  0x22, 0x62, 0x80, 0xBF, 0x0E, 0x26, 0x69, 0x33, 0x37, 0x22, 0x2B, 0x33, 0x3D, 0x3C, 0x62, 0x93,
+  0x33, 0x32, 0x62, 0x83, 0x80, 0x7D, 0x80, 0xB7, 0x80, 0x07, 0x82, 0xBF, 0x01, 0x22, 0x93, 0x81,
+  0xEB, 0x82, 0x00, 0x00, 0xF2, 0x80, 0x03, 0x00, 0x37, 0x81, 0xEF, 0x00, 0x42, 0x80, 0x03, 0x00,
+  0x38, 0x81, 0xF7, 0x00, 0x32, 0x82, 0x03, 0x86, 0x00, 0x09, 0x28, 0x72, 0x22, 0x27, 0x33, 0x82,
+  0x48, 0x28, 0x38, 0x52, 0x81, 0x33, 0x00, 0x28, 0x86, 0x17, 0x00, 0xC3, 0x80, 0xAB, 0x80, 0x9E,
+  0x80, 0x1C, 0x80, 0x17, 0x00, 0x73, 0x80, 0x31, 0x06, 0x27, 0x33, 0x34, 0x22, 0x22, 0x2C, 0x87,
+  0x84, 0x1E, 0x89, 0x94, 0x0A, 0x13, 0x35, 0x54, 0x33, 0xC3, 0x31, 0x11, 0x33, 0x53, 0x81, 0x1C,
+  0x81, 0x0E, 0x00, 0x34, 0x82, 0x14, 0x02, 0x43, 0x33, 0x39, 0x85, 0x0B, 0x07, 0x88, 0x88, 0x33,
+  0x33, 0x11, 0x11, 0x15, 0x83, 0x80, 0x03, 0x80, 0x07, 0x0A, 0x18, 0x34, 0x4C, 0x11, 0x53, 0x39,
+  0x26, 0x66, 0x62, 0x22, 0x66, 0x80, 0x00, 0x12, 0x86, 0x66, 0x6B, 0xC2, 0x32, 0x66, 0x29, 0x39,
+  0x32, 0x26, 0x64, 0x33, 0x82, 0x26, 0x62, 0x83, 0x22, 0x26, 0x66, 0x80, 0x5D, 0x00, 0x66, 0x80,
+  0x04, 0x00, 0x26, 0x81, 0x1E, 0x80, 0x25, 0x11, 0xB8, 0x26, 0x22, 0x28, 0x33, 0x82, 0x42, 0x23,
+  0x33, 0x22, 0x96, 0x23, 0x92, 0x28, 0x26, 0x62, 0x22, 0x29, 0x80, 0x1F, 0x01, 0x83, 0x66, 0x83,
+  0x1E, 0x80, 0x28, 0x80, 0x22, 0x06, 0x22, 0x22, 0x62, 0x93, 0xF9, 0x44, 0x93, 0x89, 0x93, 0x0C,
+  0x26, 0x66, 0x28, 0x33, 0x66, 0x66, 0x83, 0x33, 0x22, 0xC9, 0x33, 0x33, 0x89, 0x89, 0x18, 0x04,
+  0x33, 0x98, 0x23, 0x34, 0x82, 0x81, 0xD9, 0x00, 0x33, 0x80, 0xC3, 0x00, 0x37, 0x80, 0xDD, 0x01,
+  0x82, 0x28, 0x83, 0xE5, 0x00, 0x77, 0x80, 0x03, 0x80, 0xAF, 0x02, 0x38, 0x48, 0x33, 0x80, 0xEC,
+  0x0D, 0xC8, 0x22, 0x22, 0xC7, 0x22, 0x42, 0x22, 0x83, 0x72, 0x37, 0x22, 0x73, 0x42, 0x34, 0x85,
+  0x03, 0x02, 0x72, 0x73, 0x42, 0x80, 0x23, 0x01, 0x38, 0x38, 0x81, 0x3C, 0x03, 0x22, 0x27, 0x38,
+  0x22, 0x80, 0x98, 0x81, 0x03, 0x00, 0x77, 0x81, 0x3E, 0x03, 0x22, 0x2C, 0x33, 0x83, 0x80, 0x03,
+  0x01, 0x33, 0x42, 0x80, 0x03, 0x03, 0x38, 0x77, 0x33, 0x4D, 0x87, 0x70, 0x00, 0x34, 0x80, 0x03,
+  0x00, 0x3A, 0x84, 0x03, 0x00, 0x3D, 0x83, 0x12, 0x00, 0xF3, 0x81, 0x13, 0x82, 0x00, 0x00, 0x83,
+  0x80, 0x03, 0x0B, 0x11, 0x13, 0x35, 0x54, 0x11, 0xC3, 0x31, 0x11, 0xCC, 0x53, 0x81, 0x1C, 0x81,
+  0x13, 0x00, 0x88, 0x82, 0x19, 0x00, 0x43, 0x87, 0x41, 0x00, 0x88, 0x80, 0x11, 0x02, 0x11, 0x11,
+  0x15, 0x81, 0x03, 0x1B, 0x34, 0x11, 0x11, 0x18, 0x33, 0x4C, 0x11, 0x53, 0x32, 0x26, 0x66, 0x62,
+  0x34, 0x26, 0x66, 0x66, 0x33, 0x82, 0x66, 0x6B, 0x33, 0x32, 0x66, 0x29, 0x43, 0x32, 0x66, 0x68,
+  0x80, 0x0B, 0x01, 0x62, 0x39, 0x80, 0x13, 0x04, 0x32, 0x22, 0x22, 0x66, 0x22, 0x80, 0x00, 0x00,
+  0x66, 0x80, 0x00, 0x05, 0xC2, 0x26, 0x26, 0xB8, 0x39, 0x26, 0x81, 0x97, 0x06, 0x23, 0x33, 0x83,
+  0x92, 0x23, 0x92, 0x62, 0x81, 0x17, 0x01, 0x26, 0x26, 0x82, 0x1B, 0x81, 0x00, 0x00, 0x26, 0x80,
+  0x0E, 0x00, 0x82, 0x81, 0x2F, 0x03, 0x93, 0xF9, 0x44, 0x28, 0x80, 0x6A, 0x00, 0x29, 0x84, 0x93,
+  0x0D, 0x66, 0x62, 0x22, 0x28, 0x66, 0x66, 0x22, 0x83, 0x22, 0x22, 0x89, 0x33, 0x62, 0x89, 0x8A,
+  0x8D, 0x04, 0x98, 0x33, 0x34, 0x82, 0x22, 0x84, 0x0B, 0x00, 0x37, 0x80, 0x03, 0x00, 0x82, 0x80,
+  0x03, 0x81, 0x0F, 0x00, 0x77, 0x81, 0x10, 0x05, 0x53, 0x33, 0x38, 0x48, 0x53, 0x33, 0x80, 0x81,
+  0x0C, 0x22, 0x22, 0xC7, 0x27, 0x42, 0x22, 0x83, 0x28, 0x37, 0x22, 0x73, 0x27, 0x34, 0x83, 0x03,
+  0x03, 0x38, 0x34, 0x72, 0x73, 0x81, 0x23, 0x01, 0x78, 0x38, 0x80, 0x30, 0x07, 0x22, 0x22, 0x27,
+  0x72, 0x22, 0x22, 0x28, 0x42, 0x81, 0x03, 0x0D, 0x77, 0x22, 0x27, 0x42, 0x33, 0x22, 0x2C, 0x42,
+  0x83, 0x22, 0x2C, 0x38, 0x33, 0x72, 0x80, 0xAC, 0x03, 0x38, 0x77, 0x38, 0x47, 0x87, 0x70, 0x99,
+  0x00, 0x00, 0x34, 0x80, 0xAC, 0x0B, 0x31, 0x11, 0x13, 0x35, 0x31, 0x11, 0xC3, 0x31, 0x35, 0x55,
+  0x53, 0x81, 0x81, 0x13, 0x01, 0x38, 0x88, 0x82, 0x1A, 0x86, 0xB2, 0x08, 0x54, 0x33, 0x88, 0x88,
+  0x11, 0x33, 0x11, 0x11, 0x1C, 0x80, 0x03, 0x01, 0x33, 0x34, 0x80, 0x03, 0x08, 0x38, 0x4C, 0x11,
+  0x33, 0x39, 0x96, 0x66, 0x33, 0x34, 0x80, 0x03, 0x01, 0x33, 0xD6, 0x80, 0x03, 0x16, 0x39, 0x66,
+  0x15, 0x43, 0x39, 0x66, 0x1C, 0x33, 0xD9, 0x66, 0x18, 0x34, 0x99, 0x66, 0x53, 0x39, 0x99, 0x99,
+  0x62, 0x22, 0x22, 0x26, 0x66, 0x80, 0x00, 0x0F, 0x2B, 0xC2, 0x62, 0x66, 0x29, 0x39, 0x22, 0x6C,
+  0x24, 0x33, 0x42, 0x23, 0x22, 0x83, 0x92, 0x23, 0x81, 0xD8, 0x02, 0x66, 0x66, 0x26, 0x81, 0x1B,
+  0x80, 0x07, 0x02, 0x66, 0x66, 0xB8, 0x80, 0x0A, 0x09, 0x33, 0x82, 0x22, 0x22, 0x33, 0x22, 0x93,
+  0xF9, 0x92, 0x28, 0x80, 0xD7, 0x00, 0x29, 0x80, 0x03, 0x80, 0x93, 0x01, 0x66, 0x62, 0x81, 0x1D,
+  0x80, 0x05, 0x08, 0x62, 0x22, 0xC9, 0x66, 0x22, 0x89, 0x33, 0x44, 0x93, 0x8A, 0xB5, 0x01, 0x82,
+  0x57, 0x80, 0x05, 0x00, 0x73, 0x90, 0xCF, 0x08, 0x87, 0xD3, 0x33, 0x36, 0x55, 0xD3, 0x33, 0x3C,
+  0x33, 0x80, 0x67, 0x0C, 0x37, 0x27, 0x42, 0x22, 0x82, 0x28, 0x37, 0x22, 0x22, 0x27, 0x34, 0x22,
+  0x77, 0x80, 0x03, 0x04, 0x33, 0x34, 0x34, 0x72, 0x48, 0x80, 0x23, 0x04, 0x22, 0xC8, 0x38, 0x33,
+  0xC7, 0x80, 0x1F, 0x05, 0x83, 0x72, 0x22, 0x22, 0x73, 0x42, 0x81, 0x03, 0x00, 0x77, 0x80, 0x03,
+  0x00, 0x33, 0x80, 0x03, 0x05, 0x83, 0x22, 0x33, 0x38, 0x33, 0x42, 0x80, 0x22, 0x04, 0x38, 0x27,
+  0x38, 0x47, 0x33, 0x80, 0x8E, 0x82, 0x03, 0x00, 0x27, 0x80, 0x03, 0x00, 0x2C, 0x88, 0x03, 0x00,
+  0x77, 0x8A, 0x8A, 0x80, 0xAC, 0x02, 0x31, 0x11, 0x13, 0x80, 0x03, 0x04, 0xC3, 0x33, 0x35, 0x55,
+  0x53, 0x83, 0x13, 0x00, 0x44, 0x8A, 0x93, 0x0B, 0x35, 0x54, 0x33, 0x88, 0x31, 0x11, 0x33, 0x11,
+  0x81, 0x1C, 0x33, 0x11, 0x80, 0x1C, 0x80, 0x03, 0x05, 0x33, 0x4C, 0x43, 0x33, 0x39, 0x69, 0x80,
+  0x0B, 0x00, 0x96, 0x80, 0x0B, 0x07, 0xD9, 0x88, 0x33, 0x33, 0x39, 0x11, 0x15, 0x83, 0x80, 0x03,
+  0x0D, 0x33, 0xD9, 0x11, 0x18, 0x34, 0x96, 0x11, 0x53, 0x39, 0x99, 0x66, 0x66, 0x22, 0x22, 0x80,
+  0xFF, 0x12, 0x66, 0x66, 0x6B, 0xC2, 0x22, 0x66, 0x29, 0x39, 0x22, 0x66, 0x28, 0x33, 0x42, 0x66,
+  0x22, 0x83, 0x92, 0x66, 0x26, 0x80, 0xB8, 0x80, 0x16, 0x83, 0x1C, 0x1A, 0x66, 0x66, 0x26, 0xB8,
+  0x22, 0x62, 0x2C, 0x33, 0x82, 0x22, 0x23, 0x33, 0x22, 0x93, 0x23, 0x92, 0x28, 0x33, 0x62, 0x22,
+  0x29, 0x33, 0x62, 0x62, 0x83, 0x33, 0x62, 0x80, 0x28, 0x82, 0x1F, 0x09, 0x66, 0x66, 0x62, 0x22,
+  0x66, 0x22, 0x89, 0xF9, 0x44, 0x93, 0x8A, 0xB5, 0x00, 0x22, 0x80, 0xD8, 0x00, 0x22, 0x80, 0xBA,
+  0x00, 0xC9, 0x8A, 0xA9, 0x80, 0x00, 0x01, 0x98, 0x23, 0x82, 0x4D, 0x80, 0x1D, 0x0E, 0x22, 0x33,
+  0x37, 0x27, 0x42, 0x33, 0x82, 0x28, 0x37, 0x33, 0x22, 0x27, 0x34, 0x33, 0x77, 0x80, 0x03, 0x0C,
+  0x33, 0x38, 0x34, 0x38, 0x48, 0x33, 0x33, 0x32, 0x22, 0xC8, 0x38, 0x22, 0xC7, 0x80, 0x87, 0x05,
+  0x83, 0x72, 0x22, 0x22, 0x73, 0x42, 0x81, 0x03, 0x00, 0x77, 0x80, 0x03, 0x03, 0x33, 0x72, 0x73,
+  0x42, 0x80, 0x51, 0x00, 0x38, 0x82, 0x46, 0x03, 0x22, 0x27, 0x38, 0x47, 0x82, 0x63, 0x81, 0x03,
+  0x00, 0x27, 0x80, 0x03, 0x00, 0x2C, 0x83, 0x03, 0x00, 0x72, 0x80, 0x03, 0x13, 0x38, 0x77, 0x33,
+  0x33, 0x83, 0x71, 0x53, 0x33, 0x33, 0x11, 0x53, 0x85, 0x88, 0x1B, 0x83, 0x5B, 0x11, 0x11, 0x15,
+  0x11, 0x8D, 0x00, 0x03, 0x33, 0x35, 0x33, 0x49, 0x80, 0x4C, 0x0D, 0x99, 0x11, 0x53, 0x3D, 0x96,
+  0x11, 0x53, 0x39, 0x99, 0x1B, 0x83, 0x44, 0x43, 0x11, 0x80, 0x57, 0x1C, 0x1C, 0x33, 0x33, 0xD9,
+  0x15, 0x33, 0x49, 0x99, 0x2C, 0x38, 0x66, 0x62, 0x28, 0x34, 0x66, 0x66, 0x29, 0x34, 0x22, 0x62,
+  0x83, 0x38, 0x22, 0x6C, 0x33, 0x33, 0x39, 0x88, 0xF3, 0x80, 0x1F, 0x0D, 0x83, 0x42, 0x28, 0x93,
+  0x83, 0x42, 0x26, 0xB3, 0x28, 0x22, 0x62, 0x33, 0x93, 0x86, 0x80, 0x6C, 0x03, 0x82, 0x28, 0x33,
+  0x3F, 0x80, 0xCF, 0x04, 0x34, 0x22, 0xB3, 0x33, 0x39, 0x81, 0xF0, 0x01, 0x38, 0x93, 0x85, 0xE9,
+  0x10, 0xE7, 0x33, 0x36, 0xD5, 0x55, 0x33, 0x36, 0x55, 0x55, 0x33, 0x3A, 0x5D, 0x3A, 0x33, 0x36,
+  0x5B, 0x3E, 0x80, 0x0B, 0x2C, 0x33, 0x33, 0x3A, 0x55, 0x83, 0x33, 0x36, 0x77, 0x83, 0x55, 0x55,
+  0x54, 0x53, 0x55, 0x44, 0x54, 0x53, 0x44, 0x44, 0x45, 0x53, 0x44, 0x45, 0x55, 0x53, 0x54, 0x57,
+  0x3A, 0x53, 0xB5, 0x57, 0x38, 0x53, 0x74, 0x5B, 0x33, 0xB3, 0xA7, 0x77, 0x33, 0x83, 0x33, 0x32,
+  0x22, 0x24, 0x80, 0x03, 0x02, 0x28, 0x33, 0x42, 0x82, 0x03, 0x00, 0x22, 0x8A, 0x03, 0x80, 0x00,
+  0x0E, 0x37, 0x22, 0x73, 0x4C, 0x3F, 0x22, 0x73, 0x42, 0x32, 0x22, 0x73, 0x72, 0x22, 0x22, 0x23,
+  0x80, 0x15, 0x87, 0x00, 0x00, 0x47, 0x80, 0x11, 0x80, 0x89, 0x10, 0x33, 0x73, 0x47, 0x83, 0x34,
+  0x73, 0x42, 0x28, 0x37, 0x73, 0x72, 0xC3, 0x3A, 0x22, 0x22, 0x73, 0x4A, 0x80, 0x15, 0x00, 0x7A,
+  0x80, 0x3D, 0x00, 0xAA, 0x81, 0x03, 0x0A, 0x34, 0x41, 0xC3, 0x41, 0x11, 0x11, 0xC3, 0x4B, 0x11,
+  0x11, 0x53, 0x80, 0x07, 0x05, 0x83, 0x51, 0x11, 0x11, 0xC4, 0x11, 0x87, 0x00, 0x0D, 0x1C, 0xC1,
+  0x11, 0x83, 0x71, 0x53, 0x11, 0x33, 0x11, 0x53, 0x11, 0x88, 0x11, 0x83, 0x80, 0x10, 0x00, 0x15,
+  0x88, 0x1C, 0x82, 0x00, 0x04, 0x33, 0x33, 0x35, 0x33, 0x85, 0x80, 0x64, 0x03, 0x5B, 0x11, 0x53,
+  0x3D, 0x80, 0x43, 0x04, 0x39, 0x11, 0x1B, 0x83, 0x44, 0x81, 0x15, 0x01, 0x11, 0x1C, 0x80, 0x03,
+  0x16, 0x15, 0x33, 0x49, 0x42, 0x28, 0x38, 0x66, 0x22, 0x68, 0x34, 0x66, 0x22, 0x69, 0x34, 0x26,
+  0x2B, 0x83, 0x38, 0x22, 0x93, 0x33, 0x33, 0x39, 0x81, 0xB7, 0x25, 0x82, 0x83, 0x42, 0x28, 0x26,
+  0x83, 0x42, 0x26, 0x66, 0x28, 0x26, 0x22, 0x66, 0x43, 0x82, 0x2B, 0x62, 0x33, 0x86, 0x68, 0x2C,
+  0x3F, 0x26, 0x23, 0x88, 0x34, 0x22, 0xB3, 0x33, 0x39, 0x22, 0x83, 0x43, 0x33, 0x38, 0x93, 0x23,
+  0x3F, 0x81, 0x29, 0x81, 0x00, 0x01, 0x36, 0xD5, 0x80, 0x03, 0x00, 0x55, 0x84, 0x03, 0x00, 0x5B,
+  0x83, 0x07, 0x00, 0x3A, 0x81, 0x0B, 0x02, 0x77, 0xE7, 0x55, 0x81, 0x00, 0x02, 0x44, 0x44, 0x55,
+  0x80, 0x01, 0x00, 0x3A, 0x80, 0x09, 0x13, 0x3E, 0x55, 0x57, 0x3A, 0x33, 0xB4, 0x57, 0x38, 0x83,
+  0xB4, 0x5B, 0x33, 0x83, 0xA7, 0x77, 0x33, 0x53, 0x33, 0x3C, 0xCC, 0x83, 0x03, 0x00, 0x6C, 0x8A,
+  0x03, 0x00, 0xB3, 0x80, 0x03, 0x80, 0xB6, 0x06, 0x33, 0x24, 0x37, 0x22, 0x73, 0x28, 0x35, 0x80,
+  0x03, 0x06, 0x32, 0x22, 0x73, 0x22, 0x22, 0x22, 0x23, 0x80, 0x03, 0x86, 0x00, 0x04, 0x38, 0x47,
+  0x72, 0x29, 0x4C, 0x80, 0x24, 0x0B, 0x42, 0x73, 0x47, 0x83, 0x72, 0x73, 0x42, 0x28, 0x42, 0x73,
+  0x72, 0xC3, 0x80, 0x16, 0x81, 0x27, 0x00, 0x83, 0x80, 0x03, 0x0D, 0x33, 0x11, 0x92, 0x22, 0x33,
+  0x33, 0x34, 0x41, 0xC3, 0x34, 0x11, 0x11, 0xC3, 0x37, 0x80, 0xFC, 0x09, 0x31, 0x11, 0x11, 0x83,
+  0x41, 0x11, 0x11, 0xC4, 0x51, 0x11, 0x86, 0x00, 0x0C, 0x1C, 0x41, 0x11, 0x83, 0x71, 0x41, 0x11,
+  0x33, 0x11, 0x41, 0x11, 0x88, 0x1B, 0x80, 0x17, 0x04, 0xBB, 0x11, 0x11, 0xBF, 0x22, 0x80, 0x02,
+  0x01, 0x22, 0x1B, 0x80, 0x40, 0x00, 0xF2, 0x80, 0x03, 0x0F, 0x53, 0x33, 0x33, 0x35, 0x53, 0x85,
+  0x83, 0x33, 0x83, 0x51, 0xB1, 0x53, 0x1E, 0xFF, 0xFB, 0x53, 0x80, 0x12, 0x00, 0x27, 0x89, 0x83,
+  0x10, 0x33, 0x65, 0x57, 0x37, 0x33, 0x55, 0x57, 0x36, 0x37, 0x55, 0x58, 0x36, 0x35, 0x5B, 0x73,
+  0x37, 0x66, 0x80, 0x8F, 0x05, 0x16, 0x33, 0x62, 0x29, 0x11, 0x91, 0x83, 0x60, 0x17, 0x66, 0x69,
+  0x9D, 0x99, 0x66, 0x66, 0x43, 0xD6, 0x99, 0x69, 0x33, 0xD6, 0x99, 0x9D, 0x33, 0x99, 0x34, 0xDD,
+  0x34, 0x99, 0xFF, 0xFE, 0x7D, 0x99, 0x80, 0x3A, 0x00, 0x2E, 0x81, 0x3F, 0x00, 0x62, 0x80, 0xE3,
+  0x00, 0x2C, 0x80, 0xA5, 0x00, 0x68, 0x80, 0x03, 0x00, 0x23, 0x80, 0x03, 0x00, 0xC3, 0x80, 0x03,
+  0x80, 0x42, 0x01, 0x34, 0x93, 0x80, 0x03, 0x00, 0xA3, 0x80, 0x03, 0x07, 0x33, 0xEA, 0x55, 0x55,
+  0xD5, 0x55, 0x55, 0x54, 0x80, 0x02, 0x18, 0x54, 0x5D, 0x3A, 0x44, 0x45, 0x5B, 0x38, 0x55, 0x5B,
+  0x55, 0x33, 0xB5, 0x47, 0x45, 0x83, 0xB5, 0x4B, 0x77, 0x83, 0xA7, 0xB5, 0x44, 0x53, 0x33, 0x3C,
+  0x81, 0x03, 0x04, 0x45, 0x53, 0x33, 0x6C, 0x55, 0x80, 0x03, 0x00, 0x3A, 0x80, 0x03, 0x00, 0x38,
+  0x80, 0x03, 0x12, 0x33, 0xB3, 0x33, 0x6C, 0x66, 0x63, 0x33, 0x33, 0x22, 0x28, 0x37, 0x22, 0x22,
+  0x28, 0x3F, 0x22, 0x22, 0x24, 0x32, 0x89, 0xB6, 0x83, 0xBB, 0x12, 0x38, 0x47, 0x72, 0x73, 0x4C,
+  0x83, 0x33, 0x73, 0x42, 0x73, 0x47, 0x73, 0x72, 0x73, 0x72, 0x23, 0x42, 0x73, 0x72, 0x8E, 0x23,
+  0x18, 0x33, 0x34, 0x4A, 0x83, 0x34, 0xAA, 0xAA, 0x28, 0x35, 0xAA, 0xAA, 0xC3, 0x3A, 0xAA, 0xAA,
+  0x73, 0x4A, 0xAA, 0xAA, 0x83, 0x7A, 0xAA, 0xAA, 0x33, 0xAA, 0x83, 0x03, 0x03, 0xC3, 0x41, 0x11,
+  0x83, 0x80, 0x03, 0x09, 0x33, 0x53, 0x41, 0x11, 0x88, 0x83, 0x51, 0x11, 0x11, 0xC4, 0x83, 0xF6,
+  0x82, 0x00, 0x0C, 0x1C, 0xC1, 0x11, 0x11, 0x71, 0x53, 0x33, 0x33, 0x11, 0x53, 0x85, 0x83, 0x11,
+  0x81, 0x1C, 0x00, 0x15, 0x82, 0x16, 0x00, 0x1B, 0x85, 0x1E, 0x80, 0x03, 0x16, 0x15, 0x3D, 0x33,
+  0x42, 0x28, 0x33, 0x33, 0x26, 0x68, 0xD3, 0x38, 0x22, 0x29, 0xD3, 0x32, 0x6B, 0x83, 0x43, 0x94,
+  0x93, 0x33, 0xF3, 0x33, 0x81, 0x02, 0x1A, 0x82, 0x83, 0x33, 0x42, 0x22, 0x83, 0x38, 0x66, 0x66,
+  0x28, 0x34, 0x66, 0x66, 0x43, 0x34, 0x26, 0x62, 0x33, 0x38, 0x22, 0x2C, 0x33, 0x33, 0x39, 0x88,
+  0x34, 0x33, 0x80, 0x05, 0x02, 0x42, 0x28, 0x43, 0x80, 0x1E, 0x00, 0x23, 0x80, 0xD8, 0x03, 0x33,
+  0x33, 0x86, 0x6B, 0x80, 0x2D, 0x80, 0x45, 0x01, 0x22, 0x2F, 0x80, 0x03, 0x00, 0xB3, 0x80, 0x03,
+  0x04, 0x83, 0x33, 0x33, 0x38, 0x93, 0x80, 0x25, 0x82, 0x00, 0x10, 0xE7, 0x55, 0x36, 0xD5, 0x55,
+  0x55, 0x36, 0x55, 0x55, 0x44, 0x36, 0x5D, 0x3A, 0x44, 0x36, 0x5B, 0x38, 0x80, 0x0B, 0x0F, 0x33,
+  0xB5, 0x3A, 0x55, 0x83, 0xB5, 0x36, 0x77, 0x83, 0xA7, 0x54, 0x55, 0x53, 0x33, 0x44, 0x44, 0x83,
+  0x03, 0x00, 0x45, 0x80, 0x0B, 0x1F, 0x47, 0x3A, 0x53, 0x33, 0x57, 0x38, 0x53, 0x33, 0x5B, 0x33,
+  0xD3, 0x33, 0x77, 0x33, 0x83, 0x33, 0x32, 0x22, 0x24, 0x37, 0x32, 0x22, 0x28, 0x35, 0x42, 0x22,
+  0x28, 0x32, 0x42, 0x22, 0x22, 0x22, 0x89, 0x03, 0x80, 0x65, 0x0E, 0x47, 0x22, 0x73, 0x47, 0x83,
+  0x22, 0x73, 0x42, 0x73, 0x22, 0x73, 0x72, 0x73, 0x22, 0x23, 0x80, 0x07, 0x88, 0x00, 0x00, 0x72,
+  0x82, 0x23, 0x18, 0x33, 0x34, 0x47, 0x83, 0x34, 0xAA, 0x72, 0x28, 0x35, 0xAA, 0x72, 0xC3, 0x3A,
+  0xAA, 0x22, 0x73, 0x4A, 0xAA, 0x22, 0x83, 0x7A, 0xAA, 0x22, 0x33, 0xAA, 0x82, 0x03, 0x04, 0x41,
+  0x11, 0x11, 0x11, 0x34, 0x80, 0x03, 0x05, 0x33, 0x31, 0x11, 0x11, 0xC4, 0x51, 0x80, 0x08, 0x83,
+  0x00, 0x00, 0x1B, 0x85, 0x03, 0x06, 0xAD, 0x33, 0x42, 0x26, 0xAD, 0x33, 0x82, 0x80, 0x03, 0x02,
+  0x86, 0x26, 0xA3, 0x80, 0x03, 0x00, 0x43, 0x80, 0x03, 0x80, 0xF1, 0x80, 0x03, 0x0C, 0x22, 0x66,
+  0x33, 0x33, 0x39, 0x99, 0x93, 0x82, 0x66, 0x83, 0x93, 0x22, 0x62, 0x83, 0x03, 0x1B, 0x82, 0x66,
+  0x23, 0x83, 0x32, 0x66, 0x2B, 0x29, 0x38, 0x66, 0x66, 0x2B, 0x82, 0x66, 0x66, 0x99, 0x99, 0x88,
+  0x88, 0x92, 0x83, 0x33, 0x33, 0x42, 0x24, 0x33, 0x33, 0xF2, 0x80, 0x89, 0x00, 0x39, 0x81, 0x8D,
+  0x03, 0x82, 0x33, 0x33, 0x83, 0x80, 0x03, 0x00, 0x2C, 0x80, 0x0B, 0x00, 0x8B, 0x81, 0x0F, 0x81,
+  0x00, 0x0A, 0x36, 0x66, 0xE3, 0x33, 0x37, 0x55, 0x73, 0x33, 0x37, 0x44, 0xB3, 0x80, 0x03, 0x00,
+  0xA3, 0x80, 0x03, 0x81, 0x0B, 0x00, 0x55, 0x82, 0x03, 0x80, 0x00, 0x1B, 0xE6, 0x66, 0xE3, 0xE3,
+  0x85, 0x55, 0x83, 0x63, 0x85, 0x45, 0x83, 0xA3, 0x85, 0x45, 0x63, 0x73, 0x65, 0x44, 0x5D, 0xD3,
+  0x55, 0x55, 0x55, 0x53, 0x5B, 0x8D, 0x55, 0x53, 0x84, 0x41, 0x98, 0x00, 0x01, 0x84, 0x72, 0x90,
+  0x14, 0x00, 0x34, 0x80, 0x03, 0x00, 0x3A, 0x80, 0x03, 0x0A, 0x7A, 0xAA, 0xA5, 0x38, 0x11, 0x38,
+  0x83, 0x35, 0x11, 0x33, 0x33, 0x80, 0x03, 0x03, 0x55, 0x11, 0x11, 0x51, 0x83, 0xFF, 0x88, 0x00,
+  0x04, 0xC3, 0x31, 0x11, 0x11, 0x83, 0x81, 0x03, 0x00, 0x71, 0x80, 0x03, 0x80, 0x0F, 0x00, 0xC5,
+  0x8A, 0x1D, 0x09, 0x18, 0x41, 0x11, 0x11, 0x13, 0x34, 0x11, 0x11, 0x15, 0x33, 0x80, 0x22, 0x00,
+  0xC4, 0x8F, 0x3D, 0x80, 0x18, 0x00, 0x49, 0x80, 0x03, 0x00, 0xD9, 0x80, 0x03, 0x02, 0xD6, 0x11,
+  0x13, 0x80, 0x03, 0x00, 0x83, 0x80, 0x0B, 0x00, 0x33, 0x82, 0x03, 0x00, 0x99, 0x80, 0x03, 0x0B,
+  0x34, 0x66, 0x93, 0x82, 0x66, 0x66, 0x93, 0x22, 0x62, 0x66, 0x93, 0x26, 0x80, 0x03, 0x80, 0x0B,
+  0x2D, 0x83, 0x32, 0x66, 0x66, 0x29, 0x38, 0x66, 0x22, 0x2C, 0x82, 0x22, 0x99, 0x99, 0x99, 0x88,
+  0x83, 0x92, 0x83, 0x33, 0x83, 0x42, 0x24, 0x33, 0x83, 0xF2, 0x2B, 0x33, 0x23, 0x39, 0x2B, 0x33,
+  0x6B, 0x33, 0x8B, 0x33, 0x62, 0x83, 0x8B, 0x33, 0x22, 0x2C, 0x2B, 0x33, 0x88, 0x8B, 0x22, 0x84,
+  0xCE, 0x05, 0x36, 0x66, 0x33, 0x33, 0x37, 0x55, 0x80, 0x03, 0x00, 0x44, 0x88, 0x03, 0x00, 0x54,
+  0x83, 0x13, 0x0E, 0x33, 0x33, 0xE3, 0x86, 0x66, 0xE3, 0x73, 0x85, 0x55, 0x83, 0xB3, 0x85, 0x44,
+  0x83, 0xA3, 0x80, 0x07, 0x0A, 0x73, 0x65, 0x55, 0x5D, 0x55, 0x55, 0x55, 0x45, 0x55, 0x5B, 0x8D,
+  0x80, 0x27, 0x80, 0x1F, 0x80, 0x03, 0x00, 0x63, 0x80, 0x03, 0x00, 0xA3, 0x80, 0x03, 0x00, 0x73,
+  0x80, 0x4C, 0x07, 0xD3, 0x33, 0x33, 0x39, 0x53, 0x33, 0x33, 0xA1, 0x80, 0x03, 0x80, 0xA2, 0x02,
+  0x51, 0x11, 0x33, 0x80, 0xE3, 0x80, 0xE2, 0x00, 0x11, 0x80, 0x06, 0x8E, 0x00, 0x07, 0x22, 0x22,
+  0xF7, 0x38, 0x22, 0x22, 0x22, 0xE7, 0x80, 0x03, 0x92, 0x00, 0x09, 0xB1, 0x11, 0x11, 0xBF, 0xB1,
+  0x1B, 0xFF, 0x22, 0xFB, 0xF2, 0x93, 0x1F, 0x90, 0x52, 0xA9, 0x00, 0x04, 0x99, 0x22, 0x2F, 0xFE,
+  0xA7, 0x95, 0x7B, 0x81, 0x00, 0x01, 0xE6, 0x29, 0x9C, 0x41, 0x02, 0x19, 0x23, 0x33, 0x80, 0x05,
+  0x00, 0x63, 0x80, 0x03, 0x00, 0x16, 0x91, 0x1E, 0x00, 0x33, 0x88, 0x00, 0x00, 0x43, 0x80, 0x03,
+  0x00, 0x15, 0x80, 0x03, 0x00, 0x11, 0x80, 0x08, 0x00, 0x11, 0x80, 0x08, 0x0B, 0x11, 0x11, 0x14,
+  0x33, 0x84, 0x72, 0x22, 0x27, 0x33, 0x33, 0x38, 0x83, 0x84, 0x22, 0x0A, 0x77, 0x33, 0x33, 0x7A,
+  0xAA, 0x33, 0x34, 0xAA, 0xAA, 0x33, 0x3A, 0x80, 0x03, 0x03, 0x7A, 0xAA, 0xAA, 0x38, 0x80, 0x43,
+  0x00, 0x35, 0x84, 0x03, 0x91, 0x00, 0x10, 0xC3, 0x31, 0x18, 0x41, 0x83, 0x31, 0x13, 0x34, 0x83,
+  0x71, 0x15, 0x33, 0x83, 0x11, 0x11, 0xC4, 0xC5, 0x8F, 0x22, 0x00, 0x15, 0x81, 0x03, 0x00, 0x31,
+  0x80, 0x03, 0x00, 0x5B, 0x80, 0x2E, 0x80, 0x0B, 0x80, 0x26, 0x00, 0x1B, 0x80, 0x7B, 0x83, 0x03,
+  0x05, 0x33, 0x42, 0x22, 0x93, 0x33, 0x86, 0x80, 0x03, 0x00, 0x82, 0x86, 0x03, 0x00, 0x83, 0x80,
+  0x03, 0x28, 0x29, 0x33, 0x26, 0x22, 0x2B, 0x33, 0x39, 0x99, 0x99, 0x82, 0x66, 0x83, 0x92, 0x26,
+  0x62, 0x83, 0x42, 0x22, 0x62, 0x83, 0xF2, 0x82, 0x66, 0x2F, 0x39, 0x32, 0x66, 0x2C, 0x33, 0x38,
+  0x66, 0x26, 0x83, 0x82, 0x22, 0x22, 0x2C, 0x99, 0x88, 0x88, 0x8B, 0x81, 0xB8, 0x00, 0x24, 0x80,
+  0x03, 0x00, 0x22, 0x84, 0x03, 0x00, 0x82, 0x84, 0x03, 0x85, 0x0F, 0x81, 0x00, 0x0A, 0x36, 0x66,
+  0xE3, 0xE6, 0x37, 0x55, 0x73, 0x85, 0x37, 0x54, 0xB3, 0x80, 0x03, 0x00, 0xA3, 0x80, 0x03, 0x09,
+  0x73, 0x65, 0x37, 0x54, 0x55, 0x55, 0x37, 0x55, 0x55, 0x5B, 0x81, 0x1F, 0x06, 0x66, 0x33, 0xE3,
+  0x33, 0x55, 0x83, 0x63, 0x80, 0x03, 0x00, 0x73, 0x83, 0x03, 0x0D, 0x5D, 0x53, 0x33, 0x55, 0x54,
+  0x53, 0x33, 0x8D, 0x55, 0x53, 0x33, 0x33, 0x84, 0x72, 0x81, 0x46, 0x00, 0x38, 0x84, 0x4A, 0x81,
+  0x00, 0x07, 0x7A, 0x33, 0x33, 0x34, 0xAA, 0x33, 0x33, 0x3A, 0x80, 0x03, 0x03, 0x7A, 0xAA, 0xB5,
+  0x38, 0x80, 0xD0, 0x03, 0x35, 0x11, 0x11, 0x33, 0x80, 0x03, 0x00, 0x55, 0x8F, 0xFB, 0x81, 0x00,
+  0x02, 0x1B, 0x55, 0x51, 0x81, 0xE8, 0x87, 0x00, 0x80, 0x55, 0x02, 0x33, 0x14, 0x85, 0x81, 0x2D,
+  0x01, 0xBB, 0x11, 0x86, 0x14, 0x01, 0x34, 0x83, 0x81, 0x42, 0x02, 0x58, 0x33, 0x51, 0x80, 0x4B,
+  0x80, 0x03, 0x00, 0x15, 0x84, 0x3C, 0x89, 0x37, 0x85, 0x3B, 0x00, 0x15, 0x80, 0x03, 0x00, 0x11,
+  0x80, 0x08, 0x01, 0x11, 0x18, 0x8C, 0x99, 0x83, 0x00, 0x08, 0xEE, 0x33, 0x33, 0x37, 0x55, 0x33,
+  0x33, 0x75, 0x55, 0x80, 0x06, 0x1C, 0x44, 0x33, 0x37, 0x4B, 0x3A, 0x33, 0x37, 0x58, 0x36, 0x33,
+  0x37, 0x83, 0x3D, 0x33, 0x3A, 0x78, 0xB5, 0x33, 0x3A, 0x55, 0x55, 0xD7, 0x75, 0x55, 0x44, 0x55,
+  0x55, 0x55, 0x44, 0x81, 0x00, 0x0D, 0x5A, 0x38, 0x55, 0xD3, 0x5B, 0x33, 0xA5, 0x5A, 0x45, 0x73,
+  0x3A, 0x55, 0x44, 0x5A, 0x80, 0x03, 0x00, 0x45, 0x82, 0x18, 0x83, 0x1C, 0x80, 0x0C, 0x81, 0x50,
+  0x80, 0xE8, 0x06, 0x33, 0x55, 0x83, 0x33, 0x33, 0x44, 0xB3, 0x80, 0x03, 0x00, 0x58, 0x80, 0x03,
+  0x00, 0x5B, 0x80, 0x0F, 0x80, 0x10, 0x02, 0x55, 0x45, 0xA3, 0x81, 0x1E, 0x80, 0xA3, 0x00, 0x34,
+  0x80, 0x03, 0x00, 0x31, 0x84, 0x03, 0x00, 0x35, 0x84, 0x0F, 0x00, 0x38, 0x81, 0xBB, 0x80, 0xC1,
+  0x06, 0x1C, 0x11, 0x11, 0xC5, 0x33, 0x38, 0x1B, 0x80, 0x3F, 0x01, 0x1B, 0xC8, 0x81, 0x10, 0x00,
+  0x88, 0x81, 0x14, 0x8A, 0x00, 0x02, 0x84, 0x58, 0x51, 0x88, 0x3F, 0x02, 0x81, 0x11, 0xC5, 0x8D,
+  0x20, 0x03, 0x55, 0x51, 0x11, 0xC3, 0x80, 0x4C, 0x81, 0x03, 0x87, 0xFB, 0x03, 0x85, 0x55, 0x11,
+  0x1B, 0x80, 0x1B, 0x80, 0x0F, 0x00, 0x1B, 0x82, 0xF6, 0x01, 0x38, 0x83, 0x80, 0x7A, 0x80, 0x0E,
+  0x81, 0x4B, 0x03, 0x51, 0x11, 0x11, 0x15, 0x83, 0x3A, 0x82, 0x1A, 0x84, 0x00, 0x80, 0xBA, 0x83,
+  0x3B, 0x80, 0x44, 0x00, 0x11, 0x80, 0x08, 0x02, 0x11, 0x11, 0x18, 0x80, 0x11, 0x00, 0x39, 0x89,
+  0x22, 0x85, 0x00, 0x00, 0x38, 0x80, 0x03, 0x00, 0x82, 0x80, 0x06, 0x03, 0x22, 0x33, 0x33, 0x37,
+  0x80, 0xED, 0x00, 0x37, 0x80, 0x3A, 0x00, 0x37, 0x80, 0xC1, 0x09, 0x3A, 0x78, 0xEE, 0x33, 0x3A,
+  0x55, 0x55, 0x57, 0x75, 0x44, 0x85, 0x00, 0x1E, 0x3A, 0x5A, 0x38, 0x54, 0x36, 0x5B, 0x33, 0xA5,
+  0x3D, 0x55, 0x73, 0x3A, 0xD5, 0x55, 0x56, 0x3A, 0x54, 0x45, 0x55, 0x5F, 0x44, 0x44, 0x45, 0x91,
+  0x44, 0x44, 0x54, 0x11, 0x44, 0x44, 0x59, 0x80, 0x65, 0x06, 0x32, 0x11, 0x5A, 0xA9, 0x11, 0x11,
+  0x5F, 0x8D, 0xD3, 0x9A, 0x00, 0x07, 0x19, 0x22, 0x11, 0x12, 0x22, 0x22, 0x11, 0x92, 0x80, 0x03,
+  0x90, 0x00, 0x04, 0x22, 0x22, 0x91, 0x99, 0x22, 0x84, 0x00, 0x8D, 0x38, 0x81, 0x3B, 0x00, 0x99,
+  0x80, 0x37, 0x87, 0x1F, 0x83, 0x47, 0x00, 0x19, 0x87, 0x12, 0x8B, 0x00, 0x81, 0x4F, 0x00, 0x29,
+  0x81, 0x25, 0x00, 0x22, 0x86, 0x53, 0x8C, 0x1E, 0x86, 0x00, 0x00, 0x55, 0x90, 0x00, 0x82, 0x24,
+  0x04, 0xFE, 0x77, 0x77, 0xE7, 0x77, 0x93, 0x00, 0x82, 0xAF, 0x00, 0x91, 0x85, 0x63, 0x00, 0x91,
+  0x80, 0x03, 0x00, 0x29, 0x81, 0x6B, 0x00, 0x29, 0x94, 0xBF, 0x82, 0x00, 0x80, 0x2E, 0x00, 0x11,
+  0x85, 0x97, 0x80, 0x00, 0x00, 0x23, 0x83, 0xD7, 0x93, 0x00, 0x00, 0x33, 0x80, 0x03, 0x0D, 0x34,
+  0x11, 0x11, 0xC5, 0x71, 0x11, 0x1B, 0x83, 0x2F, 0x11, 0x11, 0xC8, 0x22, 0xF1, 0x80, 0x37, 0x80,
+  0x08, 0x02, 0x22, 0x22, 0xB1, 0x80, 0x03, 0x02, 0x21, 0x11, 0x1C, 0x81, 0x23, 0x03, 0x38, 0x84,
+  0x58, 0x33, 0x84, 0x00, 0x00, 0x88, 0x80, 0x03, 0x80, 0x2E, 0x8A, 0x43, 0x00, 0x51, 0x80, 0xDA,
+  0x03, 0x31, 0x11, 0xC3, 0x33, 0x81, 0x03, 0x02, 0x81, 0x11, 0x15, 0x81, 0x52, 0x00, 0x53, 0x80,
+  0x03, 0x00, 0x18, 0x83, 0x1D, 0x02, 0x1B, 0x33, 0x51, 0x80, 0x03, 0x84, 0x00, 0x00, 0x35, 0x85,
+  0x08, 0x03, 0x85, 0x55, 0x11, 0x15, 0x82, 0x7F, 0x84, 0x00, 0x01, 0x34, 0x83, 0x81, 0x57, 0x00,
+  0x58, 0x80, 0x2B, 0x01, 0x11, 0x53, 0x80, 0x03, 0x82, 0x1B, 0x89, 0x1F, 0x8D, 0x00, 0x00, 0x53,
+  0x80, 0x03, 0x00, 0x18, 0x80, 0x03, 0x00, 0x38, 0x8E, 0x19, 0x26, 0xEE, 0x33, 0x33, 0x37, 0x55,
+  0xD7, 0x33, 0x75, 0x55, 0x55, 0x37, 0x55, 0x44, 0x55, 0x37, 0x57, 0x3A, 0x5A, 0x37, 0x58, 0x36,
+  0x5B, 0x37, 0x83, 0x3D, 0x55, 0x36, 0x78, 0xD5, 0x55, 0x3A, 0x55, 0x54, 0x55, 0x75, 0x44, 0x44,
+  0x44, 0x54, 0x80, 0x03, 0x81, 0x00, 0x01, 0x38, 0x54, 0x80, 0x49, 0x08, 0xA5, 0x5A, 0xAA, 0x73,
+  0x3A, 0x55, 0x55, 0x56, 0x3A, 0x80, 0x30, 0x01, 0x55, 0x55, 0x84, 0x19, 0x80, 0x00, 0x02, 0x45,
+  0x55, 0x55, 0x85, 0x55, 0x80, 0x9E, 0x01, 0x33, 0xB3, 0x80, 0x03, 0x00, 0x58, 0x80, 0x03, 0x00,
+  0x5B, 0x80, 0x03, 0x00, 0x45, 0x80, 0x10, 0x01, 0x45, 0xA3, 0x81, 0x19, 0x80, 0xA3, 0x00, 0x34,
+  0x80, 0x03, 0x00, 0x31, 0x80, 0xE4, 0x00, 0x31, 0x80, 0x07, 0x00, 0x35, 0x84, 0x0F, 0x00, 0x38,
+  0x81, 0xBB, 0x80, 0xC0, 0x06, 0x1C, 0x11, 0x11, 0xC5, 0x33, 0x38, 0x84, 0x81, 0x3F, 0x00, 0xC8,
+  0x81, 0x2D, 0x00, 0x88, 0x82, 0x15, 0x00, 0xC5, 0x85, 0xDF, 0x00, 0xAA, 0x9C, 0x00, 0x01, 0x11,
+  0x15, 0x82, 0x61, 0x00, 0x33, 0x80, 0x5D, 0x83, 0x03, 0x81, 0x0B, 0x81, 0x13, 0x80, 0xFC, 0x00,
+  0x1C, 0x81, 0x7E, 0x0A, 0x85, 0x45, 0x44, 0x33, 0xD5, 0x44, 0x44, 0x36, 0x54, 0x44, 0x55, 0x80,
+  0x03, 0x0C, 0x5B, 0x3A, 0x54, 0x44, 0x58, 0x37, 0x54, 0x44, 0x5E, 0x3D, 0x54, 0x44, 0x53, 0x80,
+  0x03, 0x00, 0x58, 0x82, 0xC7, 0x80, 0xD3, 0x07, 0x57, 0x86, 0x75, 0x44, 0xE3, 0x33, 0x3A, 0x54,
+  0x80, 0x31, 0x00, 0xD5, 0x80, 0x03, 0x00, 0x74, 0x85, 0x03, 0x05, 0x44, 0x45, 0x78, 0x33, 0x44,
+  0x57, 0x80, 0xCB, 0x80, 0xDC, 0x81, 0xCF, 0x81, 0xD7, 0x00, 0x44, 0x80, 0x0B, 0x01, 0x44, 0x5A,
+  0x80, 0x03, 0x0C, 0x55, 0xA3, 0x33, 0x36, 0x54, 0x73, 0x33, 0x33, 0xA5, 0x53, 0x33, 0x33, 0xE5,
+  0x80, 0x03, 0x00, 0x35, 0x88, 0x03, 0x04, 0xE5, 0x73, 0x33, 0x3E, 0xD5, 0x81, 0xD5, 0x01, 0x33,
+  0x51, 0x80, 0x03, 0x00, 0x81, 0x80, 0x03, 0x00, 0x31, 0x80, 0x03, 0x00, 0x34, 0x81, 0x10, 0x89,
+  0x00, 0x85, 0xE7, 0x85, 0x00, 0x00, 0x41, 0x80, 0x03, 0x01, 0x38, 0x51, 0x81, 0xC5, 0x01, 0x38,
+  0x45, 0x91, 0x1F, 0x89, 0x00, 0x01, 0x38, 0x45, 0x80, 0x28, 0x80, 0xEC, 0x80, 0x04, 0x80, 0x03,
+  0x00, 0x1B, 0x84, 0x03, 0x81, 0x0B, 0x81, 0x13, 0x03, 0x18, 0x33, 0x11, 0x1C, 0x81, 0x41, 0x01,
+  0x85, 0x55, 0x80, 0xD2, 0x00, 0x44, 0x80, 0xA8, 0x83, 0x03, 0x01, 0x37, 0x55, 0x83, 0x03, 0x00,
+  0x3D, 0x83, 0x03, 0x02, 0x44, 0x44, 0x45, 0x81, 0xFF, 0x09, 0x55, 0x55, 0x57, 0x86, 0x75, 0x4B,
+  0xE3, 0x33, 0x3A, 0x58, 0x80, 0x31, 0x00, 0x5E, 0x80, 0x03, 0x80, 0xC1, 0x01, 0x33, 0x48, 0x80,
+  0x03, 0x06, 0x44, 0x44, 0x5F, 0x11, 0x44, 0x44, 0x51, 0x80, 0x03, 0x16, 0xBF, 0x11, 0x54, 0x45,
+  0xA1, 0x11, 0xB5, 0x45, 0x61, 0x11, 0x75, 0x44, 0x41, 0x11, 0x74, 0x55, 0x91, 0x11, 0x74, 0x54,
+  0x11, 0x11, 0x22, 0x8F, 0x00, 0x00, 0x2E, 0x80, 0x03, 0x00, 0x27, 0x80, 0x03, 0x00, 0xF7, 0x80,
+  0x03, 0x01, 0x77, 0x19, 0x80, 0x04, 0x00, 0x92, 0x90, 0x24, 0x85, 0x00, 0x81, 0x7A, 0xB8, 0x00,
+  0x82, 0xBA, 0x95, 0x00, 0x00, 0x45, 0x80, 0x03, 0x02, 0x22, 0x22, 0x91, 0x80, 0xA3, 0x00, 0x21,
+  0x84, 0x03, 0x00, 0x22, 0x81, 0x03, 0x00, 0x91, 0x80, 0x03, 0x00, 0x29, 0x85, 0x7F, 0x00, 0x11,
+  0x94, 0x00, 0x00, 0x51, 0x80, 0x03, 0x00, 0x55, 0x80, 0x03, 0x02, 0x22, 0x22, 0x2F, 0x85, 0x37,
+  0x00, 0xF1, 0x80, 0x03, 0x00, 0x2B, 0x8D, 0xBF, 0x8D, 0x37, 0x00, 0xB1, 0x80, 0x03, 0x00, 0xF1,
+  0x80, 0x03, 0x06, 0x24, 0x45, 0x11, 0x11, 0x2E, 0x33, 0x38, 0x80, 0x05, 0x97, 0x00, 0x81, 0x63,
+  0x9C, 0x00, 0x05, 0x1C, 0x15, 0x33, 0x33, 0x33, 0x11, 0x80, 0x03, 0x03, 0x1B, 0x33, 0x33, 0x34,
+  0x81, 0x03, 0x80, 0x0B, 0x00, 0x34, 0x80, 0x13, 0x04, 0x3D, 0x18, 0x33, 0x33, 0x37, 0x80, 0x16,
+  0x17, 0x37, 0x85, 0x55, 0x44, 0x44, 0xD5, 0x44, 0x44, 0x45, 0x55, 0x44, 0x45, 0x57, 0x54, 0x44,
+  0x4B, 0xE3, 0x54, 0x44, 0x58, 0x33, 0x44, 0x44, 0x5E, 0x80, 0x03, 0x00, 0x53, 0x80, 0x03, 0x06,
+  0x58, 0x33, 0x54, 0x44, 0x44, 0x44, 0x55, 0x80, 0x04, 0x0E, 0x86, 0x75, 0x44, 0x44, 0x33, 0x3A,
+  0x54, 0x44, 0x33, 0x33, 0xD5, 0x45, 0x33, 0x33, 0x75, 0x80, 0x07, 0x00, 0x74, 0x82, 0x03, 0x04,
+  0x44, 0x78, 0x33, 0x36, 0x57, 0x80, 0x48, 0x00, 0xB3, 0x80, 0x03, 0x00, 0xA3, 0x80, 0x03, 0x00,
+  0x83, 0x84, 0x0B, 0x00, 0x5A, 0x80, 0x03, 0x0C, 0x55, 0xA3, 0x33, 0x38, 0x55, 0x73, 0x33, 0x33,
+  0xA5, 0xD3, 0x33, 0x33, 0xE5, 0x80, 0x03, 0x00, 0x35, 0x81, 0x03, 0x00, 0x53, 0x83, 0x03, 0x00,
+  0xE5, 0x80, 0x17, 0x00, 0xD5, 0x81, 0x2C, 0x01, 0x33, 0x51, 0x80, 0x92, 0x00, 0x81, 0x80, 0x03,
+  0x00, 0x31, 0x81, 0x9A, 0x81, 0xAA, 0x00, 0x41, 0x80, 0x03, 0x00, 0x38, 0x81, 0x19, 0x81, 0x00,
+  0x95, 0xF7, 0x02, 0x33, 0x38, 0x45, 0x81, 0x2B, 0x04, 0x38, 0x85, 0xC1, 0x1B, 0xBB, 0x80, 0x06,
+  0x00, 0x88, 0x85, 0x2F, 0x80, 0x00, 0x00, 0x4D, 0x80, 0x47, 0x03, 0xEE, 0x33, 0x33, 0x3E, 0x80,
+  0x03, 0x08, 0x97, 0xD9, 0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x77, 0x74, 0x86, 0x1C, 0x08, 0xFB, 0xBF,
+  0xDD, 0x43, 0x66, 0x66, 0x69, 0x9B, 0x66, 0x81, 0x00, 0x02, 0x6B, 0xB6, 0x66, 0x82, 0x82, 0x8C,
+  0x00, 0x00, 0x43, 0x80, 0x03, 0x00, 0x94, 0x80, 0x03, 0x00, 0x6F, 0x80, 0x03, 0x09, 0x37, 0x54,
+  0x44, 0x5B, 0x36, 0x54, 0x44, 0x45, 0x33, 0x55, 0x80, 0xFF, 0x04, 0x75, 0x55, 0x55, 0x33, 0xE5,
+  0x80, 0x03, 0x01, 0x38, 0x55, 0x80, 0xFB, 0x01, 0xEA, 0x7D, 0x81, 0x2B, 0x0C, 0xE3, 0x33, 0x33,
+  0x74, 0xB3, 0x33, 0x36, 0x54, 0x55, 0x77, 0xD5, 0x54, 0x45, 0x80, 0x23, 0x01, 0x44, 0x54, 0x80,
+  0x03, 0x02, 0x44, 0x44, 0x55, 0x80, 0x00, 0x01, 0x7A, 0xE8, 0x80, 0x95, 0x03, 0x44, 0x55, 0x5D,
+  0x7A, 0x81, 0x0F, 0x03, 0x44, 0x44, 0x45, 0x45, 0x81, 0x07, 0x07, 0x54, 0x55, 0x57, 0x83, 0x5B,
+  0x78, 0x33, 0x33, 0x85, 0x77, 0x15, 0xA5, 0x5B, 0x33, 0x33, 0x55, 0x58, 0x33, 0x33, 0x5D, 0x83,
+  0x33, 0x66, 0xA3, 0x33, 0x36, 0xCC, 0x33, 0x33, 0xCC, 0xCC, 0x33, 0x32, 0x80, 0x03, 0x05, 0x6C,
+  0xC6, 0xCC, 0x33, 0xCC, 0x63, 0x80, 0x21, 0x04, 0x88, 0x77, 0x34, 0x72, 0x22, 0x92, 0x00, 0x00,
+  0x34, 0x80, 0x03, 0x00, 0x77, 0x80, 0x48, 0x02, 0x22, 0x22, 0x73, 0x80, 0x03, 0x01, 0x22, 0x27,
+  0x91, 0x23, 0x89, 0xD3, 0x00, 0x22, 0x80, 0x77, 0x02, 0x22, 0x22, 0x23, 0x81, 0x2B, 0x00, 0x83,
+  0x80, 0x03, 0x00, 0x28, 0x82, 0x1F, 0x02, 0x85, 0x11, 0x1B, 0x80, 0x1A, 0x00, 0x38, 0x89, 0xFF,
+  0x80, 0x00, 0x00, 0x34, 0x80, 0x03, 0x00, 0x3E, 0x80, 0x03, 0x01, 0x97, 0xAA, 0x80, 0x00, 0x02,
+  0x88, 0x77, 0x77, 0x80, 0x39, 0x83, 0x00, 0x10, 0xED, 0xFB, 0xBF, 0xDD, 0x99, 0x66, 0x69, 0x66,
+  0x66, 0x66, 0x99, 0x69, 0xDB, 0x66, 0x9B, 0xB6, 0xA7, 0x85, 0xC8, 0x88, 0x67, 0x00, 0x9B, 0x80,
+  0x04, 0x01, 0x66, 0x94, 0x80, 0x03, 0x00, 0x6F, 0x80, 0x0C, 0x04, 0x37, 0x55, 0x44, 0x33, 0x36,
+  0x80, 0x03, 0x00, 0x33, 0x81, 0x03, 0x00, 0x75, 0x80, 0x03, 0x0F, 0xE5, 0x55, 0x33, 0x33, 0x32,
+  0x11, 0x33, 0x33, 0x91, 0x11, 0x33, 0x39, 0x11, 0x11, 0x4B, 0xE3, 0x80, 0x19, 0x0F, 0xB3, 0x33,
+  0x36, 0x54, 0x55, 0xB7, 0xD5, 0x44, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0x95, 0x5F, 0x11, 0x88, 0x00,
+  0x04, 0x75, 0x41, 0x11, 0x11, 0x54, 0x80, 0x07, 0x00, 0x51, 0x80, 0x03, 0x00, 0xF1, 0x89, 0x18,
+  0x84, 0x00, 0x8C, 0xEE, 0x00, 0x27, 0x80, 0x03, 0x00, 0xE7, 0x80, 0x03, 0x12, 0x77, 0x22, 0xF7,
+  0x77, 0x77, 0x2F, 0x77, 0x77, 0x77, 0x11, 0x11, 0x1C, 0x22, 0x11, 0x11, 0x92, 0x22, 0x11, 0x19,
+  0x8C, 0x29, 0x84, 0x00, 0x80, 0x72, 0x8D, 0x00, 0x03, 0x44, 0x55, 0x54, 0x44, 0x86, 0x00, 0x8C,
+  0x1A, 0x8E, 0x00, 0x81, 0x13, 0x90, 0x16, 0x8A, 0x40, 0x83, 0x25, 0x96, 0x1E, 0x94, 0x59, 0x8F,
+  0x7F, 0x01, 0x44, 0x45, 0x82, 0x27, 0x00, 0x45, 0x95, 0x1F, 0x8B, 0xC4, 0x81, 0x2B, 0x07, 0x45,
+  0x55, 0x22, 0x91, 0x11, 0x11, 0x22, 0x29, 0x80, 0x03, 0x00, 0x22, 0x81, 0x03, 0x00, 0x91, 0x80,
+  0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x29, 0x80, 0x03, 0x00, 0x22, 0x81, 0x03, 0x06, 0x91, 0x22,
+  0x43, 0x33, 0x33, 0x22, 0x23, 0x80, 0x03, 0x0D, 0x2A, 0x43, 0x33, 0x22, 0x22, 0xAA, 0x58, 0x22,
+  0x22, 0xFA, 0xAA, 0x22, 0x22, 0x2B, 0x80, 0x03, 0x00, 0x22, 0x81, 0x03, 0x04, 0xFA, 0x33, 0x33,
+  0x33, 0x87, 0x80, 0x03, 0x86, 0x00, 0x80, 0x2A, 0x02, 0x33, 0x22, 0x83, 0x80, 0x03, 0x00, 0x28,
+  0x80, 0x03, 0x03, 0x22, 0x33, 0x33, 0xAA, 0x80, 0x00, 0x03, 0x33, 0x38, 0x88, 0x77, 0x87, 0x21,
+  0x13, 0x4D, 0xFB, 0x33, 0x34, 0x99, 0x96, 0x33, 0x39, 0x66, 0x99, 0x33, 0xBF, 0xDB, 0x66, 0xAA,
+  0xAA, 0xA7, 0x83, 0x77, 0x74, 0x87, 0x1D, 0x0F, 0xBF, 0xDD, 0x43, 0x33, 0x99, 0x66, 0x9B, 0x43,
+  0x66, 0x66, 0x66, 0x94, 0x9B, 0xB9, 0x66, 0x9F, 0x80, 0x12, 0x00, 0x38, 0x80, 0x03, 0x00, 0x34,
+  0x89, 0x63, 0x89, 0x00, 0x08, 0x54, 0x44, 0x5B, 0xE3, 0x54, 0x44, 0x45, 0xB3, 0x54, 0x80, 0xEA,
+  0x00, 0x75, 0x80, 0xD0, 0x00, 0xE5, 0x80, 0x08, 0x00, 0x38, 0x80, 0xDB, 0x03, 0x33, 0xEA, 0x7D,
+  0x55, 0x80, 0x1E, 0x0D, 0xE8, 0x33, 0x33, 0x75, 0x44, 0x33, 0x36, 0x54, 0x44, 0xB7, 0xD5, 0x54,
+  0x44, 0x54, 0x80, 0x1B, 0x80, 0x03, 0x00, 0x54, 0x80, 0x1E, 0x05, 0x5B, 0x44, 0x55, 0x7A, 0x83,
+  0x88, 0x80, 0x20, 0x07, 0x45, 0x5D, 0x7A, 0xA5, 0x44, 0x45, 0x45, 0x55, 0x80, 0x3A, 0x80, 0x03,
+  0x06, 0x5D, 0xA3, 0x55, 0x57, 0x83, 0x33, 0x78, 0x88, 0x5F, 0x80, 0xC6, 0x01, 0x33, 0x29, 0x80,
+  0x7F, 0x0B, 0x93, 0x33, 0x4D, 0x77, 0x33, 0x3D, 0x77, 0x77, 0x34, 0x77, 0x77, 0x77, 0x80, 0x06,
+  0x02, 0x77, 0x47, 0x7D, 0x80, 0x04, 0x81, 0x97, 0x04, 0x88, 0x47, 0x77, 0x72, 0x22, 0x97, 0x00,
+  0x00, 0x83, 0x80, 0x3F, 0x01, 0x22, 0x73, 0x80, 0x03, 0x02, 0x22, 0x27, 0x43, 0x91, 0x1F, 0x26,
+  0x33, 0x3F, 0xD3, 0x3F, 0x33, 0x49, 0xD3, 0x3B, 0x33, 0xD9, 0xF3, 0x49, 0x33, 0xD9, 0x69, 0x99,
+  0x33, 0xEB, 0x99, 0x99, 0x33, 0x34, 0x94, 0xD9, 0x83, 0x34, 0x93, 0xE9, 0x83, 0x34, 0x6B, 0x99,
+  0x6B, 0xE3, 0x39, 0x66, 0x6E, 0x33, 0x3B, 0x81, 0x03, 0x15, 0x9B, 0x6D, 0x44, 0xFF, 0xD3, 0x69,
+  0x99, 0x43, 0x33, 0x9B, 0x96, 0xE3, 0x33, 0xB3, 0x49, 0x33, 0x33, 0xBE, 0x4B, 0x33, 0x33, 0x74,
+  0x80, 0x5F, 0x17, 0xC3, 0x33, 0x33, 0x94, 0x33, 0x33, 0x82, 0x22, 0x33, 0x42, 0x22, 0x66, 0x34,
+  0x22, 0x62, 0x66, 0xF2, 0x26, 0x66, 0x66, 0x82, 0x62, 0x66, 0x66, 0x80, 0x0A, 0x00, 0x62, 0x81,
+  0xC3, 0x04, 0x88, 0x88, 0x88, 0x84, 0x66, 0x80, 0x0E, 0x80, 0x03, 0x81, 0x00, 0x0B, 0x22, 0x66,
+  0xB2, 0x66, 0x29, 0x28, 0x33, 0x26, 0xC3, 0x93, 0x33, 0x86, 0x80, 0x3A, 0x02, 0x33, 0x33, 0x44,
+  0x80, 0x4B, 0x0C, 0x22, 0x22, 0x2C, 0x43, 0x66, 0x66, 0x62, 0x28, 0x22, 0x66, 0x62, 0x62, 0x92,
+  0x80, 0x24, 0x00, 0x39, 0x80, 0x43, 0x01, 0x33, 0x42, 0x80, 0x03, 0x88, 0x00, 0x00, 0x93, 0x80,
+  0x03, 0x00, 0x28, 0x81, 0xCF, 0x80, 0xD4, 0x00, 0x66, 0x80, 0x08, 0x08, 0x66, 0x22, 0x93, 0x33,
+  0x37, 0x22, 0x33, 0x33, 0x32, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00, 0x72, 0x82, 0x03, 0x00,
+  0x83, 0x80, 0x03, 0x00, 0x23, 0x80, 0x03, 0x00, 0x27, 0x80, 0x03, 0x80, 0xF9, 0x00, 0x37, 0x80,
+  0xE3, 0x82, 0x1D, 0x01, 0x33, 0xC2, 0x80, 0x03, 0x00, 0x34, 0x89, 0x4F, 0x81, 0x00, 0x00, 0x22,
+  0x8C, 0x00, 0x01, 0x32, 0x22, 0x80, 0x38, 0x00, 0x22, 0x80, 0x5C, 0x01, 0x22, 0xC3, 0x80, 0x35,
+  0x00, 0xC3, 0x88, 0x1F, 0x00, 0x2C, 0x80, 0x52, 0x01, 0x73, 0x34, 0x80, 0x7A, 0x8A, 0x00, 0x5D,
+  0x73, 0x33, 0x3F, 0xD3, 0x23, 0x33, 0x49, 0xD3, 0x27, 0x33, 0xD9, 0xF3, 0x22, 0x33, 0xD9, 0x99,
+  0x22, 0x33, 0xEB, 0x69, 0x42, 0x33, 0x34, 0x94, 0x32, 0x83, 0x34, 0x93, 0x37, 0x83, 0x3E, 0x6B,
+  0x3F, 0x9B, 0xE3, 0xE6, 0x3B, 0x9E, 0x33, 0x3B, 0x49, 0x93, 0x33, 0x3B, 0x96, 0x6D, 0x44, 0xFF,
+  0x66, 0x66, 0x99, 0x43, 0xD6, 0x6B, 0x96, 0xE3, 0xE6, 0xB3, 0x49, 0x33, 0xB6, 0xBE, 0x4B, 0x33,
+  0xEE, 0xE4, 0x33, 0x33, 0xEE, 0x73, 0x33, 0x33, 0xE7, 0x33, 0x33, 0xD9, 0xD3, 0x33, 0x49, 0x99,
+  0x33, 0x34, 0x96, 0x96, 0x33, 0x39, 0x66, 0x92, 0x33, 0xD9, 0x66, 0x62, 0x33, 0x99, 0x80, 0x07,
+  0x07, 0x91, 0x11, 0x11, 0x82, 0x11, 0x11, 0x11, 0x51, 0x80, 0x03, 0x00, 0xF1, 0x80, 0x03, 0xA4,
+  0x00, 0x00, 0x19, 0x84, 0x03, 0x01, 0x12, 0x12, 0x80, 0xB9, 0x81, 0x03, 0x00, 0x92, 0x8D, 0xE8,
+  0x84, 0x00, 0x00, 0x55, 0x93, 0x00, 0x00, 0x54, 0x80, 0x03, 0x00, 0x44, 0x80, 0x06, 0x80, 0x03,
+  0x01, 0x44, 0x44, 0x80, 0x02, 0x01, 0x44, 0x54, 0x80, 0x03, 0xAF, 0x00, 0x01, 0x4F, 0x33, 0x94,
+  0x16, 0x02, 0x34, 0x43, 0x33, 0x83, 0x00, 0x93, 0x1E, 0x87, 0x00, 0x8B, 0x19, 0x02, 0x33, 0x34,
+  0x44, 0x85, 0x38, 0x94, 0x3F, 0x01, 0x33, 0x3F, 0x80, 0x03, 0x98, 0x1F, 0x81, 0x00, 0x00, 0x34,
+  0x81, 0x27, 0x80, 0x28, 0x95, 0x1F, 0x89, 0x00, 0x00, 0x55, 0x80, 0x00, 0x02, 0x44, 0x44, 0x45,
+  0x80, 0x03, 0x00, 0x44, 0x81, 0x03, 0x00, 0x45, 0x8D, 0x1F, 0x03, 0x22, 0x22, 0x22, 0x29, 0x80,
+  0x03, 0x8A, 0x00, 0x00, 0x62, 0x84, 0x03, 0x00, 0x66, 0x80, 0x03, 0x00, 0x11, 0x80, 0x00, 0x00,
+  0x91, 0x80, 0x03, 0x00, 0x29, 0x80, 0x03, 0x00, 0x22, 0x80, 0x08, 0x00, 0x22, 0x80, 0x08, 0x81,
+  0x15, 0x02, 0x22, 0x22, 0x21, 0x80, 0x03, 0x82, 0x1E, 0x00, 0x12, 0x81, 0x04, 0x95, 0x00, 0x11,
+  0x22, 0x22, 0x73, 0x33, 0x22, 0x22, 0x23, 0x33, 0x1C, 0x72, 0x27, 0x33, 0x15, 0x34, 0x22, 0x33,
+  0x11, 0x53, 0x80, 0x03, 0x46, 0x14, 0x42, 0x33, 0x11, 0x11, 0x42, 0x83, 0x11, 0x11, 0x15, 0x83,
+  0x3F, 0xD3, 0x3F, 0x6B, 0x49, 0xD3, 0x3B, 0x6E, 0xD9, 0xF3, 0x49, 0x6E, 0xD9, 0x99, 0x99, 0x6D,
+  0xEB, 0x66, 0x69, 0x99, 0x34, 0x94, 0xD9, 0x9B, 0x3E, 0x93, 0xE9, 0xB3, 0x3E, 0x9B, 0xB6, 0xBE,
+  0xE3, 0x39, 0x66, 0x94, 0x33, 0x3B, 0x66, 0xB3, 0x33, 0x3B, 0x9B, 0x33, 0x44, 0xFF, 0xD3, 0x33,
+  0x99, 0x43, 0x33, 0x34, 0x96, 0xE3, 0x33, 0x3B, 0x49, 0x33, 0x33, 0xDB, 0x80, 0x03, 0x01, 0xBB,
+  0x33, 0x82, 0x00, 0x06, 0x94, 0x88, 0x33, 0x82, 0x22, 0x22, 0x42, 0x81, 0xBC, 0x03, 0x66, 0x66,
+  0x66, 0x26, 0x83, 0x03, 0x04, 0x28, 0x66, 0x66, 0x22, 0x93, 0x81, 0x1D, 0x02, 0x88, 0x88, 0x84,
+  0x81, 0xE7, 0x81, 0x1A, 0x82, 0x19, 0x0A, 0xB2, 0x66, 0x29, 0x92, 0x33, 0x26, 0xC3, 0x39, 0x33,
+  0x82, 0xC3, 0x82, 0x3D, 0x80, 0x47, 0x0B, 0x33, 0x22, 0x2C, 0x43, 0x33, 0x66, 0x26, 0x28, 0x93,
+  0x66, 0x26, 0x62, 0x80, 0x37, 0x01, 0x66, 0x62, 0x81, 0x2C, 0x00, 0x42, 0x80, 0x03, 0x80, 0x1A,
+  0x00, 0x3D, 0x80, 0x03, 0x00, 0x37, 0x80, 0x03, 0x00, 0x47, 0x80, 0x03, 0x00, 0xD7, 0x81, 0x03,
+  0x00, 0x83, 0x80, 0x03, 0x00, 0x28, 0x80, 0x03, 0x04, 0x62, 0x93, 0x33, 0xD7, 0x77, 0x80, 0x10,
+  0x8A, 0x03, 0x00, 0x43, 0x80, 0x03, 0x00, 0x73, 0x80, 0x03, 0x00, 0x7D, 0x80, 0x03, 0x03, 0x77,
+  0xD3, 0x33, 0x37, 0x80, 0x77, 0x00, 0x33, 0x80, 0x98, 0x02, 0x33, 0x33, 0xC2, 0x80, 0x03, 0x00,
+  0x34, 0x80, 0x03, 0x01, 0x33, 0x32, 0x83, 0xB3, 0x82, 0x00, 0x82, 0xB2, 0x8B, 0x00, 0x02, 0x27,
+  0x83, 0x22, 0x80, 0x5C, 0x00, 0x22, 0x80, 0x9A, 0x81, 0x03, 0x0B, 0x83, 0x34, 0x6B, 0x4B, 0x73,
+  0x34, 0x64, 0x3D, 0x73, 0x33, 0x43, 0x34, 0x80, 0x56, 0x08, 0x33, 0x83, 0x33, 0xD3, 0x3D, 0x33,
+  0x34, 0xB3, 0x39, 0x80, 0x03, 0x10, 0xE9, 0x33, 0x3E, 0x9B, 0xB9, 0x69, 0x9B, 0x33, 0x34, 0x9B,
+  0xFB, 0x33, 0x3B, 0xD4, 0x34, 0x33, 0x3B, 0x80, 0x1E, 0x00, 0x4B, 0x80, 0x7E, 0x11, 0xDB, 0xB3,
+  0x4F, 0x33, 0xDB, 0x9B, 0xBF, 0x33, 0xDB, 0x99, 0x9F, 0x33, 0x4B, 0x66, 0x22, 0x22, 0x83, 0x2C,
+  0x80, 0xE0, 0x00, 0x23, 0x80, 0x1C, 0x81, 0x03, 0x80, 0x5A, 0x00, 0x33, 0x80, 0xB7, 0x06, 0x33,
+  0x62, 0xB3, 0x33, 0x33, 0x26, 0x22, 0x80, 0x08, 0x01, 0x33, 0x82, 0x80, 0x65, 0x00, 0x42, 0x80,
+  0x1A, 0x81, 0x03, 0x01, 0x82, 0x24, 0x80, 0x03, 0x80, 0xA3, 0x0B, 0x22, 0x26, 0x33, 0x34, 0x26,
+  0x26, 0x33, 0x32, 0x26, 0x66, 0x33, 0x39, 0x81, 0xBB, 0x01, 0x38, 0xC2, 0x80, 0x28, 0x00, 0x39,
+  0x85, 0xB4, 0x80, 0xFF, 0x82, 0x47, 0x0D, 0x22, 0xC9, 0x33, 0x34, 0x66, 0x66, 0xB3, 0x33, 0x22,
+  0x66, 0x29, 0x33, 0x82, 0x26, 0x80, 0x11, 0x00, 0x92, 0x80, 0x50, 0x0E, 0x38, 0x22, 0x83, 0x33,
+  0x82, 0x62, 0x83, 0x38, 0x22, 0x62, 0x83, 0x82, 0x26, 0x62, 0x83, 0x81, 0xE0, 0x00, 0x32, 0x80,
+  0x03, 0x00, 0x3F, 0x80, 0x03, 0x00, 0x33, 0x81, 0x03, 0x00, 0x37, 0x81, 0x4F, 0x00, 0x72, 0x80,
+  0x03, 0x00, 0x34, 0x80, 0x03, 0x05, 0x33, 0x82, 0x77, 0x44, 0x44, 0x74, 0x88, 0xFB, 0x02, 0x72,
+  0x22, 0x27, 0x80, 0x80, 0x05, 0x23, 0x33, 0x7C, 0x22, 0x2C, 0x72, 0x82, 0x11, 0x02, 0x52, 0x22,
+  0xC3, 0x80, 0x36, 0x81, 0x03, 0x00, 0x23, 0x80, 0x03, 0x02, 0x27, 0x33, 0x77, 0x80, 0xCF, 0x80,
+  0x21, 0x02, 0x27, 0x73, 0x34, 0x80, 0x1C, 0x80, 0x03, 0x85, 0x93, 0x8D, 0x00, 0x04, 0x7D, 0x44,
+  0x44, 0xD7, 0x77, 0x80, 0x00, 0x0B, 0x34, 0x83, 0x3E, 0x6B, 0x33, 0x73, 0x3E, 0x64, 0x33, 0x73,
+  0x33, 0x43, 0x80, 0x03, 0x09, 0x33, 0x37, 0x83, 0x33, 0xD3, 0x77, 0x33, 0x34, 0xB3, 0x23, 0x80,
+  0x03, 0x0E, 0x43, 0x33, 0x3E, 0x9B, 0x4B, 0x99, 0x9B, 0x33, 0x3D, 0x9B, 0xFB, 0x33, 0x34, 0xD4,
+  0x34, 0x82, 0x37, 0x01, 0x3F, 0x43, 0x80, 0xE8, 0x1C, 0xB3, 0x4F, 0x33, 0xE9, 0x9B, 0xBB, 0x33,
+  0xB9, 0x66, 0x6B, 0x33, 0x36, 0x55, 0x55, 0x51, 0x35, 0x57, 0x68, 0x71, 0x35, 0x53, 0x33, 0x21,
+  0x65, 0x53, 0x33, 0x91, 0x75, 0x57, 0x80, 0x03, 0x0A, 0x55, 0x83, 0x11, 0x75, 0x55, 0xB2, 0x11,
+  0x65, 0x55, 0x51, 0x11, 0x80, 0x85, 0x00, 0xE7, 0x80, 0x97, 0x80, 0x96, 0x03, 0x77, 0x77, 0x22,
+  0xF7, 0x80, 0x03, 0x80, 0x73, 0x00, 0x27, 0x81, 0x78, 0x84, 0x00, 0x03, 0x55, 0x55, 0x54, 0x44,
+  0x83, 0x03, 0x01, 0x44, 0x44, 0x80, 0x06, 0x00, 0x44, 0x80, 0x06, 0x00, 0x44, 0x80, 0x06, 0x89,
+  0x00, 0x03, 0x33, 0x44, 0x44, 0x43, 0x84, 0x03, 0x00, 0x33, 0x83, 0x03, 0x80, 0x83, 0x80, 0x06,
+  0x80, 0xB0, 0x80, 0x00, 0x00, 0x34, 0x81, 0x11, 0x82, 0x0E, 0x92, 0x00, 0x85, 0x44, 0x00, 0xF4,
+  0x81, 0x48, 0x82, 0x2B, 0x81, 0x03, 0x00, 0x34, 0x81, 0x2F, 0x00, 0xF4, 0x82, 0x3D, 0x00, 0x45,
+  0x82, 0x79, 0x84, 0x03, 0x00, 0x45, 0x81, 0x7E, 0x00, 0x45, 0x89, 0x7C, 0x00, 0x55, 0x80, 0xDF,
+  0x80, 0x03, 0x8E, 0x00, 0x80, 0x36, 0x00, 0x55, 0x81, 0x1C, 0x00, 0x11, 0x84, 0x00, 0x00, 0x21,
+  0x80, 0x03, 0x01, 0x22, 0x91, 0x80, 0x03, 0x00, 0x22, 0x81, 0x03, 0x00, 0x21, 0x81, 0xF7, 0x00,
+  0x91, 0x80, 0x03, 0x81, 0x16, 0x00, 0x63, 0x80, 0x03, 0x00, 0x93, 0x80, 0x03, 0x00, 0x16, 0x85,
+  0x2B, 0x89, 0x00, 0x0B, 0x3E, 0x9B, 0x4B, 0x69, 0x3E, 0x9E, 0x3D, 0x6B, 0x33, 0x43, 0x34, 0xD4,
+  0x81, 0xCF, 0x1E, 0x14, 0xD3, 0x3F, 0x43, 0x11, 0x93, 0x39, 0xB3, 0x11, 0x14, 0xE6, 0x6B, 0x11,
+  0x11, 0xB6, 0x99, 0xEE, 0x33, 0x34, 0x99, 0x79, 0x33, 0x39, 0x9D, 0x34, 0x33, 0x39, 0x93, 0x33,
+  0x33, 0x46, 0x80, 0x03, 0x06, 0xD9, 0x9D, 0x47, 0x33, 0xD9, 0x99, 0x97, 0x80, 0x03, 0x08, 0xE7,
+  0x33, 0x49, 0x69, 0x22, 0x22, 0x83, 0x33, 0x49, 0x8C, 0xF3, 0x80, 0x24, 0x01, 0x33, 0xB3, 0x80,
+  0x03, 0x00, 0x22, 0x81, 0x08, 0x00, 0x82, 0x80, 0x09, 0x01, 0x42, 0x23, 0x83, 0x03, 0x1E, 0x82,
+  0x24, 0x33, 0x33, 0x86, 0x22, 0x33, 0x33, 0x26, 0x62, 0x83, 0x34, 0x22, 0x66, 0x28, 0x32, 0x22,
+  0x66, 0x62, 0x39, 0x22, 0x26, 0x66, 0x33, 0x38, 0xC2, 0x66, 0x33, 0x33, 0x39, 0x82, 0x8C, 0x46,
+  0x01, 0x38, 0xC9, 0x80, 0x13, 0x0C, 0x62, 0xC3, 0x33, 0x47, 0x66, 0x29, 0x33, 0x37, 0x22, 0x28,
+  0x33, 0x3D, 0x92, 0x80, 0x50, 0x08, 0x38, 0x26, 0x83, 0x33, 0x82, 0x66, 0x83, 0x33, 0x22, 0x80,
+  0x03, 0x00, 0x26, 0x81, 0x07, 0x02, 0x22, 0x22, 0x77, 0x80, 0x03, 0x86, 0x00, 0x00, 0x37, 0x80,
+  0x03, 0x01, 0x33, 0x72, 0x80, 0x03, 0x00, 0x34, 0x80, 0x03, 0x06, 0x33, 0x82, 0x22, 0x44, 0x44,
+  0x74, 0xF2, 0x86, 0x1C, 0x0E, 0x27, 0x72, 0x22, 0x27, 0x33, 0x32, 0x77, 0x28, 0x33, 0x72, 0x33,
+  0x2C, 0x72, 0x22, 0x73, 0x82, 0x13, 0x00, 0xC3, 0x80, 0xA7, 0x81, 0x03, 0x80, 0x9E, 0x80, 0x1C,
+  0x80, 0x4F, 0x02, 0x83, 0x33, 0x32, 0x80, 0x08, 0x80, 0x3E, 0x00, 0x27, 0x80, 0x03, 0x80, 0x43,
+  0x00, 0x34, 0x8A, 0xDE, 0x0A, 0x53, 0x34, 0x48, 0x33, 0xC3, 0x31, 0x11, 0x33, 0x53, 0x4B, 0xBC,
+  0x80, 0xA1, 0x09, 0x88, 0x34, 0xEE, 0xE7, 0x33, 0x49, 0x34, 0x44, 0x33, 0x39, 0x80, 0x1A, 0x00,
+  0x3D, 0x85, 0x23, 0x06, 0x11, 0x11, 0xC5, 0x83, 0x11, 0x11, 0x1C, 0x80, 0x07, 0x07, 0x18, 0x33,
+  0x26, 0x26, 0x28, 0x99, 0x26, 0x26, 0x80, 0x48, 0x80, 0x03, 0x1E, 0xC2, 0x26, 0x62, 0x22, 0x32,
+  0x26, 0x69, 0x34, 0x32, 0x26, 0x29, 0x33, 0x42, 0x22, 0x62, 0x83, 0x26, 0x62, 0x62, 0x28, 0x93,
+  0x42, 0x26, 0x66, 0x22, 0x26, 0x66, 0x66, 0x66, 0x62, 0x66, 0x80, 0x08, 0x00, 0x2B, 0x80, 0x28,
+  0x0D, 0x93, 0x82, 0x42, 0x23, 0x33, 0x26, 0x92, 0x23, 0xF8, 0x28, 0x26, 0x6B, 0x22, 0x29, 0x81,
+  0xA2, 0x80, 0x1D, 0x86, 0x00, 0x80, 0x48, 0x04, 0x62, 0x83, 0x94, 0x88, 0x89, 0x85, 0x6B, 0x10,
+  0x22, 0x66, 0x26, 0x93, 0x66, 0x66, 0x28, 0x33, 0x66, 0x26, 0x83, 0x33, 0x66, 0x24, 0x33, 0x33,
+  0xB9, 0x89, 0xAC, 0x02, 0x33, 0x34, 0x83, 0x80, 0x04, 0x00, 0x37, 0x80, 0x03, 0x00, 0xF2, 0x80,
+  0x0B, 0x07, 0x2C, 0x33, 0x33, 0x32, 0x28, 0x33, 0x33, 0x52, 0x81, 0xE5, 0x80, 0x03, 0x04, 0x33,
+  0x34, 0x33, 0x33, 0x83, 0x80, 0xEF, 0x81, 0x00, 0x0C, 0x2C, 0x22, 0x72, 0x22, 0x83, 0x72, 0x37,
+  0x22, 0x43, 0x42, 0x34, 0x22, 0x73, 0x86, 0x03, 0x81, 0x23, 0x83, 0x1F, 0x04, 0x27, 0x84, 0x22,
+  0x22, 0x28, 0x80, 0x2B, 0x02, 0x28, 0x33, 0xC7, 0x81, 0x3A, 0x03, 0x22, 0x2C, 0x33, 0x83, 0x80,
+  0x03, 0x02, 0x33, 0x72, 0x2C, 0x81, 0x3F, 0x02, 0xC8, 0x7C, 0x88, 0x81, 0x66, 0x86, 0x00, 0x00,
+  0x3A, 0x88, 0x03, 0x82, 0x84, 0x89, 0x1C, 0x12, 0x11, 0x53, 0x38, 0x48, 0x11, 0xC3, 0x31, 0xB1,
+  0x11, 0x53, 0x81, 0x1C, 0x33, 0x33, 0x38, 0x88, 0x4B, 0x99, 0x9F, 0x80, 0x21, 0x00, 0x44, 0x8A,
+  0xB5, 0x03, 0x33, 0xAA, 0xAA, 0xC7, 0x80, 0x03, 0x09, 0x11, 0x34, 0xA1, 0x11, 0x11, 0xE5, 0x55,
+  0xF1, 0x11, 0x35, 0x80, 0x03, 0x05, 0x37, 0x55, 0x11, 0x11, 0x33, 0x75, 0x80, 0x03, 0x03, 0x35,
+  0xF1, 0x11, 0x63, 0x80, 0x03, 0x03, 0xC2, 0x25, 0xF1, 0x11, 0x84, 0x00, 0x00, 0x12, 0x84, 0x03,
+  0x00, 0x92, 0x84, 0x03, 0x00, 0x22, 0x80, 0x06, 0x04, 0x22, 0x11, 0x19, 0x22, 0x22, 0x80, 0x06,
+  0x01, 0x22, 0x55, 0x97, 0x00, 0x00, 0x54, 0x83, 0x03, 0x05, 0x54, 0x44, 0x55, 0x55, 0x44, 0x44,
+  0x80, 0x06, 0x00, 0x44, 0x80, 0x06, 0x82, 0x03, 0x80, 0x0A, 0x91, 0x00, 0x00, 0x43, 0x84, 0x03,
+  0x00, 0x33, 0x83, 0x03, 0x00, 0x43, 0x80, 0x03, 0x02, 0x33, 0x33, 0x43, 0x8B, 0xB9, 0xA1, 0x00,
+  0x00, 0x39, 0x80, 0x03, 0x00, 0xE5, 0x84, 0x03, 0x00, 0x55, 0x8D, 0x1C, 0x07, 0x99, 0x99, 0x93,
+  0x33, 0x55, 0x55, 0x5E, 0x93, 0x80, 0x9B, 0x00, 0x5E, 0x81, 0xA4, 0x95, 0x44, 0x00, 0x93, 0x80,
+  0x03, 0x00, 0x5E, 0x81, 0x04, 0x97, 0x00, 0x00, 0x3E, 0x80, 0x03, 0x00, 0x95, 0x86, 0x72, 0x07,
+  0x3E, 0xEE, 0xE9, 0x33, 0xE5, 0x55, 0x5E, 0x3E, 0x80, 0x53, 0x00, 0xE5, 0x83, 0xFF, 0x82, 0x00,
+  0x91, 0x57, 0x00, 0xE3, 0x80, 0x03, 0x00, 0x53, 0x80, 0x03, 0x00, 0x59, 0x83, 0x12, 0x00, 0x34,
+  0x80, 0x03, 0x00, 0x3F, 0x95, 0x64, 0x00, 0x44, 0x8C, 0x00, 0x00, 0x34, 0x84, 0x03, 0x81, 0x18,
+  0x82, 0x1C, 0x04, 0x45, 0x55, 0x55, 0x44, 0x44, 0x85, 0x03, 0x00, 0x44, 0x81, 0x03, 0x00, 0x45,
+  0x89, 0x2F, 0x03, 0x22, 0x22, 0x22, 0x29, 0x80, 0x03, 0x8E, 0x00, 0x00, 0x66, 0x84, 0x03, 0x00,
+  0x11, 0x84, 0x00, 0x00, 0x91, 0x84, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x29, 0x80, 0x03, 0x81,
+  0x18, 0x00, 0x22, 0x81, 0x0C, 0x06, 0x11, 0x9B, 0xB9, 0x11, 0x11, 0x14, 0x34, 0x80, 0x08, 0x00,
+  0x33, 0x80, 0x03, 0x00, 0x13, 0x85, 0x2F, 0x85, 0x00, 0x0B, 0xE7, 0x33, 0x49, 0x66, 0x44, 0x33,
+  0x39, 0x66, 0x33, 0x33, 0x3D, 0x69, 0x80, 0xAE, 0x16, 0xD9, 0x73, 0x33, 0x33, 0x39, 0x22, 0xA5,
+  0x83, 0x39, 0x22, 0x21, 0x33, 0x49, 0x22, 0x2E, 0x33, 0x99, 0x62, 0x28, 0x99, 0x93, 0x66, 0x62,
+  0x80, 0x6B, 0x01, 0x66, 0x66, 0x81, 0x6F, 0x12, 0x66, 0x66, 0x69, 0x34, 0x26, 0x66, 0x69, 0x33,
+  0x42, 0x66, 0x62, 0x83, 0x96, 0x66, 0x66, 0x28, 0x26, 0x42, 0x22, 0x80, 0x1D, 0x80, 0x1C, 0x01,
+  0x26, 0x62, 0x80, 0x04, 0x12, 0x2B, 0x66, 0x66, 0x62, 0x93, 0x86, 0x22, 0x23, 0x33, 0x26, 0x83,
+  0x23, 0xF8, 0x28, 0x33, 0x2C, 0x22, 0x29, 0x33, 0x82, 0xAB, 0x88, 0x00, 0x80, 0x0E, 0x03, 0xB9,
+  0x94, 0x88, 0x89, 0x80, 0x6A, 0x83, 0x00, 0x0C, 0x26, 0x22, 0x93, 0x33, 0x66, 0x28, 0x33, 0x33,
+  0x22, 0x83, 0x33, 0x33, 0x24, 0x86, 0x15, 0x84, 0x00, 0x00, 0xF4, 0x80, 0x14, 0x14, 0x33, 0x3F,
+  0x22, 0x33, 0x33, 0xF2, 0x22, 0x33, 0x34, 0x2C, 0x72, 0x33, 0x32, 0x28, 0x37, 0x33, 0x52, 0x27,
+  0x34, 0x33, 0x22, 0x80, 0x03, 0x03, 0x33, 0x34, 0x34, 0x33, 0x80, 0x1E, 0x81, 0x5F, 0x01, 0x22,
+  0x2C, 0x80, 0x03, 0x0A, 0x83, 0x72, 0x22, 0x22, 0x43, 0x42, 0x22, 0x22, 0x73, 0x42, 0xC7, 0x80,
+  0x03, 0x00, 0x33, 0x80, 0x03, 0x80, 0x1D, 0x80, 0x2A, 0x81, 0x00, 0x03, 0x27, 0x84, 0x72, 0x22,
+  0x81, 0x63, 0x81, 0x03, 0x00, 0x27, 0x80, 0x03, 0x00, 0x2C, 0x83, 0x03, 0x00, 0x72, 0x80, 0x03,
+  0x80, 0x00, 0x10, 0x38, 0x83, 0x51, 0x53, 0x33, 0x33, 0x11, 0x53, 0x35, 0x33, 0x11, 0x83, 0x51,
+  0x11, 0x11, 0xC5, 0x11, 0x89, 0x00, 0x07, 0x51, 0x1B, 0x53, 0x3D, 0x33, 0x3C, 0x33, 0x49, 0x80,
+  0x27, 0x0D, 0x99, 0x11, 0x53, 0x3D, 0x96, 0x11, 0x53, 0x39, 0x99, 0x11, 0x83, 0x4D, 0x43, 0x1B,
+  0x80, 0x5D, 0x03, 0x11, 0x33, 0x33, 0xDD, 0x80, 0xDD, 0x14, 0x26, 0x6B, 0x98, 0x66, 0x66, 0x28,
+  0x34, 0x66, 0x66, 0x69, 0x34, 0x66, 0x62, 0x29, 0x38, 0x22, 0x6B, 0x33, 0x33, 0x94, 0x88, 0x81,
+  0x58, 0x11, 0x83, 0x42, 0x84, 0xF3, 0x26, 0x26, 0x62, 0x83, 0x2B, 0x22, 0x62, 0x93, 0x83, 0x82,
+  0x2B, 0x33, 0xF3, 0x82, 0x81, 0x80, 0x04, 0x29, 0x33, 0x34, 0x22, 0xB3, 0x80, 0x03, 0x80, 0x40,
+  0x01, 0x98, 0x93, 0x85, 0xE9, 0x13, 0x36, 0x33, 0x38, 0x7D, 0x55, 0x33, 0x36, 0x54, 0x45, 0x33,
+  0x36, 0x55, 0x8A, 0x33, 0x36, 0x5B, 0x38, 0x33, 0x36, 0x5D, 0x80, 0x15, 0x01, 0x54, 0x83, 0x80,
+  0x16, 0x0E, 0x53, 0xD5, 0x55, 0x55, 0x53, 0x55, 0x54, 0x44, 0x53, 0x44, 0x44, 0x44, 0x53, 0x55,
+  0x45, 0x80, 0x0B, 0x12, 0x4B, 0x87, 0x53, 0xD5, 0x47, 0x38, 0x53, 0xB4, 0x5B, 0x33, 0x53, 0x33,
+  0x35, 0x22, 0x78, 0x33, 0x32, 0x22, 0x24, 0x80, 0x03, 0x02, 0x28, 0x33, 0x42, 0x82, 0x03, 0x00,
+  0x22, 0x8A, 0x03, 0x80, 0x00, 0x03, 0x37, 0x22, 0x73, 0x87, 0x80, 0x03, 0x07, 0x42, 0x32, 0x22,
+  0x73, 0x72, 0x22, 0x22, 0x23, 0x80, 0x15, 0x87, 0x00, 0x02, 0x33, 0x34, 0x7C, 0x82, 0x80, 0x13,
+  0x73, 0x44, 0x33, 0x34, 0x73, 0x72, 0x28, 0x37, 0x73, 0x72, 0x23, 0x3A, 0x27, 0x22, 0x73, 0x8A,
+  0x22, 0x22, 0x83, 0x7A, 0x80, 0x1D, 0x00, 0xAA, 0x82, 0x1C, 0x05, 0x31, 0x13, 0x81, 0x11, 0x11,
+  0xC3, 0x80, 0x03, 0x00, 0x53, 0x80, 0x03, 0x05, 0x83, 0x41, 0x11, 0x11, 0x58, 0x11, 0x85, 0x00,
+  0x81, 0x1E, 0x06, 0xBB, 0x83, 0x51, 0x53, 0x11, 0x33, 0x11, 0x80, 0x03, 0x01, 0x1B, 0x87, 0x80,
+  0x12, 0x00, 0xC2, 0x80, 0x03, 0x00, 0xB2, 0x80, 0x03, 0x00, 0xF2, 0x81, 0x03, 0x00, 0x34, 0x80,
+  0x63, 0x81, 0x70, 0x00, 0xF2, 0x89, 0x74, 0x88, 0x00, 0x86, 0x48, 0x83, 0x00, 0x03, 0x92, 0x11,
+  0x11, 0x19, 0x80, 0x13, 0x00, 0x92, 0x80, 0x03, 0x80, 0x1B, 0x03, 0x12, 0x22, 0x22, 0x19, 0x80,
+  0x23, 0x80, 0x06, 0x95, 0x00, 0x07, 0x26, 0x55, 0x55, 0x55, 0x44, 0x55, 0x55, 0x54, 0x80, 0x03,
+  0x00, 0x44, 0x83, 0x03, 0x02, 0x54, 0x44, 0x44, 0x80, 0x02, 0x9D, 0x00, 0x00, 0x43, 0x80, 0x03,
+  0x00, 0x33, 0x80, 0x06, 0x80, 0x03, 0x01, 0x33, 0x33, 0x80, 0x06, 0x83, 0x03, 0x80, 0xCB, 0x81,
+  0x03, 0x8C, 0x00, 0x00, 0x55, 0x84, 0x03, 0x00, 0xE5, 0x80, 0x03, 0x00, 0x95, 0x80, 0x03, 0x00,
+  0x35, 0x80, 0x03, 0x00, 0x39, 0x86, 0x1C, 0x94, 0x00, 0x00, 0xE5, 0x80, 0x03, 0x06, 0x39, 0xEE,
+  0xEE, 0xE9, 0x55, 0x5E, 0x93, 0x80, 0x23, 0x00, 0xE9, 0x81, 0x27, 0x84, 0x03, 0x80, 0x0B, 0x06,
+  0x59, 0x33, 0x33, 0xEE, 0x93, 0x33, 0x33, 0x80, 0x02, 0x81, 0x00, 0x80, 0x57, 0x00, 0x3E, 0x80,
+  0x5F, 0x00, 0xE5, 0x88, 0x03, 0x00, 0x95, 0x80, 0x03, 0x81, 0x13, 0x00, 0x39, 0x81, 0x46, 0x99,
+  0x00, 0x00, 0x5E, 0x80, 0x4A, 0x00, 0x33, 0x89, 0x03, 0x00, 0x53, 0x80, 0x03, 0x00, 0xE3, 0x80,
+  0x03, 0x84, 0x5B, 0x02, 0x33, 0x33, 0x34, 0x80, 0xE1, 0x81, 0x03, 0x82, 0xE9, 0x00, 0x34, 0x85,
+  0xE2, 0x00, 0x34, 0x85, 0x1E, 0x00, 0x44, 0x94, 0x00, 0x80, 0x32, 0x82, 0x37, 0x05, 0x44, 0x45,
+  0x55, 0x55, 0x44, 0x44, 0x85, 0x03, 0x00, 0x45, 0x80, 0x03, 0x00, 0x44, 0x81, 0x03, 0x86, 0x00,
+  0x06, 0x22, 0x22, 0x11, 0x11, 0x22, 0x22, 0x29, 0x80, 0x03, 0x01, 0x22, 0x91, 0x80, 0x03, 0x00,
+  0x29, 0x80, 0x03, 0x82, 0x00, 0x01, 0x66, 0x62, 0x80, 0x03, 0x80, 0x04, 0x00, 0x11, 0x8C, 0x00,
+  0x00, 0x91, 0x80, 0x03, 0x00, 0x29, 0x80, 0x03, 0x00, 0x22, 0x80, 0x08, 0x81, 0x3B, 0x03, 0x11,
+  0x11, 0x25, 0xFF, 0x8D, 0x23, 0x89, 0x00, 0x00, 0xF5, 0x80, 0xE4, 0x80, 0x06, 0x00, 0x1F, 0x95,
+  0x1F, 0x0E, 0x96, 0x96, 0xD3, 0x33, 0x69, 0x99, 0x43, 0x33, 0x22, 0x29, 0x33, 0x33, 0x22, 0x22,
+  0xE3, 0x80, 0x03, 0x01, 0x22, 0x43, 0x80, 0x03, 0x00, 0x24, 0x85, 0x87, 0x80, 0xE2, 0x09, 0x38,
+  0x33, 0x33, 0x36, 0xD5, 0x38, 0x7D, 0x55, 0x55, 0x36, 0x80, 0xC2, 0x1C, 0x36, 0x55, 0x87, 0x54,
+  0x36, 0x5B, 0x38, 0x54, 0x6A, 0x5D, 0x33, 0xD5, 0x11, 0x11, 0x19, 0x95, 0x7D, 0x55, 0x53, 0x33,
+  0x55, 0x44, 0x53, 0x33, 0x45, 0x45, 0x53, 0x33, 0x44, 0x80, 0x03, 0x00, 0x45, 0x80, 0x0F, 0x1C,
+  0x5B, 0x87, 0x53, 0x33, 0x57, 0x36, 0xD3, 0x33, 0x5B, 0x33, 0xD3, 0x33, 0x35, 0x22, 0x78, 0x33,
+  0x32, 0x22, 0x24, 0x37, 0x32, 0x22, 0x28, 0x37, 0x42, 0x22, 0x28, 0x32, 0x42, 0x80, 0x53, 0x89,
+  0x03, 0x80, 0x5F, 0x03, 0x33, 0x22, 0x73, 0x47, 0x80, 0x03, 0x07, 0x42, 0x73, 0x22, 0x73, 0x72,
+  0x73, 0x22, 0xC3, 0x80, 0x07, 0x02, 0x22, 0x22, 0x27, 0x85, 0x7F, 0x01, 0x34, 0x7C, 0x81, 0x21,
+  0x19, 0x33, 0x33, 0x44, 0x33, 0x34, 0xAA, 0x72, 0x28, 0x37, 0xAA, 0x72, 0x23, 0x3A, 0xAA, 0x22,
+  0x73, 0x8A, 0xAA, 0x22, 0x83, 0x7A, 0xAA, 0x22, 0x33, 0xAA, 0xAA, 0x81, 0xC3, 0x00, 0x51, 0x80,
+  0x03, 0x00, 0x35, 0x80, 0x03, 0x05, 0x33, 0x31, 0x11, 0x11, 0x53, 0x41, 0x8B, 0xDF, 0x03, 0x15,
+  0x33, 0x49, 0x99, 0x80, 0x03, 0x00, 0x69, 0x80, 0x03, 0x09, 0x66, 0x15, 0x33, 0xD9, 0x66, 0x18,
+  0x33, 0xD6, 0x66, 0x53, 0x80, 0x07, 0x11, 0x33, 0x33, 0xD9, 0x99, 0x33, 0x33, 0x99, 0x99, 0x83,
+  0x46, 0x22, 0x23, 0x93, 0x86, 0x22, 0x83, 0x93, 0x22, 0x80, 0x03, 0x00, 0x26, 0x80, 0x03, 0x0D,
+  0x86, 0x66, 0xB3, 0x43, 0x32, 0x66, 0x68, 0x2F, 0x38, 0x66, 0x62, 0x28, 0x42, 0x66, 0x80, 0x27,
+  0x0E, 0x33, 0x33, 0xF2, 0x43, 0x33, 0x33, 0x42, 0x29, 0x33, 0x33, 0x92, 0x62, 0x33, 0x33, 0x34,
+  0x81, 0xB1, 0x80, 0x03, 0x04, 0x43, 0x82, 0x33, 0x33, 0x28, 0x81, 0x0B, 0x02, 0x3A, 0xBB, 0x83,
+  0x82, 0xA0, 0x0A, 0x3E, 0x88, 0x33, 0x33, 0x37, 0x55, 0x73, 0x33, 0x37, 0x44, 0xB3, 0x80, 0x03,
+  0x00, 0xA3, 0x84, 0x03, 0x04, 0x5D, 0x7B, 0xBB, 0x33, 0x63, 0x81, 0x1E, 0x00, 0x38, 0x80, 0x1E,
+  0x17, 0x65, 0x55, 0x83, 0x63, 0x85, 0x55, 0x83, 0xA3, 0x85, 0x45, 0x83, 0x73, 0x65, 0x44, 0xD7,
+  0x53, 0x55, 0x55, 0x45, 0x53, 0x33, 0x34, 0x88, 0x84, 0x83, 0xE1, 0x93, 0x00, 0x06, 0x72, 0x22,
+  0x22, 0x22, 0x33, 0x38, 0x47, 0x81, 0x69, 0x8D, 0x00, 0x00, 0x34, 0x81, 0x7D, 0x0D, 0xAA, 0xAA,
+  0x33, 0x11, 0xAA, 0xA5, 0x38, 0x11, 0x84, 0x48, 0x35, 0x11, 0x33, 0x33, 0x80, 0x03, 0x03, 0x45,
+  0x51, 0x11, 0x41, 0x88, 0xFF, 0x02, 0x11, 0x11, 0xB1, 0x80, 0x03, 0x04, 0xC3, 0x31, 0x11, 0x11,
+  0x83, 0x81, 0x03, 0x00, 0x71, 0x80, 0x03, 0x80, 0x0F, 0x00, 0xC4, 0x88, 0x1F, 0x0F, 0x1F, 0x22,
+  0x15, 0x51, 0xB2, 0x22, 0x13, 0x35, 0xF2, 0x22, 0x15, 0x33, 0x22, 0x22, 0x11, 0x55, 0x80, 0x03,
+  0x00, 0x1F, 0x88, 0x03, 0x8B, 0x00, 0x00, 0x19, 0x80, 0x03, 0x00, 0x92, 0x80, 0x06, 0x80, 0x17,
+  0x00, 0x92, 0x80, 0x03, 0x80, 0x9C, 0x03, 0x77, 0x77, 0x77, 0x2E, 0x80, 0x03, 0x00, 0xF7, 0x80,
+  0x03, 0x91, 0x00, 0x03, 0x55, 0x55, 0x55, 0x44, 0x83, 0x03, 0x00, 0x54, 0x88, 0x03, 0x00, 0x44,
+  0x83, 0x03, 0x01, 0x54, 0x44, 0x9D, 0x00, 0x08, 0x43, 0x44, 0x44, 0x33, 0x33, 0x44, 0x43, 0x33,
+  0x33, 0x80, 0x02, 0x82, 0x03, 0x90, 0x00, 0x00, 0x3E, 0x93, 0x16, 0x83, 0x00, 0x06, 0xE5, 0x55,
+  0x55, 0x93, 0x39, 0x99, 0x93, 0x98, 0x21, 0x81, 0x61, 0x00, 0x33, 0x81, 0x03, 0x94, 0x1D, 0x87,
+  0x00, 0x00, 0x38, 0x80, 0x03, 0x8D, 0x2F, 0x80, 0x12, 0x00, 0x45, 0x91, 0xB8, 0x00, 0x34, 0x81,
+  0x2B, 0x80, 0x03, 0x04, 0x22, 0x22, 0x29, 0x11, 0x62, 0x80, 0x04, 0x00, 0x66, 0x80, 0x04, 0x01,
+  0x66, 0x66, 0x81, 0x03, 0x00, 0x62, 0x80, 0x03, 0x00, 0x66, 0x81, 0x03, 0x00, 0x62, 0x80, 0x03,
+  0x01, 0x66, 0x11, 0x84, 0x00, 0x00, 0x91, 0x80, 0x03, 0x80, 0x2A, 0x04, 0x11, 0x22, 0x22, 0x22,
+  0x21, 0x80, 0x03, 0x9A, 0x00, 0x00, 0xF2, 0x80, 0x03, 0x00, 0x72, 0x80, 0x03, 0x0A, 0x77, 0xE2,
+  0x22, 0x22, 0x11, 0x23, 0x63, 0x33, 0x11, 0x11, 0xD6, 0x80, 0x03, 0x01, 0x11, 0x12, 0x85, 0x4B,
+  0x89, 0x00, 0x03, 0x38, 0x88, 0x84, 0x72, 0x85, 0xAB, 0x00, 0x15, 0x80, 0x03, 0x01, 0x11, 0x93,
+  0x80, 0x03, 0x00, 0x19, 0x80, 0x03, 0x01, 0x11, 0x53, 0x80, 0x03, 0x01, 0x13, 0x33, 0x81, 0x4F,
+  0x03, 0x38, 0x47, 0x22, 0x22, 0x80, 0x1A, 0x00, 0x84, 0x88, 0xF6, 0x09, 0x4A, 0x33, 0x33, 0x34,
+  0xAA, 0x33, 0x33, 0x3A, 0xAA, 0xAA, 0x80, 0x25, 0x00, 0xA5, 0x80, 0x03, 0x04, 0x48, 0x35, 0x11,
+  0x11, 0x33, 0x80, 0x03, 0x01, 0x45, 0x51, 0x91, 0x65, 0x09, 0x11, 0x11, 0xC5, 0x51, 0xBB, 0xBB,
+  0x33, 0x33, 0x88, 0x88, 0x85, 0x40, 0x00, 0x83, 0x80, 0x03, 0x07, 0x18, 0x34, 0x44, 0x55, 0x33,
+  0x33, 0x44, 0x44, 0x88, 0x57, 0x80, 0x42, 0x01, 0x15, 0x43, 0x81, 0xAC, 0x00, 0x33, 0x80, 0x47,
+  0x00, 0x55, 0x80, 0x07, 0x03, 0x44, 0x44, 0xDD, 0xDD, 0x89, 0x1F, 0x81, 0x00, 0x00, 0x53, 0x80,
+  0x03, 0x00, 0xB5, 0x81, 0xAB, 0x80, 0x08, 0x00, 0x75, 0x80, 0x41, 0x01, 0x33, 0x86, 0x8D, 0x21,
+  0x81, 0x00, 0x00, 0x3A, 0x80, 0x19, 0x04, 0xA5, 0x55, 0x33, 0x37, 0x55, 0x80, 0x03, 0x27, 0x5B,
+  0x87, 0x33, 0x37, 0x58, 0x36, 0x33, 0x37, 0xA3, 0x3B, 0x33, 0x36, 0xA3, 0x75, 0x33, 0x36, 0x55,
+  0x55, 0x7A, 0xAD, 0x54, 0x54, 0x55, 0x55, 0x54, 0x44, 0x5B, 0xA5, 0x55, 0x53, 0x5A, 0x36, 0x55,
+  0x53, 0x5B, 0x33, 0x75, 0x58, 0x55, 0xA3, 0x80, 0x2C, 0x0B, 0x58, 0x36, 0x55, 0x44, 0x55, 0xB5,
+  0x45, 0x44, 0x45, 0x54, 0x45, 0x44, 0x80, 0x00, 0x85, 0x4D, 0x00, 0x66, 0x80, 0x03, 0x05, 0x55,
+  0xE3, 0x33, 0x33, 0x54, 0xB3, 0x80, 0xB1, 0x00, 0x58, 0x80, 0x03, 0x00, 0x5B, 0x80, 0x03, 0x00,
+  0x55, 0x81, 0xC5, 0x01, 0x33, 0x51, 0x81, 0x8A, 0x02, 0x33, 0x33, 0x34, 0x80, 0x03, 0x00, 0x35,
+  0x80, 0x03, 0x00, 0x31, 0x84, 0x07, 0x81, 0x03, 0x00, 0x34, 0x85, 0xFE, 0x0F, 0xB1, 0x11, 0x15,
+  0x33, 0x4F, 0x11, 0x83, 0x33, 0xF2, 0x11, 0x53, 0x3E, 0x22, 0x11, 0x11, 0x52, 0x80, 0x03, 0x03,
+  0x22, 0x22, 0x11, 0x1B, 0x80, 0x03, 0x04, 0xBF, 0xFF, 0xFF, 0xB2, 0x22, 0x97, 0x00, 0x01, 0xB1,
+  0x1F, 0x98, 0x1C, 0x80, 0x00, 0x85, 0x60, 0x87, 0x00, 0x00, 0x19, 0x80, 0x13, 0x03, 0x92, 0x22,
+  0x11, 0x12, 0x80, 0x1B, 0x81, 0x1F, 0x06, 0x15, 0x55, 0x55, 0x11, 0x55, 0x55, 0x55, 0x80, 0x06,
+  0x93, 0x00, 0x02, 0x54, 0x44, 0x44, 0x82, 0x03, 0x80, 0xEB, 0x81, 0x03, 0x80, 0x0A, 0x82, 0x03,
+  0x85, 0x00, 0x85, 0xFF, 0x80, 0x0A, 0x00, 0x43, 0x88, 0x16, 0x8E, 0x1F, 0x82, 0x23, 0x83, 0x27,
+  0x96, 0x1F, 0x91, 0x23, 0x8D, 0x1F, 0x80, 0x1D, 0x00, 0xF3, 0x9B, 0x1F, 0x81, 0x3F, 0x00, 0x94,
+  0x96, 0x1F, 0x00, 0x34, 0x9D, 0x7F, 0x80, 0x12, 0x9C, 0x5F, 0x8A, 0x42, 0x90, 0x3F, 0x98, 0x5F,
+  0x01, 0x38, 0x88, 0x9B, 0x1F, 0x00, 0x84, 0x8D, 0x1E, 0x8A, 0x1F, 0x80, 0x0E, 0x00, 0x43, 0x8E,
+  0x1F, 0x80, 0x32, 0x82, 0x03, 0x8D, 0xB8, 0x84, 0x00, 0x04, 0x45, 0x55, 0x55, 0x55, 0x44, 0x85,
+  0x03, 0x80, 0x0C, 0x00, 0x44, 0x80, 0x08, 0x89, 0x03, 0x04, 0x22, 0x22, 0x91, 0x11, 0x22, 0x80,
+  0x04, 0x80, 0x03, 0x92, 0x00, 0x00, 0x11, 0x88, 0x00, 0x00, 0x21, 0x80, 0x03, 0x81, 0x10, 0x00,
+  0x22, 0x80, 0x08, 0x01, 0x22, 0x29, 0x80, 0x03, 0x80, 0x3B, 0x06, 0x11, 0x11, 0x12, 0x33, 0x11,
+  0x11, 0x19, 0x80, 0x03, 0x01, 0x11, 0x96, 0x89, 0x2B, 0x85, 0x00, 0x02, 0x33, 0x33, 0x51, 0x80,
+  0x03, 0x80, 0x07, 0x04, 0x34, 0x11, 0x11, 0x73, 0x35, 0x80, 0x33, 0x01, 0x2F, 0xB1, 0x81, 0x6F,
+  0x00, 0xB1, 0x80, 0x03, 0x00, 0x2B, 0x87, 0x5F, 0x06, 0xB1, 0x11, 0x15, 0x33, 0x84, 0x55, 0x83,
+  0x80, 0xE3, 0x00, 0x53, 0x80, 0x03, 0x80, 0x30, 0x80, 0x31, 0x02, 0x1C, 0x55, 0xB1, 0x81, 0x1A,
+  0x00, 0x18, 0x80, 0x0B, 0x00, 0x15, 0x80, 0x03, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x1B, 0x88, 0x03,
+  0x81, 0x0F, 0x80, 0x1B, 0x05, 0x33, 0x3A, 0x54, 0x44, 0x33, 0x35, 0x80, 0x03, 0x03, 0xD5, 0x44,
+  0x44, 0x36, 0x80, 0xD1, 0x80, 0x03, 0x00, 0x45, 0x80, 0x12, 0x09, 0x56, 0x37, 0x54, 0x44, 0x58,
+  0x3D, 0x54, 0x44, 0x53, 0x54, 0x80, 0x13, 0x81, 0x00, 0x06, 0x54, 0x44, 0x45, 0x45, 0x5B, 0xAA,
+  0xB5, 0x80, 0x63, 0x00, 0x35, 0x80, 0x5E, 0x03, 0x91, 0x11, 0x33, 0x31, 0x80, 0x93, 0x80, 0xBE,
+  0x02, 0x44, 0x44, 0x55, 0x80, 0x21, 0x08, 0xB6, 0x88, 0x44, 0x5B, 0x33, 0x33, 0x9F, 0x97, 0x63,
+  0x81, 0xC7, 0x00, 0x92, 0x89, 0xBF, 0x09, 0x45, 0x55, 0xA3, 0x33, 0x8A, 0x55, 0x73, 0x33, 0x33,
+  0x75, 0x80, 0x99, 0x0A, 0xE5, 0x53, 0x33, 0x63, 0x35, 0x53, 0x33, 0x11, 0x99, 0x52, 0x21, 0x87,
+  0xDF, 0x82, 0xAE, 0x00, 0x51, 0x80, 0x03, 0x00, 0x41, 0x80, 0x03, 0x02, 0x31, 0x47, 0xE2, 0x81,
+  0xD5, 0x87, 0x00, 0x01, 0x11, 0x1F, 0x87, 0x03, 0x01, 0xBB, 0xBF, 0x8B, 0x1B, 0x87, 0xFF, 0x82,
+  0x00, 0x00, 0x12, 0x80, 0x03, 0x80, 0x0F, 0x05, 0x12, 0x22, 0x11, 0x19, 0x22, 0x22, 0x80, 0x02,
+  0x01, 0x22, 0x12, 0x80, 0x03, 0x01, 0x15, 0x55, 0x9E, 0x00, 0x00, 0x54, 0x94, 0x03, 0x82, 0x00,
+  0x83, 0xFD, 0x8E, 0x00, 0x01, 0x45, 0x54, 0x80, 0xF7, 0x95, 0x1F, 0x81, 0x16, 0x9C, 0x3F, 0x01,
+  0x44, 0x54, 0x81, 0x27, 0x81, 0x04, 0x9B, 0x00, 0x00, 0x45, 0x8F, 0x0F, 0x02, 0x45, 0x55, 0x45,
+  0x88, 0xBC, 0x8A, 0x75, 0x90, 0x00, 0x8A, 0x6F, 0x80, 0x0D, 0x89, 0x9B, 0x95, 0x9F, 0x83, 0x2B,
+  0x01, 0x55, 0x54, 0x99, 0xBF, 0x82, 0x71, 0x9E, 0xBE, 0x9C, 0x3F, 0x92, 0x5F, 0x01, 0x45, 0x55,
+  0x80, 0x02, 0x86, 0xA4, 0x85, 0xB5, 0x82, 0x03, 0x89, 0xF8, 0x84, 0x00, 0x03, 0x22, 0x22, 0x22,
+  0x29, 0x80, 0x03, 0x96, 0x00, 0x03, 0x11, 0x11, 0x99, 0x91, 0x9B, 0x1F, 0x02, 0x11, 0x11, 0x91,
+  0x80, 0x03, 0x00, 0x22, 0x80, 0x04, 0x81, 0x0D, 0x02, 0x22, 0x22, 0x21, 0x80, 0x03, 0x00, 0x29,
+  0x80, 0x03, 0x00, 0x22, 0x81, 0x37, 0x01, 0x29, 0x2B, 0x81, 0x1B, 0x81, 0x03, 0x00, 0xF1, 0x80,
+  0x03, 0x00, 0x21, 0x80, 0x03, 0x80, 0x10, 0x01, 0x22, 0x2F, 0x85, 0x2B, 0x02, 0x51, 0xB1, 0xAA,
+  0x80, 0x00, 0x00, 0x77, 0x80, 0x03, 0x04, 0x33, 0x33, 0x84, 0x47, 0x33, 0x87, 0x00, 0x00, 0x34,
+  0x80, 0x02, 0x04, 0xB9, 0x33, 0x33, 0x3B, 0x99, 0x81, 0x1F, 0x82, 0x23, 0x01, 0x77, 0x77, 0x86,
+  0x1C, 0x08, 0x4F, 0xF4, 0x44, 0x33, 0x96, 0x66, 0x66, 0x9B, 0x66, 0x80, 0x00, 0x03, 0x11, 0x83,
+  0x33, 0x33, 0x80, 0x02, 0x8E, 0x00, 0x00, 0x43, 0x80, 0x03, 0x00, 0xE4, 0x80, 0x03, 0x0C, 0x3D,
+  0x54, 0x44, 0x5E, 0x37, 0x54, 0x44, 0x5B, 0x36, 0x55, 0x44, 0x55, 0x33, 0x81, 0x03, 0x04, 0x75,
+  0x44, 0x45, 0x33, 0x85, 0x80, 0x03, 0x07, 0x36, 0x55, 0x45, 0x33, 0x33, 0x87, 0xD5, 0x32, 0x80,
+  0x9B, 0x00, 0x31, 0x84, 0xC3, 0x80, 0xA2, 0x8A, 0x00, 0x84, 0x0F, 0x03, 0x99, 0x11, 0x11, 0x12,
+  0x80, 0xAD, 0x85, 0x03, 0x81, 0x0F, 0x87, 0x00, 0x00, 0xE7, 0x80, 0x98, 0x89, 0x00, 0x02, 0xEE,
+  0xEE, 0xF2, 0x80, 0xF6, 0x97, 0x00, 0x00, 0x19, 0x80, 0x03, 0x80, 0x36, 0x00, 0x19, 0x85, 0x3F,
+  0x95, 0x27, 0x00, 0x12, 0x81, 0x27, 0x01, 0x99, 0x99, 0x9A, 0x4B, 0x02, 0x29, 0x99, 0x91, 0x96,
+  0x3F, 0x02, 0x91, 0x19, 0x99, 0x82, 0xA7, 0x93, 0x38, 0x87, 0xBF, 0x91, 0x1E, 0x02, 0x92, 0x22,
+  0x91, 0x97, 0x1F, 0x80, 0x73, 0x89, 0x00, 0x93, 0xDF, 0x00, 0x99, 0x86, 0xE3, 0x99, 0xBF, 0x01,
+  0x11, 0x92, 0x9A, 0xDE, 0x82, 0x6D, 0x00, 0x66, 0x80, 0x00, 0x96, 0x1C, 0x80, 0x3F, 0x99, 0x1F,
+  0x81, 0xE9, 0x9A, 0x3F, 0x03, 0x99, 0x99, 0x22, 0x44, 0x80, 0x00, 0x00, 0x55, 0x98, 0x00, 0x99,
+  0x5B, 0x04, 0x22, 0x29, 0x91, 0x11, 0x77, 0x8E, 0x00, 0x01, 0xE2, 0x22, 0x80, 0x02, 0x01, 0x22,
+  0xF2, 0x84, 0x24, 0x8D, 0x4F, 0x00, 0x11, 0x8C, 0x00, 0x8D, 0x3D, 0x03, 0x22, 0x2F, 0xEE, 0xA7,
+  0x98, 0x73, 0x82, 0x00, 0x80, 0xF6, 0x01, 0x22, 0x11, 0x81, 0x03, 0x00, 0x19, 0x96, 0x22, 0x00,
+  0x21, 0x81, 0x9B, 0x81, 0x00, 0x03, 0x22, 0x22, 0x33, 0x85, 0x80, 0x03, 0x00, 0x33, 0x83, 0x03,
+  0x07, 0xA4, 0x83, 0x22, 0x2F, 0xAA, 0xAA, 0x22, 0x2B, 0x80, 0x03, 0x00, 0x2A, 0x80, 0x03, 0x47,
+  0xBA, 0xAA, 0xAA, 0x33, 0x33, 0x5B, 0xF9, 0x33, 0x3D, 0xF3, 0x3F, 0x33, 0x3B, 0xD3, 0x3B, 0x33,
+  0x49, 0xD3, 0xE9, 0x33, 0xD9, 0x9B, 0x99, 0x33, 0x4B, 0x96, 0x66, 0x33, 0x3D, 0x9D, 0xF9, 0x83,
+  0x34, 0x93, 0x39, 0x96, 0x6B, 0x96, 0x66, 0x9B, 0x43, 0x49, 0x66, 0x94, 0x33, 0x39, 0x66, 0x93,
+  0x33, 0x3B, 0x9B, 0x64, 0x3E, 0xFB, 0xF3, 0x96, 0x99, 0x43, 0x33, 0x66, 0x66, 0xE3, 0x33, 0x94,
+  0xD9, 0x33, 0x33, 0x6D, 0x33, 0x33, 0x33, 0x64, 0x80, 0x03, 0x07, 0xC3, 0x33, 0x33, 0x39, 0x33,
+  0x33, 0x42, 0x22, 0x80, 0x02, 0x09, 0x22, 0x39, 0x26, 0x66, 0x66, 0x32, 0x22, 0x66, 0x66, 0x82,
+  0x80, 0x03, 0x80, 0x1A, 0x82, 0x00, 0x03, 0x44, 0x84, 0x44, 0x49, 0x81, 0x98, 0x01, 0x66, 0x62,
+  0x80, 0x14, 0x80, 0x00, 0x08, 0x62, 0x22, 0x22, 0x28, 0x28, 0x39, 0x22, 0xC3, 0xD2, 0x80, 0x13,
+  0x00, 0x32, 0x80, 0x03, 0x00, 0x47, 0x80, 0x03, 0x00, 0x99, 0x81, 0x1F, 0x80, 0xDC, 0x0B, 0x66,
+  0x69, 0x22, 0x22, 0xD9, 0x96, 0x96, 0x22, 0x34, 0x99, 0x99, 0x99, 0x82, 0xC4, 0x94, 0x00, 0x00,
+  0x5F, 0x99, 0x1C, 0x82, 0x00, 0x05, 0x1F, 0xF1, 0x22, 0x22, 0x2F, 0xEE, 0x81, 0x77, 0x95, 0x00,
+  0x9B, 0x61, 0x01, 0x11, 0x11, 0x80, 0x22, 0x00, 0xFE, 0x9B, 0x3F, 0x00, 0x91, 0x9D, 0x84, 0x00,
+  0x92, 0x9C, 0x5F, 0x03, 0x22, 0x19, 0xC2, 0x29, 0x96, 0x85, 0x03, 0x29, 0x99, 0x22, 0x29, 0x9C,
+  0x3F, 0x00, 0xEF, 0x99, 0x9F, 0x07, 0xFE, 0xE7, 0x77, 0x77, 0x22, 0x22, 0x2E, 0xEE, 0x95, 0x1F,
+  0x00, 0x77, 0x80, 0x00, 0x03, 0xEE, 0xEE, 0xEE, 0xFF, 0x8E, 0x18, 0x06, 0x2E, 0x94, 0x72, 0x24,
+  0x99, 0xD3, 0x34, 0x99, 0x7D, 0x02, 0x5F, 0xF1, 0xFF, 0x8F, 0x37, 0x86, 0x00, 0x05, 0xE5, 0xAA,
+  0x9D, 0x33, 0x33, 0x7A, 0x91, 0x19, 0x0B, 0x2F, 0xE7, 0x74, 0x44, 0xAA, 0x53, 0x33, 0x33, 0xAA,
+  0xA5, 0x33, 0x33, 0x89, 0x16, 0x80, 0x03, 0x09, 0xBA, 0x22, 0x2A, 0x45, 0xAA, 0x43, 0x33, 0x33,
+  0x8A, 0x33, 0x84, 0x00, 0x81, 0xE0, 0x00, 0x12, 0x8E, 0x41, 0x1A, 0x2C, 0x78, 0x22, 0x24, 0x83,
+  0x33, 0x22, 0xC3, 0x33, 0x33, 0x83, 0x34, 0x9B, 0xB9, 0x83, 0x34, 0x6B, 0xDB, 0x43, 0x34, 0x94,
+  0x3D, 0x73, 0x33, 0xD3, 0x34, 0x73, 0x80, 0x33, 0x07, 0x83, 0x33, 0x43, 0x34, 0x33, 0x34, 0xB3,
+  0x39, 0x81, 0x03, 0x06, 0xB3, 0x4B, 0x33, 0x33, 0x69, 0x9B, 0x33, 0x80, 0x25, 0x05, 0x33, 0x3B,
+  0xFD, 0x3D, 0x33, 0x3B, 0x80, 0x1E, 0x10, 0x4B, 0xE3, 0x33, 0x33, 0xDB, 0xB3, 0xEF, 0x33, 0xDB,
+  0x9B, 0xBB, 0x33, 0xDB, 0x22, 0x26, 0x26, 0x62, 0x80, 0x50, 0x05, 0x89, 0x22, 0x88, 0x99, 0x33,
+  0x23, 0x80, 0x1C, 0x81, 0x03, 0x00, 0x28, 0x80, 0x03, 0x05, 0x62, 0x93, 0x33, 0x33, 0x66, 0x83,
+  0x81, 0x4B, 0x00, 0x86, 0x80, 0x65, 0x00, 0x82, 0x80, 0x03, 0x00, 0x42, 0x80, 0x1A, 0x81, 0x03,
+  0x01, 0x82, 0x29, 0x80, 0x03, 0x00, 0x2B, 0x81, 0xB9, 0x05, 0x33, 0x34, 0x26, 0x62, 0x33, 0x82,
+  0x82, 0x07, 0x03, 0x22, 0x33, 0x33, 0x38, 0x80, 0x03, 0x01, 0x33, 0x34, 0x85, 0xB7, 0x80, 0xC3,
+  0x01, 0x33, 0x24, 0x80, 0x03, 0x0A, 0x69, 0x99, 0x7E, 0x22, 0x66, 0x66, 0xD3, 0x33, 0x99, 0x66,
+  0x94, 0x80, 0x03, 0x11, 0x9D, 0x33, 0x33, 0x49, 0x69, 0x43, 0x33, 0x3D, 0x96, 0xD3, 0x33, 0x49,
+  0x96, 0xD3, 0x34, 0x99, 0x96, 0xD3, 0x81, 0xCD, 0x07, 0x7F, 0xFF, 0xFF, 0xFF, 0x3A, 0xAA, 0xAA,
+  0xAA, 0x81, 0x03, 0x00, 0x33, 0x81, 0x03, 0x00, 0x8A, 0x80, 0x03, 0x01, 0x33, 0x5A, 0x80, 0x03,
+  0x09, 0x35, 0xAA, 0x11, 0x19, 0x53, 0x33, 0x54, 0x33, 0x34, 0x48, 0x87, 0xFB, 0x00, 0x27, 0x80,
+  0xFE, 0x10, 0x83, 0x32, 0x22, 0x28, 0x33, 0x72, 0x22, 0x27, 0x72, 0x22, 0x42, 0x22, 0x99, 0x11,
+  0x72, 0x22, 0xC3, 0x80, 0x8D, 0x81, 0x03, 0x00, 0x23, 0x80, 0x03, 0x05, 0x27, 0x33, 0xC7, 0x22,
+  0x22, 0x83, 0x80, 0x97, 0x05, 0x24, 0x73, 0x34, 0x22, 0x22, 0x11, 0x80, 0x00, 0x02, 0x44, 0x33,
+  0x33, 0x80, 0x02, 0x8F, 0x00, 0x03, 0xC4, 0x83, 0x38, 0x72, 0x81, 0x1F, 0x07, 0x55, 0x44, 0x44,
+  0x96, 0x33, 0x73, 0x33, 0x94, 0x80, 0x03, 0x00, 0xD3, 0x80, 0x03, 0x09, 0x33, 0x37, 0x83, 0x33,
+  0x43, 0x4C, 0x33, 0x34, 0xB3, 0x23, 0x80, 0x03, 0x81, 0x1F, 0x81, 0x00, 0x06, 0x35, 0x66, 0x96,
+  0x43, 0x34, 0xF4, 0x3D, 0x82, 0x37, 0x1C, 0x34, 0xE3, 0x33, 0x33, 0x39, 0xB3, 0xEF, 0x33, 0x39,
+  0x9B, 0xBF, 0x33, 0x11, 0x1F, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55, 0x35, 0x55, 0x77, 0x88, 0x35,
+  0x53, 0x33, 0x33, 0x65, 0x80, 0x03, 0x01, 0x75, 0x57, 0x80, 0x03, 0x00, 0x55, 0x81, 0x03, 0x02,
+  0x73, 0x33, 0x5F, 0x80, 0x3B, 0x03, 0x78, 0x33, 0x62, 0x5F, 0x80, 0x36, 0x00, 0x65, 0x88, 0x03,
+  0x00, 0x75, 0x80, 0x03, 0x80, 0x21, 0x01, 0x36, 0x55, 0x81, 0x5B, 0x00, 0xF1, 0x80, 0x03, 0x01,
+  0x53, 0x62, 0x80, 0x03, 0x03, 0x33, 0x33, 0x66, 0x58, 0x80, 0x18, 0x00, 0x5B, 0x81, 0x1C, 0x00,
+  0x63, 0x80, 0x03, 0x01, 0x56, 0x33, 0x80, 0xCF, 0x87, 0xF8, 0x0B, 0x44, 0x99, 0x99, 0x9D, 0x33,
+  0x33, 0x49, 0x96, 0x33, 0x33, 0x3D, 0x99, 0x82, 0x07, 0x02, 0x34, 0x99, 0x96, 0x85, 0x1C, 0x0E,
+  0x44, 0x3F, 0xBB, 0xAA, 0x33, 0x3A, 0xAA, 0xAA, 0x43, 0x33, 0xAA, 0xAA, 0xD3, 0x33, 0x8A, 0x80,
+  0x03, 0x01, 0x33, 0x5A, 0x80, 0x03, 0x00, 0x35, 0x85, 0xBF, 0x80, 0x22, 0x81, 0x03, 0x82, 0x47,
+  0x02, 0x22, 0x22, 0x2C, 0x80, 0x57, 0x00, 0x28, 0x80, 0x03, 0x01, 0x27, 0x42, 0x85, 0x3F, 0x06,
+  0xFF, 0xFF, 0xFF, 0xA3, 0xAA, 0xAA, 0xAA, 0x81, 0x03, 0x05, 0xA5, 0x3B, 0x55, 0xAA, 0xAA, 0x5A,
+  0x80, 0x43, 0x03, 0xAA, 0x53, 0x34, 0xAA, 0x81, 0x3B, 0x00, 0x52, 0x80, 0x03, 0x03, 0x33, 0x34,
+  0x59, 0x11, 0x81, 0xFA, 0x81, 0xFF, 0x00, 0x83, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x03, 0x22,
+  0xC4, 0x83, 0x38, 0x88, 0x9F, 0x06, 0x22, 0x7E, 0xEE, 0xFE, 0xE7, 0x33, 0x33, 0x80, 0xC5, 0x00,
+  0x35, 0x80, 0x21, 0x06, 0x4A, 0x33, 0x34, 0x5A, 0xA3, 0x33, 0x34, 0x85, 0x7F, 0x81, 0x00, 0x03,
+  0x54, 0x44, 0x5B, 0x59, 0x81, 0x3F, 0x0B, 0x43, 0x34, 0xE3, 0x33, 0xB3, 0x39, 0xB3, 0xEF, 0xB3,
+  0x39, 0x9B, 0xBB, 0x88, 0x3E, 0x03, 0x7D, 0xEE, 0x7E, 0x93, 0x80, 0xD6, 0x80, 0x03, 0x00, 0xD6,
+  0x80, 0xE6, 0x00, 0xD9, 0x80, 0xE2, 0x02, 0xD9, 0x96, 0xD3, 0x85, 0x3B, 0x03, 0x86, 0x62, 0xD9,
+  0x91, 0x81, 0x3B, 0x8C, 0x00, 0x00, 0x36, 0x89, 0x5F, 0x0E, 0x65, 0x53, 0x33, 0x36, 0xA5, 0x58,
+  0x33, 0x33, 0x75, 0x5B, 0x33, 0x33, 0x55, 0x55, 0x63, 0x80, 0x03, 0x01, 0x56, 0x33, 0x89, 0x1F,
+  0x00, 0x91, 0x81, 0xC7, 0x02, 0x36, 0x22, 0x29, 0x80, 0x37, 0x00, 0x37, 0x80, 0x03, 0x00, 0x65,
+  0x80, 0x3E, 0x00, 0x55, 0x89, 0xBF, 0x81, 0x00, 0x0C, 0x26, 0x43, 0x34, 0xF2, 0x69, 0xD3, 0x33,
+  0x8A, 0x99, 0xD3, 0x33, 0x33, 0x66, 0x80, 0x03, 0x8D, 0x1F, 0x81, 0x00, 0x0B, 0xAF, 0xFF, 0xFF,
+  0xFA, 0x7A, 0xAA, 0xAA, 0xB8, 0x35, 0xAA, 0xAA, 0xA5, 0x8E, 0x1C, 0x0D, 0xFF, 0xAB, 0xF2, 0x43,
+  0x8A, 0xA5, 0xAA, 0x33, 0x5A, 0x33, 0x8A, 0x5A, 0xAA, 0x53, 0x8A, 0xFF, 0x85, 0x00, 0x05, 0x22,
+  0x74, 0x44, 0x33, 0x22, 0x24, 0x81, 0x5B, 0x01, 0x74, 0x83, 0x91, 0x1F, 0x80, 0x9E, 0x07, 0x83,
+  0x33, 0x33, 0x4C, 0x33, 0x38, 0x72, 0x23, 0x8A, 0xBF, 0x81, 0x00, 0x0B, 0x99, 0x55, 0x55, 0x55,
+  0x33, 0x43, 0x34, 0xE3, 0x34, 0xB3, 0x39, 0xB3, 0x80, 0x03, 0x00, 0x9B, 0x8C, 0x7D, 0x10, 0x27,
+  0x77, 0x74, 0xD9, 0x93, 0x33, 0x33, 0xD6, 0x6D, 0x37, 0x33, 0xD9, 0x99, 0x97, 0x33, 0xD6, 0x69,
+  0x80, 0x32, 0x09, 0x92, 0x11, 0x11, 0x96, 0x33, 0x11, 0x2E, 0x33, 0x33, 0x63, 0x80, 0xF4, 0x89,
+  0x00, 0x00, 0x73, 0x81, 0x04, 0x04, 0x82, 0xC3, 0x33, 0x33, 0x86, 0x80, 0x03, 0x01, 0x46, 0x23,
+  0x84, 0x03, 0x00, 0x29, 0x80, 0x13, 0x00, 0x2B, 0x81, 0x9C, 0x14, 0x43, 0x34, 0x22, 0x22, 0x24,
+  0x82, 0x22, 0x22, 0x26, 0x34, 0x22, 0x26, 0x66, 0x33, 0x38, 0x22, 0x62, 0x33, 0x33, 0x34, 0xB2,
+  0x8C, 0x42, 0x13, 0x34, 0x62, 0x93, 0x33, 0xD7, 0x66, 0xC3, 0x33, 0x47, 0x66, 0x2F, 0x33, 0x37,
+  0x66, 0x28, 0x33, 0x37, 0x42, 0x22, 0x93, 0x80, 0x2A, 0x06, 0x83, 0x33, 0x42, 0x66, 0x83, 0x33,
+  0x22, 0x81, 0x03, 0x01, 0x22, 0x43, 0x80, 0x03, 0x01, 0x22, 0x78, 0x89, 0xA4, 0x80, 0x53, 0x02,
+  0x22, 0x33, 0xF2, 0x80, 0x03, 0x00, 0x37, 0x80, 0x03, 0x80, 0x6D, 0x03, 0x33, 0x38, 0x48, 0x72,
+  0x87, 0xC1, 0x0E, 0x22, 0x22, 0x2C, 0x33, 0x32, 0x77, 0x28, 0x33, 0x72, 0x33, 0x27, 0x72, 0x22,
+  0x73, 0x22, 0x80, 0x9A, 0x86, 0x03, 0x80, 0x9E, 0x01, 0x22, 0x24, 0x81, 0x9A, 0x02, 0x83, 0x33,
+  0x82, 0x80, 0x08, 0x80, 0x9F, 0x08, 0x74, 0x33, 0x34, 0x9B, 0xB9, 0x33, 0x33, 0x44, 0xDB, 0x8D,
+  0xD7, 0x0B, 0xA3, 0x3A, 0xAA, 0x33, 0xA3, 0x4A, 0xAA, 0x33, 0x66, 0x6B, 0x33, 0x4B, 0x80, 0x03,
+  0x04, 0xEB, 0xED, 0xD4, 0x33, 0x3B, 0x80, 0x16, 0x00, 0x3D, 0x85, 0x23, 0x05, 0xAA, 0xAA, 0x74,
+  0x83, 0xAA, 0xAA, 0x80, 0x1F, 0x0B, 0x2B, 0x93, 0x33, 0x66, 0x22, 0x28, 0x33, 0x66, 0x62, 0x22,
+  0x22, 0x66, 0x80, 0x00, 0x07, 0x22, 0x66, 0x22, 0x26, 0x32, 0x66, 0x69, 0xF8, 0x80, 0x03, 0x80,
+  0xC3, 0x07, 0x62, 0x43, 0x33, 0x38, 0x26, 0x62, 0x33, 0x92, 0x80, 0x17, 0x16, 0x22, 0x26, 0x66,
+  0x66, 0x62, 0x62, 0x66, 0x22, 0x62, 0x22, 0x26, 0x22, 0x62, 0x93, 0xC6, 0x82, 0x23, 0x33, 0x26,
+  0xF2, 0x23, 0x38, 0x2C, 0x80, 0x8A, 0x80, 0x3F, 0x80, 0x3B, 0x81, 0x01, 0x84, 0x00, 0x00, 0x26,
+  0x80, 0x0E, 0x03, 0x89, 0x48, 0xCC, 0x84, 0x81, 0x67, 0x03, 0x82, 0x26, 0x22, 0x83, 0x80, 0x1A,
+  0x08, 0x93, 0x66, 0x66, 0x2B, 0x33, 0x66, 0x66, 0xC9, 0x33, 0x80, 0x6A, 0x00, 0x33, 0x80, 0x02,
+  0x89, 0x00, 0x00, 0x42, 0x80, 0x03, 0x00, 0x37, 0x80, 0x03, 0x01, 0x72, 0x33, 0x80, 0xD1, 0x02,
+  0x33, 0x33, 0x32, 0x80, 0x1E, 0x01, 0xF2, 0x27, 0x80, 0xE5, 0x80, 0x03, 0x01, 0x33, 0x47, 0x80,
+  0x5A, 0x86, 0x00, 0x00, 0x72, 0x80, 0x4A, 0x07, 0x37, 0x22, 0x83, 0x72, 0x34, 0x22, 0x73, 0x42,
+  0x85, 0x03, 0x01, 0x27, 0x34, 0x85, 0x1D, 0x00, 0x27, 0x80, 0x2B, 0x01, 0x28, 0x33, 0x83, 0x03,
+  0x81, 0x3E, 0x02, 0x2C, 0x33, 0x83, 0x80, 0x03, 0x84, 0x1C, 0x03, 0x28, 0x72, 0x44, 0x48, 0x89,
+  0x73, 0x00, 0x3A, 0x85, 0x03, 0x03, 0x53, 0x33, 0x34, 0xE7, 0x80, 0x07, 0x00, 0x44, 0x89, 0x1C,
+  0x10, 0x1C, 0x53, 0x33, 0x33, 0x11, 0xC3, 0x31, 0x11, 0x11, 0xC3, 0x81, 0x1C, 0xB9, 0x66, 0x6B,
+  0x33, 0xDB, 0x80, 0x03, 0x02, 0x33, 0xED, 0xD4, 0x8B, 0xB5, 0x02, 0xAA, 0xAA, 0x74, 0x80, 0x03,
+  0x09, 0xAA, 0x42, 0x22, 0x2B, 0x93, 0x92, 0x22, 0x26, 0x28, 0x32, 0x80, 0x64, 0x0C, 0x38, 0x22,
+  0x26, 0x66, 0x33, 0x22, 0x26, 0x22, 0x33, 0x32, 0x26, 0x29, 0x43, 0x80, 0x03, 0x06, 0x33, 0x42,
+  0x26, 0x62, 0x33, 0x33, 0x38, 0x80, 0xD3, 0x01, 0x92, 0x66, 0x80, 0x1E, 0x83, 0x03, 0x13, 0x26,
+  0x26, 0x22, 0xF8, 0x22, 0x22, 0x93, 0x33, 0x82, 0x23, 0x33, 0x43, 0xF2, 0xB3, 0x38, 0x62, 0x22,
+  0x83, 0x33, 0x66, 0x80, 0x19, 0x00, 0x66, 0x84, 0x00, 0x81, 0x08, 0x00, 0xB2, 0x80, 0x05, 0x04,
+  0x22, 0x89, 0x88, 0xCC, 0x2C, 0x81, 0x67, 0x00, 0x82, 0x80, 0x50, 0x81, 0x14, 0x02, 0x22, 0x66,
+  0x6B, 0x80, 0x05, 0x02, 0xCF, 0x66, 0x62, 0x80, 0xDF, 0x03, 0x28, 0x33, 0x33, 0x84, 0x84, 0x86,
+  0x00, 0x83, 0x80, 0x03, 0x00, 0x93, 0x87, 0x95, 0x00, 0x34, 0x80, 0x03, 0x00, 0x37, 0x80, 0x03,
+  0x00, 0xD7, 0x80, 0x03, 0x00, 0x77, 0x81, 0x10, 0x00, 0x42, 0x80, 0x74, 0x00, 0x37, 0x80, 0x03,
+  0x00, 0x72, 0x80, 0x03, 0x80, 0x04, 0x08, 0x83, 0x28, 0x37, 0x22, 0x83, 0x27, 0x34, 0x22, 0x73,
+  0x81, 0x03, 0x00, 0x87, 0x80, 0x03, 0x00, 0x22, 0x80, 0x08, 0x84, 0x00, 0x00, 0x27, 0x80, 0x03,
+  0x00, 0x28, 0x80, 0x27, 0x0C, 0x28, 0x42, 0x2C, 0x22, 0x27, 0x42, 0x33, 0x22, 0x2C, 0x42, 0x83,
+  0x22, 0x2C, 0x85, 0x1C, 0x03, 0x47, 0x72, 0x44, 0x48, 0x8A, 0xFF, 0x84, 0x00, 0x04, 0xAA, 0x53,
+  0x33, 0x34, 0xA8, 0x8C, 0x13, 0x07, 0x31, 0x1C, 0x53, 0x33, 0x31, 0x11, 0xC3, 0x31, 0x80, 0x03,
+  0x0C, 0x41, 0x9B, 0xB6, 0x66, 0x9B, 0x44, 0xDB, 0x99, 0x9B, 0x33, 0x33, 0xED, 0xD4, 0x8A, 0x37,
+  0x02, 0x33, 0xAA, 0xAA, 0x81, 0x03, 0x12, 0x33, 0x42, 0x26, 0x2B, 0x33, 0x92, 0x66, 0x22, 0x33,
+  0x32, 0x66, 0x62, 0x33, 0x38, 0x66, 0x66, 0x33, 0x33, 0x22, 0x80, 0x03, 0x05, 0x32, 0x66, 0xD4,
+  0x43, 0x32, 0x66, 0x80, 0x1C, 0x00, 0x66, 0x80, 0xDB, 0x00, 0x38, 0x80, 0xEE, 0x20, 0x92, 0x62,
+  0x22, 0x22, 0x26, 0x66, 0x66, 0x62, 0x66, 0x62, 0x26, 0x66, 0x62, 0x29, 0xF8, 0x22, 0x62, 0x29,
+  0x33, 0x82, 0x23, 0x22, 0x43, 0xF2, 0x23, 0x22, 0x62, 0x22, 0x8F, 0x66, 0x66, 0x66, 0x22, 0x80,
+  0x03, 0x00, 0x62, 0x80, 0x03, 0x01, 0x66, 0x22, 0x80, 0x09, 0x01, 0x93, 0xB2, 0x80, 0x43, 0x04,
+  0x26, 0x89, 0x88, 0x38, 0x2C, 0x81, 0x69, 0x02, 0x82, 0x66, 0xBB, 0x81, 0x14, 0x83, 0x1E, 0x81,
+  0x21, 0x06, 0x28, 0x66, 0x66, 0x28, 0x33, 0xCC, 0x84, 0x83, 0x87, 0x01, 0x62, 0x83, 0x80, 0x03,
+  0x80, 0x64, 0x00, 0x2B, 0x80, 0x0B, 0x00, 0xCF, 0x91, 0xE0, 0x04, 0x42, 0x22, 0x22, 0x33, 0x37,
+  0x80, 0x03, 0x0F, 0x72, 0x22, 0x22, 0x34, 0x22, 0x72, 0x22, 0x32, 0x28, 0x37, 0x22, 0x52, 0x27,
+  0x34, 0x22, 0x22, 0x80, 0x03, 0x01, 0x33, 0x87, 0x80, 0x07, 0x81, 0x08, 0x84, 0x00, 0x00, 0x83,
+  0x81, 0x03, 0x80, 0x27, 0x00, 0x73, 0x80, 0x33, 0x02, 0x73, 0x42, 0x33, 0x80, 0x03, 0x81, 0x11,
+  0x83, 0x00, 0x03, 0x27, 0x47, 0x72, 0x44, 0x80, 0xC7, 0x00, 0x33, 0x81, 0x03, 0x00, 0x27, 0x80,
+  0x03, 0x81, 0x9A, 0x81, 0x03, 0x08, 0xAA, 0xAA, 0x53, 0x33, 0xAA, 0xA8, 0x33, 0x33, 0x48, 0x89,
+  0x73, 0x06, 0x31, 0x1C, 0x53, 0x33, 0x31, 0x11, 0xC3, 0x81, 0x03, 0x07, 0x34, 0x9B, 0xB9, 0x66,
+  0x33, 0x44, 0xDB, 0x99, 0x80, 0x15, 0x00, 0xED, 0x89, 0x22, 0x04, 0x3A, 0xAA, 0x33, 0xAA, 0x4A,
+  0x80, 0x03, 0x03, 0xE7, 0x33, 0x49, 0x69, 0x80, 0x03, 0x07, 0x66, 0xD4, 0x33, 0x39, 0x96, 0x33,
+  0x33, 0x3D, 0x81, 0x27, 0x81, 0x03, 0x09, 0x39, 0x11, 0x54, 0x83, 0x39, 0x11, 0x1C, 0x33, 0x49,
+  0x2C, 0x80, 0xDB, 0x00, 0x62, 0x80, 0x74, 0x03, 0x22, 0x62, 0x22, 0x22, 0x80, 0xFC, 0x15, 0x62,
+  0x66, 0x22, 0x22, 0x62, 0x66, 0x29, 0xF8, 0x26, 0x66, 0x29, 0x33, 0x86, 0x66, 0x62, 0x43, 0xF2,
+  0x38, 0x22, 0x66, 0x22, 0x92, 0x80, 0x18, 0x81, 0x1C, 0x00, 0x26, 0x80, 0x03, 0x80, 0x1F, 0x10,
+  0x66, 0x22, 0x93, 0xC2, 0x22, 0x2F, 0x33, 0x22, 0x89, 0x23, 0x38, 0x2C, 0x33, 0x83, 0x33, 0x33,
+  0x82, 0x81, 0xBF, 0x00, 0x26, 0x83, 0x1D, 0x82, 0x20, 0x80, 0x00, 0x03, 0x28, 0x88, 0xCC, 0x84,
+  0x82, 0x87, 0x02, 0x22, 0x66, 0x83, 0x80, 0x03, 0x07, 0x93, 0x33, 0x66, 0x2B, 0x33, 0x33, 0x66,
+  0xCF, 0x83, 0xDF, 0x8B, 0x00, 0x04, 0x42, 0x22, 0x33, 0x33, 0x37, 0x80, 0x03, 0x0F, 0x72, 0x22,
+  0x33, 0x34, 0x22, 0x72, 0x33, 0x32, 0x28, 0x37, 0x33, 0x72, 0x27, 0x34, 0x33, 0x22, 0x80, 0x03,
+  0x02, 0x33, 0x87, 0x34, 0x80, 0x4B, 0x00, 0x27, 0x82, 0x51, 0x81, 0x00, 0x00, 0x83, 0x81, 0x03,
+  0x04, 0x72, 0x22, 0x22, 0x73, 0x42, 0x81, 0x03, 0x00, 0x33, 0x80, 0x03, 0x00, 0x83, 0x81, 0x20,
+  0x82, 0x00, 0x03, 0x27, 0x47, 0x72, 0x22, 0x81, 0xC7, 0x81, 0x03, 0x00, 0x27, 0x80, 0x03, 0x00,
+  0x2C, 0x83, 0x03, 0x03, 0x33, 0x34, 0x58, 0x38, 0x81, 0x05, 0x0F, 0x83, 0x55, 0x43, 0x33, 0x33,
+  0x11, 0x53, 0x34, 0x33, 0x1B, 0x83, 0x41, 0xC1, 0x11, 0x54, 0x11, 0x87, 0x00, 0x09, 0x18, 0x33,
+  0xC1, 0x11, 0xC3, 0x3D, 0x33, 0x81, 0x83, 0x49, 0x80, 0x27, 0x0D, 0x99, 0x1C, 0x43, 0x34, 0x99,
+  0x11, 0xC3, 0x39, 0x99, 0x1B, 0x83, 0x4D, 0xD4, 0x1B, 0x80, 0xDC, 0x80, 0xED, 0x00, 0x28, 0x80,
+  0xFB, 0x14, 0x26, 0x22, 0x8B, 0x66, 0x66, 0x28, 0x34, 0x66, 0x66, 0x24, 0x34, 0x26, 0x66, 0x29,
+  0x38, 0x26, 0x6B, 0x33, 0x33, 0x48, 0xBC, 0x81, 0xBD, 0x11, 0x82, 0x28, 0x22, 0x69, 0x22, 0x26,
+  0x62, 0xC3, 0x62, 0x22, 0x62, 0x93, 0x83, 0x82, 0x62, 0x33, 0x93, 0x82, 0x80, 0x80, 0x01, 0x26,
+  0x29, 0x80, 0xCA, 0x00, 0xB3, 0x80, 0x03, 0x80, 0x40, 0x87, 0x00, 0x10, 0x38, 0x33, 0x3E, 0xA7,
+  0xD5, 0x33, 0x3A, 0x54, 0x55, 0x33, 0x3A, 0x55, 0x67, 0x33, 0x3A, 0x5B, 0x36, 0x80, 0x03, 0x80,
+  0x16, 0x0C, 0x36, 0x73, 0x33, 0x67, 0xD5, 0x53, 0x75, 0x55, 0x55, 0x53, 0x55, 0x44, 0x44, 0x84,
+  0x03, 0x80, 0x0B, 0x06, 0x5B, 0x67, 0x53, 0xD5, 0x57, 0x36, 0x53, 0x82, 0x39, 0x04, 0x37, 0x22,
+  0x43, 0x33, 0x32, 0x80, 0xD5, 0x00, 0x32, 0x80, 0xDD, 0x00, 0x82, 0x80, 0x03, 0x80, 0xFE, 0x86,
+  0x03, 0x02, 0x34, 0x83, 0x87, 0x82, 0x22, 0x0D, 0x27, 0x73, 0x84, 0x37, 0x22, 0x73, 0x42, 0x32,
+  0x22, 0x73, 0x72, 0x72, 0x22, 0xC3, 0x80, 0x19, 0x01, 0x27, 0x22, 0x81, 0x00, 0x02, 0x83, 0x72,
+  0x2C, 0x80, 0x1C, 0x80, 0x03, 0x80, 0x00, 0x0F, 0x73, 0x88, 0x33, 0x38, 0x73, 0x72, 0x28, 0x37,
+  0x73, 0x72, 0x23, 0x3A, 0x27, 0x22, 0x73, 0x8A, 0x80, 0x1D, 0x00, 0x7A, 0x86, 0x9D, 0x09, 0x35,
+  0x53, 0x81, 0xC1, 0x11, 0xC3, 0x41, 0x11, 0x11, 0x53, 0x80, 0x03, 0x00, 0x43, 0x81, 0x07, 0x01,
+  0x51, 0x11, 0x80, 0x00, 0x03, 0x33, 0x33, 0x34, 0x48, 0x81, 0x1E, 0x07, 0x11, 0x83, 0x55, 0x43,
+  0x11, 0x33, 0x11, 0x53, 0x80, 0x03, 0x04, 0x83, 0x11, 0xC1, 0x11, 0x54, 0x81, 0x1B, 0x81, 0x00,
+  0x0C, 0x38, 0x11, 0x11, 0x18, 0x34, 0xC1, 0xB1, 0xC3, 0x33, 0x33, 0x81, 0x83, 0x34, 0x80, 0x27,
+  0x0D, 0x41, 0x1C, 0x43, 0x34, 0x11, 0x11, 0xC3, 0x39, 0x11, 0x11, 0x83, 0x4D, 0x11, 0x1B, 0x80,
+  0xFF, 0x03, 0x22, 0x26, 0x62, 0x38, 0x80, 0x03, 0x09, 0x42, 0x22, 0x8B, 0x62, 0x22, 0x68, 0x34,
+  0x66, 0x22, 0x69, 0x80, 0x03, 0x05, 0x29, 0x38, 0x66, 0x89, 0x33, 0x33, 0x82, 0x57, 0x09, 0x28,
+  0xC2, 0x28, 0x22, 0x22, 0x26, 0x22, 0x22, 0x66, 0x62, 0x80, 0x03, 0x13, 0x83, 0x82, 0x22, 0x66,
+  0x93, 0x82, 0x28, 0x6B, 0x33, 0x26, 0x29, 0xBC, 0x34, 0x26, 0x23, 0x33, 0x34, 0x26, 0x83, 0x58,
+  0x81, 0xB7, 0x80, 0x03, 0x80, 0x49, 0x80, 0x00, 0x05, 0x3E, 0xA7, 0x33, 0x33, 0x36, 0x55, 0x84,
+  0x03, 0x00, 0x5B, 0x83, 0x03, 0x1E, 0x33, 0x36, 0x33, 0x33, 0x67, 0xD5, 0x38, 0x75, 0x55, 0x44,
+  0xD5, 0x55, 0x55, 0x44, 0x54, 0x44, 0x44, 0x44, 0x67, 0x44, 0x44, 0x55, 0x36, 0x55, 0x4B, 0x67,
+  0x33, 0xD4, 0x57, 0x36, 0xD3, 0x82, 0x3F, 0x04, 0x35, 0xAA, 0x93, 0x33, 0x3A, 0x84, 0x03, 0x00,
+  0x8A, 0x80, 0x03, 0x00, 0x4A, 0x86, 0x03, 0x04, 0x33, 0x33, 0x38, 0x83, 0x43, 0x80, 0x23, 0x13,
+  0x27, 0x37, 0x27, 0x73, 0x28, 0x37, 0x22, 0x73, 0x28, 0x32, 0x22, 0x73, 0x22, 0x72, 0x22, 0xC3,
+  0x22, 0x22, 0x22, 0x27, 0x80, 0x03, 0x09, 0x22, 0x87, 0x83, 0x72, 0x2C, 0x33, 0x33, 0x37, 0x2C,
+  0x84, 0x80, 0x23, 0x0B, 0x42, 0x73, 0x88, 0x33, 0x72, 0x73, 0x72, 0x28, 0x42, 0x73, 0x72, 0x23,
+  0x80, 0x1D, 0x00, 0x73, 0x80, 0x1E, 0x83, 0x96, 0x82, 0x00, 0x0E, 0x35, 0x53, 0x38, 0x51, 0x11,
+  0xC3, 0x35, 0x11, 0x11, 0x53, 0x31, 0x11, 0x11, 0x43, 0x81, 0x80, 0x07, 0x03, 0x51, 0x11, 0x11,
+  0x11, 0x80, 0x18, 0x00, 0x34, 0x81, 0x1D, 0x0F, 0x81, 0x11, 0x83, 0x55, 0x41, 0x11, 0x33, 0x11,
+  0x4B, 0x11, 0x33, 0x1B, 0x41, 0x11, 0xCC, 0x11, 0x81, 0x1B, 0x81, 0x00, 0x01, 0x44, 0x38, 0x80,
+  0x23, 0x02, 0x34, 0xC1, 0x11, 0x80, 0x83, 0x01, 0x81, 0x53, 0x80, 0x29, 0x07, 0x83, 0x41, 0x1C,
+  0x43, 0x54, 0x11, 0x11, 0xC3, 0x80, 0x1A, 0x1E, 0x83, 0x11, 0x11, 0x1B, 0x83, 0xA4, 0x33, 0x22,
+  0x66, 0xA3, 0x38, 0x22, 0x66, 0x43, 0x42, 0x22, 0x8B, 0x33, 0x22, 0x28, 0x34, 0x34, 0x22, 0x29,
+  0x34, 0x32, 0x22, 0x29, 0x38, 0x4C, 0x89, 0x83, 0x75, 0x09, 0x62, 0x28, 0xC2, 0x28, 0x66, 0x62,
+  0x22, 0x66, 0x22, 0x62, 0x80, 0x8D, 0x0E, 0x66, 0x83, 0x86, 0x22, 0x22, 0x93, 0x86, 0x22, 0x2B,
+  0x33, 0x26, 0x48, 0x2C, 0x34, 0x22, 0x80, 0x7A, 0x0A, 0x22, 0x22, 0x29, 0x33, 0x33, 0x26, 0xC3,
+  0x33, 0x33, 0x22, 0x93, 0x80, 0x03, 0x03, 0x33, 0x33, 0x3F, 0x28, 0x80, 0x14, 0x80, 0x12, 0x01,
+  0x34, 0x23, 0x80, 0x03, 0x80, 0xBC, 0x82, 0x9B, 0x80, 0x00, 0x25, 0x67, 0x33, 0x38, 0x75, 0x55,
+  0xA7, 0xD5, 0x54, 0x44, 0x55, 0x45, 0x55, 0x44, 0x55, 0x67, 0x55, 0x55, 0x5B, 0x36, 0x55, 0x4B,
+  0x5B, 0x33, 0xD5, 0x47, 0x36, 0x73, 0x33, 0x33, 0xD5, 0xD3, 0x33, 0x32, 0x54, 0x53, 0x33, 0x3C,
+  0x44, 0x83, 0x03, 0x01, 0x6C, 0x55, 0x80, 0x03, 0x00, 0x67, 0x80, 0x03, 0x00, 0x36, 0x80, 0x03,
+  0x81, 0xDF, 0x00, 0x22, 0x80, 0xBC, 0x0A, 0x22, 0x27, 0x37, 0x27, 0x22, 0x28, 0x37, 0x22, 0x22,
+  0x28, 0x32, 0x80, 0x88, 0x00, 0x72, 0x80, 0x03, 0x83, 0x00, 0x03, 0x83, 0x87, 0x83, 0x72, 0x80,
+  0x23, 0x13, 0x37, 0x73, 0x84, 0x33, 0x33, 0x73, 0x42, 0x73, 0x88, 0x73, 0x72, 0x73, 0x72, 0xC3,
+  0x42, 0x73, 0x72, 0x27, 0x22, 0x27, 0x82, 0x1F, 0x00, 0x2C, 0x80, 0x1C, 0x81, 0x03, 0x81, 0x23,
+  0x13, 0x33, 0x38, 0x7A, 0xAA, 0x28, 0x37, 0xAA, 0xAA, 0x23, 0x3A, 0xAA, 0xAA, 0x73, 0x8A, 0xAA,
+  0xAA, 0x83, 0x7A, 0xAA, 0xAA, 0x84, 0x9F, 0x13, 0x33, 0x53, 0x81, 0x11, 0x83, 0xC3, 0x41, 0x11,
+  0x33, 0x53, 0x4B, 0x11, 0x33, 0x83, 0x41, 0x11, 0xC1, 0x53, 0x51, 0x11, 0x82, 0x00, 0x03, 0x34,
+  0x58, 0x38, 0x11, 0x80, 0x82, 0x01, 0xC1, 0x55, 0x80, 0x83, 0x09, 0x11, 0x53, 0x34, 0x33, 0x1B,
+  0x83, 0x41, 0x1C, 0x11, 0x54, 0x83, 0x1B, 0x80, 0x00, 0x1C, 0x1B, 0x11, 0x18, 0x33, 0x96, 0x11,
+  0xC3, 0x3D, 0x96, 0x81, 0x83, 0x49, 0x99, 0x33, 0x33, 0x99, 0x9D, 0x43, 0x34, 0x99, 0x94, 0xC3,
+  0x39, 0x69, 0x94, 0x83, 0x4D, 0xD4, 0x33, 0x80, 0xFF, 0x1C, 0x33, 0x66, 0x26, 0x28, 0xC2, 0x66,
+  0x66, 0x22, 0x22, 0x4C, 0x26, 0x66, 0x22, 0x34, 0x26, 0x66, 0x83, 0x34, 0x22, 0x66, 0x93, 0x38,
+  0x22, 0x2B, 0x33, 0x33, 0x48, 0x2C, 0x34, 0x81, 0xDB, 0x15, 0x28, 0x22, 0x29, 0x33, 0x22, 0x62,
+  0xC3, 0x33, 0x22, 0x22, 0x93, 0x33, 0x82, 0x22, 0x33, 0x33, 0x82, 0x28, 0x33, 0x33, 0x26, 0x29,
+  0x80, 0xEF, 0x00, 0xB3, 0x80, 0x03, 0x81, 0x40, 0x86, 0x00, 0x23, 0x38, 0x75, 0x3E, 0xA7, 0xD5,
+  0x55, 0x36, 0x55, 0x55, 0x44, 0x36, 0x55, 0x67, 0x44, 0x36, 0x5B, 0x36, 0x54, 0x36, 0x5B, 0x33,
+  0xD5, 0x33, 0x36, 0x73, 0x33, 0x67, 0xD5, 0x53, 0x33, 0x55, 0x54, 0x53, 0x33, 0x44, 0x55, 0x80,
+  0x03, 0x00, 0x44, 0x83, 0x07, 0x06, 0x4B, 0x67, 0x53, 0x33, 0x57, 0x36, 0x53, 0x83, 0xF8, 0x12,
+  0x22, 0x43, 0x33, 0x32, 0x22, 0x27, 0x37, 0x32, 0x22, 0x28, 0x37, 0x82, 0x22, 0x28, 0x32, 0x42,
+  0x22, 0x22, 0x72, 0x80, 0x03, 0x00, 0x22, 0x81, 0x03, 0x02, 0x34, 0x83, 0x87, 0x82, 0x65, 0x0D,
+  0x27, 0x73, 0x84, 0x33, 0x22, 0x73, 0x42, 0x73, 0x22, 0x73, 0x72, 0x73, 0x22, 0xC3, 0x80, 0x07,
+  0x00, 0x27, 0x80, 0x01, 0x80, 0x00, 0x01, 0x72, 0x2C, 0x80, 0x3F, 0x80, 0x03, 0x81, 0x00, 0x14,
+  0x88, 0x33, 0x38, 0x7A, 0x72, 0x28, 0x37, 0xAA, 0x72, 0x23, 0x3A, 0xAA, 0x22, 0x73, 0x8A, 0xAA,
+  0x22, 0x83, 0x7A, 0xAA, 0x11, 0x84, 0x00, 0x00, 0x51, 0x80, 0x03, 0x00, 0x35, 0x80, 0x03, 0x04,
+  0x33, 0x81, 0x11, 0x11, 0x43, 0x80, 0x03, 0x84, 0x00, 0x0F, 0x1B, 0x11, 0x33, 0x33, 0x4D, 0x15,
+  0x33, 0x4D, 0x99, 0x15, 0x33, 0x49, 0x66, 0x15, 0x33, 0x46, 0x80, 0x03, 0x02, 0xD6, 0x66, 0x18,
+  0x80, 0x03, 0x04, 0x53, 0x33, 0xD9, 0x66, 0x33, 0x80, 0x03, 0x0D, 0x83, 0x48, 0x89, 0x33, 0x83,
+  0x46, 0x22, 0x23, 0x93, 0x42, 0x66, 0x83, 0x93, 0x22, 0x81, 0x03, 0x10, 0x62, 0x83, 0x93, 0x82,
+  0x62, 0xC3, 0x93, 0xF2, 0x66, 0x68, 0x23, 0x38, 0x66, 0x22, 0x33, 0x42, 0x93, 0x82, 0x7B, 0x00,
+  0x3C, 0x80, 0x06, 0x01, 0x42, 0x29, 0x80, 0x03, 0x04, 0x2B, 0x33, 0x33, 0x38, 0x62, 0x80, 0x10,
+  0x04, 0x22, 0x33, 0x33, 0x93, 0x82, 0x80, 0x07, 0x04, 0x3A, 0x55, 0x83, 0x33, 0x37, 0x80, 0x03,
+  0x85, 0x00, 0x02, 0x37, 0x55, 0xA3, 0x80, 0x03, 0x00, 0xB3, 0x80, 0x03, 0x0C, 0x73, 0x33, 0x37,
+  0x44, 0xA3, 0xB5, 0x5B, 0x33, 0xD3, 0x75, 0x55, 0x33, 0xA3, 0x85, 0x1E, 0x17, 0x65, 0x55, 0x83,
+  0x63, 0x85, 0x55, 0x83, 0xA3, 0x85, 0x45, 0x83, 0x73, 0x65, 0x44, 0xBA, 0xD3, 0x33, 0x47, 0x77,
+  0x77, 0x33, 0x3D, 0xDD, 0xDD, 0x86, 0x3F, 0x8C, 0x00, 0x00, 0x22, 0x80, 0x00, 0x00, 0x72, 0x80,
+  0x03, 0x02, 0x33, 0x34, 0x7C, 0x80, 0x71, 0x01, 0x33, 0x38, 0x8C, 0x1E, 0x04, 0x38, 0xAA, 0xAA,
+  0x33, 0x11, 0x82, 0x03, 0x05, 0xA5, 0x33, 0xB1, 0x45, 0x58, 0x34, 0x80, 0xEE, 0x06, 0x35, 0x11,
+  0x33, 0x84, 0x51, 0x11, 0x81, 0x83, 0xFF, 0x88, 0x00, 0x00, 0x18, 0x80, 0x12, 0x05, 0x53, 0x31,
+  0x11, 0x11, 0x83, 0x51, 0x80, 0x03, 0x80, 0x0F, 0x00, 0x58, 0x8A, 0x1D, 0x00, 0x15, 0x80, 0x15,
+  0x01, 0x13, 0x35, 0x80, 0x25, 0x00, 0x33, 0x81, 0x26, 0x89, 0x3D, 0x05, 0x33, 0x33, 0x11, 0x15,
+  0x33, 0x4D, 0x80, 0x03, 0x00, 0x49, 0x80, 0x03, 0x00, 0x46, 0x80, 0x03, 0x00, 0xD6, 0x80, 0x24,
+  0x02, 0xD6, 0x11, 0x53, 0x80, 0x03, 0x12, 0x33, 0x33, 0xD9, 0x48, 0x83, 0x48, 0x89, 0x22, 0x83,
+  0x42, 0x22, 0x66, 0x93, 0x42, 0x26, 0x66, 0x93, 0x22, 0x66, 0x83, 0x03, 0x0E, 0x86, 0x66, 0x62,
+  0x93, 0xF2, 0x66, 0x62, 0x23, 0x38, 0x66, 0x33, 0x33, 0x42, 0x93, 0x23, 0x80, 0xA8, 0x06, 0x83,
+  0x3C, 0x93, 0x33, 0x83, 0x42, 0x29, 0x80, 0x03, 0x0C, 0x2B, 0x33, 0xC3, 0x38, 0x62, 0x33, 0x28,
+  0x33, 0x22, 0x33, 0x62, 0x93, 0x82, 0x80, 0x19, 0x05, 0x3A, 0x54, 0x33, 0x33, 0x37, 0x55, 0x87,
+  0xD2, 0x81, 0x0B, 0x01, 0x37, 0x44, 0x85, 0x03, 0x05, 0x83, 0xB5, 0x5B, 0x33, 0x83, 0x75, 0x87,
+  0x1E, 0x17, 0xA3, 0x65, 0x55, 0x83, 0xB3, 0x85, 0x44, 0x83, 0x73, 0x85, 0x45, 0x83, 0xA3, 0x85,
+  0x45, 0xBA, 0x23, 0x33, 0x47, 0x77, 0x43, 0x33, 0x3D, 0xDD, 0x85, 0x1F, 0x00, 0x43, 0x84, 0x03,
+  0x00, 0x83, 0x80, 0x03, 0x81, 0x77, 0x00, 0x22, 0x80, 0x00, 0x07, 0x77, 0x72, 0x22, 0x22, 0x33,
+  0x33, 0x34, 0x7C, 0x87, 0x63, 0x87, 0x00, 0x80, 0x1E, 0x84, 0x03, 0x05, 0x27, 0x33, 0x38, 0x47,
+  0x78, 0x34, 0x81, 0x80, 0x0C, 0x33, 0x33, 0x84, 0x7A, 0x33, 0x8A, 0xAA, 0xAA, 0x38, 0xAA, 0xAA,
+  0xAA, 0x11, 0x87, 0x00, 0x00, 0x18, 0x80, 0x03, 0x00, 0x53, 0x80, 0x03, 0x00, 0x83, 0x84, 0x03,
+  0x00, 0x58, 0x88, 0x1B, 0x0F, 0x11, 0x81, 0x15, 0x51, 0x11, 0x31, 0x13, 0x35, 0x11, 0x51, 0x18,
+  0x33, 0x81, 0x11, 0x11, 0x43, 0x80, 0x03, 0x86, 0x00, 0x03, 0x33, 0x11, 0x11, 0x15, 0x8C, 0x03,
+  0x00, 0x18, 0x80, 0x03, 0x03, 0x53, 0x33, 0x11, 0x1B, 0x80, 0x6D, 0x23, 0x48, 0x83, 0x48, 0x98,
+  0x22, 0x83, 0x42, 0x42, 0x22, 0x93, 0x42, 0x42, 0x62, 0x93, 0x22, 0x86, 0x66, 0x93, 0x26, 0x82,
+  0x66, 0x93, 0x86, 0x82, 0x62, 0x93, 0xF2, 0x82, 0x62, 0x23, 0x38, 0x89, 0x33, 0x33, 0x42, 0x22,
+  0x80, 0xC8, 0x18, 0x62, 0x83, 0x3C, 0x93, 0x66, 0x83, 0x42, 0x29, 0x62, 0x43, 0x42, 0x2B, 0x66,
+  0xC3, 0x38, 0x22, 0x66, 0x28, 0x33, 0x22, 0x66, 0x22, 0x93, 0x82, 0x93, 0x80, 0xD8, 0x80, 0x45,
+  0x00, 0x38, 0x88, 0xD2, 0x81, 0x0B, 0x86, 0x03, 0x07, 0x55, 0x83, 0xB5, 0x5B, 0x55, 0x83, 0x75,
+  0x55, 0x85, 0x1C, 0x17, 0x55, 0xA3, 0x65, 0x55, 0x54, 0xB3, 0x85, 0x44, 0x54, 0x73, 0x85, 0x45,
+  0x44, 0xA3, 0x85, 0x44, 0x33, 0xD3, 0x33, 0x6C, 0x33, 0xA3, 0x33, 0x36, 0x85, 0x1F, 0x01, 0x83,
+  0x63, 0x80, 0x03, 0x00, 0xA3, 0x80, 0x03, 0x07, 0x73, 0x33, 0x33, 0xBA, 0xD3, 0x33, 0x33, 0x77,
+  0x80, 0x00, 0x03, 0xDD, 0xDD, 0xD7, 0x77, 0x80, 0x1A, 0x81, 0x67, 0x8E, 0x00, 0x00, 0x22, 0x84,
+  0x00, 0x07, 0x7C, 0x22, 0x22, 0x27, 0x33, 0x38, 0x47, 0x78, 0x84, 0x16, 0x08, 0x84, 0x33, 0x33,
+  0x8A, 0xAA, 0x33, 0x38, 0xAA, 0xAA, 0x80, 0xE8, 0x00, 0x11, 0x85, 0x03, 0x00, 0x34, 0x80, 0x03,
+  0x00, 0x35, 0x80, 0x03, 0x00, 0x51, 0x80, 0x03, 0x8D, 0x00, 0x10, 0x18, 0x81, 0x15, 0x51, 0x53,
+  0x31, 0x13, 0x35, 0x83, 0x51, 0x14, 0x33, 0x83, 0x11, 0x11, 0x43, 0x58, 0x8B, 0x1E, 0x00, 0x15,
+  0x85, 0x03, 0x00, 0x81, 0x83, 0x03, 0x00, 0x18, 0x80, 0x0B, 0x00, 0x53, 0x81, 0x56, 0x0D, 0x33,
+  0x33, 0x48, 0x83, 0x33, 0x98, 0x22, 0x83, 0x33, 0x42, 0x66, 0x93, 0x33, 0x46, 0x80, 0x03, 0x00,
+  0x82, 0x84, 0x03, 0x00, 0x86, 0x82, 0x03, 0x10, 0x23, 0x48, 0x89, 0x33, 0x33, 0x42, 0x22, 0x23,
+  0x33, 0x42, 0x26, 0x83, 0x3C, 0x22, 0x66, 0x83, 0x42, 0x81, 0x03, 0x0D, 0x82, 0x66, 0xC3, 0x38,
+  0xF2, 0x66, 0x28, 0x33, 0x38, 0x26, 0x22, 0x93, 0x42, 0x93, 0x83, 0xB0, 0x81, 0x06, 0x00, 0x29,
+  0x80, 0x03, 0x00, 0x62, 0x81, 0xD3, 0x84, 0x03, 0x00, 0x82, 0x80, 0x03, 0x07, 0x36, 0x55, 0x83,
+  0xB5, 0x37, 0x55, 0x83, 0x75, 0x85, 0xEF, 0x0A, 0x37, 0x55, 0xA3, 0x65, 0x37, 0x44, 0xB3, 0x85,
+  0x37, 0x55, 0x73, 0x80, 0x03, 0x08, 0xA3, 0x65, 0x4B, 0x33, 0xD3, 0x33, 0x55, 0x33, 0xA3, 0x85,
+  0x1E, 0x03, 0x33, 0x55, 0x83, 0x63, 0x80, 0x03, 0x08, 0xA3, 0x33, 0x45, 0x83, 0x73, 0x33, 0x44,
+  0xBA, 0xD3, 0x80, 0x7B, 0x05, 0x22, 0x22, 0x87, 0x77, 0x77, 0x72, 0x86, 0x20, 0x8C, 0x00, 0x80,
+  0x1E, 0x82, 0x00, 0x02, 0x34, 0x7C, 0x22, 0x80, 0x72, 0x01, 0x38, 0x47, 0x88, 0x1A, 0x00, 0x8A,
+  0x80, 0x0F, 0x03, 0xAA, 0x22, 0x33, 0xAA, 0x82, 0x03, 0x00, 0x27, 0x80, 0x03, 0x0A, 0x78, 0x34,
+  0xAA, 0xAA, 0x33, 0x37, 0xAA, 0xAA, 0x84, 0x7A, 0xAA, 0x86, 0x00, 0x03, 0x11, 0x11, 0x11, 0x1B,
+  0x85, 0x03, 0x04, 0x1C, 0xC1, 0x11, 0x1B, 0x00, 0x8C, 0x00, 0x80, 0x61, 0x04, 0x66, 0x33, 0x33,
+  0x48, 0x88, 0x85, 0x54, 0x8D, 0x1F, 0x07, 0x68, 0x92, 0x66, 0x62, 0x88, 0x88, 0xCC, 0xCC, 0x95,
+  0x1F, 0x00, 0x24, 0x80, 0x95, 0x81, 0x99, 0x01, 0x3F, 0x48, 0x93, 0x1F, 0x03, 0x33, 0x37, 0x44,
+  0x57, 0x80, 0x03, 0x08, 0x54, 0x33, 0x37, 0x5B, 0x67, 0x33, 0x37, 0x56, 0x36, 0x8D, 0x1F, 0x0F,
+  0xD5, 0x54, 0x55, 0x53, 0x5D, 0x75, 0x45, 0x53, 0x5A, 0x3A, 0x55, 0x53, 0x57, 0x33, 0x75, 0x5E,
+  0x8F, 0x9F, 0x87, 0x00, 0x00, 0x39, 0x91, 0x5F, 0x02, 0x33, 0x33, 0x3A, 0x80, 0x03, 0x00, 0x4A,
+  0x80, 0x03, 0x04, 0xAA, 0x33, 0x33, 0x34, 0xAA, 0x8D, 0x1F, 0x80, 0xF7, 0x84, 0x00, 0x00, 0x1B,
+  0x80, 0x03, 0x01, 0x83, 0x45, 0x97, 0x1F, 0x05, 0x11, 0x11, 0x55, 0x15, 0xC1, 0x11, 0x99, 0x1F,
+  0x01, 0x11, 0x1C, 0x8F, 0x1F, 0x80, 0x74, 0x00, 0x22, 0x80, 0x03, 0x00, 0x48, 0x80, 0x03, 0x81,
+  0x80, 0x8E, 0x9F, 0x07, 0x62, 0x28, 0x92, 0x26, 0x88, 0x88, 0x88, 0xCB, 0x85, 0xC3, 0x8E, 0x1F,
+  0x09, 0x24, 0x2B, 0x33, 0xBB, 0x22, 0x2B, 0x33, 0x33, 0x3F, 0x48, 0x92, 0x1F, 0x03, 0x33, 0x33,
+  0x37, 0x55, 0x84, 0x03, 0x00, 0x5B, 0x80, 0x03, 0x00, 0x56, 0x8D, 0x1F, 0x0F, 0x57, 0xD5, 0x45,
+  0x55, 0x55, 0x55, 0x75, 0x44, 0x67, 0x5A, 0x3A, 0x55, 0x36, 0x57, 0x33, 0x75, 0x8D, 0x1F, 0x00,
+  0x23, 0x80, 0x53, 0x86, 0x03, 0x00, 0x39, 0x91, 0x5F, 0x8A, 0x00, 0x00, 0x34, 0x8D, 0x1F, 0x00,
+  0x31, 0x80, 0xF6, 0x00, 0x41, 0x85, 0xFF, 0x02, 0x11, 0x11, 0x83, 0x8D, 0x1F, 0x87, 0x1A, 0x05,
+  0x11, 0x11, 0x85, 0x55, 0x15, 0xC1, 0x99, 0x1F, 0x02, 0x11, 0x11, 0x1C, 0x8F, 0x1F, 0x02, 0x1B,
+  0x33, 0x33, 0x89, 0x03, 0x8D, 0x1F, 0x07, 0x22, 0x62, 0x28, 0xF2, 0x48, 0x88, 0x88, 0x88, 0x85,
+  0xA0, 0x8D, 0x1F, 0x0B, 0x66, 0x62, 0x24, 0x22, 0xBB, 0xBB, 0x22, 0x22, 0x33, 0x33, 0x3F, 0x48,
+  0x91, 0x1F, 0x80, 0x12, 0x00, 0x38, 0x89, 0x03, 0x8D, 0x1F, 0x0E, 0x44, 0x57, 0xD5, 0x45, 0x44,
+  0x55, 0x55, 0x75, 0x5B, 0x67, 0x5A, 0x3A, 0x56, 0x36, 0x57, 0x8E, 0x3F, 0x03, 0x55, 0x53, 0x33,
+  0x33, 0x82, 0x03, 0x05, 0xD3, 0x33, 0x33, 0x75, 0x5E, 0x38, 0x91, 0x5F, 0x8A, 0x00, 0x8E, 0x1F,
+  0x04, 0x3A, 0xAA, 0xAA, 0x33, 0x4A, 0x80, 0x03, 0x03, 0xAA, 0xAA, 0xAA, 0x34, 0x80, 0x03, 0x8E,
+  0xFF, 0x84, 0x00, 0x00, 0xB1, 0x80, 0x03, 0x03, 0x83, 0x45, 0x55, 0x15, 0x95, 0x1F, 0x81, 0x00,
+  0x03, 0xC1, 0x11, 0x11, 0x1C, 0x90, 0x1F, 0x00, 0x33, 0x85, 0x03, 0x80, 0x1F, 0x8F, 0x7F, 0x06,
+  0x26, 0x66, 0x68, 0x33, 0x48, 0x88, 0x88, 0x95, 0x9F, 0x07, 0xF2, 0x22, 0x22, 0x24, 0x88, 0xBB,
+  0xBB, 0x22, 0x80, 0x1A, 0x00, 0x3F, 0x91, 0x1F, 0x81, 0x18, 0x81, 0x03, 0x00, 0x48, 0x94, 0x3F,
+  0x0F, 0x37, 0x55, 0x57, 0xD5, 0x37, 0x44, 0x55, 0x55, 0x37, 0x5B, 0x67, 0x5A, 0x37, 0x56, 0x36,
+  0x57, 0x8D, 0x1F, 0x08, 0x55, 0x54, 0x53, 0x33, 0x75, 0x44, 0x53, 0x33, 0x3A, 0x80, 0x07, 0x03,
+  0x33, 0x75, 0x5E, 0x38, 0x8E, 0x9F, 0x05, 0x33, 0x3A, 0xAA, 0x33, 0x33, 0x4A, 0x80, 0x03, 0x05,
+  0xAA, 0xAA, 0x33, 0x34, 0xAA, 0xAA, 0x99, 0xFF, 0x03, 0x1C, 0x83, 0x45, 0x55, 0x8D, 0x1F,
+};
+static const u8 ILLUSTRATION_MAP_skel_b[] = {
+  0x08, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x9A, 0x00, 0x7F, 0x20, 0x01, 0x20, 0x02, 0x20, 0x03, 0x40,
+  0x04, 0x40, 0x05, 0x40, 0x06, 0x60, 0x07, 0x20, 0x08, 0x00, 0x09, 0x20, 0x0A, 0x20, 0x0B, 0x20,
+  0x0C, 0x20, 0x0D, 0x40, 0x0E, 0x40, 0x0F, 0x40, 0x10, 0x40, 0x11, 0x20, 0x12, 0x00, 0x13, 0x20,
+  0x14, 0x20, 0x15, 0x20, 0x16, 0x20, 0x17, 0x40, 0x18, 0x40, 0x19, 0x40, 0x1A, 0x40, 0x1B, 0x20,
+  0x1C, 0x00, 0x1D, 0x00, 0x1E, 0x20, 0x1F, 0x20, 0x20, 0x20, 0x21, 0x00, 0x22, 0x40, 0x23, 0x40,
+  0x24, 0x40, 0x25, 0x20, 0x26, 0x00, 0x27, 0x00, 0x28, 0x20, 0x29, 0x20, 0x2A, 0x00, 0x2B, 0x00,
+  0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x20, 0x2F, 0x20, 0x30, 0x20, 0x31, 0x00, 0x32, 0x20, 0x33, 0x20,
+  0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x20, 0x39, 0x20, 0x3A, 0x20, 0x3B, 0x00,
+  0x3C, 0x20, 0x3D, 0x20, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x7F, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
+  0x20, 0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x48, 0x20, 0x49, 0x00, 0x4A, 0x00, 0x4B,
+  0x00, 0x4C, 0x00, 0x4D, 0x20, 0x4E, 0x20, 0x4F, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x00, 0x53,
+  0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x20, 0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5A, 0x20, 0x5B,
+  0x20, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60, 0x00, 0x61, 0x20, 0x62, 0x20, 0x63,
+  0x00, 0x64, 0x20, 0x65, 0x20, 0x66, 0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B,
+  0x20, 0x6C, 0x20, 0x6D, 0x20, 0x6E, 0x20, 0x6F, 0x20, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73,
+  0x00, 0x74, 0x00, 0x75, 0x20, 0x76, 0x20, 0x77, 0x20, 0x78, 0x60, 0x79, 0x60, 0x7A, 0x00, 0x7B,
+  0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E, 0x20, 0x7F, 0x20, 0x80, 0x7F, 0x20, 0x81, 0x00, 0x82, 0x60,
+  0x83, 0x60, 0x84, 0x00, 0x85, 0x00, 0x86, 0x00, 0x87, 0x00, 0x88, 0x20, 0x89, 0x20, 0x8A, 0x20,
+  0x8B, 0x20, 0x8C, 0x60, 0x8D, 0x60, 0x8E, 0x60, 0x8F, 0x00, 0x90, 0x00, 0x91, 0x00, 0x92, 0x40,
+  0x93, 0x20, 0x94, 0x20, 0x95, 0x20, 0x96, 0x60, 0x97, 0x60, 0x98, 0x60, 0x99, 0x00, 0x9A, 0x00,
+  0x9B, 0x00, 0x9C, 0x00, 0x9D, 0x20, 0x9E, 0x20, 0x9F, 0x20, 0xA0, 0x60, 0xA1, 0x60, 0xA2, 0x00,
+  0xA3, 0x00, 0xA4, 0x40, 0xA5, 0x40, 0xA6, 0x20, 0xA7, 0x20, 0xA8, 0x20, 0xA9, 0x60, 0xAA, 0x60,
+  0xAB, 0x60, 0xAC, 0x00, 0xAD, 0x00, 0xAE, 0x40, 0xAF, 0x40, 0xB0, 0x40, 0xB1, 0x20, 0xB2, 0x20,
+  0xB3, 0x60, 0xB4, 0x60, 0xB5, 0x60, 0xB6, 0x40, 0xB7, 0x60, 0xB8, 0x00, 0xB9, 0x40, 0xBA, 0x40,
+  0xBB, 0x20, 0xBC, 0x20, 0xBD, 0x20, 0xBE, 0x60, 0xBF, 0x60, 0xC0, 0x59, 0x00, 0xC1, 0x00, 0xC2,
+  0x00, 0xC3, 0x40, 0xC4, 0x40, 0xC5, 0x20, 0xC6, 0x20, 0xC7, 0x20, 0xC8, 0x60, 0xC9, 0x00, 0xCA,
+  0x00, 0xCB, 0x00, 0xCC, 0x40, 0xCD, 0x40, 0xCE, 0x00, 0xCF, 0x20, 0xD0, 0x60, 0xD1, 0x60, 0xD2,
+  0x60, 0xD3, 0x60, 0xD4, 0x00, 0xD5, 0x00, 0xD6, 0x40, 0xD7, 0x40, 0xD8, 0x40, 0xD9, 0x20, 0xDA,
+  0x60, 0xDB, 0x60, 0xDC, 0x20, 0xDD, 0x40, 0xDE, 0x20, 0xDD, 0x20, 0xDD, 0x60, 0xDF, 0x40, 0xE0,
+  0x40, 0xE1, 0x20, 0xE2, 0x20, 0xE3, 0x60, 0xE4, 0x60, 0xE5, 0x60, 0xE6, 0x00, 0xE7, 0x00, 0xE8,
+  0x00, 0xE9, 0x40, 0xEA, 0x40, 0xEB, 0x80, 0x3D, 0x24, 0xEC, 0x60, 0xED, 0x60, 0xEE, 0x60, 0xEF,
+  0x60, 0xF0, 0x40, 0xF1, 0x40, 0xF2, 0x40, 0xF3, 0x40, 0xF4, 0x60, 0xF5, 0x60, 0xF6, 0x60, 0xF7,
+  0x60, 0xF8, 0x60, 0xF9, 0x60, 0xFA, 0x00, 0xFB, 0x40, 0xFC, 0x40, 0xFD, 0x40, 0xFE, 0x80, 0x49,
+  0x3E, 0xFF, 0x41, 0x00, 0x41, 0x01, 0x41, 0x02, 0x41, 0x03, 0x21, 0x04, 0x61, 0x05, 0x41, 0x06,
+  0x41, 0x07, 0x41, 0x08, 0x61, 0x09, 0x61, 0x0A, 0x61, 0x0B, 0x61, 0x0C, 0x61, 0x0D, 0x61, 0x0E,
+  0x41, 0x0F, 0x41, 0x10, 0x41, 0x11, 0x41, 0x12, 0x61, 0x13, 0x61, 0x14, 0x01, 0x15, 0x01, 0x15,
+  0x61, 0x16, 0x41, 0x17, 0x41, 0x18, 0x41, 0x19, 0x41, 0x1A, 0x61, 0x1B, 0x61, 0x1C, 0x61, 0x1D,
+  0x82, 0x13, 0x0E, 0x1E, 0x41, 0x1F, 0x41, 0x20, 0x41, 0x21, 0x20, 0xDD, 0x61, 0x22, 0x41, 0x23,
+  0x21, 0x24, 0x80, 0x01, 0x02, 0x25, 0x21, 0x26, 0x82, 0x07, 0x0A, 0x24, 0x41, 0x27, 0x21, 0x28,
+  0x61, 0x29, 0x61, 0x2A, 0x61, 0x2B, 0x80, 0x27, 0x32, 0x2C, 0x61, 0x2D, 0x41, 0x2E, 0x41, 0x2F,
+  0x41, 0x30, 0x41, 0x31, 0x61, 0x32, 0x61, 0x33, 0x61, 0x34, 0x21, 0x35, 0x21, 0x36, 0x41, 0x37,
+  0x41, 0x38, 0x41, 0x39, 0x41, 0x3A, 0x21, 0x3B, 0x21, 0x3C, 0x21, 0x3D, 0x61, 0x3E, 0x21, 0x3F,
+  0x21, 0x40, 0x41, 0x41, 0x41, 0x42, 0x41, 0x43, 0x61, 0x44, 0x41, 0x45, 0x80, 0x49, 0x0C, 0x46,
+  0x21, 0x47, 0x21, 0x48, 0x21, 0x49, 0x21, 0x4A, 0x21, 0x4B, 0x21, 0x4C, 0x80, 0x51, 0x00, 0x4D,
+  0x80, 0x67, 0x7F, 0x4E, 0x21, 0x4F, 0x21, 0x50, 0x21, 0x51, 0x01, 0x52, 0x41, 0x53, 0x41, 0x54,
+  0x41, 0x55, 0x01, 0x56, 0x21, 0x57, 0x21, 0x58, 0x21, 0x59, 0x21, 0x5A, 0x01, 0x5B, 0x01, 0x5C,
+  0x01, 0x5D, 0x01, 0x5E, 0x21, 0x5F, 0x21, 0x60, 0x21, 0x61, 0x21, 0x62, 0x21, 0x63, 0x21, 0x64,
+  0x61, 0x65, 0x41, 0x66, 0x20, 0xDD, 0x41, 0x67, 0x41, 0x68, 0x21, 0x69, 0x21, 0x6A, 0x01, 0x6B,
+  0x01, 0x6C, 0x01, 0x6D, 0x01, 0x6E, 0x01, 0x6F, 0x01, 0x70, 0x01, 0x71, 0x21, 0x72, 0x41, 0x73,
+  0x41, 0x74, 0x21, 0x75, 0x21, 0x76, 0x21, 0x77, 0x21, 0x78, 0x01, 0x79, 0x01, 0x7A, 0x01, 0x7B,
+  0x01, 0x7C, 0x01, 0x7D, 0x21, 0x7E, 0x21, 0x7F, 0x21, 0x80, 0x21, 0x81, 0x01, 0x82, 0x01, 0x83,
+  0x01, 0x84, 0x01, 0x85, 0x21, 0x86, 0x21, 0x87, 0x21, 0x88, 0x01, 0x89, 0x21, 0x8A, 0x21, 0x8B,
+  0x41, 0x8C, 0x20, 0x04, 0xDD, 0x29, 0x2B, 0x61, 0x8D, 0x80, 0x9B, 0x04, 0x8E, 0x01, 0x8F, 0x00,
+  0xCF, 0x87, 0x01, 0x37, 0x01, 0x90, 0x01, 0x91, 0x21, 0x92, 0x21, 0x93, 0x41, 0x94, 0x41, 0x95,
+  0x21, 0x96, 0x61, 0x97, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9A, 0x01, 0x9B, 0x21, 0x9C, 0x21, 0x9D,
+  0x21, 0x9E, 0x61, 0x9F, 0x61, 0xA0, 0x01, 0xA1, 0x01, 0xA2, 0x01, 0xA3, 0x01, 0xA4, 0x21, 0xA5,
+  0x21, 0xA6, 0x21, 0xA7, 0x21, 0xA8, 0x61, 0xA9, 0x21, 0xAA, 0x41, 0xAB, 0x80, 0x9D, 0x14, 0xAC,
+  0x21, 0xAD, 0x21, 0xAE, 0x01, 0xAF, 0x01, 0xB0, 0x01, 0xB1, 0x01, 0xB2, 0x01, 0xB3, 0x01, 0xB4,
+  0x01, 0xB5, 0x01, 0xB6, 0x80, 0x51, 0x32, 0xB7, 0x01, 0xB8, 0x21, 0xB9, 0x41, 0xBA, 0x41, 0xBB,
+  0x21, 0xBC, 0x61, 0xBD, 0x01, 0xBE, 0x01, 0xBF, 0x01, 0xC0, 0x01, 0xC1, 0x21, 0xC2, 0x21, 0xC3,
+  0x21, 0xC4, 0x61, 0xC5, 0x61, 0xC6, 0x01, 0xC7, 0x01, 0xC8, 0x41, 0xC9, 0x41, 0xCA, 0x21, 0xCB,
+  0x21, 0xCC, 0x21, 0xCD, 0x61, 0xCE, 0x61, 0xCF, 0x61, 0xD0, 0x80, 0x4D, 0x08, 0xD1, 0x41, 0xD2,
+  0x21, 0xD3, 0x01, 0xD4, 0x01, 0xD5, 0x80, 0x41, 0x0A, 0xD6, 0x01, 0xD7, 0x01, 0xD8, 0x01, 0xD9,
+  0x01, 0xDA, 0x01, 0xDB, 0x82, 0xA3, 0x2E, 0xDC, 0x01, 0xDD, 0x21, 0xDE, 0x41, 0xDF, 0x41, 0xE0,
+  0x41, 0xE1, 0x41, 0xE2, 0x61, 0xE3, 0x41, 0xE4, 0x41, 0xE5, 0x21, 0xE6, 0x21, 0xE7, 0x21, 0xE8,
+  0x61, 0xE9, 0x61, 0xEA, 0x01, 0xEB, 0x01, 0xEC, 0x41, 0xED, 0x41, 0xEE, 0x61, 0xEF, 0x21, 0xF0,
+  0x61, 0xF1, 0x61, 0xF2, 0x61, 0xF3, 0x80, 0x4D, 0x08, 0xF4, 0x61, 0xF5, 0x21, 0xF6, 0x01, 0xF7,
+  0x01, 0xF8, 0x87, 0xE9, 0x03, 0x21, 0xF9, 0x01, 0xFA, 0x86, 0xF5, 0x4E, 0xFB, 0x61, 0xFC, 0x21,
+  0xFD, 0x41, 0xFE, 0x41, 0xFF, 0x62, 0x00, 0x20, 0xDD, 0x20, 0xDD, 0x42, 0x01, 0x22, 0x02, 0x22,
+  0x03, 0x62, 0x04, 0x62, 0x05, 0x62, 0x06, 0x62, 0x07, 0x42, 0x08, 0x42, 0x09, 0x42, 0x0A, 0x42,
+  0x0B, 0x62, 0x0C, 0x62, 0x0D, 0x62, 0x0E, 0x62, 0x0F, 0x42, 0x10, 0x22, 0x11, 0x21, 0x24, 0x22,
+  0x12, 0x11, 0xF7, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02,
+  0x19, 0x02, 0x1A, 0x02, 0x1B, 0x62, 0x1C, 0x62, 0x1D, 0x02, 0x1E, 0x81, 0x0B, 0x09, 0x62, 0x1F,
+  0x01, 0x71, 0x22, 0x20, 0x42, 0x21, 0x42, 0x22, 0x82, 0x51, 0x16, 0x23, 0x62, 0x24, 0x62, 0x25,
+  0x01, 0x15, 0x01, 0x15, 0x62, 0x26, 0x42, 0x27, 0x42, 0x28, 0x42, 0x29, 0x42, 0x2A, 0x62, 0x2B,
+  0x62, 0x2C, 0x80, 0x19, 0x02, 0x2D, 0x22, 0x2E, 0x80, 0x4D, 0x14, 0x2F, 0x22, 0x30, 0x22, 0x31,
+  0x22, 0x32, 0x22, 0x33, 0x22, 0x34, 0x22, 0x35, 0x22, 0x36, 0x22, 0x37, 0x22, 0x38, 0x01, 0x71,
+  0x85, 0x01, 0x11, 0x22, 0x39, 0x2A, 0x38, 0x22, 0x3A, 0x22, 0x3B, 0x22, 0x3C, 0x21, 0x24, 0x42,
+  0x3D, 0x42, 0x3E, 0x42, 0x3F, 0x81, 0x53, 0x0B, 0x62, 0x40, 0x22, 0x41, 0x22, 0x42, 0x62, 0x43,
+  0x42, 0x44, 0x42, 0x45, 0x81, 0x0F, 0x82, 0x67, 0x08, 0x46, 0x62, 0x47, 0x42, 0x48, 0x42, 0x49,
+  0x21, 0x24, 0x80, 0x29, 0x22, 0x4A, 0x42, 0x4B, 0x42, 0x4C, 0x42, 0x4D, 0x42, 0x4E, 0x42, 0x4F,
+  0x42, 0x50, 0x42, 0x51, 0x42, 0x52, 0x42, 0x53, 0x42, 0x54, 0x22, 0x55, 0x39, 0x25, 0x42, 0x56,
+  0x62, 0x57, 0x22, 0x58, 0x62, 0x59, 0x42, 0x5A, 0x82, 0x27, 0x02, 0x51, 0x42, 0x5B, 0x82, 0x4F,
+  0x0C, 0x5C, 0x22, 0x5D, 0x22, 0x5E, 0x02, 0x5F, 0x02, 0x60, 0x62, 0x61, 0x42, 0x62, 0x85, 0x51,
+  0x82, 0x55, 0x00, 0x63, 0x89, 0x0D, 0x82, 0x2B, 0x0E, 0x64, 0x42, 0x65, 0x62, 0x66, 0x42, 0x67,
+  0x42, 0x68, 0x42, 0x69, 0x42, 0x6A, 0x58, 0xDE, 0x84, 0x15, 0x7F, 0x6B, 0x62, 0x6C, 0x62, 0x6D,
+  0x42, 0x6E, 0x62, 0x6F, 0x62, 0x70, 0x62, 0x71, 0x22, 0x72, 0x22, 0x73, 0x22, 0x74, 0x02, 0x75,
+  0x02, 0x76, 0x02, 0x77, 0x62, 0x78, 0x62, 0x79, 0x22, 0x7A, 0x22, 0x7B, 0x22, 0x7C, 0x22, 0x7D,
+  0x22, 0x7E, 0x42, 0x7F, 0x42, 0x80, 0x42, 0x81, 0x62, 0x82, 0x62, 0x83, 0x22, 0x84, 0x62, 0x85,
+  0x22, 0x86, 0x62, 0x87, 0x22, 0x88, 0x62, 0x89, 0x42, 0x8A, 0x42, 0x8B, 0x42, 0x8C, 0x62, 0x8D,
+  0x62, 0x8E, 0x62, 0x8F, 0x22, 0x90, 0x22, 0x91, 0x22, 0x92, 0x62, 0x93, 0x42, 0x94, 0x02, 0x95,
+  0x02, 0x96, 0x02, 0x97, 0x22, 0x98, 0x22, 0x99, 0x22, 0x9A, 0x22, 0x9B, 0x22, 0x9C, 0x02, 0x9D,
+  0x02, 0x9E, 0x02, 0x9F, 0x02, 0xA0, 0x22, 0xA1, 0x22, 0xA2, 0x22, 0xA3, 0x22, 0xA4, 0x62, 0xA5,
+  0x22, 0xA6, 0x02, 0xA7, 0x02, 0xA8, 0x02, 0xA9, 0x02, 0xAA, 0x02, 0x7F, 0xAB, 0x22, 0xAC, 0x22,
+  0xAD, 0x22, 0xAE, 0x62, 0xAF, 0x22, 0xB0, 0x02, 0xB1, 0x02, 0xB2, 0x02, 0xB3, 0x02, 0xB4, 0x02,
+  0xB5, 0x22, 0xB6, 0x22, 0xB7, 0x22, 0xB8, 0x62, 0xB9, 0x22, 0xBA, 0x62, 0xBB, 0x02, 0xBC, 0x02,
+  0xBD, 0x02, 0xBE, 0x02, 0xBF, 0x22, 0xC0, 0x22, 0xC1, 0x22, 0xC2, 0x62, 0xC3, 0x62, 0xC4, 0x02,
+  0xC5, 0x02, 0xC6, 0x42, 0xC7, 0x42, 0xC8, 0x22, 0xC9, 0x22, 0xCA, 0x22, 0xCB, 0x62, 0xCC, 0x62,
+  0xCD, 0x62, 0xCE, 0x02, 0xCF, 0x02, 0xD0, 0x42, 0xD1, 0x42, 0xD2, 0x62, 0xD3, 0x22, 0xD4, 0x22,
+  0xD5, 0x62, 0xD6, 0x62, 0xD7, 0x62, 0xD8, 0x02, 0xD9, 0x02, 0xDA, 0x02, 0xDB, 0x42, 0xDC, 0x42,
+  0xDD, 0x22, 0xDE, 0x22, 0xDF, 0x22, 0xE0, 0x62, 0xE1, 0x62, 0xE2, 0x62, 0xE3, 0x02, 0xE4, 0x02,
+  0xE5, 0x42, 0xE6, 0x42, 0xE7, 0x22, 0xE8, 0x22, 0xE9, 0x22, 0xEA, 0x62, 0x7F, 0xEB, 0x62, 0xEC,
+  0x02, 0xED, 0x02, 0xEE, 0x42, 0xEF, 0x42, 0xF0, 0x02, 0xF1, 0x22, 0xF2, 0x62, 0xF3, 0x62, 0xF4,
+  0x62, 0xF5, 0x62, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x42, 0xF9, 0x42, 0xFA, 0x02, 0xFB, 0x22, 0xFC,
+  0x22, 0xFD, 0x62, 0xFE, 0x62, 0xFF, 0x63, 0x00, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x43, 0x04,
+  0x43, 0x05, 0x03, 0x06, 0x23, 0x07, 0x63, 0x08, 0x63, 0x09, 0x63, 0x0A, 0x03, 0x0B, 0x03, 0x0C,
+  0x03, 0x0D, 0x43, 0x0E, 0x43, 0x0F, 0x23, 0x10, 0x23, 0x11, 0x23, 0x12, 0x63, 0x13, 0x03, 0x14,
+  0x03, 0x15, 0x03, 0x16, 0x43, 0x17, 0x43, 0x18, 0x03, 0x19, 0x03, 0x1A, 0x63, 0x1B, 0x63, 0x1C,
+  0x63, 0x1D, 0x03, 0x1E, 0x03, 0x1F, 0x03, 0x20, 0x43, 0x21, 0x43, 0x22, 0x03, 0x23, 0x03, 0x24,
+  0x63, 0x25, 0x63, 0x26, 0x63, 0x27, 0x63, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x18, 0x2B, 0x43,
+  0x2C, 0x43, 0x2D, 0x03, 0x2E, 0x03, 0x2F, 0x63, 0x30, 0x63, 0x31, 0x63, 0x32, 0x03, 0x33, 0x03,
+  0x34, 0x03, 0x35, 0x43, 0x36, 0x43, 0x37, 0x80, 0x13, 0x03, 0x38, 0x63, 0x39, 0x00, 0xFF, 0x00,
+  0xEA, 0x00,
+};
+
+// ---- skel_c: ../content/images/skel-test-01257.bmp, 829 tiles (829 unique, 0 cells flipped), 21379 bytes packed ----
+static const u16 ILLUSTRATION_PALETTES_skel_c[64] = {
+  0x000, 0xEEE, 0x886, 0x028, 0x222, 0x86A, 0x646, 0x868, 0x664, 0x444, 0x424, 0x442, 0x648, 0x8A6, 0x884, 0x048,
+  0x000, 0x686, 0x222, 0xEEE, 0x028, 0x464, 0x68A, 0x444, 0x668, 0x688, 0x242, 0x886, 0x484, 0x466, 0x446, 0x224,
+  0x000, 0x868, 0x222, 0x646, 0xA68, 0x686, 0x424, 0x444, 0x86A, 0x866, 0x644, 0x846, 0x422, 0x464, 0x68A, 0x468,
+  0x000, 0xEEE, 0x666, 0x028, 0x222, 0xAAA, 0xCCC, 0x888, 0x444, 0x868, 0x048, 0x886, 0x646, 0x46A, 0x248, 0x424,
+};
+static const u8 ILLUSTRATION_TILES_skel_c[] = {
+  0x67, 0xA0, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x22, 0x8B, 0x00, 0x13, 0x7D, 0x22, 0x22, 0x2E, 0x99,
+  0x22, 0x22, 0x79, 0x66, 0x22, 0x22, 0x8E, 0x78, 0x22, 0x2D, 0xE2, 0x2D, 0xAA, 0xAA, 0xAA, 0x86,
+  0x1C, 0x13, 0x89, 0x98, 0x8D, 0x72, 0x99, 0x99, 0x99, 0x68, 0x66, 0x66, 0x99, 0x66, 0x66, 0x8D,
+  0x89, 0x96, 0x98, 0x22, 0x29, 0x96, 0x8C, 0x3F, 0x01, 0x22, 0xE2, 0x80, 0x03, 0x00, 0x6E, 0x80,
+  0x03, 0x00, 0x6D, 0x80, 0x03, 0x00, 0x97, 0x80, 0x03, 0x04, 0x26, 0x11, 0x44, 0x44, 0x22, 0x81,
+  0x03, 0x00, 0xA1, 0x80, 0x03, 0x00, 0x29, 0x80, 0x03, 0x02, 0x2C, 0x91, 0x44, 0x80, 0x15, 0x00,
+  0x3B, 0x85, 0x2F, 0x0B, 0x96, 0x22, 0x23, 0x44, 0x11, 0x9B, 0x11, 0x44, 0x11, 0x44, 0x14, 0x44,
+  0x81, 0x00, 0x07, 0x14, 0x44, 0x14, 0x14, 0x11, 0x11, 0xBB, 0x36, 0x85, 0x1F, 0x82, 0x14, 0x81,
+  0x00, 0x08, 0x11, 0x41, 0x1B, 0x14, 0x11, 0xB7, 0xC2, 0x1B, 0xAC, 0x8B, 0x6F, 0x11, 0x11, 0x1C,
+  0x22, 0x22, 0x1B, 0xC2, 0x22, 0x75, 0x72, 0x22, 0x75, 0x55, 0x22, 0x27, 0x55, 0x55, 0x22, 0x25,
+  0x80, 0x03, 0x07, 0xD5, 0x5D, 0x5D, 0x22, 0x55, 0x22, 0x22, 0x29, 0x80, 0x03, 0x01, 0xA5, 0x11,
+  0x93, 0x00, 0x00, 0x2A, 0x80, 0x03, 0x01, 0x22, 0x27, 0x81, 0x09, 0x01, 0x57, 0x22, 0x80, 0x04,
+  0x00, 0x15, 0x94, 0x26, 0x00, 0x11, 0x81, 0x63, 0x00, 0x52, 0x81, 0x67, 0x00, 0x17, 0x80, 0x03,
+  0x01, 0x11, 0x1A, 0x81, 0x2B, 0x00, 0x72, 0x80, 0x03, 0x00, 0x17, 0x89, 0x1F, 0x8C, 0x00, 0x00,
+  0x2E, 0x80, 0x03, 0x0C, 0x79, 0xA2, 0x22, 0x22, 0x8E, 0x52, 0x22, 0x2D, 0xE2, 0x22, 0x77, 0x77,
+  0x7A, 0x85, 0x18, 0x05, 0x7D, 0x89, 0x98, 0xDD, 0x96, 0x66, 0x83, 0x00, 0x07, 0x78, 0x96, 0x8D,
+  0x86, 0x2D, 0x98, 0x22, 0x29, 0x89, 0x38, 0x00, 0x72, 0x80, 0x03, 0x05, 0x98, 0xE2, 0x22, 0x22,
+  0x66, 0x9E, 0x80, 0x03, 0x00, 0x9D, 0x80, 0x03, 0x00, 0x97, 0x80, 0x10, 0x02, 0x26, 0x14, 0x44,
+  0x80, 0x79, 0x80, 0x03, 0x00, 0xA1, 0x80, 0x03, 0x00, 0x29, 0x80, 0x03, 0x01, 0x2C, 0x91, 0x81,
+  0x15, 0x85, 0x33, 0x0A, 0x44, 0x1C, 0x22, 0x23, 0x44, 0x11, 0x9B, 0x11, 0x44, 0x44, 0x44, 0x81,
+  0x03, 0x08, 0x44, 0x14, 0x14, 0x44, 0x41, 0x33, 0x11, 0x11, 0xBB, 0x86, 0x1F, 0x86, 0x00, 0x01,
+  0x11, 0x41, 0x80, 0x03, 0x05, 0xB7, 0x11, 0x13, 0xAC, 0x22, 0xA6, 0x88, 0x73, 0x00, 0x44, 0x80,
+  0x40, 0x0E, 0x44, 0x1B, 0xC2, 0x22, 0x1B, 0x72, 0x22, 0x75, 0xC2, 0x22, 0x27, 0x55, 0x22, 0x22,
+  0x25, 0x80, 0x03, 0x01, 0xD5, 0x5D, 0x82, 0x0A, 0x00, 0x29, 0x80, 0x03, 0x03, 0xA5, 0x11, 0x11,
+  0x71, 0x85, 0xEC, 0x84, 0x00, 0x01, 0x1C, 0xC1, 0x80, 0xF7, 0x00, 0x2A, 0x81, 0xFB, 0x00, 0x25,
+  0x81, 0x0E, 0x00, 0x57, 0x8C, 0x1E, 0x8A, 0x00, 0x81, 0x63, 0x01, 0x15, 0x52, 0x80, 0xC1, 0x01,
+  0x11, 0x17, 0x80, 0x03, 0x01, 0x11, 0x1A, 0x91, 0x1F, 0x89, 0x00, 0x00, 0x72, 0x80, 0x03, 0x00,
+  0x17, 0x80, 0x03, 0x01, 0x11, 0xA2, 0x80, 0x03, 0x06, 0x52, 0x22, 0x2D, 0x22, 0x22, 0x77, 0x77,
+  0x86, 0x1C, 0x07, 0x7D, 0x89, 0x98, 0x2E, 0x99, 0x66, 0x66, 0x79, 0x80, 0x03, 0x08, 0x8E, 0x78,
+  0x69, 0x8D, 0xE2, 0x2D, 0x98, 0x22, 0x7A, 0x88, 0x3B, 0x00, 0xDD, 0x80, 0x3C, 0x0E, 0x66, 0x68,
+  0xE2, 0x22, 0x66, 0x66, 0x9E, 0x22, 0x89, 0x66, 0x6D, 0x22, 0x29, 0x66, 0x97, 0x80, 0x15, 0x00,
+  0x26, 0x81, 0x63, 0x81, 0x03, 0x00, 0xA1, 0x80, 0x03, 0x00, 0x29, 0x80, 0x03, 0x00, 0x2C, 0x89,
+  0x6F, 0x82, 0xFF, 0x03, 0x44, 0x41, 0x9B, 0x44, 0x84, 0x00, 0x05, 0x91, 0x14, 0x44, 0x44, 0x26,
+  0x3B, 0x87, 0x97, 0x00, 0x23, 0x80, 0x13, 0x00, 0x11, 0x83, 0x1A, 0x81, 0x06, 0x07, 0x11, 0x44,
+  0x11, 0x1B, 0xAC, 0xBB, 0xA6, 0xC2, 0x88, 0x3F, 0x0D, 0x11, 0x1C, 0x44, 0x44, 0x1B, 0xC2, 0x11,
+  0x1B, 0x72, 0x22, 0xB7, 0xC2, 0x22, 0x27, 0x80, 0x12, 0x00, 0x25, 0x80, 0x03, 0x04, 0xD5, 0x22,
+  0x22, 0x27, 0x55, 0x80, 0x6E, 0x80, 0x03, 0x06, 0xA5, 0x11, 0x22, 0x71, 0x11, 0x11, 0xA1, 0x88,
+  0xF3, 0x02, 0x15, 0x1C, 0xC1, 0x80, 0xDE, 0x00, 0x2A, 0x81, 0x63, 0x00, 0x27, 0x88, 0x16, 0x92,
+  0x00, 0x00, 0x57, 0x81, 0xBC, 0x02, 0x15, 0x52, 0x22, 0x80, 0x0A, 0x00, 0x17, 0x91, 0x1F, 0x89,
+  0xCB, 0x00, 0x1A, 0x81, 0x2B, 0x00, 0x72, 0x80, 0x03, 0x00, 0x17, 0x80, 0x03, 0x80, 0x61, 0x02,
+  0x11, 0x11, 0x52, 0x81, 0x16, 0x00, 0xAA, 0x87, 0x21, 0x12, 0x7D, 0x89, 0x22, 0x2E, 0x99, 0x66,
+  0x22, 0x79, 0x96, 0x66, 0x22, 0x8E, 0x78, 0x96, 0x2D, 0xE2, 0x2D, 0x98, 0xAA, 0x88, 0x1D, 0x13,
+  0x88, 0xDD, 0x72, 0x22, 0x66, 0x66, 0x68, 0xE2, 0x66, 0x66, 0x69, 0x9E, 0x8D, 0x89, 0x66, 0x6D,
+  0x22, 0x29, 0x99, 0x97, 0x80, 0xF3, 0x00, 0x4A, 0x83, 0xFE, 0x93, 0x00, 0x03, 0x11, 0x44, 0x44,
+  0x16, 0x80, 0x03, 0x0F, 0x11, 0xA1, 0x44, 0x44, 0x14, 0x29, 0x14, 0x44, 0x44, 0x2C, 0x91, 0x14,
+  0x14, 0x22, 0x26, 0x3B, 0x87, 0x97, 0x04, 0x23, 0x11, 0x44, 0x9B, 0x11, 0x80, 0x21, 0x81, 0x29,
+  0x81, 0x00, 0x05, 0x14, 0x11, 0x13, 0x11, 0xBB, 0xA6, 0x86, 0x1E, 0x81, 0x11, 0x80, 0x03, 0x09,
+  0x1B, 0x11, 0x41, 0x1B, 0x72, 0x11, 0xB7, 0xC2, 0x22, 0xAC, 0x89, 0xD0, 0x0F, 0x22, 0x22, 0x29,
+  0x82, 0x22, 0x22, 0xA5, 0x22, 0x22, 0x71, 0x11, 0x22, 0xA1, 0x11, 0x11, 0x27, 0x80, 0xEF, 0x00,
+  0x21, 0x80, 0x03, 0x03, 0x51, 0x15, 0x1C, 0xC1, 0x80, 0xDE, 0x00, 0x2A, 0x81, 0x64, 0x80, 0x0E,
+  0x96, 0x00, 0x00, 0x25, 0x81, 0x04, 0x00, 0x57, 0x81, 0x23, 0x01, 0x15, 0x52, 0x95, 0x23, 0x15,
+  0x22, 0x79, 0xE2, 0x28, 0x22, 0xE9, 0x8F, 0xE9, 0x22, 0xE9, 0x69, 0x96, 0x22, 0x28, 0x99, 0x66,
+  0x22, 0x27, 0x9F, 0x79, 0xA2, 0x2F, 0x81, 0x03, 0x09, 0x99, 0x99, 0xA2, 0x2F, 0x68, 0xF8, 0x9F,
+  0x22, 0x28, 0x66, 0x80, 0x03, 0x30, 0x9D, 0x9D, 0x7E, 0xDE, 0x72, 0x66, 0x99, 0x72, 0x22, 0x98,
+  0x89, 0xF2, 0x22, 0x82, 0x79, 0x22, 0x22, 0x97, 0xE9, 0x22, 0x22, 0x96, 0x69, 0x22, 0x27, 0x84,
+  0x44, 0x4A, 0x96, 0x44, 0x4A, 0xC7, 0x77, 0x44, 0x67, 0x77, 0x77, 0x49, 0x77, 0x55, 0x55, 0xA7,
+  0x75, 0x55, 0x55, 0x67, 0x55, 0x55, 0x55, 0x80, 0x06, 0x0C, 0x7C, 0x77, 0x77, 0x7C, 0x94, 0xCC,
+  0xCC, 0xCC, 0x66, 0x77, 0x77, 0x55, 0x57, 0x80, 0x12, 0x81, 0x00, 0x13, 0x57, 0x57, 0x6C, 0x77,
+  0x74, 0x7A, 0x44, 0x77, 0xC4, 0xA4, 0x44, 0x65, 0xC4, 0x44, 0x44, 0x67, 0xC4, 0x33, 0x37, 0x62,
+  0x81, 0xC3, 0x05, 0x32, 0x88, 0x88, 0x81, 0x11, 0x88, 0x80, 0x04, 0x04, 0x21, 0x88, 0x18, 0x88,
+  0x26, 0x80, 0x09, 0x08, 0x22, 0x61, 0x18, 0x88, 0x22, 0x2C, 0x31, 0x81, 0x44, 0x84, 0x00, 0x00,
+  0x94, 0x80, 0x03, 0x00, 0x76, 0x80, 0x03, 0x00, 0x57, 0x80, 0x35, 0x01, 0x55, 0x56, 0x80, 0x03,
+  0x0B, 0x57, 0x94, 0x44, 0x55, 0x55, 0xC4, 0x44, 0x21, 0x11, 0x22, 0x22, 0x51, 0x80, 0x03, 0x00,
+  0xD1, 0x82, 0x07, 0x00, 0x72, 0x80, 0x03, 0x00, 0x12, 0x80, 0x03, 0x00, 0x11, 0x81, 0x03, 0x01,
+  0xC2, 0x71, 0x81, 0xDF, 0x01, 0x22, 0xA1, 0x80, 0x03, 0x01, 0x22, 0x51, 0x80, 0x03, 0x00, 0x2A,
+  0x80, 0x03, 0x8A, 0x00, 0x03, 0x15, 0x77, 0x75, 0x15, 0x80, 0x22, 0x86, 0x00, 0x04, 0x25, 0x11,
+  0x11, 0x17, 0x22, 0x80, 0x3F, 0x04, 0x22, 0x11, 0xC2, 0x22, 0x71, 0x80, 0x03, 0x80, 0x42, 0x81,
+  0x9B, 0x80, 0x00, 0x05, 0x15, 0x71, 0x11, 0x55, 0x72, 0x27, 0x8D, 0x3F, 0x81, 0x00, 0x24, 0x1A,
+  0x22, 0x79, 0xE2, 0x15, 0x22, 0xE9, 0x8F, 0x11, 0x22, 0xE6, 0x99, 0x11, 0x22, 0x28, 0x69, 0xA1,
+  0x22, 0x27, 0x9F, 0x21, 0xA2, 0x2F, 0x97, 0x25, 0xA2, 0x2F, 0x99, 0x2A, 0xA2, 0x2F, 0x9D, 0x28,
+  0x6F, 0x22, 0x28, 0xE9, 0x80, 0x03, 0x25, 0x99, 0x6D, 0xEE, 0xDE, 0x66, 0x66, 0x99, 0x72, 0x79,
+  0x68, 0x89, 0x22, 0x79, 0x82, 0x79, 0x22, 0x96, 0x97, 0xD8, 0x22, 0xF8, 0x99, 0x68, 0x22, 0xEE,
+  0xD2, 0x22, 0x26, 0x53, 0x22, 0x26, 0x31, 0x72, 0x22, 0x31, 0x11, 0x22, 0x27, 0x80, 0xAF, 0x04,
+  0x61, 0x11, 0x88, 0x22, 0x31, 0x80, 0xFF, 0x02, 0x11, 0x88, 0x18, 0x80, 0x0E, 0x08, 0x1B, 0x96,
+  0xCC, 0xCC, 0xCC, 0x77, 0x77, 0x55, 0x55, 0x81, 0x03, 0x81, 0x00, 0x14, 0x77, 0x77, 0x6C, 0x77,
+  0x77, 0x7A, 0x44, 0x75, 0x77, 0xA4, 0x44, 0x67, 0x94, 0x44, 0x44, 0x67, 0x66, 0x66, 0x69, 0xA4,
+  0x77, 0x81, 0x00, 0x81, 0x21, 0x80, 0x06, 0x05, 0x74, 0x47, 0x77, 0x77, 0xC4, 0x44, 0x81, 0x03,
+  0x00, 0xA7, 0x80, 0x03, 0x02, 0x44, 0x67, 0x44, 0x80, 0x00, 0x00, 0x64, 0x80, 0x03, 0x00, 0x77,
+  0x80, 0x2C, 0x04, 0x55, 0x76, 0x44, 0x44, 0x57, 0x80, 0x15, 0x02, 0x55, 0x77, 0x76, 0x80, 0x03,
+  0x01, 0x77, 0x94, 0x80, 0x4E, 0x06, 0xC4, 0x22, 0x21, 0x11, 0x22, 0x22, 0x51, 0x80, 0x03, 0x00,
+  0xD1, 0x82, 0x03, 0x00, 0x72, 0x80, 0x0B, 0x00, 0x12, 0x80, 0x03, 0x00, 0x1C, 0x80, 0x03, 0x02,
+  0x11, 0x22, 0x71, 0x80, 0x03, 0x02, 0x22, 0x22, 0xA1, 0x91, 0xF7, 0x00, 0xC2, 0x80, 0x03, 0x04,
+  0x11, 0x15, 0x55, 0x55, 0x11, 0x80, 0x00, 0x80, 0x2A, 0x00, 0x11, 0x80, 0xAB, 0x02, 0x11, 0x22,
+  0x25, 0x81, 0x2F, 0x80, 0x3F, 0x02, 0x22, 0x11, 0xC2, 0x80, 0x3B, 0x04, 0xC2, 0x15, 0x11, 0x11,
+  0xC2, 0x81, 0x1F, 0x80, 0x00, 0x80, 0x0A, 0x02, 0x55, 0xA2, 0x17, 0x90, 0x47, 0x0F, 0x11, 0x1A,
+  0x22, 0x79, 0x71, 0x15, 0x22, 0xE9, 0x27, 0x11, 0x22, 0xE6, 0x22, 0x11, 0x22, 0x28, 0x80, 0x6D,
+  0x06, 0x27, 0x22, 0x21, 0xA2, 0x2F, 0x22, 0x25, 0x80, 0x03, 0x3A, 0x27, 0xA2, 0x2F, 0xE2, 0x28,
+  0x9F, 0x22, 0x8F, 0xE9, 0x9F, 0x22, 0x69, 0x99, 0x6D, 0x7E, 0x66, 0x99, 0x96, 0x99, 0x9F, 0x79,
+  0x68, 0x86, 0x9F, 0x79, 0x82, 0x79, 0x99, 0x96, 0x97, 0xE9, 0x9D, 0xF8, 0x99, 0x99, 0x21, 0xE5,
+  0xD2, 0x22, 0x21, 0xE3, 0x22, 0x26, 0xD3, 0x72, 0x22, 0x31, 0x72, 0x22, 0x27, 0x11, 0x62, 0x22,
+  0x61, 0x18, 0x22, 0x22, 0x31, 0x88, 0x80, 0x59, 0x0B, 0x88, 0x22, 0x27, 0x18, 0x11, 0x4A, 0x96,
+  0xCC, 0xCC, 0xC7, 0x77, 0x55, 0x80, 0xEE, 0x81, 0x00, 0x82, 0x07, 0x12, 0x6C, 0x77, 0x77, 0x7A,
+  0x44, 0x77, 0x7C, 0xA4, 0x44, 0x7C, 0x94, 0x44, 0x44, 0xCC, 0x66, 0x66, 0x69, 0x77, 0x75, 0x80,
+  0x15, 0x01, 0x75, 0x55, 0x83, 0x24, 0x0A, 0x74, 0x47, 0x77, 0x77, 0xC4, 0x4A, 0x77, 0x65, 0xC4,
+  0x44, 0xA7, 0x80, 0x03, 0x23, 0x44, 0xA4, 0x44, 0x44, 0x44, 0x77, 0x64, 0x44, 0x44, 0x57, 0x77,
+  0x94, 0x44, 0x55, 0x77, 0x76, 0x44, 0x55, 0x57, 0x77, 0xC4, 0x55, 0x57, 0x55, 0x56, 0x57, 0x57,
+  0x55, 0x77, 0x67, 0x57, 0x55, 0x55, 0x22, 0x22, 0x21, 0x80, 0xF3, 0x00, 0x51, 0x80, 0x03, 0x00,
+  0xD1, 0x8A, 0x03, 0x00, 0x72, 0x80, 0x13, 0x02, 0x82, 0x22, 0x71, 0x80, 0x0B, 0x87, 0x00, 0x00,
+  0x72, 0x80, 0x03, 0x00, 0x12, 0x80, 0x03, 0x00, 0x1C, 0x81, 0xF7, 0x00, 0xC2, 0x80, 0x03, 0x06,
+  0x11, 0x15, 0x55, 0xA1, 0x11, 0x11, 0x11, 0x80, 0x2A, 0x02, 0x11, 0x22, 0x2A, 0x80, 0x03, 0x01,
+  0x22, 0x25, 0x81, 0x2F, 0x84, 0x03, 0x03, 0x71, 0x11, 0x55, 0x15, 0x80, 0x1C, 0x87, 0x00, 0x02,
+  0x55, 0x11, 0x17, 0x83, 0x3F, 0x80, 0x3A, 0x86, 0x03, 0x09, 0x11, 0x11, 0x1A, 0x22, 0x15, 0x71,
+  0x15, 0x22, 0x72, 0x27, 0x85, 0x3A, 0x00, 0xA1, 0x80, 0x03, 0x01, 0x21, 0xA2, 0x80, 0x4B, 0x80,
+  0x03, 0x4B, 0x2A, 0xA2, 0x79, 0xE2, 0x28, 0x9F, 0xE9, 0x8F, 0xE9, 0x6F, 0xE9, 0x99, 0x99, 0x9D,
+  0x28, 0x69, 0x99, 0x99, 0x27, 0x9F, 0x79, 0x98, 0x2F, 0x9F, 0x79, 0x82, 0x2F, 0x99, 0x99, 0x97,
+  0x2F, 0x68, 0xF8, 0x69, 0x22, 0x28, 0x69, 0xD2, 0x22, 0x28, 0x9E, 0x22, 0x7E, 0xDE, 0x72, 0x22,
+  0x69, 0x72, 0x22, 0x27, 0x89, 0x22, 0x22, 0xF8, 0x79, 0x22, 0x22, 0xE8, 0xD8, 0x22, 0x22, 0x88,
+  0x98, 0x22, 0x27, 0x88, 0x44, 0x4A, 0x96, 0x77, 0x4A, 0xC7, 0x75, 0x77, 0x67, 0x77, 0x87, 0x00,
+  0x0F, 0x55, 0x55, 0x57, 0x7A, 0x57, 0x57, 0x77, 0xA4, 0x77, 0x7C, 0x94, 0x44, 0xCC, 0xCC, 0x66,
+  0x66, 0x85, 0x16, 0x81, 0x04, 0x09, 0x6C, 0x77, 0x74, 0x47, 0x44, 0x77, 0xC4, 0x44, 0x44, 0x67,
+  0x83, 0x03, 0x01, 0x37, 0x62, 0x81, 0xA3, 0x00, 0x32, 0x80, 0x03, 0x01, 0x11, 0x72, 0x80, 0x03,
+  0x10, 0x13, 0x18, 0x11, 0x88, 0x81, 0x11, 0x18, 0x88, 0x88, 0x61, 0x88, 0x88, 0x88, 0x2C, 0x31,
+  0x88, 0x88, 0x80, 0xAC, 0x00, 0x25, 0x80, 0x03, 0x00, 0xD5, 0x85, 0x03, 0x00, 0xB2, 0x80, 0x03,
+  0x00, 0x13, 0x80, 0x03, 0x07, 0x81, 0x72, 0x22, 0xD5, 0x88, 0xB2, 0x22, 0x75, 0x85, 0xD5, 0x82,
+  0x03, 0x00, 0x72, 0x80, 0x03, 0x00, 0x12, 0x81, 0x4F, 0x81, 0x03, 0x00, 0xC2, 0x81, 0x53, 0x02,
+  0x15, 0x22, 0xA1, 0x81, 0x0D, 0x00, 0x51, 0x80, 0x03, 0x00, 0x2A, 0x81, 0x22, 0x81, 0x4B, 0x85,
+  0x00, 0x03, 0x71, 0x77, 0x75, 0x15, 0x80, 0x22, 0x89, 0x00, 0x00, 0x17, 0x83, 0x3F, 0x00, 0xC2,
+  0x87, 0x03, 0x08, 0x52, 0x2F, 0x9F, 0x2D, 0x52, 0x22, 0xF2, 0x22, 0x52, 0x80, 0x30, 0x0B, 0xA2,
+  0x22, 0xD2, 0x2D, 0x22, 0x27, 0x82, 0x29, 0x22, 0x2E, 0x9F, 0x79, 0x80, 0xFE, 0x00, 0x99, 0x80,
+  0x12, 0x08, 0x7D, 0x5F, 0x31, 0x22, 0x21, 0x76, 0x27, 0x22, 0x21, 0x81, 0x4F, 0x1C, 0x32, 0x27,
+  0x22, 0x38, 0x12, 0x7D, 0x22, 0x31, 0x55, 0x5F, 0x22, 0x31, 0x5E, 0xEF, 0x22, 0x71, 0x15, 0xEF,
+  0x22, 0xC1, 0x56, 0xAA, 0x44, 0x44, 0x74, 0x44, 0x44, 0x44, 0x7A, 0x80, 0x03, 0x00, 0x7C, 0x80,
+  0x03, 0x01, 0x57, 0xA4, 0x80, 0x03, 0x80, 0x0C, 0x0A, 0x55, 0x77, 0x64, 0x44, 0x55, 0x55, 0x77,
+  0x99, 0x44, 0x44, 0x67, 0x80, 0x1E, 0x00, 0x97, 0x80, 0x03, 0x19, 0x65, 0x76, 0x44, 0x44, 0x75,
+  0x77, 0x44, 0x44, 0x77, 0x77, 0x44, 0x46, 0x77, 0x55, 0x44, 0x47, 0x77, 0x55, 0x9A, 0x67, 0x75,
+  0x55, 0x44, 0x44, 0x4A, 0x67, 0x80, 0x36, 0x86, 0x00, 0x00, 0x64, 0x80, 0x03, 0x80, 0x28, 0x0E,
+  0x44, 0x77, 0x79, 0xAA, 0xA9, 0x55, 0x57, 0x77, 0x77, 0x77, 0x55, 0x7A, 0x44, 0x66, 0x77, 0x80,
+  0x59, 0x00, 0x47, 0x80, 0x59, 0x0B, 0x47, 0x57, 0x64, 0x44, 0x67, 0x55, 0x64, 0x46, 0x57, 0x55,
+  0x64, 0x77, 0x80, 0x03, 0x04, 0x57, 0x55, 0x77, 0xA4, 0x21, 0x80, 0xD5, 0x00, 0x25, 0x80, 0x03,
+  0x01, 0x22, 0xD1, 0x80, 0x03, 0x80, 0x08, 0x80, 0xA6, 0x80, 0x03, 0x00, 0x2A, 0x80, 0x03, 0x82,
+  0xB3, 0x81, 0x1E, 0x84, 0x00, 0x08, 0xCA, 0x51, 0x11, 0x15, 0x22, 0xA1, 0x11, 0x1A, 0x2A, 0x80,
+  0x29, 0x89, 0x00, 0x04, 0xC2, 0x22, 0x11, 0x11, 0x12, 0x80, 0x03, 0x05, 0x15, 0x22, 0x77, 0x11,
+  0x11, 0x52, 0x80, 0x31, 0x02, 0x15, 0x1A, 0x27, 0x80, 0x16, 0x00, 0xA5, 0x83, 0x1D, 0x80, 0x43,
+  0x8E, 0x00, 0x02, 0x1C, 0x55, 0x55, 0x85, 0x3C, 0x08, 0x52, 0x22, 0x52, 0x2F, 0x97, 0x22, 0x52,
+  0x22, 0xF2, 0x80, 0x03, 0x10, 0x22, 0x2D, 0xA2, 0x22, 0xD2, 0xD5, 0x22, 0x27, 0x82, 0x12, 0x22,
+  0x27, 0x9F, 0xA2, 0x22, 0x22, 0x88, 0x81, 0x2B, 0x06, 0x2D, 0x98, 0xE8, 0x22, 0x2F, 0x7F, 0x27,
+  0x82, 0x37, 0x20, 0x2D, 0xE2, 0x27, 0x22, 0x29, 0x8F, 0x7D, 0x22, 0x79, 0x69, 0x98, 0x22, 0x96,
+  0x99, 0x6D, 0x22, 0x7D, 0x89, 0x6D, 0x22, 0x47, 0x76, 0xAA, 0x44, 0x47, 0x74, 0x44, 0x44, 0x97,
+  0x7A, 0x44, 0x44, 0x67, 0x80, 0xE6, 0x02, 0x67, 0x77, 0xA4, 0x80, 0x03, 0x0A, 0x7A, 0x44, 0x97,
+  0x77, 0x57, 0x64, 0x47, 0x77, 0x55, 0x77, 0x44, 0x80, 0x1A, 0x84, 0x03, 0x00, 0x67, 0x80, 0x03,
+  0x00, 0xC7, 0x80, 0x03, 0x80, 0x13, 0x09, 0x46, 0x75, 0x44, 0x44, 0x47, 0x75, 0x99, 0x9A, 0x67,
+  0x75, 0x80, 0x3A, 0x00, 0x4A, 0x80, 0x03, 0x01, 0x44, 0x76, 0x83, 0x18, 0x05, 0x44, 0x77, 0x64,
+  0x44, 0x44, 0x55, 0x80, 0x0C, 0x0E, 0x55, 0x57, 0x79, 0xAA, 0x55, 0x55, 0x77, 0x77, 0x67, 0x77,
+  0x75, 0x7A, 0x44, 0x66, 0x77, 0x80, 0x59, 0x00, 0x4C, 0x80, 0x1E, 0x00, 0x47, 0x80, 0x03, 0x07,
+  0x67, 0x77, 0x44, 0x46, 0x77, 0x55, 0xA9, 0x77, 0x81, 0x00, 0x0E, 0x55, 0x77, 0x22, 0x25, 0x55,
+  0x55, 0x22, 0x2D, 0x55, 0x55, 0x62, 0x22, 0xD5, 0x55, 0x32, 0x80, 0x08, 0x03, 0x32, 0x22, 0x22,
+  0x75, 0x80, 0x03, 0x00, 0x22, 0x81, 0x03, 0x00, 0x62, 0x80, 0x03, 0x85, 0xE8, 0x80, 0x00, 0x03,
+  0x1A, 0x11, 0x11, 0x15, 0x80, 0x0F, 0x01, 0x1A, 0x2A, 0x81, 0x0C, 0x00, 0x21, 0x84, 0x03, 0x80,
+  0x00, 0x00, 0xC2, 0x80, 0x03, 0x01, 0x12, 0x51, 0x80, 0x1C, 0x05, 0xA1, 0x7A, 0x11, 0x11, 0xD1,
+  0x22, 0x80, 0x15, 0x01, 0x1A, 0x27, 0x80, 0x12, 0x00, 0xA5, 0x82, 0x1C, 0x82, 0xF8, 0x84, 0x00,
+  0x00, 0x52, 0x80, 0x03, 0x00, 0x15, 0x81, 0x53, 0x02, 0x1C, 0x55, 0x55, 0x85, 0x54, 0x80, 0x15,
+  0x00, 0x27, 0x83, 0x19, 0x80, 0x03, 0x08, 0x2D, 0xA2, 0x22, 0x22, 0xD5, 0x22, 0x27, 0x11, 0x12,
+  0x80, 0x03, 0x80, 0x0A, 0x81, 0x15, 0x06, 0x97, 0x2D, 0x98, 0xE8, 0xF2, 0x2F, 0x7F, 0x80, 0x23,
+  0x24, 0x22, 0x22, 0xD2, 0x28, 0xE2, 0x27, 0x82, 0x29, 0x82, 0x78, 0x9F, 0x79, 0x99, 0x98, 0x89,
+  0x96, 0x99, 0x9D, 0x22, 0x7D, 0x89, 0x9D, 0x22, 0x21, 0x13, 0x66, 0x22, 0x21, 0x12, 0x22, 0x22,
+  0x71, 0x16, 0x22, 0x22, 0x31, 0x13, 0x80, 0x03, 0x01, 0x11, 0x62, 0x80, 0x03, 0x02, 0x16, 0x22,
+  0x71, 0x80, 0x5B, 0x02, 0xC1, 0x11, 0x88, 0x89, 0x7F, 0x84, 0x00, 0x00, 0x2C, 0x80, 0x03, 0x00,
+  0x2A, 0x80, 0xDF, 0x08, 0x21, 0x8B, 0x77, 0x76, 0x31, 0x97, 0x74, 0x44, 0x44, 0x81, 0x03, 0x05,
+  0x67, 0x76, 0x44, 0x44, 0x77, 0x77, 0x81, 0x03, 0x04, 0x64, 0x44, 0x77, 0x55, 0x76, 0x80, 0x03,
+  0x0C, 0x57, 0x79, 0x55, 0x55, 0x55, 0x77, 0x49, 0x67, 0x57, 0x57, 0x44, 0x44, 0x6C, 0x80, 0x19,
+  0x01, 0x44, 0x4C, 0x80, 0x03, 0x00, 0x47, 0x80, 0x03, 0x07, 0x67, 0x44, 0x44, 0x46, 0x77, 0xAA,
+  0xA9, 0x77, 0x82, 0x00, 0x07, 0x16, 0x22, 0x25, 0x55, 0x1B, 0x22, 0x2D, 0x55, 0x80, 0x75, 0x04,
+  0xD5, 0x11, 0x32, 0x22, 0x2D, 0x80, 0x03, 0x01, 0x22, 0x88, 0x84, 0x03, 0x01, 0x81, 0x62, 0x80,
+  0xEB, 0x8B, 0x00, 0x00, 0x15, 0x80, 0x96, 0x01, 0x1A, 0x2A, 0x81, 0xF7, 0x00, 0x21, 0x83, 0x03,
+  0x85, 0x00, 0x01, 0xCA, 0x51, 0x80, 0x0F, 0x04, 0xA1, 0x77, 0x11, 0x2A, 0xD1, 0x81, 0x15, 0x01,
+  0x1A, 0x27, 0x80, 0x12, 0x00, 0xA5, 0x81, 0x17, 0x00, 0xC2, 0x80, 0xAC, 0x80, 0xDD, 0x01, 0x22,
+  0x15, 0x80, 0x03, 0x01, 0x11, 0x52, 0x80, 0x03, 0x80, 0x08, 0x03, 0x11, 0x11, 0x1C, 0x55, 0x85,
+  0x37, 0x80, 0x16, 0x80, 0x15, 0x85, 0x03, 0x08, 0x2D, 0xA2, 0x22, 0x22, 0xD5, 0x22, 0x55, 0x11,
+  0x12, 0x80, 0x23, 0x00, 0xA2, 0x82, 0x2F, 0x07, 0x2F, 0x97, 0x2D, 0x68, 0x22, 0xF2, 0x22, 0x77,
+  0x82, 0xF9, 0x19, 0xD2, 0x2D, 0xE2, 0x27, 0x82, 0x29, 0x8F, 0x27, 0x9F, 0x79, 0x99, 0x22, 0x88,
+  0x96, 0x99, 0x22, 0x22, 0x7D, 0x89, 0x31, 0x22, 0x21, 0x13, 0x27, 0x22, 0x21, 0x80, 0x62, 0x10,
+  0x71, 0x16, 0x27, 0x22, 0x31, 0x83, 0x7D, 0x22, 0x31, 0x81, 0x5F, 0x22, 0x31, 0x88, 0x5F, 0x22,
+  0x71, 0x80, 0x03, 0x02, 0xC1, 0x88, 0x6C, 0x82, 0x38, 0x87, 0x00, 0x80, 0xD2, 0x01, 0x22, 0x16,
+  0x81, 0x8B, 0x80, 0xDF, 0x05, 0x18, 0x1B, 0x77, 0x76, 0x22, 0x71, 0x81, 0x3A, 0x80, 0x03, 0x01,
+  0x31, 0x13, 0x80, 0x14, 0x0E, 0x81, 0x22, 0x2C, 0x18, 0x81, 0x32, 0x23, 0x11, 0x88, 0x13, 0x21,
+  0x11, 0x88, 0x18, 0x31, 0x80, 0x03, 0x02, 0x22, 0x27, 0x31, 0x81, 0xA3, 0x00, 0x33, 0x8C, 0x46,
+  0x05, 0x23, 0x17, 0xCC, 0x67, 0x11, 0x81, 0x80, 0xBF, 0x14, 0x75, 0x5A, 0x44, 0x42, 0x77, 0x7C,
+  0x44, 0x48, 0x4C, 0x57, 0xA4, 0x44, 0x47, 0x57, 0x64, 0x44, 0x67, 0x77, 0x64, 0x44, 0x77, 0x80,
+  0x07, 0x83, 0x03, 0x01, 0xA4, 0x44, 0x85, 0xE7, 0x00, 0xD1, 0x80, 0x03, 0x00, 0x25, 0x81, 0xEF,
+  0x00, 0x71, 0x80, 0x03, 0x00, 0x2A, 0x81, 0xF7, 0x00, 0x21, 0x82, 0x03, 0x86, 0x00, 0x09, 0xCA,
+  0x51, 0x11, 0x15, 0x22, 0xA1, 0x77, 0x1A, 0x2A, 0x51, 0x80, 0xFB, 0x01, 0x11, 0x1A, 0x86, 0x17,
+  0x00, 0xC2, 0x80, 0x96, 0x80, 0x9E, 0x80, 0x1C, 0x80, 0x17, 0x00, 0x52, 0x80, 0x31, 0x06, 0x15,
+  0x22, 0x27, 0x11, 0x11, 0x1C, 0xA5, 0x84, 0x1E, 0x00, 0x44, 0x88, 0x00, 0x0A, 0x24, 0x48, 0x89,
+  0x44, 0xE4, 0x42, 0x22, 0x44, 0x84, 0xB2, 0x2E, 0x81, 0x0E, 0x00, 0x49, 0x81, 0x04, 0x03, 0x4A,
+  0x94, 0x44, 0x47, 0x85, 0x0B, 0x07, 0xBB, 0xBB, 0x44, 0x44, 0x22, 0x22, 0x28, 0xB4, 0x80, 0x03,
+  0x80, 0x07, 0x0A, 0x2B, 0x4A, 0x9E, 0x22, 0x84, 0x47, 0x75, 0x55, 0x77, 0x77, 0x55, 0x80, 0x00,
+  0x0F, 0x65, 0x55, 0x5C, 0xC7, 0x47, 0x55, 0x7A, 0x4A, 0x47, 0x75, 0x59, 0x44, 0x67, 0x75, 0x57,
+  0x64, 0x80, 0x14, 0x01, 0x77, 0x57, 0x81, 0x04, 0x01, 0x77, 0x75, 0x81, 0x1E, 0x10, 0x55, 0x75,
+  0x77, 0xC6, 0x75, 0x77, 0x76, 0x44, 0x65, 0x95, 0x74, 0x44, 0x77, 0xA7, 0x74, 0xA7, 0x76, 0x80,
+  0x17, 0x01, 0x7A, 0x75, 0x80, 0xE4, 0x00, 0x75, 0x80, 0x24, 0x00, 0x75, 0x80, 0x01, 0x80, 0x21,
+  0x00, 0x55, 0x80, 0x2A, 0x04, 0x57, 0xA4, 0x4A, 0x99, 0xA4, 0x89, 0x93, 0x0B, 0x88, 0x88, 0x13,
+  0x22, 0x81, 0x11, 0x32, 0x22, 0x11, 0x36, 0x22, 0x22, 0x80, 0x02, 0x88, 0x00, 0x03, 0x63, 0x92,
+  0x27, 0xB1, 0x81, 0xD9, 0x04, 0x22, 0x11, 0x22, 0x22, 0x25, 0x80, 0xDD, 0x01, 0xA1, 0x1A, 0x83,
+  0xE5, 0x00, 0x55, 0x80, 0x03, 0x05, 0x22, 0x2A, 0x22, 0x2A, 0x7A, 0x22, 0x80, 0xEC, 0x0D, 0xCA,
+  0x11, 0x11, 0xC5, 0x11, 0x71, 0x11, 0xA2, 0x51, 0x25, 0x11, 0x52, 0x71, 0x27, 0x84, 0x03, 0x03,
+  0x2A, 0x51, 0x52, 0x71, 0x81, 0x23, 0x00, 0x2A, 0x81, 0x3C, 0x05, 0x11, 0x15, 0x2A, 0x11, 0x11,
+  0x1A, 0x80, 0x07, 0x02, 0x1A, 0x22, 0x55, 0x81, 0x3E, 0x03, 0x11, 0x1C, 0x22, 0xA2, 0x80, 0x03,
+  0x01, 0x22, 0x71, 0x80, 0x03, 0x03, 0x2A, 0x55, 0x22, 0x98, 0x87, 0x8A, 0x00, 0x49, 0x80, 0x03,
+  0x00, 0x42, 0x84, 0x03, 0x00, 0x48, 0x88, 0x13, 0x82, 0x00, 0x00, 0xB4, 0x80, 0x03, 0x0B, 0x22,
+  0x24, 0x48, 0x89, 0x22, 0xE4, 0x42, 0x22, 0xEE, 0x84, 0xB2, 0x2E, 0x81, 0x13, 0x00, 0x99, 0x81,
+  0x04, 0x01, 0x4A, 0x94, 0x87, 0x41, 0x01, 0xBB, 0xBB, 0x80, 0x24, 0x01, 0x22, 0x28, 0x80, 0x03,
+  0x1C, 0x2E, 0x49, 0x22, 0x22, 0x2B, 0x44, 0x9E, 0x22, 0x84, 0x47, 0x77, 0x55, 0x77, 0x49, 0x77,
+  0x55, 0x57, 0x44, 0x67, 0x55, 0x5C, 0x44, 0x47, 0x55, 0x5A, 0xB4, 0x47, 0x77, 0x76, 0x80, 0x0B,
+  0x06, 0x77, 0x4A, 0x77, 0x77, 0x77, 0x47, 0x75, 0x80, 0x1C, 0x80, 0x00, 0x00, 0x55, 0x80, 0x05,
+  0x04, 0xC7, 0x77, 0x77, 0xC6, 0x4A, 0x80, 0x1A, 0x07, 0x44, 0x97, 0x74, 0x44, 0x64, 0xA7, 0x74,
+  0xA7, 0x82, 0x17, 0x80, 0x03, 0x03, 0x88, 0x88, 0x11, 0x88, 0x81, 0x00, 0x04, 0x18, 0x11, 0x11,
+  0x88, 0x38, 0x80, 0x03, 0x04, 0x11, 0x62, 0xC6, 0x77, 0x13, 0x80, 0xD7, 0x00, 0x16, 0x80, 0x03,
+  0x00, 0x32, 0x80, 0x03, 0x80, 0x22, 0x00, 0x76, 0x80, 0x03, 0x04, 0x64, 0x77, 0x77, 0x6A, 0x44,
+  0x80, 0x02, 0x01, 0x44, 0xA4, 0x87, 0x8D, 0x04, 0xA6, 0x44, 0x49, 0x67, 0x77, 0x80, 0x22, 0x81,
+  0x00, 0x00, 0x25, 0x80, 0x03, 0x00, 0xA1, 0x80, 0x03, 0x00, 0x11, 0x80, 0x03, 0x00, 0x55, 0x81,
+  0x10, 0x07, 0xB2, 0x22, 0x2A, 0x7A, 0xB2, 0x22, 0x21, 0x11, 0x80, 0x00, 0x0A, 0xC5, 0x15, 0xA1,
+  0x11, 0xA2, 0x1A, 0x25, 0x11, 0x52, 0x15, 0x27, 0x83, 0x03, 0x03, 0x2A, 0x2A, 0x51, 0x52, 0x81,
+  0x23, 0x01, 0xCA, 0x2A, 0x80, 0x30, 0x07, 0x11, 0x11, 0x15, 0x51, 0x11, 0x11, 0x1A, 0x71, 0x81,
+  0x03, 0x14, 0x55, 0x11, 0x15, 0x71, 0x22, 0x11, 0x1C, 0x71, 0xA2, 0x11, 0x1C, 0x2A, 0x22, 0x71,
+  0x1C, 0x22, 0x22, 0x2A, 0x55, 0x2A, 0x75, 0x84, 0x61, 0x94, 0x00, 0x85, 0x8C, 0x0F, 0x49, 0xB4,
+  0x44, 0x44, 0x42, 0x22, 0x24, 0x49, 0x42, 0x22, 0xE4, 0x42, 0x48, 0xEE, 0x84, 0xB2, 0x82, 0x13,
+  0x00, 0xB9, 0x81, 0x05, 0x01, 0x4A, 0x94, 0x85, 0x23, 0x08, 0x89, 0x44, 0xBB, 0xBB, 0x22, 0x44,
+  0x22, 0x22, 0x2E, 0x80, 0x03, 0x01, 0x44, 0x49, 0x80, 0x03, 0x0D, 0x4B, 0x9E, 0x22, 0x44, 0x47,
+  0x77, 0x77, 0x44, 0x49, 0x77, 0x55, 0x44, 0x44, 0x65, 0x80, 0x03, 0x06, 0x47, 0x55, 0x28, 0xB4,
+  0x47, 0x55, 0x2E, 0x80, 0x0B, 0x08, 0x2B, 0x4A, 0x77, 0x55, 0x84, 0x47, 0x77, 0x55, 0x55, 0x80,
+  0xFC, 0x81, 0x04, 0x13, 0x5C, 0xC7, 0x77, 0x77, 0x5A, 0x4A, 0x77, 0x7C, 0x76, 0x44, 0x97, 0x74,
+  0x77, 0x64, 0xA7, 0x74, 0x75, 0x77, 0x77, 0x57, 0x80, 0x16, 0x00, 0x55, 0x80, 0x00, 0x82, 0x04,
+  0x05, 0xC6, 0x77, 0x75, 0x77, 0x44, 0x67, 0x80, 0x4B, 0x0C, 0x77, 0xA4, 0xAA, 0xA7, 0x76, 0x44,
+  0x44, 0x77, 0x7A, 0x44, 0x44, 0x55, 0x64, 0x80, 0x03, 0x80, 0x28, 0x83, 0x44, 0x07, 0x77, 0xCA,
+  0x77, 0x57, 0x6A, 0x44, 0x99, 0xA4, 0x85, 0x8D, 0x82, 0xA1, 0x01, 0x67, 0x13, 0x80, 0xC3, 0x00,
+  0x32, 0x90, 0xD7, 0x18, 0x63, 0x92, 0x22, 0x27, 0x11, 0x92, 0x22, 0x25, 0x22, 0x11, 0x11, 0x11,
+  0x25, 0x15, 0x71, 0x11, 0xA1, 0x1A, 0x25, 0x11, 0x11, 0x15, 0x27, 0x11, 0x55, 0x80, 0x03, 0x04,
+  0x22, 0x2A, 0x2A, 0x51, 0x7A, 0x80, 0x23, 0x04, 0x11, 0xCA, 0x2A, 0x22, 0xC5, 0x80, 0x1F, 0x05,
+  0xA2, 0x51, 0x11, 0x11, 0x52, 0x71, 0x81, 0x03, 0x00, 0x55, 0x80, 0x03, 0x00, 0x22, 0x80, 0x03,
+  0x00, 0xA2, 0x80, 0x23, 0x01, 0x22, 0x71, 0x80, 0x22, 0x05, 0x2A, 0x15, 0x2A, 0x75, 0x22, 0x1A,
+  0x80, 0x08, 0x81, 0x03, 0x00, 0x15, 0x80, 0x03, 0x00, 0x1C, 0x88, 0x03, 0x00, 0x55, 0x80, 0x03,
+  0x87, 0x8A, 0x05, 0xB4, 0x44, 0x44, 0x42, 0x22, 0x24, 0x80, 0x03, 0x04, 0xE4, 0x44, 0x48, 0x88,
+  0x84, 0x83, 0x13, 0x00, 0x99, 0x81, 0x05, 0x00, 0x4A, 0x85, 0x22, 0x0A, 0x48, 0x89, 0x44, 0xBB,
+  0x42, 0x22, 0x44, 0x22, 0xB2, 0x2E, 0x44, 0x80, 0x37, 0x00, 0x49, 0x81, 0x3B, 0x04, 0x9E, 0x94,
+  0x44, 0x47, 0x77, 0x80, 0x0B, 0x80, 0x03, 0x08, 0x44, 0x67, 0xBB, 0x44, 0x44, 0x47, 0x22, 0x28,
+  0xB4, 0x80, 0x03, 0x08, 0x44, 0x65, 0x22, 0x2B, 0x4A, 0x77, 0x22, 0x84, 0x47, 0x80, 0xF6, 0x81,
+  0xFA, 0x11, 0x55, 0x55, 0x55, 0x5C, 0xC7, 0x75, 0x77, 0x7A, 0x4A, 0x77, 0x77, 0x79, 0x44, 0x97,
+  0x55, 0x77, 0x64, 0xA7, 0x81, 0x17, 0x01, 0x77, 0x75, 0x80, 0x01, 0x03, 0x77, 0x57, 0x75, 0x57,
+  0x81, 0x03, 0x11, 0xC6, 0x75, 0x75, 0x56, 0x44, 0x65, 0x77, 0x74, 0x44, 0x77, 0xA4, 0x74, 0xA7,
+  0x76, 0x44, 0x77, 0x77, 0x7A, 0x80, 0x03, 0x0D, 0x64, 0x44, 0x55, 0x55, 0x77, 0x75, 0x55, 0x57,
+  0x55, 0x75, 0x75, 0x77, 0x57, 0x57, 0x80, 0x2B, 0x03, 0x6A, 0x4A, 0x99, 0x94, 0x86, 0xB2, 0x81,
+  0xA1, 0x03, 0x55, 0x76, 0x44, 0x44, 0x80, 0x26, 0x01, 0x44, 0xCA, 0x89, 0x15, 0x81, 0x00, 0x03,
+  0xA6, 0x74, 0x44, 0x67, 0x80, 0x4D, 0x11, 0x22, 0x22, 0x11, 0x11, 0x22, 0x25, 0x15, 0x71, 0x22,
+  0xA1, 0x1A, 0x25, 0x22, 0x11, 0x15, 0x27, 0x22, 0x55, 0x80, 0x03, 0x15, 0x22, 0x2A, 0x2A, 0x2A,
+  0x7A, 0x22, 0x22, 0x21, 0x11, 0xCA, 0x2A, 0x11, 0xC5, 0x11, 0x11, 0x11, 0xA2, 0x51, 0x11, 0x11,
+  0x52, 0x71, 0x81, 0x03, 0x00, 0x55, 0x80, 0x03, 0x04, 0x22, 0x51, 0x52, 0x71, 0xA2, 0x80, 0x23,
+  0x00, 0x22, 0x81, 0x00, 0x05, 0x11, 0x15, 0x2A, 0x75, 0x11, 0x1A, 0x80, 0x07, 0x81, 0x03, 0x00,
+  0x15, 0x80, 0x03, 0x00, 0x1C, 0x83, 0x03, 0x00, 0x71, 0x80, 0x03, 0x0C, 0x2A, 0x55, 0x22, 0x22,
+  0xB4, 0x82, 0x84, 0x44, 0x44, 0x22, 0x84, 0xB8, 0x4B, 0x80, 0x09, 0x02, 0x22, 0x22, 0x28, 0x82,
+  0x33, 0x89, 0x00, 0x04, 0x44, 0x48, 0x44, 0x97, 0xB4, 0x80, 0xA2, 0x02, 0x22, 0x84, 0x46, 0x80,
+  0x03, 0x06, 0x47, 0x7C, 0x2D, 0xB4, 0x99, 0xA4, 0x22, 0x80, 0x9E, 0x1B, 0x2E, 0x44, 0x44, 0x67,
+  0x28, 0x44, 0x97, 0x77, 0x56, 0x46, 0x55, 0x57, 0x76, 0x49, 0x55, 0x55, 0x5A, 0x49, 0x77, 0x57,
+  0x64, 0x46, 0x77, 0x5C, 0x44, 0x44, 0x4A, 0x66, 0x81, 0xBE, 0x0D, 0x64, 0x97, 0x76, 0xA4, 0x64,
+  0x97, 0x77, 0xC4, 0x76, 0x75, 0x77, 0x44, 0xA4, 0x67, 0x80, 0x16, 0x00, 0x67, 0x81, 0xE8, 0x06,
+  0x74, 0x44, 0x49, 0x77, 0xC4, 0x44, 0x4A, 0x81, 0xF0, 0x01, 0x46, 0xA4, 0x82, 0xE6, 0x80, 0x62,
+  0x06, 0xCA, 0x22, 0x27, 0x91, 0x11, 0x22, 0x2A, 0x80, 0xE7, 0x09, 0x2A, 0x19, 0x2A, 0x22, 0x2A,
+  0x1B, 0x2C, 0x22, 0x2A, 0x41, 0x80, 0x9C, 0x05, 0x41, 0x62, 0x22, 0x2A, 0x33, 0x62, 0x80, 0xDD,
+  0x02, 0x12, 0x11, 0x44, 0x83, 0x03, 0x00, 0x44, 0x81, 0x07, 0x12, 0x13, 0x2A, 0x12, 0xB1, 0x13,
+  0x26, 0x12, 0xB1, 0x4B, 0x22, 0xB2, 0xA3, 0x33, 0x22, 0x62, 0x22, 0x21, 0x11, 0x17, 0x80, 0x03,
+  0x02, 0x1A, 0x22, 0x71, 0x82, 0x03, 0x00, 0x11, 0x8A, 0x03, 0x80, 0x00, 0x0B, 0x25, 0x11, 0x52,
+  0x7C, 0x2D, 0x11, 0x52, 0x71, 0x21, 0x11, 0x52, 0x51, 0x80, 0x4A, 0x80, 0x15, 0x87, 0x00, 0x00,
+  0x75, 0x80, 0x11, 0x00, 0xA2, 0x80, 0x23, 0x0F, 0x52, 0x75, 0xA2, 0x27, 0x52, 0x71, 0x1A, 0x25,
+  0x52, 0x51, 0xC2, 0x2B, 0x11, 0x11, 0x52, 0x7B, 0x80, 0x15, 0x00, 0x5B, 0x80, 0x3D, 0x00, 0xBB,
+  0x81, 0x03, 0x0A, 0x49, 0x92, 0x24, 0x92, 0x22, 0x22, 0xE4, 0xB2, 0x22, 0x22, 0x84, 0x80, 0x03,
+  0x04, 0xB4, 0x82, 0x22, 0x22, 0xE9, 0x81, 0x56, 0x84, 0x00, 0x01, 0x2E, 0xE2, 0x80, 0x12, 0x08,
+  0x84, 0x22, 0x44, 0x2D, 0x84, 0x22, 0xBB, 0x22, 0xB4, 0x80, 0x10, 0x03, 0x28, 0x22, 0x22, 0xDD,
+  0x80, 0x06, 0x81, 0x03, 0x83, 0x00, 0x0B, 0x44, 0x44, 0x48, 0x44, 0xB8, 0xB4, 0x44, 0x44, 0x82,
+  0x22, 0x84, 0x46, 0x80, 0x43, 0x00, 0x47, 0x80, 0x43, 0x00, 0x99, 0x81, 0x15, 0x01, 0x22, 0x2E,
+  0x80, 0x03, 0x40, 0x28, 0x44, 0x97, 0x71, 0x83, 0x23, 0x88, 0x11, 0x83, 0x27, 0x88, 0x11, 0x86,
+  0x27, 0x11, 0x1B, 0x32, 0x23, 0x11, 0x62, 0x22, 0x22, 0x26, 0x22, 0xC2, 0x22, 0x22, 0x31, 0x32,
+  0x71, 0x13, 0x11, 0x32, 0x71, 0x81, 0x57, 0x76, 0x77, 0x77, 0x57, 0x94, 0x67, 0x7C, 0x77, 0x44,
+  0x67, 0x76, 0x5C, 0x44, 0x77, 0x74, 0x66, 0x49, 0x77, 0xC4, 0x44, 0x4A, 0x77, 0x64, 0xA4, 0x44,
+  0x46, 0xA4, 0xC4, 0x44, 0x80, 0x43, 0x82, 0x00, 0x04, 0x27, 0x91, 0x22, 0x22, 0x2A, 0x80, 0xEF,
+  0x01, 0x2A, 0x19, 0x80, 0x03, 0x00, 0x1B, 0x84, 0x0B, 0x80, 0x1B, 0x03, 0x27, 0x33, 0x4C, 0x99,
+  0x87, 0x00, 0x00, 0x48, 0x80, 0x03, 0x14, 0x4F, 0x99, 0x9C, 0x48, 0x44, 0xC9, 0x9C, 0x4F, 0xF4,
+  0xC9, 0x9C, 0x45, 0xF4, 0x8C, 0xC2, 0x61, 0x24, 0x44, 0x4B, 0xBB, 0x94, 0x82, 0x03, 0x00, 0x8B,
+  0x80, 0x03, 0x07, 0x87, 0x75, 0x24, 0xC7, 0x61, 0x11, 0x51, 0x11, 0x85, 0x00, 0x07, 0x57, 0x51,
+  0xB8, 0x48, 0xBB, 0x84, 0xB4, 0x42, 0x80, 0x03, 0x06, 0x4B, 0xBB, 0x84, 0x56, 0x11, 0x16, 0x66,
+  0x86, 0x1A, 0x84, 0x00, 0x13, 0x7C, 0xA2, 0x22, 0x22, 0x71, 0x52, 0x75, 0xA2, 0x51, 0x52, 0x51,
+  0x1A, 0x63, 0x6D, 0x91, 0xC2, 0x33, 0x33, 0x33, 0x39, 0x80, 0x03, 0x86, 0x00, 0x06, 0x44, 0x48,
+  0x8B, 0xB4, 0x48, 0xBB, 0xBB, 0x80, 0x42, 0x10, 0xBB, 0x24, 0x4B, 0xBB, 0xBB, 0x84, 0x8B, 0xBB,
+  0xBB, 0xB8, 0x11, 0x6B, 0xBB, 0xBB, 0x11, 0x11, 0x65, 0x80, 0x03, 0x0E, 0x11, 0x6B, 0x92, 0x22,
+  0xB4, 0x82, 0x92, 0x22, 0x44, 0x22, 0x92, 0x22, 0xBB, 0x22, 0x82, 0x83, 0xCC, 0x86, 0x00, 0x00,
+  0xE2, 0x80, 0x03, 0x0F, 0x84, 0x44, 0x44, 0x48, 0x84, 0xB8, 0xB4, 0x44, 0xB4, 0x8D, 0x22, 0x84,
+  0x28, 0x2D, 0x22, 0x84, 0x80, 0x12, 0x00, 0xB4, 0x80, 0x03, 0x80, 0xDB, 0x00, 0x2E, 0x80, 0x03,
+  0x13, 0x28, 0x44, 0x22, 0x71, 0x13, 0x23, 0x22, 0x11, 0x13, 0x27, 0x23, 0x18, 0x86, 0x27, 0x21,
+  0x1B, 0x32, 0x23, 0x77, 0x62, 0x81, 0x39, 0x32, 0xC2, 0x22, 0x22, 0x31, 0x32, 0x71, 0x71, 0x11,
+  0x32, 0x71, 0x55, 0x77, 0x76, 0x75, 0x55, 0x55, 0x94, 0x67, 0x77, 0x77, 0x44, 0x67, 0x77, 0x7C,
+  0x44, 0x75, 0x4A, 0x66, 0x49, 0x75, 0x44, 0x44, 0x4A, 0x75, 0x76, 0xA4, 0x44, 0x46, 0x77, 0xC4,
+  0x44, 0x44, 0x57, 0x44, 0x44, 0x44, 0x7C, 0x44, 0x44, 0x49, 0x76, 0x80, 0x03, 0x00, 0x74, 0x80,
+  0x03, 0x80, 0x12, 0x01, 0x49, 0x64, 0x80, 0x03, 0x00, 0xA4, 0x80, 0x03, 0x80, 0x1A, 0x05, 0x49,
+  0x22, 0xC3, 0x11, 0x11, 0x91, 0x85, 0xEC, 0x17, 0x2A, 0x44, 0x44, 0x1B, 0x26, 0x11, 0x1B, 0x11,
+  0x22, 0xB1, 0x13, 0x11, 0x62, 0xB1, 0x1B, 0x33, 0x62, 0xA3, 0x33, 0x11, 0x92, 0x22, 0x25, 0x44,
+  0x81, 0x03, 0x03, 0x12, 0x22, 0x75, 0x11, 0x80, 0x03, 0x04, 0x2A, 0x92, 0x22, 0x75, 0x26, 0x80,
+  0x03, 0x01, 0x22, 0xB2, 0x80, 0x03, 0x80, 0x8B, 0x0A, 0x11, 0x1A, 0x25, 0x11, 0x11, 0x1A, 0x2D,
+  0x11, 0x11, 0x17, 0x21, 0x85, 0x45, 0x86, 0x00, 0x13, 0x22, 0x2A, 0x75, 0x51, 0x52, 0x7C, 0xA2,
+  0x22, 0x52, 0x71, 0x52, 0x75, 0x52, 0x51, 0x52, 0x51, 0x12, 0x71, 0x52, 0x51, 0x8E, 0x23, 0x18,
+  0x22, 0x27, 0x7B, 0xA2, 0x27, 0xBB, 0xBB, 0x1A, 0x2D, 0xBB, 0xBB, 0xC2, 0x2B, 0xBB, 0xBB, 0x52,
+  0x7B, 0xBB, 0xBB, 0xA2, 0x5B, 0xBB, 0xBB, 0x22, 0xBB, 0x83, 0x03, 0x10, 0x24, 0xB2, 0x22, 0xB4,
+  0xE4, 0xB2, 0x22, 0x44, 0x84, 0xB2, 0x22, 0xBB, 0xB4, 0x92, 0x22, 0x22, 0xE9, 0x81, 0xFE, 0x84,
+  0x00, 0x11, 0x2E, 0xE2, 0x22, 0x22, 0x82, 0x84, 0x44, 0x44, 0x22, 0x84, 0xB8, 0x94, 0x22, 0xB4,
+  0x82, 0x22, 0x22, 0x28, 0x88, 0x1C, 0x80, 0x1E, 0x80, 0x03, 0x12, 0xD8, 0x48, 0x44, 0x97, 0x56,
+  0x44, 0x44, 0x77, 0x76, 0x84, 0x46, 0x77, 0x7A, 0x84, 0x47, 0x7C, 0x64, 0xB4, 0x99, 0x80, 0xF9,
+  0x82, 0x00, 0x0E, 0x67, 0x64, 0x44, 0x97, 0x77, 0x64, 0x23, 0x11, 0x88, 0x13, 0x27, 0x11, 0x88,
+  0x72, 0x27, 0x80, 0x8A, 0x07, 0x23, 0x11, 0x83, 0x2C, 0x22, 0x26, 0x33, 0x27, 0x80, 0x37, 0x0E,
+  0x26, 0x71, 0x13, 0x72, 0x22, 0x71, 0x11, 0x12, 0x2C, 0x77, 0x57, 0x44, 0x44, 0x65, 0x7C, 0x80,
+  0x2D, 0x00, 0x76, 0x80, 0x45, 0x0B, 0x74, 0x44, 0x44, 0x55, 0xC4, 0x44, 0x44, 0x75, 0x64, 0x44,
+  0x44, 0x46, 0x84, 0x46, 0x07, 0x22, 0x22, 0xC3, 0x11, 0x27, 0x91, 0x11, 0x11, 0x80, 0x3F, 0x01,
+  0x11, 0x2A, 0x81, 0x01, 0x01, 0x1B, 0x26, 0x80, 0x05, 0x0F, 0x22, 0xB1, 0x2A, 0x11, 0x62, 0xB1,
+  0x27, 0x33, 0xC2, 0xA3, 0x11, 0x11, 0x12, 0x22, 0x44, 0x44, 0x83, 0x03, 0x81, 0x0B, 0x01, 0x13,
+  0x2A, 0x80, 0x03, 0x17, 0x26, 0x12, 0x22, 0x1B, 0x22, 0xB2, 0x22, 0x33, 0x22, 0x62, 0x22, 0x21,
+  0x11, 0x17, 0x25, 0x21, 0x11, 0x1A, 0x25, 0x71, 0x11, 0x1A, 0x21, 0x71, 0x80, 0x43, 0x89, 0x03,
+  0x11, 0x22, 0x22, 0x2A, 0x75, 0x11, 0x52, 0x7D, 0xA2, 0x11, 0x52, 0x71, 0x52, 0x11, 0x52, 0x51,
+  0x52, 0x11, 0x12, 0x80, 0x07, 0x88, 0x00, 0x00, 0x51, 0x82, 0x23, 0x18, 0x22, 0x27, 0x75, 0xA2,
+  0x27, 0xBB, 0x51, 0x1A, 0x2D, 0xBB, 0x51, 0xC2, 0x2B, 0xBB, 0x11, 0x52, 0x7B, 0xBB, 0x11, 0xA2,
+  0x5B, 0xBB, 0x11, 0x22, 0xBB, 0x82, 0x03, 0x00, 0x92, 0x80, 0x20, 0x00, 0x4B, 0x80, 0x03, 0x05,
+  0x44, 0x42, 0x22, 0x22, 0xE9, 0x82, 0x80, 0x08, 0x8C, 0x00, 0x06, 0x28, 0x44, 0x97, 0x75, 0x28,
+  0x44, 0x67, 0x82, 0x03, 0x00, 0x24, 0x80, 0x03, 0x00, 0xB4, 0x80, 0x03, 0x80, 0xED, 0x80, 0x03,
+  0x0B, 0x77, 0x77, 0x44, 0x44, 0x4A, 0xAA, 0xA4, 0x67, 0x57, 0x64, 0xA4, 0x75, 0x80, 0x03, 0x00,
+  0x77, 0x80, 0x03, 0x1B, 0x67, 0x55, 0x74, 0x64, 0x47, 0x57, 0x7C, 0x7A, 0x46, 0x57, 0x75, 0x7C,
+  0x67, 0x55, 0x55, 0xAA, 0xAA, 0x66, 0x66, 0xA7, 0x64, 0x44, 0x44, 0x97, 0x79, 0x44, 0x44, 0x47,
+  0x81, 0x2D, 0x80, 0x03, 0x04, 0x44, 0x67, 0x44, 0x44, 0x64, 0x80, 0x03, 0x00, 0x7C, 0x80, 0x0B,
+  0x00, 0x6C, 0x80, 0x03, 0x82, 0x64, 0x0E, 0x27, 0x77, 0xC2, 0x22, 0x23, 0x11, 0x32, 0x22, 0x23,
+  0x44, 0xB2, 0x22, 0x23, 0x41, 0x72, 0x80, 0x03, 0x81, 0x0B, 0x00, 0x11, 0x82, 0x03, 0x80, 0x00,
+  0x07, 0xC7, 0x77, 0x22, 0xC2, 0x61, 0x11, 0x62, 0x72, 0x80, 0x03, 0x10, 0xA2, 0x61, 0x44, 0x62,
+  0x32, 0x71, 0x44, 0x19, 0x92, 0x11, 0x14, 0x11, 0x12, 0x1B, 0x61, 0x11, 0x12, 0x80, 0x51, 0x9A,
+  0x00, 0x03, 0x22, 0x22, 0xA7, 0x51, 0x8F, 0xD5, 0x01, 0x22, 0x27, 0x80, 0x03, 0x00, 0x2B, 0x80,
+  0x03, 0x0A, 0x5B, 0x22, 0x28, 0x4B, 0x22, 0x4B, 0xB4, 0x48, 0x22, 0x44, 0x44, 0x80, 0x03, 0x03,
+  0x88, 0x22, 0x22, 0x82, 0x8E, 0x2A, 0x04, 0xE4, 0x42, 0x22, 0x22, 0xB4, 0x81, 0x03, 0x00, 0x72,
+  0x80, 0x03, 0x80, 0x0F, 0x00, 0xE8, 0x8A, 0x1D, 0x09, 0x2B, 0x92, 0x22, 0x22, 0x24, 0x4B, 0x22,
+  0x22, 0x28, 0x44, 0x80, 0x22, 0x01, 0xEB, 0x8D, 0x8F, 0x69, 0x02, 0x28, 0x44, 0x97, 0x80, 0x03,
+  0x00, 0x65, 0x80, 0x03, 0x02, 0x67, 0x22, 0xE4, 0x80, 0x03, 0x00, 0xB4, 0x80, 0x0B, 0x00, 0x44,
+  0x82, 0x03, 0x00, 0x77, 0x80, 0x03, 0x07, 0x4A, 0x77, 0xA4, 0x67, 0x55, 0x55, 0xA4, 0x77, 0x84,
+  0x03, 0x30, 0x67, 0x55, 0x57, 0x64, 0x47, 0x55, 0x55, 0x7A, 0x46, 0x55, 0x77, 0x7C, 0x67, 0x77,
+  0xAA, 0xAA, 0xAA, 0x66, 0x64, 0xA7, 0x64, 0x44, 0x64, 0x97, 0x79, 0x44, 0x64, 0x47, 0x7C, 0x44,
+  0x74, 0x4A, 0x7C, 0x44, 0x7C, 0x44, 0x6C, 0x44, 0x55, 0x64, 0x6C, 0x44, 0x77, 0x7C, 0x7C, 0x44,
+  0x66, 0x6C, 0x7C, 0x80, 0xDF, 0x82, 0xCE, 0x04, 0x77, 0x22, 0x22, 0x23, 0x11, 0x88, 0x03, 0x80,
+  0x17, 0x83, 0x03, 0x18, 0x44, 0x44, 0x86, 0x11, 0x44, 0x4C, 0x61, 0x11, 0xC4, 0x81, 0x11, 0x11,
+  0xC4, 0x71, 0x11, 0x11, 0x88, 0x61, 0x11, 0x11, 0xC5, 0x11, 0x11, 0x11, 0x91, 0x80, 0x03, 0x80,
+  0x0A, 0x06, 0x11, 0x11, 0x16, 0x22, 0x22, 0x11, 0x15, 0x80, 0x03, 0x80, 0x35, 0x07, 0x11, 0x11,
+  0x67, 0x22, 0x11, 0x67, 0x56, 0x72, 0x80, 0x0A, 0x04, 0x67, 0x62, 0x22, 0x22, 0x25, 0x81, 0x59,
+  0x81, 0x23, 0x00, 0x26, 0x80, 0x03, 0x01, 0x22, 0x51, 0x81, 0x21, 0x00, 0x61, 0x80, 0x03, 0x00,
+  0x27, 0x80, 0x03, 0x02, 0x22, 0x51, 0x67, 0x80, 0x1F, 0x01, 0x61, 0x72, 0x81, 0x33, 0x92, 0x00,
+  0x00, 0x16, 0x80, 0x03, 0x00, 0x62, 0x80, 0x3B, 0x81, 0x1F, 0x81, 0x0B, 0x80, 0x05, 0x80, 0x0D,
+  0x02, 0x72, 0x22, 0x61, 0x80, 0x57, 0x00, 0x21, 0x80, 0x3F, 0x00, 0x26, 0x80, 0x03, 0x80, 0x07,
+  0x15, 0x27, 0x61, 0x2B, 0xB8, 0x8B, 0xBB, 0x15, 0xB4, 0x48, 0xBB, 0x11, 0x62, 0x44, 0x4B, 0x11,
+  0x16, 0xB8, 0x2B, 0x11, 0x11, 0x6B, 0xBB, 0x80, 0x2C, 0x80, 0x03, 0x01, 0x11, 0x5B, 0x80, 0x03,
+  0x03, 0x1B, 0x22, 0x22, 0x28, 0x80, 0xC7, 0x85, 0x03, 0x00, 0x24, 0x80, 0x03, 0x04, 0xB4, 0x44,
+  0x22, 0x2D, 0x44, 0x86, 0x03, 0x07, 0x97, 0x75, 0xA4, 0x67, 0x67, 0x55, 0xA4, 0x77, 0x81, 0x03,
+  0x21, 0x65, 0x55, 0xA4, 0x65, 0x67, 0x55, 0x64, 0x47, 0x67, 0x55, 0x7A, 0x46, 0x77, 0x55, 0x7C,
+  0x67, 0x4A, 0xAA, 0xAA, 0xAA, 0x11, 0x32, 0x61, 0x32, 0x11, 0x32, 0x71, 0x17, 0x11, 0x32, 0xC1,
+  0x11, 0x11, 0x1C, 0x80, 0xC9, 0x0F, 0x1B, 0x22, 0x31, 0x11, 0x88, 0x32, 0x31, 0x88, 0x81, 0x13,
+  0x11, 0x33, 0x33, 0x3B, 0x11, 0x44, 0x83, 0x00, 0x00, 0x49, 0x80, 0x03, 0x00, 0x46, 0x91, 0x03,
+  0x80, 0xA7, 0x04, 0x22, 0x77, 0xC2, 0xC7, 0x77, 0x80, 0x47, 0x06, 0x11, 0x44, 0xB2, 0x61, 0x41,
+  0x44, 0xA2, 0x80, 0x03, 0x0A, 0x32, 0x71, 0x44, 0x44, 0x11, 0x11, 0x14, 0x44, 0x11, 0x4B, 0x69,
+  0x81, 0x1F, 0x05, 0x22, 0xC2, 0x22, 0x22, 0x62, 0x72, 0x80, 0x03, 0x00, 0x32, 0x83, 0x03, 0x04,
+  0x19, 0x92, 0x22, 0x22, 0x11, 0x80, 0x03, 0x0B, 0x44, 0x12, 0x22, 0x22, 0xA7, 0x51, 0x11, 0x15,
+  0x22, 0x22, 0x2A, 0xA2, 0x82, 0x27, 0x0C, 0x22, 0x22, 0x55, 0x22, 0x22, 0x5B, 0xBB, 0x22, 0x27,
+  0xBB, 0xBB, 0x22, 0x2B, 0x80, 0x03, 0x03, 0x5B, 0xBB, 0xBB, 0x4B, 0x80, 0x14, 0x00, 0x48, 0x84,
+  0x03, 0x91, 0x00, 0x10, 0xE4, 0x42, 0x2B, 0x92, 0xB4, 0x42, 0x24, 0x49, 0xB4, 0x82, 0x28, 0x44,
+  0xB4, 0x22, 0x22, 0xE9, 0xE8, 0x8F, 0x22, 0x00, 0x28, 0x81, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00,
+  0x82, 0x80, 0x2E, 0x80, 0x0B, 0x80, 0x26, 0x01, 0x22, 0x44, 0x85, 0x03, 0x05, 0x44, 0x97, 0x75,
+  0xA4, 0x44, 0x67, 0x88, 0x03, 0x16, 0x65, 0x75, 0x64, 0x44, 0x65, 0x55, 0x7A, 0x44, 0x77, 0x77,
+  0x5C, 0x44, 0x4A, 0xAA, 0xAA, 0x67, 0x57, 0x64, 0xA7, 0x77, 0x57, 0x64, 0x97, 0x80, 0x03, 0x19,
+  0x47, 0x67, 0x57, 0x74, 0x4A, 0x47, 0x57, 0x7C, 0x44, 0x46, 0x55, 0x77, 0x64, 0x67, 0x77, 0x77,
+  0x7C, 0xAA, 0x66, 0x66, 0x6C, 0x64, 0x44, 0x44, 0x44, 0x79, 0x80, 0x03, 0x00, 0x77, 0x84, 0x03,
+  0x00, 0x67, 0x84, 0x03, 0x85, 0x0F, 0x81, 0x80, 0x0E, 0x27, 0x77, 0xC2, 0xC7, 0x23, 0x11, 0x32,
+  0x61, 0x23, 0x41, 0xB2, 0x61, 0x23, 0x44, 0x72, 0x80, 0x03, 0x05, 0x32, 0x71, 0x23, 0x44, 0x11,
+  0x11, 0x80, 0x03, 0x00, 0x1B, 0x81, 0x1F, 0x18, 0x77, 0x22, 0xC2, 0x22, 0x11, 0x62, 0x72, 0x22,
+  0x41, 0x62, 0x32, 0x22, 0x11, 0x72, 0x32, 0x22, 0x41, 0x19, 0x92, 0x22, 0x11, 0x11, 0x12, 0x22,
+  0x69, 0x80, 0x03, 0x03, 0x22, 0xA7, 0x51, 0x11, 0x80, 0x22, 0x00, 0x2A, 0x88, 0xCF, 0x00, 0x5B,
+  0x80, 0x51, 0x03, 0xBB, 0x22, 0x22, 0x2B, 0x80, 0x03, 0x03, 0x5B, 0xBB, 0x28, 0x4B, 0x80, 0xD0,
+  0x00, 0x48, 0x80, 0xC8, 0x80, 0x03, 0x01, 0x88, 0x2D, 0x84, 0x21, 0x00, 0xDD, 0x8A, 0xFF, 0x01,
+  0x22, 0x88, 0x80, 0xF8, 0x80, 0x8A, 0x86, 0x00, 0x00, 0x84, 0x80, 0x03, 0x02, 0x29, 0xB8, 0x88,
+  0x82, 0x1B, 0x86, 0x14, 0x01, 0x4B, 0xB4, 0x81, 0x42, 0x01, 0x8B, 0x44, 0x81, 0x2B, 0x80, 0x03,
+  0x00, 0x28, 0x84, 0x3B, 0x89, 0x37, 0x85, 0x3B, 0x00, 0x28, 0x81, 0xD7, 0x80, 0x08, 0x01, 0x22,
+  0x2B, 0x80, 0x03, 0x00, 0x26, 0x8B, 0x6B, 0x80, 0x00, 0x03, 0xCC, 0x22, 0x22, 0x23, 0x80, 0xB3,
+  0x04, 0x31, 0x11, 0x22, 0x23, 0x14, 0x80, 0x03, 0x14, 0x4B, 0x2A, 0x22, 0x23, 0x1C, 0x27, 0x22,
+  0x23, 0x62, 0x29, 0x22, 0x2A, 0x36, 0x91, 0x22, 0x2A, 0x11, 0x11, 0x93, 0x31, 0x14, 0x80, 0xFD,
+  0x83, 0x03, 0x0D, 0x1A, 0x26, 0x11, 0x12, 0x1B, 0x22, 0xA1, 0x1A, 0x41, 0x32, 0x2A, 0x11, 0x14,
+  0x1A, 0x80, 0x03, 0x02, 0x41, 0x11, 0x11, 0x80, 0x5E, 0x81, 0x03, 0x81, 0x00, 0x81, 0xFB, 0x01,
+  0x22, 0xAA, 0x80, 0x03, 0x05, 0x11, 0x62, 0x22, 0x22, 0x41, 0xB2, 0x80, 0x07, 0x04, 0x16, 0x22,
+  0x22, 0x14, 0x1B, 0x80, 0x97, 0x80, 0x10, 0x02, 0x11, 0x41, 0xA2, 0x81, 0x9F, 0x80, 0x03, 0x00,
+  0x49, 0x80, 0x03, 0x00, 0x42, 0x84, 0x03, 0x00, 0x48, 0x84, 0x0F, 0x00, 0x4B, 0x82, 0x1B, 0x0D,
+  0x22, 0x22, 0x2E, 0x22, 0x22, 0xE8, 0x44, 0x4B, 0xDD, 0xB4, 0x44, 0x44, 0xDD, 0xEB, 0x81, 0x10,
+  0x00, 0xBB, 0x81, 0x14, 0x8A, 0x00, 0x02, 0xB9, 0x8B, 0x82, 0x88, 0x3F, 0x02, 0xB2, 0x22, 0xE8,
+  0x8D, 0x20, 0x03, 0x88, 0x82, 0x22, 0xE4, 0x80, 0x4C, 0x81, 0x03, 0x87, 0xFB, 0x01, 0xB8, 0x88,
+  0x82, 0x1B, 0x83, 0x80, 0x80, 0x00, 0x00, 0x49, 0x81, 0x7A, 0x80, 0x0A, 0x81, 0x4B, 0x03, 0x82,
+  0x22, 0x22, 0x28, 0x83, 0x3A, 0x84, 0xC7, 0x82, 0x00, 0x00, 0x8B, 0x85, 0x3B, 0x80, 0x44, 0x00,
+  0x22, 0x80, 0x08, 0x02, 0x22, 0x22, 0x2B, 0x80, 0x11, 0x00, 0x4A, 0x89, 0x22, 0x85, 0x00, 0x00,
+  0x46, 0x80, 0x03, 0x00, 0x67, 0x80, 0x06, 0x04, 0x77, 0x44, 0x44, 0x4C, 0x9C, 0x80, 0x03, 0x00,
+  0x99, 0x80, 0x03, 0x00, 0xF5, 0x80, 0x60, 0x00, 0xC6, 0x80, 0x03, 0x07, 0x91, 0x99, 0x2C, 0xC9,
+  0x51, 0x99, 0x99, 0x99, 0x82, 0x03, 0x8D, 0xAA, 0x00, 0x72, 0x84, 0x03, 0x00, 0x52, 0x80, 0x03,
+  0x00, 0x62, 0x80, 0x03, 0x05, 0x71, 0x17, 0x22, 0x22, 0x27, 0x11, 0x80, 0x0D, 0x00, 0x51, 0x80,
+  0x08, 0x01, 0x71, 0x11, 0x81, 0x0C, 0x03, 0x15, 0x22, 0x22, 0x26, 0x82, 0x08, 0x80, 0x1E, 0x07,
+  0x11, 0x26, 0x11, 0x11, 0x72, 0x25, 0x11, 0x11, 0x80, 0x0D, 0x01, 0x11, 0x22, 0x80, 0x07, 0x05,
+  0x72, 0x61, 0x11, 0x11, 0x15, 0x11, 0x83, 0x00, 0x81, 0x07, 0x80, 0x4A, 0x03, 0x56, 0x72, 0x22,
+  0x25, 0x81, 0x3B, 0x06, 0x62, 0x22, 0x27, 0x16, 0x22, 0x22, 0x61, 0x80, 0x4A, 0x80, 0x40, 0x82,
+  0x5F, 0x81, 0x00, 0x03, 0x71, 0x11, 0x11, 0x16, 0x80, 0x37, 0x01, 0x11, 0x22, 0x81, 0x03, 0x80,
+  0x3C, 0x82, 0x03, 0x00, 0x51, 0x84, 0x03, 0x07, 0x21, 0x11, 0x11, 0xBB, 0xBB, 0x44, 0x44, 0x5B,
+  0x80, 0x03, 0x00, 0x64, 0x80, 0xB8, 0x09, 0x12, 0x44, 0x42, 0xBB, 0x16, 0x44, 0x44, 0x2B, 0x11,
+  0x74, 0x80, 0x03, 0x04, 0x6B, 0xB2, 0xBB, 0x11, 0x15, 0x81, 0x1D, 0x83, 0x00, 0x00, 0xB4, 0x80,
+  0x03, 0x01, 0x22, 0x8B, 0x80, 0x03, 0x01, 0x22, 0x84, 0x80, 0x03, 0x00, 0x28, 0x80, 0x03, 0x01,
+  0x22, 0x84, 0x80, 0x03, 0x00, 0x2B, 0x80, 0x16, 0x00, 0x4A, 0x85, 0x23, 0x90, 0x00, 0x00, 0x46,
+  0x80, 0x23, 0x00, 0x23, 0x88, 0x03, 0x09, 0x2A, 0x22, 0xCC, 0x22, 0x2A, 0x23, 0x11, 0x93, 0x31,
+  0x31, 0x82, 0xC2, 0x11, 0x44, 0x44, 0x43, 0x2A, 0x1A, 0x26, 0x16, 0x27, 0x1B, 0x22, 0x62, 0x29,
+  0x11, 0x32, 0x36, 0x91, 0x44, 0x1A, 0x80, 0x12, 0x00, 0x41, 0x80, 0x03, 0x00, 0x44, 0x81, 0x03,
+  0x81, 0x00, 0x0F, 0x11, 0x92, 0x22, 0x22, 0xA1, 0x1A, 0xAA, 0x22, 0x23, 0x11, 0x11, 0x62, 0x2A,
+  0x11, 0x11, 0xB2, 0x80, 0x34, 0x80, 0xA2, 0x01, 0x44, 0x1B, 0x80, 0x19, 0x01, 0x41, 0x44, 0x81,
+  0xD3, 0x94, 0x00, 0x00, 0x62, 0x80, 0x03, 0x00, 0xA2, 0x80, 0x03, 0x81, 0xA8, 0x0C, 0x49, 0x22,
+  0x22, 0xE8, 0x42, 0x22, 0x2D, 0xB4, 0x42, 0x22, 0x22, 0xEB, 0x48, 0x83, 0x0F, 0x01, 0x22, 0x4B,
+  0x84, 0x1B, 0x00, 0x2E, 0x81, 0x07, 0x01, 0x4B, 0xB9, 0x80, 0xD9, 0x83, 0x00, 0x81, 0xF0, 0x02,
+  0x2D, 0x22, 0xE8, 0x8A, 0x4B, 0x07, 0x82, 0x22, 0x22, 0x88, 0x42, 0x22, 0xE4, 0x44, 0x81, 0x03,
+  0x00, 0xB2, 0x87, 0xFB, 0x00, 0x29, 0x84, 0x1E, 0x03, 0x44, 0x82, 0x22, 0x2D, 0x85, 0x3E, 0x00,
+  0x48, 0x85, 0x08, 0x03, 0xB8, 0x88, 0x22, 0x28, 0x82, 0x1C, 0x84, 0x00, 0x00, 0x49, 0x80, 0x03,
+  0x02, 0x22, 0x22, 0x8B, 0x80, 0x2B, 0x01, 0x22, 0x84, 0x80, 0x03, 0x82, 0x1B, 0x89, 0x1F, 0x8D,
+  0x00, 0x00, 0x84, 0x80, 0x03, 0x00, 0x2B, 0x80, 0x03, 0x00, 0x26, 0x8E, 0xD9, 0x24, 0xCC, 0x22,
+  0x22, 0x23, 0x11, 0x13, 0x22, 0x31, 0x11, 0x11, 0x23, 0x11, 0x44, 0x41, 0x23, 0x13, 0x2A, 0x1A,
+  0x23, 0x16, 0x27, 0x1B, 0x23, 0x62, 0x29, 0x11, 0x2A, 0x36, 0x91, 0x14, 0x2A, 0x11, 0x11, 0x14,
+  0x31, 0x44, 0x41, 0x80, 0x39, 0x83, 0x03, 0x11, 0x26, 0x11, 0x12, 0x22, 0x22, 0xA1, 0x1A, 0xAA,
+  0x32, 0x23, 0x11, 0x11, 0x1A, 0x2A, 0x44, 0x44, 0x11, 0x11, 0x88, 0x64, 0x02, 0x41, 0x11, 0x11,
+  0x85, 0x55, 0x00, 0x62, 0x80, 0x03, 0x00, 0xB2, 0x80, 0x03, 0x00, 0x16, 0x80, 0x03, 0x00, 0x1B,
+  0x80, 0x03, 0x00, 0x41, 0x80, 0x10, 0x01, 0x41, 0xA2, 0x81, 0x9F, 0x80, 0x03, 0x00, 0x49, 0x80,
+  0x03, 0x00, 0x42, 0x80, 0xE4, 0x00, 0x42, 0x80, 0x07, 0x00, 0x48, 0x84, 0x0F, 0x00, 0x4B, 0x83,
+  0x1B, 0x08, 0x22, 0x2E, 0x22, 0x22, 0xE8, 0x44, 0x4B, 0xBB, 0xB4, 0x80, 0x4E, 0x00, 0xEB, 0x81,
+  0xE3, 0x00, 0xBB, 0x82, 0x15, 0x00, 0xE8, 0x8E, 0xB6, 0x95, 0x00, 0x00, 0x28, 0x82, 0x61, 0x00,
+  0x44, 0x80, 0x5D, 0x83, 0x03, 0x81, 0x0B, 0x81, 0x13, 0x80, 0xFC, 0x00, 0x2E, 0x81, 0x4F, 0x00,
+  0x61, 0x80, 0x03, 0x0E, 0x91, 0x44, 0x44, 0x27, 0x11, 0x44, 0x11, 0x27, 0x14, 0x44, 0x1B, 0x23,
+  0x14, 0x44, 0x16, 0x80, 0x03, 0x04, 0x1C, 0x29, 0x14, 0x44, 0x12, 0x80, 0x03, 0x03, 0x16, 0x44,
+  0x14, 0x14, 0x80, 0xD4, 0x08, 0x14, 0x44, 0x13, 0x67, 0x31, 0x11, 0xC2, 0x22, 0x2A, 0x81, 0xCF,
+  0x00, 0x91, 0x80, 0x03, 0x00, 0x34, 0x80, 0x03, 0x00, 0x31, 0x81, 0x03, 0x05, 0x44, 0x11, 0x36,
+  0x22, 0x44, 0x13, 0x80, 0xCB, 0x80, 0xDC, 0x81, 0xCF, 0x82, 0xD7, 0x80, 0x0B, 0x01, 0x44, 0x1A,
+  0x80, 0x03, 0x0C, 0x11, 0xA2, 0x22, 0x27, 0x14, 0x32, 0x22, 0x22, 0xA1, 0x12, 0x22, 0x22, 0x21,
+  0x8C, 0x03, 0x05, 0xC1, 0x32, 0x22, 0x26, 0x91, 0x62, 0x80, 0x8D, 0x01, 0x44, 0x82, 0x80, 0x03,
+  0x00, 0xB2, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00, 0x49, 0x80, 0x03, 0x8A, 0x00, 0x8D, 0xCE,
+  0x00, 0x92, 0x80, 0x03, 0x01, 0x4B, 0x82, 0x81, 0xC5, 0x01, 0x4B, 0x98, 0x91, 0x1F, 0x89, 0x00,
+  0x01, 0x4B, 0x98, 0x80, 0x28, 0x80, 0xEC, 0x80, 0x04, 0x80, 0x03, 0x00, 0x2D, 0x84, 0x03, 0x81,
+  0x0B, 0x81, 0x13, 0x03, 0x2B, 0x44, 0x22, 0x2E, 0x81, 0x3F, 0x00, 0x61, 0x80, 0xD3, 0x04, 0x91,
+  0x44, 0x22, 0x27, 0x11, 0x83, 0x03, 0x00, 0x23, 0x84, 0x03, 0x00, 0x29, 0x83, 0x03, 0x03, 0x99,
+  0x99, 0x99, 0x51, 0x80, 0x03, 0x0D, 0x91, 0x99, 0x9C, 0xF8, 0xC6, 0x9C, 0x44, 0x44, 0x47, 0x9F,
+  0x44, 0x44, 0x48, 0x94, 0x80, 0x77, 0x81, 0x03, 0x80, 0x0B, 0x01, 0x44, 0x11, 0x90, 0x00, 0x00,
+  0x71, 0x80, 0x03, 0x00, 0xC1, 0x80, 0x03, 0x00, 0xC5, 0x80, 0x03, 0x00, 0x62, 0x80, 0x70, 0x80,
+  0xED, 0x82, 0x03, 0x00, 0x17, 0x80, 0x03, 0x00, 0x16, 0x80, 0x03, 0x01, 0x11, 0x72, 0x80, 0x03,
+  0x80, 0x0C, 0x03, 0x11, 0x11, 0x65, 0x56, 0x81, 0x0E, 0x84, 0x03, 0x00, 0x61, 0x84, 0x03, 0x80,
+  0x0B, 0x06, 0x26, 0x11, 0x22, 0x76, 0x11, 0x11, 0x61, 0x82, 0x4D, 0x00, 0x16, 0x80, 0x27, 0x00,
+  0x11, 0x81, 0x03, 0x00, 0x12, 0x81, 0x0C, 0x8D, 0x6B, 0x8D, 0xF3, 0x80, 0x5A, 0x00, 0x25, 0x80,
+  0x73, 0x06, 0x21, 0x15, 0x22, 0x22, 0x71, 0x11, 0x52, 0x80, 0x4F, 0x00, 0x21, 0x80, 0x23, 0x81,
+  0x03, 0x03, 0x51, 0x11, 0x11, 0x26, 0x80, 0x2F, 0x83, 0x53, 0x8A, 0x41, 0x03, 0x2D, 0x11, 0x11,
+  0xD2, 0x94, 0x03, 0x01, 0x22, 0x2D, 0x80, 0x52, 0x00, 0xD8, 0x8C, 0x62, 0x81, 0x13, 0x00, 0x28,
+  0x80, 0x03, 0x04, 0x2B, 0x22, 0x22, 0x2E, 0x44, 0x84, 0xB3, 0x03, 0x91, 0x22, 0x22, 0x27, 0x80,
+  0x8B, 0x81, 0x03, 0x00, 0x2A, 0x80, 0x03, 0x00, 0x23, 0x80, 0x03, 0x00, 0x29, 0x82, 0x03, 0x02,
+  0x11, 0x11, 0x44, 0x81, 0x00, 0x0E, 0x11, 0x44, 0x11, 0x13, 0x67, 0x44, 0x4B, 0xC2, 0x22, 0x44,
+  0x16, 0x22, 0x22, 0x44, 0x1C, 0x80, 0x03, 0x00, 0x12, 0x80, 0x03, 0x81, 0x0B, 0x02, 0x44, 0x44,
+  0x41, 0x80, 0x03, 0x14, 0x13, 0x31, 0x44, 0x44, 0xB2, 0x2A, 0x44, 0x44, 0xA2, 0x22, 0x91, 0x41,
+  0x62, 0x22, 0x34, 0x44, 0xB2, 0x22, 0x31, 0x44, 0x1A, 0x80, 0x07, 0x01, 0x11, 0x36, 0x82, 0x53,
+  0x01, 0x22, 0xA1, 0x80, 0x03, 0x00, 0x21, 0x8C, 0x03, 0x05, 0xC1, 0xA2, 0x22, 0x2C, 0x91, 0x32,
+  0x80, 0x08, 0x00, 0x92, 0x88, 0x03, 0x80, 0x56, 0x82, 0x03, 0x81, 0x17, 0x00, 0x62, 0x80, 0x03,
+  0x01, 0x44, 0x82, 0x80, 0x03, 0x00, 0xB2, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00, 0x49, 0x81,
+  0x6F, 0x00, 0x92, 0x80, 0x03, 0x01, 0x4B, 0x82, 0x82, 0x95, 0x80, 0x00, 0x8C, 0xDB, 0x86, 0x00,
+  0x01, 0x4B, 0x98, 0x81, 0x2B, 0x81, 0x05, 0x97, 0x00, 0x80, 0x5A, 0x9D, 0x00, 0x01, 0x2E, 0x28,
+  0x81, 0x63, 0x83, 0x03, 0x00, 0x49, 0x84, 0x03, 0x00, 0x46, 0x80, 0x13, 0x04, 0x46, 0x2B, 0x44,
+  0x44, 0x47, 0x80, 0x16, 0x1B, 0x47, 0x61, 0x14, 0x44, 0x11, 0x91, 0x44, 0x44, 0x41, 0x11, 0x44,
+  0x44, 0x13, 0x11, 0x44, 0x1B, 0xC2, 0x11, 0x44, 0x46, 0x22, 0x11, 0x44, 0x1C, 0x22, 0x41, 0x44,
+  0x12, 0x80, 0x03, 0x00, 0x16, 0x80, 0x2E, 0x02, 0x41, 0x44, 0x11, 0x80, 0x03, 0x05, 0x67, 0x31,
+  0x41, 0x44, 0x22, 0x2A, 0x80, 0x03, 0x01, 0x22, 0xB1, 0x80, 0x03, 0x00, 0x31, 0x80, 0x03, 0x00,
+  0x34, 0x82, 0x03, 0x04, 0x41, 0x36, 0x22, 0x27, 0x13, 0x80, 0x68, 0x80, 0xE2, 0x01, 0x22, 0xA2,
+  0x84, 0xF3, 0x81, 0x0B, 0x00, 0x1A, 0x80, 0x03, 0x05, 0x41, 0xA2, 0x22, 0x2C, 0x11, 0x32, 0x80,
+  0x2D, 0x03, 0x92, 0x22, 0x22, 0xC1, 0x80, 0x03, 0x00, 0x21, 0x81, 0x03, 0x00, 0x12, 0x83, 0x03,
+  0x00, 0xC1, 0x80, 0x17, 0x00, 0x91, 0x80, 0x2C, 0x02, 0x44, 0x44, 0x82, 0x80, 0x03, 0x00, 0xB2,
+  0x80, 0x03, 0x00, 0x42, 0x84, 0x9E, 0x01, 0x44, 0x92, 0x80, 0x03, 0x00, 0x4B, 0x80, 0x03, 0x82,
+  0x00, 0x95, 0xF7, 0x02, 0x44, 0x4B, 0x98, 0x81, 0x2B, 0x08, 0x4B, 0xA5, 0xBB, 0xBB, 0xBB, 0x22,
+  0x22, 0x2A, 0xAA, 0x88, 0x1E, 0x07, 0x7E, 0x22, 0x22, 0x27, 0x99, 0x22, 0x22, 0x29, 0x80, 0x03,
+  0x01, 0x8D, 0xE8, 0x80, 0x1E, 0x03, 0xB5, 0x55, 0x55, 0x57, 0x86, 0x1C, 0x08, 0xD8, 0x8D, 0xEE,
+  0x72, 0x96, 0x66, 0x69, 0x98, 0x66, 0x81, 0x00, 0x02, 0x68, 0x86, 0x66, 0x81, 0xB3, 0x8D, 0x00,
+  0x00, 0x72, 0x80, 0x03, 0x00, 0x67, 0x80, 0x03, 0x00, 0x6D, 0x80, 0x03, 0x09, 0x23, 0x14, 0x44,
+  0x1B, 0x27, 0x14, 0x44, 0x41, 0x22, 0x11, 0x80, 0x8B, 0x0E, 0x31, 0x11, 0x44, 0x22, 0xC1, 0x14,
+  0x44, 0x22, 0x26, 0x11, 0x11, 0x22, 0x22, 0xCA, 0x39, 0x81, 0x2B, 0x00, 0xC2, 0x80, 0xDE, 0x06,
+  0xB2, 0x22, 0x2A, 0x11, 0x11, 0xB3, 0x91, 0x80, 0x25, 0x04, 0x11, 0x14, 0x44, 0x44, 0x11, 0x80,
+  0x01, 0x01, 0x14, 0x11, 0x80, 0x00, 0x02, 0x3A, 0xC6, 0x66, 0x80, 0xA7, 0x02, 0x41, 0x19, 0x3A,
+  0x80, 0xA7, 0x80, 0x3D, 0x00, 0x44, 0x80, 0x1B, 0x09, 0x44, 0x19, 0x41, 0x11, 0x13, 0x62, 0x19,
+  0x36, 0x22, 0x22, 0x80, 0xFA, 0x82, 0x00, 0x05, 0x31, 0x1B, 0x22, 0x22, 0x11, 0x16, 0x80, 0x03,
+  0x0C, 0x62, 0x22, 0x7D, 0xA2, 0x22, 0x2D, 0x55, 0x22, 0x22, 0x55, 0x55, 0x22, 0x29, 0x80, 0x03,
+  0x04, 0x75, 0x5D, 0x55, 0x22, 0x55, 0x81, 0x89, 0x03, 0xAA, 0x75, 0x27, 0x51, 0x81, 0x4E, 0x8F,
+  0x00, 0x00, 0x27, 0x80, 0x03, 0x00, 0x57, 0x80, 0xC0, 0x02, 0x11, 0x11, 0x52, 0x80, 0x03, 0x01,
+  0x11, 0x15, 0x91, 0x23, 0x89, 0xD3, 0x01, 0x11, 0x5A, 0x81, 0x2B, 0x00, 0x12, 0x81, 0x2B, 0x00,
+  0xA2, 0x80, 0x03, 0x00, 0x1A, 0x81, 0x1F, 0x03, 0x44, 0xB8, 0xE2, 0x22, 0x80, 0x97, 0x00, 0x4B,
+  0x80, 0x03, 0x89, 0x00, 0x00, 0x49, 0x80, 0x03, 0x00, 0x47, 0x80, 0x03, 0x01, 0x78, 0xBB, 0x80,
+  0x00, 0x03, 0xAA, 0x55, 0x55, 0x57, 0x85, 0x47, 0x11, 0x7E, 0xD8, 0x8D, 0xDD, 0x99, 0x99, 0x66,
+  0x33, 0x66, 0x66, 0x66, 0x33, 0xE8, 0x66, 0x96, 0x33, 0xB2, 0x84, 0x8B, 0x38, 0x81, 0x0E, 0x00,
+  0x17, 0x80, 0x04, 0x01, 0x16, 0x78, 0x80, 0x03, 0x08, 0x72, 0x44, 0x44, 0x22, 0x23, 0x11, 0x44,
+  0x22, 0x27, 0x80, 0x03, 0x00, 0x22, 0x81, 0x03, 0x00, 0x31, 0x80, 0x03, 0x04, 0xC1, 0x41, 0x22,
+  0x22, 0x26, 0x81, 0x97, 0x00, 0xCA, 0x81, 0x4F, 0x01, 0x4B, 0xC2, 0x80, 0x19, 0x00, 0xB2, 0x80,
+  0x21, 0x04, 0x11, 0xB3, 0x91, 0x44, 0x11, 0x84, 0x01, 0x80, 0x00, 0x08, 0x31, 0x11, 0x11, 0x19,
+  0x22, 0xC6, 0xC6, 0x22, 0xC9, 0x80, 0xA3, 0x01, 0x99, 0x91, 0x80, 0x03, 0x00, 0x95, 0x80, 0x03,
+  0x01, 0x99, 0x51, 0x80, 0x03, 0x09, 0x95, 0x11, 0x99, 0x9C, 0xCF, 0x21, 0xC8, 0xF4, 0x44, 0x48,
+  0x81, 0x27, 0x91, 0xF3, 0x81, 0x00, 0x00, 0x61, 0x80, 0x03, 0x00, 0x42, 0x81, 0x08, 0x01, 0x16,
+  0x56, 0x95, 0x22, 0xA1, 0x00, 0x25, 0x68, 0x33, 0x33, 0xBB, 0xBB, 0x33, 0x37, 0x55, 0x55, 0x33,
+  0x62, 0x22, 0x22, 0x33, 0x72, 0x22, 0x22, 0x39, 0x7E, 0xD8, 0x8D, 0x37, 0x99, 0x66, 0x66, 0xD9,
+  0x99, 0x99, 0x99, 0x8D, 0xE8, 0x96, 0x98, 0xBB, 0xB5, 0xA2, 0x22, 0x57, 0x81, 0xC8, 0x84, 0x00,
+  0x00, 0xEE, 0x80, 0x23, 0x0A, 0x99, 0x98, 0x72, 0x22, 0x69, 0x66, 0x97, 0x22, 0x89, 0x66, 0x6D,
+  0x80, 0x11, 0x00, 0x23, 0x80, 0xEB, 0x00, 0x27, 0x80, 0xF7, 0x00, 0x22, 0x81, 0xF3, 0x00, 0x31,
+  0x80, 0x03, 0x00, 0xC1, 0x80, 0x03, 0x00, 0x26, 0x85, 0x2F, 0x07, 0x44, 0x4B, 0xC2, 0x22, 0x44,
+  0x41, 0xB2, 0x22, 0x80, 0x6B, 0x00, 0x33, 0x80, 0x03, 0x0B, 0x41, 0x11, 0x11, 0x44, 0x41, 0x11,
+  0x14, 0x44, 0x44, 0xCA, 0x39, 0x11, 0x80, 0x2F, 0x0A, 0xC6, 0x66, 0x22, 0x31, 0x44, 0x44, 0x27,
+  0x11, 0x44, 0x44, 0x91, 0x80, 0x03, 0x00, 0x14, 0x83, 0x03, 0x06, 0x41, 0x44, 0x44, 0x19, 0x36,
+  0x19, 0x3A, 0x80, 0x90, 0x80, 0x00, 0x10, 0x19, 0x3A, 0xA1, 0x1B, 0x44, 0x11, 0x14, 0x16, 0x44,
+  0x11, 0x19, 0x62, 0x44, 0x19, 0xA2, 0x22, 0x93, 0x83, 0x16, 0x00, 0x29, 0x80, 0x03, 0x00, 0x75,
+  0x80, 0x03, 0x00, 0x55, 0x83, 0x65, 0x06, 0x27, 0x51, 0x22, 0xA5, 0x11, 0x11, 0x25, 0x88, 0xD8,
+  0x00, 0x15, 0x80, 0x03, 0x07, 0xA2, 0x22, 0x27, 0x11, 0xAA, 0x75, 0x55, 0xA2, 0x98, 0xFF, 0x81,
+  0xB3, 0x01, 0x22, 0x52, 0x81, 0xBC, 0x01, 0x15, 0x72, 0x81, 0xA3, 0x00, 0x5A, 0x90, 0x1F, 0x00,
+  0xA5, 0x88, 0xFE, 0x01, 0x22, 0x12, 0x81, 0x2B, 0x00, 0xA2, 0x80, 0x03, 0x00, 0x1A, 0x80, 0x03,
+  0x80, 0x1D, 0x00, 0xBB, 0x80, 0x00, 0x02, 0x22, 0x2A, 0xAA, 0x84, 0x87, 0x81, 0x00, 0x13, 0x7E,
+  0xD8, 0x22, 0x27, 0x99, 0x66, 0x22, 0x29, 0x66, 0x66, 0x22, 0x8D, 0xE8, 0x66, 0xBB, 0xBB, 0xB5,
+  0xA2, 0x55, 0x57, 0x87, 0x1D, 0x13, 0x8D, 0xEE, 0x72, 0x22, 0x66, 0x66, 0x98, 0x72, 0x66, 0x66,
+  0x99, 0x97, 0x98, 0x86, 0x99, 0x9D, 0x44, 0x44, 0x44, 0x46, 0x80, 0x03, 0x00, 0x49, 0x80, 0x03,
+  0x92, 0x00, 0x08, 0x11, 0x44, 0x1B, 0xC2, 0x14, 0x44, 0x41, 0xB2, 0x14, 0x80, 0x0A, 0x00, 0x34,
+  0x80, 0x0F, 0x00, 0xC1, 0x80, 0x08, 0x06, 0x26, 0x11, 0x44, 0x44, 0x22, 0xCA, 0x39, 0x81, 0x9B,
+  0x04, 0xC6, 0x22, 0x22, 0x31, 0x14, 0x80, 0xE6, 0x09, 0x14, 0x33, 0x91, 0x14, 0x14, 0x14, 0x41,
+  0x14, 0x14, 0x44, 0x80, 0x04, 0x08, 0x11, 0x14, 0x41, 0x19, 0x11, 0x11, 0x3A, 0x62, 0x66, 0x80,
+  0x20, 0x06, 0x41, 0x19, 0x3A, 0xA1, 0x44, 0x41, 0x11, 0x80, 0x31, 0x81, 0x03, 0x06, 0x19, 0xA2,
+  0x11, 0x13, 0x62, 0x22, 0x36, 0x88, 0xCF, 0x00, 0x1B, 0x80, 0x03, 0x10, 0x16, 0x22, 0x22, 0x27,
+  0x62, 0x22, 0x7D, 0x55, 0x22, 0x2D, 0x55, 0x55, 0x22, 0x55, 0x55, 0x55, 0x29, 0x80, 0x03, 0x01,
+  0x75, 0x5D, 0x80, 0x04, 0x08, 0x72, 0x22, 0x27, 0x22, 0xAA, 0x75, 0x55, 0x51, 0x11, 0x97, 0x00,
+  0x00, 0xA2, 0x80, 0x3F, 0x01, 0x11, 0x52, 0x80, 0x03, 0x02, 0x11, 0x15, 0x72, 0x91, 0x1F, 0x3C,
+  0x22, 0x2D, 0xD2, 0x2D, 0x22, 0x79, 0xE2, 0x28, 0x22, 0xE9, 0xD2, 0x79, 0x22, 0xE9, 0x99, 0x99,
+  0x22, 0xF8, 0x69, 0x66, 0x22, 0x27, 0x97, 0xE9, 0xA2, 0x27, 0x92, 0xF9, 0xA2, 0x2F, 0x68, 0x86,
+  0x68, 0xF2, 0x29, 0x66, 0x6F, 0x22, 0x28, 0x66, 0x62, 0x22, 0x28, 0x68, 0x6E, 0x77, 0xDD, 0xE2,
+  0x69, 0x99, 0x72, 0x22, 0x99, 0x99, 0xF2, 0x22, 0x82, 0x79, 0x22, 0x22, 0x8F, 0x80, 0x03, 0x00,
+  0x57, 0x80, 0x5F, 0x03, 0xF2, 0x22, 0x22, 0x67, 0x80, 0xE7, 0x0D, 0x11, 0x22, 0x71, 0x11, 0x88,
+  0x27, 0x11, 0x11, 0x88, 0xC1, 0x11, 0x88, 0x88, 0x31, 0x80, 0x03, 0x80, 0x02, 0x01, 0x81, 0x44,
+  0x80, 0x00, 0x03, 0x66, 0x66, 0x66, 0x69, 0x80, 0xAD, 0x00, 0x57, 0x80, 0x03, 0x81, 0x00, 0x0C,
+  0x77, 0x77, 0xC7, 0x77, 0x7A, 0x76, 0x44, 0x77, 0xC4, 0xA4, 0x44, 0x67, 0xC4, 0x81, 0x1F, 0x0B,
+  0x99, 0x9A, 0x44, 0x44, 0x77, 0x77, 0x7C, 0x94, 0x77, 0x55, 0x55, 0x76, 0x80, 0x03, 0x01, 0x77,
+  0xA7, 0x80, 0x24, 0x05, 0x4A, 0x75, 0x55, 0x55, 0x44, 0x97, 0x80, 0x03, 0x88, 0x00, 0x00, 0xA4,
+  0x80, 0x03, 0x00, 0x76, 0x80, 0x03, 0x04, 0x77, 0x64, 0x44, 0x44, 0x55, 0x80, 0x08, 0x08, 0x55,
+  0x77, 0xA4, 0x44, 0x25, 0x11, 0x22, 0x22, 0x21, 0x80, 0x03, 0x00, 0x71, 0x80, 0x03, 0x00, 0x51,
+  0x82, 0x03, 0x00, 0xA2, 0x80, 0x03, 0x00, 0x12, 0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x80, 0xF9,
+  0x00, 0x25, 0x80, 0xE3, 0x82, 0x1D, 0x01, 0x22, 0xC1, 0x80, 0x03, 0x00, 0x27, 0x80, 0x03, 0x8A,
+  0x00, 0x00, 0x11, 0x8C, 0x00, 0x01, 0x21, 0x11, 0x80, 0x38, 0x01, 0x11, 0x1A, 0x80, 0x18, 0x00,
+  0xC2, 0x80, 0x35, 0x00, 0xC2, 0x88, 0x1F, 0x00, 0x1C, 0x80, 0x52, 0x02, 0x52, 0x27, 0xA2, 0x8C,
+  0x3F, 0x45, 0x52, 0x22, 0x2D, 0xE2, 0x12, 0x22, 0x79, 0xE2, 0x15, 0x22, 0xE9, 0xD2, 0x11, 0x22,
+  0xE6, 0x99, 0x11, 0x22, 0xF8, 0x69, 0x71, 0x22, 0x27, 0x67, 0x21, 0xA2, 0x27, 0x92, 0x25, 0xA2,
+  0x27, 0x98, 0x2D, 0x68, 0xF9, 0x33, 0x28, 0x9F, 0x29, 0x33, 0x79, 0x6F, 0x29, 0x33, 0x99, 0x6E,
+  0x79, 0x33, 0x99, 0x66, 0x96, 0x33, 0xE9, 0x99, 0x96, 0x33, 0xF9, 0x82, 0x79, 0x27, 0x89, 0x9F,
+  0x78, 0x22, 0x16, 0x78, 0x44, 0x44, 0x16, 0xD4, 0x80, 0x03, 0x10, 0x44, 0x44, 0xC9, 0x15, 0x44,
+  0x89, 0x99, 0x15, 0x48, 0x99, 0x99, 0x18, 0x49, 0x99, 0x99, 0x44, 0xC9, 0x80, 0x03, 0x00, 0x99,
+  0x80, 0x03, 0x80, 0x00, 0x04, 0xA9, 0x66, 0x66, 0x66, 0x77, 0x84, 0x00, 0x0B, 0x55, 0x55, 0x75,
+  0x55, 0x55, 0x55, 0xC7, 0x75, 0x57, 0x76, 0x44, 0x77, 0x80, 0xFE, 0x00, 0x67, 0x81, 0x1F, 0x02,
+  0x69, 0x99, 0x9A, 0x80, 0x0C, 0x03, 0x77, 0x7C, 0x55, 0x55, 0x81, 0x1F, 0x0C, 0x57, 0x57, 0x7A,
+  0xA7, 0x77, 0x64, 0xC4, 0x4A, 0x76, 0x44, 0xC4, 0x44, 0xA4, 0x81, 0x1E, 0x82, 0x00, 0x00, 0x94,
+  0x80, 0x03, 0x00, 0x76, 0x80, 0x03, 0x00, 0x64, 0x86, 0x11, 0x84, 0x00, 0x04, 0x81, 0x11, 0x11,
+  0x44, 0x44, 0x84, 0x03, 0x00, 0x48, 0x84, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00, 0x41, 0x80, 0x03,
+  0x00, 0x21, 0x87, 0xFD, 0x8D, 0x00, 0x00, 0x15, 0x80, 0x03, 0x01, 0x52, 0x71, 0x81, 0x09, 0x1A,
+  0x16, 0x82, 0x11, 0x11, 0x68, 0x87, 0x11, 0x11, 0x24, 0xC7, 0x11, 0x17, 0x44, 0xC7, 0x11, 0x74,
+  0x44, 0xF9, 0x17, 0x44, 0x44, 0x48, 0x14, 0x44, 0x44, 0x4F, 0x12, 0x80, 0x5E, 0x3F, 0xE2, 0x2D,
+  0x98, 0xF2, 0xE2, 0x28, 0x6F, 0x22, 0xD2, 0x79, 0x6F, 0x22, 0x69, 0x99, 0x6E, 0x77, 0x69, 0x69,
+  0x69, 0x99, 0x97, 0xE9, 0x68, 0x96, 0x92, 0xF9, 0x82, 0x79, 0x98, 0x89, 0x8F, 0x79, 0x65, 0xEE,
+  0xE7, 0x22, 0x21, 0xEE, 0xF2, 0x22, 0x21, 0x5F, 0x22, 0x22, 0xDD, 0x32, 0x22, 0x71, 0x72, 0x22,
+  0x27, 0x11, 0x62, 0x22, 0xC1, 0x18, 0x22, 0x22, 0x31, 0x11, 0x22, 0x22, 0x11, 0x88, 0x82, 0xA3,
+  0x03, 0xA9, 0x66, 0x66, 0x67, 0x80, 0xD9, 0x80, 0x02, 0x82, 0xFD, 0x80, 0x09, 0x06, 0xC7, 0x55,
+  0x55, 0x76, 0x44, 0x55, 0x57, 0x81, 0xD5, 0x07, 0x44, 0x44, 0x66, 0x69, 0x99, 0x9A, 0x55, 0x57,
+  0x81, 0xFB, 0x81, 0x1A, 0x0D, 0x57, 0x55, 0x75, 0x7A, 0xA7, 0x55, 0x77, 0xC4, 0x4A, 0x77, 0x67,
+  0xC4, 0x44, 0x97, 0x85, 0xE6, 0x00, 0x7C, 0x80, 0x2A, 0x05, 0x57, 0x76, 0xA4, 0x44, 0x55, 0x77,
+  0x80, 0x37, 0x02, 0x77, 0x77, 0x64, 0x80, 0x03, 0x00, 0x76, 0x81, 0x2D, 0x02, 0x22, 0x22, 0x25,
+  0x80, 0x67, 0x00, 0x21, 0x80, 0x03, 0x00, 0x71, 0x80, 0x03, 0x00, 0xD1, 0x8A, 0x03, 0x02, 0xF2,
+  0x22, 0x51, 0x80, 0x07, 0x01, 0x22, 0x25, 0x80, 0x03, 0x86, 0x00, 0x00, 0x72, 0x80, 0x03, 0x00,
+  0x12, 0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x01, 0x11, 0x52, 0x80, 0x03, 0x80, 0x00, 0x00, 0x71,
+  0x80, 0x03, 0x80, 0x2A, 0x00, 0x11, 0x80, 0xBA, 0x84, 0x4B, 0x00, 0x22, 0x84, 0x03, 0x81, 0x19,
+  0x8A, 0x00, 0x05, 0x15, 0x11, 0x15, 0xA2, 0x22, 0x1A, 0x80, 0x1C, 0x00, 0xC2, 0x84, 0x03, 0x00,
+  0x11, 0x80, 0x44, 0x09, 0x11, 0x11, 0x12, 0x22, 0x1C, 0x51, 0x15, 0x22, 0x52, 0x27, 0x85, 0x3A,
+  0x00, 0x71, 0x80, 0x03, 0x01, 0x21, 0xA2, 0x80, 0x7A, 0x3C, 0xA2, 0x2D, 0xE2, 0x2D, 0x68, 0x79,
+  0xE2, 0x28, 0x6F, 0x79, 0xD2, 0x79, 0x6F, 0xE9, 0x99, 0x99, 0x9E, 0xF8, 0x69, 0x69, 0x99, 0x27,
+  0x97, 0xE9, 0x99, 0x27, 0x92, 0xF9, 0x82, 0x27, 0x68, 0x89, 0x8F, 0xF2, 0x29, 0x66, 0x97, 0x22,
+  0x28, 0x66, 0x82, 0x22, 0x28, 0x98, 0x22, 0x77, 0xDD, 0xE2, 0x22, 0x99, 0x72, 0x22, 0x27, 0x96,
+  0xF2, 0x22, 0x28, 0x79, 0x22, 0x22, 0xE8, 0x80, 0x03, 0x00, 0x88, 0x83, 0xFD, 0x07, 0xA9, 0x66,
+  0x44, 0x67, 0x77, 0x77, 0x97, 0x77, 0x80, 0xF5, 0x04, 0x77, 0x75, 0x75, 0x77, 0x55, 0x81, 0x03,
+  0x81, 0xFF, 0x01, 0x77, 0xA4, 0x81, 0x1D, 0x03, 0x66, 0x66, 0x69, 0x99, 0x80, 0x18, 0x00, 0x77,
+  0x80, 0x0F, 0x80, 0x1E, 0x0C, 0x55, 0x77, 0xC7, 0x75, 0x7A, 0xA7, 0x44, 0x77, 0xC4, 0x4A, 0x44,
+  0x65, 0xC4, 0x82, 0x3D, 0x00, 0x9A, 0x80, 0x03, 0x08, 0x77, 0x7C, 0x94, 0x44, 0x57, 0x75, 0x76,
+  0xA4, 0x57, 0x80, 0x37, 0x80, 0x03, 0x00, 0x57, 0x81, 0x4A, 0x03, 0x97, 0x55, 0x77, 0x75, 0x80,
+  0xA8, 0x00, 0x2D, 0x80, 0x03, 0x00, 0x25, 0x80, 0x03, 0x81, 0x0B, 0x00, 0xD5, 0x81, 0x03, 0x00,
+  0x32, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x03, 0x81, 0x62, 0x22, 0xD5, 0x85, 0xD1, 0x86, 0x03,
+  0x80, 0xD5, 0x80, 0xEE, 0x02, 0x22, 0x11, 0x15, 0x83, 0xFB, 0x05, 0x25, 0x11, 0x11, 0x11, 0x22,
+  0x71, 0x80, 0x03, 0x01, 0x22, 0xC1, 0x80, 0x03, 0x00, 0x27, 0x81, 0x22, 0x00, 0x21, 0x80, 0x03,
+  0x85, 0x00, 0x80, 0x19, 0x8D, 0x00, 0x03, 0x15, 0xA2, 0x11, 0x1A, 0x80, 0x3B, 0x00, 0xC2, 0x83,
+  0x03, 0x0C, 0xA2, 0x27, 0x98, 0x78, 0x52, 0x27, 0x97, 0x2E, 0x52, 0x22, 0x72, 0x27, 0x52, 0x80,
+  0x30, 0x1B, 0xA2, 0x22, 0xE2, 0x2D, 0x22, 0x27, 0x82, 0x29, 0x22, 0x27, 0x92, 0xF9, 0x22, 0x2F,
+  0x98, 0x89, 0x69, 0x99, 0x22, 0x27, 0x68, 0xD8, 0x22, 0x28, 0xE7, 0x27, 0x22, 0x28, 0x80, 0x1E,
+  0x15, 0x78, 0x72, 0x22, 0x22, 0xE8, 0x82, 0x7D, 0x22, 0xE8, 0x68, 0x88, 0x22, 0xE8, 0x66, 0x98,
+  0x22, 0x78, 0x75, 0x77, 0x77, 0x64, 0x7C, 0x80, 0xE0, 0x00, 0x74, 0x80, 0xE3, 0x81, 0x03, 0x00,
+  0x76, 0x81, 0xEB, 0x00, 0xA4, 0x80, 0x03, 0x80, 0xFA, 0x00, 0x55, 0x81, 0x08, 0x01, 0x44, 0x67,
+  0x80, 0x09, 0x00, 0x67, 0x80, 0x1A, 0x00, 0x97, 0x80, 0x03, 0x01, 0x67, 0x59, 0x80, 0x03, 0x00,
+  0x77, 0x80, 0x1D, 0x02, 0x75, 0x44, 0x49, 0x80, 0x03, 0x0A, 0x47, 0x75, 0x55, 0x44, 0x4A, 0x77,
+  0x55, 0x44, 0x44, 0x49, 0xC7, 0x80, 0x28, 0x00, 0x4A, 0x80, 0x03, 0x82, 0x00, 0x00, 0x64, 0x84,
+  0x47, 0x0A, 0x57, 0xCA, 0x44, 0x49, 0x55, 0x75, 0xC4, 0x44, 0x77, 0x77, 0x7A, 0x80, 0x35, 0x80,
+  0x11, 0x00, 0xA7, 0x80, 0x50, 0x0B, 0x46, 0x57, 0x64, 0x44, 0x67, 0x57, 0x64, 0x46, 0x77, 0x57,
+  0x64, 0x67, 0x80, 0x03, 0x81, 0xE0, 0x00, 0x21, 0x80, 0x03, 0x00, 0x2D, 0x80, 0x03, 0x00, 0x22,
+  0x81, 0x03, 0x00, 0x25, 0x80, 0x03, 0x01, 0x22, 0x51, 0x80, 0x03, 0x00, 0x27, 0x80, 0x03, 0x05,
+  0x22, 0xA1, 0x55, 0x77, 0x77, 0x57, 0x88, 0xFB, 0x04, 0x51, 0x11, 0x15, 0x22, 0xA1, 0x80, 0xFF,
+  0x03, 0x51, 0x11, 0x1C, 0x51, 0x82, 0x11, 0x02, 0xD1, 0x11, 0xC2, 0x80, 0x36, 0x81, 0x03, 0x00,
+  0x12, 0x80, 0x03, 0x0B, 0x15, 0x22, 0x55, 0x11, 0x11, 0xA2, 0x22, 0x21, 0x11, 0x15, 0x52, 0x27,
+  0x80, 0x1C, 0x80, 0x03, 0x80, 0x43, 0x92, 0x00, 0x02, 0x15, 0x77, 0x77, 0x82, 0x40, 0x0B, 0x27,
+  0xA2, 0x2F, 0x68, 0x22, 0x52, 0x2F, 0x97, 0x22, 0x52, 0x22, 0x72, 0x80, 0x03, 0x3D, 0x22, 0x25,
+  0xA2, 0x22, 0xE2, 0x55, 0x22, 0x27, 0x82, 0x12, 0x22, 0x27, 0x92, 0x72, 0x22, 0x2F, 0x98, 0x78,
+  0x99, 0x98, 0x22, 0x2E, 0x98, 0xD8, 0x22, 0x27, 0xE7, 0x27, 0x63, 0x22, 0x22, 0x2D, 0x33, 0x2D,
+  0x72, 0x29, 0x33, 0x29, 0x82, 0x76, 0x33, 0xF9, 0x98, 0x86, 0x33, 0x89, 0x99, 0x99, 0x33, 0x48,
+  0x99, 0x99, 0x99, 0x49, 0x9C, 0x8F, 0x44, 0x69, 0x94, 0x44, 0x44, 0x16, 0x81, 0x03, 0x00, 0x9C,
+  0x80, 0x03, 0x01, 0x99, 0xF4, 0x80, 0x03, 0x09, 0x94, 0x44, 0x15, 0x99, 0x99, 0xF4, 0x3C, 0x22,
+  0x22, 0x31, 0x80, 0x6E, 0x00, 0x71, 0x80, 0x03, 0x81, 0x07, 0x81, 0x03, 0x00, 0x38, 0x80, 0x03,
+  0x00, 0x18, 0x83, 0xDF, 0x06, 0x21, 0x11, 0xC4, 0x44, 0x44, 0x44, 0x74, 0x84, 0x03, 0x00, 0x59,
+  0x80, 0x03, 0x00, 0x76, 0x84, 0x0B, 0x00, 0xA4, 0x80, 0x03, 0x81, 0x00, 0x95, 0xBF, 0x80, 0x00,
+  0x00, 0x27, 0x80, 0x03, 0x01, 0x28, 0x44, 0x80, 0xC5, 0x00, 0x44, 0x80, 0xC7, 0x08, 0x48, 0x11,
+  0x11, 0x16, 0x46, 0x57, 0x75, 0x57, 0x86, 0x80, 0x14, 0x03, 0x51, 0x77, 0x77, 0x22, 0x80, 0x0E,
+  0x80, 0x03, 0x03, 0x17, 0x22, 0x72, 0x71, 0x80, 0x04, 0x09, 0x51, 0x11, 0x12, 0x22, 0x61, 0x11,
+  0x62, 0x22, 0x55, 0x55, 0x80, 0xE1, 0x80, 0x38, 0x01, 0x77, 0x72, 0x80, 0x0E, 0x01, 0x11, 0x52,
+  0x80, 0x36, 0x01, 0x52, 0x26, 0x80, 0x04, 0x80, 0x03, 0x00, 0x12, 0x81, 0x03, 0x00, 0x21, 0x80,
+  0x03, 0x03, 0x27, 0x75, 0x55, 0x62, 0x81, 0x23, 0x01, 0x25, 0x77, 0x81, 0x9D, 0x01, 0x11, 0x15,
+  0x80, 0x1E, 0x10, 0x11, 0x21, 0x62, 0x71, 0x11, 0x26, 0x62, 0x25, 0x11, 0x26, 0x17, 0x22, 0x11,
+  0x26, 0x65, 0x22, 0x51, 0x86, 0x81, 0x80, 0x63, 0x00, 0x17, 0x80, 0xA3, 0x00, 0x11, 0x81, 0x03,
+  0x00, 0x24, 0x80, 0x03, 0x00, 0x64, 0x80, 0x03, 0x00, 0x12, 0x81, 0xB3, 0x80, 0x03, 0x11, 0x27,
+  0x44, 0x44, 0x25, 0x51, 0x74, 0x44, 0x78, 0x78, 0x69, 0x99, 0x22, 0x2E, 0x98, 0xD8, 0x22, 0x27,
+  0xE7, 0x81, 0xAF, 0x80, 0x7C, 0x00, 0x72, 0x80, 0x04, 0x05, 0x82, 0x7D, 0x22, 0x22, 0x78, 0x9D,
+  0x80, 0xBE, 0x0A, 0x9D, 0x44, 0x49, 0x77, 0x77, 0x44, 0x47, 0x7C, 0x9A, 0x44, 0x47, 0x80, 0xF5,
+  0x00, 0x97, 0x80, 0x03, 0x01, 0x67, 0x76, 0x80, 0x03, 0x01, 0x77, 0xA4, 0x80, 0x03, 0x06, 0xC4,
+  0x44, 0x97, 0x55, 0x57, 0x99, 0xC4, 0x80, 0x5C, 0x93, 0x00, 0x09, 0x48, 0xF4, 0x44, 0x44, 0x42,
+  0x67, 0xC4, 0x44, 0x4A, 0x67, 0x81, 0x36, 0x81, 0x03, 0x00, 0x59, 0x80, 0x03, 0x16, 0x57, 0x44,
+  0x44, 0x75, 0x57, 0x64, 0x44, 0x75, 0x55, 0x76, 0x44, 0x55, 0x55, 0x57, 0xCA, 0x77, 0x75, 0x55,
+  0x77, 0x49, 0xC7, 0x55, 0x55, 0x80, 0x25, 0x00, 0x77, 0x80, 0x33, 0x00, 0xA7, 0x80, 0x03, 0x00,
+  0x46, 0x80, 0x03, 0x00, 0x67, 0x80, 0x06, 0x1C, 0x77, 0x44, 0x49, 0x67, 0x55, 0x32, 0x22, 0x75,
+  0x55, 0x16, 0x22, 0x25, 0x55, 0x13, 0x22, 0x2D, 0x55, 0x11, 0x62, 0x22, 0x55, 0x11, 0x32, 0x22,
+  0x2D, 0x18, 0x32, 0x22, 0x22, 0x85, 0x03, 0x04, 0x11, 0x11, 0x55, 0x77, 0x11, 0x8B, 0x00, 0x0F,
+  0x15, 0x51, 0x11, 0x11, 0x1A, 0x27, 0x11, 0x11, 0x1C, 0x22, 0xA1, 0x11, 0x11, 0x77, 0x57, 0xD1,
+  0x8A, 0x18, 0x0A, 0x22, 0xA1, 0x55, 0x11, 0x22, 0x5C, 0x22, 0x21, 0x51, 0x11, 0x52, 0x80, 0x22,
+  0x02, 0x11, 0x27, 0xC2, 0x80, 0xED, 0x81, 0x03, 0x00, 0x12, 0x80, 0x03, 0x00, 0x15, 0x80, 0x03,
+  0x00, 0x11, 0x80, 0xFE, 0x00, 0x11, 0x80, 0x08, 0x80, 0x2D, 0x82, 0x57, 0x03, 0x22, 0x22, 0x27,
+  0xA2, 0x80, 0x16, 0x00, 0x52, 0x87, 0x03, 0x00, 0x25, 0x80, 0x0F, 0x04, 0x55, 0x22, 0x77, 0x51,
+  0x12, 0x80, 0x23, 0x0D, 0x72, 0x22, 0x27, 0x98, 0x78, 0x69, 0x27, 0x67, 0x2D, 0x98, 0x22, 0x72,
+  0x27, 0xE7, 0x80, 0x1F, 0x1B, 0x22, 0x22, 0xE2, 0x2E, 0x72, 0x27, 0x82, 0x29, 0x82, 0x27, 0x92,
+  0x29, 0x68, 0x2F, 0x98, 0x89, 0x99, 0x55, 0x22, 0x27, 0x11, 0xD1, 0x22, 0x21, 0x13, 0x27, 0x22,
+  0x21, 0x80, 0x62, 0x00, 0x71, 0x80, 0x03, 0x06, 0x31, 0x83, 0x7D, 0x22, 0x31, 0x11, 0x5F, 0x82,
+  0x03, 0x06, 0x71, 0x11, 0x77, 0x77, 0x64, 0x44, 0x9A, 0x80, 0xF0, 0x89, 0x00, 0x00, 0xA4, 0x80,
+  0x03, 0x00, 0xC4, 0x80, 0x03, 0x00, 0x77, 0x81, 0x08, 0x00, 0x65, 0x80, 0x09, 0x01, 0x97, 0x74,
+  0x83, 0x03, 0x01, 0x67, 0x79, 0x80, 0x03, 0x19, 0x57, 0x44, 0x44, 0x75, 0x77, 0x64, 0x49, 0x77,
+  0x77, 0x76, 0x48, 0x77, 0x55, 0x57, 0x4A, 0x77, 0x55, 0x75, 0x44, 0x49, 0xC7, 0x55, 0x44, 0x44,
+  0x4A, 0x67, 0x8C, 0x46, 0x1D, 0x46, 0xCA, 0x44, 0x49, 0x67, 0x81, 0xB2, 0x22, 0x75, 0x88, 0x16,
+  0x22, 0x25, 0x11, 0x13, 0x22, 0x2D, 0x61, 0x11, 0x62, 0x22, 0x23, 0x18, 0x32, 0x22, 0x31, 0x88,
+  0x32, 0x22, 0x11, 0x80, 0x03, 0x01, 0x88, 0x81, 0x80, 0x07, 0x02, 0x11, 0x11, 0x55, 0x81, 0xE7,
+  0x85, 0x00, 0x00, 0x25, 0x81, 0xF3, 0x00, 0x51, 0x80, 0x03, 0x00, 0x27, 0x81, 0xFB, 0x00, 0xA1,
+  0x80, 0x9F, 0x01, 0x57, 0xD1, 0x86, 0x1C, 0x0E, 0x15, 0x51, 0x11, 0x15, 0x22, 0xA1, 0x55, 0x12,
+  0x22, 0x51, 0x22, 0x1C, 0x51, 0x11, 0x52, 0x82, 0x13, 0x02, 0xC2, 0x22, 0x22, 0x82, 0x03, 0x80,
+  0xD9, 0x80, 0x1C, 0x80, 0x4F, 0x02, 0xA2, 0x22, 0x21, 0x80, 0x08, 0x80, 0x3E, 0x00, 0x15, 0x80,
+  0x03, 0x04, 0x11, 0x44, 0x44, 0x49, 0x97, 0x89, 0x94, 0x17, 0x84, 0x49, 0x9B, 0x44, 0xE4, 0x42,
+  0x22, 0x44, 0x84, 0xBD, 0xDE, 0x44, 0x44, 0x4B, 0xBB, 0x49, 0x22, 0x28, 0x44, 0x47, 0x49, 0x99,
+  0x44, 0x47, 0x81, 0xAF, 0x85, 0x23, 0x06, 0x22, 0x22, 0x88, 0xB4, 0x22, 0x22, 0x2E, 0x80, 0x07,
+  0x09, 0x2B, 0x44, 0x55, 0x77, 0x76, 0xAA, 0x55, 0x55, 0x55, 0x77, 0x80, 0x02, 0x10, 0x75, 0xC7,
+  0x55, 0x77, 0x77, 0x47, 0x77, 0x5A, 0x49, 0x47, 0x55, 0x7A, 0x44, 0x97, 0x55, 0x57, 0x64, 0x80,
+  0x14, 0x03, 0x76, 0xA4, 0x97, 0x75, 0x80, 0x15, 0x00, 0x75, 0x80, 0x22, 0x81, 0x03, 0x14, 0x7C,
+  0x77, 0x77, 0x77, 0xA4, 0x65, 0x97, 0x74, 0x44, 0x77, 0xA7, 0x74, 0x46, 0x76, 0x77, 0x7C, 0x77,
+  0x7A, 0x55, 0x57, 0x77, 0x80, 0x26, 0x83, 0x00, 0x80, 0x1C, 0x02, 0x77, 0x57, 0x77, 0x80, 0x38,
+  0x02, 0xA9, 0x66, 0x6A, 0x85, 0x6B, 0x80, 0xA2, 0x0E, 0x62, 0x88, 0x88, 0x13, 0x22, 0x11, 0x81,
+  0x32, 0x22, 0x81, 0x17, 0x22, 0x22, 0xB7, 0x22, 0x89, 0x00, 0x01, 0x2A, 0xB2, 0x80, 0x04, 0x00,
+  0x25, 0x80, 0x03, 0x08, 0xD1, 0x22, 0x22, 0x27, 0x1C, 0x22, 0x22, 0x21, 0x1A, 0x80, 0x0A, 0x81,
+  0xE5, 0x80, 0x03, 0x04, 0x22, 0x27, 0x22, 0x22, 0xA2, 0x80, 0xEF, 0x81, 0x00, 0x0C, 0x1C, 0x11,
+  0x51, 0x11, 0xA2, 0x51, 0x25, 0x11, 0x72, 0x71, 0x27, 0x11, 0x52, 0x86, 0x03, 0x81, 0x23, 0x83,
+  0x1F, 0x04, 0x15, 0xA7, 0x11, 0x11, 0x1A, 0x80, 0x2B, 0x02, 0x1A, 0x22, 0xC5, 0x81, 0x3A, 0x03,
+  0x11, 0x1C, 0x22, 0xA2, 0x80, 0x03, 0x02, 0x22, 0x51, 0x1C, 0x81, 0x3F, 0x03, 0xCA, 0x51, 0xAA,
+  0xA2, 0x89, 0x74, 0x00, 0x2B, 0x88, 0x03, 0x00, 0x22, 0x80, 0xA2, 0x00, 0x49, 0x85, 0xAB, 0x81,
+  0x00, 0x16, 0x22, 0x84, 0x49, 0x9B, 0x22, 0xE4, 0x42, 0x22, 0x22, 0x84, 0x92, 0x2E, 0x44, 0x44,
+  0x4B, 0xBB, 0x89, 0x77, 0x7D, 0x82, 0x44, 0x48, 0x88, 0x89, 0x22, 0x04, 0x45, 0x44, 0xBB, 0xBB,
+  0x51, 0x80, 0x03, 0x01, 0x11, 0x48, 0x80, 0x03, 0x08, 0x29, 0x99, 0x99, 0x9C, 0x49, 0x99, 0x99,
+  0x99, 0x4C, 0x80, 0x03, 0x07, 0x75, 0x59, 0x99, 0x99, 0x11, 0x11, 0x69, 0x52, 0x83, 0x93, 0x83,
+  0x00, 0x03, 0xFF, 0xF4, 0x89, 0x9C, 0x80, 0x1A, 0x00, 0x94, 0x80, 0x03, 0x00, 0xF4, 0x80, 0x03,
+  0x04, 0x44, 0x29, 0x55, 0x5F, 0x44, 0x80, 0xAF, 0x80, 0x03, 0x01, 0x11, 0x84, 0x80, 0x03, 0x81,
+  0x4F, 0x00, 0xC1, 0x80, 0x03, 0x00, 0x51, 0x80, 0x03, 0x03, 0x61, 0x44, 0x44, 0x42, 0x80, 0x10,
+  0x00, 0x47, 0x80, 0x03, 0x00, 0x46, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x81, 0x80, 0x22,
+  0x05, 0x17, 0x25, 0x11, 0x11, 0x16, 0x76, 0x89, 0x53, 0x86, 0x00, 0x02, 0x65, 0x55, 0x55, 0x80,
+  0x05, 0x81, 0x6F, 0x81, 0x03, 0x00, 0x62, 0x8D, 0x1E, 0x00, 0x56, 0x80, 0x03, 0x00, 0x21, 0x80,
+  0x3C, 0x81, 0x03, 0x00, 0x71, 0x92, 0x40, 0x02, 0x11, 0x11, 0x22, 0x80, 0x37, 0x80, 0x03, 0x00,
+  0x16, 0x81, 0x2B, 0x92, 0x1F, 0x08, 0x61, 0x64, 0x44, 0x22, 0x21, 0x18, 0x44, 0x62, 0x21, 0x86,
+  0xB3, 0x00, 0x74, 0x80, 0x03, 0x00, 0x14, 0x80, 0x03, 0x00, 0x18, 0x80, 0x03, 0x08, 0x54, 0x22,
+  0x22, 0x2F, 0x98, 0x22, 0x22, 0x22, 0x77, 0x80, 0x03, 0x92, 0x00, 0x0E, 0x44, 0xA7, 0x55, 0x77,
+  0x44, 0x47, 0x55, 0x55, 0x44, 0x46, 0x77, 0x55, 0x44, 0x44, 0xC7, 0x80, 0x03, 0x08, 0x47, 0x55,
+  0x98, 0xB4, 0x47, 0x55, 0x4E, 0x44, 0x97, 0x80, 0x0B, 0x06, 0x77, 0x55, 0x76, 0xAA, 0xA4, 0x97,
+  0x77, 0x80, 0x00, 0x1A, 0x57, 0x75, 0x57, 0x75, 0x77, 0x77, 0x55, 0x55, 0x7A, 0x49, 0x75, 0x57,
+  0x5A, 0x44, 0x97, 0x74, 0x57, 0x64, 0xA7, 0x74, 0x55, 0x76, 0x77, 0x7C, 0x55, 0x55, 0x57, 0x80,
+  0x15, 0x80, 0x00, 0x80, 0x05, 0x00, 0x7C, 0x80, 0x03, 0x09, 0xA4, 0x67, 0x77, 0x75, 0x44, 0x77,
+  0x64, 0xA9, 0x4C, 0x76, 0x80, 0x3D, 0x00, 0x5A, 0x80, 0x03, 0x81, 0x34, 0x87, 0x00, 0x07, 0x76,
+  0x55, 0x57, 0xCA, 0x44, 0x66, 0x6A, 0x44, 0x86, 0x00, 0x04, 0x81, 0x62, 0x22, 0x22, 0x13, 0x80,
+  0x87, 0x00, 0x32, 0x8B, 0x96, 0x00, 0x2C, 0x81, 0x04, 0x01, 0xCA, 0xB2, 0x80, 0x04, 0x00, 0x25,
+  0x80, 0xE3, 0x0F, 0x51, 0x11, 0x11, 0x27, 0x1C, 0x51, 0x11, 0x21, 0x1A, 0x25, 0x11, 0xD1, 0x15,
+  0x27, 0x11, 0x11, 0x80, 0x03, 0x04, 0x22, 0x27, 0x27, 0x11, 0xA2, 0x80, 0x1E, 0x80, 0xE3, 0x01,
+  0x11, 0x1C, 0x80, 0x03, 0x00, 0xA2, 0x80, 0x23, 0x06, 0x72, 0x71, 0x11, 0x11, 0x52, 0x71, 0xC5,
+  0x80, 0x03, 0x00, 0x22, 0x80, 0x03, 0x00, 0xA2, 0x80, 0x23, 0x81, 0x39, 0x80, 0x2E, 0x03, 0xA7,
+  0x51, 0xAA, 0x1A, 0x80, 0x2B, 0x81, 0x03, 0x00, 0x15, 0x80, 0x03, 0x00, 0x1C, 0x88, 0x03, 0x03,
+  0x11, 0xCA, 0x22, 0x22, 0x81, 0x47, 0x86, 0x00, 0x02, 0x2B, 0xBB, 0x52, 0x80, 0x03, 0x00, 0xB2,
+  0x82, 0x07, 0x80, 0x00, 0x03, 0x44, 0x49, 0x97, 0x75, 0x80, 0xA6, 0x00, 0x49, 0x85, 0xAF, 0x14,
+  0x49, 0x9B, 0x44, 0x44, 0x42, 0x22, 0x44, 0x22, 0x92, 0x2E, 0x44, 0x22, 0x4B, 0xBB, 0x49, 0x22,
+  0x2C, 0x44, 0x47, 0x57, 0x99, 0x80, 0x03, 0x03, 0x44, 0x44, 0x46, 0x77, 0x80, 0x1E, 0x00, 0x67,
+  0x80, 0x03, 0x0A, 0x47, 0x22, 0xE8, 0xB4, 0x47, 0x22, 0x2E, 0x44, 0x97, 0x22, 0x2B, 0x80, 0xFE,
+  0x08, 0x76, 0xAA, 0xA4, 0x57, 0x77, 0x57, 0x77, 0x55, 0x77, 0x80, 0xFD, 0x00, 0x77, 0x80, 0x04,
+  0x12, 0x5A, 0x49, 0x77, 0x55, 0x5A, 0x44, 0x97, 0x55, 0x57, 0x64, 0xA5, 0x55, 0x57, 0x76, 0x75,
+  0x97, 0x77, 0x55, 0x75, 0x80, 0x15, 0x06, 0x75, 0x57, 0x57, 0x55, 0x75, 0x55, 0x7C, 0x80, 0x0B,
+  0x0D, 0xA4, 0x67, 0x77, 0x74, 0x44, 0x75, 0x64, 0x74, 0x46, 0x76, 0x44, 0x7C, 0x77, 0x7A, 0x80,
+  0x40, 0x81, 0x34, 0x80, 0x20, 0x84, 0x03, 0x80, 0x0E, 0x03, 0xCA, 0xA9, 0x66, 0x6A, 0x85, 0x8E,
+  0x0D, 0x44, 0x88, 0x11, 0x62, 0x22, 0x88, 0x83, 0x22, 0x22, 0x18, 0x32, 0x22, 0x22, 0x13, 0x89,
+  0xC7, 0x81, 0x00, 0x01, 0x2A, 0xB2, 0x80, 0x04, 0x13, 0x2D, 0x11, 0x22, 0x22, 0x51, 0x11, 0x22,
+  0x27, 0x1C, 0x51, 0x22, 0x21, 0x1A, 0x25, 0x22, 0xD1, 0x15, 0x27, 0x22, 0x11, 0x80, 0x03, 0x02,
+  0x22, 0x27, 0x27, 0x81, 0xF8, 0x00, 0x11, 0x81, 0x00, 0x00, 0x1C, 0x80, 0x03, 0x0A, 0xA2, 0xD1,
+  0x11, 0x11, 0x72, 0x71, 0x11, 0x11, 0x52, 0x71, 0xC5, 0x80, 0x03, 0x00, 0x22, 0x80, 0x03, 0x80,
+  0x1D, 0x80, 0x2A, 0x81, 0x00, 0x04, 0x15, 0xA7, 0x51, 0x11, 0x1A, 0x80, 0x2B, 0x81, 0x03, 0x00,
+  0x15, 0x80, 0x03, 0x00, 0x1C, 0x83, 0x03, 0x00, 0x51, 0x80, 0x03, 0x80, 0x82, 0x0F, 0x4B, 0xB4,
+  0x82, 0x84, 0x44, 0x44, 0x22, 0x84, 0x48, 0x44, 0x2D, 0xB4, 0x82, 0x22, 0x22, 0xE8, 0x8A, 0x82,
+  0x07, 0x82, 0x22, 0x84, 0x46, 0x44, 0x4E, 0x44, 0x97, 0x80, 0x27, 0x00, 0x77, 0x80, 0x0A, 0x1D,
+  0x75, 0x22, 0x84, 0x47, 0x77, 0x22, 0xB4, 0x96, 0x94, 0x2D, 0xB4, 0x44, 0x44, 0x2E, 0x44, 0x44,
+  0x66, 0x77, 0x57, 0x75, 0x77, 0x7C, 0xA6, 0x75, 0x55, 0x76, 0x49, 0x55, 0x77, 0x7A, 0x81, 0x03,
+  0x06, 0x46, 0x75, 0x7C, 0x44, 0x44, 0xA9, 0x66, 0x81, 0xDB, 0x0D, 0x64, 0x97, 0x69, 0x44, 0x57,
+  0x77, 0x57, 0x64, 0x7C, 0x77, 0x57, 0xA4, 0x64, 0x67, 0x80, 0x16, 0x12, 0x67, 0x76, 0x44, 0x44,
+  0x75, 0x7A, 0x44, 0x49, 0x75, 0xC4, 0x44, 0x4A, 0x77, 0x64, 0x44, 0x44, 0xA6, 0xA4, 0x44, 0x84,
+  0x66, 0x03, 0x27, 0x22, 0x26, 0x39, 0x80, 0xE3, 0x00, 0x14, 0x80, 0x03, 0x07, 0x11, 0x63, 0x22,
+  0x2A, 0x1B, 0x26, 0x22, 0x2A, 0x80, 0xF6, 0x0E, 0x2A, 0x11, 0x62, 0x26, 0x31, 0x11, 0x92, 0x91,
+  0x11, 0x11, 0x92, 0x14, 0x44, 0x11, 0x12, 0x80, 0x52, 0x00, 0x12, 0x80, 0xCD, 0x14, 0x12, 0x11,
+  0x1B, 0x63, 0x12, 0x94, 0x43, 0x26, 0x92, 0xB1, 0x1B, 0x22, 0x92, 0x22, 0x2D, 0x11, 0x5A, 0x22,
+  0x21, 0x11, 0x17, 0x80, 0x03, 0x02, 0x1A, 0x22, 0x71, 0x82, 0x03, 0x00, 0x11, 0x8A, 0x03, 0x80,
+  0x00, 0x03, 0x25, 0x11, 0x52, 0x75, 0x80, 0x03, 0x04, 0x71, 0x21, 0x11, 0x52, 0x51, 0x80, 0x3E,
+  0x80, 0x15, 0x87, 0x00, 0x02, 0x22, 0x27, 0xCC, 0x82, 0x80, 0x13, 0x52, 0x77, 0x22, 0x27, 0x52,
+  0x51, 0x1A, 0x25, 0x52, 0x51, 0x12, 0x2B, 0x15, 0x11, 0x52, 0x7B, 0x11, 0x11, 0xA2, 0x5B, 0x80,
+  0x1D, 0x00, 0xBB, 0x81, 0xC7, 0x06, 0x44, 0x42, 0x24, 0x92, 0x22, 0x22, 0xE4, 0x80, 0x03, 0x00,
+  0x84, 0x80, 0x03, 0x00, 0xB4, 0x80, 0x03, 0x00, 0x8B, 0x84, 0xB6, 0x01, 0x22, 0x22, 0x81, 0x1E,
+  0x06, 0x22, 0xB4, 0x82, 0x84, 0x22, 0x44, 0x22, 0x81, 0x03, 0x00, 0xB4, 0x80, 0x12, 0x00, 0xE8,
+  0x86, 0x1C, 0x80, 0x00, 0x03, 0x49, 0x82, 0x2D, 0x11, 0x80, 0x40, 0x07, 0x11, 0x48, 0x44, 0x49,
+  0x11, 0x82, 0x22, 0x89, 0x80, 0x8F, 0x00, 0x8B, 0x80, 0x03, 0x00, 0xB4, 0x84, 0x03, 0x04, 0x44,
+  0xD1, 0x11, 0x11, 0x16, 0x80, 0x85, 0x04, 0x17, 0x99, 0x11, 0x11, 0x18, 0x80, 0x03, 0x08, 0x68,
+  0x96, 0x11, 0x11, 0x2C, 0x61, 0x11, 0x11, 0x84, 0x80, 0xA7, 0x11, 0x84, 0x86, 0x11, 0x11, 0x29,
+  0xCC, 0x11, 0x11, 0x62, 0x44, 0x99, 0x9C, 0x44, 0x44, 0x99, 0xCF, 0x88, 0x44, 0x80, 0x28, 0x00,
+  0x74, 0x80, 0x03, 0x00, 0x64, 0x82, 0x03, 0x03, 0x16, 0x65, 0x84, 0xC8, 0x82, 0x9C, 0x01, 0x47,
+  0x16, 0x82, 0x06, 0x94, 0x00, 0x00, 0x72, 0x99, 0x1C, 0x83, 0x00, 0x00, 0xF2, 0x93, 0x16, 0x04,
+  0x48, 0x71, 0x44, 0x42, 0x61, 0x80, 0xA3, 0x83, 0xE3, 0x80, 0xC3, 0x00, 0x61, 0x80, 0xC6, 0x05,
+  0x11, 0x44, 0x71, 0x11, 0x11, 0x26, 0x80, 0x80, 0x85, 0x00, 0x03, 0x22, 0x77, 0x77, 0x77, 0x81,
+  0x1D, 0x00, 0x68, 0x80, 0x03, 0x01, 0x11, 0x17, 0x80, 0x03, 0x80, 0xAF, 0x80, 0x16, 0x00, 0x55,
+  0x81, 0x1B, 0x81, 0xD9, 0x84, 0x1E, 0x8A, 0x00, 0x05, 0x74, 0x44, 0x76, 0x65, 0x15, 0x45, 0x80,
+  0x1C, 0x80, 0xE9, 0x91, 0x79, 0x00, 0x94, 0x80, 0x03, 0x81, 0xD4, 0x01, 0x11, 0x84, 0x80, 0x04,
+  0x12, 0x46, 0x75, 0x77, 0x44, 0x97, 0x7C, 0xA6, 0x44, 0x47, 0x76, 0x49, 0x44, 0x49, 0x7A, 0x49,
+  0x44, 0x44, 0x6A, 0x46, 0x88, 0x2A, 0x01, 0x97, 0x55, 0x80, 0x60, 0x02, 0x55, 0x57, 0x7C, 0x80,
+  0x03, 0x0C, 0x64, 0x67, 0x55, 0x57, 0xA4, 0x67, 0x77, 0x7C, 0x44, 0x77, 0xA9, 0x66, 0x49, 0x80,
+  0x74, 0x12, 0x49, 0x77, 0x69, 0x44, 0x44, 0xA6, 0x77, 0x64, 0x44, 0x44, 0x77, 0xA4, 0x44, 0x44,
+  0x7C, 0x44, 0x44, 0x4A, 0x76, 0x80, 0x14, 0x00, 0x7A, 0x80, 0x03, 0x00, 0xC4, 0x80, 0x03, 0x80,
+  0x16, 0x00, 0x49, 0x80, 0x16, 0x0C, 0x49, 0x22, 0x22, 0x26, 0x39, 0x22, 0x27, 0x91, 0x11, 0x3B,
+  0x11, 0x11, 0x41, 0x80, 0x91, 0x18, 0x44, 0x11, 0x6A, 0x11, 0x44, 0x1B, 0x26, 0x11, 0x1B, 0x1B,
+  0x22, 0xB1, 0x43, 0x11, 0x62, 0xB4, 0x1B, 0x11, 0x12, 0x22, 0x29, 0x11, 0x92, 0x22, 0x25, 0x80,
+  0x07, 0x04, 0x25, 0x44, 0x12, 0x22, 0x75, 0x80, 0x07, 0x01, 0x75, 0x63, 0x80, 0x03, 0x00, 0x27,
+  0x80, 0x03, 0x01, 0x22, 0x92, 0x80, 0x0F, 0x08, 0x5A, 0x22, 0x22, 0x11, 0x17, 0x25, 0x11, 0x11,
+  0x1A, 0x81, 0x03, 0x00, 0x21, 0x81, 0xF6, 0x8A, 0x00, 0x16, 0x22, 0x22, 0x22, 0x27, 0x52, 0x75,
+  0x22, 0x22, 0x52, 0x71, 0x52, 0x77, 0x52, 0x51, 0x52, 0x51, 0x12, 0x71, 0x52, 0x51, 0x11, 0x11,
+  0x15, 0x86, 0x1F, 0x00, 0xCC, 0x80, 0x20, 0x80, 0x00, 0x18, 0x21, 0x22, 0x27, 0xBB, 0xBB, 0x1A,
+  0x25, 0xBB, 0xBB, 0x12, 0x2B, 0xBB, 0xBB, 0x52, 0x7B, 0xBB, 0xBB, 0xA2, 0x5B, 0xBB, 0xBB, 0x22,
+  0xBB, 0xBB, 0xBB, 0x81, 0xE4, 0x08, 0x24, 0x92, 0x22, 0xB4, 0xE4, 0xB2, 0x22, 0x44, 0x84, 0x80,
+  0x03, 0x04, 0xB4, 0x92, 0x22, 0x22, 0x8B, 0x83, 0x33, 0x82, 0x00, 0x80, 0xC2, 0x0E, 0x82, 0x82,
+  0x84, 0x44, 0x44, 0x22, 0x84, 0x48, 0x44, 0x22, 0xB4, 0x82, 0x22, 0xD2, 0xE8, 0x82, 0x16, 0x00,
+  0x2D, 0x84, 0x03, 0x19, 0x2E, 0x22, 0x84, 0x46, 0x77, 0x4E, 0x44, 0x97, 0x5C, 0x44, 0x44, 0x77,
+  0x76, 0x84, 0x46, 0x55, 0x7A, 0x84, 0x47, 0x77, 0x7A, 0xB4, 0x96, 0x94, 0x44, 0xB4, 0x81, 0x58,
+  0x0E, 0x44, 0x66, 0x64, 0x77, 0x77, 0x75, 0x77, 0xA6, 0x77, 0x57, 0x7C, 0x49, 0x77, 0x77, 0x64,
+  0x80, 0x03, 0x08, 0xA4, 0x46, 0x77, 0x7C, 0x44, 0x44, 0xA9, 0x66, 0x49, 0x80, 0x1C, 0x0D, 0x49,
+  0x97, 0x69, 0x44, 0x44, 0x57, 0x57, 0x64, 0x44, 0x75, 0x57, 0xA4, 0x44, 0x67, 0x80, 0x41, 0x01,
+  0x67, 0x76, 0x80, 0x45, 0x00, 0x7A, 0x80, 0x13, 0x00, 0xC4, 0x80, 0x07, 0x04, 0x64, 0x44, 0x44,
+  0xA6, 0xA4, 0x80, 0x77, 0x02, 0x22, 0x22, 0x26, 0x80, 0xE2, 0x1F, 0x91, 0x26, 0x3B, 0x11, 0x11,
+  0x27, 0x11, 0x11, 0x44, 0x27, 0x11, 0x63, 0x11, 0x27, 0x1B, 0x26, 0x11, 0x27, 0x19, 0x22, 0x94,
+  0x27, 0x11, 0x62, 0xB4, 0x39, 0x11, 0x12, 0x22, 0x11, 0x14, 0x12, 0x80, 0xA7, 0x83, 0x03, 0x23,
+  0x41, 0x41, 0x12, 0x22, 0x4B, 0x63, 0x12, 0x22, 0x13, 0x27, 0x12, 0x22, 0x1B, 0x22, 0x92, 0x22,
+  0x2D, 0x11, 0x5A, 0x22, 0x21, 0x11, 0x17, 0x25, 0x21, 0x11, 0x1A, 0x2D, 0x71, 0x11, 0x1A, 0x21,
+  0x71, 0x11, 0x11, 0x11, 0x89, 0x03, 0x81, 0xCC, 0x02, 0x11, 0x52, 0xA5, 0x80, 0x03, 0x07, 0x71,
+  0x52, 0x11, 0x52, 0x51, 0x52, 0x11, 0xC2, 0x80, 0x07, 0x02, 0x11, 0x11, 0x15, 0x80, 0x03, 0x82,
+  0x00, 0x01, 0x27, 0x5C, 0x82, 0xEF, 0x18, 0x22, 0x77, 0x22, 0x27, 0xBB, 0x51, 0x1A, 0x25, 0xBB,
+  0x51, 0x12, 0x2B, 0xBB, 0x11, 0x52, 0x7B, 0xBB, 0x11, 0xA2, 0x5B, 0xBB, 0x11, 0x22, 0xBB, 0xBB,
+  0x81, 0x1B, 0x00, 0x82, 0x80, 0x03, 0x00, 0x49, 0x80, 0x03, 0x05, 0x44, 0x42, 0x22, 0x22, 0x8B,
+  0x92, 0x83, 0x2F, 0x85, 0x00, 0x03, 0x28, 0x44, 0x97, 0x77, 0x84, 0x03, 0x05, 0x75, 0x28, 0x44,
+  0x65, 0x55, 0x2B, 0x80, 0x03, 0x04, 0x84, 0x44, 0x67, 0x55, 0x44, 0x80, 0x07, 0x80, 0xE5, 0x0B,
+  0x77, 0x32, 0x71, 0x81, 0x12, 0x62, 0x38, 0x88, 0x32, 0x62, 0x18, 0x81, 0x83, 0x03, 0x0B, 0x31,
+  0x81, 0xB2, 0x72, 0x21, 0x18, 0x13, 0x1C, 0x23, 0x88, 0x11, 0x13, 0x80, 0xA0, 0x00, 0x44, 0x80,
+  0x00, 0x0D, 0x47, 0x94, 0x44, 0x44, 0x97, 0x7A, 0x44, 0x44, 0xA7, 0x57, 0x44, 0x44, 0x49, 0x77,
+  0x80, 0x10, 0x07, 0xC7, 0x44, 0x44, 0x94, 0x67, 0x44, 0x44, 0x76, 0x80, 0x0B, 0x03, 0x22, 0x2A,
+  0xBB, 0x62, 0x82, 0x68, 0x06, 0x2C, 0x66, 0x22, 0x22, 0x23, 0x11, 0x32, 0x80, 0x03, 0x04, 0xB2,
+  0x22, 0x23, 0x44, 0xA2, 0x80, 0x03, 0x80, 0x0B, 0x05, 0x44, 0x19, 0x3B, 0xBB, 0x22, 0x72, 0x81,
+  0x1E, 0x00, 0x26, 0x80, 0x1E, 0x17, 0x61, 0x11, 0x62, 0x72, 0x61, 0x14, 0x62, 0xA2, 0x61, 0x44,
+  0x62, 0x32, 0x71, 0x44, 0x93, 0x92, 0x11, 0x44, 0x11, 0x92, 0x22, 0x27, 0xAA, 0xA7, 0x8B, 0xB1,
+  0x8B, 0x00, 0x07, 0x51, 0x11, 0x11, 0x11, 0x22, 0x2A, 0x75, 0x11, 0x90, 0x1A, 0x00, 0x27, 0x80,
+  0x03, 0x00, 0x2B, 0x80, 0x1D, 0x0A, 0xBB, 0x11, 0x15, 0x22, 0xBB, 0xA7, 0x7A, 0x25, 0xBB, 0x22,
+  0x22, 0x80, 0x03, 0x04, 0x75, 0x5B, 0xBB, 0x7B, 0xBB, 0x87, 0x00, 0x83, 0x2A, 0x04, 0x24, 0x42,
+  0x22, 0x22, 0xB4, 0x81, 0x03, 0x00, 0x82, 0x80, 0x03, 0x80, 0x0F, 0x00, 0xE9, 0x8A, 0x48, 0x00,
+  0x28, 0x80, 0x15, 0x01, 0x24, 0x48, 0x80, 0x07, 0x00, 0x44, 0x80, 0x22, 0x01, 0x8B, 0x92, 0x8A,
+  0x1B, 0x0A, 0xBB, 0xB2, 0x44, 0x61, 0xBB, 0xB2, 0x42, 0x11, 0xBB, 0xB2, 0x47, 0x80, 0x03, 0x03,
+  0x48, 0x11, 0xBB, 0xB8, 0x80, 0x03, 0x00, 0x24, 0x80, 0x0B, 0x00, 0x44, 0x83, 0x03, 0x0A, 0x11,
+  0x11, 0x79, 0x99, 0x11, 0x11, 0x59, 0x66, 0x11, 0x16, 0x95, 0x80, 0x0B, 0x00, 0x55, 0x80, 0x03,
+  0x00, 0x19, 0x81, 0x03, 0x81, 0x0C, 0x82, 0x00, 0x07, 0x94, 0x44, 0x44, 0x44, 0x66, 0x66, 0x67,
+  0x44, 0x80, 0x0A, 0x00, 0x84, 0x80, 0x03, 0x0B, 0x24, 0x11, 0x11, 0x16, 0x44, 0x98, 0x88, 0x84,
+  0x44, 0x11, 0x16, 0x24, 0x80, 0x13, 0x00, 0x18, 0x80, 0x1D, 0x8E, 0x00, 0x01, 0x26, 0x44, 0x80,
+  0x57, 0x06, 0x44, 0x44, 0x21, 0x11, 0x44, 0x45, 0x11, 0x80, 0x07, 0x81, 0x00, 0x04, 0x48, 0x25,
+  0x44, 0x44, 0x71, 0x80, 0x0B, 0x07, 0x11, 0x11, 0x57, 0x84, 0x61, 0x11, 0x11, 0x68, 0x80, 0x03,
+  0x01, 0x16, 0x51, 0x80, 0x4E, 0x02, 0x51, 0x11, 0x85, 0x85, 0x68, 0x82, 0x00, 0x05, 0x62, 0x44,
+  0x11, 0x58, 0x44, 0x44, 0x80, 0x02, 0x01, 0x44, 0x64, 0x80, 0x03, 0x81, 0x5D, 0x0A, 0x11, 0x11,
+  0x87, 0x11, 0x11, 0x74, 0x47, 0x11, 0x74, 0x44, 0x42, 0x80, 0x3F, 0x00, 0x48, 0x80, 0x03, 0x80,
+  0x07, 0x00, 0x48, 0x80, 0x57, 0x00, 0x46, 0x80, 0x03, 0x04, 0x21, 0x11, 0x11, 0x15, 0x86, 0x81,
+  0x91, 0x00, 0x88, 0x80, 0x9D, 0x00, 0x44, 0x80, 0x54, 0x01, 0x74, 0x71, 0x80, 0x0D, 0x00, 0x81,
+  0x80, 0x48, 0x00, 0x56, 0x82, 0x4E, 0x80, 0x11, 0x97, 0x00, 0x00, 0x66, 0x80, 0x03, 0x03, 0x74,
+  0x21, 0x11, 0x24, 0x80, 0x63, 0x8D, 0x03, 0x00, 0x54, 0x80, 0x03, 0x00, 0x15, 0x81, 0x7B, 0x80,
+  0x08, 0x02, 0x44, 0x44, 0x95, 0x84, 0x03, 0x00, 0xA7, 0x80, 0x03, 0x00, 0x46, 0x80, 0x03, 0x00,
+  0x4A, 0x89, 0xEC, 0x23, 0x77, 0x74, 0x44, 0x44, 0x57, 0x64, 0x47, 0x94, 0x57, 0x64, 0x97, 0x7A,
+  0x57, 0x64, 0xA7, 0x77, 0x75, 0xC4, 0x49, 0x77, 0x67, 0x56, 0x44, 0xC7, 0xA7, 0x77, 0x94, 0x67,
+  0x4C, 0x77, 0x76, 0x77, 0x22, 0x22, 0x22, 0x2A, 0x80, 0x03, 0x81, 0x00, 0x00, 0x2C, 0x80, 0x03,
+  0x00, 0x23, 0x8D, 0x03, 0x03, 0xBB, 0x62, 0x3B, 0xBB, 0x81, 0x1C, 0x05, 0x66, 0x22, 0xC6, 0x66,
+  0x11, 0x32, 0x80, 0xBE, 0x12, 0xB2, 0x61, 0x14, 0x44, 0xA2, 0x61, 0x44, 0x44, 0x32, 0x71, 0x44,
+  0x44, 0x19, 0x11, 0x44, 0x22, 0x72, 0x22, 0x27, 0x84, 0x3F, 0x02, 0x22, 0x62, 0x72, 0x80, 0x03,
+  0x00, 0xA2, 0x80, 0x03, 0x0E, 0x32, 0x22, 0x22, 0x93, 0x92, 0x22, 0x22, 0x11, 0x12, 0x22, 0x22,
+  0xAA, 0xA7, 0x51, 0x11, 0x88, 0x63, 0x8E, 0x00, 0x81, 0xE9, 0x07, 0x75, 0x11, 0x11, 0x15, 0x22,
+  0x22, 0xA7, 0x7A, 0x84, 0x12, 0x0D, 0x75, 0x22, 0x22, 0x7B, 0xBB, 0x22, 0x27, 0xBB, 0xBB, 0x22,
+  0x2B, 0xBB, 0xBB, 0x44, 0x80, 0x10, 0x81, 0x03, 0x00, 0x48, 0x84, 0x03, 0x00, 0x82, 0x90, 0x43,
+  0x10, 0x24, 0x42, 0x28, 0x82, 0xB4, 0x42, 0x24, 0x48, 0xB4, 0x82, 0x28, 0x44, 0xB4, 0x22, 0x22,
+  0x8B, 0xE9, 0x8B, 0x1E, 0x00, 0x28, 0x81, 0x03, 0x00, 0x2D, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03,
+  0x80, 0x96, 0x00, 0x2B, 0x80, 0x0F, 0x03, 0x84, 0x22, 0x22, 0x2D, 0x80, 0x56, 0x05, 0x2D, 0x44,
+  0x44, 0x97, 0x77, 0x64, 0x80, 0x03, 0x06, 0xA4, 0x44, 0x97, 0x75, 0xA4, 0x44, 0x67, 0x80, 0x03,
+  0x00, 0x65, 0x81, 0x03, 0x01, 0x77, 0x94, 0x80, 0x07, 0x05, 0x74, 0x44, 0x77, 0x77, 0x76, 0x78,
+  0x80, 0xC4, 0x05, 0x31, 0x11, 0x32, 0xC1, 0x11, 0x81, 0x80, 0xFC, 0x13, 0x88, 0x32, 0x61, 0x31,
+  0x18, 0xB2, 0x27, 0x21, 0x11, 0x13, 0x22, 0x23, 0x11, 0x11, 0x72, 0x71, 0x11, 0x11, 0x13, 0x44,
+  0x80, 0x00, 0x00, 0x94, 0x80, 0x03, 0x00, 0x7A, 0x80, 0x03, 0x00, 0x77, 0x84, 0x03, 0x00, 0xC7,
+  0x80, 0x03, 0x00, 0x67, 0x84, 0x0B, 0x03, 0x2A, 0xBB, 0x62, 0x3B, 0x81, 0x84, 0x0E, 0x2C, 0x66,
+  0x22, 0x26, 0x23, 0x11, 0x32, 0x71, 0x23, 0x14, 0xB2, 0x61, 0x23, 0x14, 0xA2, 0x80, 0x03, 0x81,
+  0x0B, 0x04, 0x19, 0x11, 0xBB, 0x22, 0x72, 0x82, 0xA4, 0x00, 0x66, 0x80, 0x03, 0x02, 0x11, 0x62,
+  0x72, 0x80, 0x03, 0x0A, 0xA2, 0x22, 0x41, 0x62, 0x32, 0x22, 0x44, 0x93, 0x92, 0x22, 0x11, 0x80,
+  0x7B, 0x03, 0x2A, 0xAA, 0xA7, 0x51, 0x90, 0xF2, 0x86, 0x00, 0x00, 0x11, 0x80, 0x00, 0x03, 0x2A,
+  0x75, 0x11, 0x11, 0x80, 0x0A, 0x00, 0xA7, 0x88, 0x16, 0x04, 0x7B, 0x22, 0x22, 0x27, 0xBB, 0x80,
+  0xEA, 0x05, 0xBB, 0x11, 0x22, 0xBB, 0xBB, 0x15, 0x80, 0x03, 0x04, 0x7A, 0x25, 0xBB, 0xBB, 0x22,
+  0x80, 0x03, 0x02, 0x75, 0x5B, 0xBB, 0x8A, 0x00, 0x85, 0x30, 0x07, 0xE8, 0x82, 0xDD, 0xDD, 0x44,
+  0x44, 0xBB, 0xBB, 0x81, 0xCF, 0x81, 0x00, 0x00, 0xB4, 0x80, 0x03, 0x07, 0x2B, 0x49, 0x88, 0x88,
+  0x44, 0x44, 0xA9, 0x99, 0x85, 0x13, 0x81, 0x00, 0x04, 0x48, 0x22, 0x28, 0x94, 0x44, 0x80, 0x2F,
+  0x01, 0x44, 0x82, 0x80, 0x33, 0x80, 0x07, 0x03, 0x99, 0x99, 0x66, 0x66, 0x89, 0x1F, 0x81, 0x00,
+  0x00, 0x84, 0x80, 0x03, 0x00, 0xD8, 0x80, 0x03, 0x00, 0x22, 0x80, 0x08, 0x00, 0x31, 0x81, 0x99,
+  0x00, 0x67, 0x91, 0xB9, 0x00, 0x2A, 0x80, 0x19, 0x03, 0xA1, 0x14, 0x22, 0x23, 0x80, 0xBB, 0x0E,
+  0x23, 0x1B, 0x63, 0x22, 0x23, 0x16, 0x27, 0x22, 0x23, 0xA2, 0x2B, 0x22, 0x2A, 0xAC, 0x31, 0x80,
+  0x1A, 0x16, 0x11, 0xBA, 0xA9, 0x14, 0x14, 0x11, 0x11, 0x44, 0x44, 0x1B, 0xA1, 0x11, 0x12, 0x1A,
+  0x27, 0x11, 0x12, 0x13, 0x22, 0x31, 0x16, 0x11, 0xA2, 0x80, 0x2C, 0x01, 0x16, 0x27, 0x80, 0xF1,
+  0x00, 0xB1, 0x81, 0xF6, 0x80, 0x00, 0x80, 0x63, 0x84, 0x00, 0x81, 0x62, 0x05, 0x11, 0xC2, 0x22,
+  0x22, 0x41, 0xB2, 0x80, 0x9B, 0x00, 0x16, 0x80, 0x03, 0x00, 0x1B, 0x80, 0x03, 0x02, 0x11, 0x62,
+  0x22, 0x80, 0x86, 0x00, 0x82, 0x81, 0x8A, 0x02, 0x44, 0x44, 0x49, 0x80, 0x03, 0x00, 0x48, 0x80,
+  0x03, 0x00, 0x42, 0x84, 0x07, 0x81, 0x03, 0x00, 0x4B, 0x80, 0x35, 0x00, 0x2D, 0x83, 0x40, 0x03,
+  0x28, 0x44, 0xB9, 0x2D, 0x80, 0xF4, 0x81, 0xB3, 0x01, 0x22, 0x2E, 0x82, 0x57, 0x00, 0x2E, 0x89,
+  0xAD, 0x02, 0x88, 0x88, 0x82, 0x84, 0x3B, 0x83, 0x03, 0x01, 0x88, 0x8E, 0x8C, 0xCE, 0x07, 0xE8,
+  0x82, 0xDD, 0x2B, 0x44, 0x44, 0xBB, 0xE4, 0x80, 0x6C, 0x00, 0x28, 0x81, 0x70, 0x81, 0x4B, 0x06,
+  0x2B, 0x49, 0x99, 0x22, 0x44, 0x48, 0x11, 0x80, 0x30, 0x01, 0x11, 0xDD, 0x80, 0x80, 0x00, 0xBB,
+  0x80, 0x17, 0x80, 0x76, 0x80, 0x1E, 0x80, 0x9B, 0x01, 0x44, 0x82, 0x80, 0x53, 0x80, 0xB3, 0x09,
+  0x57, 0x11, 0x11, 0x15, 0x48, 0x11, 0x11, 0x84, 0x44, 0x87, 0x81, 0x36, 0x00, 0x44, 0x80, 0x7E,
+  0x16, 0x44, 0xBB, 0x24, 0x44, 0x4F, 0xBB, 0xB2, 0x44, 0x46, 0xBB, 0xBB, 0x24, 0x21, 0x11, 0x11,
+  0x18, 0x44, 0x11, 0x11, 0x54, 0x44, 0x88, 0x88, 0x81, 0x1D, 0x83, 0x00, 0x00, 0x72, 0x80, 0x03,
+  0x80, 0x12, 0x02, 0x44, 0x11, 0x15, 0x80, 0x08, 0x03, 0x81, 0x11, 0x11, 0x44, 0x80, 0x25, 0x82,
+  0x07, 0x00, 0x41, 0x80, 0x03, 0x02, 0x71, 0x11, 0x16, 0x80, 0x4E, 0x05, 0x18, 0x46, 0x11, 0x11,
+  0x74, 0x71, 0x80, 0x20, 0x06, 0x11, 0x11, 0x51, 0x11, 0x11, 0x11, 0x55, 0x80, 0x03, 0x00, 0x77,
+  0x80, 0x68, 0x05, 0x47, 0x11, 0x55, 0x24, 0x42, 0x11, 0x80, 0x84, 0x80, 0x03, 0x00, 0x44, 0x82,
+  0x03, 0x81, 0x42, 0x85, 0x03, 0x09, 0x16, 0x44, 0x44, 0x46, 0x11, 0x44, 0x48, 0x61, 0x11, 0x84,
+  0x80, 0x50, 0x00, 0x75, 0x80, 0x32, 0x80, 0x00, 0x04, 0x44, 0x61, 0x11, 0x11, 0x45, 0x80, 0x07,
+  0x80, 0x06, 0x80, 0x48, 0x00, 0x12, 0x80, 0x03, 0x03, 0x24, 0x51, 0x11, 0x12, 0x80, 0x65, 0x03,
+  0x24, 0x44, 0x51, 0x68, 0x80, 0x47, 0x01, 0x11, 0x72, 0x80, 0x1C, 0x00, 0x74, 0x80, 0x2F, 0x06,
+  0x74, 0x4F, 0x61, 0x11, 0x74, 0x44, 0x86, 0x80, 0x97, 0x00, 0x4F, 0x82, 0x9B, 0x81, 0x03, 0x00,
+  0x68, 0x80, 0x03, 0x01, 0x11, 0x54, 0x80, 0x24, 0x00, 0x54, 0x80, 0x07, 0x00, 0x64, 0x82, 0x03,
+  0x00, 0x71, 0x80, 0x03, 0x00, 0x21, 0x88, 0x03, 0x81, 0xDF, 0x03, 0x21, 0x11, 0x16, 0x44, 0x80,
+  0x63, 0x00, 0x74, 0x80, 0x79, 0x00, 0x17, 0x82, 0xCB, 0x00, 0x47, 0x80, 0x03, 0x01, 0x44, 0x51,
+  0x80, 0x03, 0x80, 0x8E, 0x8C, 0x00, 0x00, 0x74, 0x80, 0x03, 0x00, 0x17, 0x85, 0xFF, 0x80, 0x08,
+  0x03, 0x49, 0x66, 0xC7, 0x77, 0x80, 0x0E, 0x00, 0xA9, 0x8D, 0x27, 0x85, 0x00, 0x03, 0x22, 0x22,
+  0x22, 0x23, 0x8C, 0x03, 0x00, 0x2A, 0x81, 0x03, 0x04, 0x2A, 0x11, 0xBA, 0xA9, 0xA1, 0x81, 0xE0,
+  0x16, 0x14, 0x4B, 0xA1, 0x1B, 0x63, 0x1A, 0x27, 0x16, 0x27, 0x13, 0x22, 0xA2, 0x2B, 0x11, 0xA2,
+  0xAC, 0x31, 0x11, 0x16, 0x11, 0x14, 0x11, 0x41, 0x80, 0x81, 0x01, 0x14, 0x14, 0x81, 0x67, 0x03,
+  0x12, 0x22, 0x22, 0x14, 0x80, 0x03, 0x0C, 0x31, 0x16, 0x67, 0x22, 0x23, 0x11, 0x11, 0xC2, 0x27,
+  0x11, 0x11, 0xB2, 0xB1, 0x83, 0x98, 0x00, 0x1B, 0x81, 0x1E, 0x80, 0x4B, 0x96, 0x00, 0x00, 0xC2,
+  0x80, 0x03, 0x01, 0x44, 0x82, 0x80, 0x03, 0x80, 0x07, 0x0F, 0x49, 0x22, 0x22, 0x28, 0x48, 0x22,
+  0x2D, 0xB4, 0x42, 0x22, 0x22, 0x84, 0x48, 0x22, 0x22, 0x2E, 0x80, 0x03, 0x01, 0x22, 0x4B, 0x88,
+  0x2B, 0x03, 0x44, 0xB9, 0x88, 0x88, 0x8A, 0xB7, 0x01, 0x2E, 0x88, 0x80, 0x39, 0x87, 0x00, 0x80,
+  0x0C, 0x07, 0xE8, 0x42, 0x22, 0x2B, 0x44, 0x42, 0x22, 0xE4, 0x80, 0x03, 0x00, 0x28, 0x81, 0x52,
+  0x00, 0xB4, 0x80, 0x03, 0x03, 0x2B, 0x22, 0x22, 0x2D, 0x80, 0x0B, 0x08, 0x2D, 0x44, 0x82, 0xDD,
+  0xD2, 0x44, 0x44, 0xBB, 0xBB, 0x81, 0x3A, 0x00, 0x48, 0x85, 0x43, 0x01, 0x48, 0x88, 0x80, 0x53,
+  0x02, 0xA9, 0x99, 0x99, 0x8A, 0x57, 0x01, 0x28, 0x94, 0x81, 0x3B, 0x00, 0x84, 0x80, 0x4F, 0x00,
+  0x28, 0x81, 0x57, 0x03, 0x99, 0x66, 0x66, 0xC7, 0x89, 0x1F, 0x89, 0x00, 0x00, 0x84, 0x84, 0xE0,
+  0x00, 0x67, 0x91, 0xDC, 0x23, 0x2A, 0x11, 0xBA, 0x22, 0xA1, 0x11, 0x41, 0x23, 0x11, 0x11, 0x1B,
+  0x23, 0x1B, 0x63, 0x1A, 0x23, 0x16, 0x27, 0x1B, 0x23, 0xA2, 0x23, 0x11, 0x2A, 0xA2, 0x31, 0x11,
+  0x2A, 0x11, 0x11, 0x44, 0xA9, 0x14, 0x11, 0x44, 0x11, 0x80, 0x3F, 0x04, 0xA1, 0x11, 0x12, 0x22,
+  0x27, 0x80, 0x03, 0x03, 0x22, 0x31, 0x16, 0x67, 0x80, 0x1E, 0x06, 0x11, 0x16, 0x27, 0x14, 0x44,
+  0x11, 0xB1, 0x80, 0x18, 0x00, 0x41, 0x84, 0x8F, 0x88, 0x00, 0x00, 0xC2, 0x80, 0x03, 0x00, 0xB2,
+  0x80, 0x03, 0x00, 0x16, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x06, 0x11, 0x62, 0x22, 0x22, 0x44,
+  0x44, 0x82, 0x80, 0x03, 0x80, 0x07, 0x00, 0x49, 0x80, 0x03, 0x00, 0x48, 0x80, 0xE8, 0x00, 0x42,
+  0x82, 0x07, 0x83, 0x03, 0x80, 0x13, 0x83, 0x00, 0x06, 0xD2, 0x22, 0x28, 0x44, 0xB9, 0x88, 0xB4,
+  0x84, 0xB3, 0x80, 0x30, 0x80, 0x31, 0x01, 0x2E, 0x88, 0x82, 0x1A, 0x00, 0x24, 0x81, 0xF3, 0x80,
+  0x03, 0x00, 0x2E, 0x82, 0x45, 0x83, 0x03, 0x00, 0x2D, 0x84, 0x0F, 0x00, 0x2B, 0x80, 0x03, 0x04,
+  0x2A, 0x11, 0x44, 0x22, 0x21, 0x80, 0x03, 0x03, 0x91, 0x11, 0x44, 0x27, 0x80, 0xB0, 0x0F, 0x27,
+  0x11, 0x11, 0x19, 0x2A, 0x14, 0x14, 0x17, 0x23, 0x11, 0x44, 0x16, 0x29, 0x11, 0x11, 0x12, 0x82,
+  0xC4, 0x80, 0x00, 0x80, 0xD2, 0x08, 0x44, 0x1B, 0xAA, 0xB1, 0x44, 0x62, 0x22, 0x23, 0x11, 0x80,
+  0x55, 0x00, 0x94, 0x80, 0x03, 0x00, 0x34, 0x80, 0x03, 0x00, 0x31, 0x83, 0x19, 0x03, 0xB7, 0x66,
+  0x44, 0x1B, 0x80, 0x59, 0x04, 0xBC, 0x22, 0x22, 0x41, 0xA2, 0x83, 0xB7, 0x01, 0x41, 0x32, 0x80,
+  0x0F, 0x00, 0x17, 0x80, 0x0B, 0x04, 0x14, 0xA2, 0x22, 0x6A, 0x14, 0x80, 0x0C, 0x04, 0x31, 0x12,
+  0x22, 0x22, 0xC1, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x24, 0x84, 0x07, 0x01, 0x21, 0x32,
+  0x82, 0xAA, 0x80, 0x03, 0x00, 0x82, 0x80, 0x03, 0x00, 0x92, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03,
+  0x00, 0x48, 0x83, 0x71, 0x83, 0x00, 0x85, 0xE1, 0x89, 0x00, 0x00, 0x82, 0x80, 0x03, 0x02, 0x49,
+  0x82, 0xD2, 0x80, 0x37, 0x00, 0xB9, 0x81, 0x0A, 0x96, 0x00, 0x00, 0xD2, 0x82, 0x05, 0x06, 0x2B,
+  0x91, 0x22, 0x22, 0x28, 0x4D, 0x22, 0x80, 0xF0, 0x80, 0x0C, 0x84, 0x03, 0x00, 0x2D, 0x80, 0x03,
+  0x81, 0x0F, 0x00, 0x2B, 0x80, 0xBD, 0x00, 0x84, 0x80, 0x03, 0x13, 0x54, 0x44, 0x51, 0x11, 0x15,
+  0x44, 0x21, 0x11, 0x11, 0x74, 0x47, 0x11, 0x11, 0x18, 0x44, 0x71, 0x11, 0x16, 0x44, 0x45, 0x81,
+  0xD7, 0x81, 0x03, 0x82, 0x8F, 0x00, 0x45, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x80, 0x0F, 0x00,
+  0x45, 0x80, 0x03, 0x06, 0x41, 0x11, 0x24, 0x44, 0x81, 0x11, 0x64, 0x80, 0x28, 0x81, 0x2E, 0x80,
+  0x36, 0x00, 0x44, 0x80, 0x3E, 0x00, 0x44, 0x80, 0x0A, 0x00, 0x44, 0x80, 0x4A, 0x00, 0x44, 0x80,
+  0x0E, 0x00, 0x44, 0x80, 0x20, 0x00, 0x44, 0x80, 0x12, 0x81, 0x00, 0x81, 0x43, 0x88, 0x03, 0x00,
+  0x42, 0x80, 0x03, 0x00, 0x4C, 0x80, 0x03, 0x00, 0x48, 0x82, 0x03, 0x80, 0x00, 0x00, 0x15, 0x80,
+  0x03, 0x02, 0x74, 0x11, 0x16, 0x80, 0x43, 0x81, 0x37, 0x81, 0x24, 0x00, 0xF4, 0x80, 0x03, 0x01,
+  0xC7, 0x56, 0x81, 0x1B, 0x80, 0x0E, 0x00, 0x46, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x01, 0x61,
+  0x11, 0x82, 0x93, 0x80, 0xA4, 0x01, 0x42, 0x61, 0x82, 0x1A, 0x81, 0x00, 0x00, 0x12, 0x83, 0xA5,
+  0x00, 0x54, 0x80, 0x03, 0x81, 0x87, 0x06, 0x16, 0x44, 0x16, 0x11, 0x11, 0x66, 0x58, 0x80, 0x18,
+  0x00, 0x84, 0x80, 0x27, 0x80, 0x6A, 0x01, 0x11, 0x21, 0x80, 0xA5, 0x87, 0x03, 0x81, 0x23, 0x00,
+  0x15, 0x80, 0x03, 0x01, 0x11, 0x24, 0x82, 0x73, 0x02, 0x11, 0x16, 0x84, 0x80, 0x6E, 0x00, 0x71,
+  0x80, 0x03, 0x00, 0x47, 0x83, 0xAA, 0x8F, 0x00, 0x80, 0x2A, 0x82, 0x33, 0x04, 0x51, 0x11, 0x11,
+  0x68, 0x46, 0x81, 0x60, 0x80, 0x7B, 0x80, 0xFA, 0x82, 0x5B, 0x82, 0x93, 0x80, 0xC4, 0x80, 0x03,
+  0x00, 0x49, 0x80, 0x03, 0x00, 0x29, 0x80, 0x0A, 0x01, 0x99, 0x54, 0x80, 0x03, 0x00, 0x15, 0x80,
+  0x03, 0x07, 0x11, 0x74, 0x4C, 0x99, 0x11, 0x18, 0x42, 0x99, 0x80, 0x25, 0x00, 0x41, 0x83, 0xF8,
+  0x00, 0x14, 0x80, 0x05, 0x0B, 0x1B, 0xAA, 0x44, 0x19, 0x62, 0x22, 0x44, 0x47, 0x22, 0x22, 0x44,
+  0x46, 0x80, 0x03, 0x00, 0x12, 0x80, 0x03, 0x85, 0x67, 0x80, 0x1C, 0x0F, 0xB1, 0x44, 0x44, 0xB2,
+  0x23, 0x11, 0x44, 0xA2, 0x22, 0x91, 0x41, 0x62, 0x22, 0x34, 0x44, 0x32, 0x80, 0x03, 0x0C, 0x17,
+  0x11, 0x11, 0x41, 0x41, 0xB7, 0x66, 0x6A, 0x11, 0x22, 0x22, 0x22, 0x31, 0x80, 0x03, 0x00, 0xC1,
+  0x80, 0x03, 0x00, 0x21, 0x89, 0x03, 0x00, 0xA2, 0x80, 0x04, 0x00, 0x32, 0x80, 0x03, 0x80, 0x4A,
+  0x8E, 0x03, 0x81, 0x17, 0x00, 0x44, 0x81, 0x03, 0x00, 0x82, 0x80, 0x03, 0x00, 0x92, 0x80, 0x03,
+  0x00, 0x42, 0x80, 0x03, 0x00, 0x48, 0x81, 0x73, 0x00, 0x82, 0x80, 0x03, 0x01, 0x49, 0x82, 0x81,
+  0x77, 0x80, 0x1E, 0x92, 0x00, 0x00, 0xD2, 0x80, 0x03, 0x00, 0xB9, 0x80, 0x37, 0x00, 0x2B, 0x80,
+  0x23, 0x00, 0x28, 0x81, 0x27, 0x83, 0x03, 0x01, 0x49, 0x2D, 0x84, 0x03, 0x03, 0x2E, 0x44, 0x44,
+  0x46, 0x80, 0x1B, 0x01, 0x47, 0x2A, 0x80, 0xE0, 0x06, 0xC1, 0x14, 0x14, 0x44, 0x91, 0x11, 0x44,
+  0x80, 0xAA, 0x0C, 0x11, 0x1B, 0x11, 0x41, 0x19, 0x62, 0x11, 0x44, 0x17, 0x22, 0x11, 0x44, 0x16,
+  0x80, 0x2E, 0x00, 0x12, 0x80, 0x07, 0x02, 0x44, 0x44, 0x41, 0x81, 0xDF, 0x80, 0x08, 0x00, 0xAA,
+  0x80, 0xE0, 0x02, 0x22, 0x23, 0x14, 0x80, 0x73, 0x01, 0x91, 0x41, 0x80, 0xCE, 0x80, 0x07, 0x00,
+  0x31, 0x81, 0x18, 0x09, 0x11, 0x44, 0xBA, 0x66, 0x6A, 0x4B, 0xC2, 0x22, 0x22, 0xB2, 0x80, 0x73,
+  0x81, 0xCF, 0x00, 0x62, 0x84, 0xBB, 0x00, 0x17, 0x80, 0x03, 0x00, 0x11, 0x80, 0x10, 0x00, 0x11,
+  0x80, 0x0C, 0x00, 0x31, 0x80, 0xD0, 0x00, 0xC1, 0x80, 0x03, 0x00, 0x21, 0x89, 0x03, 0x80, 0x30,
+  0x81, 0xC1, 0x83, 0xCF, 0x00, 0x92, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00, 0x48, 0x81, 0xAA,
+  0x81, 0xDB, 0x00, 0x49, 0x99, 0xDF, 0x80, 0xDA, 0x05, 0x22, 0x44, 0xB9, 0x82, 0xD2, 0xBB, 0x80,
+  0x00, 0x00, 0x55, 0x80, 0x03, 0x03, 0x22, 0x22, 0xA7, 0x75, 0x88, 0x1E, 0x00, 0x27, 0x80, 0x02,
+  0x04, 0x89, 0x22, 0x22, 0x28, 0x99, 0x81, 0x1F, 0x82, 0x23, 0x01, 0x55, 0x55, 0x86, 0x1C, 0x07,
+  0x7D, 0xD7, 0x77, 0x22, 0x66, 0x66, 0x66, 0x98, 0x80, 0x03, 0x01, 0x66, 0xBB, 0x80, 0x9F, 0x81,
+  0xB3, 0x8D, 0x00, 0x00, 0x72, 0x80, 0x03, 0x00, 0x97, 0x80, 0x03, 0x0D, 0x29, 0x11, 0x11, 0x1C,
+  0x23, 0x11, 0x44, 0x1B, 0x27, 0x11, 0x44, 0x41, 0x22, 0x11, 0x80, 0x8F, 0x04, 0x31, 0x44, 0x11,
+  0x22, 0x61, 0x80, 0x07, 0x06, 0x27, 0x14, 0x11, 0x22, 0x22, 0x63, 0x91, 0x80, 0x22, 0x00, 0x31,
+  0x81, 0x03, 0x07, 0x32, 0x22, 0x27, 0x11, 0x1B, 0x3A, 0x31, 0x11, 0x81, 0x00, 0x81, 0xB7, 0x80,
+  0x00, 0x0C, 0x41, 0x41, 0x14, 0x11, 0x93, 0x44, 0x11, 0x72, 0x22, 0x11, 0x11, 0x1B, 0x76, 0x84,
+  0x17, 0x80, 0x03, 0x81, 0x07, 0x03, 0x13, 0xAC, 0x11, 0xB7, 0x83, 0x63, 0x09, 0x22, 0x31, 0x62,
+  0x22, 0x79, 0x1B, 0x22, 0x22, 0x11, 0x16, 0x80, 0x03, 0x05, 0x72, 0x22, 0x2D, 0x3C, 0x22, 0x2D,
+  0x80, 0xA8, 0x80, 0xAC, 0x00, 0x2D, 0x80, 0x03, 0x00, 0x75, 0x86, 0xB4, 0x02, 0x77, 0x22, 0x51,
+  0x82, 0x5A, 0x8E, 0x00, 0x81, 0x1C, 0x00, 0x7A, 0x80, 0x03, 0x01, 0x11, 0x15, 0x81, 0x67, 0x01,
+  0x11, 0x17, 0x8D, 0x1F, 0x03, 0xA7, 0x55, 0xBB, 0xBB, 0x85, 0xD3, 0x81, 0xE7, 0x01, 0x1C, 0x52,
+  0x80, 0x2B, 0x01, 0x11, 0x52, 0x81, 0x2B, 0x81, 0x03, 0x00, 0x1A, 0x81, 0x17, 0x01, 0x44, 0x88,
+  0x80, 0x03, 0x02, 0x44, 0x44, 0xB9, 0x84, 0xB7, 0x85, 0x00, 0x00, 0x49, 0x80, 0x03, 0x01, 0x47,
+  0xBB, 0x84, 0x00, 0x80, 0x8A, 0x85, 0x8B, 0x10, 0x22, 0x27, 0x7D, 0xDE, 0x77, 0x89, 0x99, 0x99,
+  0x99, 0x96, 0x66, 0x66, 0x66, 0xBB, 0xBB, 0xA2, 0x22, 0x80, 0x02, 0x8E, 0x00, 0x00, 0x9D, 0x80,
+  0xDC, 0x01, 0x66, 0x97, 0x81, 0x57, 0x00, 0x21, 0x80, 0xEF, 0x00, 0x46, 0x80, 0x03, 0x00, 0x47,
+  0x81, 0xFF, 0x00, 0x61, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x41, 0x80, 0x03, 0x00, 0x42,
+  0x81, 0x03, 0x05, 0x17, 0x48, 0x11, 0x11, 0x16, 0x81, 0x80, 0x89, 0x00, 0x61, 0x82, 0xAE, 0x00,
+  0x16, 0x8D, 0xBF, 0x00, 0x14, 0x80, 0x24, 0x00, 0x54, 0x80, 0x03, 0x00, 0x84, 0x84, 0x94, 0x00,
+  0x74, 0x88, 0x03, 0x83, 0x13, 0x00, 0x45, 0x80, 0x57, 0x00, 0x81, 0x80, 0x03, 0x01, 0x51, 0x11,
+  0x80, 0x62, 0x00, 0x11, 0x80, 0x6A, 0x00, 0x11, 0x80, 0x12, 0x03, 0x17, 0x44, 0x44, 0x77, 0x82,
+  0x1E, 0x87, 0x49, 0x06, 0x67, 0x28, 0x67, 0x78, 0x44, 0x44, 0x24, 0x8C, 0xE4, 0x0A, 0x11, 0x11,
+  0x12, 0x84, 0x11, 0x15, 0x48, 0x75, 0x88, 0x84, 0x41, 0x80, 0x43, 0x81, 0xAB, 0x81, 0x4B, 0x81,
+  0x03, 0x81, 0x0F, 0x01, 0x48, 0x55, 0x80, 0x03, 0x00, 0x88, 0x81, 0x33, 0x80, 0x50, 0x02, 0x44,
+  0x11, 0x12, 0x81, 0x2F, 0x84, 0x03, 0x80, 0x10, 0x01, 0x78, 0xF4, 0x81, 0x31, 0x00, 0x17, 0x80,
+  0x29, 0x03, 0x12, 0x44, 0x48, 0x61, 0x81, 0x91, 0x91, 0x00, 0x81, 0x47, 0x00, 0x42, 0x81, 0xFB,
+  0x00, 0x71, 0x81, 0xAC, 0x80, 0x03, 0x00, 0x48, 0x8A, 0x7F, 0x05, 0x16, 0x42, 0x99, 0x11, 0x11,
+  0x52, 0x80, 0x03, 0x00, 0x16, 0x80, 0x03, 0x06, 0x11, 0x69, 0x61, 0x11, 0x11, 0x15, 0x21, 0x80,
+  0x03, 0x03, 0x47, 0x66, 0x11, 0x58, 0x82, 0x20, 0x04, 0x1C, 0x22, 0x22, 0x44, 0x1B, 0x80, 0x03,
+  0x06, 0x11, 0xB2, 0x22, 0x44, 0x44, 0x1B, 0x3A, 0x83, 0x7D, 0x02, 0x44, 0x44, 0x14, 0x80, 0x07,
+  0x07, 0x63, 0x91, 0x11, 0x11, 0x22, 0x31, 0x44, 0x41, 0x80, 0x03, 0x05, 0x44, 0x27, 0x14, 0x44,
+  0x44, 0x31, 0x80, 0x03, 0x00, 0x11, 0x80, 0x03, 0x82, 0x57, 0x0E, 0x44, 0x11, 0xBA, 0x11, 0x93,
+  0x72, 0x22, 0x72, 0x22, 0x22, 0x31, 0x13, 0x76, 0x79, 0x1B, 0x80, 0x5B, 0x00, 0x16, 0x80, 0x32,
+  0x07, 0x72, 0x11, 0x11, 0x3C, 0x22, 0x13, 0xAC, 0x22, 0x81, 0x00, 0x00, 0x2D, 0x80, 0x03, 0x01,
+  0x75, 0xF2, 0x82, 0x0A, 0x81, 0x00, 0x05, 0x2A, 0x51, 0x22, 0x25, 0x11, 0x11, 0x80, 0x02, 0x8A,
+  0x00, 0x82, 0x1A, 0x02, 0x77, 0x7A, 0x22, 0x80, 0x0A, 0x00, 0x15, 0x8C, 0x1A, 0x84, 0x1F, 0x01,
+  0xA5, 0x55, 0x81, 0x22, 0x80, 0x67, 0x03, 0x22, 0x11, 0x17, 0xA2, 0x81, 0x27, 0x00, 0x52, 0x88,
+  0x1E, 0x01, 0xDE, 0xE2, 0x80, 0x17, 0x80, 0x8E, 0x00, 0x88, 0x89, 0xF3, 0x0C, 0x84, 0x44, 0x4A,
+  0x33, 0x22, 0xA3, 0x33, 0xFF, 0xFF, 0xF3, 0x33, 0x33, 0xBB, 0x84, 0x00, 0x02, 0x22, 0xA7, 0x75,
+  0x82, 0x47, 0x83, 0x00, 0x09, 0x27, 0x7D, 0xF2, 0x27, 0x89, 0x99, 0x4F, 0x28, 0x96, 0x66, 0x84,
+  0x1E, 0x01, 0xA2, 0x55, 0x88, 0x1D, 0x0B, 0xDE, 0x77, 0x22, 0x22, 0x99, 0x99, 0x98, 0x72, 0x66,
+  0x66, 0x99, 0x97, 0x80, 0x77, 0x00, 0x29, 0x80, 0x12, 0x00, 0x2B, 0x81, 0x34, 0x87, 0x21, 0x87,
+  0x00, 0x02, 0x44, 0x44, 0x1C, 0x80, 0x03, 0x0E, 0x13, 0x22, 0x14, 0x44, 0x41, 0x32, 0x14, 0x44,
+  0x44, 0x4B, 0x31, 0x44, 0x44, 0x41, 0x61, 0x80, 0x83, 0x00, 0x27, 0x81, 0xBB, 0x01, 0x63, 0x91,
+  0x80, 0xBF, 0x01, 0x31, 0x44, 0x82, 0x03, 0x09, 0x27, 0x11, 0x44, 0x3A, 0x31, 0x14, 0x14, 0x11,
+  0x11, 0x44, 0x80, 0x26, 0x80, 0x00, 0x00, 0x41, 0x80, 0x09, 0x03, 0x11, 0x93, 0x72, 0x41, 0x80,
+  0x60, 0x03, 0x41, 0x1B, 0x77, 0x79, 0x82, 0x0F, 0x00, 0x44, 0x81, 0x13, 0x07, 0x11, 0x3C, 0x41,
+  0x13, 0xAC, 0x22, 0xB7, 0xC2, 0x83, 0x5F, 0x04, 0x31, 0x62, 0x22, 0x22, 0x1B, 0x80, 0x07, 0x00,
+  0x16, 0x80, 0x03, 0x03, 0x72, 0x22, 0x2D, 0x55, 0x80, 0x02, 0x04, 0x55, 0x22, 0x55, 0x55, 0x55,
+  0x80, 0x06, 0x01, 0x55, 0x75, 0x80, 0x03, 0x83, 0x25, 0x02, 0x77, 0x7A, 0x51, 0x80, 0x6F, 0x91,
+  0x00, 0x80, 0x1C, 0x00, 0xA5, 0x81, 0x21, 0x00, 0x15, 0x80, 0x67, 0x03, 0x11, 0x11, 0x17, 0xA2,
+  0x8F, 0x1F, 0x3E, 0xD8, 0xD9, 0x22, 0x2E, 0xD2, 0x2D, 0x22, 0x29, 0xE2, 0x28, 0x22, 0x79, 0xE2,
+  0xF9, 0x22, 0xE9, 0x98, 0x99, 0x22, 0x78, 0x96, 0x66, 0x22, 0x2E, 0x9E, 0xD9, 0xA2, 0x27, 0x92,
+  0x29, 0x66, 0x68, 0x96, 0x66, 0x68, 0x72, 0x79, 0x66, 0x97, 0x22, 0x28, 0x66, 0x6F, 0x22, 0x28,
+  0x98, 0x67, 0x2F, 0xD8, 0xD2, 0x99, 0x99, 0x72, 0x22, 0x66, 0x99, 0xF2, 0x22, 0x97, 0xE9, 0x22,
+  0x22, 0x5D, 0x80, 0x5B, 0x00, 0x57, 0x80, 0x03, 0x07, 0xF2, 0x22, 0x22, 0x26, 0x22, 0x22, 0x71,
+  0x11, 0x80, 0x02, 0x09, 0x18, 0x26, 0x11, 0x88, 0x88, 0x21, 0x81, 0x88, 0x88, 0x31, 0x80, 0x07,
+  0x82, 0xEB, 0x80, 0x00, 0x04, 0x99, 0x99, 0x96, 0x94, 0x77, 0x80, 0x00, 0x00, 0x55, 0x81, 0x01,
+  0x80, 0xBA, 0x09, 0x57, 0x77, 0x77, 0x76, 0x76, 0x4A, 0x77, 0xC4, 0x99, 0x99, 0x83, 0x1F, 0x03,
+  0xAA, 0xA4, 0x44, 0x44, 0x80, 0x12, 0x00, 0xA4, 0x80, 0x1E, 0x00, 0x76, 0x80, 0x1F, 0x05, 0x57,
+  0x67, 0x57, 0x55, 0x55, 0x49, 0x80, 0x29, 0x85, 0x3F, 0x89, 0x00, 0x00, 0x79, 0x80, 0x03, 0x0C,
+  0x77, 0x64, 0x44, 0x44, 0x55, 0x76, 0x44, 0x44, 0x22, 0x11, 0x52, 0xA2, 0x25, 0x80, 0xC5, 0x00,
+  0x21, 0x80, 0x03, 0x80, 0x7D, 0x01, 0x22, 0x51, 0x80, 0x03, 0x02, 0xD1, 0x11, 0xA2, 0x80, 0x03,
+  0x00, 0x52, 0x80, 0x03, 0x02, 0x15, 0x22, 0x25, 0x81, 0xE3, 0x00, 0xA1, 0x81, 0xE7, 0x81, 0x1D,
+  0x00, 0x2A, 0x80, 0x03, 0x01, 0x22, 0x25, 0x80, 0x03, 0x86, 0x00, 0x80, 0x1E, 0x8E, 0x00, 0x80,
+  0x2E, 0x07, 0x1C, 0x22, 0x11, 0x17, 0xA2, 0x22, 0x11, 0xC2, 0x8D, 0x1F, 0x05, 0xC1, 0x11, 0x1C,
+  0x52, 0x25, 0x5A, 0x89, 0x40, 0x44, 0x22, 0x22, 0xD8, 0x52, 0x22, 0x2E, 0xD2, 0x12, 0x22, 0xF9,
+  0xE2, 0x15, 0x22, 0xE9, 0xE2, 0x11, 0x22, 0xE9, 0x98, 0x11, 0x22, 0x78, 0x99, 0x71, 0x22, 0x2E,
+  0x9E, 0x21, 0xA2, 0x27, 0x92, 0xD8, 0x66, 0x68, 0x99, 0x2D, 0x68, 0x72, 0x79, 0x28, 0x97, 0x22,
+  0x29, 0xF8, 0x6F, 0x22, 0x28, 0x96, 0x67, 0x2F, 0xD8, 0x66, 0x69, 0x99, 0x72, 0xD6, 0x69, 0x99,
+  0xF2, 0x29, 0x97, 0xE8, 0x22, 0xEE, 0xED, 0x22, 0x22, 0xEE, 0x53, 0x80, 0x03, 0x00, 0xF2, 0x80,
+  0xBB, 0x03, 0x22, 0x22, 0x73, 0xD2, 0x81, 0xA7, 0x0A, 0x26, 0x11, 0x88, 0x22, 0x21, 0x18, 0x88,
+  0x22, 0x31, 0x88, 0x88, 0x80, 0xEA, 0x00, 0x42, 0x84, 0x03, 0x00, 0x4F, 0x85, 0xFF, 0x00, 0x84,
+  0x80, 0x03, 0x00, 0xC4, 0x80, 0x03, 0x00, 0x98, 0x80, 0x03, 0x80, 0x93, 0x00, 0x17, 0x80, 0x03,
+  0x06, 0x24, 0x11, 0x11, 0x58, 0x44, 0x85, 0x72, 0x85, 0x21, 0x8D, 0x00, 0x07, 0x51, 0x57, 0x44,
+  0x47, 0x11, 0x11, 0x44, 0x46, 0x84, 0x03, 0x00, 0x45, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03, 0x02,
+  0x44, 0x82, 0x24, 0x81, 0x1D, 0x00, 0x94, 0x80, 0x03, 0x00, 0x17, 0x80, 0x03, 0x00, 0x16, 0x84,
+  0x03, 0x00, 0x12, 0x84, 0x5F, 0x87, 0x00, 0x0B, 0x45, 0x15, 0x44, 0x48, 0x51, 0x11, 0x44, 0xF9,
+  0x61, 0x11, 0x44, 0xC9, 0x80, 0x07, 0x09, 0x99, 0x95, 0x61, 0x4C, 0x99, 0x99, 0x95, 0x49, 0x99,
+  0x9C, 0x80, 0x1B, 0x01, 0x88, 0x88, 0x81, 0x8F, 0x0A, 0x15, 0x84, 0xFF, 0x44, 0x11, 0x16, 0x99,
+  0x99, 0x11, 0x11, 0x15, 0x80, 0x03, 0x02, 0x11, 0x15, 0x61, 0x80, 0x04, 0x00, 0x95, 0x80, 0x04,
+  0x89, 0x45, 0x03, 0x9C, 0xF4, 0x44, 0x44, 0x81, 0x32, 0x12, 0x99, 0x99, 0x98, 0x44, 0x16, 0x59,
+  0x99, 0xC4, 0x11, 0x11, 0x66, 0x5E, 0x22, 0x22, 0x22, 0x11, 0x22, 0x22, 0x25, 0x80, 0x03, 0x00,
+  0x21, 0x80, 0x03, 0x80, 0xFB, 0x07, 0x22, 0x51, 0x11, 0x22, 0x2F, 0xDD, 0xE4, 0xFF, 0x84, 0x33,
+  0x01, 0x52, 0xA2, 0x81, 0x1B, 0x01, 0x22, 0xA1, 0x80, 0x03, 0x81, 0x00, 0x02, 0x2F, 0x22, 0xFF,
+  0x80, 0x44, 0x88, 0x00, 0x80, 0x66, 0x81, 0x00, 0x04, 0x1D, 0x71, 0x1D, 0xDE, 0x44, 0x8B, 0x19,
+  0x83, 0x00, 0x07, 0xBB, 0x2E, 0xEA, 0x33, 0xEA, 0xAA, 0x33, 0x33, 0x80, 0x02, 0xB2, 0x00, 0x12,
+  0x44, 0x88, 0xD8, 0x99, 0x44, 0xE2, 0x2D, 0x98, 0x44, 0x4F, 0x28, 0x97, 0x44, 0x44, 0xF8, 0x6F,
+  0x44, 0x44, 0xE8, 0x80, 0x07, 0x01, 0x4E, 0x89, 0x80, 0x5A, 0x00, 0x48, 0x81, 0x5F, 0x1E, 0x98,
+  0x89, 0x66, 0x6D, 0x72, 0x79, 0x66, 0x97, 0x22, 0x29, 0x99, 0x82, 0x22, 0x28, 0x68, 0x22, 0x2F,
+  0xD8, 0xD2, 0x22, 0x99, 0x72, 0x22, 0x2F, 0x96, 0xF2, 0x22, 0x28, 0xE8, 0x22, 0x22, 0x80, 0x02,
+  0x85, 0x00, 0x01, 0x26, 0xA7, 0x80, 0xDE, 0x05, 0x11, 0x71, 0x11, 0x18, 0x88, 0x11, 0x80, 0x03,
+  0x00, 0x88, 0x81, 0x03, 0x02, 0x88, 0x88, 0x13, 0x80, 0x42, 0x00, 0x99, 0x81, 0x47, 0x04, 0x99,
+  0x99, 0x9A, 0xAA, 0x77, 0x80, 0x00, 0x04, 0x55, 0x55, 0x75, 0x55, 0x75, 0x80, 0x02, 0x08, 0x77,
+  0x75, 0x79, 0x67, 0x44, 0x75, 0xC4, 0x49, 0x77, 0x84, 0x3D, 0x00, 0xC2, 0x80, 0x03, 0x03, 0x11,
+  0x13, 0x62, 0x22, 0x80, 0x32, 0x80, 0x03, 0x01, 0x81, 0x17, 0x80, 0x40, 0x00, 0x11, 0x80, 0x3F,
+  0x00, 0x11, 0x84, 0x1E, 0x00, 0x25, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x71, 0x80, 0x03,
+  0x00, 0x51, 0x80, 0x03, 0x01, 0xD1, 0xE2, 0x80, 0x03, 0x00, 0x8E, 0x80, 0x03, 0x03, 0x11, 0x52,
+  0xA2, 0x25, 0x81, 0x24, 0x8A, 0x03, 0x00, 0xA2, 0x80, 0x03, 0x00, 0x52, 0x80, 0x03, 0x00, 0x15,
+  0x80, 0x03, 0x80, 0x00, 0x00, 0xA1, 0x80, 0x03, 0x81, 0x9B, 0x01, 0x22, 0x2A, 0x80, 0x03, 0x00,
+  0x22, 0x82, 0x2E, 0x00, 0xA1, 0x85, 0xB5, 0x81, 0x1F, 0x8F, 0x00, 0x06, 0x1C, 0x5A, 0x11, 0x17,
+  0xA2, 0x22, 0x11, 0x80, 0x94, 0x0F, 0xA2, 0x27, 0x68, 0x86, 0xA2, 0x27, 0x98, 0xE8, 0x72, 0x27,
+  0x97, 0x2E, 0x52, 0x22, 0xE2, 0x27, 0x80, 0x56, 0x08, 0x22, 0xA2, 0x22, 0x72, 0x27, 0x22, 0x27,
+  0x82, 0x29, 0x81, 0x03, 0x0F, 0x82, 0x79, 0x22, 0x22, 0x69, 0x99, 0x22, 0x27, 0x99, 0x88, 0x22,
+  0x28, 0xD7, 0x2E, 0x22, 0x28, 0x80, 0x1E, 0x1B, 0x78, 0xF2, 0x22, 0x22, 0xE8, 0x82, 0xFD, 0x22,
+  0xE8, 0x68, 0x8D, 0x22, 0xE8, 0x77, 0x75, 0x55, 0x57, 0x77, 0x57, 0x77, 0x6A, 0x77, 0x66, 0xAA,
+  0x44, 0x74, 0x44, 0x44, 0x82, 0x03, 0x00, 0x76, 0x80, 0x03, 0x00, 0x77, 0x80, 0x03, 0x0A, 0x55,
+  0x64, 0x44, 0x44, 0x64, 0x44, 0x65, 0xC4, 0x44, 0x44, 0x67, 0x80, 0x03, 0x00, 0x97, 0x80, 0x1A,
+  0x81, 0x03, 0x01, 0x65, 0x7A, 0x80, 0x03, 0x14, 0x7C, 0x44, 0x44, 0x75, 0x75, 0x44, 0x49, 0x75,
+  0x55, 0x44, 0x67, 0x55, 0x55, 0x44, 0x49, 0x77, 0x55, 0x44, 0x44, 0x46, 0x75, 0x80, 0x32, 0x00,
+  0x49, 0x80, 0x03, 0x82, 0x00, 0x00, 0x94, 0x80, 0x03, 0x80, 0x28, 0x0E, 0x44, 0x77, 0x77, 0xA4,
+  0x44, 0x55, 0x57, 0xC4, 0x44, 0x77, 0x55, 0x7A, 0x44, 0xC7, 0x55, 0x80, 0x59, 0x00, 0x97, 0x80,
+  0x10, 0x00, 0x46, 0x80, 0x59, 0x02, 0x97, 0x55, 0x64, 0x80, 0x36, 0x04, 0x64, 0x51, 0x11, 0x11,
+  0x52, 0x80, 0x03, 0x01, 0x1C, 0x21, 0x80, 0xD5, 0x81, 0x03, 0x81, 0xF0, 0x01, 0x22, 0xA1, 0x80,
+  0x03, 0x01, 0x22, 0x51, 0x80, 0x03, 0x00, 0x25, 0x80, 0x03, 0x05, 0x22, 0x22, 0x5A, 0x22, 0x2A,
+  0x7A, 0x87, 0xFB, 0x00, 0x15, 0x80, 0x2D, 0x03, 0xA2, 0xA1, 0x11, 0x1A, 0x80, 0x20, 0x05, 0x15,
+  0x51, 0x11, 0xA1, 0x11, 0xC2, 0x80, 0x08, 0x00, 0xC2, 0x80, 0x36, 0x81, 0x03, 0x00, 0x12, 0x80,
+  0x03, 0x05, 0x15, 0x22, 0xC5, 0x11, 0x11, 0xA2, 0x80, 0x43, 0x02, 0x17, 0x52, 0x27, 0x81, 0x47,
+  0x97, 0x00, 0x08, 0x57, 0xA2, 0x2A, 0x51, 0x25, 0xA2, 0x2F, 0x98, 0x27, 0x80, 0x03, 0x07, 0x22,
+  0x52, 0x2F, 0x67, 0x22, 0x52, 0x22, 0xE2, 0x80, 0x03, 0x1B, 0x22, 0x25, 0xA2, 0x22, 0x72, 0x7C,
+  0x22, 0x27, 0x82, 0x1A, 0x22, 0x2E, 0x82, 0x86, 0x82, 0x79, 0x22, 0xE8, 0x99, 0x98, 0x22, 0x2D,
+  0x99, 0x88, 0x22, 0x27, 0xD7, 0x2E, 0x82, 0x37, 0x19, 0x27, 0xF2, 0x22, 0x22, 0x29, 0x82, 0xFD,
+  0x22, 0x29, 0x98, 0x8D, 0x22, 0x44, 0x75, 0x55, 0x55, 0x49, 0x77, 0x77, 0x77, 0x47, 0x57, 0x66,
+  0xAA, 0x47, 0x74, 0x80, 0xDE, 0x80, 0x03, 0x01, 0x67, 0x56, 0x80, 0x03, 0x00, 0x77, 0x81, 0x03,
+  0x06, 0x64, 0x44, 0x5C, 0x44, 0x44, 0x44, 0x6A, 0x80, 0x03, 0x9E, 0x00, 0x0E, 0x4C, 0x72, 0x44,
+  0x44, 0xC1, 0x11, 0x54, 0x44, 0x71, 0x11, 0x17, 0x44, 0x51, 0x11, 0x11, 0x82, 0x03, 0x00, 0x71,
+  0x93, 0xBF, 0x80, 0x7E, 0x01, 0x22, 0x72, 0x83, 0x07, 0x00, 0x2F, 0x97, 0xDD, 0x02, 0xFF, 0xF4,
+  0xF4, 0x92, 0x68, 0x07, 0x4A, 0x33, 0x4A, 0x33, 0x3F, 0x3F, 0xFF, 0x33, 0x83, 0x00, 0x8A, 0x1A,
+  0x06, 0xAA, 0x33, 0x44, 0x3F, 0xF3, 0x33, 0xA4, 0x84, 0x1A, 0x82, 0x00, 0x04, 0x67, 0x57, 0x64,
+  0x44, 0x77, 0x80, 0xC0, 0x00, 0xAA, 0x84, 0x3C, 0x80, 0x02, 0x03, 0xFF, 0xFF, 0xFF, 0xF3, 0x86,
+  0x1F, 0x0C, 0xC9, 0xC7, 0x11, 0x11, 0xC9, 0xC4, 0x42, 0x61, 0x89, 0xE3, 0xAA, 0x3E, 0xEE, 0x80,
+  0x0F, 0x00, 0xAA, 0x84, 0x03, 0x85, 0x00, 0x03, 0x11, 0x11, 0x11, 0x16, 0x80, 0x03, 0x01, 0x11,
+  0x76, 0x80, 0x03, 0x01, 0x33, 0xE5, 0x80, 0x03, 0x01, 0x33, 0x71, 0x80, 0x03, 0x00, 0x3D, 0x80,
+  0x03, 0x01, 0x33, 0xED, 0x81, 0x1F, 0x00, 0xE3, 0x80, 0x03, 0x00, 0x53, 0x80, 0x03, 0x00, 0x6A,
+  0x80, 0x03, 0x0C, 0x1D, 0x3A, 0x75, 0x5E, 0x1D, 0xA6, 0x11, 0x11, 0x6E, 0xD1, 0x11, 0x11, 0xE3,
+  0x80, 0x03, 0x00, 0x3D, 0x81, 0x33, 0x85, 0x00, 0x02, 0xA3, 0x33, 0x33, 0x81, 0x5F, 0x01, 0x11,
+  0x7E, 0x80, 0x03, 0x01, 0x16, 0x5A, 0x81, 0x57, 0x00, 0x15, 0x81, 0x57, 0x89, 0xAB, 0x89, 0x00,
+  0x00, 0x7A, 0x80, 0x03, 0x0E, 0x15, 0x33, 0xE5, 0x5D, 0xFF, 0x44, 0x44, 0x77, 0x33, 0x34, 0x49,
+  0x77, 0x33, 0x33, 0x47, 0x80, 0x03, 0x04, 0x37, 0x74, 0x33, 0x33, 0xFC, 0x80, 0x03, 0x01, 0x33,
+  0xC6, 0x80, 0x03, 0x00, 0xF7, 0x80, 0x03, 0x05, 0x3F, 0x55, 0x55, 0x77, 0x64, 0x55, 0x80, 0xE0,
+  0x00, 0x66, 0x84, 0xE0, 0x89, 0x00, 0x00, 0xC4, 0x81, 0x04, 0x00, 0x65, 0x80, 0x05, 0x00, 0x67,
+  0x80, 0x03, 0x01, 0x97, 0x74, 0x84, 0x03, 0x00, 0x7A, 0x80, 0x0F, 0x00, 0x7C, 0x80, 0x55, 0x16,
+  0x77, 0x94, 0x49, 0x75, 0x55, 0x7A, 0x31, 0x11, 0x88, 0x81, 0x27, 0x11, 0x88, 0x88, 0x22, 0xC3,
+  0x11, 0x11, 0x22, 0x22, 0x27, 0xB1, 0x22, 0x8B, 0x00, 0x11, 0x27, 0x11, 0x62, 0x22, 0xD5, 0x88,
+  0x32, 0x22, 0x75, 0x88, 0x1C, 0x22, 0x25, 0x88, 0x13, 0x22, 0x25, 0x71, 0x80, 0x10, 0x04, 0x23,
+  0x11, 0x32, 0x22, 0x71, 0x80, 0x03, 0x00, 0x11, 0x82, 0x03, 0x00, 0x52, 0x80, 0x03, 0x01, 0x11,
+  0x5A, 0x81, 0xCB, 0x85, 0x00, 0x00, 0xA1, 0x80, 0x03, 0x01, 0x22, 0x51, 0x80, 0x03, 0x00, 0x25,
+  0x81, 0x53, 0x04, 0x22, 0xA1, 0x22, 0x2A, 0x7A, 0x80, 0x0D, 0x84, 0x00, 0x80, 0xF5, 0x0F, 0x1C,
+  0x22, 0x21, 0xC5, 0x1A, 0x22, 0x5C, 0x22, 0x15, 0x51, 0x11, 0x52, 0x11, 0xC2, 0x22, 0x22, 0x86,
+  0x03, 0x00, 0x12, 0x80, 0x03, 0x00, 0x17, 0x80, 0x03, 0x03, 0x11, 0xA2, 0x22, 0xA1, 0x80, 0x08,
+  0x0B, 0x27, 0x11, 0x11, 0x57, 0x22, 0x27, 0x98, 0x89, 0x22, 0x22, 0x77, 0xE8, 0x89, 0x94, 0x00,
+  0x52, 0x80, 0x03, 0x13, 0xB2, 0x2B, 0xBB, 0x22, 0xB2, 0xAB, 0xBB, 0x22, 0x66, 0x9D, 0x22, 0x78,
+  0x99, 0x9D, 0x22, 0xF8, 0x7E, 0xE7, 0x22, 0x28, 0x80, 0x16, 0x00, 0x2E, 0x85, 0x23, 0x12, 0xBB,
+  0xBB, 0x57, 0xA2, 0xBB, 0xBB, 0xBB, 0x22, 0x88, 0x1B, 0x62, 0x22, 0x88, 0x11, 0x13, 0x22, 0x88,
+  0x81, 0x11, 0x80, 0xE5, 0x01, 0x88, 0x88, 0x80, 0xEE, 0x1E, 0x11, 0xC1, 0x88, 0x86, 0xC3, 0x21,
+  0x88, 0x86, 0x22, 0x71, 0x88, 0x81, 0x72, 0x44, 0x46, 0x75, 0x55, 0x44, 0xA7, 0x55, 0x55, 0x77,
+  0x77, 0x75, 0x55, 0x57, 0x75, 0x55, 0x55, 0x55, 0x75, 0x80, 0x09, 0x14, 0x57, 0xA4, 0xC5, 0x67,
+  0x74, 0x44, 0x75, 0x47, 0xC4, 0x46, 0x7C, 0x57, 0x64, 0x44, 0x44, 0x57, 0x77, 0xC7, 0x77, 0x55,
+  0x77, 0x81, 0x1D, 0x02, 0x75, 0x57, 0x77, 0x84, 0x03, 0x04, 0x6A, 0x66, 0xCC, 0x69, 0x44, 0x80,
+  0x00, 0x13, 0x67, 0x75, 0x57, 0x64, 0x77, 0x55, 0x57, 0xA4, 0x75, 0x55, 0x5C, 0x44, 0x55, 0x55,
+  0xCA, 0x44, 0x57, 0x76, 0x44, 0x44, 0x80, 0x02, 0x86, 0x00, 0x80, 0x8A, 0x00, 0x71, 0x80, 0x03,
+  0x00, 0x25, 0x80, 0x03, 0x01, 0x51, 0x22, 0x80, 0xD1, 0x03, 0x22, 0x22, 0x21, 0x1A, 0x80, 0x0A,
+  0x00, 0x15, 0x80, 0xE5, 0x80, 0x03, 0x02, 0x22, 0xA5, 0x11, 0x88, 0x00, 0x0B, 0x51, 0x11, 0xA2,
+  0x11, 0x25, 0x11, 0xA2, 0x51, 0x27, 0x11, 0x52, 0x71, 0x85, 0x03, 0x01, 0x15, 0x27, 0x85, 0x1D,
+  0x05, 0x15, 0x75, 0x11, 0x11, 0x1A, 0x22, 0x83, 0x03, 0x81, 0x3E, 0x02, 0x1C, 0x22, 0xA2, 0x80,
+  0x03, 0x84, 0x1C, 0x03, 0x1A, 0x51, 0x77, 0x7A, 0x85, 0xFA, 0x81, 0x00, 0x00, 0x2B, 0x85, 0x03,
+  0x03, 0x84, 0x44, 0x49, 0x2C, 0x80, 0x86, 0x00, 0x99, 0x88, 0x92, 0x02, 0x44, 0x2E, 0x84, 0x80,
+  0x97, 0x0B, 0xE4, 0x42, 0x22, 0x22, 0xE4, 0xB2, 0x2E, 0x89, 0x99, 0x68, 0x22, 0xE8, 0x80, 0x03,
+  0x02, 0x22, 0xFE, 0xE7, 0x89, 0x3F, 0x04, 0x22, 0x22, 0xBB, 0xBB, 0x57, 0x80, 0x03, 0x23, 0x1D,
+  0x97, 0x77, 0x7C, 0xA4, 0xA7, 0x75, 0x77, 0x76, 0x47, 0x55, 0x77, 0x77, 0x46, 0x77, 0x77, 0x77,
+  0x44, 0x77, 0x77, 0x57, 0x44, 0x47, 0x77, 0x5A, 0x9A, 0xAC, 0xCC, 0xC3, 0xFF, 0x33, 0x33, 0x33,
+  0x44, 0x44, 0x4A, 0x80, 0x51, 0x00, 0xA7, 0x80, 0x16, 0x05, 0x77, 0xC4, 0x77, 0x57, 0x55, 0x56,
+  0x80, 0x1E, 0x06, 0x77, 0xAC, 0xCF, 0xFC, 0x93, 0x33, 0x3F, 0x81, 0x1D, 0x81, 0x1F, 0x87, 0x00,
+  0x08, 0x4F, 0x33, 0x33, 0x3A, 0xCE, 0xAA, 0x33, 0x33, 0xEE, 0x80, 0x03, 0x06, 0xAA, 0xAA, 0xAA,
+  0x33, 0xAA, 0xA3, 0xAA, 0x86, 0x1F, 0x80, 0x0F, 0x05, 0xA3, 0xFF, 0xFF, 0xFF, 0xF3, 0x33, 0x80,
+  0x04, 0x83, 0x39, 0x83, 0x00, 0x84, 0x1E, 0x00, 0x4A, 0x80, 0x0A, 0x89, 0x16, 0x8A, 0x1F, 0x80,
+  0x3A, 0x80, 0x36, 0x91, 0x1D, 0x80, 0x1F, 0x02, 0x45, 0x11, 0x17, 0x80, 0x6D, 0x00, 0xA3, 0x93,
+  0x1D, 0x01, 0x33, 0x33, 0x80, 0x58, 0x00, 0x3F, 0x95, 0x1B, 0x83, 0x00, 0x80, 0x58, 0x95, 0x5C,
+  0x8C, 0xDF, 0x84, 0x00, 0x00, 0x46, 0x80, 0x03, 0x00, 0x63, 0x85, 0x03, 0x03, 0x31, 0x11, 0x11,
+  0x11, 0x85, 0x03, 0x00, 0x3D, 0x80, 0x03, 0x01, 0x15, 0xD7, 0x80, 0x04, 0x08, 0x7A, 0xD7, 0x61,
+  0x11, 0x5E, 0x22, 0x22, 0x11, 0x62, 0x80, 0x03, 0x94, 0x00, 0x00, 0x56, 0x80, 0x03, 0x01, 0x22,
+  0x25, 0x80, 0x2F, 0x00, 0x3A, 0x80, 0x03, 0x03, 0xED, 0x11, 0x11, 0x17, 0x80, 0x29, 0x02, 0x12,
+  0x22, 0x75, 0x81, 0x32, 0x00, 0x75, 0x80, 0x03, 0x09, 0x22, 0x62, 0x61, 0x16, 0x52, 0x75, 0x11,
+  0x11, 0x16, 0x57, 0x80, 0xD9, 0x01, 0x11, 0x6E, 0x80, 0x03, 0x00, 0x15, 0x84, 0x03, 0x07, 0x1D,
+  0xA3, 0x33, 0x27, 0x61, 0x6E, 0x33, 0x25, 0x80, 0x0C, 0x1A, 0x25, 0x11, 0x16, 0x33, 0xFC, 0xA4,
+  0x44, 0x44, 0x3F, 0x76, 0x44, 0x44, 0x33, 0xC7, 0x77, 0x77, 0x33, 0xFC, 0x55, 0x75, 0x33, 0x33,
+  0x55, 0x57, 0x33, 0x33, 0x36, 0x80, 0x07, 0x01, 0x3A, 0x67, 0x80, 0xBE, 0x26, 0xA7, 0x46, 0x75,
+  0x57, 0x77, 0xA7, 0x75, 0x55, 0x77, 0x77, 0x55, 0x55, 0x55, 0x77, 0x55, 0x57, 0x75, 0x75, 0x77,
+  0x77, 0x75, 0x77, 0xA4, 0xC5, 0x77, 0x74, 0x44, 0x77, 0x6A, 0xC4, 0x46, 0x7C, 0x44, 0x64, 0x44,
+  0x44, 0x67, 0x77, 0xCC, 0x80, 0x14, 0x05, 0x55, 0x77, 0x57, 0x55, 0x55, 0x75, 0x81, 0x01, 0x00,
+  0x77, 0x80, 0x32, 0x03, 0x76, 0x66, 0xCC, 0x69, 0x82, 0xEC, 0x02, 0x77, 0x55, 0x64, 0x80, 0x03,
+  0x09, 0xA4, 0x44, 0x55, 0x5C, 0x44, 0x44, 0x55, 0xCA, 0x44, 0x44, 0x80, 0x6A, 0x8A, 0x00, 0x04,
+  0x22, 0x22, 0x71, 0x11, 0x22, 0x80, 0xC8, 0x11, 0x22, 0x22, 0x51, 0x11, 0x22, 0x27, 0x11, 0x51,
+  0x22, 0x21, 0x1A, 0x25, 0x22, 0x51, 0x15, 0x27, 0x22, 0x11, 0x80, 0x03, 0x02, 0x22, 0xA5, 0x27,
+  0x80, 0xE6, 0x00, 0x15, 0x86, 0xF4, 0x00, 0xA2, 0x81, 0x03, 0x04, 0x51, 0x11, 0x11, 0x52, 0x71,
+  0x81, 0x03, 0x00, 0x22, 0x80, 0x03, 0x00, 0xA2, 0x81, 0x20, 0x82, 0x00, 0x06, 0x15, 0x75, 0x51,
+  0x11, 0x1A, 0x22, 0x22, 0x82, 0x03, 0x00, 0x15, 0x80, 0x03, 0x00, 0x1C, 0x83, 0x03, 0x03, 0x44,
+  0x49, 0x8B, 0x4B, 0x80, 0x66, 0x03, 0x49, 0xB4, 0x88, 0x94, 0x80, 0x6C, 0x09, 0x84, 0x49, 0x44,
+  0x2D, 0xB4, 0x92, 0xE2, 0x22, 0x89, 0x22, 0x87, 0x00, 0x09, 0x2B, 0x44, 0xE2, 0x22, 0xE4, 0x46,
+  0x44, 0xB2, 0xB4, 0x97, 0x81, 0xAE, 0x0D, 0x2E, 0x94, 0x49, 0x77, 0x22, 0xE4, 0x47, 0x77, 0x2D,
+  0xB4, 0x9C, 0x6A, 0x2D, 0xB4, 0x81, 0xBF, 0x01, 0x57, 0x76, 0x80, 0xFB, 0x09, 0x75, 0x57, 0x6C,
+  0x75, 0x55, 0x56, 0x49, 0x75, 0x55, 0x7A, 0x81, 0x03, 0x01, 0x46, 0x75, 0x80, 0xCD, 0x01, 0x96,
+  0xCC, 0x81, 0xBF, 0x11, 0x67, 0x76, 0x77, 0x5A, 0x77, 0x77, 0x55, 0xC4, 0x77, 0x77, 0x77, 0xA4,
+  0x64, 0x67, 0x57, 0x44, 0xA4, 0x67, 0x80, 0xE1, 0x05, 0x75, 0x7A, 0x44, 0x49, 0x77, 0xC4, 0x80,
+  0x03, 0x00, 0x64, 0x80, 0xDF, 0x86, 0x00, 0x04, 0x26, 0x22, 0x26, 0xA3, 0x91, 0x80, 0xE3, 0x81,
+  0xE7, 0x04, 0x73, 0x22, 0x27, 0x1B, 0x27, 0x80, 0x03, 0x80, 0x16, 0x0D, 0x27, 0x32, 0x22, 0x73,
+  0x11, 0x12, 0x31, 0x11, 0x11, 0x12, 0x11, 0x44, 0x14, 0x12, 0x80, 0xC9, 0x83, 0x03, 0x06, 0x1B,
+  0x73, 0x12, 0x94, 0x13, 0x27, 0x12, 0x82, 0x39, 0x04, 0x25, 0x11, 0x72, 0x22, 0x21, 0x80, 0xD5,
+  0x00, 0x21, 0x80, 0xDD, 0x00, 0xA1, 0x80, 0x03, 0x80, 0xFE, 0x86, 0x03, 0x02, 0x27, 0xA2, 0xA5,
+  0x82, 0x22, 0x0D, 0x1D, 0x52, 0xA7, 0x25, 0x11, 0x52, 0x71, 0x21, 0x11, 0x52, 0x51, 0x51, 0x11,
+  0xC2, 0x80, 0x19, 0x00, 0x15, 0x80, 0x46, 0x04, 0x11, 0x11, 0xA2, 0x51, 0x1C, 0x80, 0x1C, 0x80,
+  0x03, 0x80, 0x00, 0x0F, 0x52, 0xAA, 0x22, 0x2A, 0x52, 0x51, 0x1A, 0x25, 0x52, 0x51, 0x12, 0x2B,
+  0x15, 0x11, 0x52, 0xAB, 0x80, 0x1D, 0x00, 0x5B, 0x81, 0xC3, 0x82, 0x00, 0x0D, 0x48, 0x84, 0xB2,
+  0x82, 0x22, 0xE4, 0x9D, 0x22, 0x22, 0x84, 0x92, 0x22, 0x22, 0x94, 0x80, 0x03, 0x01, 0x84, 0x82,
+  0x83, 0xB6, 0x07, 0x2E, 0xDE, 0x22, 0x22, 0xF4, 0x44, 0xBB, 0xA2, 0x80, 0x03, 0x04, 0x2F, 0x44,
+  0x44, 0xBB, 0x24, 0x80, 0x03, 0x00, 0x54, 0x80, 0x03, 0x00, 0xB4, 0x83, 0x03, 0x06, 0x48, 0xB2,
+  0xEA, 0xAA, 0x3E, 0xA3, 0x33, 0xA6, 0x00, 0x00, 0x3F, 0x84, 0x03, 0x88, 0x00, 0x00, 0xD1, 0x84,
+  0x03, 0x00, 0xA1, 0x80, 0x03, 0x00, 0x3D, 0x84, 0x13, 0x00, 0xA6, 0x84, 0x13, 0x06, 0x71, 0x11,
+  0x62, 0x22, 0x22, 0x11, 0x12, 0x80, 0x03, 0x0C, 0x6E, 0x22, 0x22, 0x65, 0xEA, 0x22, 0x22, 0xEE,
+  0xEA, 0xE2, 0x22, 0x11, 0x16, 0x80, 0x03, 0x01, 0x11, 0x7A, 0x80, 0x03, 0x01, 0x73, 0xA2, 0x80,
+  0xDC, 0x00, 0x67, 0x83, 0xA7, 0x01, 0x22, 0x27, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x0E, 0x71,
+  0x22, 0x22, 0x56, 0x61, 0x22, 0x27, 0x11, 0x11, 0x22, 0x22, 0x51, 0x11, 0x25, 0x11, 0x80, 0x07,
+  0x09, 0x61, 0x11, 0x11, 0x55, 0x56, 0x61, 0x15, 0x11, 0x11, 0x15, 0x80, 0x33, 0x00, 0x11, 0x80,
+  0x19, 0x05, 0x16, 0x25, 0x16, 0x56, 0x62, 0x25, 0x80, 0x20, 0x04, 0x27, 0x77, 0x11, 0x11, 0xD3,
+  0x80, 0x10, 0x00, 0x5A, 0x80, 0x23, 0x03, 0x7C, 0x56, 0x55, 0x65, 0x80, 0x5B, 0x00, 0x5B, 0x80,
+  0x23, 0x00, 0x16, 0x81, 0x27, 0x81, 0x03, 0x00, 0x72, 0x89, 0xA8, 0x81, 0xE6, 0x04, 0xA3, 0xAA,
+  0x33, 0x33, 0xEA, 0x80, 0x03, 0x06, 0x22, 0xA3, 0x33, 0xAA, 0x22, 0x22, 0xCE, 0x80, 0x09, 0x05,
+  0xF3, 0xC5, 0x33, 0x33, 0xFF, 0xF5, 0x8F, 0xD6, 0x83, 0x00, 0x1F, 0x56, 0x77, 0x7A, 0x44, 0x75,
+  0x57, 0xC4, 0x44, 0x55, 0x57, 0xA4, 0x44, 0xC5, 0x77, 0x44, 0x44, 0xF5, 0x76, 0x44, 0x44, 0x3C,
+  0x7A, 0x44, 0x44, 0x3F, 0xC4, 0x44, 0x44, 0x33, 0x34, 0x44, 0x44, 0x84, 0xBB, 0x80, 0x00, 0x1C,
+  0x26, 0x31, 0x2C, 0xA3, 0x91, 0x11, 0x2A, 0x11, 0x11, 0x44, 0x2A, 0x11, 0x73, 0x44, 0x2A, 0x1B,
+  0x27, 0x11, 0x27, 0x1B, 0x22, 0x91, 0x22, 0x27, 0x32, 0x22, 0x73, 0x91, 0x92, 0x80, 0x8B, 0x00,
+  0x12, 0x82, 0x03, 0x01, 0x44, 0x44, 0x80, 0x03, 0x80, 0x07, 0x06, 0x4B, 0x73, 0x92, 0x22, 0x13,
+  0x27, 0x92, 0x82, 0x39, 0x13, 0x25, 0x11, 0x72, 0x22, 0x21, 0x11, 0x15, 0x25, 0x21, 0x11, 0x1A,
+  0x25, 0xA1, 0x11, 0x1A, 0x21, 0x71, 0x11, 0x11, 0x51, 0x80, 0x03, 0x00, 0x11, 0x81, 0x03, 0x03,
+  0x27, 0xA2, 0xA5, 0xA2, 0x81, 0x23, 0x0D, 0x15, 0x52, 0xA7, 0x22, 0x11, 0x52, 0x71, 0x52, 0x11,
+  0x52, 0x51, 0x52, 0x11, 0xC2, 0x80, 0x07, 0x00, 0x15, 0x80, 0x01, 0x80, 0x00, 0x01, 0x51, 0x1C,
+  0x80, 0x3F, 0x80, 0x03, 0x81, 0x00, 0x13, 0xAA, 0x22, 0x2A, 0x5B, 0x51, 0x1A, 0x25, 0xBB, 0x51,
+  0x12, 0x2B, 0xBB, 0x11, 0x52, 0xAB, 0xBB, 0x11, 0xA2, 0x5B, 0xBB, 0x85, 0x9D, 0x00, 0x82, 0x80,
+  0x03, 0x00, 0x48, 0x80, 0x03, 0x04, 0x44, 0xB2, 0x22, 0x22, 0x94, 0x80, 0x03, 0x86, 0x00, 0x09,
+  0x44, 0x44, 0x96, 0x28, 0x44, 0xA6, 0x75, 0x28, 0x44, 0x97, 0x81, 0x03, 0x05, 0x55, 0x28, 0x44,
+  0x65, 0x55, 0x2B, 0x80, 0x03, 0x04, 0x84, 0x44, 0x67, 0x55, 0x44, 0x80, 0x03, 0x0E, 0x64, 0x96,
+  0x6A, 0x44, 0x64, 0x97, 0x77, 0x74, 0xA4, 0x97, 0x57, 0x64, 0xA4, 0x77, 0x55, 0x80, 0x03, 0x80,
+  0x07, 0x0E, 0x67, 0x57, 0xC4, 0xA4, 0x47, 0x55, 0x76, 0x74, 0x46, 0x75, 0x77, 0x44, 0x97, 0xA4,
+  0x44, 0x81, 0x00, 0x00, 0x4C, 0x80, 0x06, 0x01, 0x97, 0x7A, 0x80, 0x03, 0x04, 0x7C, 0x44, 0x44,
+  0x46, 0x77, 0x80, 0x10, 0x80, 0x03, 0x09, 0xA4, 0x67, 0x44, 0x44, 0x22, 0x2A, 0x11, 0x62, 0x22,
+  0x23, 0x80, 0x03, 0x85, 0x00, 0x06, 0x23, 0x11, 0xA2, 0x22, 0x23, 0x41, 0xB2, 0x80, 0x07, 0x00,
+  0x32, 0x81, 0x0B, 0x06, 0xB1, 0x1B, 0x22, 0x92, 0x31, 0x11, 0x22, 0x82, 0xE3, 0x81, 0x00, 0x0F,
+  0x71, 0x11, 0x62, 0x72, 0x61, 0x44, 0x62, 0xA2, 0x61, 0x41, 0x62, 0x32, 0x71, 0x44, 0xBA, 0x92,
+  0x80, 0x10, 0x04, 0x11, 0x22, 0x25, 0x55, 0x55, 0x88, 0xB1, 0x8A, 0x00, 0x00, 0x11, 0x80, 0x00,
+  0x00, 0x51, 0x80, 0x03, 0x03, 0x22, 0x27, 0x5C, 0x11, 0x80, 0x0E, 0x00, 0x2A, 0x8C, 0x1E, 0x00,
+  0x2A, 0x80, 0x19, 0x00, 0xBB, 0x82, 0x03, 0x10, 0x15, 0x22, 0xBB, 0x75, 0x5A, 0x27, 0xBB, 0x22,
+  0x22, 0x25, 0xBB, 0x22, 0xA7, 0x5B, 0xBB, 0xAB, 0xBB, 0x83, 0x00, 0x87, 0x2A, 0x0C, 0x2B, 0xB2,
+  0x22, 0x22, 0x84, 0x42, 0x22, 0x22, 0xB4, 0x82, 0x22, 0x2D, 0xB4, 0x80, 0x0F, 0x00, 0x8B, 0x84,
+  0xAF, 0x01, 0x33, 0x33, 0x81, 0x03, 0x08, 0x28, 0x83, 0x33, 0x33, 0x24, 0x4F, 0x33, 0x33, 0x29,
+  0x80, 0x03, 0x00, 0x22, 0x80, 0x0B, 0x85, 0x17, 0x80, 0x00, 0x00, 0xA5, 0x82, 0x05, 0x94, 0x00,
+  0x05, 0x11, 0x16, 0xE3, 0x3E, 0xAA, 0xDA, 0x97, 0x1F, 0x0F, 0x22, 0x22, 0x51, 0x11, 0xE2, 0x22,
+  0x75, 0x11, 0x3A, 0xE2, 0x22, 0x27, 0x33, 0x3E, 0xE2, 0x25, 0x80, 0x12, 0x00, 0xE5, 0x80, 0x03,
+  0x00, 0x3D, 0x86, 0x3F, 0x01, 0x22, 0x27, 0x80, 0xBA, 0x08, 0x21, 0x11, 0x66, 0x52, 0xB6, 0x11,
+  0x11, 0x16, 0x27, 0x80, 0xE9, 0x07, 0xCC, 0x71, 0x11, 0x16, 0xAA, 0xA5, 0xD6, 0x6D, 0x83, 0x1F,
+  0x11, 0x57, 0x51, 0x16, 0x22, 0x15, 0x22, 0x72, 0x2E, 0x11, 0x52, 0x2C, 0xE3, 0x11, 0x1D, 0xA3,
+  0x33, 0x11, 0x1D, 0x80, 0x33, 0x04, 0x6A, 0x33, 0x33, 0xDD, 0xA3, 0x80, 0x1C, 0x00, 0xAA, 0x81,
+  0x5F, 0x0D, 0x22, 0xEA, 0xE2, 0x22, 0x22, 0x2E, 0x3A, 0xAE, 0x22, 0x2E, 0x33, 0x33, 0xE2, 0x2C,
+  0x80, 0x03, 0x00, 0x22, 0x83, 0x03, 0x00, 0xA2, 0x80, 0x03, 0x00, 0x3A, 0x80, 0x03, 0x8B, 0x00,
+  0x02, 0xAA, 0xA3, 0xAA, 0x81, 0x33, 0x00, 0x2E, 0x83, 0xFC, 0x00, 0x22, 0x8E, 0x1F, 0x81, 0x00,
+  0x00, 0xE3, 0x80, 0x03, 0x00, 0x2C, 0x80, 0x5F, 0x81, 0x51, 0x06, 0x44, 0x4F, 0x22, 0x22, 0x44,
+  0x44, 0xF2, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00, 0x44, 0x81, 0x03, 0x00, 0xF2, 0x80, 0x03,
+  0x00, 0x42, 0x80, 0x03, 0x82, 0x00, 0x07, 0x27, 0x11, 0x62, 0xB1, 0x23, 0x11, 0x62, 0x31, 0x85,
+  0x4F, 0x0A, 0x23, 0x11, 0xA2, 0x71, 0x23, 0x44, 0xB2, 0x61, 0x23, 0x44, 0x32, 0x80, 0x03, 0x08,
+  0xA2, 0x71, 0x1B, 0x22, 0x92, 0x22, 0x11, 0x22, 0xA2, 0x85, 0x1E, 0x03, 0x22, 0x11, 0x62, 0x72,
+  0x80, 0x03, 0x0A, 0xA2, 0x22, 0x41, 0x62, 0x32, 0x22, 0x44, 0xBA, 0x92, 0x22, 0x71, 0x80, 0xF1,
+  0x03, 0x25, 0x55, 0x55, 0x51, 0x86, 0x20, 0x8C, 0x00, 0x80, 0x1E, 0x82, 0x00, 0x07, 0x27, 0x5C,
+  0x11, 0x11, 0x22, 0x22, 0x2A, 0x75, 0x88, 0x1A, 0x00, 0xAB, 0x80, 0x0F, 0x03, 0xBB, 0x11, 0x22,
+  0xBB, 0x82, 0x03, 0x00, 0x15, 0x80, 0x03, 0x0A, 0x5A, 0x27, 0xBB, 0xBB, 0x22, 0x25, 0xBB, 0xBB,
+  0xA7, 0x5B, 0xBB, 0x86, 0x00, 0x89, 0x4B, 0x04, 0x2E, 0xE2, 0x22, 0x22, 0x00, 0x8C, 0x00, 0x07,
+  0x44, 0x44, 0x77, 0x55, 0x44, 0x44, 0x96, 0x66, 0x85, 0xCF, 0x8D, 0x1F, 0x07, 0x76, 0xA7, 0x55,
+  0x57, 0x66, 0x66, 0xCC, 0xCC, 0x95, 0x1F, 0x00, 0x17, 0x80, 0x95, 0x81, 0x99, 0x01, 0x2C, 0x73,
+  0x83, 0x63, 0x8D, 0x1F, 0x03, 0x22, 0x23, 0x11, 0x13, 0x80, 0x03, 0x08, 0x14, 0x22, 0x23, 0x1B,
+  0x73, 0x22, 0x23, 0x17, 0x27, 0x8D, 0x1F, 0x0F, 0x91, 0x14, 0x11, 0x12, 0x11, 0x31, 0x14, 0x12,
+  0x1A, 0x2A, 0x11, 0x12, 0x13, 0x22, 0x31, 0x1C, 0x8F, 0x9F, 0x87, 0x00, 0x00, 0x4A, 0x90, 0x7F,
+  0x80, 0x12, 0x00, 0x42, 0x80, 0x03, 0x00, 0x92, 0x80, 0x03, 0x03, 0x22, 0x44, 0x44, 0x49, 0x8F,
+  0x7F, 0x86, 0x00, 0x00, 0x2D, 0x80, 0x03, 0x01, 0xB4, 0x98, 0x97, 0x1F, 0x04, 0x22, 0x22, 0x88,
+  0x28, 0xE2, 0x8F, 0x3F, 0x04, 0x2F, 0x33, 0x33, 0x22, 0xDF, 0x84, 0x03, 0x02, 0x29, 0x33, 0x33,
+  0x8D, 0x1F, 0x00, 0x33, 0x8C, 0x00, 0x90, 0x1F, 0x00, 0xAE, 0x99, 0x1F, 0x07, 0xEE, 0xEE, 0xEE,
+  0xE2, 0x3A, 0x3A, 0xAA, 0xAA, 0x80, 0x1A, 0x00, 0x3D, 0x80, 0x03, 0x00, 0xE2, 0x8E, 0x7F, 0x00,
+  0x2C, 0x80, 0x77, 0x81, 0x03, 0x00, 0x2E, 0x80, 0x03, 0x00, 0xC3, 0x8F, 0x3F, 0x0F, 0x36, 0x77,
+  0x76, 0x77, 0x3C, 0x77, 0x77, 0x77, 0x33, 0xC6, 0x96, 0x79, 0x33, 0xF9, 0x49, 0x76, 0x8D, 0x1F,
+  0x08, 0x11, 0x14, 0x12, 0x22, 0x31, 0x44, 0x12, 0x22, 0x2A, 0x80, 0x07, 0x03, 0x22, 0x31, 0x1C,
+  0x26, 0x8D, 0x1F, 0x00, 0x44, 0x8C, 0x00, 0x8F, 0x1F, 0x04, 0x42, 0x22, 0x44, 0x44, 0x92, 0x80,
+  0x03, 0x05, 0x22, 0x22, 0x44, 0x49, 0x22, 0x22, 0x8E, 0x9F, 0x85, 0x00, 0x06, 0x2D, 0x22, 0x22,
+  0x2E, 0xB4, 0x98, 0x88, 0x8D, 0x1F,
+};
+static const u8 ILLUSTRATION_MAP_skel_c[] = {
+  0x08, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x9A, 0x00, 0x7F, 0x20, 0x01, 0x20, 0x02, 0x20, 0x03, 0x40,
+  0x04, 0x40, 0x05, 0x40, 0x06, 0x40, 0x07, 0x20, 0x08, 0x20, 0x09, 0x20, 0x0A, 0x20, 0x0B, 0x20,
+  0x0C, 0x20, 0x0D, 0x40, 0x0E, 0x40, 0x0F, 0x40, 0x10, 0x40, 0x11, 0x20, 0x12, 0x20, 0x13, 0x20,
+  0x14, 0x20, 0x15, 0x20, 0x16, 0x20, 0x17, 0x40, 0x18, 0x40, 0x19, 0x40, 0x1A, 0x40, 0x1B, 0x20,
+  0x1C, 0x20, 0x1D, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x20, 0x20, 0x21, 0x00, 0x22, 0x40, 0x23, 0x40,
+  0x24, 0x40, 0x25, 0x20, 0x26, 0x20, 0x27, 0x20, 0x28, 0x20, 0x29, 0x20, 0x2A, 0x00, 0x2B, 0x00,
+  0x2C, 0x40, 0x2D, 0x00, 0x2E, 0x20, 0x2F, 0x20, 0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+  0x34, 0x40, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x20, 0x39, 0x20, 0x3A, 0x20, 0x3B, 0x20,
+  0x3C, 0x20, 0x3D, 0x20, 0x3E, 0x40, 0x3F, 0x00, 0x40, 0x7F, 0x00, 0x41, 0x00, 0x42, 0x20, 0x43,
+  0x20, 0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x48, 0x20, 0x49, 0x00, 0x4A, 0x00, 0x4B,
+  0x40, 0x4C, 0x40, 0x4D, 0x20, 0x4E, 0x20, 0x4F, 0x20, 0x50, 0x20, 0x51, 0x40, 0x52, 0x00, 0x53,
+  0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x20, 0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5A, 0x20, 0x5B,
+  0x20, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60, 0x40, 0x61, 0x20, 0x62, 0x20, 0x63,
+  0x20, 0x64, 0x20, 0x65, 0x20, 0x66, 0x40, 0x67, 0x40, 0x68, 0x00, 0x69, 0x00, 0x6A, 0x40, 0x6B,
+  0x20, 0x6C, 0x20, 0x6D, 0x20, 0x6E, 0x20, 0x6F, 0x20, 0x70, 0x40, 0x71, 0x40, 0x72, 0x40, 0x73,
+  0x40, 0x74, 0x00, 0x75, 0x20, 0x76, 0x20, 0x77, 0x20, 0x78, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B,
+  0x00, 0x7C, 0x00, 0x7D, 0x40, 0x7E, 0x20, 0x7F, 0x20, 0x80, 0x7F, 0x20, 0x81, 0x00, 0x82, 0x00,
+  0x83, 0x00, 0x84, 0x00, 0x85, 0x00, 0x86, 0x40, 0x87, 0x00, 0x88, 0x20, 0x89, 0x20, 0x8A, 0x20,
+  0x8B, 0x20, 0x8C, 0x00, 0x8D, 0x00, 0x8E, 0x00, 0x8F, 0x00, 0x90, 0x00, 0x91, 0x00, 0x92, 0x40,
+  0x93, 0x20, 0x94, 0x20, 0x95, 0x20, 0x96, 0x00, 0x97, 0x00, 0x98, 0x00, 0x99, 0x00, 0x9A, 0x00,
+  0x9B, 0x00, 0x9C, 0x00, 0x9D, 0x20, 0x9E, 0x20, 0x9F, 0x20, 0xA0, 0x00, 0xA1, 0x00, 0xA2, 0x00,
+  0xA3, 0x00, 0xA4, 0x40, 0xA5, 0x40, 0xA6, 0x20, 0xA7, 0x20, 0xA8, 0x20, 0xA9, 0x00, 0xAA, 0x00,
+  0xAB, 0x00, 0xAC, 0x40, 0xAD, 0x00, 0xAE, 0x40, 0xAF, 0x60, 0xB0, 0x60, 0xB1, 0x60, 0xB2, 0x20,
+  0xB3, 0x60, 0xB4, 0x00, 0xB5, 0x00, 0xB6, 0x40, 0xB7, 0x00, 0xB8, 0x00, 0xB9, 0x40, 0xBA, 0x40,
+  0xBB, 0x20, 0xBC, 0x20, 0xBD, 0x20, 0xBE, 0x00, 0xBF, 0x00, 0xC0, 0x45, 0x00, 0xC1, 0x40, 0xC2,
+  0x00, 0xC3, 0x40, 0xC4, 0x40, 0xC5, 0x20, 0xC6, 0x20, 0xC7, 0x20, 0xC8, 0x00, 0xC9, 0x00, 0xCA,
+  0x00, 0xCB, 0x00, 0xCC, 0x40, 0xCD, 0x40, 0xCE, 0x00, 0xCF, 0x20, 0xD0, 0x00, 0xD1, 0x00, 0xD2,
+  0x00, 0xD3, 0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD6, 0x40, 0xD7, 0x60, 0xD8, 0x60, 0xD9, 0x60, 0xDA,
+  0x60, 0xDB, 0x60, 0xDC, 0x60, 0xDD, 0x00, 0xDE, 0x00, 0xDF, 0x40, 0xE0, 0x00, 0xE1, 0x40, 0xE2,
+  0x40, 0xE3, 0x80, 0x29, 0x10, 0xE4, 0x00, 0xE5, 0x00, 0xE6, 0x00, 0xE7, 0x00, 0xE8, 0x00, 0xE9,
+  0x00, 0xEA, 0x40, 0xEB, 0x40, 0xEC, 0x80, 0x13, 0x54, 0xED, 0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF0,
+  0x00, 0xF1, 0x40, 0xF2, 0x40, 0xF3, 0x40, 0xF4, 0x40, 0xF5, 0x00, 0xF6, 0x00, 0xF7, 0x00, 0xF8,
+  0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC, 0x60, 0xFD, 0x00, 0x1D, 0x60, 0xFE, 0x60, 0xFF,
+  0x61, 0x00, 0x61, 0x01, 0x61, 0x02, 0x61, 0x03, 0x01, 0x04, 0x01, 0x05, 0x41, 0x06, 0x41, 0x07,
+  0x41, 0x08, 0x41, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F,
+  0x41, 0x10, 0x41, 0x11, 0x41, 0x12, 0x41, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x16, 0x80, 0x01,
+  0x0E, 0x17, 0x41, 0x18, 0x41, 0x19, 0x41, 0x1A, 0x41, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x01, 0x1E,
+  0x82, 0x13, 0x24, 0x1F, 0x41, 0x20, 0x61, 0x21, 0x61, 0x22, 0x61, 0x23, 0x61, 0x24, 0x61, 0x25,
+  0x61, 0x26, 0x61, 0x27, 0x01, 0x28, 0x01, 0x29, 0x41, 0x2A, 0x41, 0x2B, 0x41, 0x2C, 0x41, 0x2D,
+  0x41, 0x2E, 0x01, 0x2F, 0x01, 0x30, 0x01, 0x31, 0x80, 0x27, 0x7F, 0x32, 0x01, 0x33, 0x41, 0x34,
+  0x41, 0x35, 0x41, 0x36, 0x41, 0x37, 0x01, 0x38, 0x01, 0x39, 0x21, 0x3A, 0x21, 0x3B, 0x21, 0x3C,
+  0x41, 0x3D, 0x41, 0x3E, 0x41, 0x3F, 0x41, 0x40, 0x21, 0x41, 0x21, 0x42, 0x21, 0x43, 0x01, 0x44,
+  0x21, 0x45, 0x61, 0x46, 0x41, 0x47, 0x41, 0x48, 0x61, 0x49, 0x61, 0x4A, 0x00, 0x1D, 0x00, 0x1D,
+  0x61, 0x4B, 0x61, 0x4C, 0x21, 0x4D, 0x21, 0x4E, 0x41, 0x4F, 0x41, 0x50, 0x41, 0x51, 0x41, 0x52,
+  0x21, 0x53, 0x21, 0x54, 0x21, 0x55, 0x21, 0x56, 0x21, 0x57, 0x21, 0x58, 0x01, 0x59, 0x41, 0x5A,
+  0x41, 0x5B, 0x41, 0x5C, 0x41, 0x5D, 0x21, 0x5E, 0x21, 0x5F, 0x21, 0x60, 0x21, 0x61, 0x41, 0x62,
+  0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x21, 0x66, 0x21, 0x67, 0x21, 0x68, 0x21, 0x69, 0x21, 0x6A,
+  0x21, 0x6B, 0x61, 0x6C, 0x01, 0x6D, 0x01, 0x6E, 0x01, 0x6F, 0x61, 0x02, 0x70, 0x61, 0x71, 0x82,
+  0x51, 0x7F, 0x72, 0x21, 0x73, 0x41, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x21, 0x78, 0x21,
+  0x79, 0x21, 0x7A, 0x21, 0x7B, 0x21, 0x7C, 0x21, 0x7D, 0x21, 0x7E, 0x01, 0x7F, 0x01, 0x80, 0x01,
+  0x81, 0x41, 0x82, 0x21, 0x83, 0x21, 0x84, 0x21, 0x85, 0x21, 0x86, 0x21, 0x87, 0x01, 0x88, 0x01,
+  0x89, 0x01, 0x8A, 0x01, 0x8B, 0x21, 0x8C, 0x21, 0x8D, 0x21, 0x8E, 0x21, 0x8F, 0x21, 0x90, 0x21,
+  0x91, 0x61, 0x92, 0x41, 0x93, 0x01, 0x94, 0x21, 0x95, 0x61, 0x96, 0x61, 0x97, 0x61, 0x98, 0x61,
+  0x99, 0x61, 0x9A, 0x21, 0x9B, 0x01, 0x9C, 0x61, 0x9D, 0x01, 0x9E, 0x01, 0x9F, 0x41, 0xA0, 0x21,
+  0xA1, 0x21, 0xA2, 0x21, 0xA3, 0x21, 0xA4, 0x21, 0xA5, 0x41, 0xA6, 0x01, 0xA7, 0x01, 0xA8, 0x01,
+  0xA9, 0x41, 0xAA, 0x21, 0xAB, 0x21, 0xAC, 0x21, 0xAD, 0x01, 0xAE, 0x01, 0xAF, 0x01, 0xB0, 0x01,
+  0xB1, 0x01, 0x62, 0xB2, 0x41, 0xB3, 0x21, 0xB4, 0x21, 0xB5, 0x21, 0xB6, 0x21, 0xB7, 0x01, 0xB8,
+  0x61, 0xB9, 0x61, 0xBA, 0x61, 0xBB, 0x00, 0xCF, 0x61, 0xBC, 0x61, 0xBD, 0x61, 0xBE, 0x61, 0xBF,
+  0x61, 0xC0, 0x61, 0xC1, 0x21, 0xC2, 0x01, 0xC3, 0x01, 0xC4, 0x01, 0xC5, 0x01, 0xC6, 0x41, 0xC7,
+  0x21, 0xC8, 0x21, 0xC9, 0x21, 0xCA, 0x21, 0xCB, 0x01, 0xCC, 0x01, 0xCD, 0x01, 0xCE, 0x01, 0xCF,
+  0x01, 0xD0, 0x41, 0xD1, 0x21, 0xD2, 0x21, 0xD3, 0x21, 0xD4, 0x01, 0xD5, 0x01, 0xD6, 0x01, 0xD7,
+  0x01, 0xD8, 0x41, 0xD9, 0x41, 0xDA, 0x21, 0xDB, 0x21, 0xDC, 0x21, 0xDD, 0x01, 0xDE, 0x01, 0xDF,
+  0x01, 0xE0, 0x61, 0xE1, 0x61, 0xE2, 0x80, 0x4F, 0x7F, 0xE3, 0x61, 0xE4, 0x61, 0xE5, 0x61, 0xE6,
+  0x61, 0xE7, 0x61, 0xE8, 0x61, 0xE9, 0x01, 0xEA, 0x01, 0xEB, 0x01, 0xEC, 0x41, 0xED, 0x41, 0xEE,
+  0x21, 0xEF, 0x21, 0xF0, 0x21, 0xF1, 0x01, 0xF2, 0x01, 0xF3, 0x01, 0xF4, 0x01, 0xF5, 0x01, 0xF6,
+  0x41, 0xF7, 0x41, 0xF8, 0x21, 0xF9, 0x21, 0xFA, 0x21, 0xFB, 0x01, 0xFC, 0x01, 0xFD, 0x41, 0xFE,
+  0x01, 0xFF, 0x42, 0x00, 0x42, 0x01, 0x22, 0x02, 0x22, 0x03, 0x22, 0x04, 0x02, 0x05, 0x02, 0x06,
+  0x62, 0x07, 0x62, 0x08, 0x62, 0x09, 0x00, 0xCF, 0x62, 0x0A, 0x62, 0x0B, 0x62, 0x0C, 0x62, 0x0D,
+  0x62, 0x0E, 0x62, 0x0F, 0x62, 0x10, 0x02, 0x11, 0x02, 0x12, 0x42, 0x13, 0x42, 0x14, 0x42, 0x15,
+  0x22, 0x16, 0x22, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1A, 0x02, 0x1B, 0x42, 0x1C, 0x02, 0x1D,
+  0x42, 0x1E, 0x42, 0x1F, 0x22, 0x20, 0x22, 0x21, 0x22, 0x1C, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02,
+  0x25, 0x42, 0x26, 0x42, 0x27, 0x42, 0x28, 0x42, 0x29, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x02,
+  0x2D, 0x02, 0x2E, 0x62, 0x2F, 0x62, 0x30, 0x80, 0x4F, 0x44, 0x31, 0x62, 0x32, 0x62, 0x33, 0x62,
+  0x34, 0x62, 0x35, 0x62, 0x36, 0x62, 0x37, 0x62, 0x38, 0x02, 0x39, 0x42, 0x3A, 0x42, 0x3B, 0x42,
+  0x3C, 0x42, 0x3D, 0x02, 0x3E, 0x02, 0x3F, 0x02, 0x40, 0x02, 0x41, 0x02, 0x42, 0x02, 0x43, 0x42,
+  0x44, 0x42, 0x45, 0x42, 0x46, 0x42, 0x47, 0x02, 0x48, 0x02, 0x49, 0x01, 0x16, 0x01, 0x16, 0x02,
+  0x4A, 0x42, 0x4B, 0x42, 0x4C, 0x42, 0x4D, 0x42, 0x4E, 0x02, 0x4F, 0x02, 0x50, 0x02, 0x51, 0x82,
+  0x13, 0x22, 0x52, 0x62, 0x53, 0x62, 0x54, 0x62, 0x55, 0x62, 0x56, 0x62, 0x57, 0x62, 0x58, 0x62,
+  0x59, 0x62, 0x5A, 0x62, 0x5B, 0x62, 0x5C, 0x62, 0x5D, 0x42, 0x5E, 0x42, 0x5F, 0x42, 0x60, 0x42,
+  0x61, 0x02, 0x62, 0x02, 0x63, 0x81, 0x27, 0x80, 0x29, 0x36, 0x64, 0x42, 0x65, 0x42, 0x66, 0x42,
+  0x67, 0x42, 0x68, 0x02, 0x69, 0x02, 0x6A, 0x22, 0x6B, 0x22, 0x6C, 0x22, 0x6D, 0x42, 0x6E, 0x42,
+  0x6F, 0x42, 0x70, 0x42, 0x71, 0x22, 0x72, 0x22, 0x73, 0x22, 0x74, 0x02, 0x75, 0x22, 0x76, 0x22,
+  0x77, 0x62, 0x78, 0x62, 0x79, 0x62, 0x7A, 0x62, 0x7B, 0x62, 0x7C, 0x62, 0x7D, 0x62, 0x7E, 0x62,
+  0x7F, 0x80, 0xAD, 0x42, 0x80, 0x62, 0x81, 0x42, 0x82, 0x42, 0x83, 0x42, 0x84, 0x22, 0x85, 0x22,
+  0x86, 0x22, 0x87, 0x02, 0x88, 0x22, 0x89, 0x22, 0x8A, 0x42, 0x8B, 0x42, 0x8C, 0x42, 0x8D, 0x42,
+  0x8E, 0x42, 0x8F, 0x22, 0x90, 0x22, 0x91, 0x22, 0x92, 0x22, 0x93, 0x42, 0x94, 0x02, 0x95, 0x02,
+  0x96, 0x02, 0x97, 0x22, 0x98, 0x22, 0x99, 0x22, 0x9A, 0x22, 0x9B, 0x22, 0x9C, 0x22, 0x9D, 0x42,
+  0x9E, 0x62, 0x9F, 0x62, 0xA0, 0x00, 0xCF, 0x81, 0x01, 0x03, 0x62, 0xA1, 0x62, 0xA2, 0x84, 0x09,
+  0x3C, 0xA3, 0x62, 0xA4, 0x62, 0xA5, 0x22, 0xA6, 0x22, 0xA7, 0x22, 0xA8, 0x62, 0xA9, 0x02, 0xAA,
+  0x22, 0xAB, 0x22, 0xAC, 0x42, 0xAD, 0x02, 0xAE, 0x42, 0xAF, 0x22, 0xB0, 0x22, 0xB1, 0x22, 0xB2,
+  0x22, 0xB3, 0x22, 0xB4, 0x22, 0xB5, 0x02, 0xB6, 0x02, 0xB7, 0x02, 0xB8, 0x02, 0xB9, 0x22, 0xBA,
+  0x22, 0xBB, 0x22, 0xBC, 0x22, 0xBD, 0x22, 0xBE, 0x22, 0xBF, 0x02, 0xC0, 0x02, 0xC1, 0x83, 0x43,
+  0x80, 0x45, 0x16, 0xC2, 0x22, 0xC3, 0x22, 0xC4, 0x02, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x62, 0xC8,
+  0x62, 0xC9, 0x62, 0xCA, 0x62, 0xCB, 0x62, 0xCC, 0x02, 0xAA, 0x82, 0x01, 0x38, 0xCD, 0x02, 0xCE,
+  0x02, 0xCF, 0x42, 0xD0, 0x42, 0xD1, 0x22, 0xD2, 0x22, 0xD3, 0x22, 0xD4, 0x22, 0xD5, 0x22, 0xD6,
+  0x42, 0xD7, 0x02, 0xD8, 0x02, 0xD9, 0x02, 0xDA, 0x22, 0xDB, 0x22, 0xDC, 0x22, 0xDD, 0x22, 0xDE,
+  0x02, 0xDF, 0x22, 0xE0, 0x02, 0xE1, 0x02, 0xE2, 0x62, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x02, 0xE6,
+  0x62, 0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x84, 0x3F, 0x0A, 0xAA, 0x22, 0xEA, 0x62, 0xEB, 0x62, 0xEC,
+  0x62, 0xED, 0x62, 0xEE, 0x84, 0x11, 0x24, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x22, 0xF3,
+  0x22, 0xF4, 0x22, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x42, 0xFA, 0x42, 0xFB,
+  0x22, 0xFC, 0x22, 0xFD, 0x22, 0xFE, 0x02, 0xFF, 0x23, 0x00, 0x63, 0x01, 0x85, 0x3D, 0x81, 0x01,
+  0x01, 0x03, 0x02, 0x89, 0x0D, 0x0B, 0x63, 0x03, 0x63, 0x04, 0x63, 0x05, 0x63, 0x06, 0x63, 0x07,
+  0x63, 0x08, 0x82, 0x1D, 0x22, 0x09, 0x03, 0x0A, 0x43, 0x0B, 0x43, 0x0C, 0x23, 0x0D, 0x23, 0x0E,
+  0x23, 0x0F, 0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x43, 0x14, 0x43, 0x15, 0x23, 0x16,
+  0x23, 0x17, 0x23, 0x18, 0x03, 0x19, 0x03, 0x1A, 0x89, 0x3F, 0x8D, 0x01, 0x35, 0x63, 0x1B, 0x63,
+  0x1C, 0x63, 0x1D, 0x63, 0x1E, 0x63, 0x1F, 0x63, 0x20, 0x63, 0x21, 0x63, 0x22, 0x02, 0xAA, 0x23,
+  0x23, 0x43, 0x24, 0x43, 0x25, 0x23, 0x26, 0x23, 0x27, 0x23, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03,
+  0x2B, 0x43, 0x2C, 0x43, 0x2D, 0x43, 0x2E, 0x03, 0x2F, 0x03, 0x30, 0x03, 0x31, 0x03, 0x32, 0x03,
+  0x33, 0x03, 0x34, 0xA1, 0x01, 0x05, 0x63, 0x35, 0x63, 0x36, 0x63, 0x37, 0x82, 0x0B, 0x09, 0x38,
+  0x43, 0x39, 0x03, 0x3A, 0x03, 0x3B, 0x03, 0x3C, 0x00, 0xFF, 0x00, 0xEA, 0x00,
+};
+
+// ---- gbgg_skel: ../res/GBGGSkel.png, 389 tiles (389 unique, 6 cells flipped), 7528 bytes packed ----
+static const u16 ILLUSTRATION_PALETTES_gbgg_skel[64] = {
+  0x000, 0xEEE, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0xEEE, 0x666, 0xAAA, 0x888, 0xCCC, 0x444, 0x222, 0xECE, 0x868, 0x646, 0xCEC, 0x866, 0xCAC, 0x424, 0x668,
+  0x000, 0xEEE, 0x666, 0xAAA, 0xCCC, 0x888, 0x242, 0x444, 0xEEC, 0x222, 0x686, 0xCEC, 0xCCA, 0xAA8, 0x664, 0x886,
+};
+static const u8 ILLUSTRATION_TILES_gbgg_skel[] = {
+  0x30, 0xA0, 0x00, 0x00, 0x9E, 0x00, 0x09, 0x51, 0xD0, 0x00, 0x71, 0x11, 0x13, 0x00, 0x41, 0x11,
+  0x11, 0x82, 0x03, 0x00, 0xC1, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x05, 0x80, 0x03, 0x00,
+  0x03, 0x80, 0x03, 0x84, 0x00, 0x00, 0x20, 0x80, 0x03, 0x00, 0x17, 0x80, 0x03, 0x00, 0x1F, 0x80,
+  0x03, 0x00, 0x14, 0x80, 0x03, 0x00, 0x18, 0x80, 0x03, 0x01, 0x11, 0xA0, 0x8A, 0x48, 0x00, 0x03,
+  0x80, 0x03, 0x00, 0xA1, 0x80, 0x03, 0x00, 0x91, 0x8C, 0x03, 0x01, 0x00, 0x69, 0x80, 0x27, 0x80,
+  0x61, 0x03, 0x00, 0x11, 0x11, 0x20, 0x80, 0x03, 0x00, 0x40, 0x8A, 0x03, 0x98, 0x00, 0x00, 0x02,
+  0x80, 0x03, 0x00, 0x31, 0x95, 0x1C, 0x00, 0xF2, 0x81, 0x7F, 0x00, 0x30, 0x80, 0x04, 0x00, 0x0C,
+  0x81, 0xA3, 0x85, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x02, 0x80, 0x03,
+  0x00, 0x07, 0x81, 0xBB, 0x82, 0x62, 0x82, 0x03, 0x80, 0xBC, 0x01, 0x11, 0x12, 0x84, 0x87, 0x00,
+  0x15, 0x84, 0x03, 0x81, 0xC8, 0x02, 0x00, 0x00, 0x41, 0x88, 0x03, 0x00, 0x51, 0x84, 0x73, 0x00,
+  0x81, 0x85, 0x03, 0x8D, 0xAF, 0x83, 0xC3, 0x87, 0x03, 0x80, 0xF6, 0x84, 0x73, 0x01, 0x41, 0x11,
+  0x80, 0x72, 0x02, 0x11, 0x00, 0x04, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x61, 0x80, 0x03,
+  0x02, 0x31, 0x11, 0x11, 0x82, 0x73, 0x85, 0x03, 0x81, 0x83, 0x00, 0x10, 0x80, 0x03, 0x80, 0x36,
+  0x00, 0x18, 0x80, 0x39, 0x80, 0x0A, 0x88, 0x00, 0x03, 0x72, 0xA0, 0x00, 0x06, 0x80, 0x95, 0x81,
+  0x3B, 0x02, 0x21, 0x11, 0x11, 0x80, 0x46, 0x00, 0x11, 0x81, 0x3E, 0x8D, 0xF7, 0x81, 0x71, 0x80,
+  0xCE, 0x82, 0x03, 0x00, 0x60, 0x83, 0x12, 0x81, 0xB7, 0x00, 0x02, 0x8D, 0x27, 0x84, 0x00, 0x00,
+  0x07, 0x81, 0x6F, 0x00, 0x53, 0x84, 0x28, 0x89, 0x00, 0x01, 0x02, 0x42, 0x81, 0xBF, 0x00, 0x13,
+  0x81, 0x0A, 0x80, 0xE7, 0x00, 0x07, 0x80, 0x67, 0x00, 0x0A, 0x84, 0xC7, 0x00, 0x0D, 0x80, 0x03,
+  0x81, 0x0F, 0x01, 0x00, 0x68, 0x81, 0x1C, 0x87, 0xEB, 0x01, 0x90, 0x00, 0x81, 0x2E, 0x01, 0x11,
+  0x1A, 0x84, 0xC7, 0x00, 0x70, 0x85, 0x60, 0x02, 0x11, 0x11, 0x08, 0x80, 0x03, 0x80, 0xB2, 0x01,
+  0x11, 0x81, 0x80, 0xED, 0x80, 0x03, 0x00, 0x16, 0x80, 0x0B, 0x03, 0x50, 0x09, 0x51, 0x13, 0x82,
+  0x75, 0x81, 0xA7, 0x80, 0xB3, 0x00, 0x03, 0x80, 0x2E, 0x00, 0x21, 0x80, 0x75, 0x80, 0x57, 0x00,
+  0x21, 0x80, 0x03, 0x01, 0x31, 0x11, 0x81, 0x38, 0x01, 0x00, 0x61, 0x80, 0x34, 0x83, 0x00, 0x00,
+  0x12, 0x80, 0x03, 0x05, 0x30, 0x11, 0x11, 0x15, 0x70, 0x11, 0x80, 0xB0, 0x05, 0x11, 0x11, 0x60,
+  0x00, 0x11, 0x15, 0x80, 0x63, 0x00, 0x30, 0x8A, 0xB2, 0x00, 0x04, 0x80, 0x03, 0x00, 0x01, 0x80,
+  0x03, 0x00, 0x03, 0x84, 0x0B, 0x00, 0x07, 0x85, 0x18, 0x01, 0x31, 0x15, 0x80, 0x2F, 0x80, 0x94,
+  0x80, 0x3F, 0x80, 0x03, 0x00, 0x11, 0x85, 0x03, 0x04, 0x50, 0x51, 0x11, 0x11, 0x80, 0x90, 0xF9,
+  0x01, 0x18, 0x00, 0x80, 0x78, 0x80, 0xF6, 0x80, 0x03, 0x80, 0x28, 0x8C, 0x00, 0x00, 0xC0, 0x80,
+  0x03, 0x00, 0x16, 0x81, 0xF7, 0x81, 0x03, 0x80, 0xB8, 0x8A, 0x00, 0x07, 0x07, 0x27, 0x00, 0x00,
+  0x51, 0x11, 0x20, 0x06, 0x80, 0xA4, 0x03, 0x04, 0x11, 0x11, 0x1B, 0x81, 0x03, 0x80, 0x15, 0x00,
+  0x09, 0x84, 0x03, 0x00, 0x02, 0x8F, 0x6B, 0x81, 0x61, 0x01, 0x11, 0x20, 0x83, 0xDB, 0x02, 0x11,
+  0x1E, 0x41, 0x80, 0xE7, 0x80, 0x33, 0x01, 0x12, 0x02, 0x84, 0x03, 0x01, 0x00, 0x31, 0x80, 0xEC,
+  0x8B, 0x00, 0x03, 0x76, 0x00, 0x00, 0x08, 0x80, 0x7A, 0x00, 0x31, 0x83, 0x9B, 0x80, 0x68, 0x8D,
+  0x4F, 0x00, 0x40, 0x80, 0x03, 0x00, 0x14, 0x81, 0x57, 0x04, 0x60, 0x31, 0x11, 0x11, 0x46, 0x8F,
+  0x1F, 0x89, 0x27, 0x00, 0x19, 0x81, 0x08, 0x00, 0x21, 0x80, 0x23, 0x80, 0x78, 0x82, 0x03, 0x06,
+  0x61, 0x11, 0x13, 0x00, 0x02, 0x11, 0x50, 0x8A, 0x9F, 0x80, 0x03, 0x00, 0x12, 0x80, 0x03, 0x00,
+  0x30, 0x80, 0x03, 0x00, 0x70, 0x95, 0x4C, 0x8B, 0x00, 0x04, 0x0C, 0x00, 0x00, 0x62, 0xB1, 0x80,
+  0x4B, 0x01, 0x11, 0x93, 0x80, 0xD4, 0x84, 0x13, 0x00, 0x06, 0x80, 0xFE, 0x02, 0xC1, 0x00, 0x51,
+  0x80, 0x10, 0x8C, 0x00, 0x80, 0x1B, 0x02, 0x0E, 0x2F, 0xD1, 0x8F, 0x17, 0x85, 0x00, 0x00, 0x81,
+  0x97, 0x1A, 0xA4, 0x00, 0x01, 0x84, 0x90, 0x99, 0x1D, 0x81, 0x9C, 0x03, 0x15, 0x70, 0x60, 0x00,
+  0x81, 0x28, 0x95, 0x1F, 0x81, 0x00, 0x00, 0x60, 0x80, 0x03, 0x02, 0x11, 0x14, 0x42, 0x81, 0x27,
+  0x92, 0x1F, 0x85, 0x00, 0x01, 0x56, 0x40, 0x80, 0x27, 0x02, 0x11, 0x18, 0x46, 0x95, 0x1F, 0x85,
+  0x00, 0x01, 0x54, 0x26, 0x81, 0x27, 0x05, 0x32, 0x60, 0x31, 0x11, 0x11, 0x80, 0x84, 0x03, 0x0B,
+  0x50, 0x61, 0x11, 0x11, 0x70, 0x0D, 0x11, 0x1C, 0x00, 0x00, 0x22, 0xA0, 0x88, 0x29, 0x81, 0x43,
+  0x00, 0xD1, 0x80, 0x03, 0x00, 0x61, 0x80, 0x03, 0x00, 0x04, 0x84, 0x03, 0x00, 0x09, 0x80, 0x03,
+  0x00, 0x07, 0x81, 0x5B, 0x02, 0x81, 0x11, 0x10, 0x80, 0x21, 0x81, 0x03, 0x80, 0x36, 0x01, 0x11,
+  0x15, 0x83, 0x2D, 0x02, 0x11, 0x11, 0x20, 0x80, 0x03, 0x00, 0x40, 0x82, 0x03, 0x04, 0x04, 0x11,
+  0x11, 0x1B, 0x03, 0x80, 0x03, 0x00, 0x05, 0x8C, 0x03, 0x00, 0x01, 0x83, 0x03, 0x00, 0x12, 0x83,
+  0x63, 0x06, 0x09, 0x00, 0x00, 0x7B, 0x11, 0x30, 0x06, 0x80, 0x0F, 0x04, 0x0A, 0x11, 0x11, 0x14,
+  0x0B, 0x80, 0x03, 0x03, 0x71, 0x11, 0x11, 0x17, 0x80, 0x93, 0x04, 0x10, 0x00, 0x01, 0x11, 0x70,
+  0x95, 0xC3, 0x82, 0x00, 0x80, 0x60, 0x82, 0x03, 0x80, 0x54, 0x01, 0x00, 0x0D, 0x80, 0x03, 0x80,
+  0x6C, 0x00, 0x00, 0x80, 0x48, 0x03, 0x00, 0x00, 0xA1, 0x83, 0x82, 0xBD, 0x03, 0x22, 0x11, 0x11,
+  0x11, 0x80, 0x1F, 0x00, 0x13, 0x80, 0x6C, 0x00, 0x14, 0x80, 0xE0, 0x00, 0x10, 0x80, 0x07, 0x00,
+  0x30, 0x82, 0x23, 0x01, 0x31, 0x16, 0x82, 0x1F, 0x05, 0x00, 0x00, 0x21, 0x11, 0x00, 0x75, 0x80,
+  0x68, 0x03, 0x21, 0x11, 0x30, 0x07, 0x80, 0xB1, 0x80, 0x2B, 0x00, 0x60, 0x80, 0x27, 0x01, 0x00,
+  0x41, 0x83, 0x03, 0x00, 0x50, 0x81, 0x23, 0x00, 0x60, 0x80, 0x03, 0x00, 0x30, 0x80, 0x03, 0x80,
+  0x0C, 0x80, 0xD2, 0x00, 0x00, 0x80, 0xDE, 0x00, 0x00, 0x80, 0xEA, 0x00, 0x00, 0x80, 0x0E, 0x00,
+  0x02, 0x96, 0x97, 0x03, 0x74, 0x55, 0x40, 0x51, 0x80, 0x76, 0x90, 0x19, 0x09, 0x0E, 0x00, 0x00,
+  0x07, 0xC1, 0x00, 0x02, 0x41, 0x11, 0x07, 0x80, 0xE0, 0x83, 0x12, 0x05, 0x02, 0x41, 0x00, 0x73,
+  0x11, 0x11, 0x80, 0xFB, 0x01, 0x11, 0xB1, 0x80, 0x03, 0x88, 0x00, 0x00, 0x13, 0x8B, 0x0E, 0x8B,
+  0x00, 0x01, 0x42, 0x43, 0x83, 0x3F, 0x01, 0x15, 0x27, 0x80, 0x93, 0x02, 0x11, 0x36, 0x70, 0x80,
+  0x12, 0x00, 0x14, 0x8D, 0x23, 0x89, 0x78, 0x00, 0x26, 0x81, 0xCB, 0x00, 0xC0, 0x80, 0x03, 0x00,
+  0x12, 0x81, 0x2F, 0x00, 0x32, 0x80, 0x03, 0x81, 0xD5, 0x96, 0x00, 0x00, 0x21, 0x81, 0x2E, 0x80,
+  0x03, 0x00, 0x81, 0x80, 0x03, 0x00, 0xC1, 0x81, 0xA4, 0x85, 0x18, 0x01, 0x99, 0x70, 0x80, 0x18,
+  0x00, 0x14, 0x81, 0x43, 0x00, 0x30, 0x80, 0x03, 0x00, 0x40, 0x80, 0x03, 0x03, 0x20, 0x00, 0x31,
+  0x32, 0x8C, 0x3D, 0x03, 0x23, 0x36, 0x00, 0x03, 0x80, 0x20, 0x04, 0x01, 0x11, 0x11, 0x10, 0x61,
+  0x84, 0x03, 0x80, 0x0B, 0x01, 0x40, 0x02, 0x81, 0x92, 0x01, 0x24, 0x47, 0x91, 0x6F, 0x00, 0x0B,
+  0x84, 0x73, 0x81, 0x03, 0x00, 0x71, 0x85, 0x14, 0x80, 0xA3, 0x00, 0x50, 0x80, 0x03, 0x00, 0x40,
+  0x80, 0x03, 0x81, 0xDF, 0x80, 0x0F, 0x00, 0x15, 0x80, 0x03, 0x02, 0x12, 0x00, 0x31, 0x80, 0x77,
+  0x87, 0x00, 0x00, 0x07, 0x80, 0x54, 0x00, 0x21, 0x80, 0x03, 0x81, 0x5C, 0x81, 0x03, 0x00, 0x31,
+  0x80, 0x03, 0x00, 0x03, 0x81, 0xBB, 0x04, 0x11, 0x22, 0xFF, 0x22, 0x20, 0x80, 0x37, 0x96, 0x00,
+  0x81, 0x3D, 0x00, 0x10, 0x81, 0x28, 0x00, 0x18, 0x93, 0x27, 0x80, 0x56, 0x02, 0x11, 0x00, 0x05,
+  0x81, 0xED, 0x01, 0x62, 0x60, 0x80, 0xF6, 0x01, 0x00, 0x30, 0x84, 0x2F, 0x00, 0x1A, 0x80, 0x03,
+  0x00, 0x1D, 0x80, 0x03, 0x04, 0x60, 0x00, 0x00, 0x51, 0x00, 0x80, 0x20, 0x02, 0x00, 0x00, 0x01,
+  0x84, 0x03, 0x01, 0x00, 0x31, 0x80, 0x03, 0x00, 0x05, 0x88, 0xBF, 0x89, 0x00, 0x06, 0x16, 0x11,
+  0x11, 0x39, 0x70, 0x55, 0x20, 0x91, 0xFE, 0x8E, 0x00, 0x03, 0x23, 0x00, 0x00, 0x61, 0x81, 0x4F,
+  0x00, 0x64, 0x81, 0x46, 0x08, 0x00, 0x00, 0x73, 0x11, 0x00, 0x71, 0x11, 0x11, 0x04, 0x8C, 0x50,
+  0x00, 0x41, 0x99, 0xDC, 0x83, 0x00, 0x00, 0x32, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03, 0x00, 0x22,
+  0x84, 0x07, 0x00, 0x14, 0x89, 0x1C, 0x02, 0x22, 0x22, 0x25, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03,
+  0x01, 0x22, 0x31, 0x80, 0x03, 0x00, 0x25, 0x80, 0x03, 0x01, 0x22, 0x52, 0x80, 0x03, 0x00, 0x14,
+  0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x8D, 0x4C, 0x00, 0x31, 0x80, 0x03, 0x00, 0x25, 0x80, 0x03,
+  0x00, 0x24, 0x81, 0x3B, 0x00, 0x51, 0x82, 0x12, 0x00, 0x13, 0x99, 0x7C, 0x00, 0x70, 0x80, 0xBC,
+  0x00, 0x40, 0x80, 0x03, 0x00, 0x1E, 0x81, 0xC4, 0x80, 0x0C, 0x00, 0x11, 0x80, 0x08, 0x01, 0x11,
+  0x19, 0x80, 0x03, 0x80, 0xD1, 0x02, 0x11, 0x11, 0x30, 0x99, 0xFF, 0x04, 0x00, 0x00, 0x63, 0x84,
+  0x20, 0x83, 0xFB, 0x82, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x04, 0x80, 0x03, 0x00, 0x02, 0x89,
+  0x22, 0x02, 0x11, 0x11, 0x17, 0x80, 0x03, 0x00, 0x12, 0x84, 0x03, 0x00, 0x13, 0x80, 0x03, 0x01,
+  0x11, 0x40, 0x80, 0x03, 0x00, 0x10, 0x80, 0xA7, 0x01, 0x12, 0x71, 0x83, 0x03, 0x01, 0x15, 0x01,
+  0x80, 0x10, 0x00, 0x05, 0x80, 0x03, 0x00, 0x06, 0x80, 0x03, 0x00, 0x00, 0x80, 0xB3, 0x01, 0x00,
+  0x41, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x80, 0x1C, 0x08, 0x00, 0x00, 0x44, 0x20, 0x00, 0x01,
+  0x11, 0x15, 0x60, 0x80, 0x13, 0x00, 0x30, 0x80, 0x1B, 0x00, 0x10, 0x80, 0x07, 0x86, 0x03, 0x81,
+  0x23, 0x84, 0x00, 0x00, 0x60, 0x84, 0xC7, 0x04, 0x40, 0x00, 0x03, 0x11, 0x40, 0x80, 0x40, 0x00,
+  0x40, 0x80, 0x69, 0x00, 0x20, 0x80, 0x58, 0x8D, 0xB2, 0x00, 0x16, 0x88, 0xB0, 0x84, 0x1C, 0x81,
+  0xB7, 0x00, 0x01, 0x80, 0x03, 0x00, 0x0A, 0x91, 0xE2, 0x80, 0x92, 0x86, 0x00, 0x80, 0xB3, 0x00,
+  0x11, 0x80, 0x92, 0x01, 0x11, 0x08, 0x81, 0xA7, 0x80, 0x0C, 0x80, 0x6A, 0x01, 0x11, 0x1D, 0x80,
+  0x23, 0x84, 0x03, 0x05, 0x41, 0x12, 0x00, 0x61, 0x11, 0x50, 0x80, 0xC0, 0x01, 0x50, 0x04, 0x80,
+  0xAB, 0x80, 0x1B, 0x00, 0x70, 0x88, 0x9F, 0x00, 0x32, 0x81, 0x4B, 0x00, 0x20, 0x80, 0x03, 0x00,
+  0x50, 0x84, 0x03, 0x80, 0xAC, 0x01, 0x15, 0x70, 0x91, 0x71, 0x01, 0x00, 0x06, 0x84, 0x8F, 0x01,
+  0x31, 0x00, 0x80, 0x60, 0x03, 0x00, 0x06, 0x51, 0x11, 0x80, 0xCE, 0x00, 0x11, 0x80, 0x4E, 0x82,
+  0x7F, 0x8E, 0x00, 0x04, 0x12, 0x22, 0x22, 0x11, 0x15, 0x80, 0x03, 0x01, 0x11, 0x42, 0x80, 0x03,
+  0x00, 0x14, 0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x01, 0x11, 0x42, 0x80, 0x03, 0x00, 0x52, 0x81,
+  0x1E, 0x01, 0x22, 0x45, 0x80, 0x03, 0x80, 0x11, 0x02, 0x22, 0x22, 0x31, 0x80, 0x03, 0x00, 0x25,
+  0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x01, 0x22, 0x21, 0x80, 0x03, 0x01, 0x23, 0x42, 0x80, 0x04,
+  0x8C, 0x4D, 0x00, 0x15, 0x80, 0x03, 0x00, 0x14, 0x80, 0x03, 0x00, 0x32, 0x81, 0x3A, 0x02, 0x11,
+  0x11, 0x54, 0x82, 0x1F, 0x07, 0x15, 0x42, 0x41, 0x11, 0x32, 0x22, 0x22, 0x51, 0x80, 0x2E, 0x00,
+  0x31, 0x88, 0x03, 0x80, 0x0F, 0x00, 0x25, 0x80, 0x1D, 0x01, 0x16, 0x00, 0x80, 0x32, 0x80, 0x03,
+  0x01, 0x11, 0x20, 0x80, 0x03, 0x00, 0x17, 0x84, 0x3F, 0x86, 0x00, 0x92, 0xE1, 0x84, 0x00, 0x00,
+  0x30, 0x80, 0x03, 0x04, 0x02, 0x11, 0x11, 0x13, 0x04, 0x80, 0x27, 0x81, 0xDF, 0x80, 0x0B, 0x00,
+  0x11, 0x81, 0x48, 0x81, 0xEF, 0x01, 0x00, 0x01, 0x80, 0x03, 0x80, 0x18, 0x85, 0x2B, 0x00, 0x60,
+  0x84, 0x2F, 0x00, 0x10, 0x88, 0x03, 0x81, 0x0F, 0x0A, 0x09, 0x11, 0x11, 0x50, 0x00, 0x51, 0x11,
+  0x70, 0x00, 0x0A, 0x27, 0x80, 0x0D, 0x02, 0x07, 0xA2, 0x00, 0x80, 0x3C, 0x01, 0x00, 0x07, 0x80,
+  0x37, 0x00, 0x08, 0x84, 0x43, 0x80, 0x54, 0x08, 0x00, 0x00, 0x61, 0x50, 0x00, 0x24, 0x31, 0x13,
+  0x31, 0x8C, 0xEC, 0x81, 0x00, 0x03, 0x60, 0x02, 0x41, 0x46, 0x81, 0x5F, 0x90, 0x1A, 0x83, 0xBF,
+  0x81, 0x43, 0x80, 0x03, 0x02, 0x30, 0x07, 0x51, 0x81, 0x4C, 0x01, 0x20, 0x11, 0x80, 0x74, 0x00,
+  0x11, 0x80, 0x7C, 0x01, 0x11, 0x15, 0x81, 0x33, 0x02, 0x00, 0x00, 0x13, 0x80, 0x3B, 0x00, 0x14,
+  0x84, 0x8B, 0x93, 0x00, 0x00, 0x31, 0x86, 0xC3, 0x86, 0x00, 0x01, 0x03, 0x20, 0x81, 0x96, 0x01,
+  0x60, 0x61, 0x80, 0xBB, 0x00, 0x45, 0x80, 0xFF, 0x80, 0x48, 0x04, 0x10, 0x00, 0x74, 0x44, 0x62,
+  0x80, 0x19, 0x00, 0x04, 0x80, 0x03, 0x00, 0x06, 0x89, 0x2A, 0x80, 0x23, 0x89, 0x00, 0x00, 0x12,
+  0x80, 0x03, 0x00, 0x20, 0x82, 0x2E, 0x01, 0x34, 0x60, 0x82, 0x1F, 0x81, 0x77, 0x00, 0x20, 0x80,
+  0x03, 0x00, 0x70, 0x96, 0x7F, 0x00, 0x61, 0x80, 0x7F, 0x00, 0x41, 0x80, 0x03, 0x81, 0xAD, 0x81,
+  0xC2, 0x80, 0x03, 0x00, 0x03, 0x87, 0x03, 0x82, 0x00, 0x07, 0x44, 0x44, 0x44, 0x12, 0x22, 0x22,
+  0x22, 0x32, 0x88, 0x03, 0x81, 0x0F, 0x01, 0x11, 0x34, 0x80, 0x03, 0x83, 0x1E, 0x00, 0x35, 0x80,
+  0x0E, 0x92, 0x00, 0x00, 0x52, 0x80, 0x03, 0x00, 0x13, 0x95, 0x1C, 0x80, 0x00, 0x00, 0x24, 0x80,
+  0x3F, 0x01, 0x22, 0x51, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x01, 0x22, 0x43, 0x80, 0x03, 0x01,
+  0x22, 0x41, 0x80, 0x03, 0x00, 0x23, 0x81, 0x1A, 0x84, 0x1E, 0x95, 0x00, 0x03, 0x15, 0x11, 0x11,
+  0x33, 0x82, 0x7F, 0x84, 0x00, 0x00, 0x54, 0x80, 0x02, 0x01, 0x22, 0x11, 0x80, 0x6C, 0x00, 0x11,
+  0x80, 0xA0, 0x00, 0x42, 0x84, 0x5F, 0x80, 0x12, 0x82, 0xAF, 0x90, 0x00, 0x81, 0xB3, 0x80, 0x67,
+  0x01, 0x51, 0x11, 0x81, 0x65, 0x01, 0x22, 0x25, 0x80, 0x03, 0x02, 0x31, 0x11, 0x11, 0x80, 0x06,
+  0x00, 0x11, 0x80, 0x8E, 0x86, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x12, 0x80, 0x03, 0x00, 0x14,
+  0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x01, 0x11, 0x20, 0x80, 0x03, 0x80, 0x14, 0x82, 0x03, 0x81,
+  0x18, 0x02, 0x00, 0x25, 0x59, 0x81, 0x05, 0xA7, 0x00, 0x07, 0x31, 0x11, 0x00, 0x09, 0x11, 0x11,
+  0x00, 0x03, 0x88, 0x03, 0x00, 0x00, 0x81, 0x03, 0x00, 0x61, 0x80, 0x03, 0x00, 0x06, 0x81, 0x5E,
+  0x00, 0x41, 0x80, 0x04, 0x04, 0x01, 0x11, 0x13, 0x2E, 0x07, 0x80, 0x7E, 0x00, 0x40, 0x98, 0xFF,
+  0x00, 0x53, 0x80, 0x03, 0x82, 0x39, 0x8A, 0x03, 0x81, 0x97, 0x80, 0x44, 0x00, 0x42, 0x93, 0x7C,
+  0x00, 0x07, 0x80, 0x03, 0x00, 0x04, 0x84, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x01, 0x80, 0xF2,
+  0x00, 0x10, 0x81, 0xE6, 0x80, 0x03, 0x00, 0xC0, 0x80, 0x03, 0x00, 0x20, 0x84, 0x03, 0x80, 0x4B,
+  0x83, 0x03, 0x8A, 0xA7, 0x90, 0x03, 0x03, 0x11, 0x15, 0x22, 0x22, 0x82, 0x03, 0x00, 0x14, 0x80,
+  0x03, 0x00, 0x52, 0x80, 0x03, 0x00, 0x42, 0x80, 0x03, 0x03, 0x22, 0x22, 0x22, 0x13, 0x80, 0x03,
+  0x80, 0x12, 0xA1, 0x00, 0x00, 0x23, 0x99, 0x1C, 0x81, 0xE8, 0x00, 0x51, 0x80, 0x03, 0x00, 0x25,
+  0x80, 0x03, 0x81, 0x0C, 0x00, 0x22, 0x80, 0xB0, 0x01, 0x22, 0x21, 0x80, 0x03, 0x00, 0x23, 0x80,
+  0x03, 0x00, 0x24, 0x81, 0x1D, 0x86, 0x00, 0x00, 0x15, 0x80, 0x02, 0x03, 0x42, 0x11, 0x11, 0x32,
+  0x83, 0x8B, 0x80, 0x87, 0x81, 0x7F, 0x81, 0x93, 0x81, 0x8B, 0x80, 0x0E, 0x93, 0x7C, 0x81, 0x53,
+  0x00, 0x41, 0x83, 0x4B, 0x00, 0x22, 0x80, 0x08, 0x02, 0x22, 0x22, 0x25, 0x80, 0x03, 0x01, 0x26,
+  0x51, 0x80, 0x1A, 0x00, 0x41, 0x80, 0x03, 0x04, 0x25, 0x11, 0x12, 0x00, 0x00, 0x8A, 0x03, 0x00,
+  0x1D, 0x80, 0x03, 0x00, 0x11, 0x81, 0x03, 0x00, 0xE0, 0x82, 0x03, 0x01, 0x00, 0x06, 0x81, 0x0D,
+  0x00, 0x31, 0x80, 0x03, 0x02, 0x02, 0x51, 0x00, 0x80, 0x0D, 0x80, 0x03, 0x8A, 0x00, 0x80, 0x5E,
+  0x00, 0x10, 0x83, 0x9B, 0x08, 0x11, 0x12, 0x81, 0x11, 0x11, 0x30, 0x0C, 0x99, 0x92, 0x8A, 0x1F,
+  0x00, 0x71, 0x80, 0x18, 0x00, 0x08, 0x80, 0x03, 0x80, 0x46, 0x03, 0x3C, 0x00, 0x72, 0x26, 0x85,
+  0x16, 0x00, 0xA8, 0x81, 0x58, 0x02, 0x00, 0x00, 0x01, 0x80, 0x19, 0x00, 0x13, 0x80, 0x43, 0x03,
+  0x10, 0x00, 0xCC, 0x22, 0x87, 0x33, 0x00, 0x8A, 0x81, 0x57, 0x00, 0x20, 0x80, 0x03, 0x00, 0x15,
+  0x82, 0x0E, 0x00, 0x21, 0x80, 0x03, 0x00, 0x81, 0x81, 0x12, 0x80, 0x83, 0x80, 0x03, 0x00, 0x08,
+  0x80, 0x03, 0x03, 0x81, 0x11, 0x00, 0x0E, 0x80, 0x97, 0x00, 0x03, 0x80, 0x3E, 0x80, 0x3B, 0x02,
+  0x11, 0x11, 0x50, 0x80, 0x03, 0x00, 0x40, 0x80, 0x03, 0x01, 0x60, 0x00, 0x80, 0x4E, 0x02, 0x00,
+  0x11, 0x14, 0x80, 0x03, 0x00, 0x17, 0x83, 0x43, 0x81, 0x23, 0x01, 0x00, 0x0C, 0x80, 0x03, 0x86,
+  0xC7, 0x00, 0x21, 0x84, 0x03, 0x00, 0x61, 0x80, 0x03, 0x05, 0x03, 0x11, 0x14, 0x22, 0x22, 0x22,
+  0x91, 0x03, 0x00, 0x13, 0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x06, 0x22, 0x22, 0x41, 0x11, 0x22,
+  0x22, 0x25, 0x80, 0x03, 0x00, 0x23, 0x80, 0x03, 0x00, 0x24, 0x80, 0x03, 0x01, 0x22, 0x51, 0x84,
+  0x03, 0x00, 0x41, 0x80, 0x03, 0x00, 0x25, 0x81, 0x81, 0x94, 0x00, 0x00, 0x15, 0x80, 0x02, 0x01,
+  0x32, 0x32, 0x80, 0x24, 0x00, 0x42, 0x84, 0x03, 0x00, 0x52, 0x84, 0x53, 0x81, 0x5F, 0x81, 0x0F,
+  0x84, 0x00, 0x00, 0x24, 0x87, 0x0A, 0x8F, 0x00, 0x85, 0x4C, 0x00, 0x51, 0x80, 0x03, 0x00, 0x41,
+  0x80, 0x03, 0x00, 0x21, 0x84, 0x03, 0x00, 0x24, 0x80, 0x03, 0x01, 0x22, 0x31, 0x81, 0x19, 0x00,
+  0xA0, 0x83, 0xF7, 0x82, 0x03, 0x00, 0x20, 0x8E, 0x03, 0x02, 0x00, 0x00, 0x01, 0x80, 0xE7, 0x00,
+  0x71, 0x80, 0x03, 0x81, 0x07, 0x01, 0x06, 0x51, 0x81, 0x10, 0x80, 0x03, 0x00, 0x02, 0x80, 0x03,
+  0x82, 0x00, 0x83, 0x27, 0x00, 0x10, 0x80, 0x03, 0x00, 0x16, 0x80, 0x03, 0x01, 0x11, 0x20, 0x80,
+  0x03, 0x00, 0x10, 0x85, 0x03, 0x80, 0x6F, 0x00, 0x10, 0x85, 0x27, 0x8C, 0x00, 0x00, 0x09, 0x80,
+  0x03, 0x00, 0x0F, 0x80, 0x03, 0x01, 0xD1, 0x00, 0x80, 0x8C, 0x04, 0x09, 0x81, 0x11, 0x11, 0x02,
+  0x80, 0x30, 0x00, 0x03, 0x83, 0x9B, 0x00, 0x14, 0x80, 0x06, 0x00, 0x16, 0x84, 0x43, 0x05, 0xD0,
+  0x11, 0x70, 0x00, 0x00, 0x12, 0x80, 0x28, 0x00, 0x50, 0x80, 0x03, 0x80, 0x0A, 0x90, 0x00, 0x00,
+  0x06, 0x80, 0x97, 0x00, 0x00, 0x81, 0x97, 0x85, 0x9B, 0x00, 0x04, 0x80, 0x03, 0x00, 0x0A, 0x86,
+  0x9F, 0x04, 0x32, 0x22, 0x22, 0x11, 0x52, 0x80, 0x03, 0x00, 0x14, 0x80, 0x03, 0x00, 0x11, 0x81,
+  0x03, 0x00, 0x52, 0x80, 0x03, 0x00, 0x13, 0x80, 0x03, 0x00, 0x11, 0x81, 0x03, 0x00, 0x52, 0x80,
+  0x03, 0x01, 0x11, 0x51, 0x80, 0x03, 0x80, 0xAB, 0x01, 0x11, 0x25, 0x80, 0x03, 0x00, 0x24, 0x88,
+  0x03, 0x81, 0x20, 0x01, 0x11, 0x15, 0x84, 0x3B, 0x00, 0x12, 0x84, 0x03, 0x00, 0x13, 0x81, 0x43,
+  0x01, 0x53, 0x44, 0x81, 0x1A, 0x81, 0x00, 0x00, 0x22, 0x90, 0x00, 0x01, 0x43, 0x42, 0x80, 0x23,
+  0x84, 0x03, 0x01, 0x22, 0x31, 0x80, 0x23, 0x80, 0x5C, 0x95, 0x03, 0x06, 0x11, 0x11, 0x20, 0x00,
+  0x11, 0x11, 0x60, 0x80, 0x03, 0x00, 0x70, 0x80, 0x03, 0x81, 0x0B, 0x81, 0x07, 0x80, 0xB7, 0x84,
+  0x03, 0x00, 0x01, 0x80, 0x81, 0x80, 0x03, 0x01, 0x11, 0x03, 0x80, 0x03, 0x00, 0x04, 0x80, 0x03,
+  0x00, 0x61, 0x84, 0xAF, 0x85, 0x03, 0x85, 0xE7, 0x00, 0x20, 0x80, 0x03, 0x00, 0x40, 0x80, 0x03,
+  0x00, 0x10, 0x80, 0x03, 0x00, 0x12, 0x81, 0xF7, 0x84, 0x03, 0x02, 0x00, 0x00, 0x07, 0x80, 0x06,
+  0x00, 0x03, 0x80, 0x03, 0x03, 0x81, 0x11, 0x00, 0x02, 0x80, 0x2F, 0x07, 0x71, 0x11, 0x11, 0x09,
+  0x81, 0x11, 0x11, 0x05, 0x80, 0x3B, 0x00, 0xE1, 0x83, 0xC2, 0x80, 0x67, 0x00, 0x14, 0x80, 0x03,
+  0x03, 0x50, 0x00, 0x11, 0x13, 0x80, 0x33, 0x00, 0x30, 0x83, 0x37, 0x81, 0x43, 0x81, 0x4F, 0x81,
+  0x7B, 0x00, 0x06, 0x81, 0x24, 0x80, 0x08, 0x80, 0x46, 0x80, 0x1A, 0x00, 0x31, 0x84, 0x4F, 0x00,
+  0x02, 0x81, 0x26, 0x00, 0x21, 0x80, 0x1A, 0x00, 0x15, 0x83, 0x46, 0x93, 0x00, 0x04, 0x42, 0x22,
+  0x22, 0x22, 0x52, 0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x81, 0x0C, 0x01, 0x11, 0x14, 0x80, 0x03,
+  0x01, 0x11, 0x32, 0x80, 0x03, 0x00, 0x14, 0x80, 0x03, 0x80, 0x15, 0x80, 0x23, 0x00, 0x22, 0x80,
+  0xC8, 0x01, 0x22, 0x41, 0x80, 0x03, 0x80, 0x4D, 0x8D, 0x03, 0x82, 0x33, 0x00, 0x32, 0x80, 0x03,
+  0x80, 0x44, 0x82, 0x03, 0x81, 0x3F, 0x81, 0x36, 0x84, 0x03, 0x82, 0x37, 0x85, 0x03, 0x00, 0x31,
+  0x83, 0x4B, 0x00, 0x23, 0x80, 0x36, 0x80, 0x0E, 0x00, 0x11, 0x80, 0x0A, 0x80, 0x62, 0x80, 0xCF,
+  0x00, 0x1C, 0x80, 0x03, 0x80, 0xD0, 0x01, 0x11, 0x10, 0x80, 0x03, 0x00, 0xC0, 0x83, 0xDF, 0x80,
+  0x16, 0x82, 0xE3, 0x81, 0x62, 0x00, 0x61, 0x80, 0x03, 0x81, 0xE7, 0x81, 0x03, 0x00, 0x04, 0x80,
+  0x03, 0x00, 0x09, 0x80, 0x03, 0x00, 0x0A, 0x81, 0xF3, 0x80, 0x4F, 0x81, 0x2B, 0x01, 0x11, 0x70,
+  0x80, 0x03, 0x00, 0x40, 0x80, 0x03, 0x00, 0x30, 0x84, 0x43, 0x81, 0x4B, 0x80, 0x18, 0x02, 0x11,
+  0x11, 0x60, 0x80, 0x1D, 0x01, 0x00, 0x06, 0x80, 0x03, 0x00, 0x03, 0x81, 0x4A, 0x80, 0x03, 0x03,
+  0x51, 0x00, 0x00, 0x07, 0x80, 0x19, 0x00, 0x03, 0x80, 0x03, 0x01, 0x21, 0x11, 0x80, 0x0A, 0x81,
+  0x00, 0x00, 0x13, 0x80, 0x03, 0x00, 0x30, 0x81, 0x49, 0x80, 0x0A, 0x80, 0x03, 0x00, 0x16, 0x80,
+  0x03, 0x00, 0x20, 0x83, 0x3F, 0x00, 0x14, 0x81, 0x43, 0x83, 0x77, 0x81, 0x08, 0x01, 0x00, 0x71,
+  0x81, 0x15, 0x00, 0x31, 0x80, 0x03, 0x00, 0x61, 0x84, 0x43, 0x82, 0x40, 0x00, 0x54, 0x82, 0x45,
+  0x94, 0x00, 0x00, 0x22, 0x80, 0x00, 0x00, 0x32, 0x80, 0x03, 0x00, 0x14, 0x80, 0x03, 0x00, 0x11,
+  0x80, 0x08, 0x00, 0x11, 0x80, 0x04, 0x80, 0x67, 0x80, 0x03, 0x01, 0x11, 0x14, 0x85, 0x1F, 0x94,
+  0x00, 0x03, 0x44, 0x55, 0x55, 0x55, 0x90, 0x1F, 0x06, 0x24, 0x31, 0x22, 0x43, 0x11, 0x11, 0x41,
+  0x85, 0x5F, 0x80, 0x08, 0x01, 0x22, 0x51, 0x80, 0x03, 0x80, 0x0B, 0x00, 0x45, 0x92, 0x81, 0x00,
+  0x42, 0x84, 0x73, 0x00, 0x14, 0x84, 0x77, 0x81, 0x03, 0x00, 0x15, 0x81, 0x2E, 0x00, 0x42, 0x81,
+  0xFB, 0x84, 0x54, 0x00, 0x23, 0x80, 0x03, 0x00, 0x25, 0x80, 0x03, 0x00, 0x41, 0x80, 0x03, 0x00,
+  0x51, 0x80, 0x0A, 0x80, 0x77, 0x03, 0x51, 0x11, 0x22, 0x23, 0x92, 0x50, 0x00, 0x13, 0x80, 0x03,
+  0x00, 0x17, 0x80, 0x03, 0x00, 0x00, 0x80, 0x0A, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x80,
+  0x03, 0x00, 0x20, 0x80, 0x03, 0x00, 0x70, 0x80, 0x03, 0x8E, 0x00, 0x80, 0x9F, 0x01, 0x00, 0x21,
+  0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x80, 0x31, 0x02, 0x00, 0x00, 0x31, 0x80, 0x03, 0x00, 0x21,
+  0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x0B, 0x80, 0x46, 0x00, 0x30, 0x80, 0x15, 0x00, 0x16,
+  0x80, 0x03, 0x00, 0x12, 0x82, 0x4F, 0x02, 0x11, 0x11, 0x1C, 0x80, 0x03, 0x00, 0x14, 0x80, 0x03,
+  0x81, 0x5F, 0x80, 0x22, 0x9B, 0x00, 0x02, 0x06, 0x00, 0x04, 0x80, 0x24, 0x00, 0xE1, 0x80, 0x03,
+  0x00, 0xF1, 0x80, 0x03, 0x03, 0x51, 0x11, 0x11, 0x02, 0x80, 0x34, 0x80, 0x6A, 0x00, 0x11, 0x80,
+  0x0A, 0x00, 0x15, 0x80, 0x06, 0x01, 0x16, 0x11, 0x80, 0xA0, 0x00, 0x11, 0x80, 0x9C, 0x81, 0x49,
+  0x00, 0x12, 0x80, 0x03, 0x81, 0xAF, 0x00, 0xE0, 0x8B, 0x43, 0x00, 0xD1, 0x80, 0x03, 0x00, 0x02,
+  0x95, 0x60, 0x85, 0xF4, 0x80, 0xC2, 0x01, 0x11, 0x03, 0x81, 0x90, 0x00, 0x31, 0x80, 0x03, 0x01,
+  0x02, 0x3B, 0x81, 0x4E, 0x00, 0x31, 0x81, 0x37, 0x03, 0x11, 0x15, 0x42, 0x22, 0x80, 0x6A, 0x00,
+  0x55, 0x85, 0x27, 0x8D, 0x00, 0x00, 0x22, 0x80, 0x00, 0x02, 0x44, 0x44, 0x22, 0x80, 0x23, 0x01,
+  0x11, 0x33, 0x95, 0x1F, 0x80, 0x00, 0x02, 0x24, 0x33, 0x33, 0x80, 0xB1, 0x91, 0x1F, 0x03, 0x41,
+  0x11, 0x11, 0x35, 0x95, 0x5C, 0x9B, 0x00, 0x00, 0x17, 0x80, 0x03, 0x00, 0x60, 0x80, 0x06, 0x80,
+  0xC3, 0x03, 0x20, 0x00, 0x11, 0x15, 0x80, 0xCB, 0x03, 0x47, 0x00, 0x00, 0x16, 0x80, 0xB4, 0x00,
+  0x60, 0x8A, 0xE1, 0x00, 0x0B, 0x80, 0xCB, 0x00, 0x0D, 0x80, 0x03, 0x00, 0x07, 0x81, 0xD3, 0x81,
+  0x03, 0x00, 0x51, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x82, 0xF2, 0x8C,
+  0x03, 0x00, 0x70, 0x80, 0x03, 0x00, 0x20, 0x80, 0x03, 0x00, 0x40, 0x80, 0x03, 0x00, 0x30, 0x84,
+  0x27, 0x81, 0x2F, 0x80, 0x37, 0x00, 0x0A, 0x80, 0x3F, 0x00, 0x08, 0x80, 0x03, 0x03, 0x21, 0x11,
+  0x00, 0x06, 0x80, 0x2C, 0x00, 0x05, 0x82, 0x87, 0x00, 0x30, 0x83, 0x87, 0x81, 0x3B, 0x00, 0x16,
+  0x83, 0x8B, 0x00, 0x13, 0x80, 0x68, 0x00, 0x17, 0x80, 0x03, 0x03, 0x10, 0x00, 0x00, 0x93, 0x81,
+  0x18, 0x00, 0x21, 0x80, 0x03, 0x01, 0x00, 0x31, 0x80, 0x03, 0x01, 0x0E, 0xB1, 0x84, 0x4B, 0x85,
+  0x03, 0x00, 0x51, 0x9A, 0xE1, 0x02, 0x13, 0x44, 0x66, 0x8C, 0x11, 0x09, 0x14, 0x11, 0x11, 0x19,
+  0x70, 0x11, 0x14, 0x00, 0x00, 0x88, 0x84, 0xDD, 0x82, 0x6F, 0x80, 0xA5, 0x00, 0x80, 0x8A, 0xF3,
+  0x87, 0x00, 0x81, 0x45, 0x00, 0x31, 0x80, 0x04, 0x80, 0x82, 0x01, 0x11, 0x71, 0x80, 0x03, 0x00,
+  0x01, 0x84, 0x03, 0x81, 0xBA, 0x00, 0x04, 0x81, 0x9B, 0x84, 0x00, 0x00, 0x20, 0x80, 0x03, 0x00,
+  0x40, 0x80, 0x03, 0x00, 0x50, 0x80, 0x03, 0x80, 0xB6, 0x82, 0x03, 0x80, 0x66, 0x91, 0x00, 0x00,
+  0x06, 0x80, 0x03, 0x00, 0x01, 0x84, 0xBF, 0x00, 0x11, 0x80, 0xD6, 0x01, 0x11, 0x06, 0x80, 0x47,
+  0x00, 0x03, 0x80, 0x03, 0x84, 0xCC, 0x00, 0x12, 0x80, 0x03, 0x00, 0x30, 0x80, 0x03, 0x04, 0x70,
+  0x11, 0x11, 0x15, 0x00, 0x80, 0x9E, 0x80, 0x24, 0x02, 0x00, 0x00, 0x16, 0x94, 0x9F, 0x80, 0x00,
+  0x00, 0x31, 0x82, 0x47, 0x01, 0x00, 0x02, 0x80, 0x03, 0x00, 0x04, 0x80, 0x03, 0x00, 0x05, 0x80,
+  0x03, 0x00, 0x21, 0x80, 0x03, 0x00, 0x41, 0x80, 0x03, 0x8C, 0xFD, 0x8C, 0x00, 0x00, 0x15, 0x84,
+  0x70, 0x95, 0x00, 0x00, 0x55, 0x80, 0x03, 0x81, 0xD7, 0x00, 0x30, 0x84, 0xCF, 0x81, 0x83, 0x81,
+  0x8B, 0x89, 0x03, 0x00, 0x04, 0x80, 0x23, 0x00, 0x02, 0x84, 0x03, 0x81, 0x6E, 0x81, 0xCF, 0x80,
+  0x7E, 0x86, 0x03, 0x00, 0x15, 0x80, 0x23, 0x81, 0x03, 0x82, 0x2F, 0x81, 0xCB, 0x80, 0x4C, 0x00,
+  0x11, 0x80, 0x4C, 0x01, 0x11, 0x13, 0x81, 0x9D, 0x80, 0x14, 0x01, 0x0F, 0xF3, 0x82, 0xFF, 0x00,
+  0x01, 0x84, 0x03, 0x8F, 0x92, 0x00, 0x16, 0x80, 0x27, 0x00, 0x60, 0x83, 0x2F, 0x00, 0x12, 0x84,
+  0x3B, 0x88, 0x03, 0x80, 0xEE, 0x81, 0x67, 0x05, 0x15, 0x09, 0x11, 0x11, 0x42, 0x0A, 0x80, 0x03,
+  0x00, 0x0B, 0x80, 0x03, 0x80, 0x43, 0x0F, 0x32, 0xB1, 0x11, 0x11, 0x22, 0x0A, 0xB1, 0x1B, 0x22,
+  0x32, 0x22, 0x31, 0x11, 0x22, 0x22, 0x23, 0x94, 0x03, 0x00, 0x61, 0x81, 0x60, 0x00, 0x32, 0x80,
+  0xA5, 0x03, 0x22, 0x11, 0x11, 0x13, 0x84, 0x03, 0x00, 0x14, 0x80, 0x03, 0x00, 0x12, 0x80, 0x03,
+  0x01, 0x32, 0x22, 0x80, 0x16, 0x02, 0x22, 0x22, 0x41, 0x80, 0x48, 0x00, 0x23, 0x80, 0x03, 0x00,
+  0x24, 0x8C, 0x03, 0x00, 0x25, 0x80, 0x03, 0x80, 0xDF, 0x88, 0x00, 0x00, 0x53, 0x83, 0x47, 0x81,
+  0x3F, 0x00, 0x52, 0x83, 0x3F, 0x80, 0x61, 0x85, 0x1C, 0x00, 0x35, 0x80, 0x03, 0x81, 0x0C, 0x82,
+  0x4F, 0x80, 0x37, 0x85, 0x03, 0x82, 0x00, 0x02, 0x54, 0x24, 0x51, 0x80, 0x6A, 0x01, 0x23, 0x14,
+  0x80, 0x6E, 0x85, 0x03, 0x81, 0x7A, 0x80, 0x46, 0x86, 0x3F, 0x85, 0x00, 0x81, 0x32, 0x80, 0x8E,
+  0x01, 0x11, 0x22, 0x80, 0xE4, 0x80, 0xDA, 0x8C, 0x00, 0x01, 0x53, 0x35, 0x80, 0xC2, 0x00, 0x22,
+  0x80, 0xBE, 0x83, 0x3B, 0x81, 0x07, 0x02, 0x00, 0x00, 0x00, 0x89, 0x03, 0x00, 0x31, 0x80, 0x03,
+  0x00, 0x23, 0x80, 0x03, 0x01, 0x22, 0x70, 0x80, 0x03, 0x00, 0x30, 0x80, 0x08, 0x04, 0x01, 0x11,
+  0x11, 0x00, 0x0D, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x09, 0x84, 0x03, 0x81, 0x0B, 0x82,
+  0x03, 0x00, 0xB1, 0x80, 0x53, 0x00, 0x20, 0x80, 0x09, 0x00, 0x40, 0x80, 0x03, 0x00, 0x10, 0x84,
+  0x03, 0x00, 0x16, 0x80, 0x03, 0x00, 0x15, 0x80, 0x03, 0x00, 0x11, 0x81, 0x03, 0x00, 0x60, 0x85,
+  0x93, 0x00, 0x03, 0x84, 0x10, 0x01, 0x00, 0x73, 0x81, 0x37, 0x87, 0x00, 0x80, 0x32, 0x00, 0x00,
+  0x80, 0x3E, 0x01, 0x00, 0x11, 0x80, 0x6F, 0x00, 0x14, 0x80, 0x0F, 0x09, 0x40, 0x00, 0x6F, 0x60,
+  0x00, 0x75, 0x11, 0x13, 0x00, 0xF1, 0x80, 0x27, 0x00, 0x41, 0x8B, 0x2B, 0x85, 0x00, 0x00, 0x20,
+  0x81, 0x37, 0x80, 0x04, 0x01, 0x11, 0x18, 0x81, 0x09, 0x96, 0x00, 0x00, 0x07, 0x80, 0x03, 0x04,
+  0x0B, 0x00, 0x00, 0x92, 0x22, 0x80, 0x07, 0x00, 0xE2, 0x80, 0x03, 0x00, 0x92, 0x85, 0x18, 0x01,
+  0x22, 0xE0, 0x81, 0xBD, 0x04, 0x52, 0x22, 0x11, 0x15, 0x22, 0x80, 0x00, 0x09, 0x51, 0x11, 0x22,
+  0x22, 0xC1, 0x11, 0x22, 0x27, 0x24, 0xBB, 0x81, 0x28, 0x85, 0x00, 0x00, 0x90, 0x80, 0x03, 0x00,
+  0x27, 0x81, 0x67, 0x02, 0x12, 0x22, 0x22, 0x81, 0x03, 0x00, 0xB1, 0x80, 0x03, 0x01, 0x00, 0xA0,
+  0x80, 0x03, 0x01, 0x00, 0x72, 0x80, 0x03, 0x00, 0x09, 0x81, 0x1E, 0x83, 0x4B, 0x80, 0xA3, 0x80,
+  0x42, 0x01, 0x11, 0x24, 0x80, 0xDB, 0x00, 0x25, 0x80, 0x03, 0x03, 0x62, 0x22, 0x23, 0x55, 0x8A,
+  0xDF, 0x80, 0x63, 0x01, 0x11, 0x13, 0x80, 0x03, 0x00, 0x14, 0x83, 0x47, 0x01, 0x55, 0x52, 0x81,
+  0x43, 0x00, 0x62, 0x81, 0x6A, 0x81, 0x9F, 0x00, 0x00, 0x81, 0x3B, 0x82, 0x03, 0x81, 0x47, 0x84,
+  0x43, 0x00, 0x77, 0x80, 0x16, 0x00, 0x60, 0x85, 0x3F, 0x81, 0x37, 0x81, 0x43, 0x01, 0x11, 0x32,
+  0x80, 0x03, 0x80, 0xB3, 0x81, 0x10, 0x02, 0x22, 0x24, 0x7E, 0x8A, 0x7F, 0x81, 0x03, 0x00, 0x21,
+  0x84, 0x07, 0x80, 0x4B, 0x00, 0xE6, 0x80, 0x20, 0x86, 0x7F, 0x86, 0x3F, 0x85, 0x03, 0x04, 0x42,
+  0x22, 0x3D, 0x3D, 0x42, 0x81, 0x7F, 0x00, 0x62, 0x82, 0x3F, 0x00, 0x30, 0x80, 0x03, 0x00, 0x42,
+  0x80, 0x03, 0x00, 0x43, 0x80, 0x03, 0x00, 0x21, 0x81, 0x03, 0x00, 0x60, 0x80, 0x53, 0x04, 0x30,
+  0x00, 0x27, 0x31, 0x12, 0x84, 0x41, 0x04, 0xB1, 0x11, 0x00, 0x00, 0x21, 0x80, 0x03, 0x00, 0x01,
+  0x84, 0x03, 0x00, 0x05, 0x80, 0x03, 0x01, 0x00, 0x41, 0x80, 0x03, 0x00, 0x61, 0x80, 0x03, 0x00,
+  0x01, 0x80, 0xAE, 0x00, 0x20, 0x84, 0x03, 0x00, 0x30, 0x80, 0x03, 0x00, 0x10, 0x8C, 0x03, 0x01,
+  0xA0, 0x00, 0x80, 0x93, 0x01, 0x00, 0x61, 0x80, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x02, 0x80,
+  0x03, 0x00, 0x06, 0x80, 0x03, 0x82, 0x47, 0x00, 0x06, 0x81, 0x47, 0x80, 0x22, 0x01, 0x13, 0x70,
+  0x81, 0x04, 0x80, 0x03, 0x92, 0x00, 0x81, 0x81, 0x00, 0x26, 0x81, 0x28, 0x01, 0x52, 0x20, 0x81,
+  0x2C, 0x81, 0x03, 0x00, 0x12, 0x8D, 0x1F, 0x89, 0x00, 0x00, 0x70, 0x80, 0x03, 0x00, 0x13, 0x80,
+  0x04, 0x01, 0x11, 0x13, 0x81, 0x5C, 0x00, 0x10, 0x81, 0x12, 0x80, 0xD5, 0x81, 0xAF, 0x00, 0x02,
+  0x84, 0x77, 0x81, 0xCB, 0x03, 0xD1, 0x11, 0x00, 0x07, 0x80, 0x3B, 0x00, 0x0B, 0x81, 0x4D, 0x01,
+  0x22, 0x22, 0x8E, 0x03, 0x00, 0x52, 0x84, 0x03, 0x80, 0x0B, 0x07, 0x23, 0x14, 0x20, 0x00, 0x23,
+  0x11, 0x11, 0x33, 0x80, 0x03, 0x00, 0x11, 0x90, 0x03, 0x80, 0x65, 0x0D, 0x00, 0x00, 0x33, 0x60,
+  0x00, 0x00, 0x15, 0x22, 0x23, 0xBB, 0x42, 0x22, 0x22, 0xB1, 0x80, 0x36, 0x00, 0x41, 0x81, 0x03,
+  0x00, 0xA2, 0x80, 0x03, 0x00, 0x22, 0x80, 0x03, 0x85, 0x97, 0x80, 0x13, 0x81, 0xE7, 0x92, 0xDF,
+  0x85, 0xBA, 0x05, 0x11, 0x11, 0x17, 0x22, 0x11, 0x15, 0x80, 0x77, 0x00, 0x13, 0x87, 0x03, 0x89,
+  0xDB, 0x00, 0x06, 0x80, 0x03, 0x00, 0x22, 0x80, 0x33, 0x89, 0x03, 0x02, 0x00, 0x00, 0x07, 0x89,
+  0x22, 0x80, 0xD5, 0x01, 0x11, 0x52, 0x80, 0x03, 0x00, 0x32, 0x84, 0x03, 0x00, 0x52, 0x87, 0x5D,
+  0x80, 0x3B, 0x00, 0x2E, 0x80, 0x03, 0x01, 0x22, 0x41, 0x80, 0x61, 0x01, 0x25, 0x11, 0x80, 0xD9,
+  0x82, 0x03, 0x89, 0x3C, 0x81, 0x00, 0x03, 0x44, 0x44, 0x44, 0xA6, 0x80, 0x37, 0x00, 0x42, 0x85,
+  0x43, 0x89, 0x1B, 0x00, 0x72, 0x80, 0x43, 0x01, 0x62, 0x26, 0x81, 0x43, 0x00, 0x66, 0x80, 0x03,
+  0x01, 0x21, 0x50, 0x80, 0x47, 0x00, 0x10, 0x88, 0x1E, 0x00, 0x61, 0x80, 0x03, 0x80, 0x4F, 0x06,
+  0x73, 0x11, 0x00, 0x74, 0x11, 0x11, 0x03, 0x80, 0x3C, 0x00, 0xC1, 0x80, 0x03, 0x0A, 0x04, 0x53,
+  0x20, 0x00, 0x31, 0x11, 0x12, 0x00, 0x11, 0x11, 0x14, 0x80, 0x03, 0x00, 0x11, 0x81, 0x03, 0x00,
+  0x20, 0x80, 0x03, 0x00, 0x40, 0x85, 0x03, 0x06, 0x41, 0x11, 0x11, 0x60, 0x02, 0xA2, 0x20, 0x8D,
+  0x86, 0x89, 0x00, 0x81, 0x57, 0x00, 0x04, 0x95, 0x1C, 0x80, 0x43, 0x82, 0x00, 0x80, 0x47, 0x01,
+  0x11, 0x04, 0x80, 0x03, 0x00, 0x02, 0x81, 0x64, 0x00, 0x51, 0x80, 0x03, 0x80, 0x80, 0x02, 0x00,
+  0x00, 0xA1, 0x80, 0x0D, 0x00, 0x1A, 0x81, 0x23, 0x00, 0x60, 0x80, 0x03, 0x00, 0x13, 0x85, 0x2B,
+  0x89, 0x00, 0x89, 0x4B, 0x00, 0x90, 0x80, 0x03, 0x00, 0x14, 0x81, 0x53, 0x00, 0x30, 0x80, 0x03,
+  0x00, 0x13, 0x81, 0x5B, 0x03, 0x12, 0x00, 0x00, 0x91, 0x80, 0x23, 0x80, 0x46, 0x81, 0x44, 0x81,
+  0x5B, 0x00, 0x0A, 0x80, 0x03, 0x00, 0x0B, 0x80, 0x03, 0x00, 0x21, 0x84, 0xDF, 0x05, 0x11, 0x12,
+  0x22, 0x22, 0x11, 0x15, 0x80, 0x03, 0x02, 0x11, 0x15, 0x55, 0x91, 0x5F, 0x00, 0x25, 0x80, 0x77,
+  0x80, 0x9B, 0x00, 0x52, 0x80, 0x0A, 0x00, 0x32, 0x88, 0x03, 0x86, 0x8B, 0x03, 0x22, 0x22, 0x22,
+  0x51, 0x80, 0x03, 0x80, 0x07, 0x00, 0x24, 0x80, 0x03, 0x00, 0x23, 0x80, 0x03, 0x04, 0x25, 0x11,
+  0x22, 0x24, 0x51, 0x87, 0x20, 0x00, 0x13, 0x80, 0x1C, 0x91, 0x03, 0x82, 0x73, 0x00, 0x14, 0x81,
+  0x04, 0x00, 0x11, 0x91, 0x03, 0x00, 0x24, 0x80, 0x03, 0x80, 0x77, 0x81, 0x00, 0x81, 0x7B, 0x96,
+  0x03, 0x83, 0x73, 0x97, 0x03, 0x84, 0x27, 0x00, 0x12, 0x90, 0x03, 0x00, 0x15, 0x83, 0xBF, 0x01,
+  0x25, 0x12, 0x80, 0x03, 0x80, 0x8D, 0x80, 0xB7, 0x8A, 0x03, 0x06, 0x31, 0x11, 0x53, 0x35, 0x11,
+  0x11, 0x00, 0x88, 0x00, 0x00, 0x20, 0x80, 0x03, 0x00, 0x30, 0x80, 0x03, 0x00, 0x10, 0x80, 0x03,
+  0x00, 0x16, 0x80, 0x03, 0x01, 0x11, 0x70, 0x89, 0x1D, 0x8A, 0x00, 0x00, 0x06, 0x80, 0x02, 0x80,
+  0x3B, 0x00, 0x61, 0x81, 0x3F, 0x09, 0x04, 0x00, 0x00, 0x03, 0x11, 0x00, 0x02, 0x31, 0x11, 0x00,
+  0x80, 0xD0, 0x00, 0x65, 0x83, 0xD3, 0xA5, 0x00, 0x00, 0x30, 0x80, 0x03, 0x04, 0x20, 0x11, 0x11,
+  0x13, 0x00, 0x80, 0x0A, 0x80, 0x03, 0x01, 0x70, 0x00, 0x80, 0x06, 0x01, 0x00, 0x14, 0x80, 0x54,
+  0x00, 0x40, 0x86, 0x6A, 0x00, 0x08, 0x80, 0x63, 0x81, 0x6B, 0x01, 0x00, 0x61, 0x80, 0x03, 0x00,
+  0x0E, 0x8D, 0x88, 0x8D, 0x50, 0x00, 0x01, 0x80, 0x03, 0x00, 0x06, 0x80, 0x03, 0x81, 0x8B, 0x02,
+  0x00, 0x06, 0x51, 0x81, 0x12, 0x80, 0x5F, 0x82, 0x67, 0x00, 0x13, 0x91, 0x80, 0x85, 0x47, 0x81,
+  0xEA, 0x00, 0x12, 0x80, 0x03, 0x00, 0x18, 0x81, 0x53, 0x80, 0x7C, 0x00, 0x11, 0x80, 0x0C, 0x80,
+  0x3A, 0x01, 0x00, 0xB1, 0x80, 0x23, 0x81, 0x03, 0x80, 0x4E, 0x01, 0x11, 0x03, 0x85, 0x57, 0x01,
+  0x00, 0x62, 0x81, 0x37, 0x00, 0x06, 0x91, 0x7F, 0x85, 0x00, 0x00, 0x24, 0x81, 0x2B, 0x01, 0x02,
+  0x35, 0x81, 0x0A, 0x82, 0x84, 0x98, 0x00, 0x00, 0x12, 0x80, 0x03, 0x00, 0x14, 0x95, 0x1C, 0x02,
+  0x22, 0x22, 0x25, 0x80, 0x03, 0x02, 0x41, 0x11, 0x53, 0x82, 0x4A, 0x90, 0x00, 0x00, 0x20, 0x80,
+  0x83, 0x81, 0x03, 0x00, 0x17, 0x80, 0x03, 0x00, 0x14, 0x80, 0x03, 0x00, 0x15, 0x81, 0x93, 0x85,
+  0x03, 0x00, 0xE0, 0x85, 0xDE, 0x85, 0x00, 0x00, 0x02, 0x81, 0xB2, 0x08, 0x00, 0x00, 0x63, 0x11,
+  0x00, 0x04, 0x11, 0x11, 0x06, 0x82, 0xA3, 0x02, 0x11, 0x11, 0x07, 0x80, 0xD3, 0x00, 0x65, 0x9C,
+  0xA4, 0x8C, 0x00, 0x00, 0x10, 0x80, 0x03, 0x03, 0xA0, 0x11, 0x11, 0x13, 0x80, 0x63, 0x00, 0x15,
+  0x80, 0x03, 0x01, 0x30, 0x00, 0x80, 0x02, 0x01, 0x00, 0x57, 0x8D, 0x6D, 0x82, 0x00, 0x00, 0x09,
+  0x80, 0x6F, 0x01, 0x00, 0x41, 0x80, 0x03, 0x00, 0x0E, 0x91, 0x1D, 0x85, 0x50, 0x00, 0x91, 0x80,
+  0x03, 0x01, 0x07, 0x51, 0x80, 0x8F, 0x00, 0x01, 0x80, 0x03, 0x80, 0x98, 0x80, 0xAA, 0x81, 0x37,
+  0x01, 0x75, 0x11, 0x80, 0xD4, 0x80, 0x1A, 0x00, 0x40, 0x80, 0x03, 0x00, 0x14, 0x91, 0x88, 0x89,
+  0x4B, 0x00, 0x60, 0x80, 0x03, 0x00, 0x10, 0x80, 0x03, 0x01, 0x18, 0x70, 0x80, 0x57, 0x80, 0x8F,
+  0x80, 0x3A, 0x9A, 0x00, 0x02, 0x09, 0x62, 0xA3, 0x82, 0x43, 0x02, 0x02, 0x48, 0x81, 0x81, 0x47,
+  0x00, 0x02, 0x8A, 0x1B, 0x02, 0x22, 0x23, 0x43, 0x89, 0x67, 0x00, 0x24, 0x81, 0x9B, 0x02, 0x00,
+  0x00, 0x22, 0x85, 0x1F, 0x01, 0x44, 0x20, 0x81, 0xBB, 0x00, 0x60, 0x86, 0xBF, 0x81, 0x00, 0x01,
+  0x22, 0x81, 0x80, 0x23, 0x02, 0x0F, 0xF5, 0x48, 0x91, 0xDF, 0x89, 0x00, 0x03, 0x62, 0x55, 0x55,
+  0x33, 0x99, 0x1F, 0x01, 0x3C, 0x44, 0x81, 0x8F, 0x00, 0x09, 0x96, 0x1F, 0x81, 0x00, 0x00, 0x23,
+  0x82, 0xFB, 0x04, 0xE5, 0xC1, 0x11, 0x11, 0xF0, 0x80, 0x23, 0x00, 0x30, 0x80, 0x03, 0x00, 0x40,
+  0x88, 0x07, 0x87, 0x03, 0x98, 0x00, 0x03, 0x07, 0x00, 0x00, 0x06, 0x81, 0xD3, 0x81, 0x00, 0x00,
+  0x06, 0x80, 0x02, 0x09, 0x41, 0x00, 0x07, 0x41, 0x11, 0x00, 0x41, 0x11, 0x11, 0x03, 0x80, 0x5B,
+  0x80, 0xEE, 0x82, 0x00, 0x00, 0x01, 0x95, 0x80, 0x97, 0x00, 0x00, 0x13, 0x80, 0x03, 0x03, 0xC0,
+  0x11, 0x11, 0x12, 0x84, 0x83, 0x0A, 0x10, 0x00, 0x11, 0x15, 0x60, 0x00, 0x11, 0xA0, 0x00, 0x00,
+  0x30, 0x90, 0x84, 0x81, 0x30, 0x00, 0x95, 0x80, 0x73, 0x00, 0x00, 0x80, 0x74, 0x02, 0x00, 0x00,
+  0x31, 0x80, 0x03, 0x00, 0x01, 0x81, 0x93, 0x00, 0xD1, 0x80, 0x03, 0x00, 0x03, 0x83, 0x1F, 0x81,
+  0x03, 0x81, 0xD7, 0x00, 0x19, 0x81, 0x2B, 0x00, 0x20, 0x80, 0x03, 0x00, 0x10, 0x80, 0x03, 0x00,
+  0x12, 0x85, 0x6C, 0x95, 0xDC, 0x00, 0x60, 0x80, 0x03, 0x00, 0x16, 0x97, 0xFB, 0x05, 0x02, 0x00,
+  0x00, 0x74, 0x11, 0x04, 0x8E, 0x3F, 0x06, 0x2D, 0xBB, 0x00, 0x02, 0x11, 0x11, 0xA3, 0x88, 0xCC,
+  0x83, 0x17, 0x02, 0x92, 0x53, 0x7C, 0x93, 0xEB, 0x05, 0x3A, 0x00, 0x4B, 0xBB, 0x11, 0xB1, 0x91,
+  0x19, 0x03, 0x14, 0x44, 0xCA, 0x70, 0x84, 0xDF, 0x90, 0x00, 0x02, 0xC4, 0x22, 0x22, 0x81, 0xA1,
+  0x92, 0x1F, 0x02, 0x00, 0x42, 0x27, 0x81, 0x39, 0x83, 0x00, 0x02, 0x11, 0x11, 0xC0, 0x80, 0x03,
+  0x00, 0x80, 0x80, 0x03, 0x03, 0x30, 0x00, 0x11, 0x18, 0x83, 0x33, 0x88, 0x00, 0x00, 0x2F, 0x88,
+  0x0B, 0x00, 0x07, 0x80, 0x03, 0x00, 0x0C, 0x80, 0x03, 0x00, 0x01, 0x84, 0x07, 0x01, 0x07, 0xF6,
+  0x85, 0x18, 0x03, 0x22, 0x22, 0x90, 0x81, 0x8C, 0x64, 0x81, 0x0F, 0x02, 0x02, 0xF3, 0x88, 0x86,
+  0xFF, 0x01, 0x44, 0xF2, 0x81, 0x6B, 0x01, 0x18, 0x4C, 0x8E, 0x8C, 0x88, 0x00, 0x02, 0xC4, 0x32,
+  0x29, 0x81, 0xAF, 0x00, 0x86, 0x89, 0x1F, 0x00, 0xC8, 0x80, 0x48, 0x03, 0x00, 0x00, 0x97, 0x25,
+  0x89, 0x27, 0x02, 0x8D, 0xF2, 0xE0, 0x8A, 0xD7, 0x00, 0x51, 0x82, 0x47, 0x01, 0x02, 0x22, 0x89,
+  0x23, 0x03, 0x11, 0x11, 0x14, 0x34, 0x89, 0x23, 0x00, 0x24, 0x80, 0x24, 0x89, 0x1F, 0x03, 0x44,
+  0x42, 0x00, 0x77, 0x83, 0x19, 0x00, 0x40, 0x80, 0x2B, 0x05, 0x60, 0x00, 0x11, 0x14, 0x00, 0x00,
+  0x8A, 0x40, 0x80, 0x00, 0x01, 0x18, 0x96, 0x8C, 0x10, 0x8B, 0x00, 0x03, 0x73, 0x02, 0x47, 0x03,
+  0x80, 0x53, 0x00, 0x01, 0x80, 0x03, 0x05, 0x31, 0x11, 0x00, 0x03, 0x11, 0x11, 0x80, 0x02, 0x01,
+  0x11, 0x21, 0x80, 0x03, 0x00, 0x31, 0x8D, 0xE4, 0x8F, 0x00, 0x06, 0x56, 0x11, 0x11, 0x36, 0x00,
+  0x11, 0x13, 0x81, 0xA7, 0x80, 0x03, 0x02, 0x16, 0x00, 0x00, 0x80, 0x0A, 0x01, 0x00, 0x30, 0x90,
+  0x64, 0x00, 0x61, 0x80, 0x2C, 0x00, 0x06, 0x81, 0xBB, 0x80, 0x08, 0x01, 0x00, 0x02, 0x81, 0x2D,
+  0x00, 0x81, 0x80, 0x03, 0x00, 0x7D, 0x81, 0xCB, 0x00, 0x61, 0x80, 0x03, 0x00, 0x06, 0x81, 0x08,
+  0x01, 0x11, 0x20, 0x83, 0x43, 0x86, 0x4F, 0x82, 0xD3, 0x00, 0x12, 0x80, 0x2D, 0x01, 0x11, 0x31,
+  0x93, 0xBA, 0x02, 0xC2, 0x26, 0x41, 0x84, 0x88, 0x95, 0xDC, 0x01, 0x13, 0x46, 0x81, 0x47, 0x00,
+  0x70, 0x89, 0x12, 0x06, 0x07, 0x00, 0x00, 0x41, 0x11, 0x00, 0x0F, 0x80, 0x33, 0x00, 0x05, 0x80,
+  0x03, 0x00, 0x01, 0x80, 0x03, 0x80, 0xF0, 0x81, 0x7E, 0x04, 0x00, 0x06, 0x21, 0x11, 0x45, 0x92,
+  0xE6, 0x01, 0x32, 0x27, 0x90, 0x14, 0x05, 0x13, 0x11, 0x11, 0x26, 0x00, 0xC6, 0x84, 0x54, 0x87,
+  0x13, 0x03, 0x52, 0x00, 0x13, 0x60, 0x8F, 0x87, 0x81, 0xD3, 0x00, 0x42, 0x8A, 0x86, 0x8D, 0x00,
+  0x00, 0x05, 0x80, 0x83, 0x00, 0x61, 0x80, 0x03, 0x00, 0xF1, 0x80, 0x03, 0x00, 0x21, 0x80, 0x03,
+  0x00, 0x01, 0x80, 0x03, 0x00, 0x0D, 0x80, 0x03, 0x81, 0x17, 0x81, 0xA8, 0x80, 0x43, 0x00, 0x30,
+  0x80, 0x03, 0x00, 0x16, 0x80, 0x03, 0x00, 0x12, 0x8F, 0x03, 0x00, 0x88, 0x80, 0x7C, 0x02, 0x00,
+  0xEF, 0x58, 0x81, 0x26, 0x92, 0x00, 0x85, 0xB4, 0x03, 0x00, 0x07, 0x2D, 0x81, 0x80, 0x0E, 0x00,
+  0x0E, 0x95, 0x1F, 0x81, 0x00, 0x01, 0x2F, 0x38, 0x82, 0x6E, 0x96, 0x1F, 0x82, 0x47, 0x02, 0x77,
+  0x00, 0x03, 0x99, 0x1F, 0x82, 0x23, 0x02, 0x02, 0x22, 0x4D, 0x88, 0x1F, 0x81, 0x03, 0x00, 0x15,
+  0x89, 0x1F, 0x00, 0x81, 0x81, 0x14, 0x01, 0x22, 0x31, 0x81, 0x6B, 0x00, 0x73, 0x81, 0x23, 0x01,
+  0x42, 0x70, 0x80, 0x27, 0x00, 0x13, 0x81, 0x2B, 0x00, 0x40, 0x80, 0x03, 0x00, 0x80, 0x84, 0x03,
+  0x00, 0x30, 0x82, 0x13, 0x05, 0x00, 0x00, 0x41, 0x11, 0x00, 0x03, 0x80, 0x2F, 0x00, 0x61, 0x80,
+  0x03, 0x03, 0x31, 0x11, 0x11, 0x0D, 0x80, 0x3B, 0x00, 0x01, 0x88, 0x03, 0x88, 0x00, 0x00, 0x13,
+  0x80, 0x03, 0x08, 0x20, 0x11, 0x11, 0x50, 0x00, 0x11, 0x14, 0x70, 0x00, 0x81, 0x3A, 0x00, 0x60,
+  0x81, 0x7F, 0x80, 0x03, 0x00, 0x1E, 0x80, 0x03, 0x80, 0x62, 0x92, 0x00, 0x00, 0xF1, 0x80, 0x34,
+  0x01, 0x0A, 0xD1, 0x80, 0x5B, 0x00, 0x06, 0x81, 0xFB, 0x00, 0x64, 0x81, 0x2E, 0x00, 0x01, 0x9D,
+  0xDF, 0x80, 0x86, 0x02, 0x11, 0x02, 0x21, 0x81, 0xE7, 0x81, 0x0D, 0x00, 0x20, 0x80, 0x23, 0x85,
+  0x03, 0x80, 0x7B, 0x8C, 0x03, 0x01, 0x00, 0x07, 0x81, 0x57, 0x01, 0x7C, 0xC2, 0x94, 0x7E, 0x02,
+  0x00, 0x15, 0x30, 0x97, 0x9B, 0x9C, 0x00, 0x07, 0x9C, 0x00, 0x00, 0x06, 0xC1, 0x00, 0x00, 0x05,
+  0x80, 0x5F, 0x80, 0x03, 0x03, 0x07, 0x2C, 0x11, 0x00, 0x80, 0x98, 0x00, 0x0D, 0x80, 0x91, 0x80,
+  0xCE, 0x87, 0x00, 0x00, 0x12, 0x80, 0xC3, 0x8D, 0x03, 0x01, 0x11, 0x85, 0x81, 0xD7, 0x00, 0x12,
+  0x81, 0x1E, 0x99, 0x60, 0x04, 0x13, 0x60, 0x00, 0x00, 0x01, 0x80, 0x23, 0x81, 0x03, 0x00, 0x08,
+  0x81, 0x2B, 0x00, 0x51, 0x80, 0x03, 0x84, 0xF7, 0x02, 0x00, 0x00, 0x64, 0x82, 0x3B, 0x89, 0x6A,
+  0x80, 0x00, 0x00, 0x17, 0x81, 0x26, 0x05, 0x11, 0x11, 0x37, 0x00, 0x11, 0x13, 0x83, 0x43, 0x83,
+  0x67, 0x03, 0x15, 0x20, 0x11, 0x52, 0x94, 0x64, 0x00, 0x07, 0x81, 0x4B, 0x00, 0x41, 0x80, 0x03,
+  0x00, 0x61, 0x80, 0x03, 0x00, 0x02, 0x81, 0x53, 0x00, 0x61, 0x81, 0x15, 0x85, 0x1E, 0x8C, 0x5F,
+  0x84, 0x00, 0x01, 0x15, 0x20, 0x87, 0x1F, 0x00, 0x50, 0x80, 0x03, 0x0A, 0xC0, 0x00, 0x11, 0x15,
+  0x70, 0x00, 0x11, 0x90, 0x00, 0x00, 0x37, 0x99, 0xD0, 0x8A, 0x00, 0x80, 0x73, 0x82, 0xC7, 0x93,
+  0x00, 0x02, 0x44, 0x44, 0x44, 0x82, 0x69, 0x95, 0x1F, 0x85, 0x89, 0x8E, 0x18, 0x03, 0x62, 0x22,
+  0x44, 0x31, 0x88, 0xA9, 0x87, 0x18, 0x06, 0x06, 0x25, 0x09, 0xE2, 0x31, 0x11, 0xB1, 0x8C, 0xC9,
+  0x05, 0x00, 0x02, 0x41, 0x11, 0x0D, 0x81, 0x92, 0xE4, 0x03, 0x52, 0x11, 0x1F, 0x20, 0x8B, 0xFF,
+  0x00, 0x18, 0x80, 0x03, 0x04, 0x74, 0x11, 0x11, 0x87, 0x08, 0x80, 0x37, 0x81, 0x03, 0x00, 0x01,
+  0x8C, 0x31, 0x00, 0x0D, 0x82, 0x50, 0x04, 0x11, 0x14, 0x00, 0x00, 0x0C, 0x80, 0x03, 0x01, 0x00,
+  0x12, 0x81, 0xA7, 0x02, 0x18, 0x82, 0x90, 0x80, 0x15, 0x00, 0x14, 0x8D, 0x5C, 0x01, 0x92, 0x38,
+  0x81, 0x9B, 0x01, 0x22, 0xC1, 0x81, 0x99, 0x00, 0x90, 0x81, 0x27, 0x02, 0x88, 0x84, 0x8D, 0x91,
+  0x84, 0x85, 0xBD, 0x00, 0x22, 0x80, 0x00, 0x99, 0x1F, 0x00, 0x20, 0x81, 0x43, 0x02, 0x3A, 0xAA,
+  0x29, 0x95, 0x1F, 0x85, 0x00, 0x80, 0x12, 0x00, 0x44, 0x99, 0x1F, 0x03, 0x44, 0x44, 0x4C, 0x60,
+  0x80, 0x16, 0x00, 0x10, 0x80, 0x03, 0x00, 0x13, 0x81, 0x1F,
+};
+static const u8 ILLUSTRATION_MAP_gbgg_skel[] = {
+  0x08, 0xC0, 0x00, 0x00, 0xD2, 0x00, 0x0B, 0x40, 0x01, 0x40, 0x02, 0x40, 0x03, 0x40, 0x04, 0x40,
+  0x05, 0x40, 0x06, 0xC2, 0x4F, 0x0E, 0x07, 0x40, 0x08, 0x40, 0x09, 0x40, 0x0A, 0x40, 0x0B, 0x40,
+  0x0C, 0x40, 0x0D, 0x40, 0x0E, 0xBE, 0x4F, 0x0C, 0x0F, 0x40, 0x10, 0x40, 0x11, 0x60, 0x12, 0x40,
+  0x13, 0x40, 0x14, 0x40, 0x15, 0xAC, 0x3B, 0x08, 0x16, 0x40, 0x17, 0x40, 0x18, 0x40, 0x19, 0x40,
+  0x1A, 0x88, 0x13, 0x0C, 0x1B, 0x40, 0x1C, 0x40, 0x1D, 0x40, 0x1E, 0x40, 0x1F, 0x40, 0x20, 0x40,
+  0x21, 0x8D, 0x31, 0x13, 0x60, 0x22, 0x60, 0x23, 0x60, 0x24, 0x60, 0x25, 0x00, 0x26, 0x60, 0x27,
+  0x60, 0x28, 0x40, 0x29, 0x40, 0x2A, 0x40, 0x2B, 0x8A, 0x51, 0x06, 0x2C, 0x40, 0x2D, 0x40, 0x2E,
+  0x40, 0x2F, 0x80, 0x29, 0x00, 0x30, 0x86, 0x13, 0x0A, 0x31, 0x40, 0x32, 0x40, 0x33, 0x40, 0x34,
+  0x40, 0x35, 0x40, 0x36, 0x8A, 0x4B, 0x06, 0x37, 0x60, 0x38, 0x40, 0x39, 0x00, 0x26, 0x8D, 0x01,
+  0x03, 0x40, 0x3A, 0x40, 0x3B, 0x86, 0x3B, 0x0A, 0x3C, 0x40, 0x3D, 0x40, 0x3E, 0x40, 0x3F, 0x40,
+  0x40, 0x40, 0x41, 0x86, 0x13, 0x0A, 0x42, 0x40, 0x43, 0x40, 0x44, 0x40, 0x45, 0x40, 0x46, 0x40,
+  0x47, 0x86, 0x13, 0x0A, 0x48, 0x40, 0x49, 0x40, 0x4A, 0x40, 0x4B, 0x40, 0x4C, 0x40, 0x4D, 0x90,
+  0x51, 0x02, 0x4E, 0x40, 0x4F, 0x82, 0x25, 0x0C, 0x50, 0x40, 0x51, 0x40, 0x52, 0x40, 0x53, 0x40,
+  0x54, 0x40, 0x55, 0x40, 0x56, 0x86, 0x3B, 0x02, 0x57, 0x40, 0x58, 0x80, 0x23, 0x02, 0x59, 0x40,
+  0x5A, 0x86, 0x11, 0x02, 0x5B, 0x40, 0x5C, 0x84, 0x39, 0x04, 0x5D, 0x40, 0x5E, 0x50, 0x4A, 0x8A,
+  0x4B, 0x02, 0x5F, 0x40, 0x60, 0x80, 0x05, 0x02, 0x61, 0x40, 0x62, 0x80, 0x27, 0x0C, 0x63, 0x40,
+  0x64, 0x40, 0x65, 0x40, 0x66, 0x40, 0x67, 0x40, 0x68, 0x40, 0x69, 0x87, 0xD9, 0x07, 0x40, 0x6A,
+  0x40, 0x6B, 0x40, 0x6C, 0x40, 0x6D, 0x86, 0x0F, 0x00, 0x6E, 0x84, 0x3B, 0x06, 0x6F, 0x40, 0x70,
+  0x40, 0x71, 0x40, 0x72, 0x86, 0x4B, 0x06, 0x73, 0x40, 0x74, 0x40, 0x75, 0x40, 0x76, 0x82, 0x0B,
+  0x00, 0x77, 0x80, 0x27, 0x0A, 0x78, 0x40, 0x79, 0x40, 0x7A, 0x50, 0x4A, 0x40, 0x7B, 0x40, 0x7C,
+  0x88, 0x4D, 0x02, 0x7D, 0x40, 0x7E, 0x87, 0x0D, 0x82, 0x11, 0x00, 0x7F, 0x84, 0x3F, 0x02, 0x80,
+  0x40, 0x81, 0x80, 0x01, 0x02, 0x82, 0x40, 0x83, 0x82, 0x0D, 0x02, 0x84, 0x40, 0x85, 0x82, 0x0F,
+  0x00, 0x86, 0x82, 0x0D, 0x00, 0x87, 0x82, 0x29, 0x06, 0x88, 0x40, 0x89, 0x40, 0x8A, 0x40, 0x8B,
+  0x89, 0x3D, 0x03, 0x60, 0x8C, 0x40, 0x8D, 0x8C, 0x4F, 0x00, 0x8E, 0x84, 0x4F, 0x00, 0x8F, 0x82,
+  0x3F, 0x02, 0x81, 0x40, 0x90, 0x80, 0x0B, 0x02, 0x91, 0x40, 0x92, 0x84, 0x0D, 0x02, 0x93, 0x40,
+  0x94, 0x80, 0x0F, 0x00, 0x95, 0x86, 0x2D, 0x02, 0x96, 0x40, 0x97, 0x88, 0x4D, 0x04, 0x98, 0x60,
+  0x99, 0x40, 0x9A, 0x8C, 0x4F, 0x02, 0x9B, 0x50, 0x4A, 0x82, 0x4F, 0x00, 0x9C, 0x84, 0x41, 0x06,
+  0x82, 0x40, 0x9D, 0x40, 0x9E, 0x40, 0x9F, 0x84, 0x0D, 0x02, 0x81, 0x40, 0xA0, 0x80, 0x1B, 0x00,
+  0xA1, 0x88, 0x2F, 0x02, 0xA2, 0x40, 0xA3, 0x86, 0x4F, 0x02, 0xA4, 0x40, 0xA5, 0x8B, 0x4D, 0x82,
+  0x21, 0x00, 0xA6, 0x82, 0x4F, 0x02, 0xA7, 0x40, 0xA8, 0x84, 0x41, 0x00, 0xA9, 0x80, 0x0D, 0x00,
+  0xAA, 0x86, 0x4F, 0x00, 0xAB, 0x80, 0x0D, 0x00, 0xAC, 0x88, 0x2D, 0x02, 0xAD, 0x40, 0xAE, 0x84,
+  0x09, 0x02, 0xAF, 0x40, 0xB0, 0x8F, 0x4D, 0x82, 0x67, 0x00, 0xB1, 0x82, 0x51, 0x08, 0xB2, 0x40,
+  0xB3, 0x40, 0xB4, 0x40, 0xB5, 0x40, 0xB6, 0x80, 0x0B, 0x00, 0xB7, 0x84, 0x4D, 0x00, 0xB8, 0x80,
+  0x0B, 0x02, 0xB9, 0x40, 0xBA, 0x88, 0x4F, 0x02, 0xBB, 0x60, 0xBC, 0x82, 0x07, 0x04, 0xBD, 0x40,
+  0xBE, 0x40, 0xBF, 0x94, 0x4F, 0x02, 0xC0, 0x40, 0xC1, 0x81, 0x51, 0x89, 0x01, 0x0B, 0x40, 0xC2,
+  0x40, 0xC3, 0x40, 0xC4, 0x40, 0xC5, 0x40, 0xC6, 0x40, 0xC7, 0x8A, 0x2B, 0x02, 0xC8, 0x40, 0xC9,
+  0x82, 0x4F, 0x02, 0xCA, 0x40, 0xCB, 0x93, 0x4D, 0x84, 0x27, 0x00, 0xCC, 0x8D, 0x51, 0x80, 0x53,
+  0x04, 0xCD, 0x40, 0xCE, 0x40, 0xCF, 0x8D, 0x29, 0x09, 0x40, 0xD0, 0x40, 0xD1, 0x40, 0xD2, 0x40,
+  0xD3, 0x40, 0xD4, 0x99, 0x4F, 0x07, 0x40, 0xD5, 0x40, 0xD6, 0x50, 0xA7, 0x40, 0xD7, 0x88, 0x4D,
+  0x00, 0xD8, 0x94, 0x29, 0x06, 0xD9, 0x40, 0xDA, 0x40, 0xDB, 0x40, 0xDC, 0x99, 0x4D, 0x80, 0x9F,
+  0x12, 0xDD, 0x40, 0xDE, 0x40, 0xDF, 0x40, 0xE0, 0x40, 0xE1, 0x40, 0xE2, 0x40, 0xE3, 0x40, 0xE4,
+  0x40, 0xE5, 0x40, 0xE6, 0x94, 0x29, 0x08, 0xE7, 0x40, 0xE8, 0x40, 0xE9, 0x40, 0xEA, 0x40, 0xEB,
+  0x98, 0x9D, 0x14, 0xEC, 0x60, 0xED, 0x60, 0xEE, 0x60, 0xEF, 0x40, 0xF0, 0x40, 0xF1, 0x60, 0xF2,
+  0x40, 0xF3, 0x40, 0xF4, 0x40, 0xF5, 0x40, 0xF6, 0x94, 0x4F, 0x02, 0xF7, 0x60, 0xF8, 0x80, 0x31,
+  0x06, 0xF9, 0x40, 0xFA, 0x40, 0xFB, 0x40, 0xFC, 0x94, 0x23, 0x14, 0xFD, 0x40, 0xFE, 0x40, 0xFF,
+  0x61, 0x00, 0x41, 0x01, 0x41, 0x02, 0x41, 0x03, 0x41, 0x04, 0x41, 0x05, 0x41, 0x06, 0x41, 0x07,
+  0x8F, 0x27, 0x07, 0x41, 0x08, 0x41, 0x09, 0x50, 0xBD, 0x61, 0x0A, 0x80, 0x09, 0x08, 0x0B, 0x61,
+  0x0C, 0x00, 0x26, 0x41, 0x0D, 0x41, 0x0E, 0x91, 0x4F, 0x07, 0x61, 0x0F, 0x41, 0x10, 0x41, 0x11,
+  0x41, 0x12, 0x80, 0x21, 0x0C, 0x13, 0x41, 0x14, 0x41, 0x15, 0x41, 0x16, 0x41, 0x17, 0x41, 0x18,
+  0x41, 0x19, 0x8A, 0x4B, 0x06, 0x1A, 0x41, 0x1B, 0x41, 0x1C, 0x41, 0x1D, 0x86, 0x33, 0x02, 0x1E,
+  0x41, 0x1F, 0x80, 0x2F, 0x02, 0x20, 0x41, 0x21, 0x90, 0x77, 0x04, 0x22, 0x41, 0x23, 0x00, 0x26,
+  0x81, 0x01, 0x01, 0x41, 0x24, 0x80, 0x03, 0x01, 0x25, 0x41, 0x83, 0x0B, 0x00, 0x27, 0x88, 0x21,
+  0x06, 0x28, 0x41, 0x29, 0x41, 0x2A, 0x41, 0x2B, 0x8A, 0x35, 0x02, 0x2C, 0x41, 0x2D, 0x80, 0x25,
+  0x02, 0x2E, 0x41, 0x2F, 0x90, 0xA1, 0x0C, 0x30, 0x61, 0x31, 0x41, 0x32, 0x61, 0x33, 0x61, 0x34,
+  0x61, 0x35, 0x61, 0x36, 0x84, 0x5B, 0x00, 0x37, 0x84, 0x37, 0x08, 0x38, 0x41, 0x39, 0x01, 0x3A,
+  0x41, 0x3B, 0x41, 0x3C, 0x90, 0x37, 0x06, 0x3D, 0x58, 0x4E, 0x41, 0x3E, 0x41, 0x3F, 0x86, 0x63,
+  0x1C, 0x40, 0x61, 0x41, 0x61, 0x42, 0x61, 0x43, 0x61, 0x44, 0x41, 0x45, 0x61, 0x46, 0x61, 0x47,
+  0x61, 0x48, 0x61, 0x49, 0x61, 0x4A, 0x61, 0x4B, 0x41, 0x4C, 0x41, 0x4D, 0x41, 0x4E, 0x82, 0x21,
+  0x02, 0x4F, 0x41, 0x50, 0x80, 0x5B, 0x02, 0x51, 0x41, 0x52, 0x8F, 0x4D, 0x82, 0x1F, 0x00, 0x53,
+  0x80, 0x1D, 0x0E, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, 0x41, 0x58, 0x41, 0x59, 0x41, 0x5A,
+  0x41, 0x5B, 0x84, 0x6B, 0x02, 0x5C, 0x41, 0x5D, 0x80, 0x05, 0x0E, 0x5E, 0x61, 0x5F, 0x61, 0x60,
+  0x41, 0x61, 0x41, 0x62, 0x41, 0x63, 0x41, 0x64, 0x41, 0x65, 0x82, 0xA9, 0x02, 0x66, 0x41, 0x67,
+  0x93, 0x4D, 0x82, 0x51, 0x02, 0x68, 0x41, 0x69, 0x80, 0x23, 0x04, 0x6A, 0x41, 0x6B, 0x41, 0x6C,
+  0x88, 0xB9, 0x06, 0x6D, 0x61, 0x6E, 0x61, 0x6F, 0x61, 0x70, 0x8C, 0x2B, 0x04, 0x71, 0x41, 0x72,
+  0x41, 0x73, 0x97, 0x4B, 0x84, 0x25, 0x04, 0x74, 0x41, 0x75, 0x41, 0x76, 0x82, 0x09, 0x1A, 0x77,
+  0x41, 0x78, 0x01, 0x79, 0x41, 0x7A, 0x61, 0x7B, 0x61, 0x7C, 0x61, 0x7D, 0x61, 0x7E, 0x61, 0x7F,
+  0x61, 0x80, 0x41, 0x81, 0x61, 0x82, 0x41, 0x83, 0x41, 0x84, 0x9D, 0x45, 0xC7, 0x00,
+};
+
+// ---- Illustrations, id = index + 1 (scene illustration 0 is none) ----
+const u16 ILLUSTRATION_COUNT = 4;
+const Illustration ILLUSTRATIONS[] = {
+  { 898, 4, ILLUSTRATION_TILES_skel_a, ILLUSTRATION_MAP_skel_a, ILLUSTRATION_PALETTES_skel_a },  // 1: skel_a
+  { 826, 4, ILLUSTRATION_TILES_skel_b, ILLUSTRATION_MAP_skel_b, ILLUSTRATION_PALETTES_skel_b },  // 2: skel_b
+  { 829, 4, ILLUSTRATION_TILES_skel_c, ILLUSTRATION_MAP_skel_c, ILLUSTRATION_PALETTES_skel_c },  // 3: skel_c
+  { 389, 4, ILLUSTRATION_TILES_gbgg_skel, ILLUSTRATION_MAP_gbgg_skel, ILLUSTRATION_PALETTES_gbgg_skel },  // 4: gbgg_skel
+};
@@ -0,0 +1,48 @@
+#include "lz_stream.h"
+
+void lzStreamInit(LzStream* s, const u8* src) {
+    s->left = (src[0] << 8) | src[1];
+    s->src = src + 2;
+    s->run = 0;
+    s->match = FALSE;
+    s->pos = 0;
+}
+
+// Unpacks up to max bytes, returns how many. 0 once the stream is done.
+u16 lzStreamRead(LzStream* s, u8* dst, u16 max) {
+    u16 count = min(max, s->left);
+    
+    for(u16 i = 0; i < count; i++) {
+        if(!s->run) {
+            u8 token = *s->src++;
+            s->match = (token & 0x80) != 0;
+            if(s->match) {
+                s->run = (token & 0x7F) + 3;
+                s->distance = *s->src++;
+            } else {
+                s->run = token + 1;
+            }
+        }
+        
+        u8 b = s->match ? s->window[(u8) (s->pos - s->distance - 1)] : *s->src++;
+        s->window[s->pos++] = b;
+        dst[i] = b;
+        s->run--;
+    }
+    
+    s->left -= count;
+    return count;
+}
+
+// The packed data is in 68000 byte order, only host builds swap it
+void lzToNativeOrder(u8* data, u16 bytes, u16 width) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for(u16 i = 0; i < bytes; i += width) {
+        for(u16 a = i, b = i + width - 1; a < b; a++, b--) {
+            u8 t = data[a];
+            data[a] = data[b];
+            data[b] = t;
+        }
+    }
+#endif
+}
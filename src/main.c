@@ -4,8 +4,21 @@
 #include "data_load.h"
 #include "scene_manager.h"
 #include "quiz_manager.h"
-
-#define TO_INT(x)  ((x) >> 8)
+#include "game_timer.h"
+#include "text_box.h"
+#include "fade.h"
+#include "palette.h"
+#include "color_cycle.h"
+#include "scroll_fx.h"
+#include "sprite_engine.h"
+#include "bank.h"
+#include "hud.h"
+#include "illustration.h"
+#include "unpack_queue.h"
+#include "task.h"
+#include "warp_menu.h"
+#include "telemetry.h"
+#include "font_data.h"
 
 // Game state machine
 typedef enum {
@@ -24,116 +37,282 @@ typedef enum {
     GREEN_BG = 3
 } BgState;
 
+#define QUIZ_SCROLL_FX  SCROLLFX_WAVE
+#define QUIZ_GLOW_FIRST 5       // Magenta ramp of the skull tiles
+#define QUIZ_GLOW_COUNT 3
+#define QUIZ_GLOW_TICKS 8
+#define QUIZ_BG_CYCLES  24      // Per plane cell, for the task budget
+#define NEXT_SCENES     2       // Followers whose palettes are loaded ahead
+#define SCENE_PALETTES  (2 + NEXT_SCENES * 2)
+
 static GameState g_currentState = STATE_TITLE;
+static GameState g_pendingState = STATE_TITLE;
+static bool g_transitioning = FALSE;  // Fading out towards g_pendingState
 static u16 g_lastJoy = 0;
 static u16 g_baseTile = 0;
 
-static s16 g_scrollX = 0;
-static s16 g_scrollY = 0;
 static NextScene g_nextScenePath = SCENE_A;  // Track which path to take
-static s16 g_scrollSpeedX = FIX16(2.1);
-static s16 g_scrollSpeedY = FIX16(2.1);
+static const u8* g_sceneTrack = NULL;   // Track started by the scene script
+static u8 g_sceneSprite = 0;            // Animation shown by the scene script
+static u8 g_illustration = 0;           // Illustration on plane B, 0 none
+static u8 g_drawnBg = 0;                // Scene background on plane B, 0 none
+static const u16* g_scenePalettes[SCENE_PALETTES];     // Acquired for the scene script
+static u16 g_scenePaletteCount = 0;
+static u32 g_scenePaletteKey = 0xFFFFFFFF;  // Scene, background and sprite they were picked for
+static const u16* g_statePalette = NULL;    // Acquired for the quiz screen
+#if DEBUG
+static bool g_warpMenuOpen = FALSE;
+static bool g_warpQuiz = FALSE;         // Quiz reached by a warp, back to the title after
+#endif
 
 // Forward declarations
+static void updateState();
+static void changeState(GameState next);
+static void enterState(GameState state);
 static void handleTitleState();
 static void handleSceneState();
 static void handleCategorySelectState();
 static void handleQuizState();
 static void handleEndingState();
 static void drawTitle();
-static void drawQuizBackground();
+static NO_INLINE void drawQuizBackground(const void* data, u16 from, u16 to);  // Out of line for the benchmark runner
 static void drawSceneBackground();
 static void drawSceneBackgroundId(u8 inId, u16 x, u16 y, u16 palette);
-static void scrollBackground();
 static void drawEnding(bool isGood);
+static void updateSceneMusic();
+static void showSprite(u8 anim);
+static void showIllustration(u8 id);
+static void loadBackgrounds();
+static void updateScenePalettes();
+static void acquireScenePalette(const u16* colors);
+static void releaseScenePalettes();
+static const u16* getBgPalette(u8 id);
+static const u16* getSpritePalette(u8 anim);
+#if DEBUG
+static void handleWarpMenu(u16 pressed);
+#endif
 
 int main() {
     // Initialize hardware
+    bankInit(dataFarEnd());
     JOY_init();
+    telemetryInit();
     VDP_setBackgroundColor(0);
     
     PAL_setColor(0,RGB24_TO_VDPCOLOR(0x000000));
 
-    PAL_setPalette(PAL1, skullBgTile.palette->data, DMA);
-    PAL_setPalette(PAL3, redBg.palette->data, DMA);
-    PAL_setPalette(PAL2, greenBg.palette->data, DMA);
-    
-
+    fadeInit();
+    paletteInit();
+    colorCycleInit();
     g_baseTile = TILE_USER_INDEX;
-    VDP_loadTileSet(skullBgTile.tileset, g_baseTile, DMA);
-    VDP_loadTileSet(redBg.tileset, g_baseTile + 100, DMA);
-    VDP_loadTileSet(greenBg.tileset, g_baseTile + 200, DMA);
+    loadBackgrounds();
     
     initCustomFont();
+    textBoxInit();
+    spriteEngineInit();
     
     VDP_clearPlane(BG_A, TRUE);
     VDP_clearPlane(BG_B, TRUE);
 
     XGM_setLoopNumber(-1);
+    timerInit();
     // Initialize game systems
+    dataSetLanguage(0);
     sceneManagerInit();
     quizManagerInit();
     
     // Start at title
     drawTitle();
     
-    // Main game loop
+    // Main game loop: fixed logic ticks, one render per vblank
     while(1) {
-        switch(g_currentState) {
-            case STATE_TITLE:
-                XGM_startPlay(&bgMusic_01);
-                handleTitleState();
-                break;
-                
-            case STATE_SCENE:
-                handleSceneState();
-                break;
-                
-            case STATE_CATEGORY_SELECT:
-                XGM_pausePlay();
-                handleCategorySelectState();
-                break;
-                
-            case STATE_QUIZ:
-                handleQuizState();
-                break;
-                
-            case STATE_BAD_ENDING:
-                XGM_pausePlay();
-                handleEndingState();
-                break;
-                
-            case STATE_GOOD_ENDING:
-                XGM_pausePlay();
-                handleEndingState();
-                break;
+        u16 ticks = timerBeginFrame();
+        while(ticks--) {
+            updateState();
+            scrollFxUpdate();
+            spriteEngineUpdate();
+            colorCycleUpdate();
+            fadeUpdate();
         }
+        unpackQueueUpdate();
+        illustrationUpdate();
+        taskUpdate();
+        telemetryFlush();
+        colorCycleFlush();
+        scrollFxApply();
+        spriteEngineFlush();
+        textBoxFlush();
         SYS_doVBlankProcess();
-        scrollBackground();
     }
     
     return 0;
 }
 
+static void updateState() {
+    if(g_transitioning) {
+        // Screen is black, set up the next state out of view
+        if(!fadeIsActive()) {
+            g_transitioning = FALSE;
+            g_currentState = g_pendingState;
+            enterState(g_currentState);
+            fadeIn();
+        }
+        return;
+    }
+    
+    switch(g_currentState) {
+        case STATE_TITLE:
+            XGM_startPlay(&bgMusic_01);
+            handleTitleState();
+            break;
+            
+        case STATE_SCENE:
+            handleSceneState();
+            break;
+            
+        case STATE_CATEGORY_SELECT:
+            XGM_pausePlay();
+            handleCategorySelectState();
+            break;
+            
+        case STATE_QUIZ:
+            handleQuizState();
+            break;
+            
+        case STATE_BAD_ENDING:
+            XGM_pausePlay();
+            handleEndingState();
+            break;
+            
+        case STATE_GOOD_ENDING:
+            XGM_pausePlay();
+            handleEndingState();
+            break;
+    }
+}
+
+// Fade out, the new state is entered once the screen is black
+static void changeState(GameState next) {
+    g_pendingState = next;
+    g_transitioning = TRUE;
+    fadeOut();
+}
+
+// Screen setup of a state, runs while faded out
+static void enterState(GameState state) {
+    taskCancel();   // Whatever the last screen had left to draw
+    VDP_clearPlane(BG_A, TRUE);
+    VDP_clearPlane(BG_B, TRUE);
+    hudHide();  // The quiz and scene screens show it again
+    g_drawnBg = 0;
+    showIllustration((state == STATE_SCENE) ? sceneManagerGetCurrentIllustrationId() : 0);
+    // Nothing to keep running behind the black screen, unpack it all now
+    unpackQueueFinish();
+    illustrationUpdate();
+    scrollFxSetMode((state == STATE_QUIZ) ? QUIZ_SCROLL_FX : SCROLLFX_NONE, FALSE);
+    
+    // Palettes of the last screen go back to the pool, kept ones don't move
+    colorCycleClear();
+    releaseScenePalettes();
+    paletteRelease(g_statePalette);
+    g_statePalette = (state == STATE_QUIZ) ? skullBgTile.palette->data : NULL;
+    paletteAcquire(g_statePalette);
+    if(state == STATE_QUIZ) colorCycleStart(g_statePalette, QUIZ_GLOW_FIRST, QUIZ_GLOW_COUNT, QUIZ_GLOW_TICKS);
+    if(state == STATE_SCENE) updateScenePalettes();
+    showSprite((state == STATE_SCENE) ? sceneManagerGetCurrentSpriteId() : 0);
+    
+    switch(state) {
+        case STATE_TITLE:
+            drawTitle();
+            break;
+            
+        case STATE_SCENE:
+            sceneManagerDraw();
+            break;
+            
+        case STATE_CATEGORY_SELECT:
+            quizManagerDrawCategorySelect();
+            break;
+            
+        case STATE_QUIZ:
+            XGM_startPlay(&quizMusic_01);
+            g_sceneTrack = quizMusic_01;
+            taskStart(drawQuizBackground, NULL, 64 * PLANE_ROWS, QUIZ_BG_CYCLES);
+            quizManagerDraw();
+            break;
+            
+        case STATE_BAD_ENDING:
+        case STATE_GOOD_ENDING:
+            drawEnding(state == STATE_GOOD_ENDING);
+            break;
+    }
+}
+
 static void handleTitleState() {
     u16 joy = JOY_readJoypad(JOY_1);
     
+#if DEBUG
+    if(g_warpMenuOpen) {
+        handleWarpMenu(joy & ~g_lastJoy);
+        g_lastJoy = joy;
+        return;
+    }
+    if((joy & BUTTON_C) && !(g_lastJoy & BUTTON_C)) {
+        g_warpMenuOpen = TRUE;
+        warpMenuOpen();
+    }
+#endif
     if((joy & BUTTON_START) && !(g_lastJoy & BUTTON_START)) {
-        g_currentState = STATE_SCENE;
         g_nextScenePath = SCENE_A;  // Start on normal path
+        g_sceneTrack = bgMusic_01;  // Already playing on the title
         sceneManagerReset();
         sceneManagerStart();
-        VDP_clearPlane(BG_A, TRUE);
-        VDP_clearPlane(BG_B, TRUE);
-        sceneManagerDraw();
+        changeState(STATE_SCENE);
     }
     
     g_lastJoy = joy;
 }
 
+#if DEBUG
+// Title screen warp to a scene or quiz by name, see warp_menu.h
+static void handleWarpMenu(u16 pressed) {
+    u16 index;
+    WarpKind kind = warpMenuUpdate(pressed, &index);
+    if(kind == WARP_NONE) return;
+    
+    g_warpMenuOpen = FALSE;
+    g_warpQuiz = (kind == WARP_QUIZ || kind == WARP_QUESTION);
+    g_nextScenePath = SCENE_A;
+    g_sceneTrack = bgMusic_01;
+    sceneManagerReset();
+    switch(kind) {
+        case WARP_SCENE:
+            sceneManagerStartAt(index);
+            changeState(STATE_SCENE);
+            break;
+        case WARP_QUIZ:
+            quizManagerStartQuiz(index);
+            changeState(STATE_CATEGORY_SELECT);
+            break;
+        case WARP_QUESTION:
+            quizManagerStartSingleQuestion(index);
+            changeState(STATE_QUIZ);
+            break;
+        default:
+            drawTitle();
+            break;
+    }
+}
+#endif
+
 static void handleSceneState() {
-    // FIX: Pass the current path to scene manager
-    sceneManagerUpdate(&g_lastJoy, g_nextScenePath);
+    sceneManagerUpdate(&g_lastJoy);
+    updateSceneMusic();
+    updateScenePalettes();
+    if(sceneManagerGetCurrentIllustrationId() != g_illustration) {
+        showIllustration(sceneManagerGetCurrentIllustrationId());
+    }
+    showSprite(sceneManagerGetCurrentSpriteId());
     
     // Check if we need to trigger a quiz
     if(sceneManagerShouldTriggerQuiz()) {
@@ -143,69 +322,52 @@ static void handleSceneState() {
         // Single question mode?
         if(sceneManagerGetQuestionId(&questionId)) {
             quizManagerStartSingleQuestion(questionId);
-            g_currentState = STATE_QUIZ;
-            VDP_clearPlane(BG_A, TRUE);
-            VDP_clearPlane(BG_B, TRUE);
-            XGM_startPlay(&quizMusic_01);
-            drawQuizBackground();
-            quizManagerDraw();
+            changeState(STATE_QUIZ);
         }
         // Full quiz mode?
         else if(sceneManagerGetTriggeredQuiz(&quizId)) {
             quizManagerStartQuiz(quizId);
-            g_currentState = STATE_CATEGORY_SELECT;
-            VDP_clearPlane(BG_A, TRUE);
-            VDP_clearPlane(BG_B, TRUE);
-            quizManagerDrawCategorySelect();
+            changeState(STATE_CATEGORY_SELECT);
         }
     }
     else if(sceneManagerReachedEnd()) {
         SceneType endType = sceneManagerGetEndingType();
-        g_currentState = (endType == SCENE_TYPE_GOOD_ENDING) ? 
-                         STATE_GOOD_ENDING : STATE_BAD_ENDING;
-        VDP_clearPlane(BG_A, TRUE);
-        VDP_clearPlane(BG_B, TRUE);
-        drawEnding(endType == SCENE_TYPE_GOOD_ENDING);
+        changeState((endType == SCENE_TYPE_GOOD_ENDING) ? 
+                    STATE_GOOD_ENDING : STATE_BAD_ENDING);
     }
-    else{
+    else if(!g_illustration){
         drawSceneBackground();
     }
 }
 
 static void handleCategorySelectState() {
     if(quizManagerUpdateCategorySelect(&g_lastJoy)) {
-        g_currentState = STATE_QUIZ;
-        VDP_clearPlane(BG_A, TRUE);
-        VDP_clearPlane(BG_B, TRUE);
-        XGM_startPlay(&quizMusic_01);
-        drawQuizBackground();
-        quizManagerDraw();
+        changeState(STATE_QUIZ);
     }
 }
 
 static void handleQuizState() {
     QuizResult result = quizManagerUpdate(&g_lastJoy);
 
+#if DEBUG
+    // A warped quiz has no scene to go back to
+    if(g_warpQuiz && result != QUIZ_IN_PROGRESS) {
+        g_warpQuiz = FALSE;
+        changeState(STATE_TITLE);
+        return;
+    }
+#endif
     switch(result) {
         case QUIZ_FAILED:
-            XGM_pausePlay();
             g_nextScenePath = SCENE_B;
             sceneManagerContinueAfterQuiz(g_nextScenePath);
-            g_currentState = STATE_SCENE;
-            VDP_clearPlane(BG_A, TRUE);
-            VDP_clearPlane(BG_B, TRUE);
-            XGM_startPlay(&bgMusic_01);
-            sceneManagerDraw();
+            changeState(STATE_SCENE);
             break;
             
         case QUIZ_PASSED:
             g_nextScenePath = SCENE_A;
             sceneManagerContinueAfterQuiz(g_nextScenePath);
-            g_currentState = STATE_SCENE;
-            VDP_clearPlane(BG_A, TRUE);
-            VDP_clearPlane(BG_B, TRUE);
-            XGM_startPlay(&bgMusic_01);
-            sceneManagerDraw();
+            changeState(STATE_SCENE);
             break;
             
         case QUIZ_IN_PROGRESS:
@@ -218,17 +380,133 @@ static void handleEndingState() {
     u16 joy = JOY_readJoypad(JOY_1);
     
     if((joy & BUTTON_START) && !(g_lastJoy & BUTTON_START)) {
-        g_currentState = STATE_TITLE;
         g_nextScenePath = SCENE_A;  // Reset path
         sceneManagerReset();
-        VDP_clearPlane(BG_A, TRUE);
-        VDP_clearPlane(BG_B, TRUE);
-        drawTitle();
+        changeState(STATE_TITLE);
     }
     
     g_lastJoy = joy;
 }
 
+// Music ids used by the scene script: 0 = silence, 1 = theme, 2 = demon
+static void updateSceneMusic() {
+    const u8* track;
+    
+    switch(sceneManagerGetCurrentMusicId()) {
+        case 0:
+            track = NULL;
+            break;
+        case 2:  // No dedicated demon track yet
+        case 1:
+        default:
+            track = bgMusic_01;
+            break;
+    }
+    
+    if(track == g_sceneTrack) return;
+    
+    g_sceneTrack = track;
+    if(track) XGM_startPlay(track);
+    else XGM_pausePlay();
+}
+
+// Illustrations unpack over the sprite tiles, the animation comes back
+// with its tiles once the picture is gone
+static void showSprite(u8 anim) {
+    if(g_illustration) anim = 0;
+    if(anim == g_sceneSprite) return;
+    
+    g_sceneSprite = anim;
+    spriteEngineShow(anim);
+}
+
+// Illustrations take over the background and sprite tiles and the
+// palettes, they come back when the scene drops it. Also redraws after plane B was cleared.
+static void showIllustration(u8 id) {
+    g_drawnBg = 0;
+    if(id) {
+        g_illustration = id;
+        illustrationShow(id);
+    } else if(g_illustration) {
+        g_illustration = 0;
+        illustrationCancel();
+        VDP_clearPlane(BG_B, TRUE);
+        paletteReserve(0);
+        loadBackgrounds();
+        fadeSetPalette(PAL0, FONT_PALETTE);
+    }
+}
+
+// Background tilesets, at boot and after an illustration
+static void loadBackgrounds() {
+    VDP_loadTileSet(skullBgTile.tileset, g_baseTile, DMA);
+    VDP_loadTileSet(redBg.tileset, g_baseTile + 100, DMA);
+    VDP_loadTileSet(greenBg.tileset, g_baseTile + 200, DMA);
+}
+
+// Background and sprite palettes of the scene on screen, then those of the
+// scenes it can go to while slots are left so their colors are already up
+static void updateScenePalettes() {
+    s16 scene = sceneManagerGetCurrentScene();
+    u8 bg = sceneManagerGetCurrentBGId();
+    // Backgrounds that draw nothing leave the last one up, in its colors
+    if(!getBgPalette(bg)) bg = g_drawnBg;
+    u8 sprite = sceneManagerGetCurrentSpriteId();
+    u32 key = ((u32)(u16) scene << 16) | (bg << 8) | sprite;
+    if(key == g_scenePaletteKey) return;
+    
+    const u16* wanted[SCENE_PALETTES];
+    u16 count = 0;
+    u16 next[NEXT_SCENES];
+    u16 nextCount = sceneManagerGetNextScenes(next, NEXT_SCENES);
+    wanted[count++] = getBgPalette(bg);
+    wanted[count++] = getSpritePalette(sprite);
+    for(u16 i = 0; i < nextCount; i++) {
+        u8 nextBg, nextSprite;
+        sceneManagerGetSceneLook(next[i], &nextBg, &nextSprite);
+        wanted[count++] = getBgPalette(nextBg);
+        wanted[count++] = getSpritePalette(nextSprite);
+    }
+    
+    // Released palettes keep their slots until acquired again
+    releaseScenePalettes();
+    g_scenePaletteKey = key;
+    acquireScenePalette(wanted[0]);
+    acquireScenePalette(wanted[1]);
+    // Followers already in a slot first, so the others don't push them out
+    for(u16 i = 2; i < count; i++) {
+        if(paletteSlot(wanted[i]) != PALETTE_NONE) acquireScenePalette(wanted[i]);
+    }
+    for(u16 i = 2; i < count; i++) {
+        if(paletteSlot(wanted[i]) == PALETTE_NONE) acquireScenePalette(wanted[i]);
+    }
+}
+
+static void acquireScenePalette(const u16* colors) {
+    if(paletteAcquire(colors) != PALETTE_NONE) g_scenePalettes[g_scenePaletteCount++] = colors;
+}
+
+static void releaseScenePalettes() {
+    while(g_scenePaletteCount) paletteRelease(g_scenePalettes[--g_scenePaletteCount]);
+    g_scenePaletteKey = 0xFFFFFFFF;
+}
+
+// Palette each scene background is drawn with, NULL when it draws nothing
+static const u16* getBgPalette(u8 id) {
+    switch(id) {
+        case 2:
+            return greenBg.palette->data;
+        case 3:
+            return redBg.palette->data;
+        default:
+            return NULL;
+    }
+}
+
+static const u16* getSpritePalette(u8 anim) {
+    return (anim && anim <= SPRITE_ANIM_COUNT) ? SPRITE_ANIMS[anim - 1].palette : NULL;
+}
+
 static void drawTitle() {
     VDP_clearPlane(BG_A, TRUE);
     C_DrawText("Knowing", 14, 6, PAL0);
@@ -244,26 +522,40 @@ static void drawEnding(bool isGood) {
     C_DrawText("Press Start", 10, 18, PAL0);
 }
 
-static void drawQuizBackground(){
-    for(u16 planeY = 0; planeY < 64; planeY++) {
-        for(u16 planeX = 0; planeX < 64; planeX++) {
-            u16 patternX = planeX % 8;
-            u16 patternY = planeY % 8;
+// Task step over the plane B cells, a row piece per write
+static NO_INLINE void drawQuizBackground(const void* data, u16 from, u16 to){
+    u16 row[64];
+    u16 palette = paletteSlot(skullBgTile.palette->data);
+    if(palette == PALETTE_NONE) return;
+    
+    while(from < to) {
+        u16 planeY = from / 64;
+        u16 planeX = from % 64;
+        u16 count = min(64 - planeX, to - from);
+        u16 patternY = planeY % 8;
+        
+        for(u16 i = 0; i < count; i++) {
+            u16 patternX = (planeX + i) % 8;
             u16 tileIdx = g_baseTile + (patternY * 8) + patternX;
-            
-            VDP_setTileMapXY(BG_B, TILE_ATTR_FULL(PAL1, 0, 0, 0, tileIdx),
-                            planeX, planeY);
+            row[i] = TILE_ATTR_FULL(palette, 0, 0, 0, tileIdx);
         }
+        VDP_setTileMapDataRow(BG_B, row, planeY, planeX, count, CPU);
+        from += count;
     }
 }
 
 static void drawSceneBackground(){
-    switch (sceneManagerGetCurrentBGId()) {
+    u8 id = sceneManagerGetCurrentBGId();
+    u16 palette = paletteSlot(getBgPalette(id));
+    if(palette == PALETTE_NONE) return;
+    
+    g_drawnBg = id;
+    switch (id) {
         case 2:
-            drawSceneBackgroundId(100, 8, 8, PAL2);
+            drawSceneBackgroundId(100, 8, 8, palette);
             break;
         case 3:
-            drawSceneBackgroundId(300, 8, 8, PAL3);
+            drawSceneBackgroundId(300, 8, 8, palette);
             break;
         case 1:
         case 0:
@@ -285,14 +577,3 @@ static void drawSceneBackgroundId(u8 inId, u16 x, u16 y, u16 palette)
         VDP_setTileMapXY(BG_B, TILE_ATTR_FULL(palette, 0, 0, 0, bottomRightTile), x + 1, y + 1);
 }
 
-
-static void scrollBackground()
-{
-    if (g_currentState == STATE_QUIZ)
-    {
-        g_scrollX += g_scrollSpeedX;
-        g_scrollY += g_scrollSpeedY;
-        VDP_setHorizontalScrollVSync(BG_B, -TO_INT(g_scrollX));
-        VDP_setVerticalScrollVSync(BG_B, TO_INT(g_scrollY));
-    }
-}
@@ -0,0 +1,122 @@
+#include "palette.h"
+#include "fade.h"
+
+#define SLOT_FREE       -1
+#define SLOT_RESERVED   -2
+
+typedef struct {
+    const u16* colors;      // NULL for an unused entry
+    u16 refs;
+    u16 slot;               // PALETTE_NONE while it has none
+} PaletteEntry;
+
+static PaletteEntry g_entries[PALETTE_ENTRIES];
+static s16 g_owner[PALETTE_SLOTS];     // Entry in each slot
+
+// Forward declarations
+static s16 findEntry(const u16* colors);
+static s16 newEntry(const u16* colors);
+static void dropEntry(u16 e);
+static void place(u16 e);
+
+void paletteInit() {
+    memset(g_entries, 0, sizeof(g_entries));
+    for(u16 e = 0; e < PALETTE_ENTRIES; e++) g_entries[e].slot = PALETTE_NONE;
+    for(u16 slot = 0; slot < PALETTE_SLOTS; slot++) g_owner[slot] = SLOT_FREE;
+    g_owner[PAL0] = SLOT_RESERVED;
+}
+
+u16 paletteAcquire(const u16* colors) {
+    if(!colors) return PALETTE_NONE;
+    
+    s16 e = findEntry(colors);
+    if(e < 0) e = newEntry(colors);
+    if(e < 0) return PALETTE_NONE;
+    
+    if(g_entries[e].slot == PALETTE_NONE) place(e);
+    if(g_entries[e].slot != PALETTE_NONE) g_entries[e].refs++;
+    return g_entries[e].slot;
+}
+
+void paletteRelease(const u16* colors) {
+    s16 e = findEntry(colors);
+    if(e >= 0 && g_entries[e].refs) g_entries[e].refs--;
+}
+
+u16 paletteSlot(const u16* colors) {
+    s16 e = findEntry(colors);
+    return (e < 0) ? PALETTE_NONE : g_entries[e].slot;
+}
+
+// Palettes in the reserved slots move out, the ones still referenced come
+// back in whatever slots are free once the reservation shrinks
+void paletteReserve(u16 count) {
+    for(u16 slot = PAL1; slot < PALETTE_SLOTS; slot++) {
+        if(slot < count) {
+            s16 e = g_owner[slot];
+            if(e >= 0) {
+                g_entries[e].slot = PALETTE_NONE;
+                if(!g_entries[e].refs) dropEntry(e);
+            }
+            g_owner[slot] = SLOT_RESERVED;
+        } else if(g_owner[slot] == SLOT_RESERVED) {
+            g_owner[slot] = SLOT_FREE;
+        }
+    }
+    
+    for(u16 e = 0; e < PALETTE_ENTRIES; e++) {
+        if(g_entries[e].refs && g_entries[e].slot == PALETTE_NONE) place(e);
+    }
+}
+
+static s16 findEntry(const u16* colors) {
+    if(!colors) return -1;
+    for(u16 e = 0; e < PALETTE_ENTRIES; e++) {
+        if(g_entries[e].colors == colors) return e;
+    }
+    return -1;
+}
+
+// An unused entry, or the one of a released palette
+static s16 newEntry(const u16* colors) {
+    s16 found = -1;
+    for(u16 e = 0; e < PALETTE_ENTRIES; e++) {
+        if(!g_entries[e].colors) {
+            found = e;
+            break;
+        }
+        if(found < 0 && !g_entries[e].refs) found = e;
+    }
+    if(found < 0) return -1;
+    
+    dropEntry(found);
+    g_entries[found].colors = colors;
+    return found;
+}
+
+static void dropEntry(u16 e) {
+    PaletteEntry* entry = &g_entries[e];
+    if(entry->colors && entry->slot != PALETTE_NONE) g_owner[entry->slot] = SLOT_FREE;
+    entry->colors = NULL;
+    entry->refs = 0;
+    entry->slot = PALETTE_NONE;
+}
+
+// A free slot first, then the slot of a released palette
+static void place(u16 e) {
+    s16 target = -1;
+    for(u16 slot = PAL1; slot < PALETTE_SLOTS; slot++) {
+        s16 owner = g_owner[slot];
+        if(owner == SLOT_FREE) {
+            target = slot;
+            break;
+        }
+        if(target < 0 && owner >= 0 && !g_entries[owner].refs) target = slot;
+    }
+    if(target < 0) return;
+    
+    if(g_owner[target] >= 0) g_entries[g_owner[target]].slot = PALETTE_NONE;
+    g_owner[target] = e;
+    g_entries[e].slot = target;
+    fadeSetPalette(target, g_entries[e].colors);
+}
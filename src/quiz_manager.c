@@ -1,6 +1,8 @@
 #include <genesis.h>
 #include "functions.h"
 #include "quiz_manager.h"
+#include "hud.h"
+#include "telemetry.h"
 
 // Quiz state
 static const Quiz* g_currentQuiz = NULL;
@@ -11,6 +13,8 @@ static const Question* g_questionList[20];  // Questions for current quiz
 static u16 g_totalQuestions = 0;
 static bool g_categorySelected = FALSE;
 static bool g_singleQuestionMode = FALSE;
+static u32 g_quizStart = 0;             // vtimer at the start, for telemetry
+static u32 g_questionStart = 0;
 
 void quizManagerInit() {
     g_currentQuiz = NULL;
@@ -26,6 +30,7 @@ void quizManagerStartQuiz(u16 quizId) {
     if(quizId >= QUIZZES_COUNT) return;
     
     g_currentQuiz = &QUIZZES[quizId];
+    g_quizStart = vtimer;
     g_currentQuestionIndex = 0;
     g_wrongAnswerCount = 0;
     g_categorySelected = FALSE;
@@ -36,6 +41,7 @@ void quizManagerStartSingleQuestion(u16 questionId) {
     if(questionId >= QUESTIONS_COUNT) return;
     
     g_singleQuestionMode = TRUE;
+    g_quizStart = vtimer;
     g_categorySelected = TRUE;
     g_currentQuestionIndex = 0;
     g_wrongAnswerCount = 0;
@@ -113,39 +119,58 @@ bool quizManagerUpdateCategorySelect(u16* lastJoy) {
     return FALSE;
 }
 
-void quizManagerDraw() {
-    if(g_currentQuestionIndex >= g_totalQuestions) return;
-    
-    VDP_clearPlane(BG_A, TRUE);
-    
-    const Question* q = g_questionList[g_currentQuestionIndex];  // FIX: Use question list!
-    
-    // Draw stats (only in full quiz mode)
+// Question screen regions, drawn in full once per screen and then only
+// where the text changes. Progress and wrong count are on the HUD.
+#define QUESTION_X      2
+#define QUESTION_Y      6
+#define ANSWER_X        4
+#define ANSWER_Y        12
+
+static TextRegion g_questionRegion;
+static TextRegion g_answerRegions[3];
+
+// Static labels of the question screen, plane A is clear
+static void drawQuizLayout() {
     if(!g_singleQuestionMode && g_currentQuiz) {
-        char buf[64];
-        sprintf(buf, "Q%d/%d  Wrong:%d/%d", 
-                g_currentQuestionIndex + 1, 
-                g_currentQuiz->questionCount,
-                g_wrongAnswerCount, 
-                g_currentQuiz->wrongLimit);
-        C_DrawText(buf, 2, 0, PAL0);
+        hudShow(HUD_ROWS);
     } else {
         C_DrawText("Answer the riddle:", 10, 0, PAL0);
     }
     
-    // Draw question text
-    C_DrawText(q->question, 2, 6, PAL0);
+    C_InitRegion(&g_questionRegion, BG_A, QUESTION_X, QUESTION_Y, 64 - QUESTION_X, PAL0);
+    for(u16 i = 0; i < 3; i++) {
+        char label[4] = { 'A' + i, ':', ' ', 0 };
+        C_DrawText(label, ANSWER_X, ANSWER_Y + i * 2, PAL0);
+        C_InitRegion(&g_answerRegions[i], BG_A, ANSWER_X + 3, ANSWER_Y + i * 2, 64 - ANSWER_X - 3, PAL0);
+    }
+}
+
+static void drawQuestion() {
+    const Question* q = g_questionList[g_currentQuestionIndex];  // FIX: Use question list!
+    g_questionStart = vtimer;
     
-    // Draw answer choices
-    char buf[80];
-    sprintf(buf, "A: %s", q->answerA);
-    C_DrawText(buf, 4, 12, PAL0);
+    if(!g_singleQuestionMode && g_currentQuiz) {
+        hudSetProgress(g_currentQuestionIndex + 1, g_currentQuiz->questionCount);
+        hudSetWrong(g_wrongAnswerCount, g_currentQuiz->wrongLimit);
+    }
     
-    sprintf(buf, "B: %s", q->answerB);
-    C_DrawText(buf, 4, 14, PAL0);
+    C_SetRegionText(&g_questionRegion, dataGetQuestionText(q->id));
+    for(u16 i = 0; i < 3; i++) {
+        C_SetRegionText(&g_answerRegions[i], dataGetAnswerText(q->id, i));
+    }
+}
+
+void quizManagerDraw() {
+    if(g_currentQuestionIndex >= g_totalQuestions) return;
     
-    sprintf(buf, "C: %s", q->answerC);
-    C_DrawText(buf, 4, 16, PAL0);
+    VDP_clearPlane(BG_A, TRUE);
+    drawQuizLayout();
+    drawQuestion();
+}
+
+static void endQuiz(bool passed) {
+    u32 frames = vtimer - g_quizStart;
+    telemetryQuiz(g_singleQuestionMode ? TELEMETRY_NO_QUIZ : g_currentQuiz->id, passed, min(frames, 0xFFFF), g_wrongAnswerCount);
 }
 
 QuizResult quizManagerUpdate(u16* lastJoy) {
@@ -171,6 +196,9 @@ QuizResult quizManagerUpdate(u16* lastJoy) {
     
     // If an answer was given
     if(answerIdx != 255) {
+        u32 latency = vtimer - g_questionStart;
+        telemetryAnswer(q->id, answerIdx, answerIdx == q->correct, min(latency, 0xFFFF));
+        
         // Check if correct
         if(answerIdx != q->correct) {
             g_wrongAnswerCount++;
@@ -178,6 +206,7 @@ QuizResult quizManagerUpdate(u16* lastJoy) {
             // Check fail condition
             u8 limit = g_singleQuestionMode ? 1 : g_currentQuiz->wrongLimit;
             if(g_wrongAnswerCount >= limit) {
+                endQuiz(FALSE);
                 *lastJoy = joy;
                 return QUIZ_FAILED;
             }
@@ -189,12 +218,13 @@ QuizResult quizManagerUpdate(u16* lastJoy) {
         // Check if quiz complete
         u16 totalNeeded = g_singleQuestionMode ? 1 : g_currentQuiz->questionCount;
         if(g_currentQuestionIndex >= totalNeeded) {
+            endQuiz(TRUE);
             *lastJoy = joy;
             return QUIZ_PASSED;
         }
         
-        // Draw next question
-        quizManagerDraw();
+        // Draw next question, only what changed
+        drawQuestion();
     }
     
     *lastJoy = joy;
@@ -1,37 +1,117 @@
 #include <genesis.h>
 #include "functions.h"
+#include "text_box.h"
+#include "hud.h"
+#include "backlog.h"
+#include "task.h"
+#include "telemetry.h"
 #include "scene_manager.h"
 
-static const Scene* g_currentScene = NULL;
-static bool g_waitingForInput = FALSE;
+// Script interpreter state
+typedef enum {
+    VM_HALTED,
+    VM_RUNNING,
+    VM_TYPING,
+    VM_WAIT_INPUT,
+    VM_WAIT_FRAMES,
+    VM_WAIT_QUIZ,
+    VM_CHOICE
+} VMState;
+
+static VMState g_vmState = VM_HALTED;
+static u16 g_pc = 0;
+static u16 g_waitFrames = 0;
+static u8 g_flags[32];              // 256 script flags
+static u8 g_currentBg = 0;
+static u8 g_currentMusic = 0;
+static u8 g_currentSprite = 0;
+static u8 g_currentIllustration = 0;
+
+static s16 g_pendingQuestion = -1;
+static s16 g_pendingQuiz = -1;
 static bool g_shouldTriggerQuiz = FALSE;
 static bool g_reachedEnd = FALSE;
+static SceneType g_endingType = SCENE_TYPE_BAD_ENDING;
 
 // Typewriter effect state
+static const char* g_text = NULL;
+static u16 g_textLen = 0;
 static u16 g_textCharIndex = 0;
 static u16 g_textTimer = 0;
 static u16 g_lastDrawnIndex = 0;  // Track what we've already drawn
-#define TEXT_DELAY 1  // Frames between characters (lower = faster)
+#define TEXT_DELAY 1  // Logic ticks between characters (lower = faster)
 
-void sceneManagerInit() {
-    g_currentScene = NULL;
-    g_waitingForInput = FALSE;
-    g_shouldTriggerQuiz = FALSE;
-    g_reachedEnd = FALSE;
+// On the window above the text box, which scrolls with plane A
+static TextRegion g_prompt;
+static s16 g_scene = -1;            // Scene being played, for telemetry
+static u32 g_sceneStart = 0;        // vtimer when it started
+static bool g_backlogOpen = FALSE;
+
+// Choice menu state
+static u16 g_choiceFirst = 0;     // First edge in SCENE_CHOICES
+static u16 g_choiceCount = 0;
+static u16 g_choiceSelected = 0;
+static u16 g_choiceTop = 0;       // First visible choice
+static u16 g_choiceRows = 0;      // Visible choices
+static u16 g_choiceY = 0;
+#define CHOICE_X 4
+#define CHOICE_BOTTOM 26          // Last text row usable by the menu
+
+// Rough 68000 cycles, for spreading a page redraw over frames
+#define CHAR_CYCLES 1200
+#define CHOICE_LIST_CYCLES 8000
+
+// Forward declarations
+static void drawTextRange(u16 from, u16 to);
+static void drawChoiceList();
+static void drawPage();
+
+static void resetTypewriter() {
     g_textCharIndex = 0;
     g_textTimer = 0;
     g_lastDrawnIndex = 0;
 }
 
-void sceneManagerStart() {
-    g_currentScene = &SCENES[0];  
-    g_waitingForInput = FALSE;
+static void setFlag(u8 flag, bool value) {
+    if(value) g_flags[flag >> 3] |= 1 << (flag & 7);
+    else g_flags[flag >> 3] &= ~(1 << (flag & 7));
+}
+
+static bool testFlag(u8 flag) {
+    return (g_flags[flag >> 3] >> (flag & 7)) & 1;
+}
+
+void sceneManagerInit() {
+    g_vmState = VM_HALTED;
+    g_pc = 0;
+    g_waitFrames = 0;
+    memset(g_flags, 0, sizeof(g_flags));
+    setFlag(SCENE_FLAG_PASSED, TRUE);  // start on the normal path
+    g_currentBg = 0;
+    g_currentMusic = 0;
+    g_currentSprite = 0;
+    g_currentIllustration = 0;
+    g_pendingQuestion = -1;
+    g_pendingQuiz = -1;
     g_shouldTriggerQuiz = FALSE;
     g_reachedEnd = FALSE;
-    g_textCharIndex = 0;
-    g_textTimer = 0;
-    g_lastDrawnIndex = 0;
-    sceneManagerDraw();
+    g_endingType = SCENE_TYPE_BAD_ENDING;
+    g_text = NULL;
+    g_textLen = 0;
+    resetTypewriter();
+    backlogClear();
+    g_backlogOpen = FALSE;
+    g_scene = -1;
+}
+
+void sceneManagerStart() {
+    sceneManagerStartAt(0);
+}
+
+void sceneManagerStartAt(u16 scene) {
+    g_pc = SCENE_ENTRIES[scene];
+    g_vmState = VM_RUNNING;
+    g_text = NULL;
 }
 
 void sceneManagerReset() {
@@ -39,142 +119,382 @@ void sceneManagerReset() {
 }
 
 void sceneManagerDraw() {
-    if(!g_currentScene) return;
+    hudShow(TEXTBOX_Y);
+    C_InitRegion(&g_prompt, WINDOW, 8, 3, 12, PAL0);
+    if(g_vmState == VM_HALTED) return;
     
     VDP_clearPlane(BG_A, TRUE);
+    textBoxClear();
     
-
-    g_textCharIndex = 0;
-    g_textTimer = 0;
-    g_lastDrawnIndex = 0;
-    g_waitingForInput = FALSE;
+    // Restart the current text, if any
+    resetTypewriter();
+    if(g_text && (g_vmState == VM_TYPING || g_vmState == VM_WAIT_INPUT)) {
+        g_vmState = VM_TYPING;
+    } else if(g_vmState == VM_CHOICE) {
+        g_textCharIndex = g_textLen;
+        g_lastDrawnIndex = g_textLen;
+        drawPage();
+    }
 }
 
 
-static void getTextPosition(const char* text, u16 charIndex, u16* outX, u16* outY) {
-    u16 y = 7;
-    u16 x = 2;
+u8 sceneManagerGetCurrentBGId()
+{
+    return g_currentBg;
+}
 
-    u16 lineLen = 0;
-    const u16 maxLineLen = 36;
-    
-    for(u16 i = 0; i < charIndex && text[i] != '\0'; i++) {
-        if(text[i] == '\n') {
-            y = y + 2;
-            x = 2;
-            lineLen = 0;
-        } else {
-            x++;
-            lineLen++;
-            
-            if(lineLen >= maxLineLen) {
-                y = y + 2;
-                x = 2;
-                lineLen = 0;
-            }
-        }
-    }
-    
-    *outX = x;
-    *outY = y;
+u8 sceneManagerGetCurrentSpriteId()
+{
+    return g_currentSprite;
 }
 
-u8 sceneManagerGetCurrentBGId()
+u8 sceneManagerGetCurrentIllustrationId()
 {
-    return g_currentScene ? g_currentScene->bg : 0;
+    return g_currentIllustration;
 }
 
-static void updateTypewriter() {
-    if(!g_currentScene) return;
-    
-    const char* text = g_currentScene->text;
-    u16 textLen = strlen(text);
-    
+u8 sceneManagerGetCurrentMusicId()
+{
+    return g_currentMusic;
+}
 
-    if(g_textCharIndex >= textLen) {
-        if(!g_waitingForInput) {
-            C_DrawText("Continue...", 8, 3, PAL0);
-            g_waitingForInput = TRUE;
-        }
-        return;
+static void drawTextRange(u16 from, u16 to) {
+    for(u16 i = from; i < to; i++) {
+        textBoxPutChar(&g_text[i]);
     }
-    
+}
+
+// Scene whose code holds pc, entries are in increasing order
+static u16 sceneAt(u16 pc) {
+    u16 lo = 0, hi = SCENES_COUNT - 1;
+    while(lo < hi) {
+        u16 mid = (lo + hi + 1) / 2;
+        if(SCENE_ENTRIES[mid] <= pc) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo;
+}
+
+// Logs the time spent in the scene being left
+static void endScene() {
+    if(g_scene < 0) return;
+    u32 frames = vtimer - g_sceneStart;
+    telemetryScene(g_scene, min(frames, 0xFFFF), testFlag(SCENE_FLAG_PASSED));
+    g_scene = -1;
+}
 
+// Returns TRUE once the whole text is on screen. Kept out of line so the
+// benchmark runner can time it.
+static NO_INLINE bool updateTypewriter() {
+    if(g_textCharIndex >= g_textLen) return TRUE;
+    
     g_textTimer++;
     if(g_textTimer < TEXT_DELAY) {
-        return;  
+        return FALSE;
     }
     g_textTimer = 0;
     
+    drawTextRange(g_lastDrawnIndex, g_textCharIndex + 1);
+    
+    g_lastDrawnIndex = g_textCharIndex + 1;
+    g_textCharIndex++;
+    return g_textCharIndex >= g_textLen;
+}
 
-    for(u16 i = g_lastDrawnIndex; i <= g_textCharIndex && i < textLen; i++) {
-        if(text[i] != '\n') {
-            u16 x, y;
-            getTextPosition(text, i, &x, &y);
-            char str[2] = {text[i], '\0'};
-            C_DrawText(str, x, y, PAL0);
+static void drawChoiceCursor(bool visible) {
+    u16 row = g_choiceSelected - g_choiceTop;
+    C_DrawText(visible ? ">" : " ", CHOICE_X - 2, textBoxPlaneRow(g_choiceY + row * 2), PAL0);
+}
+
+static void drawChoiceList() {
+    for(u16 row = 0; row < g_choiceRows; row++) {
+        const char* label = dataGetSceneText(SCENE_CHOICES[g_choiceFirst + g_choiceTop + row].label);
+        u16 y = textBoxPlaneRow(g_choiceY + row * 2);
+        C_ClearText(CHOICE_X, y, 36);
+        C_DrawText(label, CHOICE_X, y, PAL0);
+    }
+    drawChoiceCursor(TRUE);
+}
+
+static void drawTextTask(const void* data, u16 from, u16 to) {
+    drawTextRange(from, to);
+}
+
+static void drawChoiceTask(const void* data, u16 from, u16 to) {
+    drawChoiceList();
+}
+
+// Text so far and the menu, over the next frames. The script waits.
+static void drawPage() {
+    if(g_text) taskStart(drawTextTask, NULL, g_lastDrawnIndex, CHAR_CYCLES);
+    if(g_vmState == VM_CHOICE) taskStart(drawChoiceTask, NULL, 1, CHOICE_LIST_CYCLES);
+}
+
+static void openChoiceMenu(u16 scene) {
+    g_choiceFirst = SCENE_CHOICE_OFFSETS[scene];
+    g_choiceCount = SCENE_CHOICE_OFFSETS[scene + 1] - g_choiceFirst;
+    g_choiceSelected = 0;
+    g_choiceTop = 0;
+    
+    // Menu starts one empty line below the text
+    g_choiceY = min(textBoxGetLineY() + 4, CHOICE_BOTTOM - 1);
+    g_choiceRows = min(g_choiceCount, (CHOICE_BOTTOM + 1 - g_choiceY) / 2);
+    
+    drawChoiceList();
+    g_vmState = VM_CHOICE;
+}
+
+static void updateChoiceMenu(u16 pressed) {
+    u16 selected = g_choiceSelected;
+    
+    if((pressed & BUTTON_UP) && selected > 0) selected--;
+    if((pressed & BUTTON_DOWN) && selected + 1 < g_choiceCount) selected++;
+    
+    if(selected != g_choiceSelected) {
+        if(selected < g_choiceTop || selected >= g_choiceTop + g_choiceRows) {
+            // Scroll the list, the whole window changes
+            g_choiceTop = (selected < g_choiceTop) ? selected : selected + 1 - g_choiceRows;
+            g_choiceSelected = selected;
+            drawChoiceList();
+        } else {
+            // Only the highlight moves
+            drawChoiceCursor(FALSE);
+            g_choiceSelected = selected;
+            drawChoiceCursor(TRUE);
         }
     }
     
-    g_lastDrawnIndex = g_textCharIndex + 1;
-    g_textCharIndex++;
+    if(pressed & (BUTTON_A | BUTTON_C)) {
+        g_pc = SCENE_ENTRIES[SCENE_CHOICES[g_choiceFirst + g_choiceSelected].target];
+        g_vmState = VM_RUNNING;
+    }
 }
 
-void sceneManagerUpdate(u16* lastJoy, SceneType nextScenePath) {
-    u16 joy = JOY_readJoypad(JOY_1);
+static u16 readU16(u16 pc) {
+    return (SCENE_SCRIPT[pc] << 8) | SCENE_SCRIPT[pc + 1];
+}
+
+// Operand bytes of each SceneOp
+static const u8 OP_OPERANDS[] = { 0, 2, 0, 1, 2, 1, 1, 3, 2, 2, 1, 1, 1, 2, 1, 1 };
+
+// Scenes the current one can go to, from its jumps and choices
+u16 sceneManagerGetNextScenes(u16* scenes, u16 max) {
+    if(g_scene < 0) return 0;
     
-    updateTypewriter();
-    
-    if((joy & BUTTON_A) && !g_waitingForInput) {
-        const char* text = g_currentScene->text;
-        u16 textLen = strlen(text);
-        if(g_textCharIndex < textLen) {
-            for(u16 i = g_lastDrawnIndex; i < textLen; i++) {
-                if(text[i] != '\n') {
-                    u16 x, y;
-                    getTextPosition(text, i, &x, &y);
-                    char str[2] = {text[i], '\0'};
-                    C_DrawText(str, x, y, PAL0);
-                }
+    u16 pc = SCENE_ENTRIES[g_scene];
+    u16 end = (g_scene + 1 < SCENES_COUNT) ? SCENE_ENTRIES[g_scene + 1] : SCENE_SCRIPT_SIZE;
+    u16 count = 0;
+    
+    while(pc < end && count < max) {
+        u8 op = SCENE_SCRIPT[pc];
+        if(op == OP_JUMP) {
+            scenes[count++] = sceneAt(readU16(pc + 1));
+        } else if(op == OP_JUMP_IF_FLAG) {
+            scenes[count++] = sceneAt(readU16(pc + 2));
+        } else if(op == OP_CHOICE) {
+            u16 scene = readU16(pc + 1);
+            for(u16 c = SCENE_CHOICE_OFFSETS[scene]; c < SCENE_CHOICE_OFFSETS[scene + 1] && count < max; c++) {
+                scenes[count++] = SCENE_CHOICES[c].target;
             }
-            g_textCharIndex = textLen;
-            g_lastDrawnIndex = textLen;
-            C_DrawText("Continue...", 8, 3, PAL0);
-            g_waitingForInput = TRUE;
         }
+        pc += 1 + OP_OPERANDS[op];
     }
+    return count;
+}
+
+// Background and sprite a scene sets up before its text
+void sceneManagerGetSceneLook(u16 scene, u8* bg, u8* sprite) {
+    u16 pc = SCENE_ENTRIES[scene];
+    *bg = 0;
+    *sprite = 0;
     
-    if(!g_waitingForInput) {
-        *lastJoy = joy;
-        return;
+    while(pc < SCENE_SCRIPT_SIZE && SCENE_SCRIPT[pc] != OP_TEXT) {
+        u8 op = SCENE_SCRIPT[pc];
+        if(op == OP_BG) *bg = SCENE_SCRIPT[pc + 1];
+        else if(op == OP_SPRITE) *sprite = SCENE_SCRIPT[pc + 1];
+        pc += 1 + OP_OPERANDS[op];
     }
+}
+
+s16 sceneManagerGetCurrentScene() {
+    return g_scene;
+}
 
-    if(((joy & BUTTON_A) && !(*lastJoy & BUTTON_A)) || ((joy & BUTTON_B) && !(*lastJoy & BUTTON_B)) || ((joy & BUTTON_C) && !(*lastJoy & BUTTON_C))) {
-        switch(g_currentScene->type) {
-            case SCENE_TYPE_NORMAL:
-                if(nextScenePath == SCENE_A && g_currentScene->nextSceneA >= 0) {
-                    g_currentScene = &SCENES[g_currentScene->nextSceneA];
-                    sceneManagerDraw();  
-                } else if(nextScenePath == SCENE_B && g_currentScene->nextSceneB >= 0) {
-                    g_currentScene = &SCENES[g_currentScene->nextSceneB];
-                    sceneManagerDraw(); 
-                } else {
-                    g_reachedEnd = TRUE;
-                }
+// Run opcodes until one blocks or the per-frame budget is spent
+static void runScript() {
+    for(u16 ops = 0; ops < SCENE_OPS_PER_FRAME && g_vmState == VM_RUNNING; ops++) {
+        if(g_pc >= SCENE_SCRIPT_SIZE) {
+            g_vmState = VM_HALTED;
+            g_reachedEnd = TRUE;
+            return;
+        }
+        
+        const u8 op = SCENE_SCRIPT[g_pc++];
+        switch(op) {
+            case OP_TEXT:
+                // Every scene has one text, it marks the scene change
+                endScene();
+                g_scene = sceneAt(g_pc);
+                g_sceneStart = vtimer;
+                backlogAdd(readU16(g_pc));
+                g_text = dataGetSceneText(readU16(g_pc));
+                g_textLen = strlen(g_text);
+                g_pc += 2;
+                VDP_clearPlane(BG_A, TRUE);
+                C_SetRegionText(&g_prompt, "");
+                textBoxClear();
+                resetTypewriter();
+                g_vmState = VM_TYPING;
+                break;
+                
+            case OP_WAIT_INPUT:
+                C_SetRegionText(&g_prompt, "Continue...");
+                g_vmState = VM_WAIT_INPUT;
+                break;
+                
+            case OP_WAIT:
+                g_waitFrames = SCENE_SCRIPT[g_pc++];
+                g_vmState = VM_WAIT_FRAMES;
                 break;
                 
-            case SCENE_TYPE_QUIZ_TRIGGER:
+            case OP_JUMP:
+                g_pc = readU16(g_pc);
+                break;
+                
+            case OP_SET_FLAG:
+                setFlag(SCENE_SCRIPT[g_pc++], TRUE);
+                break;
+                
+            case OP_CLEAR_FLAG:
+                setFlag(SCENE_SCRIPT[g_pc++], FALSE);
+                break;
+                
+            case OP_JUMP_IF_FLAG:
+                g_pc = testFlag(SCENE_SCRIPT[g_pc]) ? readU16(g_pc + 1) : g_pc + 3;
+                break;
+                
+            case OP_QUESTION:
+                endScene();
+                g_pendingQuestion = readU16(g_pc);
+                g_pc += 2;
+                g_shouldTriggerQuiz = TRUE;
+                g_vmState = VM_WAIT_QUIZ;
+                break;
+                
+            case OP_QUIZ:
+                endScene();
+                g_pendingQuiz = readU16(g_pc);
+                g_pc += 2;
                 g_shouldTriggerQuiz = TRUE;
-                g_waitingForInput = FALSE;
+                g_vmState = VM_WAIT_QUIZ;
+                break;
+                
+            case OP_MUSIC:
+                g_currentMusic = SCENE_SCRIPT[g_pc++];
+                break;
+                
+            case OP_BG:
+                // Every scene starts with one, only scenes with an illustration bring it back
+                g_currentBg = SCENE_SCRIPT[g_pc++];
+                g_currentIllustration = 0;
                 break;
                 
-            case SCENE_TYPE_GOOD_ENDING:
-            case SCENE_TYPE_BAD_ENDING:
-                g_shouldTriggerQuiz = FALSE;
+            case OP_SPRITE:
+                g_currentSprite = SCENE_SCRIPT[g_pc++];
+                break;
+                
+            case OP_ILLUSTRATION:
+                g_currentIllustration = SCENE_SCRIPT[g_pc++];
+                break;
+                
+            case OP_ENDING:
+                endScene();
+                g_endingType = SCENE_SCRIPT[g_pc++];
                 g_reachedEnd = TRUE;
+                g_vmState = VM_HALTED;
+                break;
+                
+            case OP_CHOICE:
+                openChoiceMenu(readU16(g_pc));
+                g_pc += 2;
+                break;
+                
+            case OP_END:
+            default:
+                endScene();
+                g_reachedEnd = TRUE;
+                g_vmState = VM_HALTED;
                 break;
         }
     }
+}
+
+// Back from the backlog, the text so far shows at once
+static void redrawScreen() {
+    VDP_clearPlane(BG_A, TRUE);
+    textBoxClear();
+    drawPage();
+    if(g_vmState == VM_WAIT_INPUT) C_SetRegionText(&g_prompt, "Continue...");
+}
+
+void sceneManagerUpdate(u16* lastJoy) {
+    u16 joy = JOY_readJoypad(JOY_1);
+    u16 pressed = joy & ~(*lastJoy);
+    
+    // The script waits for a page redraw to finish
+    if(taskBusy()) {
+        *lastJoy = joy;
+        return;
+    }
+    // The script waits while the backlog is open
+    if(g_backlogOpen) {
+        g_backlogOpen = backlogUpdate(pressed);
+        if(!g_backlogOpen) redrawScreen();
+        *lastJoy = joy;
+        return;
+    }
+    if((pressed & BUTTON_START) && (g_vmState == VM_TYPING || g_vmState == VM_WAIT_INPUT || g_vmState == VM_CHOICE)) {
+        C_SetRegionText(&g_prompt, "");
+        VDP_clearPlane(BG_A, TRUE);
+        g_backlogOpen = backlogOpen();
+        if(!g_backlogOpen) redrawScreen();
+        *lastJoy = joy;
+        return;
+    }
+    
+    switch(g_vmState) {
+        case VM_TYPING:
+            if(pressed & BUTTON_A) {
+                // Skip the typewriter, the press doesn't count as Continue
+                drawTextRange(g_lastDrawnIndex, g_textLen);
+                g_textCharIndex = g_textLen;
+                g_lastDrawnIndex = g_textLen;
+                g_vmState = VM_RUNNING;
+            } else if(updateTypewriter()) {
+                g_vmState = VM_RUNNING;
+            }
+            break;
+            
+        case VM_WAIT_INPUT:
+            if(pressed & (BUTTON_A | BUTTON_B | BUTTON_C)) {
+                g_vmState = VM_RUNNING;
+            }
+            break;
+            
+        case VM_WAIT_FRAMES:
+            if(g_waitFrames) g_waitFrames--;
+            else g_vmState = VM_RUNNING;
+            break;
+            
+        case VM_CHOICE:
+            updateChoiceMenu(pressed);
+            break;
+            
+        default:
+            break;
+    }
+    
+    runScript();
     
     *lastJoy = joy;
 }
@@ -184,13 +504,12 @@ bool sceneManagerShouldTriggerQuiz() {
 }
 
 bool sceneManagerGetTriggeredQuiz(u16* outQuizId) {
-    if(!g_currentScene || g_currentScene->type != SCENE_TYPE_QUIZ_TRIGGER) {
+    if(!g_shouldTriggerQuiz) {
         return FALSE;
     }
     
-    if(g_currentScene->triggerQuiz >= 0 && 
-       g_currentScene->triggerQuiz < QUIZZES_COUNT) {
-        *outQuizId = g_currentScene->triggerQuiz;
+    if(g_pendingQuiz >= 0 && g_pendingQuiz < QUIZZES_COUNT) {
+        *outQuizId = g_pendingQuiz;
         return TRUE;
     }
     
@@ -198,47 +517,31 @@ bool sceneManagerGetTriggeredQuiz(u16* outQuizId) {
 }
 
 bool sceneManagerGetQuestionId(u16* outQuestionId) {
-    if(!g_currentScene || g_currentScene->type != SCENE_TYPE_QUIZ_TRIGGER) {
+    if(!g_shouldTriggerQuiz) {
         return FALSE;
     }
     
-    if(g_currentScene->questionId >= 0 && 
-       g_currentScene->questionId < QUESTIONS_COUNT) {
-        *outQuestionId = g_currentScene->questionId;
+    if(g_pendingQuestion >= 0 && g_pendingQuestion < QUESTIONS_COUNT) {
+        *outQuestionId = g_pendingQuestion;
         return TRUE;
     }
     
     return FALSE;
 }
 
-void sceneManagerContinueAfterQuiz(SceneType nextScenePath) {
+void sceneManagerContinueAfterQuiz(NextScene nextScenePath) {
     g_shouldTriggerQuiz = FALSE;
+    g_pendingQuestion = -1;
+    g_pendingQuiz = -1;
     
-    // FIX: Move to next scene after quiz based on the path
-    if(g_currentScene) {
-        if(nextScenePath == SCENE_A && g_currentScene->nextSceneA >= 0 && 
-           g_currentScene->nextSceneA < SCENES_COUNT) {
-            g_currentScene = &SCENES[g_currentScene->nextSceneA];
-            g_reachedEnd = FALSE;
-        } else if(nextScenePath == SCENE_B && g_currentScene->nextSceneB >= 0 && 
-                  g_currentScene->nextSceneB < SCENES_COUNT) {
-            g_currentScene = &SCENES[g_currentScene->nextSceneB];
-            g_reachedEnd = FALSE;
-        } else {
-            // Invalid next scene
-            g_reachedEnd = TRUE;
-            return;
-        }
-    } else {
-        g_reachedEnd = TRUE;
-        return;
-    }
+    // The script branches on the quiz result through the passed flag
+    setFlag(SCENE_FLAG_PASSED, nextScenePath == SCENE_A);
     
-    // Reset typewriter for new scene
-    g_textCharIndex = 0;
-    g_textTimer = 0;
-    g_lastDrawnIndex = 0;
-    g_waitingForInput = FALSE;
+    g_text = NULL;
+    resetTypewriter();
+    if(g_vmState == VM_WAIT_QUIZ) {
+        g_vmState = VM_RUNNING;
+    }
 }
 
 bool sceneManagerReachedEnd() {
@@ -246,5 +549,5 @@ bool sceneManagerReachedEnd() {
 }
 
 SceneType sceneManagerGetEndingType() {
-    return g_currentScene ? g_currentScene->type : SCENE_TYPE_BAD_ENDING;
-}
\ No newline at end of file
+    return g_endingType;
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "scroll_fx.h"
+#include "scroll_tables.h"
+
+#define TO_INT(x)  ((x) >> 8)
+
+static ScrollFxMode g_mode = SCROLLFX_NONE;
+static bool g_columnWave = FALSE;
+
+static s16 g_scrollX = 0;
+static s16 g_scrollY = 0;
+static s16 g_scrollSpeedX = FIX16(2.1);
+static s16 g_scrollSpeedY = FIX16(2.1);
+
+static u16 g_phase = 0;         // Wave phase or parallax frame
+static u16 g_columnPhase = 0;
+static u16 g_timer = 0;
+
+// Forward declarations
+static void clearScrollTables();
+
+void scrollFxSetMode(ScrollFxMode mode, bool columnWave) {
+    g_mode = mode;
+    g_columnWave = columnWave && (mode != SCROLLFX_NONE);
+    g_scrollX = 0;
+    g_scrollY = 0;
+    g_phase = 0;
+    g_columnPhase = 0;
+    g_timer = 0;
+    
+    switch(mode) {
+        case SCROLLFX_WAVE:
+            VDP_setScrollingMode(HSCROLL_LINE, g_columnWave ? VSCROLL_COLUMN : VSCROLL_PLANE);
+            break;
+        case SCROLLFX_PARALLAX:
+            VDP_setScrollingMode(HSCROLL_TILE, g_columnWave ? VSCROLL_COLUMN : VSCROLL_PLANE);
+            break;
+        default:
+            VDP_setScrollingMode(HSCROLL_PLANE, g_columnWave ? VSCROLL_COLUMN : VSCROLL_PLANE);
+            break;
+    }
+    
+    // Plane A shares the tables and must stay still
+    clearScrollTables();
+}
+
+// One logic tick
+void scrollFxUpdate() {
+    bool waveStep = FALSE;
+    if(++g_timer >= SCROLLFX_WAVE_TICKS) {
+        g_timer = 0;
+        waveStep = TRUE;
+        if(++g_columnPhase >= SCROLL_COLUMN_PERIOD) g_columnPhase = 0;
+    }
+    
+    switch(g_mode) {
+        case SCROLLFX_DRIFT:
+            g_scrollX += g_scrollSpeedX;
+            g_scrollY += g_scrollSpeedY;
+            break;
+            
+        case SCROLLFX_WAVE:
+            g_scrollY += g_scrollSpeedY;
+            if(waveStep && ++g_phase >= SCROLL_WAVE_PERIOD) g_phase = 0;
+            break;
+            
+        case SCROLLFX_PARALLAX:
+            if(++g_phase >= SCROLL_PARALLAX_FRAMES) g_phase = 0;
+            break;
+            
+        default:
+            break;
+    }
+}
+
+// Once per frame, everything goes through the DMA queue at the next vblank
+void scrollFxApply() {
+    switch(g_mode) {
+        case SCROLLFX_DRIFT:
+            VDP_setHorizontalScrollVSync(BG_B, -TO_INT(g_scrollX));
+            break;
+            
+        case SCROLLFX_WAVE:
+            VDP_setHorizontalScrollLine(BG_B, 0, (s16*) &SCROLL_WAVE[g_phase],
+                                        SCROLL_LINES, DMA_QUEUE);
+            break;
+            
+        case SCROLLFX_PARALLAX:
+            VDP_setHorizontalScrollTile(BG_B, 0, (s16*) &SCROLL_PARALLAX[g_phase * SCROLL_ROWS],
+                                        SCROLL_ROWS, DMA_QUEUE);
+            break;
+            
+        default:
+            return;
+    }
+    
+    if(g_columnWave) {
+        VDP_setVerticalScrollTile(BG_B, 0, (s16*) &SCROLL_COLUMN_WAVE[g_columnPhase],
+                                  SCROLL_COLUMNS, DMA_QUEUE);
+    } else if(g_mode != SCROLLFX_PARALLAX) {
+        VDP_setVerticalScrollVSync(BG_B, TO_INT(g_scrollY));
+    }
+}
+
+// Zero both planes in every scroll mode, done once on a mode change
+static void clearScrollTables() {
+    s16 zero[SCROLL_LINES];
+    memset(zero, 0, sizeof(zero));
+    
+    VDP_setHorizontalScrollLine(BG_A, 0, zero, SCROLL_LINES, CPU);
+    VDP_setHorizontalScrollLine(BG_B, 0, zero, SCROLL_LINES, CPU);
+    VDP_setVerticalScrollTile(BG_A, 0, zero, SCROLL_COLUMNS, CPU);
+    VDP_setVerticalScrollTile(BG_B, 0, zero, SCROLL_COLUMNS, CPU);
+}
@@ -0,0 +1,98 @@
+#include <genesis.h>
+#include "scroll_tables.h"
+
+// ---- Sine wave, 6 px over 64 lines ----
+const s16 SCROLL_WAVE[288] = {
+  0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 5, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1,
+  0, -1, -1, -2, -2, -3, -3, -4, -4, -5, -5, -5, -6, -6, -6, -6,
+  -6, -6, -6, -6, -6, -5, -5, -5, -4, -4, -3, -3, -2, -2, -1, -1,
+  0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 5, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1,
+  0, -1, -1, -2, -2, -3, -3, -4, -4, -5, -5, -5, -6, -6, -6, -6,
+  -6, -6, -6, -6, -6, -5, -5, -5, -4, -4, -3, -3, -2, -2, -1, -1,
+  0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 5, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1,
+  0, -1, -1, -2, -2, -3, -3, -4, -4, -5, -5, -5, -6, -6, -6, -6,
+  -6, -6, -6, -6, -6, -5, -5, -5, -4, -4, -3, -3, -2, -2, -1, -1,
+  0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 5, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1,
+  0, -1, -1, -2, -2, -3, -3, -4, -4, -5, -5, -5, -6, -6, -6, -6,
+  -6, -6, -6, -6, -6, -5, -5, -5, -4, -4, -3, -3, -2, -2, -1, -1,
+  0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 5, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1,
+};
+
+// ---- Column sine wave, 4 px over 20 columns ----
+const s16 SCROLL_COLUMN_WAVE[40] = {
+  0, 1, 2, 3, 4, 4, 4, 3, 2, 1, 0, -1, -2, -3, -4, -4, -4, -3, -2, -1,
+  0, 1, 2, 3, 4, 4, 4, 3, 2, 1, 0, -1, -2, -3, -4, -4, -4, -3, -2, -1,
+};
+
+// ---- Parallax bands, one frame of 28 rows per line ----
+const s16 SCROLL_PARALLAX[1792] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -3, -3, -4, -4, -4, -3, -3, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1,
+  -2, -2, -2, -2, -2, -2, -4, -4, -4, -4, -4, -6, -6, -8, -8, -8, -6, -6, -4, -4, -4, -4, -4, -2, -2, -2, -2, -2,
+  -3, -3, -3, -3, -3, -3, -6, -6, -6, -6, -6, -9, -9, -12, -12, -12, -9, -9, -6, -6, -6, -6, -6, -3, -3, -3, -3, -3,
+  -4, -4, -4, -4, -4, -4, -8, -8, -8, -8, -8, -12, -12, -16, -16, -16, -12, -12, -8, -8, -8, -8, -8, -4, -4, -4, -4, -4,
+  -5, -5, -5, -5, -5, -5, -10, -10, -10, -10, -10, -15, -15, -20, -20, -20, -15, -15, -10, -10, -10, -10, -10, -5, -5, -5, -5, -5,
+  -6, -6, -6, -6, -6, -6, -12, -12, -12, -12, -12, -18, -18, -24, -24, -24, -18, -18, -12, -12, -12, -12, -12, -6, -6, -6, -6, -6,
+  -7, -7, -7, -7, -7, -7, -14, -14, -14, -14, -14, -21, -21, -28, -28, -28, -21, -21, -14, -14, -14, -14, -14, -7, -7, -7, -7, -7,
+  -8, -8, -8, -8, -8, -8, -16, -16, -16, -16, -16, -24, -24, -32, -32, -32, -24, -24, -16, -16, -16, -16, -16, -8, -8, -8, -8, -8,
+  -9, -9, -9, -9, -9, -9, -18, -18, -18, -18, -18, -27, -27, -36, -36, -36, -27, -27, -18, -18, -18, -18, -18, -9, -9, -9, -9, -9,
+  -10, -10, -10, -10, -10, -10, -20, -20, -20, -20, -20, -30, -30, -40, -40, -40, -30, -30, -20, -20, -20, -20, -20, -10, -10, -10, -10, -10,
+  -11, -11, -11, -11, -11, -11, -22, -22, -22, -22, -22, -33, -33, -44, -44, -44, -33, -33, -22, -22, -22, -22, -22, -11, -11, -11, -11, -11,
+  -12, -12, -12, -12, -12, -12, -24, -24, -24, -24, -24, -36, -36, -48, -48, -48, -36, -36, -24, -24, -24, -24, -24, -12, -12, -12, -12, -12,
+  -13, -13, -13, -13, -13, -13, -26, -26, -26, -26, -26, -39, -39, -52, -52, -52, -39, -39, -26, -26, -26, -26, -26, -13, -13, -13, -13, -13,
+  -14, -14, -14, -14, -14, -14, -28, -28, -28, -28, -28, -42, -42, -56, -56, -56, -42, -42, -28, -28, -28, -28, -28, -14, -14, -14, -14, -14,
+  -15, -15, -15, -15, -15, -15, -30, -30, -30, -30, -30, -45, -45, -60, -60, -60, -45, -45, -30, -30, -30, -30, -30, -15, -15, -15, -15, -15,
+  -16, -16, -16, -16, -16, -16, -32, -32, -32, -32, -32, -48, -48, 0, 0, 0, -48, -48, -32, -32, -32, -32, -32, -16, -16, -16, -16, -16,
+  -17, -17, -17, -17, -17, -17, -34, -34, -34, -34, -34, -51, -51, -4, -4, -4, -51, -51, -34, -34, -34, -34, -34, -17, -17, -17, -17, -17,
+  -18, -18, -18, -18, -18, -18, -36, -36, -36, -36, -36, -54, -54, -8, -8, -8, -54, -54, -36, -36, -36, -36, -36, -18, -18, -18, -18, -18,
+  -19, -19, -19, -19, -19, -19, -38, -38, -38, -38, -38, -57, -57, -12, -12, -12, -57, -57, -38, -38, -38, -38, -38, -19, -19, -19, -19, -19,
+  -20, -20, -20, -20, -20, -20, -40, -40, -40, -40, -40, -60, -60, -16, -16, -16, -60, -60, -40, -40, -40, -40, -40, -20, -20, -20, -20, -20,
+  -21, -21, -21, -21, -21, -21, -42, -42, -42, -42, -42, -63, -63, -20, -20, -20, -63, -63, -42, -42, -42, -42, -42, -21, -21, -21, -21, -21,
+  -22, -22, -22, -22, -22, -22, -44, -44, -44, -44, -44, -2, -2, -24, -24, -24, -2, -2, -44, -44, -44, -44, -44, -22, -22, -22, -22, -22,
+  -23, -23, -23, -23, -23, -23, -46, -46, -46, -46, -46, -5, -5, -28, -28, -28, -5, -5, -46, -46, -46, -46, -46, -23, -23, -23, -23, -23,
+  -24, -24, -24, -24, -24, -24, -48, -48, -48, -48, -48, -8, -8, -32, -32, -32, -8, -8, -48, -48, -48, -48, -48, -24, -24, -24, -24, -24,
+  -25, -25, -25, -25, -25, -25, -50, -50, -50, -50, -50, -11, -11, -36, -36, -36, -11, -11, -50, -50, -50, -50, -50, -25, -25, -25, -25, -25,
+  -26, -26, -26, -26, -26, -26, -52, -52, -52, -52, -52, -14, -14, -40, -40, -40, -14, -14, -52, -52, -52, -52, -52, -26, -26, -26, -26, -26,
+  -27, -27, -27, -27, -27, -27, -54, -54, -54, -54, -54, -17, -17, -44, -44, -44, -17, -17, -54, -54, -54, -54, -54, -27, -27, -27, -27, -27,
+  -28, -28, -28, -28, -28, -28, -56, -56, -56, -56, -56, -20, -20, -48, -48, -48, -20, -20, -56, -56, -56, -56, -56, -28, -28, -28, -28, -28,
+  -29, -29, -29, -29, -29, -29, -58, -58, -58, -58, -58, -23, -23, -52, -52, -52, -23, -23, -58, -58, -58, -58, -58, -29, -29, -29, -29, -29,
+  -30, -30, -30, -30, -30, -30, -60, -60, -60, -60, -60, -26, -26, -56, -56, -56, -26, -26, -60, -60, -60, -60, -60, -30, -30, -30, -30, -30,
+  -31, -31, -31, -31, -31, -31, -62, -62, -62, -62, -62, -29, -29, -60, -60, -60, -29, -29, -62, -62, -62, -62, -62, -31, -31, -31, -31, -31,
+  -32, -32, -32, -32, -32, -32, 0, 0, 0, 0, 0, -32, -32, 0, 0, 0, -32, -32, 0, 0, 0, 0, 0, -32, -32, -32, -32, -32,
+  -33, -33, -33, -33, -33, -33, -2, -2, -2, -2, -2, -35, -35, -4, -4, -4, -35, -35, -2, -2, -2, -2, -2, -33, -33, -33, -33, -33,
+  -34, -34, -34, -34, -34, -34, -4, -4, -4, -4, -4, -38, -38, -8, -8, -8, -38, -38, -4, -4, -4, -4, -4, -34, -34, -34, -34, -34,
+  -35, -35, -35, -35, -35, -35, -6, -6, -6, -6, -6, -41, -41, -12, -12, -12, -41, -41, -6, -6, -6, -6, -6, -35, -35, -35, -35, -35,
+  -36, -36, -36, -36, -36, -36, -8, -8, -8, -8, -8, -44, -44, -16, -16, -16, -44, -44, -8, -8, -8, -8, -8, -36, -36, -36, -36, -36,
+  -37, -37, -37, -37, -37, -37, -10, -10, -10, -10, -10, -47, -47, -20, -20, -20, -47, -47, -10, -10, -10, -10, -10, -37, -37, -37, -37, -37,
+  -38, -38, -38, -38, -38, -38, -12, -12, -12, -12, -12, -50, -50, -24, -24, -24, -50, -50, -12, -12, -12, -12, -12, -38, -38, -38, -38, -38,
+  -39, -39, -39, -39, -39, -39, -14, -14, -14, -14, -14, -53, -53, -28, -28, -28, -53, -53, -14, -14, -14, -14, -14, -39, -39, -39, -39, -39,
+  -40, -40, -40, -40, -40, -40, -16, -16, -16, -16, -16, -56, -56, -32, -32, -32, -56, -56, -16, -16, -16, -16, -16, -40, -40, -40, -40, -40,
+  -41, -41, -41, -41, -41, -41, -18, -18, -18, -18, -18, -59, -59, -36, -36, -36, -59, -59, -18, -18, -18, -18, -18, -41, -41, -41, -41, -41,
+  -42, -42, -42, -42, -42, -42, -20, -20, -20, -20, -20, -62, -62, -40, -40, -40, -62, -62, -20, -20, -20, -20, -20, -42, -42, -42, -42, -42,
+  -43, -43, -43, -43, -43, -43, -22, -22, -22, -22, -22, -1, -1, -44, -44, -44, -1, -1, -22, -22, -22, -22, -22, -43, -43, -43, -43, -43,
+  -44, -44, -44, -44, -44, -44, -24, -24, -24, -24, -24, -4, -4, -48, -48, -48, -4, -4, -24, -24, -24, -24, -24, -44, -44, -44, -44, -44,
+  -45, -45, -45, -45, -45, -45, -26, -26, -26, -26, -26, -7, -7, -52, -52, -52, -7, -7, -26, -26, -26, -26, -26, -45, -45, -45, -45, -45,
+  -46, -46, -46, -46, -46, -46, -28, -28, -28, -28, -28, -10, -10, -56, -56, -56, -10, -10, -28, -28, -28, -28, -28, -46, -46, -46, -46, -46,
+  -47, -47, -47, -47, -47, -47, -30, -30, -30, -30, -30, -13, -13, -60, -60, -60, -13, -13, -30, -30, -30, -30, -30, -47, -47, -47, -47, -47,
+  -48, -48, -48, -48, -48, -48, -32, -32, -32, -32, -32, -16, -16, 0, 0, 0, -16, -16, -32, -32, -32, -32, -32, -48, -48, -48, -48, -48,
+  -49, -49, -49, -49, -49, -49, -34, -34, -34, -34, -34, -19, -19, -4, -4, -4, -19, -19, -34, -34, -34, -34, -34, -49, -49, -49, -49, -49,
+  -50, -50, -50, -50, -50, -50, -36, -36, -36, -36, -36, -22, -22, -8, -8, -8, -22, -22, -36, -36, -36, -36, -36, -50, -50, -50, -50, -50,
+  -51, -51, -51, -51, -51, -51, -38, -38, -38, -38, -38, -25, -25, -12, -12, -12, -25, -25, -38, -38, -38, -38, -38, -51, -51, -51, -51, -51,
+  -52, -52, -52, -52, -52, -52, -40, -40, -40, -40, -40, -28, -28, -16, -16, -16, -28, -28, -40, -40, -40, -40, -40, -52, -52, -52, -52, -52,
+  -53, -53, -53, -53, -53, -53, -42, -42, -42, -42, -42, -31, -31, -20, -20, -20, -31, -31, -42, -42, -42, -42, -42, -53, -53, -53, -53, -53,
+  -54, -54, -54, -54, -54, -54, -44, -44, -44, -44, -44, -34, -34, -24, -24, -24, -34, -34, -44, -44, -44, -44, -44, -54, -54, -54, -54, -54,
+  -55, -55, -55, -55, -55, -55, -46, -46, -46, -46, -46, -37, -37, -28, -28, -28, -37, -37, -46, -46, -46, -46, -46, -55, -55, -55, -55, -55,
+  -56, -56, -56, -56, -56, -56, -48, -48, -48, -48, -48, -40, -40, -32, -32, -32, -40, -40, -48, -48, -48, -48, -48, -56, -56, -56, -56, -56,
+  -57, -57, -57, -57, -57, -57, -50, -50, -50, -50, -50, -43, -43, -36, -36, -36, -43, -43, -50, -50, -50, -50, -50, -57, -57, -57, -57, -57,
+  -58, -58, -58, -58, -58, -58, -52, -52, -52, -52, -52, -46, -46, -40, -40, -40, -46, -46, -52, -52, -52, -52, -52, -58, -58, -58, -58, -58,
+  -59, -59, -59, -59, -59, -59, -54, -54, -54, -54, -54, -49, -49, -44, -44, -44, -49, -49, -54, -54, -54, -54, -54, -59, -59, -59, -59, -59,
+  -60, -60, -60, -60, -60, -60, -56, -56, -56, -56, -56, -52, -52, -48, -48, -48, -52, -52, -56, -56, -56, -56, -56, -60, -60, -60, -60, -60,
+  -61, -61, -61, -61, -61, -61, -58, -58, -58, -58, -58, -55, -55, -52, -52, -52, -55, -55, -58, -58, -58, -58, -58, -61, -61, -61, -61, -61,
+  -62, -62, -62, -62, -62, -62, -60, -60, -60, -60, -60, -58, -58, -56, -56, -56, -58, -58, -60, -60, -60, -60, -60, -62, -62, -62, -62, -62,
+  -63, -63, -63, -63, -63, -63, -62, -62, -62, -62, -62, -61, -61, -60, -60, -60, -61, -61, -62, -62, -62, -62, -62, -63, -63, -63, -63, -63,
+};
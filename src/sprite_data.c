@@ -0,0 +1,203 @@
+#include <genesis.h>
+#include "sprite_data.h"
+
+// ---- demon: ../res/Bullet2.png, 11 frames, 160 tiles ----
+static const u16 SPRITE_PALETTE_demon[16] = { 0x000, 0x4E8, 0x22A, 0x682, 0x2A6, 0x64C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 };
+static const u32 SPRITE_TILES_demon[] = {
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000043, 0x00001134,
+  0x00001134, 0x00000043, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000034, 0x00000344, 0x00000344,
+  0x00003344, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x34444331, 0x34443311, 0x44433111,
+  0x44433111, 0x34443311, 0x34444331, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003344,
+  0x00000344, 0x00000344, 0x00000034, 0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x10000000, 0x43000000, 0x44300000, 0x44300000,
+  0x44330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x13344443, 0x11334443, 0x11133444,
+  0x11133444, 0x11334443, 0x13344443, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x44330000,
+  0x44300000, 0x44300000, 0x43000000, 0x10000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x34000000, 0x43110000,
+  0x43110000, 0x34000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000043, 0x00002134,
+  0x00002134, 0x00000043, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000001, 0x00000034, 0x00000344, 0x00000344,
+  0x00003344, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x34444331, 0x34443311, 0x44433115,
+  0x44433115, 0x34443311, 0x34444331, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003344,
+  0x00000344, 0x00000344, 0x00000034, 0x00000001, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x10000000, 0x43000000, 0x44300000, 0x44300000,
+  0x44330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x13344443, 0x11334443, 0x51133444,
+  0x51133444, 0x11334443, 0x13344443, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x44330000,
+  0x44300000, 0x44300000, 0x43000000, 0x10000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x34000000, 0x43120000,
+  0x43120000, 0x34000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000043, 0x00002233,
+  0x00002233, 0x00000043, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000033, 0x00000344, 0x00000344,
+  0x00003344, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x34444331, 0x34443355, 0x44433455,
+  0x44433455, 0x34443355, 0x34444331, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003344,
+  0x00000344, 0x00000344, 0x00000033, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x33000000, 0x44300000, 0x44300000,
+  0x44330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x13344443, 0x55334443, 0x55433444,
+  0x55433444, 0x55334443, 0x13344443, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x44330000,
+  0x44300000, 0x44300000, 0x33000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x34000000, 0x33220000,
+  0x33220000, 0x34000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000043, 0x00002233,
+  0x00002233, 0x00000043, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000032, 0x00000344, 0x00000344,
+  0x00003344, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x34444331, 0x34443355, 0x44433452,
+  0x44433452, 0x34443355, 0x34444331, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003344,
+  0x00000344, 0x00000344, 0x00000032, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x23000000, 0x44300000, 0x44300000,
+  0x44330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x13344443, 0x55334443, 0x25433444,
+  0x25433444, 0x55334443, 0x13344443, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x44330000,
+  0x44300000, 0x44300000, 0x23000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x34000000, 0x33220000,
+  0x33220000, 0x34000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000053, 0x00002223,
+  0x00002223, 0x00000053, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000052, 0x00000332, 0x00000344,
+  0x00003344, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x34444335, 0x34443325, 0x44433552,
+  0x44433552, 0x34443325, 0x34444335, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003344,
+  0x00000344, 0x00000332, 0x00000052, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x25000000, 0x23300000, 0x44300000,
+  0x44330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x53344443, 0x52334443, 0x25533444,
+  0x25533444, 0x52334443, 0x53344443, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x44330000,
+  0x44300000, 0x23300000, 0x25000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x35000000, 0x32220000,
+  0x32220000, 0x35000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000055, 0x00002222,
+  0x00002222, 0x00000055, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000052, 0x00000552, 0x00000333,
+  0x00003344, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x54444335, 0x54443322, 0x24433522,
+  0x24433522, 0x54443322, 0x54444335, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003344,
+  0x00000333, 0x00000552, 0x00000052, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x25000000, 0x25500000, 0x33300000,
+  0x44330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x53344445, 0x22334445, 0x22533442,
+  0x22533442, 0x22334445, 0x53344445, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x44330000,
+  0x33300000, 0x25500000, 0x25000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x55000000, 0x22220000,
+  0x22220000, 0x55000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000055, 0x00002222,
+  0x00002222, 0x00000055, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000052, 0x00000552, 0x00000342,
+  0x00003344, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x54444332, 0x54443322, 0x22433222,
+  0x22433222, 0x54443322, 0x54444332, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003344,
+  0x00000342, 0x00000552, 0x00000052, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x25000000, 0x25500000, 0x24300000,
+  0x44330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x23344445, 0x22334445, 0x22233422,
+  0x22233422, 0x22334445, 0x23344445, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x44330000,
+  0x24300000, 0x25500000, 0x25000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x55000000, 0x22220000,
+  0x22220000, 0x55000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000055, 0x00002222,
+  0x00002222, 0x00000055, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000052, 0x00000552, 0x00000342,
+  0x00003342, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x54444335, 0x54443355, 0x22433552,
+  0x22433552, 0x54443355, 0x54444335, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003342,
+  0x00000342, 0x00000552, 0x00000052, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x25000000, 0x25500000, 0x24300000,
+  0x24330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x53344445, 0x55334445, 0x25533422,
+  0x25533422, 0x55334445, 0x53344445, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x24330000,
+  0x24300000, 0x25500000, 0x25000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x55000000, 0x22220000,
+  0x22220000, 0x55000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000055, 0x00002222,
+  0x00002222, 0x00000055, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000052, 0x00000552, 0x00000342,
+  0x00003344, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x34444335, 0x34443352, 0x24433422,
+  0x24433422, 0x34443352, 0x34444335, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003344,
+  0x00000342, 0x00000552, 0x00000052, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x25000000, 0x25500000, 0x24300000,
+  0x44330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x53344443, 0x25334443, 0x22433442,
+  0x22433442, 0x25334443, 0x53344443, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x44330000,
+  0x24300000, 0x25500000, 0x25000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x55000000, 0x22220000,
+  0x22220000, 0x55000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000043, 0x00004134,
+  0x00004134, 0x00000043, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000033, 0x00000344, 0x00000344,
+  0x00003344, 0x00003444, 0x00034444, 0x00344443, 0x03444433, 0x34444331, 0x34443351, 0x44433112,
+  0x44433112, 0x34443351, 0x34444331, 0x03444433, 0x00344443, 0x00034444, 0x00003444, 0x00003344,
+  0x00000344, 0x00000344, 0x00000033, 0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x10000000, 0x33000000, 0x44300000, 0x44300000,
+  0x44330000, 0x44430000, 0x44443000, 0x34444300, 0x33444430, 0x13344443, 0x15334443, 0x21133444,
+  0x21133444, 0x15334443, 0x13344443, 0x33444430, 0x34444300, 0x44443000, 0x44430000, 0x44330000,
+  0x44300000, 0x44300000, 0x33000000, 0x10000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x34000000, 0x43140000,
+  0x43140000, 0x34000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+// ---- Pieces: x, y, size, first tile ----
+const SpritePiece SPRITE_PIECES[] = {
+  { 0, 0, SPRITE_SIZE(4, 4), 0 },
+  { 0, 0, SPRITE_SIZE(4, 4), 16 },
+  { 0, 0, SPRITE_SIZE(4, 4), 32 },
+  { 0, 0, SPRITE_SIZE(4, 4), 48 },
+  { 0, 0, SPRITE_SIZE(4, 4), 64 },
+  { 0, 0, SPRITE_SIZE(4, 4), 80 },
+  { 0, 0, SPRITE_SIZE(4, 4), 96 },
+  { 0, 0, SPRITE_SIZE(4, 4), 112 },
+  { 0, 0, SPRITE_SIZE(4, 4), 128 },
+  { 0, 0, SPRITE_SIZE(4, 4), 144 },
+  { 0, 0, SPRITE_SIZE(4, 4), 0 },
+};
+
+// ---- Frames: first piece, piece count, logic ticks ----
+const SpriteFrame SPRITE_FRAMES[] = {
+  { 0, 1, 5 },
+  { 1, 1, 5 },
+  { 2, 1, 5 },
+  { 3, 1, 5 },
+  { 4, 1, 5 },
+  { 5, 1, 5 },
+  { 6, 1, 5 },
+  { 7, 1, 5 },
+  { 8, 1, 5 },
+  { 9, 1, 5 },
+  { 10, 1, 5 },
+};
+
+// ---- Animations, id = index + 1 (scene sprite 0 is none) ----
+const u16 SPRITE_ANIM_COUNT = 1;
+const SpriteAnim SPRITE_ANIMS[] = {
+  { 0, 11, 1, 264, 32, 160, SPRITE_TILES_demon, SPRITE_PALETTE_demon },  // 1: demon
+};
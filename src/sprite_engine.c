@@ -0,0 +1,94 @@
+#include "sprite_engine.h"
+#include "palette.h"
+
+#define SCREEN_OFFSET  128      // Sprite coordinates start off screen
+
+static const SpriteAnim* g_anim = NULL;
+static u16 g_frame = 0;
+static u16 g_timer = 0;
+static bool g_dirty = FALSE;    // Sprite table needs a rebuild
+static u16 g_pal = PALETTE_NONE;    // Slot the table was built with
+
+// Forward declarations
+static u16 buildSpriteTable();
+
+void spriteEngineInit() {
+    g_anim = NULL;
+    g_frame = 0;
+    g_timer = 0;
+    g_dirty = TRUE;
+}
+
+// Loads all frames of the animation at once, frames only change the table
+void spriteEngineShow(u16 anim) {
+    if(g_anim) paletteRelease(g_anim->palette);
+    if(anim == 0 || anim > SPRITE_ANIM_COUNT) {
+        g_anim = NULL;
+    } else {
+        g_anim = &SPRITE_ANIMS[anim - 1];
+        VDP_loadTileData(g_anim->tiles, SPRITE_TILE_BASE, g_anim->tileCount, DMA);
+        paletteAcquire(g_anim->palette);
+    }
+    g_frame = 0;
+    g_timer = 0;
+    g_dirty = TRUE;
+}
+
+// One logic tick
+void spriteEngineUpdate() {
+    if(g_anim == NULL) return;
+    
+    if(++g_timer < SPRITE_FRAMES[g_anim->firstFrame + g_frame].ticks) return;
+    g_timer = 0;
+    
+    if(g_frame + 1 < g_anim->frameCount) {
+        g_frame++;
+        g_dirty = TRUE;
+    } else if(g_anim->loop && g_frame != 0) {
+        g_frame = 0;
+        g_dirty = TRUE;
+    }
+}
+
+// Once per frame, the sprite table goes through the DMA queue
+void spriteEngineFlush() {
+    u16 pal = g_anim ? paletteSlot(g_anim->palette) : PALETTE_NONE;
+    if(pal != g_pal) {
+        g_pal = pal;
+        g_dirty = TRUE;
+    }
+    if(!g_dirty) return;
+    g_dirty = FALSE;
+    
+    VDP_updateSprites(buildSpriteTable(), DMA_QUEUE);
+}
+
+// Returns the number of entries, at least one so the list is terminated
+static u16 buildSpriteTable() {
+    u16 count = 0;
+    
+    if(g_anim != NULL && g_pal != PALETTE_NONE) {
+        const SpriteFrame* frame = &SPRITE_FRAMES[g_anim->firstFrame + g_frame];
+        const SpritePiece* piece = &SPRITE_PIECES[frame->firstPiece];
+        
+        for(u16 i = 0; i < frame->pieceCount; i++, piece++) {
+            VDPSprite* s = &vdpSpriteCache[count];
+            s->y = g_anim->y + piece->y + SCREEN_OFFSET;
+            s->size = piece->size;
+            s->link = count + 1;
+            s->attribut = TILE_ATTR_FULL(g_pal, 1, 0, 0, SPRITE_TILE_BASE + piece->tile);
+            s->x = g_anim->x + piece->x + SCREEN_OFFSET;
+            count++;
+        }
+    }
+    
+    if(count == 0) {
+        // Parked above the screen
+        vdpSpriteCache[0].y = 0;
+        vdpSpriteCache[0].x = 0;
+        count = 1;
+    }
+    vdpSpriteCache[count - 1].link = 0;
+    
+    return count;
+}
@@ -0,0 +1,67 @@
+#include "task.h"
+
+typedef struct {
+    TaskStep step;
+    const void* data;
+    u16 next;               // First item not done
+    u16 count;
+    u16 cost;
+} Task;
+
+static Task g_tasks[TASK_SLOTS];
+static u16 g_first = 0;
+static u16 g_count = 0;
+
+// Forward declarations
+static void endTask();
+
+void taskStart(TaskStep step, const void* data, u16 count, u16 cost) {
+    if(!count) return;
+    // Out of slots, catch up rather than run out of order
+    if(g_count == TASK_SLOTS) taskFinish();
+    
+    Task* task = &g_tasks[(g_first + g_count) % TASK_SLOTS];
+    task->step = step;
+    task->data = data;
+    task->next = 0;
+    task->count = count;
+    task->cost = max(cost, 1);
+    g_count++;
+}
+
+void taskUpdate() {
+    u32 budget = TASK_FRAME_BUDGET;
+    
+    while(g_count && budget) {
+        Task* task = &g_tasks[g_first];
+        // At least one item, a step dearer than the budget still moves on
+        u16 items = min(task->count - task->next, max(budget / task->cost, 1));
+        u32 spent = (u32) items * task->cost;
+        
+        task->step(task->data, task->next, task->next + items);
+        task->next += items;
+        budget = (spent < budget) ? budget - spent : 0;
+        if(task->next == task->count) endTask();
+    }
+}
+
+bool taskBusy() {
+    return g_count != 0;
+}
+
+void taskFinish() {
+    while(g_count) {
+        Task* task = &g_tasks[g_first];
+        task->step(task->data, task->next, task->count);
+        endTask();
+    }
+}
+
+void taskCancel() {
+    g_count = 0;
+}
+
+static void endTask() {
+    g_first = (g_first + 1) % TASK_SLOTS;
+    g_count--;
+}
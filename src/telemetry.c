@@ -0,0 +1,91 @@
+#include "telemetry.h"
+
+#define HEADER_SIZE     16
+#define RECORD_SIZE     8
+
+typedef struct {
+    u8 kind;
+    u8 a;
+    u16 b;
+    u16 c;
+    u16 d;
+} Record;
+
+static Record g_queue[TELEMETRY_QUEUE];
+static u16 g_queued = 0;
+static u16 g_head = 0;          // Next record slot in SRAM
+static u16 g_written = 0;       // Saturates, the ring keeps the last ones
+
+// Forward declarations
+static void record(u8 kind, u8 a, u16 b, u16 c, u16 d);
+
+void telemetryInit() {
+    u16 session = 0;
+    
+    SRAM_enable();
+    if(SRAM_readByte(0) == 'K' && SRAM_readByte(1) == 'T' && SRAM_readByte(2) == 'L' && SRAM_readByte(3) == '1') {
+        session = SRAM_readWord(4);
+        g_head = SRAM_readWord(6) % TELEMETRY_RECORDS;
+        g_written = SRAM_readWord(8);
+    } else {
+        SRAM_writeByte(0, 'K');
+        SRAM_writeByte(1, 'T');
+        SRAM_writeByte(2, 'L');
+        SRAM_writeByte(3, '1');
+        g_head = 0;
+        g_written = 0;
+    }
+    session++;
+    SRAM_writeWord(4, session);
+    SRAM_disable();
+    
+    g_queued = 0;
+    record(TELEMETRY_SESSION, 0, session, 0, 0);
+}
+
+void telemetryScene(u16 scene, u16 frames, bool passed) {
+    record(TELEMETRY_SCENE, passed, scene, frames, 0);
+}
+
+void telemetryAnswer(u16 question, u8 answer, bool correct, u16 latency) {
+    record(TELEMETRY_ANSWER, answer, question, latency, correct);
+}
+
+void telemetryQuiz(u16 quiz, bool passed, u16 frames, u16 wrong) {
+    record(TELEMETRY_QUIZ, passed, quiz, frames, wrong);
+}
+
+// SRAM shows over part of the ROM while enabled, so it is only switched
+// on for the writes
+void telemetryFlush() {
+    if(!g_queued) return;
+    
+    SRAM_enable();
+    for(u16 i = 0; i < g_queued; i++) {
+        const Record* r = &g_queue[i];
+        u32 at = HEADER_SIZE + g_head * RECORD_SIZE;
+        SRAM_writeByte(at, r->kind);
+        SRAM_writeByte(at + 1, r->a);
+        SRAM_writeWord(at + 2, r->b);
+        SRAM_writeWord(at + 4, r->c);
+        SRAM_writeWord(at + 6, r->d);
+        g_head = (g_head + 1) % TELEMETRY_RECORDS;
+        if(g_written < 0xFFFF) g_written++;
+    }
+    SRAM_writeWord(6, g_head);
+    SRAM_writeWord(8, g_written);
+    SRAM_disable();
+    g_queued = 0;
+}
+
+// A full queue drops the event rather than stall the frame
+static void record(u8 kind, u8 a, u16 b, u16 c, u16 d) {
+    if(g_queued == TELEMETRY_QUEUE) return;
+    
+    Record* r = &g_queue[g_queued++];
+    r->kind = kind;
+    r->a = a;
+    r->b = b;
+    r->c = c;
+    r->d = d;
+}
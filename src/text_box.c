@@ -0,0 +1,220 @@
+#include "text_box.h"
+#include "functions.h"
+#include "font_data.h"
+
+#define LINE_TILES     (TEXTBOX_COLS * 2)        // Top and bottom tile of each column
+#define LINE_PIXELS    (TEXTBOX_COLS * 8)
+#define GLYPH_SPACING  1
+#define CELL_PAIRS     (TEXTBOX_TILES / 2)
+#define VSCROLL_COLUMNS 20                      // 2 tile columns each in VSCROLL_COLUMN mode
+
+// Current line, 8 u32 (one 4bpp tile) per tile, column by column
+static u32 g_lineBuffer[LINE_TILES * 8];
+static u16 g_lineMap[2][TEXTBOX_COLS];          // Tilemap of the line's rows, 0 for blank cells
+
+static u16 g_line = 0;         // Lines since the clear, the ring position follows
+static u16 g_top = 0;          // First line on screen
+static u16 g_penX = 0;
+static bool g_wordStart = TRUE; // The next character starts a word
+static s16 g_dirtyFirst = -1; // Dirty column range of the current line
+static s16 g_dirtyLast = -1;
+static s16 g_mapFirst = -1;   // Columns that got a tile since the last upload
+static s16 g_mapLast = -1;
+static s16 g_scroll[VSCROLL_COLUMNS];          // Read by the DMA queue at vblank
+
+// Tile pairs go to columns as glyphs reach them, in ring order. A line
+// leaving the box frees everything handed out before the next line.
+static u16 g_nextPair = 0;
+static u16 g_lineFirstPair[TEXTBOX_LINES];
+
+static const u32* getGlyphRows(u16 glyph, u16 half) {
+    return FONT_TILES + (glyph * 2 + half) * 8;
+}
+
+static u16 getCharWidth(char c) {
+    if(c < 32 || c > 126) c = 32;
+    return FONT_GLYPH_WIDTH[FONT_REMAP[c - 32]];
+}
+
+void textBoxInit() {
+    textBoxClear();
+}
+
+static u16 getLineRow(u16 line) {
+    return (TEXTBOX_Y + line * 2) % PLANE_ROWS;
+}
+
+static u16 getCellTile(u16 col) {
+    return g_lineMap[0][col] & TILE_INDEX_MASK;
+}
+
+static void clearLine(u16 line) {
+    u16 row = getLineRow(line);
+    VDP_clearTileMapRect(BG_A, TEXTBOX_X, row, TEXTBOX_COLS, 1);
+    VDP_clearTileMapRect(BG_A, TEXTBOX_X, (row + 1) % PLANE_ROWS, TEXTBOX_COLS, 1);
+}
+
+// Tile pair for a column of the current line, FALSE once the pool is full
+static bool allocCell(u16 col) {
+    if(g_lineMap[0][col]) return TRUE;
+    if((u16) (g_nextPair - g_lineFirstPair[g_top % TEXTBOX_LINES]) >= CELL_PAIRS) return FALSE;
+    
+    u16 tile = TEXTBOX_TILE_BASE + (g_nextPair++ % CELL_PAIRS) * 2;
+    g_lineMap[0][col] = TILE_ATTR_FULL(PAL0, 0, 0, 0, tile);
+    g_lineMap[1][col] = TILE_ATTR_FULL(PAL0, 0, 0, 0, tile + 1);
+    if(g_mapFirst < 0 || col < g_mapFirst) g_mapFirst = col;
+    if((s16) col > g_mapLast) g_mapLast = col;
+    return TRUE;
+}
+
+// Every column gets the value so a column wave on plane B doesn't split the box
+static void setScroll(s16 value) {
+    for(u16 i = 0; i < VSCROLL_COLUMNS; i++) g_scroll[i] = value;
+    VDP_setVerticalScrollTile(BG_A, 0, g_scroll, VSCROLL_COLUMNS, DMA_QUEUE);
+}
+
+// The top line leaves the box and frees its tiles, the new bottom line
+// only maps the cells it draws so its rows start blank
+static void scrollUp() {
+    clearLine(g_top);
+    clearLine(g_line);
+    g_top++;
+    setScroll((g_top * 16) % (PLANE_ROWS * 8));
+}
+
+// Tiles of the dirty columns, a DMA per run of consecutive pairs, then
+// the tilemap of the columns that got a tile so it can't show them early
+static void uploadDirty(TransferMethod tm) {
+    if(g_dirtyFirst >= 0) {
+        u16 col = g_dirtyFirst;
+        while(col <= g_dirtyLast) {
+            u16 first = col++;
+            while(col <= g_dirtyLast && getCellTile(col) == getCellTile(col - 1) + 2) col++;
+            VDP_loadTileData(&g_lineBuffer[first * 16], getCellTile(first), (col - first) * 2, tm);
+            while(col <= g_dirtyLast && !getCellTile(col)) col++;
+        }
+    }
+    if(g_mapFirst >= 0) {
+        u16 row = getLineRow(g_line);
+        u16 count = g_mapLast - g_mapFirst + 1;
+        VDP_setTileMapDataRow(BG_A, &g_lineMap[0][g_mapFirst], row, TEXTBOX_X + g_mapFirst, count, tm);
+        VDP_setTileMapDataRow(BG_A, &g_lineMap[1][g_mapFirst], (row + 1) % PLANE_ROWS, TEXTBOX_X + g_mapFirst, count, tm);
+    }
+    
+    g_dirtyFirst = -1;
+    g_dirtyLast = -1;
+    g_mapFirst = -1;
+    g_mapLast = -1;
+}
+
+static void newLine() {
+    // The buffers are reused right away, so this line can't wait for vblank
+    uploadDirty(DMA);
+    memset(g_lineBuffer, 0, sizeof(g_lineBuffer));
+    memset(g_lineMap, 0, sizeof(g_lineMap));
+    g_line++;
+    g_penX = 0;
+    g_wordStart = TRUE;
+    if(g_line >= g_top + TEXTBOX_LINES) scrollUp();
+    g_lineFirstPair[g_line % TEXTBOX_LINES] = g_nextPair;
+}
+
+// TRUE when text[0] goes on a new line. A word that doesn't fit the rest
+// of the line moves down whole, one longer than a line breaks anywhere.
+static bool breaksLine(const char* text) {
+    if(g_penX + getCharWidth(text[0]) > LINE_PIXELS) return TRUE;
+    if(!g_wordStart || !g_penX || text[0] == ' ') return FALSE;
+    
+    u16 width = 0;
+    while(*text && *text != ' ' && *text != '\n') width += getCharWidth(*text++) + GLYPH_SPACING;
+    return g_penX + width - GLYPH_SPACING > LINE_PIXELS;
+}
+
+void textBoxClear() {
+    // Back to the unscrolled layout with blank rows, lines map their cells as they fill
+    for(u16 line = g_top; line < g_top + TEXTBOX_LINES; line++) clearLine(line);
+    if(g_top) setScroll(0);
+    
+    memset(g_lineBuffer, 0, sizeof(g_lineBuffer));
+    memset(g_lineMap, 0, sizeof(g_lineMap));
+    g_line = 0;
+    g_top = 0;
+    g_penX = 0;
+    g_wordStart = TRUE;
+    g_dirtyFirst = -1;
+    g_dirtyLast = -1;
+    g_mapFirst = -1;
+    g_mapLast = -1;
+    g_nextPair = 0;
+    g_lineFirstPair[0] = 0;
+}
+
+// Puts text[0], the rest of the text only decides where a word wraps
+void textBoxPutChar(const char* text) {
+    char c = text[0];
+    if(c == '\n') {
+        newLine();
+        return;
+    }
+    if(breaksLine(text)) {
+        newLine();
+        if(c == ' ') return;    // Ends the line instead
+    }
+    
+    // Only handle printable ASCII
+    if(c < 32 || c > 126) {
+        c = 32;
+    }
+    
+    u16 glyph = FONT_REMAP[c - 32];
+    u16 width = FONT_GLYPH_WIDTH[glyph];
+    
+    if(glyph) {
+        u16 col = g_penX / 8;
+        u16 shift = (g_penX % 8) * 4;
+        u16 left = FONT_GLYPH_LEFT[glyph] * 4;
+        u16 last = min((g_penX + width - 1) / 8, TEXTBOX_COLS - 1);
+        
+        // Out of tiles the glyph is left out, compile_data.py checks the texts fit
+        bool placed = allocCell(col) && allocCell(last);
+        
+        for(u16 half = 0; placed && half < 2; half++) {
+            const u32* rows = getGlyphRows(glyph, half);
+            u32* dst = &g_lineBuffer[(col * 2 + half) * 8];
+            
+            for(u16 r = 0; r < 8; r++) {
+                u32 bits = rows[r] << left;
+                dst[r] |= bits >> shift;
+                if(shift && col + 1 < TEXTBOX_COLS) dst[r + 16] |= bits << (32 - shift);
+            }
+        }
+        
+        if(placed) {
+            if(g_dirtyFirst < 0 || col < g_dirtyFirst) g_dirtyFirst = col;
+            if((s16)last > g_dirtyLast) g_dirtyLast = last;
+        }
+    }
+    
+    g_penX += width + GLYPH_SPACING;
+    g_wordStart = (c == ' ');
+}
+
+// FALSE if text[0] would start a new line
+bool textBoxFits(const char* text) {
+    return text[0] != '\n' && !breaksLine(text);
+}
+
+// Queue the tiles changed this frame, call once before the vblank
+void textBoxFlush() {
+    uploadDirty(DMA_QUEUE);
+}
+
+// Screen row of the current line
+u16 textBoxGetLineY() {
+    return TEXTBOX_Y + (g_line - g_top) * 2;
+}
+
+// Plane A row shown at a screen row, for drawing below the text
+u16 textBoxPlaneRow(u16 screenRow) {
+    return (screenRow + g_top * 2) % PLANE_ROWS;
+}
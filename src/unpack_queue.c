@@ -0,0 +1,187 @@
+#include "unpack_queue.h"
+#include "lz_stream.h"
+#include "z80_unpack.h"     // Written by bintos from z80_unpack.s80
+
+// Z80 driver mailbox, see z80_unpack.s80
+#define Z80_CMD         0x1100
+#define Z80_FULL        0x1104      // Per buffer
+#define Z80_LEN         0x1106      // Per buffer, u16 low byte first
+#define Z80_DONE        0x110A
+#define Z80_HEAD        0x110C      // Input ring positions
+#define Z80_TAIL        0x110D
+#define Z80_INPUT       0x1200      // 256 byte input ring
+#define Z80_BUFFER      0x1400      // Two of them back to back
+#define Z80_BUFFER_SIZE 0x400
+
+typedef struct {
+    const u8* packed;
+    u8* ram;                // RAM destination, NULL for tiles
+    u16 tile;
+} UnpackJob;
+
+static UnpackJob g_jobs[UNPACK_JOBS];
+static u16 g_first = 0;
+static u16 g_count = 0;
+
+// Front job progress
+static bool g_started = FALSE;
+static bool g_onZ80 = FALSE;
+static u8* g_ram;
+static u16 g_tile;
+static u16 g_z80Buffer;     // Next Z80 buffer to drain
+static const u8* g_feed;    // Next packed byte for the Z80
+static LzStream g_stream;
+static u32 g_chunk[Z80_BUFFER_SIZE / 4];
+
+// Forward declarations
+static bool queueJob(const u8* packed, u8* ram, u16 tile);
+static void step(u16 budget);
+static void startJob();
+static bool startZ80(const u8* packed);
+static bool stepZ80();
+static void feedZ80(vu8* z80);
+static bool step68k(u16 budget);
+static void deliver(u16 bytes);
+static void endJob();
+
+bool unpackQueueTiles(const u8* packed, u16 tile) {
+    return queueJob(packed, NULL, tile);
+}
+
+bool unpackQueueRAM(const u8* packed, u8* dst) {
+    return queueJob(packed, dst, 0);
+}
+
+void unpackQueueUpdate() {
+    if(g_count) step(UNPACK_SLICE_BYTES);
+}
+
+bool unpackQueueBusy() {
+    return g_count != 0;
+}
+
+void unpackQueueFinish() {
+    while(g_count) step(0xFFFF);
+}
+
+void unpackQueueClear() {
+    // A Z80 stopped halfway waits on its buffers forever, reload it next time
+    if(g_started && g_onZ80 && Z80_getLoadedDriver() == Z80_DRIVER_CUSTOM) Z80_unloadDriver();
+    g_count = 0;
+    g_started = FALSE;
+    g_onZ80 = FALSE;
+}
+
+static bool queueJob(const u8* packed, u8* ram, u16 tile) {
+    if(g_count == UNPACK_JOBS) return FALSE;
+    
+    UnpackJob* job = &g_jobs[(g_first + g_count) % UNPACK_JOBS];
+    job->packed = packed;
+    job->ram = ram;
+    job->tile = tile;
+    g_count++;
+    return TRUE;
+}
+
+static void step(u16 budget) {
+    // Music took the Z80 back, the job starts over
+    if(!g_started || (g_onZ80 && Z80_getLoadedDriver() != Z80_DRIVER_CUSTOM)) startJob();
+    
+    bool done = g_onZ80 ? stepZ80() : step68k(budget);
+    if(done) endJob();
+}
+
+// Front job from the start, on the Z80 when it's free
+static void startJob() {
+    const UnpackJob* job = &g_jobs[g_first];
+    g_ram = job->ram;
+    g_tile = job->tile;
+    g_started = TRUE;
+    g_onZ80 = startZ80(job->packed);
+    if(!g_onZ80) lzStreamInit(&g_stream, job->packed);
+}
+
+static bool startZ80(const u8* packed) {
+    if(Z80_getLoadedDriver() != Z80_DRIVER_CUSTOM) {
+        // XGM owns the Z80 while music plays, XGM_startPlay() loads it back
+        if(XGM_isPlaying()) return FALSE;
+        Z80_loadCustomDriver(z80_unpack, sizeof(z80_unpack));
+        if(Z80_getLoadedDriver() != Z80_DRIVER_CUSTOM) return FALSE;
+    }
+    
+    vu8* z80 = (vu8*) Z80_RAM;
+    g_feed = packed;
+    Z80_requestBus(TRUE);
+    z80[Z80_FULL] = 0;
+    z80[Z80_FULL + 1] = 0;
+    z80[Z80_DONE] = 0;
+    z80[Z80_HEAD] = 0;
+    z80[Z80_TAIL] = 0;
+    feedZ80(z80);
+    z80[Z80_CMD] = 1;
+    Z80_releaseBus();
+    g_z80Buffer = 0;
+    return TRUE;
+}
+
+// Takes one full buffer off the Z80, TRUE once the job is done
+static bool stepZ80() {
+    vu8* z80 = (vu8*) Z80_RAM;
+    u16 bytes = 0;
+    
+    Z80_requestBus(TRUE);
+    // DONE is set after the last FULL, reading it first can't skip a buffer
+    bool done = z80[Z80_DONE] != 0;
+    if(z80[Z80_FULL + g_z80Buffer]) {
+        const vu8* src = z80 + Z80_BUFFER + g_z80Buffer * Z80_BUFFER_SIZE;
+        u8* dst = (u8*) g_chunk;
+        bytes = z80[Z80_LEN + g_z80Buffer * 2] | (z80[Z80_LEN + g_z80Buffer * 2 + 1] << 8);
+        for(u16 i = 0; i < bytes; i++) dst[i] = src[i];
+        z80[Z80_FULL + g_z80Buffer] = 0;
+        g_z80Buffer ^= 1;
+    }
+    if(done && z80[Z80_FULL + g_z80Buffer]) done = FALSE;
+    if(!done) feedZ80(z80);
+    Z80_releaseBus();
+    
+    if(bytes) deliver(bytes);
+    return done;
+}
+
+// Tops the input ring up, bus held. Reads a little past the end of the
+// data, the Z80 stops at the unpacked size.
+static void feedZ80(vu8* z80) {
+    u8 head = z80[Z80_HEAD];
+    u8 room = 255 - (u8) (head - z80[Z80_TAIL]);
+    while(room--) z80[Z80_INPUT + head++] = *g_feed++;
+    z80[Z80_HEAD] = head;
+}
+
+// Unpacks up to budget bytes here, TRUE once the job is done
+static bool step68k(u16 budget) {
+    while(budget) {
+        u16 bytes = lzStreamRead(&g_stream, (u8*) g_chunk, min(budget, sizeof(g_chunk)));
+        if(!bytes) break;
+        deliver(bytes);
+        budget -= bytes;
+    }
+    return g_stream.left == 0;
+}
+
+static void deliver(u16 bytes) {
+    if(g_ram) {
+        memcpy(g_ram, g_chunk, bytes);
+        g_ram += bytes;
+    } else {
+        lzToNativeOrder((u8*) g_chunk, bytes, 4);
+        VDP_loadTileData(g_chunk, g_tile, bytes / 32, DMA);
+        g_tile += bytes / 32;
+    }
+}
+
+static void endJob() {
+    g_first = (g_first + 1) % UNPACK_JOBS;
+    g_count--;
+    g_started = FALSE;
+    g_onZ80 = FALSE;
+}
@@ -0,0 +1,124 @@
+#include "warp_menu.h"
+
+#if DEBUG
+
+#include "functions.h"
+#include "data_load.h"
+
+#define NAME_X 10
+#define NAME_Y 10
+
+static const char LETTERS[] = " abcdefghijklmnopqrstuvwxyz0123456789_";
+
+static char g_name[WARP_NAME_MAX + 1];
+static u16 g_cursor = 0;
+static u16 g_browse = 0;        // Next name B fills in, over all three tables
+
+// Forward declarations
+static WarpKind findName(u16* index);
+static void drawName();
+static void drawMatch();
+
+void warpMenuOpen() {
+    memset(g_name, ' ', WARP_NAME_MAX);
+    g_name[WARP_NAME_MAX] = 0;
+    g_cursor = 0;
+    
+    VDP_clearPlane(BG_A, TRUE);
+    C_DrawText("Warp", 18, 4, PAL0);
+    C_DrawText("A warp  B next  C back", 9, 22, PAL0);
+    drawName();
+    drawMatch();
+}
+
+WarpKind warpMenuUpdate(u16 pressed, u16* index) {
+    if(pressed & BUTTON_C) return WARP_CLOSED;
+    if(pressed & (BUTTON_A | BUTTON_START)) {
+        WarpKind kind = findName(index);
+        if(kind != WARP_NONE) return kind;
+    }
+    
+    u16 total = SCENE_NAMES.count + QUIZ_NAMES.count + QUESTION_NAMES.count;
+    if((pressed & BUTTON_B) && total) {
+        // Scenes, then quizzes, then questions
+        const NameHash* tables[] = { &SCENE_NAMES, &QUIZ_NAMES, &QUESTION_NAMES };
+        u16 i = g_browse;
+        g_browse = (g_browse + 1) % total;
+        for(u16 t = 0; t < 3; i -= tables[t]->count, t++) {
+            if(i < tables[t]->count) {
+                const char* name = tables[t]->names[i];
+                u16 len = min(strlen(name), WARP_NAME_MAX);
+                memset(g_name, ' ', WARP_NAME_MAX);
+                memcpy(g_name, name, len);
+                g_cursor = min(len, WARP_NAME_MAX - 1);
+                break;
+            }
+        }
+    } else if(pressed & (BUTTON_UP | BUTTON_DOWN)) {
+        u16 count = sizeof(LETTERS) - 1;
+        u16 letter = 0;
+        while(letter < count && LETTERS[letter] != g_name[g_cursor]) letter++;
+        letter = (pressed & BUTTON_UP) ? (letter + 1) % count : (letter + count - 1) % count;
+        g_name[g_cursor] = LETTERS[letter];
+    } else if((pressed & BUTTON_LEFT) && g_cursor > 0) {
+        g_cursor--;
+    } else if((pressed & BUTTON_RIGHT) && g_cursor < WARP_NAME_MAX - 1) {
+        g_cursor++;
+    } else {
+        return WARP_NONE;
+    }
+    
+    drawName();
+    drawMatch();
+    return WARP_NONE;
+}
+
+// The name up to its first space, looked up in each table
+static WarpKind findName(u16* index) {
+    char name[WARP_NAME_MAX + 1];
+    u16 len = 0;
+    while(len < WARP_NAME_MAX && g_name[len] != ' ') {
+        name[len] = g_name[len];
+        len++;
+    }
+    name[len] = 0;
+    
+    s16 found;
+    WarpKind kind = WARP_NONE;
+    if((found = dataFindName(&SCENE_NAMES, name)) >= 0) kind = WARP_SCENE;
+    else if((found = dataFindName(&QUIZ_NAMES, name)) >= 0) kind = WARP_QUIZ;
+    else if((found = dataFindName(&QUESTION_NAMES, name)) >= 0) kind = WARP_QUESTION;
+    if(kind != WARP_NONE) *index = found;
+    return kind;
+}
+
+static void drawName() {
+    C_DrawText(">", NAME_X - 2, NAME_Y, PAL0);
+    C_DrawText(g_name, NAME_X, NAME_Y, PAL0);
+    C_ClearText(NAME_X, NAME_Y + 2, WARP_NAME_MAX);
+    C_DrawText("-", NAME_X + g_cursor, NAME_Y + 2, PAL0);
+}
+
+static void drawMatch() {
+    static const char* const KINDS[] = { "no match", "", "scene", "quiz", "question" };
+    char buf[24];
+    u16 index = 0;
+    WarpKind kind = findName(&index);
+    
+    char* p = buf;
+    for(const char* k = KINDS[kind]; *k; ) *p++ = *k++;
+    if(kind != WARP_NONE) {
+        *p++ = ' ';
+        p += uintToStr(index, p, 1);
+    }
+    *p = 0;
+    C_ClearText(NAME_X, NAME_Y + 6, 20);
+    C_DrawText(buf, NAME_X, NAME_Y + 6, PAL0);
+}
+
+#else
+
+void warpMenuOpen() {}
+WarpKind warpMenuUpdate(u16 pressed, u16* index) { return WARP_CLOSED; }
+
+#endif
@@ -0,0 +1,102 @@
+// Benchmark runner: plays recorded joypad input into out/rom.bin on the
+// Musashi 68000 core and reports cycles per function.
+//
+//   bench <rom.bin> <rom.out> <inputs> [--focus f,g] [--sample cycles] [--frames n] [--out dir]
+//
+// Inputs use the headless script format (thirdparty/host/headless.c):
+// "<buttons in hex> <frames>" lines, dump lines are ignored. The run ends
+// with the inputs or after --frames frames.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "m68k.h"
+#include "bench.h"
+
+#define MAX_STEPS 4096
+#define DEFAULT_FOCUS "C_DrawText,updateTypewriter,drawQuizBackground"
+
+static uint16_t g_buttons[MAX_STEPS];
+static uint32_t g_frames[MAX_STEPS];
+static uint32_t g_stepCount = 0;
+
+// The VDP drops its interrupt line once the CPU takes it
+unsigned int benchIntAck(int level) {
+    (void) level;
+    m68k_set_irq(0);
+    return M68K_INT_ACK_AUTOVECTOR;
+}
+
+static int loadInputs(const char *path) {
+    FILE *f = fopen(path, "r");
+    char line[128];
+    if(!f) return 0;
+    while(fgets(line, sizeof(line), f) && g_stepCount < MAX_STEPS) {
+        unsigned buttons, frames;
+        if(line[0] == '#' || !strncmp(line, "dump", 4)) continue;
+        if(sscanf(line, "%x %u", &buttons, &frames) == 2) {
+            g_buttons[g_stepCount] = buttons;
+            g_frames[g_stepCount++] = frames;
+        }
+    }
+    fclose(f);
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    const char *focus = DEFAULT_FOCUS;
+    const char *outDir = "out/bench";
+    uint32_t maxFrames = 0xFFFFFFFF;
+    char reportPath[512], foldedPath[512];
+
+    if(argc < 4) {
+        fprintf(stderr, "usage: bench <rom.bin> <rom.out> <inputs> [--focus f,g] [--sample cycles] [--frames n] [--out dir]\n");
+        return 1;
+    }
+    for(int i = 4; i + 1 < argc; i += 2) {
+        if(!strcmp(argv[i], "--focus")) focus = argv[i + 1];
+        else if(!strcmp(argv[i], "--sample")) profileSetSamplePeriod(strtoul(argv[i + 1], NULL, 0));
+        else if(!strcmp(argv[i], "--frames")) maxFrames = strtoul(argv[i + 1], NULL, 0);
+        else if(!strcmp(argv[i], "--out")) outDir = argv[i + 1];
+    }
+    if(!busLoadRom(argv[1])) {
+        fprintf(stderr, "bench: can't read %s\n", argv[1]);
+        return 2;
+    }
+    if(!profileLoadSymbols(argv[2])) {
+        fprintf(stderr, "bench: no symbols in %s\n", argv[2]);
+        return 2;
+    }
+    if(!loadInputs(argv[3])) {
+        fprintf(stderr, "bench: can't read %s\n", argv[3]);
+        return 2;
+    }
+    profileSetFocus(focus);
+
+    busReset();
+    m68k_init();
+    m68k_set_cpu_type(M68K_CPU_TYPE_68000);
+    m68k_pulse_reset();
+
+    uint64_t cycles = 0;
+    uint32_t frame = 0, step = 0, stepFrame = 0;
+    while(step < g_stepCount && frame < maxFrames) {
+        busSetButtons(g_buttons[step]);
+        for(uint16_t line = 0; line < LINES_PER_FRAME; line++) {
+            busSetLine(line);
+            if(line == ACTIVE_LINES && busVIntEnabled()) m68k_set_irq(6);
+            profileSetCycleBase(cycles);
+            cycles += m68k_execute(CYCLES_PER_LINE);
+            cycles += busTakeStallCycles();
+        }
+        frame++;
+        if(++stepFrame >= g_frames[step]) {
+            step++;
+            stepFrame = 0;
+        }
+    }
+
+    snprintf(reportPath, sizeof(reportPath), "%s/report.txt", outDir);
+    snprintf(foldedPath, sizeof(foldedPath), "%s/profile.folded", outDir);
+    profileReport(reportPath, foldedPath, frame);
+    return 0;
+}
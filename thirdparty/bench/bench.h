@@ -0,0 +1,32 @@
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+// Host benchmark runner: out/rom.bin on the Musashi 68000 core with just
+// enough of the console around it (bus.c) and a profiler fed by the
+// instruction hook (profile.c).
+
+#include <stdint.h>
+
+#define CPU_CLOCK           7670453     // NTSC 68000 clock
+#define LINES_PER_FRAME     262
+#define ACTIVE_LINES        224
+#define CYCLES_PER_LINE     488         // 3420 master clocks / 7
+
+// ---------- bus.c ----------
+int busLoadRom(const char *path);
+void busReset(void);
+void busSetButtons(uint16_t buttons);          // SGDK BUTTON_* mask, pad 1
+void busSetLine(uint16_t line);                // Raster position for status/HV reads
+int busVIntEnabled(void);
+uint32_t busTakeStallCycles(void);             // CPU cycles lost to DMA since the last call
+
+// ---------- profile.c ----------
+int profileLoadSymbols(const char *elfPath);
+void profileSetSamplePeriod(uint32_t cycles);
+void profileSetFocus(const char *commaList);
+void profileSetCycleBase(uint64_t cycles);     // Cycles before the current m68k_execute slice
+void profileStall(uint32_t cycles);            // DMA stall, charged to the running function
+void profileInstruction(uint32_t pc);          // M68K_INSTRUCTION_CALLBACK
+void profileReport(const char *reportPath, const char *foldedPath, uint32_t frames);
+
+#endif // _BENCH_H_
@@ -0,0 +1,273 @@
+// The console around the 68000, as far as the game needs it to run: ROM
+// with the SSF2 mapper, work RAM, a VDP that keeps VRAM/CRAM/VSRAM and runs
+// DMA, Z80 RAM and bus arbitration, the I/O chip with a 3 button pad.
+// Nothing is drawn and no sound is made.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "m68k.h"
+#include "bench.h"
+
+#define ROM_MAX         0x1000000
+#define WINDOW_SIZE     0x80000         // SSF2 mapper window, bank.h BANK_SIZE
+#define Z80_DRV_STATUS  0x0102          // SGDK driver status byte in Z80 RAM
+#define Z80_DRV_READY   0x80
+
+#define VDP_DMA_VBLANK_BYTES    205     // 68000 -> VDP bytes per line, H40
+#define VDP_DMA_ACTIVE_BYTES    18
+
+static uint8_t *g_rom = NULL;
+static uint32_t g_romSize = 0;
+static uint8_t g_ram[0x10000];
+static uint8_t g_z80Ram[0x2000];
+static uint8_t g_bank[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+static uint16_t g_buttons = 0;
+static uint8_t g_padData = 0x40;
+static uint8_t g_padCtrl = 0;
+
+// VDP
+static uint8_t g_vram[0x10000];
+static uint16_t g_cram[64];
+static uint16_t g_vsram[40];
+static uint8_t g_reg[32];
+static uint16_t g_addr = 0;
+static uint8_t g_code = 0;
+static uint16_t g_firstWord = 0;
+static int g_pendingWord = 0;
+static int g_pendingFill = 0;
+static uint16_t g_line = 0;
+static uint32_t g_stall = 0;
+
+// ---------- ROM ----------
+int busLoadRom(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if(!f) return 0;
+    g_rom = calloc(1, ROM_MAX);
+    g_romSize = fread(g_rom, 1, ROM_MAX, f);
+    fclose(f);
+    return g_romSize > 0;
+}
+
+void busReset(void) {
+    memset(g_ram, 0, sizeof(g_ram));
+    memset(g_reg, 0, sizeof(g_reg));
+    for(int i = 0; i < 8; i++) g_bank[i] = i;
+    g_pendingWord = 0;
+    g_pendingFill = 0;
+}
+
+static uint8_t romRead8(uint32_t addr) {
+    uint32_t offset = g_bank[(addr >> 19) & 7] * WINDOW_SIZE + (addr & (WINDOW_SIZE - 1));
+    return (offset < ROM_MAX) ? g_rom[offset] : 0xFF;
+}
+
+// ---------- I/O ----------
+void busSetButtons(uint16_t buttons) { g_buttons = buttons; }
+void busSetLine(uint16_t line) { g_line = line; }
+int busVIntEnabled(void) { return (g_reg[1] & 0x20) != 0; }
+
+uint32_t busTakeStallCycles(void) {
+    uint32_t stall = g_stall;
+    g_stall = 0;
+    return stall;
+}
+
+// Active low; TH high gives ?1CBRLDU, TH low ?0SA00DU
+static uint8_t padRead(void) {
+    uint8_t pressed;
+    if(g_padData & 0x40) pressed = g_buttons & 0x3F;
+    else pressed = (g_buttons & 0x03) | ((g_buttons >> 2) & 0x30);
+    return (g_padData & 0x40) | (~pressed & 0x3F);
+}
+
+static uint8_t ioRead8(uint32_t addr) {
+    switch(addr & 0x1F) {
+        case 0x01: return 0xA0;            // Overseas, NTSC, no expansion, no TMSS
+        case 0x03: return padRead();
+        case 0x05: return 0x7F;            // Nothing in port 2
+        case 0x09: return g_padCtrl;
+        default: return 0;
+    }
+}
+
+static void ioWrite8(uint32_t addr, uint8_t value) {
+    switch(addr & 0x1F) {
+        case 0x03: g_padData = value; break;
+        case 0x09: g_padCtrl = value; break;
+    }
+}
+
+// ---------- VDP ----------
+static uint32_t dmaLength(void) {
+    uint32_t len = g_reg[19] | (g_reg[20] << 8);
+    return len ? len : 0x10000;
+}
+
+static void vdpWriteTarget(uint16_t value) {
+    switch(g_code & 0x0F) {
+        case 1:
+            g_vram[g_addr & 0xFFFE] = value >> 8;
+            g_vram[(g_addr & 0xFFFE) + 1] = value & 0xFF;
+            break;
+        case 3: g_cram[(g_addr >> 1) & 63] = value; break;
+        case 5: g_vsram[((g_addr >> 1) % 40)] = value; break;
+    }
+    g_addr += g_reg[15];
+}
+
+// 68000 -> VDP: the CPU is off the bus while the words go through
+static void dmaFromBus(void) {
+    uint32_t src = ((g_reg[21] | (g_reg[22] << 8) | ((g_reg[23] & 0x7F) << 16)) << 1);
+    uint32_t len = dmaLength();
+    for(uint32_t i = 0; i < len; i++, src += 2) vdpWriteTarget(m68k_read_memory_16(src & 0xFFFFFF));
+    uint32_t perLine = (g_line >= ACTIVE_LINES || !(g_reg[1] & 0x40)) ? VDP_DMA_VBLANK_BYTES : VDP_DMA_ACTIVE_BYTES;
+    uint32_t stall = len * 2 * CYCLES_PER_LINE / perLine;
+    g_stall += stall;
+    profileStall(stall);
+    m68k_modify_timeslice(-(int) stall);
+}
+
+static void dmaFill(uint16_t value) {
+    uint32_t len = dmaLength();
+    vdpWriteTarget(value);
+    for(uint32_t i = 0; i < len; i++) {
+        g_vram[g_addr & 0xFFFF] = value >> 8;
+        g_addr += g_reg[15];
+    }
+}
+
+static void dmaCopy(void) {
+    uint16_t src = g_reg[21] | (g_reg[22] << 8);
+    uint32_t len = dmaLength();
+    for(uint32_t i = 0; i < len; i++) {
+        g_vram[g_addr & 0xFFFF] = g_vram[src++];
+        g_addr += g_reg[15];
+    }
+}
+
+static void vdpControl(uint16_t value) {
+    if(!g_pendingWord && (value & 0xC000) == 0x8000) {
+        g_reg[(value >> 8) & 0x1F] = value & 0xFF;
+        return;
+    }
+    if(!g_pendingWord) {
+        g_firstWord = value;
+        g_pendingWord = 1;
+        return;
+    }
+    g_pendingWord = 0;
+    g_code = ((g_firstWord >> 14) & 3) | ((value >> 2) & 0x3C);
+    g_addr = (g_firstWord & 0x3FFF) | ((value & 3) << 14);
+    if((g_code & 0x20) && (g_reg[1] & 0x10)) {
+        switch(g_reg[23] >> 6) {
+            case 2: g_pendingFill = 1; break;
+            case 3: dmaCopy(); break;
+            default: dmaFromBus(); break;
+        }
+    }
+}
+
+static void vdpData(uint16_t value) {
+    g_pendingWord = 0;
+    if(g_pendingFill) {
+        g_pendingFill = 0;
+        dmaFill(value);
+    } else {
+        vdpWriteTarget(value);
+    }
+}
+
+static uint16_t vdpStatus(void) {
+    g_pendingWord = 0;
+    uint16_t status = 0x3400 | 0x0200;                  // FIFO empty
+    if(g_line >= ACTIVE_LINES) status |= 0x0008;       // VBlank
+    return status;
+}
+
+static uint16_t vdpRead16(uint32_t addr) {
+    switch(addr & 0x1E) {
+        case 0x00:
+        case 0x02: {
+            uint16_t v = 0;
+            if((g_code & 0x0F) == 0) v = (g_vram[g_addr & 0xFFFE] << 8) | g_vram[(g_addr & 0xFFFE) + 1];
+            else if((g_code & 0x0F) == 8) v = g_cram[(g_addr >> 1) & 63];
+            else if((g_code & 0x0F) == 4) v = g_vsram[(g_addr >> 1) % 40];
+            g_addr += g_reg[15];
+            return v;
+        }
+        case 0x04:
+        case 0x06: return vdpStatus();
+        case 0x08: return ((g_line < 0xEB ? g_line : g_line - 6) & 0xFF) << 8;   // HV counter, H always 0
+        default: return 0;
+    }
+}
+
+static void vdpWrite16(uint32_t addr, uint16_t value) {
+    switch(addr & 0x1E) {
+        case 0x00:
+        case 0x02: vdpData(value); break;
+        case 0x04:
+        case 0x06: vdpControl(value); break;
+    }
+}
+
+// ---------- 68000 memory map ----------
+// The SGDK sound drivers are not run, their status byte reads as ready
+static uint8_t z80Read8(uint32_t addr) {
+    uint16_t a = addr & 0x1FFF;
+    if(addr & 0x4000) return 0;                     // YM2612 never busy
+    return (a == Z80_DRV_STATUS) ? (g_z80Ram[a] | Z80_DRV_READY) : g_z80Ram[a];
+}
+
+unsigned int m68k_read_memory_8(unsigned int addr) {
+    addr &= 0xFFFFFF;
+    if(addr < 0x400000) return romRead8(addr);
+    if(addr >= 0xE00000) return g_ram[addr & 0xFFFF];
+    if(addr >= 0xA00000 && addr < 0xA10000) return z80Read8(addr);
+    if(addr >= 0xA10000 && addr < 0xA10020) return ioRead8(addr);
+    if(addr >= 0xA11100 && addr < 0xA11102) return 0;      // Z80 bus always granted
+    if(addr >= 0xC00000 && addr < 0xC00020) {
+        uint16_t v = vdpRead16(addr);
+        return (addr & 1) ? (v & 0xFF) : (v >> 8);
+    }
+    return 0;
+}
+
+unsigned int m68k_read_memory_16(unsigned int addr) {
+    addr &= 0xFFFFFF;
+    if(addr >= 0xC00000 && addr < 0xC00020) return vdpRead16(addr);
+    return (m68k_read_memory_8(addr) << 8) | m68k_read_memory_8(addr + 1);
+}
+
+unsigned int m68k_read_memory_32(unsigned int addr) {
+    return (m68k_read_memory_16(addr) << 16) | m68k_read_memory_16(addr + 2);
+}
+
+void m68k_write_memory_8(unsigned int addr, unsigned int value) {
+    addr &= 0xFFFFFF;
+    if(addr >= 0xE00000) g_ram[addr & 0xFFFF] = value;
+    else if(addr >= 0xA00000 && addr < 0xA04000) g_z80Ram[addr & 0x1FFF] = value;
+    else if(addr >= 0xA10000 && addr < 0xA10020) ioWrite8(addr, value);
+    else if(addr >= 0xA130F3 && addr <= 0xA130FF && (addr & 1)) g_bank[(addr - 0xA130F1) >> 1] = value & 0x3F;
+    else if(addr >= 0xC00000 && addr < 0xC00020) vdpWrite16(addr, (value << 8) | value);
+}
+
+void m68k_write_memory_16(unsigned int addr, unsigned int value) {
+    addr &= 0xFFFFFF;
+    if(addr >= 0xC00000 && addr < 0xC00020) {
+        vdpWrite16(addr, value);
+        return;
+    }
+    m68k_write_memory_8(addr, value >> 8);
+    m68k_write_memory_8(addr + 1, value & 0xFF);
+}
+
+void m68k_write_memory_32(unsigned int addr, unsigned int value) {
+    m68k_write_memory_16(addr, value >> 16);
+    m68k_write_memory_16(addr + 2, value & 0xFFFF);
+}
+
+unsigned int m68k_read_disassembler_8(unsigned int addr) { return m68k_read_memory_8(addr); }
+unsigned int m68k_read_disassembler_16(unsigned int addr) { return m68k_read_memory_16(addr); }
+unsigned int m68k_read_disassembler_32(unsigned int addr) { return m68k_read_memory_32(addr); }
@@ -0,0 +1,56 @@
+#ifndef _M68K_BENCH_CONF_H_
+#define _M68K_BENCH_CONF_H_
+
+// Musashi configuration for the benchmark runner, used in place of the
+// stock m68kconfig.h by building the core with
+//   -DMUSASHI_CNF="\"m68k_bench_conf.h\""
+// Plain 68000, every instruction goes through the profiler and interrupt
+// acknowledge clears the VDP interrupt line.
+
+unsigned int benchIntAck(int level);
+void profileInstruction(unsigned int pc);
+
+#define M68K_COMPILE_FOR_MAME       OPT_OFF
+
+#define M68K_EMULATE_010            OPT_OFF
+#define M68K_EMULATE_EC020          OPT_OFF
+#define M68K_EMULATE_020            OPT_OFF
+#define M68K_EMULATE_030            OPT_OFF
+#define M68K_EMULATE_040            OPT_OFF
+
+#define M68K_SEPARATE_READS         OPT_OFF
+#define M68K_SIMULATE_PD_WRITES     OPT_OFF
+
+#define M68K_EMULATE_INT_ACK        OPT_SPECIFY_HANDLER
+#define M68K_INT_ACK_CALLBACK(A)    benchIntAck(A)
+
+#define M68K_EMULATE_BKPT_ACK       OPT_OFF
+#define M68K_BKPT_ACK_CALLBACK()    (void) 0
+#define M68K_EMULATE_TRACE          OPT_OFF
+#define M68K_EMULATE_RESET          OPT_OFF
+#define M68K_RESET_CALLBACK()       (void) 0
+#define M68K_CMPILD_HAS_CALLBACK    OPT_OFF
+#define M68K_CMPILD_CALLBACK(v,r)   (void) 0
+#define M68K_RTE_HAS_CALLBACK       OPT_OFF
+#define M68K_RTE_CALLBACK()         (void) 0
+#define M68K_TAS_HAS_CALLBACK       OPT_OFF
+#define M68K_TAS_CALLBACK()         1
+#define M68K_ILLG_HAS_CALLBACK      OPT_OFF
+#define M68K_ILLG_CALLBACK(opcode)  0
+#define M68K_EMULATE_FC             OPT_OFF
+#define M68K_SET_FC_CALLBACK(A)     (void) 0
+#define M68K_MONITOR_PC             OPT_OFF
+#define M68K_SET_PC_CALLBACK(A)     (void) 0
+
+#define M68K_INSTRUCTION_HOOK       OPT_SPECIFY_HANDLER
+#define M68K_INSTRUCTION_CALLBACK(pc) profileInstruction(pc)
+
+#define M68K_EMULATE_PREFETCH       OPT_OFF
+#define M68K_EMULATE_ADDRESS_ERROR  OPT_OFF
+#define M68K_LOG_ENABLE             OPT_OFF
+#define M68K_LOG_1010_1111_A_LINE   OPT_OFF
+#define M68K_LOG_FILEHANDLE         stderr
+#define M68K_EMULATE_PMMU           OPT_OFF
+#define M68K_USE_64_BIT             OPT_ON
+
+#endif // _M68K_BENCH_CONF_H_
@@ -0,0 +1,333 @@
+// Cycle profiler fed by the Musashi instruction hook.
+//
+// Every instruction charges the cycles since the previous one to the
+// function it belongs to (exclusive cycles, exact). Entering a function's
+// first instruction pushes it on a shadow stack that pops once the stack
+// pointer is back above the return address, which gives calls and
+// inclusive cycles per call. Every sample period the shadow stack is
+// recorded, folded as "outer;inner count" for flame graph tools.
+//
+// Symbols are the function symbols of out/rom.out. Static functions the
+// compiler inlined have no body of their own and are counted in their
+// caller.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "m68k.h"
+#include "bench.h"
+
+#define MAX_DEPTH       256
+#define MAX_STACKS      8192
+#define MAX_FOCUS       16
+
+typedef struct {
+    uint32_t addr;
+    uint32_t size;
+    char *name;
+    uint64_t calls;
+    uint64_t inclusive;
+    uint64_t exclusive;
+    uint64_t maxCall;
+    uint32_t depth;             // Recursion, inclusive counts the outer call only
+} Func;
+
+typedef struct {
+    uint32_t func;
+    uint32_t sp;
+    uint64_t start;
+} Frame;
+
+typedef struct {
+    char *stack;
+    uint64_t count;
+} Folded;
+
+static Func *g_funcs = NULL;
+static uint32_t g_funcCount = 0;
+static uint32_t g_unknown = 0;              // Pseudo functions, last two entries
+static uint32_t g_dma = 0;
+
+static Frame g_stack[MAX_DEPTH];
+static uint32_t g_depth = 0;
+
+static uint64_t g_base = 0;
+static uint64_t g_sliceStall = 0;
+static uint64_t g_lastClock = 0;
+static uint32_t g_lastFunc = 0;
+
+static uint32_t g_samplePeriod = 1000;
+static uint64_t g_nextSample = 0;
+static Folded g_folded[MAX_STACKS];
+static uint32_t g_foldedCount = 0;
+static uint64_t g_samples = 0;
+
+static char *g_focus[MAX_FOCUS];
+static uint32_t g_focusCount = 0;
+
+// ---------- symbols ----------
+static uint32_t be32(const uint8_t *p) { return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+static uint16_t be16(const uint8_t *p) { return (p[0] << 8) | p[1]; }
+
+static int byAddr(const void *a, const void *b) {
+    const Func *fa = a, *fb = b;
+    return (fa->addr > fb->addr) - (fa->addr < fb->addr);
+}
+
+static Func *addFunc(uint32_t addr, uint32_t size, const char *name) {
+    g_funcs = realloc(g_funcs, (g_funcCount + 1) * sizeof(Func));
+    Func *f = &g_funcs[g_funcCount++];
+    memset(f, 0, sizeof(*f));
+    f->addr = addr;
+    f->size = size;
+    f->name = strdup(name);
+    return f;
+}
+
+// Function symbols, and untyped ones in code sections (SGDK's assembly),
+// from the ELF32 big endian symbol table
+int profileLoadSymbols(const char *elfPath) {
+    FILE *file = fopen(elfPath, "rb");
+    if(!file) return 0;
+    fseek(file, 0, SEEK_END);
+    long len = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *elf = malloc(len);
+    if(fread(elf, 1, len, file) != (size_t) len || memcmp(elf, "\177ELF\1\2", 6)) {
+        fclose(file);
+        return 0;
+    }
+    fclose(file);
+
+    const uint8_t *sections = elf + be32(elf + 0x20);
+    uint16_t shentsize = be16(elf + 0x2E), shnum = be16(elf + 0x30);
+    for(uint16_t i = 0; i < shnum; i++) {
+        const uint8_t *sh = sections + i * shentsize;
+        if(be32(sh + 4) != 2) continue;                     // SHT_SYMTAB
+        const uint8_t *syms = elf + be32(sh + 16);
+        const char *strtab = (const char *) elf + be32(sections + be32(sh + 24) * shentsize + 16);
+        uint32_t count = be32(sh + 20) / 16;
+        for(uint32_t s = 1; s < count; s++) {
+            const uint8_t *sym = syms + s * 16;
+            uint8_t type = sym[12] & 0xF;
+            uint16_t shndx = be16(sym + 14);
+            if(shndx == 0 || shndx >= shnum) continue;
+            int code = (be32(sections + shndx * shentsize + 8) & 4) != 0;   // SHF_EXECINSTR
+            const char *name = strtab + be32(sym);
+            if(!(type == 2 || (type == 0 && code)) || !name[0] || name[0] == '.') continue;
+            addFunc(be32(sym + 4) & 0xFFFFFF, be32(sym + 8), name);
+        }
+    }
+    free(elf);
+
+    // Drop aliases, untyped symbols end at the next symbol
+    qsort(g_funcs, g_funcCount, sizeof(Func), byAddr);
+    uint32_t n = 0;
+    for(uint32_t i = 0; i < g_funcCount; i++) {
+        if(n && g_funcs[n - 1].addr == g_funcs[i].addr) {
+            if(!g_funcs[n - 1].size) g_funcs[n - 1] = g_funcs[i];
+            continue;
+        }
+        g_funcs[n++] = g_funcs[i];
+    }
+    g_funcCount = n;
+    for(uint32_t i = 0; i < n; i++) {
+        if(!g_funcs[i].size) g_funcs[i].size = (i + 1 < n) ? g_funcs[i + 1].addr - g_funcs[i].addr : 2;
+    }
+    g_unknown = g_funcCount;
+    addFunc(0, 0, "[unknown]");
+    g_dma = g_funcCount;
+    addFunc(0, 0, "[dma stall]");
+    return g_unknown > 0;
+}
+
+static uint32_t funcAt(uint32_t pc) {
+    uint32_t lo = 0, hi = g_unknown;
+    while(lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if(pc < g_funcs[mid].addr) hi = mid;
+        else if(pc >= g_funcs[mid].addr + g_funcs[mid].size) lo = mid + 1;
+        else return mid;
+    }
+    return g_unknown;
+}
+
+// ---------- settings ----------
+void profileSetSamplePeriod(uint32_t cycles) {
+    g_samplePeriod = cycles ? cycles : 1;
+}
+
+void profileSetFocus(const char *commaList) {
+    char *list = strdup(commaList);
+    for(char *name = strtok(list, ","); name && g_focusCount < MAX_FOCUS; name = strtok(NULL, ",")) {
+        g_focus[g_focusCount++] = name;
+    }
+}
+
+void profileSetCycleBase(uint64_t cycles) {
+    g_base = cycles;
+    g_sliceStall = 0;
+}
+
+// ---------- hook ----------
+static uint64_t clockNow(void) {
+    return g_base + m68k_cycles_run() + g_sliceStall;
+}
+
+void profileStall(uint32_t cycles) {
+    g_sliceStall += cycles;
+    g_funcs[g_dma].exclusive += cycles;
+    g_funcs[g_dma].calls++;
+    g_lastClock += cycles;      // Not charged again to the running function
+}
+
+static void sample(uint32_t leaf) {
+    char buf[4096];
+    size_t len = 0;
+    buf[0] = 0;
+    for(uint32_t i = 0; i < g_depth && len + 80 < sizeof(buf); i++) {
+        len += snprintf(buf + len, sizeof(buf) - len, "%s%s", len ? ";" : "", g_funcs[g_stack[i].func].name);
+    }
+    if(!g_depth || g_stack[g_depth - 1].func != leaf) {
+        snprintf(buf + len, sizeof(buf) - len, "%s%s", len ? ";" : "", g_funcs[leaf].name);
+    }
+    g_samples++;
+    for(uint32_t i = 0; i < g_foldedCount; i++) {
+        if(!strcmp(g_folded[i].stack, buf)) {
+            g_folded[i].count++;
+            return;
+        }
+    }
+    if(g_foldedCount < MAX_STACKS) {
+        g_folded[g_foldedCount].stack = strdup(buf);
+        g_folded[g_foldedCount++].count = 1;
+    }
+}
+
+void profileInstruction(uint32_t pc) {
+    uint64_t now = clockNow();
+    uint32_t sp = m68k_get_reg(NULL, M68K_REG_SP);
+
+    g_funcs[g_lastFunc].exclusive += now - g_lastClock;
+    g_lastClock = now;
+
+    // Returned: the stack pointer is above the return address again
+    while(g_depth && sp > g_stack[g_depth - 1].sp) {
+        Frame *fr = &g_stack[--g_depth];
+        Func *f = &g_funcs[fr->func];
+        uint64_t spent = now - fr->start;
+        if(--f->depth == 0) f->inclusive += spent;
+        if(spent > f->maxCall) f->maxCall = spent;
+    }
+
+    // A call has its return address below the caller's frame, back at the
+    // first instruction with the same stack pointer is a loop (or a tail
+    // call to itself) and stays the same call
+    uint32_t func = funcAt(pc);
+    int loop = g_depth && g_stack[g_depth - 1].func == func && g_stack[g_depth - 1].sp == sp;
+    if(func != g_unknown && pc == g_funcs[func].addr && !loop && g_depth < MAX_DEPTH) {
+        g_stack[g_depth].func = func;
+        g_stack[g_depth].sp = sp;
+        g_stack[g_depth++].start = now;
+        g_funcs[func].calls++;
+        g_funcs[func].depth++;
+    }
+    g_lastFunc = func;
+
+    if(now >= g_nextSample) {
+        sample(func);
+        g_nextSample = now + g_samplePeriod;
+    }
+}
+
+// ---------- report ----------
+static int byInclusive(const void *a, const void *b) {
+    const Func *fa = *(Func * const *) a, *fb = *(Func * const *) b;
+    uint64_t ia = fa->inclusive ? fa->inclusive : fa->exclusive;
+    uint64_t ib = fb->inclusive ? fb->inclusive : fb->exclusive;
+    return (ia < ib) - (ia > ib);
+}
+
+static void printFunc(FILE *out, const Func *f, uint32_t frames) {
+    uint64_t incl = f->inclusive ? f->inclusive : f->exclusive;
+    fprintf(out, "%-32s %9llu %13llu %13llu %10llu %10llu %9.1f\n", f->name,
+            (unsigned long long) f->calls, (unsigned long long) incl, (unsigned long long) f->exclusive,
+            (unsigned long long) (f->calls ? incl / f->calls : 0), (unsigned long long) f->maxCall,
+            frames ? (double) incl / frames : 0.0);
+}
+
+static void printHeader(FILE *out) {
+    fprintf(out, "%-32s %9s %13s %13s %10s %10s %9s\n", "function", "calls", "inclusive",
+            "exclusive", "per call", "max call", "per frame");
+}
+
+static void writeReport(FILE *out, uint32_t frames) {
+    uint64_t total = 0;
+    for(uint32_t i = 0; i < g_funcCount; i++) total += g_funcs[i].exclusive;
+
+    fprintf(out, "frames %u, cycles %llu, %.0f per frame (%u available at 60 Hz)\n\n", frames,
+            (unsigned long long) total, frames ? (double) total / frames : 0.0,
+            CYCLES_PER_LINE * LINES_PER_FRAME);
+
+    if(g_focusCount) {
+        fprintf(out, "---- Focus ----\n");
+        printHeader(out);
+        for(uint32_t i = 0; i < g_focusCount; i++) {
+            uint32_t j;
+            for(j = 0; j < g_funcCount && strcmp(g_funcs[j].name, g_focus[i]); j++) {}
+            if(j < g_funcCount) printFunc(out, &g_funcs[j], frames);
+            else fprintf(out, "%-32s not in the symbols (inlined?)\n", g_focus[i]);
+        }
+        fprintf(out, "\n");
+    }
+
+    Func **sorted = malloc(g_funcCount * sizeof(Func *));
+    for(uint32_t i = 0; i < g_funcCount; i++) sorted[i] = &g_funcs[i];
+    qsort(sorted, g_funcCount, sizeof(Func *), byInclusive);
+    fprintf(out, "---- Functions by inclusive cycles ----\n");
+    printHeader(out);
+    for(uint32_t i = 0; i < g_funcCount && i < 40; i++) {
+        if(sorted[i]->calls || sorted[i]->exclusive) printFunc(out, sorted[i], frames);
+    }
+    free(sorted);
+
+    // Self samples, the leaf of every folded stack
+    fprintf(out, "\n---- Samples (every %u cycles, %llu in all) ----\n", g_samplePeriod,
+            (unsigned long long) g_samples);
+    uint64_t *self = calloc(g_funcCount, sizeof(uint64_t));
+    for(uint32_t i = 0; i < g_foldedCount; i++) {
+        const char *leaf = strrchr(g_folded[i].stack, ';');
+        leaf = leaf ? leaf + 1 : g_folded[i].stack;
+        for(uint32_t j = 0; j < g_funcCount; j++) {
+            if(!strcmp(g_funcs[j].name, leaf)) {
+                self[j] += g_folded[i].count;
+                break;
+            }
+        }
+    }
+    for(uint32_t shown = 0; shown < 20; shown++) {
+        uint32_t best = 0;
+        for(uint32_t j = 1; j < g_funcCount; j++) if(self[j] > self[best]) best = j;
+        if(!self[best]) break;
+        fprintf(out, "%-32s %9llu %6.1f%%\n", g_funcs[best].name, (unsigned long long) self[best],
+                100.0 * self[best] / (g_samples ? g_samples : 1));
+        self[best] = 0;
+    }
+    free(self);
+}
+
+void profileReport(const char *reportPath, const char *foldedPath, uint32_t frames) {
+    writeReport(stdout, frames);
+
+    FILE *out = fopen(reportPath, "w");
+    if(out) {
+        writeReport(out, frames);
+        fclose(out);
+    }
+    out = fopen(foldedPath, "w");
+    if(out) {
+        for(uint32_t i = 0; i < g_foldedCount; i++) {
+            fprintf(out, "%s %llu\n", g_folded[i].stack, (unsigned long long) g_folded[i].count);
+        }
+        fclose(out);
+    }
+}
@@ -0,0 +1,122 @@
+// Host build of the SGDK API subset the game uses, for the headless
+// snapshot build (see sgdk_host.c and snapshot.py). Not used on hardware.
+#ifndef _HOST_GENESIS_H_
+#define _HOST_GENESIS_H_
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+typedef uint8_t u8; typedef int8_t s8; typedef uint16_t u16; typedef int16_t s16;
+typedef uint32_t u32; typedef int32_t s32; typedef s16 fix16; typedef s32 fix32;
+typedef volatile u8 vu8; typedef volatile u16 vu16; typedef volatile u32 vu32;
+typedef u8 bool;
+#define TRUE 1
+#define FALSE 0
+#define FORCE_INLINE inline __attribute__((always_inline))
+#define NO_INLINE __attribute__((noinline))
+#define PAL0 0
+#define PAL1 1
+#define PAL2 2
+#define PAL3 3
+#define FIX16(v) ((fix16)((v) * 64))
+#define BUTTON_UP 1
+#define BUTTON_DOWN 2
+#define BUTTON_LEFT 4
+#define BUTTON_RIGHT 8
+#define BUTTON_A 0x40
+#define BUTTON_B 0x10
+#define BUTTON_C 0x20
+#define BUTTON_START 0x80
+#define BUTTON_X 0x400
+#define BUTTON_Y 0x200
+#define BUTTON_Z 0x100
+#define BUTTON_MODE 0x800
+#define JOY_1 0
+#define TILE_USER_INDEX 16
+#define TILE_SIZE 32
+#define TILE_ATTR_FULL(pal, prio, flipV, flipH, index) ((((u16)(prio)) << 15) | (((u16)(pal)) << 13) | (((u16)(flipV)) << 12) | (((u16)(flipH)) << 11) | ((u16)(index)))
+#define TILE_ATTR(pal, prio, flipV, flipH) TILE_ATTR_FULL(pal, prio, flipV, flipH, 0)
+#define TILE_INDEX_MASK 0x07FF
+#define RGB24_TO_VDPCOLOR(c) ((u16)((((c) >> 20) & 0xE) | (((c) >> 8) & 0xE0) | (((c) << 4) & 0xE00)))
+#define HSCROLL_PLANE 0
+#define HSCROLL_TILE 2
+#define HSCROLL_LINE 3
+#define VSCROLL_PLANE 0
+#define VSCROLL_COLUMN 1
+#define SPRITE_SIZE(w, h) ((((w) - 1) << 2) | ((h) - 1))
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define abs(x) ((x)<0?-(x):(x))
+typedef enum { BG_B, BG_A, WINDOW } VDPPlane;
+typedef enum { CPU, DMA, DMA_QUEUE, DMA_QUEUE_COPY } TransferMethod;
+typedef enum { DMA_VRAM, DMA_CRAM, DMA_VSRAM } DMAType;
+typedef struct { u16 compression; u16 numTile; u32 *tiles; } TileSet;
+typedef struct { u16 length; u16 *data; } Palette;
+typedef struct { u16 compression; u16 w; u16 h; u16 *tilemap; } TileMap;
+typedef struct { Palette *palette; TileSet *tileset; TileMap *tilemap; } Image;
+typedef struct { s16 y; union { struct { u8 size; u8 link; }; u16 size_link; }; u16 attribut; s16 x; } VDPSprite;
+extern VDPSprite vdpSpriteCache[80];
+extern vu32 vtimer;
+void JOY_init(void); u16 JOY_readJoypad(u16 joy);
+void VDP_setBackgroundColor(u8 c); void PAL_setColor(u16 i, u16 v);
+void PAL_setPalette(u16 n, const u16 *pal, TransferMethod tm);
+void PAL_setColors(u16 index, const u16 *pal, u16 count, TransferMethod tm);
+void PAL_getColors(u16 index, u16 *dest, u16 count);
+u16 VDP_loadTileSet(const TileSet *ts, u16 index, TransferMethod tm);
+void VDP_loadTileData(const u32 *data, u16 index, u16 num, TransferMethod tm);
+void VDP_clearPlane(VDPPlane plane, bool wait);
+void VDP_setTileMapXY(VDPPlane plane, u16 tile, u16 x, u16 y);
+void VDP_fillTileMapRect(VDPPlane plane, u16 tile, u16 x, u16 y, u16 w, u16 h);
+void VDP_setTileMapDataRow(VDPPlane plane, const u16 *data, u16 row, u16 x, u16 w, TransferMethod tm);
+void VDP_setTileMapDataRect(VDPPlane plane, const u16 *data, u16 x, u16 y, u16 w, u16 h, u16 wm, TransferMethod tm);
+void VDP_setTileMapEx(VDPPlane plane, const TileMap *tilemap, u16 basetile, u16 x, u16 y, u16 xm, u16 ym, u16 wm, u16 hm, TransferMethod tm);
+void VDP_clearTileMapRect(VDPPlane plane, u16 x, u16 y, u16 w, u16 h);
+void VDP_setHorizontalScrollVSync(VDPPlane plane, s16 value);
+void VDP_setVerticalScrollVSync(VDPPlane plane, s16 value);
+void VDP_setHorizontalScroll(VDPPlane plane, s16 value);
+void VDP_setVerticalScroll(VDPPlane plane, s16 value);
+void VDP_setHorizontalScrollLine(VDPPlane plane, u16 line, s16 *values, u16 len, TransferMethod tm);
+void VDP_setHorizontalScrollTile(VDPPlane plane, u16 tile, s16 *values, u16 len, TransferMethod tm);
+void VDP_setVerticalScrollTile(VDPPlane plane, u16 tile, s16 *values, u16 len, TransferMethod tm);
+void VDP_setScrollingMode(u16 hscroll, u16 vscroll);
+void VDP_setWindowVPos(bool down, u16 pos);
+void VDP_setWindowHPos(bool right, u16 pos);
+void VDP_setSpriteFull(u16 index, s16 x, s16 y, u8 size, u16 attribut, u8 link);
+void VDP_updateSprites(u16 num, TransferMethod tm);
+void VDP_resetSprites(void);
+u16 VDP_getScreenHeight(void);
+u16 VDP_getVCounter(void);
+u16 VDP_getAdjustedVCounter(void);
+void DMA_queueDma(u8 location, void* from, u16 to, u16 len, u16 step);
+bool DMA_transfer(TransferMethod tm, u8 location, void* from, u16 to, u16 len, u16 step);
+void SYS_doVBlankProcess(void);
+bool SYS_isPAL(void);
+bool SYS_isNTSC(void);
+u32 getTick(void);
+void XGM_setLoopNumber(s8 n); void XGM_startPlay(const u8 *song); void XGM_pausePlay(void);
+void XGM_resumePlay(void); void XGM_stopPlay(void); u8 XGM_isPlaying(void); void XGM_setMusicTempo(u16 v);
+void SRAM_enable(void); void SRAM_enableRO(void); void SRAM_disable(void);
+u8 SRAM_readByte(u32 offset); void SRAM_writeByte(u32 offset, u8 val);
+u16 SRAM_readWord(u32 offset); void SRAM_writeWord(u32 offset, u16 val);
+u32 SRAM_readLong(u32 offset); void SRAM_writeLong(u32 offset, u32 val);
+void Z80_requestBus(bool wait); void Z80_releaseBus(void); bool Z80_isBusTaken(void);
+void Z80_loadCustomDriver(const u8 *drv, u16 size); u16 Z80_getLoadedDriver(void); void Z80_unloadDriver(void);
+void Z80_upload(u16 to, const u8 *from, u16 size, bool resetz80);
+void Z80_download(u16 from, u8 *to, u16 size);
+#define Z80_RAM 0xA00000
+#define Z80_DRIVER_XGM 4
+#define Z80_DRIVER_CUSTOM 0xFF
+void KLog(char *text); void KLog_U1(char *t, u32 v); void KDebug_Halt(void); void KDebug_Alert(const char *t);
+u16 intToStr(s32 value, char *str, u16 minsize);
+u16 uintToStr(u32 value, char *str, u16 minsize);
+void *MEM_alloc(u16 size); void MEM_free(void *p);
+#define random sgdk_random
+u16 random(void);
+void VDP_fillTileData(u8 value, u16 index, u16 num, bool wait);
+void VDP_fillTileMapRectInc(VDPPlane plane, u16 basetile, u16 x, u16 y, u16 w, u16 h);
+
+// Host only: VDP state dump read by render_vdp.py, SRAM for telemetry_csv.py
+void HOST_dumpVDP(const char *path);
+void HOST_dumpSRAM(const char *path);
+
+#endif
@@ -0,0 +1,89 @@
+// Headless driver: runs the game with a scripted joypad and dumps the VDP
+// state at the points the script asks for.
+//
+//   headless <script> <dump dir>
+//
+// Script lines are "<buttons in hex> <frames>": hold the buttons for that
+// many frames, "dump <name>": write <dump dir>/<name>.bin, or
+// "sram <name>": write the SRAM to <dump dir>/<name>.srm. The game exits
+// when the script ends. Lines starting with # are comments.
+#include <stdlib.h>     // before genesis.h, which defines abs() and random()
+#include <genesis.h>
+#include "bank.h"
+
+#define MAX_STEPS 4096
+
+int game_main();
+
+static u16 g_buttons[MAX_STEPS];
+static u32 g_frames[MAX_STEPS];
+static char g_dumpNames[MAX_STEPS][48];    // Set for dump steps, which take no frame
+static bool g_dumpSRAM[MAX_STEPS];
+static u16 g_stepCount = 0;
+static u16 g_step = 0;
+static u32 g_stepFrame = 0;
+static const char *g_dumpDir = NULL;
+
+static void loadScript(const char *path) {
+    FILE *f = fopen(path, "r");
+    char line[128];
+    if(!f) {
+        fprintf(stderr, "headless: can't open %s\n", path);
+        exit(2);
+    }
+    while(fgets(line, sizeof(line), f) && g_stepCount < MAX_STEPS) {
+        unsigned buttons, frames;
+        if(line[0] == '#') continue;
+        if(sscanf(line, "dump %47s", g_dumpNames[g_stepCount]) == 1) {
+            g_stepCount++;
+        } else if(sscanf(line, "sram %47s", g_dumpNames[g_stepCount]) == 1) {
+            g_dumpSRAM[g_stepCount++] = TRUE;
+        } else if(sscanf(line, "%x %u", &buttons, &frames) == 2) {
+            g_buttons[g_stepCount] = buttons;
+            g_frames[g_stepCount] = frames;
+            g_stepCount++;
+        }
+    }
+    fclose(f);
+}
+
+void JOY_init(void) {}
+
+u16 JOY_readJoypad(u16 joy) {
+    return (g_step < g_stepCount) ? g_buttons[g_step] : 0;
+}
+
+// Dump steps run as soon as the frames before them are over
+static void runDumps() {
+    char path[512];
+    while(g_step < g_stepCount && g_dumpNames[g_step][0]) {
+        snprintf(path, sizeof(path), "%s/%s.%s", g_dumpDir, g_dumpNames[g_step], g_dumpSRAM[g_step] ? "srm" : "bin");
+        if(g_dumpSRAM[g_step]) HOST_dumpSRAM(path);
+        else HOST_dumpVDP(path);
+        g_step++;
+    }
+    if(g_step >= g_stepCount) exit(0);
+}
+
+void SYS_doVBlankProcess(void) {
+    vtimer++;
+    if(g_step < g_stepCount && ++g_stepFrame >= g_frames[g_step]) {
+        g_step++;
+        g_stepFrame = 0;
+    }
+    runDumps();
+}
+
+// The mapper only exists on the cartridge, far data is plain memory here
+void bankInit(const void* farEnd) { (void) farEnd; }
+const void* bankMapFar(const void* data) { return data; }
+
+int main(int argc, char **argv) {
+    if(argc != 3) {
+        fprintf(stderr, "usage: headless <script> <dump dir>\n");
+        return 1;
+    }
+    loadScript(argv[1]);
+    g_dumpDir = argv[2];
+    return game_main();
+}
@@ -0,0 +1,253 @@
+// Host implementation of the SGDK calls the game makes. Writes go to a
+// software copy of VRAM, CRAM and VSRAM laid out like SGDK's defaults so
+// the dump can be rendered by render_vdp.py. DMA transfers happen at once.
+#include <genesis.h>
+
+#define PLANE_A_ADDR    0xC000
+#define PLANE_B_ADDR    0xE000
+#define WINDOW_ADDR     0xB000
+#define HSCROLL_ADDR    0xB800
+#define SAT_ADDR        0xBC00
+#define PLANE_W         64
+#define PLANE_H         32
+
+static u8 g_vram[0x10000];
+static u16 g_cram[64];
+static u16 g_vsram[40];
+static u16 g_hscrollMode = HSCROLL_PLANE;
+static u16 g_vscrollMode = VSCROLL_PLANE;
+static u16 g_windowH = 0;
+static u16 g_windowV = 0;
+static u8 g_bgColor = 0;
+static u16 g_randomSeed = 0x1234;
+static u8 g_sram[0x10000];              // Byte offsets as SGDK's SRAM_* take them
+
+VDPSprite vdpSpriteCache[80];
+vu32 vtimer = 0;
+
+// ---------- VRAM ----------
+static void writeWord(u16 addr, u16 value) {
+    g_vram[addr & 0xFFFE] = value >> 8;
+    g_vram[(addr & 0xFFFE) + 1] = value & 0xFF;
+}
+
+static u16 planeAddr(VDPPlane plane) {
+    switch(plane) {
+        case BG_A: return PLANE_A_ADDR;
+        case WINDOW: return WINDOW_ADDR;
+        default: return PLANE_B_ADDR;
+    }
+}
+
+static void writeTile(VDPPlane plane, u16 tile, u16 x, u16 y) {
+    writeWord(planeAddr(plane) + (y * PLANE_W + x) * 2, tile);
+}
+
+void VDP_loadTileData(const u32 *data, u16 index, u16 num, TransferMethod tm) {
+    u16 addr = index * TILE_SIZE;
+    for(u32 i = 0; i < num * 8u; i++, addr += 4) {
+        writeWord(addr, data[i] >> 16);
+        writeWord(addr + 2, data[i] & 0xFFFF);
+    }
+}
+
+u16 VDP_loadTileSet(const TileSet *ts, u16 index, TransferMethod tm) {
+    VDP_loadTileData(ts->tiles, index, ts->numTile, tm);
+    return TRUE;
+}
+
+void VDP_fillTileData(u8 value, u16 index, u16 num, bool wait) {
+    for(u32 i = 0; i < num * (u32) TILE_SIZE; i++) g_vram[(index * TILE_SIZE + i) & 0xFFFF] = value;
+}
+
+void VDP_clearPlane(VDPPlane plane, bool wait) {
+    for(u16 i = 0; i < PLANE_W * PLANE_H; i++) writeWord(planeAddr(plane) + i * 2, 0);
+}
+
+void VDP_setTileMapXY(VDPPlane plane, u16 tile, u16 x, u16 y) {
+    writeTile(plane, tile, x, y);
+}
+
+void VDP_fillTileMapRect(VDPPlane plane, u16 tile, u16 x, u16 y, u16 w, u16 h) {
+    for(u16 j = 0; j < h; j++)
+        for(u16 i = 0; i < w; i++) writeTile(plane, tile, x + i, y + j);
+}
+
+void VDP_fillTileMapRectInc(VDPPlane plane, u16 basetile, u16 x, u16 y, u16 w, u16 h) {
+    for(u16 j = 0; j < h; j++)
+        for(u16 i = 0; i < w; i++) writeTile(plane, basetile++, x + i, y + j);
+}
+
+void VDP_clearTileMapRect(VDPPlane plane, u16 x, u16 y, u16 w, u16 h) {
+    VDP_fillTileMapRect(plane, 0, x, y, w, h);
+}
+
+void VDP_setTileMapDataRow(VDPPlane plane, const u16 *data, u16 row, u16 x, u16 w, TransferMethod tm) {
+    for(u16 i = 0; i < w; i++) writeTile(plane, data[i], x + i, row);
+}
+
+void VDP_setTileMapDataRect(VDPPlane plane, const u16 *data, u16 x, u16 y, u16 w, u16 h, u16 wm, TransferMethod tm) {
+    for(u16 j = 0; j < h; j++)
+        for(u16 i = 0; i < w; i++) writeTile(plane, data[j * wm + i], x + i, y + j);
+}
+
+// ---------- palettes ----------
+void VDP_setBackgroundColor(u8 c) { g_bgColor = c & 63; }
+void PAL_setColor(u16 i, u16 v) { g_cram[i & 63] = v; }
+
+void PAL_setColors(u16 index, const u16 *pal, u16 count, TransferMethod tm) {
+    for(u16 i = 0; i < count; i++) g_cram[(index + i) & 63] = pal[i];
+}
+
+void PAL_setPalette(u16 n, const u16 *pal, TransferMethod tm) {
+    PAL_setColors(n * 16, pal, 16, tm);
+}
+
+void PAL_getColors(u16 index, u16 *dest, u16 count) {
+    for(u16 i = 0; i < count; i++) dest[i] = g_cram[(index + i) & 63];
+}
+
+// ---------- scrolling ----------
+static void writeHScroll(VDPPlane plane, u16 line, s16 value) {
+    writeWord(HSCROLL_ADDR + line * 4 + (plane == BG_B ? 2 : 0), value);
+}
+
+void VDP_setScrollingMode(u16 hscroll, u16 vscroll) {
+    g_hscrollMode = hscroll;
+    g_vscrollMode = vscroll;
+}
+
+void VDP_setHorizontalScroll(VDPPlane plane, s16 value) { writeHScroll(plane, 0, value); }
+void VDP_setHorizontalScrollVSync(VDPPlane plane, s16 value) { writeHScroll(plane, 0, value); }
+void VDP_setVerticalScroll(VDPPlane plane, s16 value) { g_vsram[plane == BG_B ? 1 : 0] = value; }
+void VDP_setVerticalScrollVSync(VDPPlane plane, s16 value) { g_vsram[plane == BG_B ? 1 : 0] = value; }
+
+void VDP_setHorizontalScrollLine(VDPPlane plane, u16 line, s16 *values, u16 len, TransferMethod tm) {
+    for(u16 i = 0; i < len; i++) writeHScroll(plane, line + i, values[i]);
+}
+
+void VDP_setHorizontalScrollTile(VDPPlane plane, u16 tile, s16 *values, u16 len, TransferMethod tm) {
+    for(u16 i = 0; i < len; i++) writeHScroll(plane, (tile + i) * 8, values[i]);
+}
+
+void VDP_setVerticalScrollTile(VDPPlane plane, u16 tile, s16 *values, u16 len, TransferMethod tm) {
+    for(u16 i = 0; i < len && tile + i < 20; i++) g_vsram[(tile + i) * 2 + (plane == BG_B ? 1 : 0)] = values[i];
+}
+
+void VDP_setWindowHPos(bool right, u16 pos) { g_windowH = (right ? 0x80 : 0) | (pos & 0x1F); }
+void VDP_setWindowVPos(bool down, u16 pos) { g_windowV = (down ? 0x80 : 0) | (pos & 0x1F); }
+
+u16 VDP_getScreenHeight(void) { return 224; }
+
+// ---------- sprites ----------
+void VDP_setSpriteFull(u16 index, s16 x, s16 y, u8 size, u16 attribut, u8 link) {
+    VDPSprite *s = &vdpSpriteCache[index];
+    s->x = x + 128;
+    s->y = y + 128;
+    s->size = size;
+    s->attribut = attribut;
+    s->link = link;
+}
+
+void VDP_updateSprites(u16 num, TransferMethod tm) {
+    for(u16 i = 0; i < num; i++) {
+        const VDPSprite *s = &vdpSpriteCache[i];
+        u16 addr = SAT_ADDR + i * 8;
+        writeWord(addr, s->y);
+        writeWord(addr + 2, (s->size << 8) | s->link);
+        writeWord(addr + 4, s->attribut);
+        writeWord(addr + 6, s->x);
+    }
+}
+
+void VDP_resetSprites(void) {
+    memset(vdpSpriteCache, 0, sizeof(vdpSpriteCache));
+    VDP_updateSprites(1, CPU);
+}
+
+// ---------- everything else ----------
+bool SYS_isPAL(void) { return FALSE; }
+bool SYS_isNTSC(void) { return TRUE; }
+u32 getTick(void) { return vtimer * 5; }
+
+void XGM_setLoopNumber(s8 n) {}
+void XGM_startPlay(const u8 *song) {}
+void XGM_pausePlay(void) {}
+void XGM_resumePlay(void) {}
+void XGM_stopPlay(void) {}
+u8 XGM_isPlaying(void) { return FALSE; }
+void XGM_setMusicTempo(u16 v) {}
+
+// No Z80 here, the XGM stand in never lets a custom driver load
+void Z80_requestBus(bool wait) {}
+void Z80_releaseBus(void) {}
+bool Z80_isBusTaken(void) { return FALSE; }
+void Z80_loadCustomDriver(const u8 *drv, u16 size) {}
+u16 Z80_getLoadedDriver(void) { return Z80_DRIVER_XGM; }
+void Z80_unloadDriver(void) {}
+
+void SRAM_enable(void) {}
+void SRAM_enableRO(void) {}
+void SRAM_disable(void) {}
+u8 SRAM_readByte(u32 offset) { return g_sram[offset & 0xFFFF]; }
+u16 SRAM_readWord(u32 offset) { return (SRAM_readByte(offset) << 8) | SRAM_readByte(offset + 1); }
+u32 SRAM_readLong(u32 offset) { return ((u32) SRAM_readWord(offset) << 16) | SRAM_readWord(offset + 2); }
+void SRAM_writeByte(u32 offset, u8 val) { g_sram[offset & 0xFFFF] = val; }
+void SRAM_writeWord(u32 offset, u16 val) { SRAM_writeByte(offset, val >> 8); SRAM_writeByte(offset + 1, val); }
+void SRAM_writeLong(u32 offset, u32 val) { SRAM_writeWord(offset, val >> 16); SRAM_writeWord(offset + 2, val); }
+
+u16 uintToStr(u32 value, char *str, u16 minsize) {
+    char tmp[12];
+    u16 len = 0;
+    do {
+        tmp[len++] = '0' + value % 10;
+        value /= 10;
+    } while(value || len < minsize);
+    for(u16 i = 0; i < len; i++) str[i] = tmp[len - 1 - i];
+    str[len] = 0;
+    return len;
+}
+
+u16 random(void) {
+    g_randomSeed ^= (g_randomSeed >> 1) ^ 0x7A4D;
+    g_randomSeed ^= g_randomSeed << 3;
+    return g_randomSeed;
+}
+
+// ---------- dump ----------
+static void putWord(FILE *f, u16 v) {
+    fputc(v >> 8, f);
+    fputc(v & 0xFF, f);
+}
+
+// "VDPDUMP1", 12 big endian u16 registers, VRAM, CRAM, VSRAM
+void HOST_dumpVDP(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if(!f) return;
+
+    fwrite("VDPDUMP1", 1, 8, f);
+    putWord(f, PLANE_A_ADDR);
+    putWord(f, PLANE_B_ADDR);
+    putWord(f, WINDOW_ADDR);
+    putWord(f, HSCROLL_ADDR);
+    putWord(f, SAT_ADDR);
+    putWord(f, PLANE_W);
+    putWord(f, PLANE_H);
+    putWord(f, g_hscrollMode);
+    putWord(f, g_vscrollMode);
+    putWord(f, g_windowH);
+    putWord(f, g_windowV);
+    putWord(f, g_bgColor);
+    fwrite(g_vram, 1, sizeof(g_vram), f);
+    for(u16 i = 0; i < 64; i++) putWord(f, g_cram[i]);
+    for(u16 i = 0; i < 40; i++) putWord(f, g_vsram[i]);
+    fclose(f);
+}
+
+// SRAM bytes in offset order, as emulators save 8 bit SRAM
+void HOST_dumpSRAM(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if(!f) return;
+    fwrite(g_sram, 1, sizeof(g_sram), f);
+    fclose(f);
+}
@@ -0,0 +1,8 @@
+// Host stand in for the header bintos writes for src/z80_unpack.s80,
+// there is no Z80 driver to load here (see Z80_getLoadedDriver()).
+#ifndef _Z80_UNPACK_H_
+#define _Z80_UNPACK_H_
+
+static const u8 z80_unpack[1] = { 0x76 };    // halt
+
+#endif
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+# Builds the benchmark runner (thirdparty/bench) with the Musashi 68000 core
+# from thirdparty/musashi, or a clone of it in out/bench while it's not
+# vendored there, and runs the built ROM with recorded inputs. The
+# report goes to out/bench/report.txt and the sampled stacks, folded for
+# flame graph tools, to out/bench/profile.folded.
+#
+# Extra arguments go to the runner: --focus f,g  --sample cycles  --frames n
+import os, subprocess, sys
+from pathlib import Path
+
+MUSASHI = Path('thirdparty/musashi')
+MUSASHI_GIT = 'https://github.com/kstenerud/Musashi.git'
+BENCH = Path('thirdparty/bench')
+BUILD_DIR = Path('out/bench')
+# The runner's own code builds clean with these, the core with the defaults
+BENCH_WARNINGS = ['-Wall', '-Wextra']
+
+# ---------- build ----------
+def musashi_dir():
+    """The vendored core, else a clone made on the first run."""
+    if (MUSASHI / 'm68kcpu.c').exists():
+        return MUSASHI
+    fetched = BUILD_DIR / 'musashi'
+    if not (fetched / 'm68kcpu.c').exists():
+        print(f'Musashi is not in {MUSASHI}, cloning {MUSASHI_GIT}')
+        if subprocess.run(['git', 'clone', '--depth', '1', MUSASHI_GIT, str(fetched)]).returncode:
+            raise SystemExit(f'Musashi sources missing, see {MUSASHI / "README.md"}')
+    return fetched
+
+def generate_ops(cc, musashi):
+    """Musashi's opcode handlers are generated from m68k_in.c by m68kmake."""
+    if (musashi / 'm68kops.c').exists():
+        return
+    tool = BUILD_DIR / 'm68kmake'
+    subprocess.run([cc, '-O1', str(musashi / 'm68kmake.c'), '-o', str(tool)], check=True)
+    subprocess.run([str(tool.resolve()), '.', 'm68k_in.c'], cwd=musashi, check=True)
+
+def build_bench():
+    BUILD_DIR.mkdir(parents=True, exist_ok=True)
+    musashi = musashi_dir()
+    cc = os.environ.get('CC', 'gcc')
+    generate_ops(cc, musashi)
+    core = [musashi / n for n in ('m68kcpu.c', 'm68kops.c', 'm68kdasm.c', 'softfloat/softfloat.c')]
+    sources = [(p, []) for p in core if p.exists()] + [(p, BENCH_WARNINGS) for p in sorted(BENCH.glob('*.c'))]
+    objects = []
+    for src, warnings in sources:
+        obj = BUILD_DIR / (src.stem + '.o')
+        subprocess.run([cc, '-std=gnu99', '-O2', *warnings, f'-I{musashi}', f'-I{BENCH}',
+                        '-DMUSASHI_CNF="m68k_bench_conf.h"', '-c', str(src), '-o', str(obj)], check=True)
+        objects.append(str(obj))
+    exe = BUILD_DIR / 'bench'
+    subprocess.run([cc, *objects, '-lm', '-o', str(exe)], check=True)
+    return exe
+
+# ---------- main ----------
+def main():
+    if len(sys.argv) < 4:
+        print("Usage: bench.py <rom.bin> <rom.out> <inputs> [runner options]")
+        sys.exit(1)
+    exe = build_bench()
+    result = subprocess.run([str(exe.resolve()), *sys.argv[1:], '--out', str(BUILD_DIR)])
+    sys.exit(result.returncode)
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/bench.py out/rom.bin out/rom.out data/bench/intro_quiz.txt
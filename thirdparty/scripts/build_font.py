@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+# Builds the font tileset from Font.png keeping only the glyphs used by the
+# game content and the strings in the C sources.
+import re, sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent))
+import image_io
+from compile_data import parse_scenes, parse_questions_csv, parse_quizzes
+
+GLYPH_W, GLYPH_H = 8, 16
+GRID_COLS = 16
+FIRST_CHAR = 32
+CHAR_COUNT = 96
+SPACE_WIDTH = 4
+
+# String literals, char literals and comments are matched together so
+# quotes inside comments and '"' don't start a string
+C_TOKEN = re.compile(r'"((?:[^"\\\n]|\\.)*)"|\'(?:[^\'\\\n]|\\.)*\'|//[^\n]*|/\*.*?\*/', re.S)
+C_FORMAT = re.compile(r'%[-+ #0-9.]*[a-zA-Z]')
+
+# ---------- helpers ----------
+def collect_content_strings(scenes, questions_rows, quizzes):
+    for s in scenes:
+        yield s.get('text', '')
+        for c in s.get('choice', []):
+            yield c.partition('->')[0].strip()
+    for q in questions_rows:
+        for k in ('category', 'question', 'answer_a', 'answer_b', 'answer_c'):
+            yield q.get(k, '')
+    for qz in quizzes:
+        yield qz.get('name', '')
+        yield from qz['categories']
+
+def collect_source_strings(src_dir: Path, skip):
+    for path in sorted(src_dir.glob('*.c')):
+        if path.name in skip:
+            continue
+        for m in C_TOKEN.finditer(path.read_text(encoding='utf-8')):
+            if m.group(1) is None:
+                continue
+            s = bytes(m.group(1), 'utf-8').decode('unicode_escape')
+            yield C_FORMAT.sub('', s)
+
+def glyph_tiles(img, ci):
+    gx, gy = ci % GRID_COLS, ci // GRID_COLS
+    top = image_io.tile_rows(img, gx, gy * 2)
+    bottom = image_io.tile_rows(img, gx, gy * 2 + 1)
+    return top, bottom
+
+def glyph_metrics(rows):
+    used = 0
+    for r in rows:
+        used |= r
+    if not used:
+        return 0, SPACE_WIDTH
+    cols = [x for x in range(8) if used & (0xF0000000 >> (x * 4))]
+    return cols[0], cols[-1] - cols[0] + 1
+
+# ---------- main ----------
+def main():
+    if len(sys.argv) < 7:
+        print("Usage: build_font.py <Font.png> <scenes.txt> <questions.csv> <quizzes.txt> <src_dir> <out_c_path> [<lang>=<dir> ...]")
+        sys.exit(1)
+
+    font_path = Path(sys.argv[1])
+    src_dir   = Path(sys.argv[5])
+    out_c     = Path(sys.argv[6])
+    translations = [a.split('=', 1) for a in sys.argv[7:]]
+
+    img = image_io.read_png(font_path)
+    if img.palette is None:
+        raise SystemExit(f'{font_path}: font must be an indexed PNG')
+
+    strings = list(collect_content_strings(parse_scenes(Path(sys.argv[2])),
+                                           parse_questions_csv(Path(sys.argv[3])),
+                                           parse_quizzes(Path(sys.argv[4]))))
+    # same translation dirs as compile_data, quizzes are not translated
+    for code, tdir in translations:
+        tdir = Path(tdir)
+        strings += collect_content_strings(parse_scenes(tdir / 'scenes.txt'),
+                                           parse_questions_csv(tdir / 'questions.csv'), [])
+    strings += collect_source_strings(src_dir, {out_c.name, 'data_load.c'})
+
+    # space is glyph 0, digits are always there for printed numbers
+    used = {' '} | set('0123456789')
+    for s in strings:
+        used |= {c for c in s if FIRST_CHAR <= ord(c) < FIRST_CHAR + CHAR_COUNT - 1}
+    chars = [' '] + sorted(used - {' '})
+
+    remap = [0] * CHAR_COUNT
+    tiles, lefts, widths = [], [], []
+    for slot, c in enumerate(chars):
+        ci = ord(c) - FIRST_CHAR
+        remap[ci] = slot
+        top, bottom = glyph_tiles(img, ci)
+        tiles.append((c, top + bottom))
+        left, width = glyph_metrics(top + bottom)
+        lefts.append(left)
+        widths.append(width)
+
+    pal = [image_io.rgb_to_vdp(*c) for c in img.palette[:16]]
+    pal += [0] * (16 - len(pal))
+
+    lines = []
+    emit = lines.append
+
+    emit('#include <genesis.h>')
+    emit('#include "font_data.h"')
+    emit('')
+    # no backslash in the comment, it would splice the next line
+    emit(f'// {len(chars)} of {CHAR_COUNT - 1} glyphs used: ' + ''.join(c for c in chars if c != '\\'))
+    emit(f'const u16 FONT_GLYPH_COUNT = {len(chars)};')
+    emit('')
+    emit('// ---- ASCII - 32 -> glyph, unused characters show as space ----')
+    emit('const u8 FONT_REMAP[96] = {')
+    for i in range(0, CHAR_COUNT, 16):
+        emit('  ' + ' '.join(f'{v},' for v in remap[i:i + 16]))
+    emit('};')
+    emit('')
+    emit('// ---- Glyph metrics in pixels ----')
+    emit('const u8 FONT_GLYPH_LEFT[] = { ' + ', '.join(str(v) for v in lefts) + ' };')
+    emit('const u8 FONT_GLYPH_WIDTH[] = { ' + ', '.join(str(v) for v in widths) + ' };')
+    emit('')
+    emit('// ---- Palette ----')
+    emit('const u16 FONT_PALETTE[16] = { ' + ', '.join(f'0x{v:03X}' for v in pal) + ' };')
+    emit('')
+    emit('// ---- Tiles, 2 per glyph: top then bottom ----')
+    emit('const u32 FONT_TILES[] = {')
+    for c, rows in tiles:
+        emit(f'  // {c!r}')
+        emit('  ' + ', '.join(f'0x{r:08X}' for r in rows[:8]) + ',')
+        emit('  ' + ', '.join(f'0x{r:08X}' for r in rows[8:]) + ',')
+    emit('};')
+    emit('')
+
+    out_c.parent.mkdir(parents=True, exist_ok=True)
+    out_c.write_text("\n".join(lines), encoding='utf-8', newline='\r\n')
+    print(f"Wrote {out_c} ({len(chars)} glyphs, {len(chars) * 2} tiles)")
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/build_font.py res/Font.png data/scenes.txt data/questions.csv data/quizzes.txt src src/font_data.c [<lang>=<dir> ...]
@@ -0,0 +1,452 @@
+#!/usr/bin/env python3
+# Builds full screen illustrations for plane B. Each image is scaled to
+# fit 320x224 and letterboxed in black, reduced to up to four 16 color palettes chosen per tile,
+# cut into tiles deduplicated with flipped copies, and merged down to the
+# VRAM tile budget when it still doesn't fit. Tiles and tilemap are packed
+# with the windowed LZ decoded by lz_stream.c, and the upload cost of each
+# illustration is printed.
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent))
+import image_io
+
+SCREEN_W, SCREEN_H = 320, 224
+COLS, ROWS = SCREEN_W // 8, SCREEN_H // 8
+MAX_TILES = 946             # ILLUSTRATION_MAX_TILES in inc/illustration.h
+FONT_WHITE = 0xEEE          # PAL0 color 1 is the text color (FONT_PALETTE)
+KMEANS_PASSES = 6
+
+# Upload cost model, NTSC H40
+VBLANK_DMA_BYTES = 7524     # 68000 RAM to VRAM per vblank with the display on
+LZ_CYCLES_PER_BYTE = 56     # lzStreamRead on the 68000
+FRAME_CYCLES = 127840
+
+# LZ format (lz_stream.h): u16 unpacked size, then tokens. 0x00-0x7F copies
+# the next n + 1 bytes, 0x80-0xFF repeats (n & 0x7F) + 3 bytes from
+# distance next byte + 1. The window is the last 256 bytes of output.
+LZ_WINDOW = 256
+LZ_MIN_MATCH = 3
+LZ_MAX_MATCH = 0x7F + LZ_MIN_MATCH
+LZ_MAX_LITERALS = 0x80
+
+# ---------- helpers ----------
+def parse_illustrations(path: Path):
+    items = []
+    cur = {}
+    with path.open('r', encoding='utf-8') as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            if line.startswith('ILLUSTRATION:'):
+                if cur:
+                    items.append(cur)
+                cur = {'name': line.split(':', 1)[1].strip(), 'palettes': '4'}
+            else:
+                k, v = line.split(':', 1)
+                cur[k.strip()] = v.strip()
+        if cur:
+            items.append(cur)
+    return items
+
+def scale_contain(img):
+    """Box filter down to fit SCREEN_W x SCREEN_H, black bars on the shorter side.
+
+    The picture starts on a tile edge, a bar ending mid tile would cost a
+    row (or column) of tiles more.
+    """
+    s = min(SCREEN_W / img.width, SCREEN_H / img.height)
+    w = min(SCREEN_W, round(img.width * s))
+    h = min(SCREEN_H, round(img.height * s))
+    ox = (SCREEN_W - w) // 2 // 8 * 8
+    oy = (SCREEN_H - h) // 2 // 8 * 8
+    out = []
+    for y in range(SCREEN_H):
+        if not oy <= y < oy + h:
+            out += [(0, 0, 0)] * SCREEN_W
+            continue
+        y0 = min(img.height - 1, int((y - oy) / s))
+        y1 = max(y0 + 1, min(img.height, int((y + 1 - oy) / s)))
+        for x in range(SCREEN_W):
+            if not ox <= x < ox + w:
+                out.append((0, 0, 0))
+                continue
+            x0 = min(img.width - 1, int((x - ox) / s))
+            x1 = max(x0 + 1, min(img.width, int((x + 1 - ox) / s)))
+            r = g = b = n = 0
+            for sy in range(y0, y1):
+                for sx in range(x0, x1):
+                    p = img.rgba(sx, sy)
+                    a = p[3]
+                    r += p[0] * a
+                    g += p[1] * a
+                    b += p[2] * a
+                    n += 255
+            out.append((r // n, g // n, b // n))
+    return out
+
+def to_vdp(rgb):
+    """Nearest VDP color, channels are 3 bits scaled like vdp_to_rgb."""
+    r, g, b = (min(7, (v + 18) // 36) for v in rgb)
+    return (r << 1) | (g << 5) | (b << 9)
+
+def dist(a, b):
+    ar, ag, ab = image_io.vdp_to_rgb(a)
+    br, bg, bb = image_io.vdp_to_rgb(b)
+    # Green counts most, blue least, close to perceived brightness
+    return 3 * (ar - br) ** 2 + 4 * (ag - bg) ** 2 + 2 * (ab - bb) ** 2
+
+def tile_histograms(pixels):
+    tiles = []
+    for ty in range(ROWS):
+        for tx in range(COLS):
+            hist = {}
+            for y in range(8):
+                for x in range(8):
+                    c = pixels[(ty * 8 + y) * SCREEN_W + tx * 8 + x]
+                    hist[c] = hist.get(c, 0) + 1
+            tiles.append(hist)
+    return tiles
+
+def pick_colors(hist, fixed, count):
+    """Weighted k-means over the distinct colors, fixed colors never move."""
+    colors = sorted(hist, key=lambda c: -hist[c])
+    centers = list(fixed)
+    # Farthest first seeding, deterministic for reproducible builds
+    while len(centers) < count and len(centers) < len(fixed) + len(colors):
+        best = max(colors, key=lambda c: hist[c] * min(dist(c, k) for k in centers))
+        if min(dist(best, k) for k in centers) == 0:
+            break
+        centers.append(best)
+    for _ in range(KMEANS_PASSES):
+        sums = {i: [0, 0, 0, 0] for i in range(len(centers))}
+        for c, n in hist.items():
+            i = min(range(len(centers)), key=lambda k: dist(c, centers[k]))
+            r, g, b = image_io.vdp_to_rgb(c)
+            acc = sums[i]
+            acc[0] += r * n
+            acc[1] += g * n
+            acc[2] += b * n
+            acc[3] += n
+        moved = list(fixed)
+        for i in range(len(fixed), len(centers)):
+            acc = sums[i]
+            c = to_vdp((acc[0] // acc[3], acc[1] // acc[3], acc[2] // acc[3])) if acc[3] else centers[i]
+            if c not in moved:
+                moved.append(c)
+        if moved == centers:
+            break
+        centers = moved
+    return centers
+
+def build_palettes(tiles, count):
+    """Tiles are clustered by the palette that draws them best.
+
+    Color 0 of every palette is the black backdrop and PAL0 keeps the text
+    color, so the text box stays readable over the picture.
+    """
+    fixed = [[0x000, FONT_WHITE]] + [[0x000]] * (count - 1)
+    # Start from brightness bands of the tile averages
+    def luma(hist):
+        total = sum(hist.values())
+        return sum(sum(image_io.vdp_to_rgb(c)) * n for c, n in hist.items()) / total
+    order = sorted(range(len(tiles)), key=lambda t: luma(tiles[t]))
+    groups = [0] * len(tiles)
+    for rank, t in enumerate(order):
+        groups[t] = rank * count // len(tiles)
+
+    palettes = []
+    for _ in range(KMEANS_PASSES):
+        palettes = []
+        for p in range(count):
+            hist = {}
+            for t, g in enumerate(groups):
+                if g == p:
+                    for c, n in tiles[t].items():
+                        hist[c] = hist.get(c, 0) + n
+            palettes.append(pick_colors(hist, fixed[p], 16))
+        nearest = [{} for _ in range(count)]
+        def error(t, p):
+            err = 0
+            for c, n in tiles[t].items():
+                if c not in nearest[p]:
+                    nearest[p][c] = min(dist(c, k) for k in palettes[p])
+                err += nearest[p][c] * n
+            return err
+        regrouped = [min(range(count), key=lambda p: error(t, p)) for t in range(len(tiles))]
+        if regrouped == groups:
+            break
+        groups = regrouped
+    return palettes, groups
+
+def index_tile(pixels, tx, ty, palette):
+    cache = {}
+    out = []
+    for y in range(8):
+        for x in range(8):
+            c = pixels[(ty * 8 + y) * SCREEN_W + tx * 8 + x]
+            if c not in cache:
+                cache[c] = min(range(len(palette)), key=lambda i: dist(c, palette[i]))
+            out.append(cache[c])
+    return tuple(out)
+
+def flips(t):
+    """(pixels, hflip, vflip) for the 4 orientations of a tile."""
+    rows = [t[y * 8:(y + 1) * 8] for y in range(8)]
+    h = tuple(v for r in rows for v in reversed(r))
+    v = tuple(p for r in reversed(rows) for p in r)
+    hv = tuple(p for r in reversed(rows) for p in reversed(r))
+    return [(t, 0, 0), (h, 1, 0), (v, 0, 1), (hv, 1, 1)]
+
+def dedupe(cells):
+    """cells: (pixels, pal) per screen cell -> tiles, map of (tile, pal, hflip, vflip)."""
+    tiles, index, cells_map = [], {}, []
+    flipped = 0
+    for pixels, pal in cells:
+        hit = None
+        for variant, h, v in flips(pixels):
+            if variant in index:
+                hit = (index[variant], h, v)
+                break
+        if hit is None:
+            index[pixels] = len(tiles)
+            tiles.append(pixels)
+            hit = (len(tiles) - 1, 0, 0)
+        elif hit[1] or hit[2]:
+            flipped += 1
+        cells_map.append((hit[0], pal, hit[1], hit[2]))
+    return tiles, cells_map, flipped
+
+def features(t, palette):
+    """4x4 block brightness plus mean color, cheap enough for k-means."""
+    rgb = [image_io.vdp_to_rgb(palette[i]) for i in t]
+    out = []
+    for by in range(4):
+        for bx in range(4):
+            s = 0
+            for y in range(2):
+                for x in range(2):
+                    r, g, b = rgb[(by * 2 + y) * 8 + bx * 2 + x]
+                    s += 3 * r + 4 * g + 2 * b
+            out.append(s / 4)
+    for ch in range(3):
+        out.append(sum(p[ch] for p in rgb) / 64 * 4)
+    return out
+
+def fdist(a, b):
+    return sum((x - y) ** 2 for x, y in zip(a, b))
+
+def merge_tiles(tiles, cells_map, palettes, budget):
+    """Lossy: cluster similar tiles per palette and keep the member nearest
+    each cluster center, until the tile count fits the budget."""
+    uses = [0] * len(tiles)
+    pal_of = [None] * len(tiles)
+    for t, pal, _, _ in cells_map:
+        uses[t] += 1
+        if pal_of[t] is None:
+            pal_of[t] = pal
+    feats = [features(t, palettes[pal_of[i]]) for i, t in enumerate(tiles)]
+
+    groups = {}
+    for i in range(len(tiles)):
+        groups.setdefault(pal_of[i], []).append(i)
+    # Clusters per palette in proportion to its tiles, at least one each
+    keys = sorted(groups)
+    quota = {p: max(1, len(groups[p]) * budget // len(tiles)) for p in keys}
+    while sum(quota.values()) > budget:
+        p = max(keys, key=lambda k: quota[k])
+        quota[p] -= 1
+    while sum(quota.values()) < budget:
+        p = max(keys, key=lambda k: len(groups[k]) - quota[k])
+        quota[p] += 1
+
+    replace = list(range(len(tiles)))
+    for p in keys:
+        members = groups[p]
+        k = quota[p]
+        if len(members) <= k:
+            continue
+        # The most used tiles seed the clusters, so the frequent ones survive
+        seeds = sorted(members, key=lambda i: -uses[i])[:k]
+        centers = [list(feats[i]) for i in seeds]
+        assign = {}
+        for _ in range(KMEANS_PASSES):
+            assign = {i: min(range(k), key=lambda c: fdist(feats[i], centers[c])) for i in members}
+            for c in range(k):
+                cluster = [i for i in members if assign[i] == c]
+                if cluster:
+                    w = sum(uses[i] for i in cluster)
+                    centers[c] = [sum(feats[i][d] * uses[i] for i in cluster) / w for d in range(len(feats[0]))]
+        for c in range(k):
+            cluster = [i for i in members if assign[i] == c]
+            if cluster:
+                keep = min(cluster, key=lambda i: fdist(feats[i], centers[c]))
+                for i in cluster:
+                    replace[i] = keep
+
+    cells = [(tiles[replace[t]], pal, h, v) for t, pal, h, v in cells_map]
+    # Merged tiles are re-deduped, the kept member may match a flipped copy
+    out = []
+    for pixels, pal, h, v in cells:
+        if h:
+            pixels = flips(pixels)[1][0]
+        if v:
+            pixels = tuple(p for r in reversed([pixels[y * 8:(y + 1) * 8] for y in range(8)]) for p in r)
+        out.append((pixels, pal))
+    return dedupe(out)
+
+def tile_bytes(t):
+    return bytes((t[i] << 4) | t[i + 1] for i in range(0, 64, 2))
+
+def lz_pack(data):
+    out = bytearray([(len(data) >> 8) & 0xFF, len(data) & 0xFF])
+    literals = bytearray()
+    heads = {}
+    i = 0
+
+    def flush():
+        for s in range(0, len(literals), LZ_MAX_LITERALS):
+            chunk = literals[s:s + LZ_MAX_LITERALS]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        literals.clear()
+
+    while i < len(data):
+        best_len, best_dist = 0, 0
+        key = bytes(data[i:i + LZ_MIN_MATCH])
+        if len(key) == LZ_MIN_MATCH:
+            for j in reversed(heads.get(key, [])):
+                if i - j > LZ_WINDOW:
+                    break
+                n = 0
+                while n < LZ_MAX_MATCH and i + n < len(data) and data[j + n] == data[i + n]:
+                    n += 1
+                if n > best_len:
+                    best_len, best_dist = n, i - j
+                    if n == LZ_MAX_MATCH:
+                        break
+        step = best_len if best_len >= LZ_MIN_MATCH else 1
+        for k in range(i, i + step):
+            heads.setdefault(bytes(data[k:k + LZ_MIN_MATCH]), []).append(k)
+        if best_len >= LZ_MIN_MATCH:
+            flush()
+            out.append(0x80 | (best_len - LZ_MIN_MATCH))
+            out.append(best_dist - 1)
+        else:
+            literals.append(data[i])
+        i += step
+    flush()
+    return bytes(out)
+
+def lz_unpack(packed):
+    """Reference decoder, checks lz_pack on every build."""
+    size = (packed[0] << 8) | packed[1]
+    out = bytearray()
+    i = 2
+    while len(out) < size:
+        c = packed[i]
+        if c & 0x80:
+            d = packed[i + 1] + 1
+            for _ in range((c & 0x7F) + LZ_MIN_MATCH):
+                out.append(out[-d])
+            i += 2
+        else:
+            out.extend(packed[i + 1:i + 2 + c])
+            i += 2 + c
+    return bytes(out)
+
+def c_bytes(emit, data):
+    for s in range(0, len(data), 16):
+        emit('  ' + ', '.join(f'0x{b:02X}' for b in data[s:s + 16]) + ',')
+
+# ---------- main ----------
+def main():
+    args = sys.argv[1:]
+    budget = MAX_TILES
+    if '--max-tiles' in args:
+        i = args.index('--max-tiles')
+        budget = int(args[i + 1])
+        del args[i:i + 2]
+    if len(args) != 2:
+        print("Usage: build_illustrations.py <illustrations.txt> <out_c_path> [--max-tiles n]")
+        sys.exit(1)
+
+    list_path = Path(args[0])
+    out_c = Path(args[1])
+    items = parse_illustrations(list_path)
+
+    lines = []
+    emit = lines.append
+    emit('#include <genesis.h>')
+    emit('#include "illustration_data.h"')
+    emit('')
+
+    print(f"{'illustration':<14} {'pals':>4} {'unique':>6} {'flip':>5} {'tiles':>5} "
+          f"{'vram':>6} {'tiles.lz':>8} {'map.lz':>6} {'dma':>5} {'unpack':>6}")
+    for it in items:
+        img = image_io.read_image(list_path.parent / it['image'])
+        count = int(it['palettes'])
+        if not 1 <= count <= 4:
+            raise SystemExit(f"{it['name']}: palettes must be 1 to 4")
+
+        pixels = [to_vdp(p) for p in scale_contain(img)]
+        palettes, groups = build_palettes(tile_histograms(pixels), count)
+        cells = [(index_tile(pixels, n % COLS, n // COLS, palettes[groups[n]]), groups[n])
+                 for n in range(COLS * ROWS)]
+        tiles, cells_map, flipped = dedupe(cells)
+        unique = len(tiles)
+        if len(tiles) > budget:
+            tiles, cells_map, flipped = merge_tiles(tiles, cells_map, palettes, budget)
+
+        tile_data = b''.join(tile_bytes(t) for t in tiles)
+        map_data = b''.join(((pal << 13) | (v << 12) | (h << 11) | t).to_bytes(2, 'big')
+                            for t, pal, h, v in cells_map)
+        packed_tiles, packed_map = lz_pack(tile_data), lz_pack(map_data)
+        if lz_unpack(packed_tiles) != tile_data or lz_unpack(packed_map) != map_data:
+            raise SystemExit(f"{it['name']}: LZ round trip failed")
+
+        # Tiles and map both cross the bus once, unpacking runs on the CPU
+        dma = len(tile_data) + len(map_data)
+        unpack = (len(tile_data) + len(map_data)) * LZ_CYCLES_PER_BYTE / FRAME_CYCLES
+        print(f"{it['name']:<14} {count:>4} {unique:>6} {flipped:>5} {len(tiles):>5} "
+              f"{len(tile_data):>6} {len(packed_tiles):>8} {len(packed_map):>6} "
+              f"{dma / VBLANK_DMA_BYTES:>4.1f}f {unpack:>5.1f}f")
+
+        pal_words = [c for p in palettes for c in p + [0] * (16 - len(p))]
+        emit(f"// ---- {it['name']}: {it['image']}, {len(tiles)} tiles ({unique} unique, "
+             f"{flipped} cells flipped), {len(packed_tiles) + len(packed_map)} bytes packed ----")
+        emit(f"static const u16 ILLUSTRATION_PALETTES_{it['name']}[{len(pal_words)}] = {{")
+        for s in range(0, len(pal_words), 16):
+            emit('  ' + ', '.join(f'0x{v:03X}' for v in pal_words[s:s + 16]) + ',')
+        emit('};')
+        emit(f"static const u8 ILLUSTRATION_TILES_{it['name']}[] = {{")
+        c_bytes(emit, packed_tiles)
+        emit('};')
+        emit(f"static const u8 ILLUSTRATION_MAP_{it['name']}[] = {{")
+        c_bytes(emit, packed_map)
+        emit('};')
+        emit('')
+        it['tiles'] = len(tiles)
+
+    emit('// ---- Illustrations, id = index + 1 (scene illustration 0 is none) ----')
+    emit(f'const u16 ILLUSTRATION_COUNT = {len(items)};')
+    emit('const Illustration ILLUSTRATIONS[] = {')
+    for i, it in enumerate(items):
+        n = it['name']
+        emit(f"  {{ {it['tiles']}, {it['palettes']}, ILLUSTRATION_TILES_{n}, ILLUSTRATION_MAP_{n}, "
+             f"ILLUSTRATION_PALETTES_{n} }},  // {i + 1}: {n}")
+    if not items:
+        emit('  { 0, 0, NULL, NULL, NULL }')
+    emit('};')
+    emit('')
+
+    out_c.parent.mkdir(parents=True, exist_ok=True)
+    out_c.write_text("\n".join(lines), encoding='utf-8', newline='\r\n')
+    print(f"Wrote {out_c} ({len(items)} illustrations, dma in vblanks of {VBLANK_DMA_BYTES} bytes, "
+          f"unpack in frames at {LZ_CYCLES_PER_BYTE} cycles/byte)")
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/build_illustrations.py data/illustrations.txt src/illustration_data.c
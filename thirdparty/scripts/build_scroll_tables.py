@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# Builds the scroll effect tables used by scroll_fx.c. Every table is laid
+# out so a frame is a contiguous window the VDP can take by one DMA.
+import math, sys
+from pathlib import Path
+
+SCREEN_LINES = 224
+SCREEN_ROWS = SCREEN_LINES // 8
+SCREEN_COLUMNS = 20             # 16 pixel vscroll columns
+PATTERN_SIZE = 64               # The quiz background repeats every 8 tiles
+
+WAVE_PERIOD = 64                # Lines per sine period, also the phase count
+WAVE_AMPLITUDE = 6              # Pixels
+COLUMN_PERIOD = 20              # Columns per sine period
+COLUMN_AMPLITUDE = 4
+PARALLAX_FRAMES = PATTERN_SIZE  # Integer speeds wrap seamlessly after this
+PARALLAX_SPEEDS = [1, 1, 2, 2, 3, 4, 3, 2, 2, 1, 1]  # Pixels per frame, top to bottom
+
+# ---------- tables ----------
+def sine_window(length, period, amplitude):
+    return [round(amplitude * math.sin(2 * math.pi * i / period)) for i in range(length)]
+
+def parallax_frames():
+    frames = []
+    for f in range(PARALLAX_FRAMES):
+        row = []
+        for r in range(SCREEN_ROWS):
+            speed = PARALLAX_SPEEDS[r * len(PARALLAX_SPEEDS) // SCREEN_ROWS]
+            row.append(-((f * speed) % PATTERN_SIZE))
+        frames.append(row)
+    return frames
+
+# ---------- output ----------
+def emit_array(lines, name, values, per_line=16):
+    lines.append(f'const s16 {name}[{len(values)}] = {{')
+    for i in range(0, len(values), per_line):
+        lines.append('  ' + ' '.join(f'{v},' for v in values[i:i + per_line]))
+    lines.append('};')
+    lines.append('')
+
+def main():
+    if len(sys.argv) != 3:
+        print("usage: build_scroll_tables.py <out.c> <out.h>")
+        sys.exit(1)
+    out_c, out_h = Path(sys.argv[1]), Path(sys.argv[2])
+
+    wave = sine_window(SCREEN_LINES + WAVE_PERIOD, WAVE_PERIOD, WAVE_AMPLITUDE)
+    columns = sine_window(SCREEN_COLUMNS + COLUMN_PERIOD, COLUMN_PERIOD, COLUMN_AMPLITUDE)
+    parallax = [v for frame in parallax_frames() for v in frame]
+
+    h = []
+    h.append('#ifndef SCROLL_TABLES_H')
+    h.append('#define SCROLL_TABLES_H')
+    h.append('')
+    h.append('#include <genesis.h>')
+    h.append('')
+    h.append('// Generated by build_scroll_tables.py')
+    h.append(f'#define SCROLL_LINES            {SCREEN_LINES}')
+    h.append(f'#define SCROLL_ROWS             {SCREEN_ROWS}')
+    h.append(f'#define SCROLL_COLUMNS          {SCREEN_COLUMNS}')
+    h.append(f'#define SCROLL_WAVE_PERIOD      {WAVE_PERIOD}')
+    h.append(f'#define SCROLL_COLUMN_PERIOD    {COLUMN_PERIOD}')
+    h.append(f'#define SCROLL_PARALLAX_FRAMES  {PARALLAX_FRAMES}')
+    h.append('')
+    h.append('extern const s16 SCROLL_WAVE[];        // Line offsets, frame = &SCROLL_WAVE[phase]')
+    h.append('extern const s16 SCROLL_COLUMN_WAVE[]; // Column offsets, frame = &SCROLL_COLUMN_WAVE[phase]')
+    h.append('extern const s16 SCROLL_PARALLAX[];    // Row offsets, frame = &SCROLL_PARALLAX[frame * SCROLL_ROWS]')
+    h.append('')
+    h.append('#endif')
+
+    c = []
+    c.append('#include <genesis.h>')
+    c.append('#include "scroll_tables.h"')
+    c.append('')
+    c.append(f'// ---- Sine wave, {WAVE_AMPLITUDE} px over {WAVE_PERIOD} lines ----')
+    emit_array(c, 'SCROLL_WAVE', wave)
+    c.append(f'// ---- Column sine wave, {COLUMN_AMPLITUDE} px over {COLUMN_PERIOD} columns ----')
+    emit_array(c, 'SCROLL_COLUMN_WAVE', columns, per_line=20)
+    c.append('// ---- Parallax bands, one frame of ' + str(SCREEN_ROWS) + ' rows per line ----')
+    emit_array(c, 'SCROLL_PARALLAX', parallax, per_line=SCREEN_ROWS)
+
+    for path, lines in ((out_c, c), (out_h, h)):
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text("\n".join(lines), encoding='utf-8', newline='\r\n')
+    size = (len(wave) + len(columns) + len(parallax)) * 2
+    print(f"Wrote {out_c} and {out_h} ({size} bytes of tables)")
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/build_scroll_tables.py src/scroll_tables.c inc/scroll_tables.h
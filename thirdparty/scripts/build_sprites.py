@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+# Builds metasprite animations from sprite sheets. Sheets are either a grid
+# of equal frames or an Aseprite export with its JSON data file next to it
+# (same name, .json), in which case frame rectangles and durations come
+# from the JSON.
+import json, sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent))
+import image_io
+
+MAX_PIECE_TILES = 4         # Hardware sprites are up to 4x4 tiles
+MAX_PIECES = 80             # Whole sprite table
+TICK_MS = 1000 / 60
+
+# ---------- helpers ----------
+def parse_sprites(path: Path):
+    sprites = []
+    cur = {}
+    with path.open('r', encoding='utf-8') as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            if line.startswith('SPRITE:'):
+                if cur:
+                    sprites.append(cur)
+                cur = {'name': line.split(':', 1)[1].strip(), 'x': '0', 'y': '0',
+                       'duration': '6', 'loop': '1'}
+            else:
+                k, v = line.split(':', 1)
+                cur[k.strip()] = v.strip()
+        if cur:
+            sprites.append(cur)
+    return sprites
+
+def sheet_frames(sprite, sheet_path: Path, img):
+    """(x, y, w, h, ticks) of each frame."""
+    data_path = sheet_path.with_suffix('.json')
+    if data_path.exists():
+        data = json.loads(data_path.read_text(encoding='utf-8'))
+        frames = data['frames']
+        if isinstance(frames, dict):
+            frames = list(frames.values())
+        out = []
+        for fr in frames:
+            r = fr['frame']
+            ticks = max(1, round(fr.get('duration', 100) / TICK_MS))
+            out.append((r['x'], r['y'], r['w'], r['h'], ticks))
+        return out
+
+    fw = int(sprite.get('frame_width', img.width))
+    fh = int(sprite.get('frame_height', img.height))
+    count = int(sprite.get('frames', (img.width // fw) * (img.height // fh)))
+    ticks = int(sprite['duration'])
+    cols = img.width // fw
+    return [((i % cols) * fw, (i // cols) * fh, fw, fh, ticks) for i in range(count)]
+
+def build_palette(img, transparent):
+    colors = []
+    for p in img.pixels:
+        rgba = p if img.palette is None else img.palette[p] + (255,)
+        if rgba[3] == 0 or rgba[:3] == transparent:
+            continue
+        c = image_io.rgb_to_vdp(*rgba[:3])
+        if c not in colors:
+            colors.append(c)
+    if len(colors) > 15:
+        raise SystemExit(f'{len(colors)} colors, sprites have 15 and transparency')
+    return [0] + colors
+
+def frame_tiles(img, rect, palette, transparent):
+    """Tile grid of a frame: tiles[ty][tx] = 8 u32 rows, None when empty."""
+    x0, y0, w, h = rect
+    tw, th = (w + 7) // 8, (h + 7) // 8
+    grid = []
+    for ty in range(th):
+        row = []
+        for tx in range(tw):
+            rows, used = [], False
+            for y in range(8):
+                v = 0
+                for x in range(8):
+                    px, py = tx * 8 + x, ty * 8 + y
+                    i = 0
+                    if px < w and py < h:
+                        rgba = img.rgba(x0 + px, y0 + py)
+                        if rgba[3] and rgba[:3] != transparent:
+                            i = palette.index(image_io.rgb_to_vdp(*rgba[:3]))
+                    v = (v << 4) | i
+                used |= v != 0
+                rows.append(v)
+            row.append(rows if used else None)
+        grid.append(row)
+    return grid
+
+def cut_pieces(grid):
+    """Cover the non empty tiles with hardware sprites of up to 4x4 tiles.
+
+    Returns (tx, ty, w, h, tiles) with tiles in VDP column-major order.
+    """
+    th, tw = len(grid), len(grid[0]) if grid else 0
+    used = [(x, y) for y in range(th) for x in range(tw) if grid[y][x]]
+    if not used:
+        return []
+    bx0, by0 = min(x for x, _ in used), min(y for _, y in used)
+    bx1, by1 = max(x for x, _ in used), max(y for _, y in used)
+
+    pieces = []
+    for py in range(by0, by1 + 1, MAX_PIECE_TILES):
+        for px in range(bx0, bx1 + 1, MAX_PIECE_TILES):
+            cells = [(x, y) for (x, y) in used
+                     if px <= x < px + MAX_PIECE_TILES and py <= y < py + MAX_PIECE_TILES]
+            if not cells:
+                continue
+            x0, y0 = min(x for x, _ in cells), min(y for _, y in cells)
+            x1, y1 = max(x for x, _ in cells), max(y for _, y in cells)
+            tiles = []
+            for x in range(x0, x1 + 1):
+                for y in range(y0, y1 + 1):
+                    tiles.append(grid[y][x] or [0] * 8)
+            pieces.append((x0, y0, x1 - x0 + 1, y1 - y0 + 1, tiles))
+    return pieces
+
+# ---------- main ----------
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: build_sprites.py <sprites.txt> <out_c_path>")
+        sys.exit(1)
+
+    sprites_path = Path(sys.argv[1])
+    out_c = Path(sys.argv[2])
+    sprites = parse_sprites(sprites_path)
+
+    lines = []
+    emit = lines.append
+    emit('#include <genesis.h>')
+    emit('#include "sprite_data.h"')
+    emit('')
+
+    all_pieces, all_frames, anims = [], [], []
+    for s in sprites:
+        sheet_path = sprites_path.parent / s['sheet']
+        img = image_io.read_png(sheet_path)
+        frames = sheet_frames(s, sheet_path, img)
+        key = s.get('transparent')
+        transparent = tuple(int(key[i:i + 2], 16) for i in (0, 2, 4)) if key else img.rgba(0, 0)[:3]
+        palette = build_palette(img, transparent)
+
+        tiles, tile_index = [], {}
+        first_frame = len(all_frames)
+        for (fx, fy, fw, fh, ticks) in frames:
+            pieces = cut_pieces(frame_tiles(img, (fx, fy, fw, fh), palette, transparent))
+            first_piece = len(all_pieces)
+            for (tx, ty, w, h, ptiles) in pieces:
+                key = tuple(tuple(t) for t in ptiles)
+                if key not in tile_index:
+                    tile_index[key] = len(tiles)
+                    tiles += ptiles
+                all_pieces.append((tx * 8, ty * 8, w, h, tile_index[key]))
+            if len(pieces) > MAX_PIECES:
+                raise SystemExit(f"{s['name']}: frame with {len(pieces)} sprites")
+            all_frames.append((first_piece, len(pieces), min(ticks, 255)))
+        anims.append((s, first_frame, len(frames), len(tiles)))
+
+        emit(f"// ---- {s['name']}: {s['sheet']}, {len(frames)} frames, {len(tiles)} tiles ----")
+        emit(f"static const u16 SPRITE_PALETTE_{s['name']}[16] = {{ "
+             + ', '.join(f'0x{v:03X}' for v in palette + [0] * (16 - len(palette))) + ' };')
+        emit(f"static const u32 SPRITE_TILES_{s['name']}[] = {{")
+        for t in tiles:
+            emit('  ' + ', '.join(f'0x{r:08X}' for r in t) + ',')
+        emit('};')
+        emit('')
+
+    for (x, y, w, h, _) in all_pieces:
+        if not (-128 <= x < 128 and -128 <= y < 128):
+            raise SystemExit('sprite frames must fit in 128x128')
+
+    emit('// ---- Pieces: x, y, size, first tile ----')
+    emit('const SpritePiece SPRITE_PIECES[] = {')
+    for (x, y, w, h, t) in all_pieces or [(0, 0, 1, 1, 0)]:
+        emit(f'  {{ {x}, {y}, SPRITE_SIZE({w}, {h}), {t} }},')
+    emit('};')
+    emit('')
+    emit('// ---- Frames: first piece, piece count, logic ticks ----')
+    emit('const SpriteFrame SPRITE_FRAMES[] = {')
+    for (p, n, d) in all_frames or [(0, 0, 1)]:
+        emit(f'  {{ {p}, {n}, {d} }},')
+    emit('};')
+    emit('')
+    emit('// ---- Animations, id = index + 1 (scene sprite 0 is none) ----')
+    emit(f'const u16 SPRITE_ANIM_COUNT = {len(anims)};')
+    emit('const SpriteAnim SPRITE_ANIMS[] = {')
+    for i, (s, first, count, ntiles) in enumerate(anims):
+        emit(f"  {{ {first}, {count}, {1 if s['loop'] != '0' else 0}, {int(s['x'])}, {int(s['y'])}, "
+             f"{ntiles}, SPRITE_TILES_{s['name']}, SPRITE_PALETTE_{s['name']} }},  // {i + 1}: {s['name']}")
+    if not anims:
+        emit('  { 0, 0, 0, 0, 0, 0, NULL, NULL }')
+    emit('};')
+    emit('')
+
+    out_c.parent.mkdir(parents=True, exist_ok=True)
+    out_c.write_text("\n".join(lines), encoding='utf-8', newline='\r\n')
+    print(f"Wrote {out_c} ({len(anims)} animations, {len(all_frames)} frames, {len(all_pieces)} pieces)")
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/build_sprites.py data/sprites.txt src/sprite_data.c
@@ -1,5 +1,5 @@
 #!/usr/bin/env python3
-import csv, re, sys, os
+import csv, json, re, sys, os
 from pathlib import Path
 
 # ---------- helpers ----------
@@ -32,6 +32,8 @@ def parse_scenes(path: Path):
                 cur['question_id'] = ''
                 cur['bg'] = '0'
                 cur['music'] = '0'
+                cur['sprite'] = '0'
+                cur['illustration'] = '0'
             else:
                 k, v = line.split(':', 1)
                 k = k.strip()
@@ -39,6 +41,9 @@ def parse_scenes(path: Path):
                 if k == 'text':
                     # pipes are newlines
                     v = v.replace('|', '\n')
+                if k in ('if_flag', 'choice'):
+                    cur.setdefault(k, []).append(v)
+                    continue
                 cur[k] = v
         if cur:
             scenes.append(cur)
@@ -102,16 +107,453 @@ def index_by_id(items, key):
         idx[it[key]] = i
     return idx
 
+# ---------- scene script ----------
+# Opcodes, in the order of SceneOp (inc/data_types.h). Operands follow the
+# opcode byte, u16 operands are stored big endian.
+#   OP_END                          stop the script
+#   OP_TEXT         u16 text        clear the text box and typewrite scene text [text]
+#   OP_WAIT_INPUT                   show "Continue..." and wait for A/B/C
+#   OP_WAIT         u8 frames       pause
+#   OP_JUMP         u16 offset      goto
+#   OP_SET_FLAG     u8 flag
+#   OP_CLEAR_FLAG   u8 flag
+#   OP_JUMP_IF_FLAG u8 flag, u16 offset
+#   OP_QUESTION     u16 question    hand over to the quiz manager (single question)
+#   OP_QUIZ         u16 quiz        hand over to the quiz manager (full quiz)
+#   OP_MUSIC        u8 music
+#   OP_BG           u8 background    also hides the illustration
+#   OP_ENDING       u8 SceneType    reach an ending
+#   OP_CHOICE       u16 scene       choice menu over the scene's SCENE_CHOICES edges
+#   OP_SPRITE       u8 sprite       sprite animation (data/sprites.txt order, 0 hides)
+#   OP_ILLUSTRATION u8 illustration full screen picture (data/illustrations.txt order, 0 hides)
+# flag 0 is set by the scene manager when the last quiz was passed
+FLAG_PASSED = 'passed'
+
+def u16_bytes(v):
+    return [(v >> 8) & 0xFF, v & 0xFF]
+
+def split_list(v):
+    return [x.strip() for x in v.split(',') if x.strip()]
+
+def compile_scene_script(scenes, scene_by_id, q_by_id, quiz_by_id):
+    """Compile scenes into one bytecode stream.
+
+    Optional scene keys on top of the classic ones:
+      wait:       frames to pause before the text
+      set_flag:   comma separated flags to set after the text
+      clear_flag: comma separated flags to clear after the text
+      if_flag:    flag -> scene, jump when the flag is set (may repeat)
+      choice:     label -> scene, menu entry replacing the A/B branch (may repeat)
+
+    Choices are returned as a CSR edge array: the edges of scene i are
+    choices[offsets[i]:offsets[i + 1]]. Choice labels are scene texts.
+    origins[t] is the first (scene_id, key) using text t, which is where
+    translations look the text up.
+    """
+    texts, text_index, origins = [], {}, []
+    flags = [FLAG_PASSED]
+    choices, choice_offsets = [], []
+
+    def text_id(t, scene_id, key):
+        if t not in text_index:
+            text_index[t] = len(texts)
+            texts.append(t)
+            origins.append((scene_id, key))
+        return text_index[t]
+
+    def flag_id(name):
+        if name not in flags:
+            flags.append(name)
+        if len(flags) > 256:
+            raise SystemExit('too many scene flags')
+        return flags.index(name)
+
+    def scene_ref(name):
+        return scene_by_id.get(name, -1) if name else -1
+
+    # pass 1: code with ('scene', idx) / ('local', n) placeholders, 2 bytes each
+    bodies = []
+    for s in scenes:
+        stype = s.get('type', 'normal').strip()
+        nextA = scene_ref(s.get('nextSceneA', '').strip())
+        nextB = scene_ref(s.get('nextSceneB', '').strip())
+        trig_quiz = s.get('trigger_quiz', '').strip()
+        question_id = s.get('question_id', '').strip()
+        trig_idx = quiz_by_id.get(trig_quiz, -1) if trig_quiz else -1
+        q_idx = q_by_id.get(question_id, -1) if question_id else -1
+
+        code = ['OP_BG', int(s.get('bg', '0') or 0), 'OP_MUSIC', int(s.get('music', '0') or 0),
+                'OP_SPRITE', int(s.get('sprite', '0') or 0)]
+        illustration = int(s.get('illustration', '0') or 0)
+        if illustration:
+            code += ['OP_ILLUSTRATION', illustration]
+        wait = int(s.get('wait', '0') or 0)
+        if wait:
+            code += ['OP_WAIT', min(wait, 255)]
+        choice_offsets.append(len(choices))
+        for n, c in enumerate(s.get('choice', [])):
+            label, _, target = c.partition('->')
+            t = scene_ref(target.strip())
+            if t < 0:
+                print(f"warning: scene {s['scene_id']}: unknown choice target '{target.strip()}'")
+                continue
+            choices.append((text_id(label.strip(), s['scene_id'], n), t))
+        has_choices = len(choices) > choice_offsets[-1]
+
+        code += ['OP_TEXT'] + u16_bytes(text_id(s.get('text', ''), s['scene_id'], 'text'))
+        if not has_choices:
+            code += ['OP_WAIT_INPUT']
+        for f in split_list(s.get('set_flag', '')):
+            code += ['OP_SET_FLAG', flag_id(f)]
+        for f in split_list(s.get('clear_flag', '')):
+            code += ['OP_CLEAR_FLAG', flag_id(f)]
+
+        if stype == 'quiz_trigger':
+            if q_idx >= 0:
+                code += ['OP_QUESTION'] + u16_bytes(q_idx)
+            elif trig_idx >= 0:
+                code += ['OP_QUIZ'] + u16_bytes(trig_idx)
+
+        for cond in s.get('if_flag', []):
+            flag, _, target = cond.partition('->')
+            t = scene_ref(target.strip())
+            if t < 0:
+                print(f"warning: scene {s['scene_id']}: unknown if_flag target '{target.strip()}'")
+                continue
+            code += ['OP_JUMP_IF_FLAG', flag_id(flag.strip()), ('scene', t)]
+
+        if has_choices:
+            code += ['OP_CHOICE'] + u16_bytes(len(bodies))
+        elif stype == 'good_ending':
+            code += ['OP_ENDING', 'SCENE_TYPE_GOOD_ENDING']
+        elif stype == 'bad_ending' or (nextA < 0 and nextB < 0):
+            code += ['OP_ENDING', 'SCENE_TYPE_BAD_ENDING']
+        elif nextA == nextB:
+            code += ['OP_JUMP', ('scene', nextA)]
+        elif nextB < 0:
+            code += ['OP_JUMP_IF_FLAG', 0, ('scene', nextA), 'OP_ENDING', 'SCENE_TYPE_BAD_ENDING']
+        elif nextA < 0:
+            # passed -> ending stub right after the jump to B
+            code += ['OP_JUMP_IF_FLAG', 0, ('local', 3), 'OP_JUMP', ('scene', nextB),
+                     'OP_ENDING', 'SCENE_TYPE_BAD_ENDING']
+        else:
+            code += ['OP_JUMP_IF_FLAG', 0, ('scene', nextA), 'OP_JUMP', ('scene', nextB)]
+        bodies.append(code)
+
+    def size(code):
+        return sum(2 if isinstance(c, tuple) else 1 for c in code)
+
+    entries, off = [], 0
+    for code in bodies:
+        entries.append(off)
+        off += size(code)
+    if off > 0xFFFF:
+        raise SystemExit('scene script larger than 64KB')
+
+    # pass 2: resolve placeholders
+    script = []
+    for i, code in enumerate(bodies):
+        out, pos = [], entries[i]
+        for c in code:
+            if isinstance(c, tuple):
+                kind, v = c
+                target = entries[v] if kind == 'scene' else pos + 2 + v
+                out += u16_bytes(target)
+                pos += 2
+            else:
+                out.append(c)
+                pos += 1
+        script.append((scenes[i]['scene_id'], out))
+    choice_offsets.append(len(choices))
+    return texts, origins, script, entries, flags, choices, choice_offsets
+
+# ---------- language packs ----------
+# Text is compiled into one object per language, laid out as a LangPack
+# header, the offset tables and the strings. compile_data places it in the
+# far data section so large packs can live in switchable banks, see bank.h.
+LANG_SECTION = '.rodata_binf'
+
+def translated_texts(texts, origins, scenes):
+    """Scene texts of a translation, in the text ids of the base scenes."""
+    by_id = {s['scene_id']: s for s in scenes}
+    out = []
+    for t, (scene_id, key) in zip(texts, origins):
+        s = by_id.get(scene_id)
+        v = None
+        if s is not None and key == 'text':
+            v = s.get('text')
+        elif s is not None and key < len(s.get('choice', [])):
+            v = s['choice'][key].partition('->')[0].strip()
+        if not v:
+            print(f"warning: no translation of scene {scene_id} {key}")
+            v = t
+        out.append(v)
+    return out
+
+def translated_questions(questions_rows, rows):
+    by_id = {r['id']: r for r in rows}
+    out = []
+    for q in questions_rows:
+        r = by_id.get(q['id'])
+        if r is None:
+            print(f"warning: no translation of question {q['id']}")
+            r = q
+        out.append([r.get(k, '') for k in ('question', 'answer_a', 'answer_b', 'answer_c')])
+    return out
+
+def emit_lang_pack(emit, code, texts, questions):
+    strings, offsets, index = [], [], {}
+    pos = 0
+    def add(t):
+        nonlocal pos
+        if t not in index:
+            index[t] = pos
+            strings.append(t)
+            pos += len(t.encode('utf-8')) + 1
+        return index[t]
+    text_offsets = [add(t) for t in texts]
+    question_offsets = [add(t) for q in questions for t in q]
+    if pos > 0x70000:
+        raise SystemExit(f'language pack {code} is larger than a bank')
+
+    name = f'LANG_{code.upper()}'
+    emit(f'// ---- Language pack: {code} ----')
+    emit('typedef struct {')
+    emit('  LangPack head;')
+    emit(f'  u32 sceneTexts[{max(1, len(text_offsets))}];')
+    emit(f'  u32 questionTexts[{max(1, len(question_offsets))}];')
+    emit(f'  char strings[{max(1, pos)}];')
+    emit(f'}} {name}_t;')
+    emit(f'static const {name}_t {name} __attribute__((section("{LANG_SECTION}"), aligned(2))) = {{')
+    emit(f'  {{ sizeof({name}_t), {len(texts)}, {len(questions)}, __builtin_offsetof({name}_t, sceneTexts), '
+         f'__builtin_offsetof({name}_t, questionTexts), __builtin_offsetof({name}_t, strings) }},')
+    for table in (text_offsets, question_offsets):
+        emit('  {')
+        for i in range(0, len(table), 16):
+            emit('    ' + ' '.join(f'{v},' for v in table[i:i + 16]))
+        if not table:
+            emit('    0,')
+        emit('  },')
+    emit('  {')
+    for t in strings:
+        emit(f'    "{esc_c(t)}\\0"')
+    if not strings:
+        emit('    ""')
+    emit('  }')
+    emit('};')
+    emit('')
+    size = 16 + 4 * (len(text_offsets) + len(question_offsets)) + pos
+    return f'&{name}.head', {'name': name, 'what': f'language pack {code}', 'far': True,
+                             'count': len(strings), 'bytes': size}
+
+# ---------- name lookup ----------
+# String IDs to indices through a minimal perfect hash (hash and displace):
+# a name's bucket holds the seed that sends it to its own slot among
+# count slots. dataFindName() in data_access.c hashes the same way.
+def name_hash(name, seed):
+    h = seed
+    for c in name.encode('utf-8'):
+        h = ((h ^ c) * 0x9E3B) & 0xFFFF
+    return h ^ (h >> 8)
+
+def build_name_hash(names):
+    count = len(names)
+    buckets = [[] for _ in range((count + 1) // 2 or 1)]
+    for i, n in enumerate(names):
+        buckets[name_hash(n, 0) % len(buckets)].append(i)
+    seeds, slots = [0] * len(buckets), [None] * count
+    # Fullest buckets first, while most slots are free
+    for b in sorted(range(len(buckets)), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        for seed in range(1, 0x10000):
+            want = [name_hash(names[i], seed) % count for i in buckets[b]]
+            if len(set(want)) == len(want) and all(slots[w] is None for w in want):
+                for w, i in zip(want, buckets[b]):
+                    slots[w] = i
+                seeds[b] = seed
+                break
+        else:
+            raise SystemExit(f'no perfect hash seed for {[names[i] for i in buckets[b]]}')
+    return seeds, [0 if x is None else x for x in slots]
+
+def emit_name_hash(emit, prefix, what, names):
+    if len(set(names)) != len(names):
+        raise SystemExit(f'duplicate {what} ids')
+    seeds, slots = build_name_hash(names)
+    emit(f'static const char * const {prefix}_STRINGS[] = {{')
+    for n in names:
+        emit(f'  "{esc_c(n)}",')
+    if not names:
+        emit('  "",')
+    emit('};')
+    emit(f'static const u16 {prefix}_SEEDS[] = {{ ' + ', '.join(str(v) for v in seeds) + ' };')
+    emit(f'static const u16 {prefix}_SLOTS[] = {{ ' + ', '.join(str(v) for v in slots or [0]) + ' };')
+    emit(f'const NameHash {prefix} = {{ {prefix}_STRINGS, {prefix}_SEEDS, {prefix}_SLOTS, {len(names)}, {len(seeds)} }};')
+    return {'name': f'{prefix}_STRINGS', 'what': f'{what} names (debug)', 'count': len(names),
+            'bytes': sum(4 + len(n) + 1 for n in names) + 2 * (len(seeds) + len(slots)) + 12}
+
+# ---------- cost model ----------
+# Estimated runtime cost of every scene page and quiz, checked against the
+# content budgets so long or broken text shows up at build time. Layout
+# numbers mirror the C side.
+FONT_PNG = Path('res') / 'Font.png'
+TEXT_DELAY = 1              # scene_manager.c, frames per typed character
+TEXTBOX_COLS = 36           # text_box.h
+TEXTBOX_LINES = 8
+TEXTBOX_TILES = 256
+TEXTBOX_Y = 7
+GLYPH_SPACING = 1           # text_box.c
+CHOICE_X = 4                # scene_manager.c
+CHOICE_BOTTOM = 26
+SCREEN_COLS = 40
+QUESTION_X = 2              # quiz_manager.c
+ANSWER_X = 4 + 3
+CATEGORY_X = 14 + 3
+CATEGORY_KEYS = 3           # A, B and C pick a category
+
+def glyph_widths(font_path: Path):
+    """Pixel width of every printable character, as the text box advances."""
+    import build_font, image_io
+    img = image_io.read_png(font_path)
+    widths = {}
+    for ci in range(build_font.CHAR_COUNT - 1):
+        top, bottom = build_font.glyph_tiles(img, ci)
+        widths[chr(build_font.FIRST_CHAR + ci)] = build_font.glyph_metrics(top + bottom)[1]
+    return widths
+
+def wrap_lines(text, widths):
+    """Cells with a glyph on each text box line of a scene text, wrapped
+    between words like textBoxPutChar()."""
+    line_px = TEXTBOX_COLS * 8
+    width = lambda c: widths.get(c, widths[' '])
+    lines, pen, word_start = [set()], 0, True
+    for i, c in enumerate(text):
+        if c == '\n':
+            lines, pen, word_start = lines + [set()], 0, True
+            continue
+        breaks = pen + width(c) > line_px
+        if not breaks and word_start and pen and c != ' ':
+            word = re.match(r'[^ \n]*', text[i:]).group(0)
+            breaks = pen + sum(width(x) + GLYPH_SPACING for x in word) - GLYPH_SPACING > line_px
+        if breaks:
+            lines, pen, word_start = lines + [set()], 0, True
+            if c == ' ':
+                continue
+        if c != ' ':
+            lines[-1].update(range(pen // 8, min((pen + width(c) - 1) // 8, TEXTBOX_COLS - 1) + 1))
+        pen += width(c) + GLYPH_SPACING
+        word_start = c == ' '
+    return [len(cells) for cells in lines]
+
+def scene_costs(scenes, scene_by_id, widths):
+    preds = [[] for _ in scenes]
+    for i, s in enumerate(scenes):
+        targets = [s.get('nextSceneA', ''), s.get('nextSceneB', '')]
+        targets += [c.partition('->')[2] for c in s.get('choice', [])]
+        targets += [c.partition('->')[2] for c in s.get('if_flag', [])]
+        for t in {scene_by_id.get(t.strip(), -1) for t in targets}:
+            if t >= 0:
+                preds[t].append(i)
+
+    state = ('bg', 'music', 'sprite', 'illustration')
+    costs = []
+    for i, s in enumerate(scenes):
+        text = s.get('text', '')
+        cells = wrap_lines(text, widths)
+        lines = len(cells)
+        scrolls = max(0, lines - TEXTBOX_LINES)
+        box_cells = max(sum(cells[k:k + TEXTBOX_LINES]) for k in range(scrolls + 1))
+        if box_cells * 2 > TEXTBOX_TILES:
+            raise SystemExit(f"scene {s['scene_id']}: text needs {box_cells * 2} text box tiles, "
+                             f"TEXTBOX_TILES is {TEXTBOX_TILES}")
+        # Box rows blanked by textBoxClear(), every drawn cell mapped, a
+        # scroll blanks two lines
+        tilemap = TEXTBOX_LINES * TEXTBOX_COLS * 2 + sum(cells) * 2 + scrolls * TEXTBOX_COLS * 4
+        labels = [c.partition('->')[0].strip() for c in s.get('choice', [])]
+        hidden = 0
+        if labels:
+            # openChoiceMenu(), one empty line below the text
+            menu_y = min(TEXTBOX_Y + (lines - 1 - scrolls) * 2 + 4, CHOICE_BOTTOM - 1)
+            rows = min(len(labels), (CHOICE_BOTTOM + 1 - menu_y) // 2)
+            hidden = len(labels) - rows
+            tilemap += sum(2 * (SCREEN_COLS - CHOICE_X) + 2 * len(l) for l in labels[:rows]) + 2
+        changes = max((sum(s.get(k, '0') != scenes[p].get(k, '0') for k in state) for p in preds[i]), default=0)
+        costs.append({'name': s['scene_id'], 'chars': len(text), 'lines': lines, 'tilemap': tilemap,
+                      'frames': len(text) * TEXT_DELAY + int(s.get('wait', '0') or 0),
+                      'changes': changes, 'choice_chars': max(map(len, labels), default=0),
+                      'hidden_choices': hidden})
+    return costs
+
+def question_costs(questions_rows):
+    costs = []
+    for q in questions_rows:
+        answers = [q.get(k, '') for k in ('answer_a', 'answer_b', 'answer_c')]
+        costs.append({'name': q['id'], 'question_chars': len(q.get('question', '')),
+                      'answer_chars': max(map(len, answers)),
+                      'tilemap': 2 * (len(q.get('question', '')) + sum(map(len, answers)))})
+    return costs
+
+def quiz_costs(quizzes, questions_rows):
+    per_category = {}
+    for q in questions_rows:
+        per_category[q['category'].strip()] = per_category.get(q['category'].strip(), 0) + 1
+    costs = []
+    for qz in quizzes:
+        wanted = int(qz.get('questions', '0') or 0)
+        cats = qz['categories'][:CATEGORY_KEYS]
+        costs.append({'name': qz['quiz_id'], 'name_chars': len(qz.get('name', '')),
+                      'categories': len(qz['categories']),
+                      'category_chars': max(map(len, cats), default=0),
+                      'missing_questions': max([wanted - per_category.get(c, 0) for c in cats] + [0])})
+    return costs
+
+def parse_cost_budgets(path: Path):
+    """{(kind, name): limit} from lines of 'kind name limit', # comments."""
+    budgets = {}
+    if path.exists():
+        for line in path.read_text(encoding='utf-8').splitlines():
+            line = line.split('#', 1)[0].strip()
+            if line:
+                kind, name, limit = line.split()
+                budgets[(kind, name)] = int(limit, 0)
+    return budgets
+
+def check_costs(kind, costs, budgets):
+    over = 0
+    for c in costs:
+        for (k, name), limit in budgets.items():
+            if k == kind and c.get(name, 0) > limit:
+                print(f"warning: {kind} {c['name']}: {name} {c[name]} over budget {limit}")
+                over += 1
+    return over
+
+def write_cost_report(path: Path, sections):
+    lines = []
+    for kind, costs in sections:
+        if not costs:
+            continue
+        cols = [k for k in costs[0] if k != 'name']
+        width = max(len(c['name']) for c in costs) + 2
+        lines.append(f'{kind:<{width}}' + ''.join(f'{k:>{len(k) + 2}}' for k in cols))
+        for c in costs:
+            lines.append(f"{c['name']:<{width}}" + ''.join(f'{c[k]:>{len(k) + 2}}' for k in cols))
+        lines.append('')
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text('\n'.join(lines), encoding='utf-8')
+
 # ---------- main ----------
 def main():
-    if len(sys.argv) != 5:
-        print("Usage: build_data.py <scenes.txt> <questions.csv> <quizzes.txt> <out_c_path>")
+    if len(sys.argv) < 5:
+        print("Usage: build_data.py <scenes.txt> <questions.csv> <quizzes.txt> <out_c_path> [<lang>=<dir> ...]")
+        print("  each <dir> holds a translated scenes.txt and questions.csv")
         sys.exit(1)
 
     scenes_path   = Path(sys.argv[1])
     questions_path= Path(sys.argv[2])
     quizzes_path  = Path(sys.argv[3])
     out_c         = Path(sys.argv[4])
+    translations  = [a.split('=', 1) for a in sys.argv[5:]]
 
     scenes = parse_scenes(scenes_path)
     questions_rows = parse_questions_csv(questions_path)
@@ -156,24 +598,15 @@ def main():
     emit(f'const u16 CATEGORY_COUNT = {len(cat_names)};')
     emit('')
 
-    # Questions
+    # Questions, text is in the language packs
     emit('// ---- Questions ----')
     emit('static const Question QUESTIONS_DATA[] = {')
     for i, row in enumerate(questions_rows):
         cat_id = cat_index[row['category'].strip()]
-        qtxt = esc_c(row['question'])
-        a = esc_c(row.get('answer_a',''))
-        b = esc_c(row.get('answer_b',''))
-        c = esc_c(row.get('answer_c',''))
-        d = ""  # not provided in your CSV; reserve for future
         corr = correct_to_idx(row.get('correct','a'))
         emit('  {')
         emit(f'    .id = {i},')
         emit(f'    .category_id = {cat_id},')
-        emit(f'    .question = "{qtxt}",')
-        emit(f'    .answerA = "{a}",')
-        emit(f'    .answerB = "{b}",')
-        emit(f'    .answerC = "{c}",')
         emit(f'    .correct = {corr},')
         emit('  },')
     emit('};')
@@ -182,44 +615,47 @@ def main():
     emit('')
 
     # Scenes
-    # types map
-    type_map = {'normal':'SCENE_TYPE_NORMAL', 'quiz_trigger':'SCENE_TYPE_QUIZ_TRIGGER',
-                'good_ending':'SCENE_TYPE_GOOD_ENDING', 'bad_ending':'SCENE_TYPE_BAD_ENDING'}
+    texts, origins, script, entries, flag_names, choices, choice_offsets = compile_scene_script(scenes, scene_by_id, q_by_id, quiz_by_id)
 
-    emit('// ---- Scenes ----')
-    emit('static const Scene SCENES_DATA[] = {')
-    for i, s in enumerate(scenes):
-        stype = type_map.get(s.get('type','normal').strip(), 'SCENE_NORMAL')
-        text = esc_c(s.get('text',''))
-        # resolve optional links
-        nextA_scene = s.get('nextSceneA','').strip()
-        nextB_scene = s.get('nextSceneB','').strip()
-        trig_quiz  = s.get('trigger_quiz','').strip()
-        question_id= s.get('question_id','').strip()
-
-        nextA_idx = scene_by_id.get(nextA_scene, -1) if nextA_scene else -1
-        nextB_idx = scene_by_id.get(nextB_scene, -1) if nextB_scene else -1
-        trig_idx = quiz_by_id.get(trig_quiz, -1) if trig_quiz else -1
-        q_idx    = q_by_id.get(question_id, -1) if question_id else -1
-
-        bg = int(s.get('bg','0') or 0)
-        music = int(s.get('music','0') or 0)
+    packs = [emit_lang_pack(emit, 'en', texts, translated_questions(questions_rows, questions_rows))]
+    for code, tdir in translations:
+        tdir = Path(tdir)
+        packs.append(emit_lang_pack(emit, code,
+                                    translated_texts(texts, origins, parse_scenes(tdir / 'scenes.txt')),
+                                    translated_questions(questions_rows, parse_questions_csv(tdir / 'questions.csv'))))
+    emit('const LangPack * const LANG_PACKS[] = { ' + ', '.join(p for p, _ in packs) + ' };')
+    emit('const void * const LANG_PACK_ENDS[] = { ' +
+         ', '.join(f"(const u8*) &{m['name']} + sizeof({m['name']}_t)" for _, m in packs) + ' };')
+    emit(f'const u16 LANG_COUNT = {len(packs)};')
+    emit(f'const u16 SCENE_TEXTS_COUNT = {len(texts)};')
+    emit('')
 
-        emit('  {')
-        emit(f'    .id = {i},')
-        emit(f'    .type = {stype},')
-        emit(f'    .text = "{text}",')
-        emit(f'    .nextSceneA = {nextA_idx},')
-        emit(f'    .nextSceneB = {nextB_idx},')
-        emit(f'    .triggerQuiz = {trig_idx},')
-        emit(f'    .questionId = {q_idx},')
-        emit(f'    .bg = {bg}, .music = {music},')
-        emit('  },')
+    emit('// ---- Scene script ----')
+    emit('// flags: ' + ', '.join(f'{i}={n}' for i, n in enumerate(flag_names)))
+    emit('static const u8 SCENE_SCRIPT_DATA[] = {')
+    for i, (sid, code) in enumerate(script):
+        emit(f'  // {i}: {sid} @ {entries[i]}')
+        emit('  ' + ' '.join(f'{c},' for c in code))
     emit('};')
-    emit(f'const Scene * const SCENES = SCENES_DATA;')
+    emit('static const u16 SCENE_ENTRIES_DATA[] = { ' + ', '.join(str(e) for e in entries) + ' };')
+    emit(f'const u8  * const SCENE_SCRIPT = SCENE_SCRIPT_DATA;')
+    emit(f'const u16 * const SCENE_ENTRIES = SCENE_ENTRIES_DATA;')
+    emit(f'const u16 SCENE_SCRIPT_SIZE = {sum(len(c) for _, c in script)};')
     emit(f'const u16 SCENES_COUNT = {len(scenes)};')
     emit('')
 
+    emit('// ---- Scene choices (CSR: edges of scene i are [offsets[i], offsets[i + 1])) ----')
+    emit('static const SceneChoice SCENE_CHOICES_DATA[] = {')
+    for label, target in choices:
+        emit(f'  {{ {label}, {target} }},  // ' + texts[label].replace('\\', ''))
+    if not choices:
+        emit('  { 0, 0 },  // unused, keeps the array non-empty')
+    emit('};')
+    emit('static const u16 SCENE_CHOICE_OFFSETS_DATA[] = { ' + ', '.join(str(o) for o in choice_offsets) + ' };')
+    emit(f'const SceneChoice * const SCENE_CHOICES = SCENE_CHOICES_DATA;')
+    emit(f'const u16 * const SCENE_CHOICE_OFFSETS = SCENE_CHOICE_OFFSETS_DATA;')
+    emit('')
+
     # Quizzes
     emit('// ---- Quizzes ----')
     # Flatten each quiz's category list into its own const array
@@ -244,6 +680,15 @@ def main():
     emit('};')
     emit(f'const Quiz * const QUIZZES = QUIZZES_DATA;')
     emit(f'const u16 QUIZZES_COUNT = {len(quizzes)};')
+    emit('')
+
+    # Only the DEBUG warp menu looks names up, release ROMs leave them out
+    emit('// ---- Name lookup ----')
+    emit('#if DEBUG')
+    name_tables = [emit_name_hash(emit, 'SCENE_NAMES', 'scene', [s['scene_id'] for s in scenes]),
+                   emit_name_hash(emit, 'QUESTION_NAMES', 'question', [r['id'] for r in questions_rows]),
+                   emit_name_hash(emit, 'QUIZ_NAMES', 'quiz', [q['quiz_id'] for q in quizzes])]
+    emit('#endif')
     emit('')
 
         # ---- Category Question Indexes (ROM) ----
@@ -277,9 +722,36 @@ def main():
     emit('')
 
     out_c.parent.mkdir(parents=True, exist_ok=True)
-    out_c.write_text("\n".join(lines), encoding='utf-8')
+    out_c.write_text("\n".join(lines), encoding='utf-8', newline='\r\n')
     print(f"Wrote {out_c}")
 
+    # Table metadata for footprint.py, sizes are estimates until linked
+    tables = [t for _, t in packs] + [
+        {'name': 'SCENE_SCRIPT_DATA', 'what': 'scene script', 'count': len(scenes),
+         'bytes': sum(len(c) for _, c in script)},
+        {'name': 'SCENE_ENTRIES_DATA', 'what': 'scene entries', 'count': len(entries), 'bytes': 2 * len(entries)},
+        {'name': 'SCENE_CHOICES_DATA', 'what': 'scene choices', 'count': len(choices), 'bytes': 4 * max(1, len(choices))},
+        {'name': 'SCENE_CHOICE_OFFSETS_DATA', 'what': 'scene choice offsets', 'count': len(choice_offsets),
+         'bytes': 2 * len(choice_offsets)},
+        {'name': 'QUESTIONS_DATA', 'what': 'questions', 'count': len(questions_rows), 'bytes': 6 * len(questions_rows)},
+        {'name': 'QUIZZES_DATA', 'what': 'quizzes', 'count': len(quizzes), 'bytes': 16 * len(quizzes)},
+        {'name': 'CATEGORY_NAMES', 'what': 'category names', 'count': len(cat_names),
+         'bytes': sum(4 + len(n) + 1 for n in cat_names)},
+    ] + name_tables
+    meta_path = Path('out') / 'data_meta.json'
+    meta_path.parent.mkdir(parents=True, exist_ok=True)
+    meta_path.write_text(json.dumps({'source': str(out_c), 'tables': tables}, indent=2), encoding='utf-8')
+
+    # Content cost model, budgets sit next to the scenes
+    sections = [('scene', scene_costs(scenes, scene_by_id, glyph_widths(FONT_PNG))),
+                ('question', question_costs(questions_rows)),
+                ('quiz', quiz_costs(quizzes, questions_rows))]
+    over = sum(check_costs(kind, costs, parse_cost_budgets(scenes_path.parent / 'content_budgets.txt'))
+               for kind, costs in sections)
+    report_path = Path('out') / 'content_cost.txt'
+    write_cost_report(report_path, sections)
+    print(f"Wrote {report_path} ({over} over budget)")
+
 if __name__ == '__main__':
     main()
 
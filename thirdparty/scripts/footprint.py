@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+# ROM and RAM footprint of the linked game, per module, table and asset,
+# checked against the budgets file. Exits with 1 when a budget is exceeded
+# so the build task fails.
+#
+# Inputs are the symbol list SGDK writes after linking (nm -n, out/symbol.txt),
+# resources.res for asset names, out/data_meta.json from compile_data.py and
+# the linker map for the per module split (-Wl,-Map=out/rom.map). Module
+# budgets fail when the map is missing rather than reading 0.
+import json, re, sys
+from pathlib import Path
+
+RAM_START = 0xFF0000
+BANK_FAR_BASE = 0x300000            # bank.h, fixed code and data stay below
+TABLE_NAME = re.compile(r'^_?[A-Z][A-Z0-9_]+$')
+NM_LINE = re.compile(r'^([0-9a-fA-F]+)\s+([a-zA-Z])\s+(\S+)$')
+MAP_SECTION = re.compile(r'^\s*(\.\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+\.o)\S*$')
+
+# ---------- helpers ----------
+def parse_symbols(path: Path):
+    """(addr, type, name, size) sorted by address, size up to the next symbol."""
+    syms = []
+    for line in path.read_text(encoding='utf-8', errors='replace').splitlines():
+        m = NM_LINE.match(line.strip())
+        if m and m.group(2) not in 'aAUwWN':
+            syms.append((int(m.group(1), 16) & 0xFFFFFF, m.group(2), m.group(3)))
+    syms.sort()
+    out = []
+    for i, (addr, t, name) in enumerate(syms):
+        end = syms[i + 1][0] if i + 1 < len(syms) else addr
+        if (addr >= RAM_START) != (end >= RAM_START):
+            end = addr
+        out.append((addr, t, name, end - addr))
+    return out
+
+def parse_map(path: Path):
+    """bytes per object file and region, from the input sections of the map."""
+    modules = {}
+    pending = None
+    for line in path.read_text(encoding='utf-8', errors='replace').splitlines():
+        # long section names put the address on the next line
+        if pending and line.startswith(' ' * 10):
+            line = pending + line
+        pending = None
+        stripped = line.strip()
+        if stripped.startswith('.') and ' ' not in stripped:
+            pending = ' ' + stripped
+            continue
+        m = MAP_SECTION.match(line)
+        if not m or not m.group(1):
+            continue
+        section, addr, size = m.group(1), int(m.group(2), 16) & 0xFFFFFF, int(m.group(3), 16)
+        if size == 0 or section.startswith('.comment') or section.startswith('.debug'):
+            continue
+        obj = Path(m.group(4)).name
+        rom, ram = modules.setdefault(obj, [0, 0])
+        if section.startswith('.bss') or section.startswith('COMMON') or addr >= RAM_START:
+            ram += size
+        else:
+            rom += size
+        if section.startswith('.data'):
+            ram += size         # copied to RAM at boot
+        modules[obj] = [rom, ram]
+    return modules
+
+def parse_budgets(path: Path):
+    """(kind, name, limit) from lines of 'kind name limit', # comments."""
+    budgets = []
+    if path.exists():
+        for line in path.read_text(encoding='utf-8').splitlines():
+            line = line.split('#', 1)[0].strip()
+            if line:
+                kind, name, limit = line.split()
+                budgets.append((kind, name, int(limit, 0)))
+    return budgets
+
+def fmt(n):
+    return f'{n:>9,}'
+
+# ---------- main ----------
+def main():
+    if len(sys.argv) < 4:
+        print("Usage: footprint.py <symbol.txt> <resources.res> <budgets.txt> [<data_meta.json>] [<rom.map>]")
+        sys.exit(1)
+
+    syms = parse_symbols(Path(sys.argv[1]))
+    assets = [l.split()[1] for l in Path(sys.argv[2]).read_text(encoding='utf-8').splitlines()
+              if len(l.split()) > 1 and not l.lstrip().startswith('#')]
+    budgets = parse_budgets(Path(sys.argv[3]))
+    meta_path = Path(sys.argv[4]) if len(sys.argv) > 4 else Path('out/data_meta.json')
+    meta = json.loads(meta_path.read_text(encoding='utf-8')) if meta_path.exists() else {'tables': []}
+    map_path = Path(sys.argv[5]) if len(sys.argv) > 5 else Path('out/rom.map')
+    modules = parse_map(map_path) if map_path.exists() else {}
+
+    # far packs are exact in the metadata, the gap after them is padding
+    far = {t['name']: t['bytes'] for t in meta['tables'] if t.get('far')}
+    syms = [(a, t, n, min(s, far[n]) if n in far else s) for a, t, n, s in syms]
+    by_name = {name: (addr, size) for addr, _, name, size in syms}
+    rom_syms = [s for s in syms if s[0] < RAM_START]
+    ram_syms = [s for s in syms if s[0] >= RAM_START]
+
+    totals = {
+        'rom': max((a + s for a, _, _, s in rom_syms), default=0),
+        'fixed': max((a + s for a, _, n, s in rom_syms if n not in far), default=0),
+        'ram': sum(s for _, _, _, s in ram_syms),
+    }
+
+    # tables: compile_data metadata plus every other ALL_CAPS ROM symbol
+    tables = {}
+    for t in meta['tables']:
+        linked = by_name.get(t['name'])
+        tables[t['name']] = (linked[1] if linked else t['bytes'], t['what'], linked is None)
+    for addr, t, name, size in rom_syms:
+        if t in 'rRdD' and TABLE_NAME.match(name) and name not in tables:
+            tables[name] = (size, '', False)
+
+    asset_sizes = {}
+    for a in assets:
+        asset_sizes[a] = sum(s for _, _, n, s in rom_syms if n == a or n.startswith(a + '_'))
+
+    report = []
+    out = report.append
+    out('---- Totals ----')
+    out(f"ROM        {fmt(totals['rom'])}")
+    out(f"ROM fixed  {fmt(totals['fixed'])}   (must stay below 0x{BANK_FAR_BASE:X} past 4 MB)")
+    out(f"RAM        {fmt(totals['ram'])}")
+    out('')
+    if modules:
+        out('---- Modules (ROM, RAM) ----')
+        for obj, (rom, ram) in sorted(modules.items(), key=lambda m: -m[1][0]):
+            out(f'{obj:<28}{fmt(rom)}{fmt(ram)}')
+        out('')
+    out('---- Tables ----')
+    for name, (size, what, estimate) in sorted(tables.items(), key=lambda t: -t[1][0]):
+        out(f"{name:<28}{fmt(size)}  {what}{' (estimate, not linked)' if estimate else ''}")
+    out('')
+    out('---- Assets ----')
+    for name, size in sorted(asset_sizes.items(), key=lambda a: -a[1]):
+        out(f'{name:<28}{fmt(size)}')
+    out('')
+    out('---- RAM ----')
+    for addr, t, name, size in sorted(ram_syms, key=lambda s: -s[3])[:20]:
+        out(f'{name:<28}{fmt(size)}')
+    out('')
+
+    # budgets
+    failed = []
+    for kind, name, limit in budgets:
+        if kind in ('rom', 'ram'):
+            used = totals['fixed' if name == 'fixed' else kind]
+        elif kind == 'module':
+            # without the map every module would read 0 and always pass
+            if name not in modules:
+                raise SystemExit(f'module {name}: not in the linker map, link with -Wl,-Map=out/rom.map and pass it')
+            used = modules[name][0]
+        elif kind == 'table':
+            used = tables.get(name, (0,))[0]
+        elif kind == 'asset':
+            used = asset_sizes.get(name, 0)
+        else:
+            raise SystemExit(f'unknown budget kind {kind}')
+        state = 'OVER' if used > limit else 'ok'
+        out(f'budget {kind:<7}{name:<28}{fmt(used)} / {fmt(limit)}  {state}')
+        if used > limit:
+            failed.append(f'{kind} {name}: {used} > {limit}')
+
+    text = '\n'.join(report)
+    print(text)
+    Path('out').mkdir(exist_ok=True)
+    Path('out/footprint.txt').write_text(text + '\n', encoding='utf-8')
+    if failed:
+        print('\nOver budget:\n  ' + '\n  '.join(failed))
+        sys.exit(1)
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/footprint.py out/symbol.txt res/resources.res res/budgets.txt out/data_meta.json out/rom.map
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+# Minimal PNG reader/writer and BMP reader for the data pipeline (stdlib
+# only, the embedded python in thirdparty has no PIL).
+import struct, zlib
+from pathlib import Path
+
+PNG_SIG = b'\x89PNG\r\n\x1a\n'
+
+class Image:
+    """width x height pixels, row-major.
+
+    Indexed images keep palette indices in `pixels` and RGB tuples in
+    `palette`; truecolor images keep (r, g, b, a) tuples and palette=None.
+    """
+    def __init__(self, width, height, pixels, palette=None):
+        self.width = width
+        self.height = height
+        self.pixels = pixels
+        self.palette = palette
+
+    def get(self, x, y):
+        return self.pixels[y * self.width + x]
+
+    def rgba(self, x, y):
+        p = self.get(x, y)
+        if self.palette is None:
+            return p
+        r, g, b = self.palette[p]
+        return (r, g, b, 255)
+
+def _unfilter(raw, width, height, bpp, stride):
+    out = bytearray()
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        ftype = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        out += line
+        prev = line
+    return out
+
+def read_png(path):
+    data = Path(path).read_bytes()
+    if data[:8] != PNG_SIG:
+        raise ValueError(f'{path}: not a PNG file')
+    pos = 8
+    idat = b''
+    palette = None
+    trns = None
+    while pos < len(data):
+        length, ctype = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif ctype == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif ctype == b'tRNS':
+            trns = chunk
+        elif ctype == b'IDAT':
+            idat += chunk
+        elif ctype == b'IEND':
+            break
+    if interlace:
+        raise ValueError(f'{path}: interlaced PNG not supported')
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits = depth * channels
+    stride = (width * bits + 7) // 8
+    raw = _unfilter(zlib.decompress(idat), width, height, max(1, bits // 8), stride)
+
+    pixels = []
+    for y in range(height):
+        row = raw[y * stride:(y + 1) * stride]
+        if depth < 8:
+            per_byte = 8 // depth
+            mask = (1 << depth) - 1
+            for x in range(width):
+                byte = row[x // per_byte]
+                shift = 8 - depth * (x % per_byte + 1)
+                pixels.append((byte >> shift) & mask)
+        else:
+            step = channels * (depth // 8)
+            for x in range(width):
+                px = row[x * step:(x + 1) * step]
+                if depth == 16:
+                    px = px[::2]
+                if color == 3:
+                    pixels.append(px[0])
+                elif color == 0:
+                    pixels.append((px[0], px[0], px[0], 255))
+                elif color == 4:
+                    pixels.append((px[0], px[0], px[0], px[1]))
+                elif color == 2:
+                    pixels.append((px[0], px[1], px[2], 255))
+                else:
+                    pixels.append(tuple(px))
+    if color == 0 and depth < 8:
+        scale = 255 // ((1 << depth) - 1)
+        pixels = [(v * scale, v * scale, v * scale, 255) for v in pixels]
+    return Image(width, height, pixels, palette if color == 3 else None)
+
+def read_bmp(path):
+    """Uncompressed 24 or 32-bit Windows bitmap, as a truecolor Image."""
+    data = Path(path).read_bytes()
+    if data[:2] != b'BM':
+        raise ValueError(f'{path}: not a BMP file')
+    offset = struct.unpack_from('<I', data, 10)[0]
+    width, height, _, bpp, compression = struct.unpack_from('<iiHHI', data, 18)
+    if bpp not in (24, 32) or compression not in (0, 3):
+        raise ValueError(f'{path}: only 24 and 32-bit uncompressed BMP are supported')
+    step = bpp // 8
+    stride = ((width * bpp + 31) // 32) * 4
+    # Rows are stored bottom up unless the height is negative
+    rows = range(height - 1, -1, -1) if height > 0 else range(-height)
+    pixels = []
+    for y in rows:
+        row = data[offset + y * stride:offset + y * stride + width * step]
+        pixels += [(row[i + 2], row[i + 1], row[i], 255) for i in range(0, width * step, step)]
+    return Image(width, abs(height), pixels)
+
+def read_image(path):
+    return read_bmp(path) if Path(path).suffix.lower() == '.bmp' else read_png(path)
+
+def _chunk(ctype, body):
+    return struct.pack('>I', len(body)) + ctype + body + struct.pack('>I', zlib.crc32(ctype + body) & 0xFFFFFFFF)
+
+def write_png(path, img):
+    """Write an 8-bit indexed (palette set) or RGB image."""
+    raw = bytearray()
+    for y in range(img.height):
+        raw.append(0)
+        row = img.pixels[y * img.width:(y + 1) * img.width]
+        if img.palette is not None:
+            raw += bytes(row)
+        else:
+            for p in row:
+                raw += bytes(p[:3])
+    color = 3 if img.palette is not None else 2
+    out = PNG_SIG + _chunk(b'IHDR', struct.pack('>IIBBBBB', img.width, img.height, 8, color, 0, 0, 0))
+    if img.palette is not None:
+        out += _chunk(b'PLTE', b''.join(bytes(c) for c in img.palette))
+    out += _chunk(b'IDAT', zlib.compress(bytes(raw), 9))
+    out += _chunk(b'IEND', b'')
+    Path(path).parent.mkdir(parents=True, exist_ok=True)
+    Path(path).write_bytes(out)
+
+def rgb_to_vdp(r, g, b):
+    """24-bit color to the 9-bit VDP format (same rounding as RGB24_TO_VDPCOLOR)."""
+    return ((r >> 4) & 0xE) | (((g >> 4) & 0xE) << 4) | (((b >> 4) & 0xE) << 8)
+
+def vdp_to_rgb(c):
+    return (((c >> 1) & 7) * 36, ((c >> 5) & 7) * 36, ((c >> 9) & 7) * 36)
+
+def tile_rows(img, tx, ty):
+    """8 u32 rows of a 4bpp tile from an indexed image (indices & 0xF)."""
+    rows = []
+    for y in range(8):
+        v = 0
+        for x in range(8):
+            v = (v << 4) | (img.get(tx * 8 + x, ty * 8 + y) & 0xF)
+        rows.append(v)
+    return rows
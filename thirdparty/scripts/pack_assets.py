@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+# Builds every IMAGE of resources.res with each compression rescomp
+# offers, measures ROM size and the unpack time, and writes the best
+# choice for the asset's load class back into resources.res.
+#
+# The unpack is timed on the benchmark runner (bench.py): for each asset
+# and compression a ROM that only runs SGDK's unpackImage() once is built
+# with makefile.gen, and the runner's cycles for that call are the cost.
+import os, re, subprocess, sys, tempfile
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent))
+from bench import build_bench
+
+COMPRESSIONS = ['NONE', 'APLIB', 'LZ4W']
+
+# Max decompression time per load class, in NTSC frames (127840 cycles)
+FRAME_CYCLES = 127840
+CLASS_BUDGET_FRAMES = {'boot': 60.0, 'scene': 2.0, 'frame': 0.1}
+# Frames the runner gives the unpack, boot included; slower is over every budget
+MEASURE_FRAMES = 120
+UNPACK_FUNCTION = 'unpackImage'
+
+UNPACK_MAIN = """#include <genesis.h>
+#include "asset.h"
+
+// Written by pack_assets.py: one unpack for the benchmark runner to time
+int main() {
+    Image* image = unpackImage(&asset, NULL);
+    if(image) MEM_free(image);
+    while(TRUE) SYS_doVBlankProcess();
+    return 0;
+}
+"""
+
+IMAGE_LINE = re.compile(r'^(\s*IMAGE\s+)(\w+)(\s+"[^"]+"\s+)(\w+)(.*)$')
+ASM_DATA = re.compile(r'^\s*(dc\.b|dc\.w|dc\.l|\.byte|\.word|\.short|\.long)\s+(.*)$', re.I)
+ASM_SIZES = {'dc.b': 1, '.byte': 1, 'dc.w': 2, '.word': 2, '.short': 2, 'dc.l': 4, '.long': 4}
+
+# ---------- helpers ----------
+def parse_res(path: Path):
+    assets = []
+    for i, line in enumerate(path.read_text(encoding='utf-8').splitlines()):
+        m = IMAGE_LINE.match(line)
+        if m:
+            assets.append({'line': i, 'name': m.group(2), 'decl': line})
+    return assets
+
+def parse_classes(path: Path):
+    classes = {}
+    if path.exists():
+        for line in path.read_text(encoding='utf-8').splitlines():
+            line = line.split('#', 1)[0].strip()
+            if line:
+                name, cls = line.split()
+                classes[name] = cls
+    return classes
+
+def asm_size(path: Path):
+    size = 0
+    for line in path.read_text(encoding='utf-8', errors='replace').splitlines():
+        m = ASM_DATA.match(line.split(';', 1)[0])
+        if m:
+            values = [v for v in m.group(2).split(',') if v.strip()]
+            size += ASM_SIZES[m.group(1).lower()] * len(values)
+    return size
+
+def build_size(rescomp, res_dir: Path, decl: str, compression: str):
+    m = IMAGE_LINE.match(decl)
+    with tempfile.TemporaryDirectory() as tmp:
+        res = Path(tmp) / 'asset.res'
+        out = Path(tmp) / 'asset.s'
+        # rescomp resolves file names relative to the .res file
+        res.write_text(image_decl(decl, m.group(2), compression, res_dir) + '\n', encoding='utf-8')
+        subprocess.run(rescomp + [str(res), str(out)], check=True, stdout=subprocess.DEVNULL)
+        return asm_size(out)
+
+def image_decl(decl: str, name: str, compression: str, res_dir: Path):
+    """The IMAGE line with another name and compression, its file absolute."""
+    m = IMAGE_LINE.match(decl)
+    line = m.group(1) + name + m.group(3) + compression + m.group(5)
+    return line.replace('"', '"' + str(res_dir.resolve()) + '/', 1)
+
+def unpack_cycles(runner, make, gdk, res_dir: Path, decl: str, compression: str):
+    """68000 cycles of the asset's unpackImage() call on the benchmark
+    runner, None when it didn't return within MEASURE_FRAMES."""
+    with tempfile.TemporaryDirectory() as tmp:
+        project = Path(tmp)
+        (project / 'src').mkdir()
+        (project / 'res').mkdir()
+        (project / 'src' / 'main.c').write_text(UNPACK_MAIN, encoding='utf-8')
+        (project / 'res' / 'asset.res').write_text(image_decl(decl, 'asset', compression, res_dir) + '\n',
+                                                   encoding='utf-8')
+        subprocess.run([make, '-f', str(Path(gdk) / 'makefile.gen')], cwd=project, check=True,
+                       stdout=subprocess.DEVNULL)
+        inputs = project / 'inputs.txt'
+        inputs.write_text(f'0 {MEASURE_FRAMES}\n', encoding='utf-8')
+        subprocess.run([str(runner.resolve()), str(project / 'out' / 'rom.bin'), str(project / 'out' / 'rom.out'),
+                        str(inputs), '--focus', UNPACK_FUNCTION, '--out', str(project / 'out')],
+                       check=True, stdout=subprocess.DEVNULL)
+        # Focus row: function calls inclusive exclusive per-call max-call per-frame
+        for line in (project / 'out' / 'report.txt').read_text(encoding='utf-8').splitlines():
+            fields = line.split()
+            if fields and fields[0] == UNPACK_FUNCTION and fields[1].isdigit():
+                return int(fields[4]) if int(fields[1]) else None
+    raise SystemExit(f'{UNPACK_FUNCTION} is not in the symbols of the unpack ROM')
+
+def choose(results, cls):
+    budget = CLASS_BUDGET_FRAMES[cls] * FRAME_CYCLES
+    fits = [r for r in results if r['cycles'] <= budget]
+    if not fits:
+        return min(results, key=lambda r: r['cycles'])
+    # smallest ROM size, ties go to the faster unpacker
+    return min(fits, key=lambda r: (r['size'], r['cycles']))
+
+# ---------- main ----------
+def main():
+    args = [a for a in sys.argv[1:] if a != '--dry-run']
+    dry_run = '--dry-run' in sys.argv
+    if len(args) != 2:
+        print("Usage: pack_assets.py <resources.res> <asset_load.txt> [--dry-run]")
+        sys.exit(1)
+
+    res_path = Path(args[0])
+    classes = parse_classes(Path(args[1]))
+
+    gdk = os.environ.get('GDK')
+    if not gdk:
+        raise SystemExit('GDK environment variable is not set')
+    rescomp = ['java', '-jar', str(Path(gdk) / 'bin' / 'rescomp.jar')]
+    make = Path(gdk) / 'bin' / 'make'
+    make = str(make) if make.exists() or make.with_suffix('.exe').exists() else 'make'
+    runner = build_bench()
+
+    raw = res_path.read_bytes().decode('utf-8')
+    newline = '\r\n' if '\r\n' in raw else '\n'
+    lines = raw.splitlines()
+
+    print(f"{'asset':<16} {'class':<6} " + ' '.join(f'{c:>14}' for c in COMPRESSIONS) + '  choice')
+    for asset in parse_res(res_path):
+        name = asset['name']
+        cls = classes.get(name, 'scene')
+        if cls not in CLASS_BUDGET_FRAMES:
+            raise SystemExit(f'{name}: unknown load class {cls}')
+
+        results = []
+        for comp in COMPRESSIONS:
+            size = build_size(rescomp, res_path.parent, asset['decl'], comp)
+            results.append({'compression': comp, 'size': size})
+        for r in results:
+            # NONE isn't unpacked, its tiles go straight to the DMA
+            r['cycles'] = 0 if r['compression'] == 'NONE' else \
+                unpack_cycles(runner, make, gdk, res_path.parent, asset['decl'], r['compression'])
+
+        best = choose([r for r in results if r['cycles'] is not None], cls)
+        cells = ' '.join(f"{r['size']:>6}B/" + (f"{r['cycles'] / FRAME_CYCLES:>5.2f}f" if r['cycles'] is not None else '    -f')
+                         for r in results)
+        print(f'{name:<16} {cls:<6} {cells}  {best["compression"]}')
+
+        m = IMAGE_LINE.match(lines[asset['line']])
+        lines[asset['line']] = m.group(1) + m.group(2) + m.group(3) + best['compression'] + m.group(5)
+
+    if dry_run:
+        return
+    res_path.write_bytes((newline.join(lines) + (newline if raw.endswith(('\n', '\r')) else '')).encode('utf-8'))
+    print(f"Wrote {res_path}")
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/pack_assets.py res/resources.res res/asset_load.txt
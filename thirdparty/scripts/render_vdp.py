@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# Renders a VDP state dump (VRAM, CRAM, VSRAM and the plane registers) to
+# a 320x224 PNG: planes A and B with scrolling, the window and sprites,
+# layered by priority like the VDP does. Dumps come from the headless
+# build (thirdparty/host) and use the layout of HOST_dumpVDP.
+import struct, sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent))
+import image_io
+
+SCREEN_W, SCREEN_H = 320, 224
+HEADER = struct.Struct('>8s12H')
+REGS = ('plane_a', 'plane_b', 'window', 'hscroll', 'sat', 'plane_w', 'plane_h',
+        'hscroll_mode', 'vscroll_mode', 'window_h', 'window_v', 'bg_color')
+HSCROLL_TILE, HSCROLL_LINE = 2, 3
+VSCROLL_COLUMN = 1
+
+# ---------- helpers ----------
+def load_dump(path):
+    data = Path(path).read_bytes()
+    fields = HEADER.unpack_from(data)
+    if fields[0] != b'VDPDUMP1':
+        raise SystemExit(f'{path}: not a VDP dump')
+    dump = dict(zip(REGS, fields[1:]))
+    pos = HEADER.size
+    dump['vram'] = data[pos:pos + 0x10000]
+    pos += 0x10000
+    dump['cram'] = list(struct.unpack_from('>64H', data, pos))
+    dump['vsram'] = list(struct.unpack_from('>40H', data, pos + 128))
+    return dump
+
+def word(vram, addr):
+    addr &= 0xFFFE
+    return (vram[addr] << 8) | vram[addr + 1]
+
+def signed(v):
+    return v - 0x10000 if v & 0x8000 else v
+
+def tile_pixel(vram, attr, px, py, tile_h=8):
+    """Color index (0-63) of a pixel of the tile named by a tilemap word, 0 is transparent."""
+    index = attr & 0x7FF
+    if attr & 0x800:
+        px = 7 - px
+    if attr & 0x1000:
+        py = tile_h - 1 - py
+    b = vram[(index * 32 + py * 4 + px // 2) & 0xFFFF]
+    c = (b >> 4) if px % 2 == 0 else (b & 0xF)
+    return ((attr >> 13) & 3) * 16 + c if c else 0
+
+def in_window(d, x, y):
+    h, v = d['window_h'], d['window_v']
+    hpos, vpos = (h & 0x1F) * 16, (v & 0x1F) * 8
+    in_h = x >= hpos if h & 0x80 else x < hpos
+    in_v = y >= vpos if v & 0x80 else y < vpos
+    return in_h or in_v
+
+def plane_pixel(d, base, hs, vs, x, y):
+    w, h = d['plane_w'] * 8, d['plane_h'] * 8
+    px, py = (x - hs) % w, (y + vs) % h
+    attr = word(d['vram'], base + ((py // 8) * d['plane_w'] + px // 8) * 2)
+    return tile_pixel(d['vram'], attr, px % 8, py % 8), attr >> 15
+
+def sprite_layer(d):
+    """Per pixel (color, priority) of the sprites, lowest index on top."""
+    vram = d['vram']
+    order, link = [], 0
+    for _ in range(80):
+        order.append(link)
+        link = vram[(d['sat'] + link * 8 + 3) & 0xFFFF] & 0x7F
+        if link == 0:
+            break
+    layer = {}
+    for i in reversed(order):
+        base = d['sat'] + i * 8
+        y = (word(vram, base) & 0x3FF) - 128
+        size = vram[(base + 2) & 0xFFFF]
+        attr = word(vram, base + 4)
+        x = (word(vram, base + 6) & 0x1FF) - 128
+        tw, th = ((size >> 2) & 3) + 1, (size & 3) + 1
+        for ty in range(th * 8):
+            for tx in range(tw * 8):
+                sx, sy = x + tx, y + ty
+                if not (0 <= sx < SCREEN_W and 0 <= sy < SCREEN_H):
+                    continue
+                cx = tw * 8 - 1 - tx if attr & 0x800 else tx
+                cy = th * 8 - 1 - ty if attr & 0x1000 else ty
+                tile = (attr & 0x7FF) + (cx // 8) * th + cy // 8
+                c = tile_pixel(vram, (attr & 0x6000) | tile, cx % 8, cy % 8)
+                if c:
+                    layer[(sx, sy)] = (c, attr >> 15)
+    return layer
+
+# ---------- render ----------
+def render(d):
+    vram, cram, vsram = d['vram'], d['cram'], d['vsram']
+    sprites = sprite_layer(d)
+    pixels = []
+    for y in range(SCREEN_H):
+        if d['hscroll_mode'] == HSCROLL_LINE:
+            line = y
+        elif d['hscroll_mode'] == HSCROLL_TILE:
+            line = y & ~7
+        else:
+            line = 0
+        hs_a = signed(word(vram, d['hscroll'] + line * 4))
+        hs_b = signed(word(vram, d['hscroll'] + line * 4 + 2))
+        for x in range(SCREEN_W):
+            col = (x // 16) * 2 if d['vscroll_mode'] == VSCROLL_COLUMN else 0
+            b = plane_pixel(d, d['plane_b'], hs_b, signed(vsram[col + 1]), x, y)
+            if in_window(d, x, y):
+                attr = word(vram, d['window'] + ((y // 8) * 64 + x // 8) * 2)
+                a = (tile_pixel(vram, attr, x % 8, y % 8), attr >> 15)
+            else:
+                a = plane_pixel(d, d['plane_a'], hs_a, signed(vsram[col]), x, y)
+            s = sprites.get((x, y), (0, 0))
+            color = d['bg_color']
+            # back to front: B, A, sprites, then the same for high priority
+            for c, prio in (b, a, s):
+                if c and not prio:
+                    color = c
+            for c, prio in (b, a, s):
+                if c and prio:
+                    color = c
+            pixels.append(color)
+    palette = [image_io.vdp_to_rgb(c) for c in cram]
+    return image_io.Image(SCREEN_W, SCREEN_H, pixels, palette)
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: render_vdp.py <dump.bin> <out.png>")
+        sys.exit(1)
+    image_io.write_png(sys.argv[2], render(load_dump(sys.argv[1])))
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/render_vdp.py out/snapshots/title.bin out/snapshots/title.png
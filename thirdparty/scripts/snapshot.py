@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+# Golden screenshots of the title, every scene, every single question quiz
+# and both endings. The game is built for the host against the SGDK shim in
+# thirdparty/host, driven by scripted joypad input that walks the scene
+# graph, and the VDP dumps it writes are rendered with render_vdp.py.
+#
+# Without --update the renders are compared with the goldens and every
+# mismatch is written next to its dump in out/snapshots; exits with 1 then.
+#
+# Scenes only reachable through a full quiz (category select, random
+# questions) or an if_flag jump on a custom flag are not walked.
+#
+# <goldens>/fixtures/scenes.txt holds scenes the story doesn't have, for
+# paths like a scrolling text box. They are compiled into a second host
+# build, walked the same way from their first scene, and compared with
+# the goldens in <goldens>/fixtures. The title and the endings are left to
+# the story's snapshots. The longest fixture route also opens the backlog
+# on its last scene and pages back through every entry.
+import os, subprocess, sys
+from collections import deque
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent))
+import image_io, render_vdp
+from compile_data import parse_scenes, parse_questions_csv
+
+BUTTON_UP, BUTTON_DOWN = 0x01, 0x02
+BUTTON_A, BUTTON_B, BUTTON_C, BUTTON_START = 0x40, 0x10, 0x20, 0x80
+ANSWER_BUTTONS = {'a': BUTTON_A, 'b': BUTTON_B, 'c': BUTTON_C}
+
+BOOT_FRAMES = 60            # Boot and title fade in
+SETTLE_FRAMES = 40          # A state change: fade out, redraw, fade in
+PRESS_FRAMES = 2
+TEXT_MARGIN = 30            # Typewriter runs one character per tick
+
+OUT_DIR = Path('out/snapshots')
+BUILD_DIR = Path('out/host')
+FIXTURES = 'fixtures'
+
+# ---------- build ----------
+def write_resources(res_path: Path, out_c: Path):
+    """SGDK resources for the host: IMAGE as uncompressed, unoptimized tiles, XGM as empty songs."""
+    lines = ['#include <genesis.h>', '']
+    for line in res_path.read_text(encoding='utf-8').splitlines():
+        parts = line.split()
+        if len(parts) < 3 or parts[0].startswith('#'):
+            continue
+        kind, name, file = parts[0], parts[1], parts[2].strip('"')
+        if kind == 'XGM':
+            lines.append(f'const u8 {name}[1] = {{ 0 }};')
+        elif kind == 'IMAGE':
+            img = image_io.read_png(res_path.parent / file)
+            if img.palette is None:
+                raise SystemExit(f'{file}: IMAGE resources must be indexed PNGs')
+            tw, th = img.width // 8, img.height // 8
+            pal = [image_io.rgb_to_vdp(*c) for c in img.palette[:16]]
+            pal += [0] * (16 - len(pal))
+            lines.append(f'static u16 {name}_pal[16] = {{ ' + ', '.join(f'0x{c:03X}' for c in pal) + ' };')
+            lines.append(f'static u32 {name}_tiles[{tw * th * 8}] = {{')
+            for ty in range(th):
+                for tx in range(tw):
+                    lines.append('  ' + ', '.join(f'0x{r:08X}' for r in image_io.tile_rows(img, tx, ty)) + ',')
+            lines.append('};')
+            lines.append(f'static u16 {name}_map[{tw * th}];')
+            lines.append(f'static Palette {name}_palette = {{ 16, {name}_pal }};')
+            lines.append(f'static TileSet {name}_tileset = {{ 0, {tw * th}, {name}_tiles }};')
+            lines.append(f'static TileMap {name}_tilemap = {{ 0, {tw}, {th}, {name}_map }};')
+            lines.append(f'const Image {name} = {{ &{name}_palette, &{name}_tileset, &{name}_tilemap }};')
+        lines.append('')
+    out_c.write_text('\n'.join(lines), encoding='utf-8')
+
+def build_headless(build_dir: Path, data_c: Path):
+    build_dir.mkdir(parents=True, exist_ok=True)
+    write_resources(Path('res/resources.res'), build_dir / 'host_resources.c')
+    cc = os.environ.get('CC', 'gcc')
+    flags = ['-std=gnu99', '-O1', '-w', '-Ithirdparty/host', '-Iinc', '-Ires']
+    # main() is the driver's, the game's is renamed; bank.c is the cartridge mapper
+    subprocess.run([cc, *flags, '-Dmain=game_main', '-c', 'src/main.c',
+                    '-o', str(build_dir / 'main.o')], check=True)
+    skip = ('main.c', 'bank.c', 'data_load.c')
+    sources = [str(p) for p in sorted(Path('src').glob('*.c')) if p.name not in skip] + [str(data_c)]
+    sources += [str(p) for p in sorted(Path('thirdparty/host').glob('*.c'))]
+    exe = build_dir / 'headless'
+    subprocess.run([cc, *flags, *sources, str(build_dir / 'host_resources.c'),
+                    str(build_dir / 'main.o'), '-o', str(exe)], check=True)
+    return exe
+
+def compile_fixtures(scenes_path: Path, questions_path: Path, build_dir: Path):
+    """data_load.c for the fixture scenes, the questions and quizzes are the game's."""
+    data_c = build_dir / 'data_load.c'
+    build_dir.mkdir(parents=True, exist_ok=True)
+    subprocess.run([sys.executable, str(Path(__file__).parent / 'compile_data.py'), str(scenes_path),
+                    str(questions_path), str(questions_path.parent / 'quizzes.txt'), str(data_c)],
+                   check=True, stdout=subprocess.DEVNULL)
+    return data_c
+
+# ---------- input plan ----------
+class Script:
+    def __init__(self):
+        self.lines = [f'0 {BOOT_FRAMES}', 'dump title']
+
+    def press(self, buttons, settle):
+        self.lines += [f'{buttons:x} {PRESS_FRAMES}', f'0 {settle}']
+
+    def dump(self, name):
+        self.lines.append(f'dump {name}')
+
+def plan_routes(scenes, questions):
+    """Shortest input route to every (scene, passed) state.
+
+    Returns {state: (parent state, action)} where action is one of
+    ('next',), ('choice', n) or ('answer', correct).
+    """
+    by_id = {s['scene_id']: s for s in scenes}
+    start = (scenes[0]['scene_id'], False)
+    parents = {start: None}
+    queue = deque([start])
+    while queue:
+        state = queue.popleft()
+        scene_id, passed = state
+        s = by_id[scene_id]
+        edges = []
+        if s.get('choice'):
+            for n, c in enumerate(s['choice']):
+                edges.append(((c.partition('->')[2].strip(), passed), ('choice', n)))
+        elif s['type'] == 'quiz_trigger' and s['question_id'] in questions:
+            edges.append(((s['nextSceneA'], True), ('answer', True)))
+            edges.append(((s['nextSceneB'], False), ('answer', False)))
+        elif s['type'] == 'normal':
+            a, b = s['nextSceneA'], s['nextSceneB']
+            target = a if (a == b or passed) else b
+            edges.append(((target, passed), ('next',)))
+        for target, action in edges:
+            if target[0] in by_id and target not in parents:
+                parents[target] = (state, action)
+                queue.append(target)
+    return parents
+
+def route_script(state, parents, by_id, questions, backlog=False):
+    path, cur = [], state
+    while parents[cur]:
+        prev, action = parents[cur]
+        path.append((prev, action))
+        cur = prev
+    path.reverse()
+
+    script = Script()
+    script.press(BUTTON_START, SETTLE_FRAMES)
+    names = ['title']
+    steps = [(prev[0], action) for prev, action in path] + [(state[0], None)]
+    for scene_id, action in steps:
+        s = by_id[scene_id]
+        script.lines.append(f"0 {len(s['text']) + TEXT_MARGIN}")
+        script.dump(f'scene_{scene_id}')
+        names.append(f'scene_{scene_id}')
+        if action is None:
+            break
+        if action[0] == 'choice':
+            for _ in range(action[1]):
+                script.press(BUTTON_DOWN, 4)
+            script.press(BUTTON_A, 4)
+        elif action[0] == 'answer':
+            script.press(BUTTON_A, SETTLE_FRAMES)
+            qid = s['question_id']
+            script.dump(f'quiz_{qid}')
+            names.append(f'quiz_{qid}')
+            correct = questions[qid]['correct'].strip().lower()
+            answer = correct if action[1] else next(k for k in 'abc' if k != correct)
+            script.press(ANSWER_BUTTONS[answer], SETTLE_FRAMES)
+        else:
+            script.press(BUTTON_A, 4)
+
+    if backlog:
+        # Newest entry first, Up scrolls to the older ones
+        script.press(BUTTON_START, SETTLE_FRAMES)
+        for n in range(len(steps)):
+            if n:
+                script.press(BUTTON_UP, SETTLE_FRAMES)
+            script.dump(f'backlog_{n + 1}')
+            names.append(f'backlog_{n + 1}')
+        script.press(BUTTON_B, SETTLE_FRAMES)
+
+    s = by_id[state[0]]
+    dead_end = s['type'] == 'normal' and not s['nextSceneA'] and not s['nextSceneB']
+    if s['type'] in ('good_ending', 'bad_ending') or dead_end:
+        script.press(BUTTON_A, SETTLE_FRAMES)
+        name = 'ending_good' if s['type'] == 'good_ending' else 'ending_bad'
+        script.dump(name)
+        names.append(name)
+    return script, names
+
+# ---------- compare ----------
+def same_image(a, b):
+    if (a.width, a.height) != (b.width, b.height):
+        return False
+    return all(a.rgba(x, y) == b.rgba(x, y) for y in range(a.height) for x in range(a.width))
+
+def run_routes(exe, scenes, questions, goldens: Path, out_dir: Path, build_dir: Path, update, skip=(),
+               backlog=False):
+    """Dumps every screen on the routes but the ones in skip, returns the
+    names and the ones different from the goldens. With backlog the first,
+    longest, route pages through the backlog."""
+    by_id = {s['scene_id']: s for s in scenes}
+    out_dir.mkdir(parents=True, exist_ok=True)
+    parents = plan_routes(scenes, questions)
+    reached = {scene_id for scene_id, _ in parents}
+    for s in scenes:
+        if s['scene_id'] not in reached:
+            print(f"warning: scene {s['scene_id']} is not reachable by single questions and choices")
+
+    done, failed = set(skip), []
+    routes = sorted(parents, key=lambda st: len(route_script(st, parents, by_id, questions)[1]), reverse=True)
+    for n, state in enumerate(routes):
+        script, names = route_script(state, parents, by_id, questions, backlog and n == 0)
+        if all(n in done for n in names):
+            continue
+        script_path = build_dir / 'input.txt'
+        script_path.write_text('\n'.join(script.lines) + '\n', encoding='utf-8')
+        subprocess.run([str(exe.resolve()), str(script_path), str(out_dir)], check=True)
+
+        for name in names:
+            if name in done:
+                continue
+            done.add(name)
+            img = render_vdp.render(render_vdp.load_dump(out_dir / f'{name}.bin'))
+            golden = goldens / f'{name}.png'
+            if update:
+                goldens.mkdir(parents=True, exist_ok=True)
+                image_io.write_png(golden, img)
+            elif not golden.exists() or not same_image(img, image_io.read_png(golden)):
+                image_io.write_png(out_dir / f'{name}.png', img)
+                failed.append(name)
+    return done - set(skip), failed
+
+# ---------- main ----------
+def main():
+    args = [a for a in sys.argv[1:] if a != '--update']
+    update = '--update' in sys.argv
+    if len(args) != 3:
+        print("Usage: snapshot.py <scenes.txt> <questions.csv> <goldens dir> [--update]")
+        sys.exit(1)
+
+    questions_path = Path(args[1])
+    questions = {q['id']: q for q in parse_questions_csv(questions_path)}
+    goldens = Path(args[2])
+
+    exe = build_headless(BUILD_DIR, Path('src/data_load.c'))
+    done, failed = run_routes(exe, parse_scenes(Path(args[0])), questions, goldens, OUT_DIR, BUILD_DIR, update)
+
+    fixtures = goldens / FIXTURES / 'scenes.txt'
+    if fixtures.exists():
+        build_dir = BUILD_DIR / FIXTURES
+        exe = build_headless(build_dir, compile_fixtures(fixtures, questions_path, build_dir))
+        more, more_failed = run_routes(exe, parse_scenes(fixtures), questions, goldens / FIXTURES,
+                                       OUT_DIR / FIXTURES, build_dir, update,
+                                       skip=done, backlog=True)
+        done |= {f'{FIXTURES}/{n}' for n in more}
+        failed += [f'{FIXTURES}/{n}' for n in more_failed]
+
+    print(f"{len(done)} snapshots, {'updated' if update else f'{len(failed)} different'}")
+    if failed:
+        print('Different from the goldens (renders in ' + str(OUT_DIR) + '):\n  ' + '\n  '.join(sorted(failed)))
+        sys.exit(1)
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/snapshot.py data/scenes.txt data/questions.csv data/snapshots --update
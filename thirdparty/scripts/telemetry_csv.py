@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+# Decodes the play telemetry ring (inc/telemetry.h) from an SRAM dump into
+# CSV, one row per event in the order they happened. Dumps may hold the
+# SRAM bytes packed (.srm of most emulators, headless "sram" steps) or
+# interleaved with the unused half of each word. With the data sources the
+# scene, quiz and question columns show string IDs instead of indices.
+import csv, struct, sys
+from pathlib import Path
+
+MAGIC = b'KTL1'
+HEADER_SIZE = 16
+RECORD_SIZE = 8
+RECORDS = 254                       # TELEMETRY_RECORDS
+NO_QUIZ = 0xFFFF
+KINDS = {1: 'session', 2: 'scene', 3: 'answer', 4: 'quiz'}
+COLUMNS = ['session', 'event', 'scene', 'quiz', 'question', 'answer', 'correct',
+           'wrong', 'frames', 'seconds', 'path']
+
+# ---------- helpers ----------
+def sram_bytes(data: bytes):
+    """The SRAM in offset order, whichever way the dump stores it."""
+    for start, step in ((0, 1), (1, 2), (0, 2)):
+        if data[start:start + 4 * step:step] == MAGIC:
+            return data[start::step]
+    raise SystemExit('no telemetry in this dump (magic KTL1 not found)')
+
+def read_records(sram: bytes):
+    sessions, head, written = struct.unpack_from('>HHH', sram, 4)
+    count = min(written, RECORDS)
+    first = head if written >= RECORDS else 0
+    out = []
+    for i in range(count):
+        at = HEADER_SIZE + ((first + i) % RECORDS) * RECORD_SIZE
+        out.append(struct.unpack_from('>BBHHH', sram, at))
+    return sessions, out
+
+def load_names(scenes_path, questions_path, quizzes_path):
+    sys.path.insert(0, str(Path(__file__).parent))
+    from compile_data import parse_scenes, parse_questions_csv, parse_quizzes
+    return ([s['scene_id'] for s in parse_scenes(Path(scenes_path))],
+            [r['id'] for r in parse_questions_csv(Path(questions_path))],
+            [q['quiz_id'] for q in parse_quizzes(Path(quizzes_path))])
+
+def name(names, index):
+    return names[index] if names and index < len(names) else index
+
+def rows(records, scenes, questions, quizzes, hz):
+    session = ''
+    for kind, a, b, c, d in records:
+        row = dict.fromkeys(COLUMNS, '')
+        row['event'] = KINDS.get(kind, kind)
+        if kind == 1:
+            session = b
+        elif kind == 2:
+            row.update(scene=name(scenes, b), frames=c, path='pass' if a else 'fail')
+        elif kind == 3:
+            row.update(question=name(questions, b), answer='ABC'[a] if a < 3 else a,
+                       correct=d, frames=c)
+        elif kind == 4:
+            row.update(quiz='single' if b == NO_QUIZ else name(quizzes, b), wrong=d, frames=c,
+                       path='pass' if a else 'fail')
+        if row['frames'] != '':
+            row['seconds'] = f'{row["frames"] / hz:.2f}'
+        row['session'] = session
+        yield row
+
+# ---------- main ----------
+def main():
+    args = [a for a in sys.argv[1:] if not a.startswith('--')]
+    if len(args) not in (2, 5):
+        print("Usage: telemetry_csv.py <sram dump> <out.csv> [<scenes.txt> <questions.csv> <quizzes.txt>] [--pal]")
+        sys.exit(1)
+    hz = 50 if '--pal' in sys.argv else 60
+    scenes = questions = quizzes = None
+    if len(args) == 5:
+        scenes, questions, quizzes = load_names(*args[2:])
+
+    sessions, records = read_records(sram_bytes(Path(args[0]).read_bytes()))
+    with open(args[1], 'w', newline='', encoding='utf-8') as f:
+        w = csv.DictWriter(f, fieldnames=COLUMNS)
+        w.writeheader()
+        for row in rows(records, scenes, questions, quizzes, hz):
+            w.writerow(row)
+    print(f'{len(records)} events over {sessions} sessions to {args[1]}')
+
+if __name__ == '__main__':
+    main()
+
+#python3 thirdparty/scripts/telemetry_csv.py out/rom.srm out/telemetry.csv data/scenes.txt data/questions.csv data/quizzes.txt